@@ -44,6 +44,7 @@
 #define MAX_CCB4_BYTES	148	// maximum byte mode capacity for ccb4
 
 #define MAX_CCC_CW	863	// ccc max data codewords
+#define MAX_CCC_ALL_CW	928	// ccc max codewords including ecc
 #define MAX_CCC_ROWS	90	// ccc max rows
 #define MAX_CCC_BYTES	1033	// maximum byte mode capacity for ccc
 
@@ -51,13 +52,15 @@
 #define MAX_CCA3_SIZE	4	// index to 167 in CC3Sizes
 #define MAX_CCA4_SIZE	4	// index to 197 in CC4Sizes
 
-int gs1_CC2enc(gs1_encoder *ctx, uint8_t str[], uint8_t pattern[MAX_CCB4_ROWS][CCB4_ELMNTS]);
-int gs1_CC3enc(gs1_encoder *ctx, uint8_t str[], uint8_t pattern[MAX_CCB4_ROWS][CCB4_ELMNTS]);
-int gs1_CC4enc(gs1_encoder *ctx, uint8_t str[], uint8_t pattern[MAX_CCB4_ROWS][CCB4_ELMNTS]);
-bool gs1_CCCenc(gs1_encoder *ctx, uint8_t str[], uint8_t pattern[]);
+char* gs1_splitCC(gs1_encoder *ctx, int *primaryLen, int *ccLen);
+int gs1_CC2enc(gs1_encoder *ctx, uint8_t str[], int len, uint8_t pattern[MAX_CCB4_ROWS][CCB4_ELMNTS]);
+int gs1_CC3enc(gs1_encoder *ctx, uint8_t str[], int len, uint8_t pattern[MAX_CCB4_ROWS][CCB4_ELMNTS]);
+int gs1_CC4enc(gs1_encoder *ctx, uint8_t str[], int len, uint8_t pattern[MAX_CCB4_ROWS][CCB4_ELMNTS]);
+bool gs1_CCCenc(gs1_encoder *ctx, uint8_t str[], int len);
+bool gs1_CCCsize(gs1_encoder *ctx, uint8_t str[], int len);
 
-int gs1_check2DData(uint8_t dataStr[]);
-int gs1_pack(gs1_encoder *ctx, uint8_t str[], uint8_t bitField[]);
+int gs1_check2DData(uint8_t dataStr[], int len);
+int gs1_pack(gs1_encoder *ctx, uint8_t str[], int len, uint8_t bitField[]);
 void gs1_putBits(gs1_encoder *ctx, uint8_t bitField[], int bitPos, int length, uint16_t bits);
 
 #endif /* CC_H */
@@ -20,13 +20,19 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
 
 #include "enc-private.h"
 #include "driver.h"
 
 
-void gs1_bmpHeader(long xdim, long ydim, FILE *oFile) {
+void gs1_bmpHeader(long xdim, long ydim, int dpi, FILE *oFile) {
 
 	uint8_t id[2] = {'B','M'};
 	struct b_hdr {
@@ -54,13 +60,17 @@ void gs1_bmpHeader(long xdim, long ydim, FILE *oFile) {
 	header.width = (uint32_t)xdim;
 	header.height = (uint32_t)ydim;
 	header.fileLength = (uint32_t)(0x3E + (((xdim+31)/32)*4) * ydim); // pad rows to 32-bit boundary
+	if (dpi > 0) { // pixels per meter
+		header.const0d = (uint32_t)((dpi*5000L + 63) / 127);
+		header.const0e = header.const0d;
+	}
 
 	fwrite(&id, sizeof(id), 1, oFile);
 	fwrite(&header, sizeof(header), 1, oFile);
 }
 
 
-void gs1_tifHeader(long xdim, long ydim, FILE *oFile) {
+void gs1_tifHeader(long xdim, long ydim, int dpi, FILE *oFile) {
 
 	struct t_hdr {
 		uint8_t endian[2];
@@ -103,6 +113,11 @@ void gs1_tifHeader(long xdim, long ydim, FILE *oFile) {
 	stripBytes.offset = (uint32_t)(((xdim+7)/8) * ydim);
 	xResData[1] = 1L; //reduce to 10 mils
 	yResData[1] = 1L; //reduce to 10 mils
+	if (dpi > 0) {
+		resUnit.offset = 2L; // inches
+		xResData[0] = (uint32_t)dpi;
+		yResData[0] = (uint32_t)dpi;
+	}
 
 	fwrite(&header, sizeof(header), 1, oFile);
 	fwrite(&tagnum, sizeof(tagnum), 1, oFile);
@@ -127,42 +142,233 @@ void gs1_tifHeader(long xdim, long ydim, FILE *oFile) {
 }
 
 
-static void printElm(gs1_encoder *ctx, int width, int color, int *bits, int *ndx, uint8_t xorMsk) {
+/*
+ * ZPL ^GF graphic field using ASCII hex with the "alternative data
+ * compression scheme" understood by Zebra printers. Each line is run-length
+ * coded and a line identical to its predecessor is sent as a single ':'.
+ */
+void gs1_zplHeader(long xdim, long ydim, FILE *oFile) {
+
+	long bytesPerRow = (xdim+7)/8;
+
+	fprintf(oFile, "^XA\n^FO0,0^GFA,%ld,%ld,%ld,", bytesPerRow*ydim, bytesPerRow*ydim, bytesPerRow);
+	return;
+}
+
+
+void gs1_zplTrailer(FILE *oFile) {
+
+	fprintf(oFile, "^FS\n^XZ\n");
+	return;
+}
+
+
+static void zplRun(int cnt, char c, FILE *oFile) {
+
+	int n;
+
+	while (cnt > 0) {
+		n = min(cnt, 419); // longest run that a single z..Y prefix can express
+		cnt -= n;
+		if (n <= 2) {
+			while (n-- > 0) fputc(c, oFile);
+			continue;
+		}
+		if (n >= 20)
+			fputc('g' + n/20 - 1, oFile);
+		if (n % 20 != 0)
+			fputc('G' + n%20 - 1, oFile);
+		fputc(c, oFile);
+	}
+	return;
+}
+
+
+static void zplLine(gs1_encoder *ctx, uint8_t *line, int ndx) {
+
+	static const char hex[] = "0123456789ABCDEF";
+	char lineHex[2*(MAX_LINE/8 + 1)];
+	int i, j, len;
+
+	if (ndx == ctx->driver_linePrevLen && memcmp(line, ctx->driver_linePrev, (size_t)ndx) == 0) {
+		fputc(':', ctx->outfp);
+		return;
+	}
+	memcpy(ctx->driver_linePrev, line, (size_t)ndx);
+	ctx->driver_linePrevLen = ndx;
+
+	len = 0;
+	for (i = 0; i < ndx; i++) {
+		lineHex[len++] = hex[line[i] >> 4];
+		lineHex[len++] = hex[line[i] & 0x0F];
+	}
+
+	for (i = 0; i < len; i = j) {
+		for (j = i+1; j < len && lineHex[j] == lineHex[i]; j++);
+		if (j == len && lineHex[i] == '0') {
+			fputc(',', ctx->outfp); // fill rest of line with white
+			break;
+		}
+		if (j == len && lineHex[i] == 'F') {
+			fputc('!', ctx->outfp); // fill rest of line with black
+			break;
+		}
+		zplRun(j-i, lineHex[i], ctx->outfp);
+	}
+	return;
+}
+
+
+static void writeLine(gs1_encoder *ctx, uint8_t *line, int ndx, int cnt) {
 
 	int i;
-	uint8_t *line = ctx->driver_line;
-	uint8_t *lineUCut = ctx->driver_lineUCut;
 
-	for (i = 0; i < width; i++) {
-		*bits = (*bits<<1) + color;
-		if (*bits > 0xff) {
-			lineUCut[*ndx] = (uint8_t)(((line[*ndx]^xorMsk)&(*bits&0xff))^xorMsk); // Y undercut
-			line[(*ndx)++] = (uint8_t)((*bits&0xff) ^ xorMsk);
-			if (*ndx >= MAX_LINE/8 + 1) {
-				*ndx = 0;
+	for (i = 0; i < cnt; i++) {
+		if (ctx->format == fZPL)
+			zplLine(ctx, line, ndx);
+		else
+			fwrite(line, sizeof(uint8_t), (size_t)ndx, ctx->outfp);
+	}
+	return;
+}
+
+
+/*
+ * In sheet mode each line of a symbol is OR'ed into the shared sheet bitmap
+ * at the symbol's pixel offset rather than being written out.
+ */
+static void sheetLine(gs1_encoder *ctx, uint8_t *line, int ndx, int cnt, long *py) {
+
+	long bytesPerRow = (ctx->driver_sheetW+7)/8;
+	long room = bytesPerRow - ctx->driver_sheetPx/8;
+	int shift = (int)(ctx->driver_sheetPx & 7);
+	uint8_t *dst;
+	int i;
+
+	for ( ; cnt > 0 && *py < ctx->driver_sheetH; cnt--) {
+		dst = &ctx->driver_sheet[(*py)++ * bytesPerRow + ctx->driver_sheetPx/8];
+		for (i = 0; i < ndx && i < room; i++) {
+			dst[i] |= (uint8_t)(line[i] >> shift);
+			if (shift != 0 && i+1 < room)
+				dst[i+1] |= (uint8_t)(line[i] << (8-shift));
+		}
+	}
+	return;
+}
+
+
+static void outputLine(gs1_encoder *ctx, uint8_t *line, int ndx, int cnt) {
+
+	if (ctx->driver_sheet != NULL)
+		sheetLine(ctx, line, ndx, cnt, &ctx->driver_sheetPy);
+	else if (ctx->rowCallback != NULL) {
+		if (cnt > 0)
+			ctx->rowCallback(ctx->rowCallbackData, line, (int)ctx->driver_xdim, cnt);
+	}
+	else
+		writeLine(ctx, line, ndx, cnt);
+	return;
+}
+
+
+// BMP bits are inverted and padded only when lines go straight to the file
+static bool bmpLines(gs1_encoder *ctx) {
+	return ctx->format == fBMP && ctx->driver_sheet == NULL && ctx->rowCallback == NULL;
+}
+
+
+struct lineWriterT {
+	uint64_t acc;	// pixels not yet written to the line, right aligned
+	int accBits;
+	int ndx;	// next byte of the line
+	uint8_t xorMsk;
+	uint8_t *line;	// holds the line above until overwritten
+	uint8_t *lineUCut;
+};
+
+
+// appends a run of pixels, a byte at a time rather than a pixel at a time
+static void printElm(gs1_encoder *ctx, int width, int color, struct lineWriterT *lw) {
+
+	int n;
+	uint8_t b;
+	uint8_t *line = lw->line;
+	uint8_t *lineUCut = lw->lineUCut;
+
+	while (width > 0) {
+		n = min(width, 32);
+		lw->acc = (lw->acc << n) | (color ? (UINT64_C(1) << n) - 1 : 0);
+		lw->accBits += n;
+		width -= n;
+		while (lw->accBits >= 8) {
+			lw->accBits -= 8;
+			b = (uint8_t)(lw->acc >> lw->accBits);
+			lineUCut[lw->ndx] = (uint8_t)(((line[lw->ndx]^lw->xorMsk)&b)^lw->xorMsk); // Y undercut
+			line[lw->ndx++] = (uint8_t)(b ^ lw->xorMsk);
+			if (lw->ndx >= MAX_LINE/8 + 1) {
+				lw->ndx = 0;
 				strcpy(ctx->errMsg, "Print line too long in graphic line.");
 				ctx->errFlag = true;
 				return;
 			}
-			*bits = 1;
 		}
 	}
 	return;
 }
 
 
+/*
+ * Pixel width of the next "mods" modules of a row, "pos" being the module
+ * offset from the left edge. Module edges are placed at the nearest pixel
+ * so that fractional module widths are distributed evenly along the row and
+ * rows of a stacked symbol stay aligned.
+ */
+static long modToPix(gs1_encoder *ctx, long mods) {
+	return (long)(((int64_t)mods*ctx->driver_xNum + ctx->driver_xDen/2) / ctx->driver_xDen);
+}
+
+static int modPixels(gs1_encoder *ctx, long *pos, int mods) {
+
+	long start;
+
+	if (ctx->driver_xDen == 1) { // whole pixels per X
+		*pos += mods;
+		return (int)(mods*ctx->driver_xNum);
+	}
+	start = modToPix(ctx, *pos);
+
+	*pos += mods;
+	return (int)(modToPix(ctx, *pos) - start);
+}
+
+
 #define WHITE 0
 
-void gs1_printElmnts(gs1_encoder *ctx, struct sPrints *prints) {
+// the first line of a symbol has no line above it to undercut against
+static void firstLine(gs1_encoder *ctx, uint8_t xorMsk) {
 
-	int i, bits, width, ndx, white;
-	uint8_t xorMsk;
+	if (ctx->line1) {
+		memset(ctx->driver_line, xorMsk, MAX_LINE/8);
+		ctx->line1 = false;
+	}
+	return;
+}
+
+
+// draws a row into line, which holds the line above, and its Y undercut into
+// lineUCut, returning the line length in bytes
+static int rasterRow(gs1_encoder *ctx, struct sPrints *prints, uint8_t *line, uint8_t *lineUCut, int *pixBytes) {
+
+	int i, width, white;
 	int undercut;
-	uint8_t *line = ctx->driver_line;
-	uint8_t *lineUCut = ctx->driver_lineUCut;
+	struct lineWriterT lw;
+	long pos = 0;
 
-	bits = 1;
-	ndx = 0;
+	lw.acc = 0;
+	lw.accBits = 0;
+	lw.ndx = 0;
+	lw.line = line;
+	lw.lineUCut = lineUCut;
 	if (prints->whtFirst) {
 		white = WHITE;
 		undercut = ctx->Xundercut;
@@ -175,96 +381,687 @@ void gs1_printElmnts(gs1_encoder *ctx, struct sPrints *prints) {
 		white = white^1; // invert if reversed even elements
 		undercut = -undercut;
 	}
-	xorMsk = ctx->bmp ? 0xFF : 0; // invert BMP bits
-	if (ctx->line1) {
-		for (i = 0; i < MAX_LINE/8; i++) {
-			line[i] = xorMsk;
-		}
-		ctx->line1 = false;
-	}
+	lw.xorMsk = bmpLines(ctx) ? 0xFF : 0; // invert BMP bits
 	// fill left pad worth of WHITE
-	printElm(ctx, prints->leftPad*ctx->pixMult, WHITE , &bits, &ndx, xorMsk);
+	printElm(ctx, modPixels(ctx, &pos, prints->leftPad), WHITE , &lw);
 
 	// process WHITE/BLACK elements in pairs for undercut
 	if (prints->guards) { // print guard pattern
-		printElm(ctx, ctx->pixMult + undercut, white , &bits, &ndx, xorMsk);
-		printElm(ctx, ctx->pixMult - undercut, (white^1) , &bits, &ndx, xorMsk);
+		printElm(ctx, modPixels(ctx, &pos, 1) + undercut, white , &lw);
+		printElm(ctx, modPixels(ctx, &pos, 1) - undercut, (white^1) , &lw);
 	}
 	for(i = 0; i < prints->elmCnt-1; i += 2) {
 		if (prints->reverse) {
-			width = (int)prints->pattern[prints->elmCnt-1-i]*ctx->pixMult + undercut;
+			width = modPixels(ctx, &pos, prints->pattern[prints->elmCnt-1-i]) + undercut;
 		}
 		else {
-			width = (int)prints->pattern[i]*ctx->pixMult + undercut;
+			width = modPixels(ctx, &pos, prints->pattern[i]) + undercut;
 		}
-		printElm(ctx, width, white , &bits, &ndx, xorMsk);
+		printElm(ctx, width, white , &lw);
 
 		if (prints->reverse) {
-			width = (int)prints->pattern[prints->elmCnt-2-i]*ctx->pixMult - undercut;
+			width = modPixels(ctx, &pos, prints->pattern[prints->elmCnt-2-i]) - undercut;
 		}
 		else {
-			width = (int)prints->pattern[i+1]*ctx->pixMult - undercut;
+			width = modPixels(ctx, &pos, prints->pattern[i+1]) - undercut;
 		}
-		printElm(ctx, width, (white^1) , &bits, &ndx, xorMsk);
+		printElm(ctx, width, (white^1) , &lw);
 	}
 
 	// process any trailing odd numbered element with no undercut
 	if (i < prints->elmCnt) {
 		if (prints->guards) { // print last element plus guard pattern
 			if (prints->reverse) {
-				width = (int)prints->pattern[0]*ctx->pixMult + undercut;
+				width = modPixels(ctx, &pos, prints->pattern[0]) + undercut;
 			}
 			else {
-				width = (int)prints->pattern[i]*ctx->pixMult + undercut;
+				width = modPixels(ctx, &pos, prints->pattern[i]) + undercut;
 			}
-			printElm(ctx, width, white , &bits, &ndx, xorMsk);
+			printElm(ctx, width, white , &lw);
 
-			printElm(ctx, ctx->pixMult - undercut, (white^1) , &bits, &ndx, xorMsk);
-			printElm(ctx, ctx->pixMult, white , &bits, &ndx, xorMsk); // last- no undercut
+			printElm(ctx, modPixels(ctx, &pos, 1) - undercut, (white^1) , &lw);
+			printElm(ctx, modPixels(ctx, &pos, 1), white , &lw); // last- no undercut
 		}
 		else { // no guard, print last odd without undercut
 			if (prints->reverse) {
-				width = (int)prints->pattern[0]*ctx->pixMult;
+				width = modPixels(ctx, &pos, prints->pattern[0]);
 			}
 			else {
-				width = (int)prints->pattern[i]*ctx->pixMult;
+				width = modPixels(ctx, &pos, prints->pattern[i]);
 			}
-			printElm(ctx, width, white , &bits, &ndx, xorMsk);
+			printElm(ctx, width, white , &lw);
 		}
 	}
 	else if (prints->guards) { // even number, just print guard pattern
-		printElm(ctx, ctx->pixMult + undercut, white , &bits, &ndx, xorMsk);
-		printElm(ctx, ctx->pixMult - undercut, (white^1) , &bits, &ndx, xorMsk);
+		printElm(ctx, modPixels(ctx, &pos, 1) + undercut, white , &lw);
+		printElm(ctx, modPixels(ctx, &pos, 1) - undercut, (white^1) , &lw);
 	}
 	// fill right pad worth of WHITE
-	printElm(ctx, prints->rightPad*ctx->pixMult, WHITE , &bits, &ndx, xorMsk);
+	printElm(ctx, modPixels(ctx, &pos, prints->rightPad), WHITE , &lw);
 	// pad last byte's bits
-	if (bits != 1) {
-		while ((bits = (bits<<1) + WHITE) <= 0xff);
-		lineUCut[ndx] = (uint8_t)(((line[ndx]^xorMsk)&(bits&0xff))^xorMsk); // Y undercut
-		line[ndx++] = (uint8_t)((bits&0xff) ^ xorMsk);
-		if (ndx > MAX_LINE/8 + 1) {
-			strcpy(ctx->errMsg, "Print line too long");
-			ctx->errFlag = true;
-			return;
-		}
+	if (lw.accBits > 0) {
+		printElm(ctx, 8 - lw.accBits, WHITE, &lw);
 	}
-	if (ctx->bmp) {
-		while ((ndx & 3) != 0) {
-			line[ndx++] = 0xFF; // pad to long word boundary for .BMP
-			if (ndx >= MAX_LINE/8 + 1) {
+	*pixBytes = lw.ndx;
+	if (bmpLines(ctx)) {
+		while ((lw.ndx & 3) != 0) {
+			line[lw.ndx++] = 0xFF; // pad to long word boundary for .BMP
+			if (lw.ndx >= MAX_LINE/8 + 1) {
 				strcpy(ctx->errMsg, "Print line too long");
 				ctx->errFlag = true;
-				return;
+				return -1;
 			}
 		}
 	}
+	return lw.ndx;
+}
+
 
-	for (i = 0; i < ctx->Yundercut; i++) {
-		fwrite(lineUCut, sizeof(uint8_t), (size_t)ndx, ctx->outfp);
+void gs1_printElmnts(gs1_encoder *ctx, struct sPrints *prints) {
+
+	int ndx, pixBytes;
+
+	firstLine(ctx, bmpLines(ctx) ? 0xFF : 0);
+	if ((ndx = rasterRow(ctx, prints, ctx->driver_line, ctx->driver_lineUCut, &pixBytes)) < 0) return;
+	outputLine(ctx, ctx->driver_lineUCut, ndx, ctx->Yundercut);
+	outputLine(ctx, ctx->driver_line, ndx, prints->height - ctx->Yundercut);
+	return;
+}
+
+
+/*
+ * With reuseLinear set the linear component is kept from one encode to the
+ * next: the pattern of the last primary encoded, and the drawn lines of the
+ * rows outside the 2D component keyed by their elements. A run that only
+ * changes the composite data then skips the linear encoder and redraws only
+ * the 2D rows. Fixed rows, whose elements depend only on the symbol layout,
+ * are drawn through the line cache too. The separators worked out for
+ * linear rows are kept too, keyed by the row's elements.
+ */
+#define RASTER_ROWS 48	// enough for an 11 row RSS Expanded with separators
+#define SEP_ROWS 24	// separators of an 11 row RSS Expanded with a composite
+#define MAX_RASTER_ELMNTS (RSSEXP_MAX_DBL_SEGS*RSSEXP_SYM_W+2)	// RSS Expanded chex row
+
+struct rasterT {
+	int elmCnt;
+	int leftPad;
+	int rightPad;
+	int guards;
+	int whtFirst;
+	int reverse;
+	uint8_t pattern[MAX_RASTER_ELMNTS];
+	int ndx;	// line length in bytes, with BMP padding
+	int pixBytes;	// line length without BMP padding
+	uint8_t line[MAX_LINE/8 + 1];
+};
+
+struct sepT {
+	int elmCnt;
+	int whtFirst;
+	uint8_t pattern[MAX_SEP_ELMNTS];	// row the separator is for
+	int sepCnt;
+	uint8_t sepPattern[MAX_SEP_ELMNTS];
+};
+
+struct linCacheT {
+	int valid;	// the linear pattern below is for the key
+	int sym;
+	int link;
+	int rowWidth;	// RSS Expanded segments per row packed for
+	int optimalPack;
+	int keyLen;
+	char key[GS1_ENCODERS_MAX_DATA+1];	// primary data
+	int result;	// linear encoder return value
+	int patLen;
+	uint8_t pattern[MAX_LIN_ELMNTS];
+	int64_t xNum;	// drawing parameters of the cached lines
+	int64_t xDen;
+	int Xundercut;
+	uint8_t xorMsk;
+	int rasterCnt;
+	int rasterNext;	// entry to replace when full
+	struct rasterT raster[RASTER_ROWS];
+	int sepCnt;
+	int sepNext;	// entry to look at first, after the last one found or saved
+	struct sepT sep[SEP_ROWS];
+};
+
+
+static bool linCache(gs1_encoder *ctx) {
+
+	if (ctx->driver_linCache == NULL) {
+		ctx->driver_linCache = calloc(1, sizeof(struct linCacheT));
+		if (ctx->driver_linCache == NULL) {
+			strcpy(ctx->errMsg, "Out of memory for linear cache");
+			ctx->errFlag = true;
+			return false;
+		}
 	}
-	for ( ; i < prints->height; i++) {
-		fwrite(line, sizeof(uint8_t), (size_t)ndx, ctx->outfp);
+	return true;
+}
+
+
+// returns the saved linear encoder result for primary, or 0 after noting primary for gs1_driverLinPut
+int gs1_driverLinGet(gs1_encoder *ctx, const char *primary, int len, int link, uint8_t pattern[], int patLen) {
+
+	struct linCacheT *lc;
+
+	if (!ctx->reuseLinear || len > GS1_ENCODERS_MAX_DATA || patLen > MAX_LIN_ELMNTS || !linCache(ctx)) return 0;
+	lc = ctx->driver_linCache;
+	if (lc->valid && lc->sym == ctx->sym && lc->link == link &&
+			lc->rowWidth == ctx->rowWidth && lc->optimalPack == ctx->optimalPack &&
+			lc->keyLen == len && memcmp(lc->key, primary, (size_t)len) == 0 && lc->patLen == patLen) {
+		memcpy(pattern, lc->pattern, (size_t)patLen);
+		return lc->result;
+	}
+
+	// the encoders rewrite their input so the key is taken before encoding
+	lc->valid = false;
+	lc->sym = ctx->sym;
+	lc->link = link;
+	lc->rowWidth = ctx->rowWidth;
+	lc->optimalPack = ctx->optimalPack;
+	lc->keyLen = len;
+	memcpy(lc->key, primary, (size_t)len);
+	lc->patLen = patLen;
+	return 0;
+}
+
+
+// saves the pattern for the primary data of the last gs1_driverLinGet miss
+void gs1_driverLinPut(gs1_encoder *ctx, const uint8_t pattern[], int patLen, int result) {
+
+	struct linCacheT *lc = ctx->driver_linCache;
+
+	if (!ctx->reuseLinear || lc == NULL || lc->patLen != patLen || result <= 0 || ctx->errFlag) return;
+	memcpy(lc->pattern, pattern, (size_t)patLen);
+	lc->result = result;
+	lc->valid = true;
+	return;
+}
+
+
+// returns the saved separator element count for the row, 0 if none, filling in sepPattern
+int gs1_driverSepGet(gs1_encoder *ctx, const struct sPrints *prints, uint8_t sepPattern[]) {
+
+	struct linCacheT *lc = ctx->driver_linCache;
+	struct sepT *s;
+	int i, ndx;
+
+	if (!ctx->reuseLinear || lc == NULL) return 0;
+	for (i = 0; i < lc->sepCnt; i++) {
+		ndx = (lc->sepNext + i) % lc->sepCnt; // rows come in the same order each encode
+		s = &lc->sep[ndx];
+		if (s->elmCnt == prints->elmCnt && s->whtFirst == prints->whtFirst &&
+				memcmp(s->pattern, prints->pattern, (size_t)prints->elmCnt) == 0) {
+			memcpy(sepPattern, s->sepPattern, (size_t)s->sepCnt);
+			lc->sepNext = (ndx+1) % lc->sepCnt;
+			return s->sepCnt;
+		}
+	}
+	return 0;
+}
+
+
+// saves the separator elements worked out for the row
+void gs1_driverSepPut(gs1_encoder *ctx, const struct sPrints *prints, const uint8_t sepPattern[], int sepCnt) {
+
+	struct linCacheT *lc = ctx->driver_linCache;
+	struct sepT *s;
+
+	if (!ctx->reuseLinear || lc == NULL || prints->elmCnt > MAX_SEP_ELMNTS || sepCnt > MAX_SEP_ELMNTS) return;
+	if (lc->sepCnt < SEP_ROWS) {
+		s = &lc->sep[lc->sepCnt++];
+	}
+	else {
+		s = &lc->sep[lc->sepNext];
 	}
+	s->elmCnt = prints->elmCnt;
+	s->whtFirst = prints->whtFirst;
+	memcpy(s->pattern, prints->pattern, (size_t)prints->elmCnt);
+	s->sepCnt = sepCnt;
+	memcpy(s->sepPattern, sepPattern, (size_t)sepCnt);
+	lc->sepNext = (int)(s - lc->sep + 1) % lc->sepCnt;
+	return;
+}
+
+
+static struct rasterT *findRaster(struct linCacheT *lc, struct sPrints *prints) {
+
+	struct rasterT *r;
+	int i;
+
+	for (i = 0; i < lc->rasterCnt; i++) {
+		r = &lc->raster[i];
+		if (r->elmCnt == prints->elmCnt && r->leftPad == prints->leftPad &&
+				r->rightPad == prints->rightPad && r->guards == prints->guards &&
+				r->whtFirst == prints->whtFirst && r->reverse == prints->reverse &&
+				memcmp(r->pattern, prints->pattern, (size_t)prints->elmCnt) == 0) {
+			return r;
+		}
+	}
+	return NULL;
+}
+
+
+static void saveRaster(struct linCacheT *lc, struct sPrints *prints, uint8_t *line, int ndx, int pixBytes) {
+
+	struct rasterT *r;
+
+	if (lc->rasterCnt < RASTER_ROWS) {
+		r = &lc->raster[lc->rasterCnt++];
+	}
+	else {
+		r = &lc->raster[lc->rasterNext];
+		lc->rasterNext = (lc->rasterNext+1) % RASTER_ROWS;
+	}
+	r->elmCnt = prints->elmCnt;
+	r->leftPad = prints->leftPad;
+	r->rightPad = prints->rightPad;
+	r->guards = prints->guards;
+	r->whtFirst = prints->whtFirst;
+	r->reverse = prints->reverse;
+	memcpy(r->pattern, prints->pattern, (size_t)prints->elmCnt);
+	r->ndx = ndx;
+	r->pixBytes = pixBytes;
+	memcpy(r->line, line, (size_t)ndx);
+	return;
+}
+
+
+// prints a linear or separator row, from its saved line if it has been drawn before
+static void printLinRow(gs1_encoder *ctx, struct sPrints *prints) {
+
+	struct linCacheT *lc;
+	struct rasterT *r;
+	uint8_t *line = ctx->driver_line;
+	uint8_t *lineUCut = ctx->driver_lineUCut;
+	uint8_t xorMsk = bmpLines(ctx) ? 0xFF : 0;
+	int i, ndx, pixBytes;
+
+	if (prints->elmCnt > MAX_RASTER_ELMNTS || !linCache(ctx)) {
+		gs1_printElmnts(ctx, prints);
+		return;
+	}
+	lc = ctx->driver_linCache;
+	if (lc->xNum != ctx->driver_xNum || lc->xDen != ctx->driver_xDen ||
+			lc->Xundercut != ctx->Xundercut || lc->xorMsk != xorMsk) {
+		lc->xNum = ctx->driver_xNum; // lines drawn at another scale are no use
+		lc->xDen = ctx->driver_xDen;
+		lc->Xundercut = ctx->Xundercut;
+		lc->xorMsk = xorMsk;
+		lc->rasterCnt = 0;
+		lc->rasterNext = 0;
+	}
+
+	firstLine(ctx, xorMsk);
+	if ((r = findRaster(lc, prints)) != NULL) {
+		for (i = 0; i < r->pixBytes; i++) {
+			lineUCut[i] = (uint8_t)(((line[i]^xorMsk)&(r->line[i]^xorMsk))^xorMsk); // Y undercut
+		}
+		memcpy(line, r->line, (size_t)r->ndx);
+		ndx = r->ndx;
+	}
+	else {
+		if ((ndx = rasterRow(ctx, prints, line, lineUCut, &pixBytes)) < 0) return;
+		saveRaster(lc, prints, line, ndx, pixBytes);
+	}
+	outputLine(ctx, lineUCut, ndx, ctx->Yundercut);
+	outputLine(ctx, line, ndx, prints->height - ctx->Yundercut);
+	return;
+}
+
+
+static void printRow(gs1_encoder *ctx, int i) {
+
+	if (ctx->reuseLinear && ctx->driver_rowKind[i] != rkCC)
+		printLinRow(ctx, &ctx->driver_rows[i]);
+	else
+		gs1_printElmnts(ctx, &ctx->driver_rows[i]);
+	return;
+}
+
+
+void gs1_driverFreeLinCache(gs1_encoder *ctx) {
+
+	free(ctx->driver_linCache);
+	ctx->driver_linCache = NULL;
+	return;
+}
+
+
+/*
+ * Symbols are described top to bottom as a list of rows which is serialised
+ * in whichever order the output format requires once the symbol is complete.
+ */
+static void setScale(gs1_encoder *ctx) {
+
+	if (ctx->Xdimension > 0) {
+		ctx->driver_xNum = (int64_t)ctx->Xdimension * ctx->dpi; // um*dpi per module
+		ctx->driver_xDen = 25400;
+	}
+	else {
+		ctx->driver_xNum = ctx->driver_pixMult;
+		ctx->driver_xDen = 1;
+	}
+	return;
+}
+
+
+void gs1_driverInit(gs1_encoder *ctx, long xmods, long ydim) {
+
+	setScale(ctx);
+	ctx->driver_xdim = modToPix(ctx, xmods);
+	ctx->driver_ydim = ydim;
+	ctx->driver_rowCnt = 0;
+	ctx->driver_elmCnt = 0;
+	return;
+}
+
+
+void gs1_driverAddRow(gs1_encoder *ctx, struct sPrints *prints) {
+
+	struct sPrints *row;
+	int i;
+
+	if (ctx->driver_rowCnt >= MAX_ROWS ||
+			ctx->driver_elmCnt + prints->elmCnt > MAX_ROW_ELMNTS) {
+		strcpy(ctx->errMsg, "Too many rows in symbol");
+		ctx->errFlag = true;
+		return;
+	}
+	if (ctx->sizeOnly) {
+		ctx->driver_rowCnt++; // only counted, patterns are not built
+		ctx->driver_elmCnt += prints->elmCnt;
+		return;
+	}
+
+	// copy the pattern since callers reuse their separator buffers
+	i = ctx->driver_rowCnt++;
+	ctx->driver_rowKind[i] = rkLINEAR;
+	row = &ctx->driver_rows[i];
+	*row = *prints;
+	row->pattern = &ctx->driver_rowPatterns[ctx->driver_elmCnt];
+	memcpy(row->pattern, prints->pattern, (size_t)prints->elmCnt);
+	ctx->driver_elmCnt += prints->elmCnt;
+	return;
+}
+
+
+// adds a row of the 2D component, which is never kept between encodes
+void gs1_driverAddCCRow(gs1_encoder *ctx, struct sPrints *prints) {
+
+	gs1_driverAddRow(ctx, prints);
+	if (!ctx->errFlag && !ctx->sizeOnly)
+		ctx->driver_rowKind[ctx->driver_rowCnt-1] = rkCC;
+	return;
+}
+
+
+// adds a row that is the same for every symbol of this layout, such as a checkerboard separator
+void gs1_driverAddFixedRow(gs1_encoder *ctx, struct sPrints *prints) {
+
+	gs1_driverAddRow(ctx, prints);
+	if (!ctx->errFlag && !ctx->sizeOnly)
+		ctx->driver_rowKind[ctx->driver_rowCnt-1] = rkFIXED;
+	return;
+}
+
+
+/*
+ * With renderThreads above 1 the rows of a symbol placed on a sheet are split
+ * into bands of consecutive rows, each drawn by its own thread into its own
+ * lines of the sheet. A band first draws the row above it so that its first
+ * row is Y undercut just as it would be in sequence. Bands do not use the
+ * line cache.
+ */
+#define MIN_BAND_BYTES (64*1024)	// sheet bytes per band worth a thread
+
+struct bandT {
+	gs1_encoder *ctx;
+	int first;	// rows first to last-1
+	int last;
+	long py;	// sheet line of the first row
+	uint8_t line[MAX_LINE/8 + 1];
+	uint8_t lineUCut[MAX_LINE/8 + 1];
+};
+
+
+// sheet lines taken by a row
+static long rowLines(gs1_encoder *ctx, int i) {
+	return ctx->Yundercut + max(ctx->driver_rows[i].height - ctx->Yundercut, 0);
+}
+
+
+static void drawBand(struct bandT *b) {
+
+	gs1_encoder *ctx = b->ctx;
+	struct sPrints *prints;
+	int i, ndx, pixBytes;
+
+	memset(b->line, 0, MAX_LINE/8); // no line above the symbol, sheet bits are not inverted
+	if (b->first > 0) {
+		rasterRow(ctx, &ctx->driver_rows[b->first-1], b->line, b->lineUCut, &pixBytes);
+	}
+	for (i = b->first; i < b->last; i++) {
+		prints = &ctx->driver_rows[i];
+		if ((ndx = rasterRow(ctx, prints, b->line, b->lineUCut, &pixBytes)) < 0) return;
+		sheetLine(ctx, b->lineUCut, ndx, ctx->Yundercut, &b->py);
+		sheetLine(ctx, b->line, ndx, prints->height - ctx->Yundercut, &b->py);
+	}
+	return;
+}
+
+
+#ifdef _WIN32
+static DWORD WINAPI bandThread(LPVOID arg) {
+	drawBand((struct bandT *)arg);
+	return 0;
+}
+#else
+static void *bandThread(void *arg) {
+	drawBand((struct bandT *)arg);
+	return NULL;
+}
+#endif
+
+
+// draws the symbol onto the sheet in bands, returns false if it is too small to be worth it
+static bool sheetBands(gs1_encoder *ctx) {
+
+#ifdef _WIN32
+	HANDLE threads[MAX_RENDER_THREADS];
+#else
+	pthread_t threads[MAX_RENDER_THREADS];
+#endif
+	bool started[MAX_RENDER_THREADS];
+	struct bandT *bands;
+	long lines, done, py;
+	int i, n, row;
+
+	n = min(ctx->renderThreads, ctx->driver_rowCnt);
+	n = (int)min((long)n, ctx->driver_ydim * ((ctx->driver_xdim+7)/8) / MIN_BAND_BYTES);
+	if (n < 2 || (bands = malloc((size_t)n * sizeof(struct bandT))) == NULL) {
+		return false;
+	}
+
+	// split the rows into bands of about the same number of lines
+	for (lines = 0, i = 0; i < ctx->driver_rowCnt; i++) {
+		lines += rowLines(ctx, i);
+	}
+	py = ctx->driver_sheetPy;
+	for (done = 0, row = 0, i = 0; i < n; i++) {
+		bands[i].ctx = ctx;
+		bands[i].first = row;
+		bands[i].py = py;
+		while (row < ctx->driver_rowCnt - (n-1-i) &&
+				(row == bands[i].first || i == n-1 || done < lines*(i+1)/n)) {
+			done += rowLines(ctx, row);
+			py += rowLines(ctx, row++);
+		}
+		bands[i].last = row;
+	}
+
+	for (i = 1; i < n; i++) {
+#ifdef _WIN32
+		started[i] = (threads[i] = CreateThread(NULL, 0, bandThread, &bands[i], 0, NULL)) != NULL;
+#else
+		started[i] = pthread_create(&threads[i], NULL, bandThread, &bands[i]) == 0;
+#endif
+	}
+	drawBand(&bands[0]);
+	for (i = 1; i < n; i++) {
+		if (!started[i]) {
+			drawBand(&bands[i]); // draw it here if no thread could be had
+			continue;
+		}
+#ifdef _WIN32
+		WaitForSingleObject(threads[i], INFINITE);
+		CloseHandle(threads[i]);
+#else
+		pthread_join(threads[i], NULL);
+#endif
+	}
+
+	ctx->driver_sheetPy = py;
+	free(bands);
+	return true;
+}
+
+
+void gs1_driverFinalise(gs1_encoder *ctx) {
+
+	int i;
+
+	if (ctx->errFlag || ctx->sizeOnly) return;
+
+	ctx->line1 = true; // so first line is not Y undercut
+	if (ctx->driver_sheet != NULL) {
+		ctx->driver_sheetPx = modToPix(ctx, ctx->sheetX);
+		ctx->driver_sheetPy = (long)ctx->sheetY * ctx->driver_pixMult;
+		if (ctx->driver_sheetPx + ctx->driver_xdim > ctx->driver_sheetW ||
+				ctx->driver_sheetPy + ctx->driver_ydim > ctx->driver_sheetH) {
+			strcpy(ctx->errMsg, "Symbol does not fit on sheet");
+			ctx->errFlag = true;
+			return;
+		}
+		if (ctx->renderThreads < 2 || !sheetBands(ctx)) {
+			for (i = 0; i < ctx->driver_rowCnt; i++) {
+				printRow(ctx, i);
+			}
+		}
+	}
+	else if (ctx->rowCallback != NULL) {
+		for (i = 0; i < ctx->driver_rowCnt; i++) {
+			printRow(ctx, i);
+		}
+	}
+	else if (ctx->format == fBMP) {
+		// note: BMP is bottom to top inverted
+		gs1_bmpHeader(ctx->driver_xdim, ctx->driver_ydim, ctx->dpi, ctx->outfp);
+		for (i = ctx->driver_rowCnt-1; i >= 0; i--) {
+			printRow(ctx, i);
+		}
+	}
+	else if (ctx->format == fZPL) {
+		ctx->driver_linePrevLen = -1;
+		gs1_zplHeader(ctx->driver_xdim, ctx->driver_ydim, ctx->outfp);
+		for (i = 0; i < ctx->driver_rowCnt; i++) {
+			printRow(ctx, i);
+		}
+		gs1_zplTrailer(ctx->outfp);
+	}
+	else {
+		gs1_tifHeader(ctx->driver_xdim, ctx->driver_ydim, ctx->dpi, ctx->outfp);
+		for (i = 0; i < ctx->driver_rowCnt; i++) {
+			printRow(ctx, i);
+		}
+	}
+	return;
+}
+
+
+/*
+ * A sheet collects any number of symbols, each placed at the sheet offset
+ * current when it is encoded, and is written as a single image.
+ */
+void gs1_driverBeginSheet(gs1_encoder *ctx, long xmods, long ymods) {
+
+	gs1_driverFreeSheet(ctx);
+	setScale(ctx);
+	ctx->driver_sheetW = modToPix(ctx, xmods);
+	ctx->driver_sheetH = ymods * ctx->driver_pixMult;
+	if (ctx->driver_sheetW < 1 || ctx->driver_sheetW > MAX_LINE || ctx->driver_sheetH < 1) {
+		strcpy(ctx->errMsg, "Invalid sheet size");
+		ctx->errFlag = true;
+		return;
+	}
+	ctx->driver_sheet = calloc((size_t)((ctx->driver_sheetW+7)/8 * ctx->driver_sheetH), sizeof(uint8_t));
+	if (ctx->driver_sheet == NULL) {
+		strcpy(ctx->errMsg, "Out of memory for sheet");
+		ctx->errFlag = true;
+	}
+	return;
+}
+
+
+void gs1_driverEndSheet(gs1_encoder *ctx) {
+
+	long bytesPerRow = (ctx->driver_sheetW+7)/8;
+	long y;
+	int i;
+
+	if (ctx->driver_sheet == NULL) {
+		strcpy(ctx->errMsg, "No sheet has been started");
+		ctx->errFlag = true;
+		return;
+	}
+
+	if (ctx->rowCallback != NULL) {
+		// pass runs of identical lines with their repeat count
+		for (y = 0; y < ctx->driver_sheetH; y += i) {
+			for (i = 1; y+i < ctx->driver_sheetH && memcmp(&ctx->driver_sheet[y*bytesPerRow],
+					&ctx->driver_sheet[(y+i)*bytesPerRow], (size_t)bytesPerRow) == 0; i++);
+			ctx->rowCallback(ctx->rowCallbackData, &ctx->driver_sheet[y*bytesPerRow],
+					(int)ctx->driver_sheetW, i);
+		}
+	}
+	else if (ctx->format == fBMP) {
+		// note: BMP is bottom to top inverted with rows padded to long words
+		gs1_bmpHeader(ctx->driver_sheetW, ctx->driver_sheetH, ctx->dpi, ctx->outfp);
+		for (y = ctx->driver_sheetH-1; y >= 0; y--) {
+			for (i = 0; i < bytesPerRow; i++) {
+				ctx->driver_line[i] = ctx->driver_sheet[y*bytesPerRow + i] ^ 0xFF;
+			}
+			while ((i & 3) != 0) {
+				ctx->driver_line[i++] = 0xFF;
+			}
+			writeLine(ctx, ctx->driver_line, i, 1);
+		}
+	}
+	else if (ctx->format == fZPL) {
+		ctx->driver_linePrevLen = -1;
+		gs1_zplHeader(ctx->driver_sheetW, ctx->driver_sheetH, ctx->outfp);
+		for (y = 0; y < ctx->driver_sheetH; y++) {
+			writeLine(ctx, &ctx->driver_sheet[y*bytesPerRow], (int)bytesPerRow, 1);
+		}
+		gs1_zplTrailer(ctx->outfp);
+	}
+	else {
+		gs1_tifHeader(ctx->driver_sheetW, ctx->driver_sheetH, ctx->dpi, ctx->outfp);
+		for (y = 0; y < ctx->driver_sheetH; y++) {
+			writeLine(ctx, &ctx->driver_sheet[y*bytesPerRow], (int)bytesPerRow, 1);
+		}
+	}
+
+	gs1_driverFreeSheet(ctx);
+	return;
+}
+
+
+void gs1_driverFreeSheet(gs1_encoder *ctx) {
+
+	free(ctx->driver_sheet);
+	ctx->driver_sheet = NULL;
 	return;
 }
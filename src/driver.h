@@ -27,14 +27,40 @@
 #include "gs1encoders.h"
 
 struct sPrints;
+struct linCacheT;
 
 #define MAX_LINE 6032 // 10 inches wide at 600 dpi
+#define MAX_ROWS 100 // CC-C 90 rows plus separator and linear rows
+#define MAX_ROW_ELMNTS 16384 // combined elements in all rows of a symbol
+#define MAX_LIN_ELMNTS ((45*6)+3) // largest linear pattern, UCC/EAN-128
+#define MAX_RENDER_THREADS 16 // largest renderThreads accepted
+
+enum {
+	rkLINEAR = 0,	// linear or separator row
+	rkCC,		// 2D component row
+	rkFIXED,	// row depending only on the symbol layout
+};
 
 #define min(X,Y) (((X) < (Y)) ? (X) : (Y))
 #define max(X,Y) (((X) > (Y)) ? (X) : (Y))
 
-void gs1_bmpHeader(long xdim, long ydim, FILE *oFile);
-void gs1_tifHeader(long xdim, long ydim, FILE *oFile);
+void gs1_bmpHeader(long xdim, long ydim, int dpi, FILE *oFile);
+void gs1_tifHeader(long xdim, long ydim, int dpi, FILE *oFile);
+void gs1_zplHeader(long xdim, long ydim, FILE *oFile);
+void gs1_zplTrailer(FILE *oFile);
 void gs1_printElmnts(gs1_encoder *ctx, struct sPrints *prints);
+void gs1_driverInit(gs1_encoder *ctx, long xmods, long ydim);
+void gs1_driverAddRow(gs1_encoder *ctx, struct sPrints *prints);
+void gs1_driverAddCCRow(gs1_encoder *ctx, struct sPrints *prints);
+void gs1_driverAddFixedRow(gs1_encoder *ctx, struct sPrints *prints);
+void gs1_driverFinalise(gs1_encoder *ctx);
+void gs1_driverBeginSheet(gs1_encoder *ctx, long xmods, long ymods);
+void gs1_driverEndSheet(gs1_encoder *ctx);
+void gs1_driverFreeSheet(gs1_encoder *ctx);
+int gs1_driverLinGet(gs1_encoder *ctx, const char *primary, int len, int link, uint8_t pattern[], int patLen);
+void gs1_driverLinPut(gs1_encoder *ctx, const uint8_t pattern[], int patLen, int result);
+int gs1_driverSepGet(gs1_encoder *ctx, const struct sPrints *prints, uint8_t sepPattern[]);
+void gs1_driverSepPut(gs1_encoder *ctx, const struct sPrints *prints, const uint8_t sepPattern[], int sepCnt);
+void gs1_driverFreeLinCache(gs1_encoder *ctx);
 
 #endif /* UTIL_H */
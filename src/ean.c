@@ -110,16 +110,12 @@ void gs1_EAN13(gs1_encoder *ctx) {
 	int i;
 	int rows, ccFlag;
 	char *ccStr;
+	int primaryLen, ccLen;
 
-	ccStr = strchr(ctx->dataStr, '|');
-	if (ccStr == NULL) ccFlag = false;
-	else {
-		ccFlag = true;
-		ccStr[0] = '\0'; // separate primary data
-		ccStr++; // point to secondary data
-	}
+	ccStr = gs1_splitCC(ctx, &primaryLen, &ccLen);
+	ccFlag = (ccStr != NULL);
 
-	if (strlen(ctx->dataStr) > 12) {
+	if (primaryLen > 12) {
 		strcpy(ctx->errMsg, "primary data exceeds 12 digits");
 		ctx->errFlag = true;
 		return;
@@ -139,12 +135,11 @@ void gs1_EAN13(gs1_encoder *ctx) {
 	}
 	printf("\n");
 #endif
-	ctx->line1 = true; // so first line is not Y undercut
 	// init most likely prints values
 	prints.elmCnt = EAN13_ELMNTS;
 	prints.pattern = linPattern;
 	prints.guards = false;
-	prints.height = ctx->pixMult*EAN13_H;
+	prints.height = ctx->driver_pixMult*EAN13_H;
 	prints.leftPad = 0;
 	prints.rightPad = 0;
 	prints.whtFirst = true;
@@ -153,13 +148,13 @@ void gs1_EAN13(gs1_encoder *ctx) {
 	sepPrnt.elmCnt = 5;
 	sepPrnt.pattern = sepPat1;
 	sepPrnt.guards = false;
-	sepPrnt.height = ctx->pixMult*2;
+	sepPrnt.height = ctx->driver_pixMult*2;
 	sepPrnt.leftPad = 0;
 	sepPrnt.rightPad = 0;
 	sepPrnt.whtFirst = true;
 	sepPrnt.reverse = false;
 	if (ccFlag) {
-		if (!((rows = gs1_CC4enc(ctx, (uint8_t*)ccStr, ccPattern)) > 0) || ctx->errFlag) return;
+		if (!((rows = gs1_CC4enc(ctx, (uint8_t*)ccStr, ccLen, ccPattern)) > 0) || ctx->errFlag) return;
 #if PRNT
 		{
 			int j;
@@ -174,70 +169,40 @@ void gs1_EAN13(gs1_encoder *ctx) {
 		}
 #endif
 
-		if (ctx->bmp) {
-			// note: BMP is bottom to top inverted
-			gs1_bmpHeader(ctx->pixMult*EAN13_W, ctx->pixMult*(rows*2 + 6 + EAN13_H), ctx->outfp);
-
-			// EAN-13
-			gs1_printElmnts(ctx, &prints);
-
-			// CC separator
-			gs1_printElmnts(ctx, &sepPrnt);
-			sepPrnt.pattern = sepPat2;
-			gs1_printElmnts(ctx, &sepPrnt);
-			sepPrnt.pattern = sepPat1;
-			gs1_printElmnts(ctx, &sepPrnt);
-
-			// Composite Component
-			prints.elmCnt = CCB4_ELMNTS;
-			prints.height = ctx->pixMult*2;
-			prints.leftPad = EAN13_L_PAD;
-			prints.rightPad = EAN13_R_PAD;
-			for (i = rows-1; i >= 0; i--) {
-				prints.pattern = ccPattern[i];
-				gs1_printElmnts(ctx, &prints);
-			}
+		gs1_driverInit(ctx, EAN13_W, ctx->driver_pixMult*(rows*2 + 6 + EAN13_H));
+
+		// Composite Component
+		prints.elmCnt = CCB4_ELMNTS;
+		prints.height = ctx->driver_pixMult*2;
+		prints.leftPad = EAN13_L_PAD;
+		prints.rightPad = EAN13_R_PAD;
+		for (i = 0; i < rows; i++) {
+			prints.pattern = ccPattern[i];
+			gs1_driverAddCCRow(ctx, &prints);
 		}
-		else {
-			gs1_tifHeader(ctx->pixMult*EAN13_W, ctx->pixMult*(rows*2 + 6 + EAN13_H), ctx->outfp);
 
-			// Composite Component
-			prints.elmCnt = CCB4_ELMNTS;
-			prints.height = ctx->pixMult*2;
-			prints.leftPad = EAN13_L_PAD;
-			prints.rightPad = EAN13_R_PAD;
-			for (i = 0; i < rows; i++) {
-				prints.pattern = ccPattern[i];
-				gs1_printElmnts(ctx, &prints);
-			}
+		// CC separator
+		gs1_driverAddRow(ctx, &sepPrnt);
+		sepPrnt.pattern = sepPat2;
+		gs1_driverAddRow(ctx, &sepPrnt);
+		sepPrnt.pattern = sepPat1;
+		gs1_driverAddRow(ctx, &sepPrnt);
 
-			// CC separator
-			gs1_printElmnts(ctx, &sepPrnt);
-			sepPrnt.pattern = sepPat2;
-			gs1_printElmnts(ctx, &sepPrnt);
-			sepPrnt.pattern = sepPat1;
-			gs1_printElmnts(ctx, &sepPrnt);
-
-			// EAN-13
-			prints.elmCnt = EAN13_ELMNTS;
-			prints.pattern = linPattern;
-			prints.height = ctx->pixMult*EAN13_H;
-			prints.leftPad = 0;
-			prints.rightPad = 0;
-			gs1_printElmnts(ctx, &prints);
-		}
+		// EAN-13
+		prints.elmCnt = EAN13_ELMNTS;
+		prints.pattern = linPattern;
+		prints.height = ctx->driver_pixMult*EAN13_H;
+		prints.leftPad = 0;
+		prints.rightPad = 0;
 	}
 	else { // primary only
-		if (ctx->bmp) {
-			gs1_bmpHeader(ctx->pixMult*EAN13_W, ctx->pixMult*EAN13_H, ctx->outfp);
-		}
-		else {
-			gs1_tifHeader(ctx->pixMult*EAN13_W, ctx->pixMult*EAN13_H, ctx->outfp);
-		}
-
-		// EAN-13
-		gs1_printElmnts(ctx, &prints);
+		gs1_driverInit(ctx, EAN13_W, ctx->driver_pixMult*EAN13_H);
 	}
+
+	// EAN-13
+	gs1_driverAddRow(ctx, &prints);
+
+	gs1_driverFinalise(ctx);
 	return;
 }
 
@@ -315,19 +280,15 @@ void gs1_EAN8(gs1_encoder *ctx) {
 	int i;
 	int rows, ccFlag;
 	char *ccStr;
+	int primaryLen, ccLen;
 	int lpadCC;
 	int lpadEAN;
 	int elmntsCC;
 
-	ccStr = strchr(ctx->dataStr, '|');
-	if (ccStr == NULL) ccFlag = false;
-	else {
-		ccFlag = true;
-		ccStr[0] = '\0'; // separate primary data
-		ccStr++; // point to secondary data
-	}
+	ccStr = gs1_splitCC(ctx, &primaryLen, &ccLen);
+	ccFlag = (ccStr != NULL);
 
-	if (strlen(ctx->dataStr) > 12) {
+	if (primaryLen > 12) {
 		sprintf(ctx->errMsg, "primary data exceeds 12 digits");
 		ctx->errFlag = true;
 		return;
@@ -347,7 +308,6 @@ void gs1_EAN8(gs1_encoder *ctx) {
 	}
 	printf("\n");
 #endif
-	ctx->line1 = true; // so first line is not Y undercut
 	// init most likely prints values
 	lpadEAN = 0;
 	lpadCC = EAN8_L_PAD;
@@ -355,7 +315,7 @@ void gs1_EAN8(gs1_encoder *ctx) {
 	prints.elmCnt = EAN8_ELMNTS;
 	prints.pattern = linPattern;
 	prints.guards = false;
-	prints.height = ctx->pixMult*EAN8_H;
+	prints.height = ctx->driver_pixMult*EAN8_H;
 	prints.leftPad = 0;
 	prints.rightPad = 0;
 	prints.whtFirst = true;
@@ -364,13 +324,13 @@ void gs1_EAN8(gs1_encoder *ctx) {
 	sepPrnt.elmCnt = 5;
 	sepPrnt.pattern = sepPat1;
 	sepPrnt.guards = false;
-	sepPrnt.height = ctx->pixMult*2;
+	sepPrnt.height = ctx->driver_pixMult*2;
 	sepPrnt.leftPad = 0;
 	sepPrnt.rightPad = 0;
 	sepPrnt.whtFirst = true;
 	sepPrnt.reverse = false;
 	if (ccFlag) {
-		if (!((rows = gs1_CC3enc(ctx, (uint8_t*)ccStr, ccPattern)) > 0) || ctx->errFlag) return;
+		if (!((rows = gs1_CC3enc(ctx, (uint8_t*)ccStr, ccLen, ccPattern)) > 0) || ctx->errFlag) return;
 		if (rows > MAX_CCA3_ROWS) { // CCB composite
 			lpadEAN = EAN8_L_PADB;
 			lpadCC = 0;
@@ -392,70 +352,40 @@ void gs1_EAN8(gs1_encoder *ctx) {
 		}
 #endif
 
-		if (ctx->bmp) {
-			// note: BMP is bottom to top inverted
-			gs1_bmpHeader(ctx->pixMult*(EAN8_W+lpadEAN), ctx->pixMult*(rows*2 + 6 + EAN8_H), ctx->outfp);
-
-			// EAN-8
-			gs1_printElmnts(ctx, &prints);
-
-			// CC separator
-			gs1_printElmnts(ctx, &sepPrnt);
-			sepPrnt.pattern = sepPat2;
-			gs1_printElmnts(ctx, &sepPrnt);
-			sepPrnt.pattern = sepPat1;
-			gs1_printElmnts(ctx, &sepPrnt);
-
-			// Composite Component
-			prints.elmCnt = elmntsCC;
-			prints.height = ctx->pixMult*2;
-			prints.leftPad = lpadCC;
-			prints.rightPad = EAN8_R_PAD;
-			for (i = rows-1; i >= 0; i--) {
-				prints.pattern = ccPattern[i];
-				gs1_printElmnts(ctx, &prints);
-			}
+		gs1_driverInit(ctx, (EAN8_W+lpadEAN), ctx->driver_pixMult*(rows*2 + 6 + EAN8_H));
+
+		// Composite Component
+		prints.elmCnt = elmntsCC;
+		prints.height = ctx->driver_pixMult*2;
+		prints.leftPad = lpadCC;
+		prints.rightPad = EAN8_R_PAD;
+		for (i = 0; i < rows; i++) {
+			prints.pattern = ccPattern[i];
+			gs1_driverAddCCRow(ctx, &prints);
 		}
-		else {
-			gs1_tifHeader(ctx->pixMult*(EAN8_W+lpadEAN), ctx->pixMult*(rows*2 + 6 + EAN8_H), ctx->outfp);
 
-			// Composite Component
-			prints.elmCnt = elmntsCC;
-			prints.height = ctx->pixMult*2;
-			prints.leftPad = lpadCC;
-			prints.rightPad = EAN8_R_PAD;
-			for (i = 0; i < rows; i++) {
-				prints.pattern = ccPattern[i];
-				gs1_printElmnts(ctx, &prints);
-			}
+		// CC separator
+		gs1_driverAddRow(ctx, &sepPrnt);
+		sepPrnt.pattern = sepPat2;
+		gs1_driverAddRow(ctx, &sepPrnt);
+		sepPrnt.pattern = sepPat1;
+		gs1_driverAddRow(ctx, &sepPrnt);
 
-			// CC separator
-			gs1_printElmnts(ctx, &sepPrnt);
-			sepPrnt.pattern = sepPat2;
-			gs1_printElmnts(ctx, &sepPrnt);
-			sepPrnt.pattern = sepPat1;
-			gs1_printElmnts(ctx, &sepPrnt);
-
-			// EAN-8
-			prints.elmCnt = EAN8_ELMNTS;
-			prints.pattern = linPattern;
-			prints.height = ctx->pixMult*EAN8_H;
-			prints.leftPad = lpadEAN;
-			prints.rightPad = 0;
-			gs1_printElmnts(ctx, &prints);
-		}
+		// EAN-8
+		prints.elmCnt = EAN8_ELMNTS;
+		prints.pattern = linPattern;
+		prints.height = ctx->driver_pixMult*EAN8_H;
+		prints.leftPad = lpadEAN;
+		prints.rightPad = 0;
 	}
 	else { // primary only
-		if (ctx->bmp) {
-			gs1_bmpHeader(ctx->pixMult*EAN8_W, ctx->pixMult*EAN8_H, ctx->outfp);
-		}
-		else {
-			gs1_tifHeader(ctx->pixMult*EAN8_W, ctx->pixMult*EAN8_H, ctx->outfp);
-		}
-
-		// EAN-8
-		gs1_printElmnts(ctx, &prints);
+		gs1_driverInit(ctx, EAN8_W, ctx->driver_pixMult*EAN8_H);
 	}
+
+	// EAN-8
+	gs1_driverAddRow(ctx, &prints);
+
+	gs1_driverFinalise(ctx);
 	return;
 }
 
@@ -573,16 +503,12 @@ void gs1_UPCE(gs1_encoder *ctx) {
 	int i;
 	int rows, ccFlag;
 	char *ccStr;
+	int primaryLen, ccLen;
 
-	ccStr = strchr(ctx->dataStr, '|');
-	if (ccStr == NULL) ccFlag = false;
-	else {
-		ccFlag = true;
-		ccStr[0] = '\0'; // separate primary data
-		ccStr++; // point to secondary data
-	}
+	ccStr = gs1_splitCC(ctx, &primaryLen, &ccLen);
+	ccFlag = (ccStr != NULL);
 
-	if (strlen(ctx->dataStr) > 12) {
+	if (primaryLen > 12) {
 		sprintf(ctx->errMsg, "primary data exceeds 12 digits");
 		ctx->errFlag = true;
 		return;
@@ -602,12 +528,11 @@ void gs1_UPCE(gs1_encoder *ctx) {
 	}
 	printf("\n");
 #endif
-	ctx->line1 = true; // so first line is not Y undercut
 	// init most likely prints values
 	prints.elmCnt = UPCE_ELMNTS;
 	prints.pattern = linPattern;
 	prints.guards = false;
-	prints.height = ctx->pixMult*UPCE_H;
+	prints.height = ctx->driver_pixMult*UPCE_H;
 	prints.leftPad = 0;
 	prints.rightPad = 0;
 	prints.whtFirst = true;
@@ -616,13 +541,13 @@ void gs1_UPCE(gs1_encoder *ctx) {
 	sepPrnt.elmCnt = 5;
 	sepPrnt.pattern = sepPat1;
 	sepPrnt.guards = false;
-	sepPrnt.height = ctx->pixMult*2;
+	sepPrnt.height = ctx->driver_pixMult*2;
 	sepPrnt.leftPad = 0;
 	sepPrnt.rightPad = 0;
 	sepPrnt.whtFirst = true;
 	sepPrnt.reverse = false;
 	if (ccFlag) {
-		if (!((rows = gs1_CC2enc(ctx, (uint8_t*)ccStr, ccPattern)) > 0) || ctx->errFlag) return;
+		if (!((rows = gs1_CC2enc(ctx, (uint8_t*)ccStr, ccLen, ccPattern)) > 0) || ctx->errFlag) return;
 #if PRNT
 		{
 			int j;
@@ -637,69 +562,39 @@ void gs1_UPCE(gs1_encoder *ctx) {
 		}
 #endif
 
-		if (ctx->bmp) {
-			// note: BMP is bottom to top inverted
-			gs1_bmpHeader(ctx->pixMult*UPCE_W, ctx->pixMult*(rows*2 + 6 + UPCE_H), ctx->outfp);
-
-			// UPC-E
-			gs1_printElmnts(ctx, &prints);
-
-			// CC separator
-			gs1_printElmnts(ctx, &sepPrnt);
-			sepPrnt.pattern = sepPat2;
-			gs1_printElmnts(ctx, &sepPrnt);
-			sepPrnt.pattern = sepPat1;
-			gs1_printElmnts(ctx, &sepPrnt);
-
-			// Composite Component
-			prints.elmCnt = CCB2_ELMNTS;
-			prints.height = ctx->pixMult*2;
-			prints.leftPad = UPCE_L_PAD;
-			prints.rightPad = UPCE_R_PAD;
-			for (i = rows-1; i >= 0; i--) {
-				prints.pattern = ccPattern[i];
-				gs1_printElmnts(ctx, &prints);
-			}
+		gs1_driverInit(ctx, UPCE_W, ctx->driver_pixMult*(rows*2 + 6 + UPCE_H));
+
+		// Composite Component
+		prints.elmCnt = CCB2_ELMNTS;
+		prints.height = ctx->driver_pixMult*2;
+		prints.leftPad = UPCE_L_PAD;
+		prints.rightPad = UPCE_R_PAD;
+		for (i = 0; i < rows; i++) {
+			prints.pattern = ccPattern[i];
+			gs1_driverAddCCRow(ctx, &prints);
 		}
-		else {
-			gs1_tifHeader(ctx->pixMult*UPCE_W, ctx->pixMult*(rows*2 + 6 + UPCE_H), ctx->outfp);
 
-			// Composite Component
-			prints.elmCnt = CCB2_ELMNTS;
-			prints.height = ctx->pixMult*2;
-			prints.leftPad = UPCE_L_PAD;
-			prints.rightPad = UPCE_R_PAD;
-			for (i = 0; i < rows; i++) {
-				prints.pattern = ccPattern[i];
-				gs1_printElmnts(ctx, &prints);
-			}
+		// CC separator
+		gs1_driverAddRow(ctx, &sepPrnt);
+		sepPrnt.pattern = sepPat2;
+		gs1_driverAddRow(ctx, &sepPrnt);
+		sepPrnt.pattern = sepPat1;
+		gs1_driverAddRow(ctx, &sepPrnt);
 
-			// CC separator
-			gs1_printElmnts(ctx, &sepPrnt);
-			sepPrnt.pattern = sepPat2;
-			gs1_printElmnts(ctx, &sepPrnt);
-			sepPrnt.pattern = sepPat1;
-			gs1_printElmnts(ctx, &sepPrnt);
-
-			// UPC-E
-			prints.elmCnt = UPCE_ELMNTS;
-			prints.pattern = linPattern;
-			prints.height = ctx->pixMult*UPCE_H;
-			prints.leftPad = 0;
-			prints.rightPad = 0;
-			gs1_printElmnts(ctx, &prints);
-		}
+		// UPC-E
+		prints.elmCnt = UPCE_ELMNTS;
+		prints.pattern = linPattern;
+		prints.height = ctx->driver_pixMult*UPCE_H;
+		prints.leftPad = 0;
+		prints.rightPad = 0;
 	}
 	else { // primary only
-		if (ctx->bmp) {
-			gs1_bmpHeader(ctx->pixMult*UPCE_W, ctx->pixMult*UPCE_H, ctx->outfp);
-		}
-		else {
-			gs1_tifHeader(ctx->pixMult*UPCE_W, ctx->pixMult*UPCE_H, ctx->outfp);
-		}
-
-		// UPC-E
-		gs1_printElmnts(ctx, &prints);
+		gs1_driverInit(ctx, UPCE_W, ctx->driver_pixMult*UPCE_H);
 	}
+
+	// UPC-E
+	gs1_driverAddRow(ctx, &prints);
+
+	gs1_driverFinalise(ctx);
 	return;
 }
@@ -60,16 +60,32 @@ struct gs1_encoder {
 	int Xundercut;		// X pixels to undercut
 	int Yundercut;		// Y pixels to undercut
 	int sepHt;		// separator row height
-	int segWidth;
-	int bmp;		// true is BMP else TIF file output
+	int segWidth;		// RSS Expanded segments per row, 0 to fit
+	int maxWidth;		// fitted symbol width limit in X, 0 if none
+	int maxHeight;		// fitted symbol height limit in X, 0 if none
+	int format;		// fTIF, fBMP or fZPL file output
 	int linHeight;		// height of UCC/EAN-128 in X
+	int dpi;		// device resolution, 0 if unspecified
+	int Xdimension;		// X in micrometers, 0 to use pixMult
+	int optimalPack;	// minimum bits general purpose compaction
+	int reuseLinear;	// keep the linear component between encodes
+	int gtinCacheSize;	// RSS-14 and RSS Limited patterns kept, 0 for none
+	int64_t gtinCacheHits;	// lookups since gtinCacheSize was set
+	int64_t gtinCacheMisses;
+	int renderThreads;	// threads drawing a symbol onto a sheet, 1 for none
+	int sheetX;		// sheet offset of next symbol in X
+	int sheetY;
+	gs1_encoder_rowCallback rowCallback;	// receives lines instead of outFile
+	void *rowCallbackData;
 	char dataFile[GS1_ENCODERS_MAX_FNAME+1];
 	char outFile[GS1_ENCODERS_MAX_FNAME+1];
 	char dataStr[GS1_ENCODERS_MAX_DATA+1];
+	int dataLen;		// length of dataStr, set on entry to encode
 	char VERSION[16];
 
 	// per-instance globals
 	FILE *outfp;
+	int sizeOnly;		// getSize pass, skips ECC, imaging and output
 	int errFlag;
 	char errMsg[512];
 	int rowWidth;
@@ -81,16 +97,41 @@ struct gs1_encoder {
 	uint8_t ccPattern[MAX_CCB4_ROWS][CCB4_ELMNTS];
 	const int *cc_CCSizes;	// will point to CCxSize
 	int cc_gpa[512];
-	uint8_t driver_line[MAX_LINE/8 + 1];
-	uint8_t driver_lineUCut[MAX_LINE/8 + 1];
+	struct packWorkT *cc_packWork;	// NULL until the first gs1_pack
+	int cc_packBits;	// bits used by the last gs1_pack, before padding
+	uint8_t *cc_patCCC;	// CC-C row patterns, grown to fit
+	size_t cc_patCCCSize;
+	uint8_t driver_line[MAX_LINE/8 + 4];	// room to pad a full sheet row to long words
+	uint8_t driver_lineUCut[MAX_LINE/8 + 4];
+	uint8_t driver_linePrev[MAX_LINE/8 + 1];	// last line output, for ZPL
+	int driver_linePrevLen;
+	int driver_pixMult;	// pixels per X for heights, from Xdimension if set
+	int64_t driver_xNum;	// pixels per module is driver_xNum/driver_xDen
+	int64_t driver_xDen;
+	long driver_xdim;	// image width in pixels
+	long driver_ydim;	// image height in pixels
+	int driver_rowCnt;	// rows added to the symbol so far
+	int driver_elmCnt;	// elements used in driver_rowPatterns
+	uint8_t *driver_sheet;	// sheet bitmap, NULL unless in sheet mode
+	long driver_sheetW;	// sheet width in pixels
+	long driver_sheetH;
+	long driver_sheetPx;	// pixel offset of the symbol being placed
+	long driver_sheetPy;	// next sheet line to receive output
+	struct sPrints driver_rows[MAX_ROWS];
+	uint8_t driver_rowKind[MAX_ROWS];	// rkLINEAR, rkCC or rkFIXED
+	struct linCacheT *driver_linCache;	// NULL until reuseLinear is used
+	uint8_t driver_rowPatterns[MAX_ROW_ELMNTS];
 	struct sPrints rss14_prntSep;
 	uint8_t rss14_sepPattern[RSS14_SYM_W/2+2];
 	struct sPrints rsslim_prntSep;
 	uint8_t rsslim_sepPattern[RSSLIM_SYM_W];
 	struct sPrints rssutil_prntSep;
 	uint8_t rssutil_sepPattern[MAX_SEP_ELMNTS];
+	struct gtinCacheT *rssutil_gtinCache;	// NULL until gtinCacheSize is used
+	uint8_t rssexp_chexPattern[RSSEXP_MAX_DBL_SEGS*RSSEXP_SYM_W+2];
+	int rssexp_chexMods;	// symbol width chexPattern is set up for, 0 if not yet
+	char rssexp_method[RSSEXP_METHOD_LEN+1];	// encodation method bits of the last size
 	int rss_util_widths[MAX_K];
-	uint8_t ucc128_patCCC[UCC128_MAX_PAT];
 
 };
 
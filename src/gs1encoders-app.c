@@ -50,6 +50,10 @@ static const char* SYMBOLOGY_NAMES[] =
 	"GS1-128 with CC-C"
 };
 
+static const char* FORMAT_NAMES[] = { "TIF", "BMP", "ZPL" };
+
+static char* FORMAT_FILES[] = { "out.tif", "out.bmp", "out.zpl" };
+
 // Replacement for the deprecated gets(3) function
 static char* gets(char* in) {
 
@@ -155,19 +159,19 @@ static bool userInt(gs1_encoder *ctx) {
 		printf("\n 1) Enter X pixels to undercut. Current value = %d", gs1_encoder_getXundercut(ctx));
 		printf("\n 2) Enter Y pixels to undercut. Current value = %d", gs1_encoder_getYundercut(ctx));
 		printf("\n 3) Enter %s output file name. Current name = %s",
-							 (gs1_encoder_getBmp(ctx)) ? "BMP":"TIF", gs1_encoder_getOutFile(ctx));
+							 FORMAT_NAMES[gs1_encoder_getFormat(ctx)], gs1_encoder_getOutFile(ctx));
 		printf("\n 4) Select keyboard or file input source. Current = %s",
 							 (gs1_encoder_getInputFlag(ctx) == 0) ? "keyboard":"file");
 		if (gs1_encoder_getInputFlag(ctx) == 0) { // for kbd input
 			printf("\n 5) Key enter data input string. %s output file will be created.",
-							 (gs1_encoder_getBmp(ctx)) ? "BMP":"TIF");
+							 FORMAT_NAMES[gs1_encoder_getFormat(ctx)]);
 		}
 		else {
 			printf("\n 5) Enter data input file name. %s output file will be created.",
-							 (gs1_encoder_getBmp(ctx)) ? "BMP":"TIF");
+							 FORMAT_NAMES[gs1_encoder_getFormat(ctx)]);
 		}
-		printf("\n 6) Select TIF or BMP format. Current = %s",
-							 (gs1_encoder_getBmp(ctx)) ? "BMP":"TIF");
+		printf("\n 6) Select TIF, BMP or ZPL format. Current = %s",
+							 FORMAT_NAMES[gs1_encoder_getFormat(ctx)]);
 		if (gs1_encoder_getSym(ctx) == sRSSEXP) {
 			printf("\n 7) Select maximum segments per row. Current value = %d", gs1_encoder_getSegWidth(ctx));
 		}
@@ -253,7 +257,7 @@ static bool userInt(gs1_encoder *ctx) {
 				break;
 			case 3:
 				printf("\nEnter %s output file name with extension: ",
-							 (gs1_encoder_getBmp(ctx)) ? "BMP":"TIF");
+							 FORMAT_NAMES[gs1_encoder_getFormat(ctx)]);
 				if (gets(inpStr) == NULL) {
 					printf("UNKNOWN ENTRY.");
 					continue;
@@ -302,25 +306,20 @@ static bool userInt(gs1_encoder *ctx) {
 			 }
 			 break;
 			case 6:
-				printf("\nEnter 0 for TIF or 1 for BMP output: ");
+				printf("\nEnter 0 for TIF, 1 for BMP or 2 for ZPL output: ");
 				if (gets(inpStr) == NULL) {
-					printf("UNKNOWN. PLEASE ENTER 0 or 1.");
+					printf("UNKNOWN. PLEASE ENTER 0, 1 or 2.");
 					continue;
 				}
 				i = atoi(inpStr);
-				if (!(i == 0 || i == 1)) {
-					printf("OUT OF RANGE. PLEASE ENTER 0 or 1");
+				if (i < 0 || i >= fNUMFORMATS) {
+					printf("OUT OF RANGE. PLEASE ENTER 0, 1 or 2");
 					continue;
 				}
-				if (gs1_encoder_getBmp(ctx) != i) {
-					if (i == 0) {
-						gs1_encoder_setOutFile(ctx, "out.tif");
-					}
-					else {
-						gs1_encoder_setOutFile(ctx, "out.bmp");
-					}
+				if (gs1_encoder_getFormat(ctx) != i) {
+					gs1_encoder_setOutFile(ctx, FORMAT_FILES[i]);
 				}
-				gs1_encoder_setBmp(ctx, i);
+				gs1_encoder_setFormat(ctx, i);
 				break;
 			case 7:
 			 if (gs1_encoder_getSym(ctx) == sRSSEXP) {
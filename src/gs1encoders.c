@@ -44,14 +44,36 @@ GS1_ENCODERS_API gs1_encoder* gs1_encoder_init(void) {
 	ctx->Xundercut = 0;
 	ctx->Yundercut = 0;
 	ctx->sepHt = 1;
-	ctx->bmp = false;
+	ctx->format = fTIF;
 	ctx->segWidth = 22;
+	ctx->maxWidth = 0;
+	ctx->maxHeight = 0;
 	ctx->linHeight = 25;
+	ctx->dpi = 0;
+	ctx->Xdimension = 0;
+	ctx->optimalPack = false;
+	ctx->reuseLinear = false;
+	ctx->gtinCacheSize = 0;
+	ctx->gtinCacheHits = 0;
+	ctx->gtinCacheMisses = 0;
+	ctx->rssutil_gtinCache = NULL;
+	ctx->renderThreads = 1;
+	ctx->sheetX = 0;
+	ctx->sheetY = 0;
+	ctx->driver_sheet = NULL;
+	ctx->driver_linCache = NULL;
+	ctx->rowCallback = NULL;
+	ctx->rowCallbackData = NULL;
 	strcpy(ctx->outFile, "out.tif");
 	ctx->sym = sNONE;
 	ctx->inputFlag = 0; // for kbd input
 	ctx->errFlag = false;
 	ctx->errMsg[0] = '\0';
+	ctx->sizeOnly = false;
+	ctx->rssexp_chexMods = 0;
+	ctx->cc_patCCC = NULL;
+	ctx->cc_patCCCSize = 0;
+	ctx->cc_packWork = NULL;
 
 	return ctx;
 
@@ -60,6 +82,11 @@ GS1_ENCODERS_API gs1_encoder* gs1_encoder_init(void) {
 
 GS1_ENCODERS_API void gs1_encoder_free(gs1_encoder *ctx) {
 	if (ctx == NULL) return;
+	gs1_driverFreeSheet(ctx);
+	gs1_driverFreeLinCache(ctx);
+	gs1_rssFreeGtinCache(ctx);
+	free(ctx->cc_patCCC);
+	free(ctx->cc_packWork);
 	free(ctx);
 	ctx = NULL;
 }
@@ -139,13 +166,154 @@ GS1_ENCODERS_API void gs1_encoder_setSegWidth(gs1_encoder *ctx, int segWidth) {
 }
 
 
+GS1_ENCODERS_API int gs1_encoder_getMaxWidth(gs1_encoder *ctx) {
+	if (ctx == NULL) return -1;
+	return ctx->maxWidth;
+}
+GS1_ENCODERS_API void gs1_encoder_setMaxWidth(gs1_encoder *ctx, int maxWidth) {
+	if (ctx == NULL) return;
+	ctx->maxWidth = maxWidth;
+}
+
+
+GS1_ENCODERS_API int gs1_encoder_getMaxHeight(gs1_encoder *ctx) {
+	if (ctx == NULL) return -1;
+	return ctx->maxHeight;
+}
+GS1_ENCODERS_API void gs1_encoder_setMaxHeight(gs1_encoder *ctx, int maxHeight) {
+	if (ctx == NULL) return;
+	ctx->maxHeight = maxHeight;
+}
+
+
 GS1_ENCODERS_API int gs1_encoder_getBmp(gs1_encoder *ctx) {
 	if (ctx == NULL) return -1;
-	return ctx->bmp;
+	return ctx->format == fBMP;
 }
 GS1_ENCODERS_API void gs1_encoder_setBmp(gs1_encoder *ctx, int bmp) {
 	if (ctx == NULL) return;
-	ctx->bmp = bmp;
+	ctx->format = bmp ? fBMP : fTIF;
+}
+
+
+GS1_ENCODERS_API int gs1_encoder_getFormat(gs1_encoder *ctx) {
+	if (ctx == NULL) return -1;
+	return ctx->format;
+}
+GS1_ENCODERS_API void gs1_encoder_setFormat(gs1_encoder *ctx, int format) {
+	if (ctx == NULL) return;
+	if (format < 0 || format >= fNUMFORMATS) return;
+	ctx->format = format;
+}
+
+
+GS1_ENCODERS_API int gs1_encoder_getDeviceResolution(gs1_encoder *ctx) {
+	if (ctx == NULL) return -1;
+	return ctx->dpi;
+}
+GS1_ENCODERS_API void gs1_encoder_setDeviceResolution(gs1_encoder *ctx, int dpi) {
+	if (ctx == NULL) return;
+	if (dpi < 0) return;
+	ctx->dpi = dpi;
+}
+
+
+GS1_ENCODERS_API int gs1_encoder_getXdimension(gs1_encoder *ctx) {
+	if (ctx == NULL) return -1;
+	return ctx->Xdimension;
+}
+GS1_ENCODERS_API void gs1_encoder_setXdimension(gs1_encoder *ctx, int Xdimension) {
+	if (ctx == NULL) return;
+	if (Xdimension < 0) return;
+	ctx->Xdimension = Xdimension;
+}
+
+
+GS1_ENCODERS_API int gs1_encoder_getOptimalPack(gs1_encoder *ctx) {
+	if (ctx == NULL) return -1;
+	return ctx->optimalPack;
+}
+GS1_ENCODERS_API void gs1_encoder_setOptimalPack(gs1_encoder *ctx, int optimalPack) {
+	if (ctx == NULL) return;
+	ctx->optimalPack = optimalPack;
+}
+
+
+GS1_ENCODERS_API int gs1_encoder_getReuseLinear(gs1_encoder *ctx) {
+	if (ctx == NULL) return -1;
+	return ctx->reuseLinear;
+}
+GS1_ENCODERS_API void gs1_encoder_setReuseLinear(gs1_encoder *ctx, int reuseLinear) {
+	if (ctx == NULL) return;
+	ctx->reuseLinear = reuseLinear;
+	if (!reuseLinear)
+		gs1_driverFreeLinCache(ctx);
+}
+
+
+GS1_ENCODERS_API int gs1_encoder_getGtinCacheSize(gs1_encoder *ctx) {
+	if (ctx == NULL) return -1;
+	return ctx->gtinCacheSize;
+}
+GS1_ENCODERS_API void gs1_encoder_setGtinCacheSize(gs1_encoder *ctx, int gtinCacheSize) {
+	if (ctx == NULL) return;
+	if (gtinCacheSize < 0 || gtinCacheSize > MAX_GTIN_CACHE) return;
+	gs1_rssFreeGtinCache(ctx);
+	ctx->gtinCacheSize = gtinCacheSize;
+	ctx->gtinCacheHits = 0;
+	ctx->gtinCacheMisses = 0;
+}
+
+
+GS1_ENCODERS_API int64_t gs1_encoder_getGtinCacheHits(gs1_encoder *ctx) {
+	if (ctx == NULL) return -1;
+	return ctx->gtinCacheHits;
+}
+
+
+GS1_ENCODERS_API int64_t gs1_encoder_getGtinCacheMisses(gs1_encoder *ctx) {
+	if (ctx == NULL) return -1;
+	return ctx->gtinCacheMisses;
+}
+
+
+GS1_ENCODERS_API int gs1_encoder_getRenderThreads(gs1_encoder *ctx) {
+	if (ctx == NULL) return -1;
+	return ctx->renderThreads;
+}
+GS1_ENCODERS_API void gs1_encoder_setRenderThreads(gs1_encoder *ctx, int renderThreads) {
+	if (ctx == NULL) return;
+	if (renderThreads < 1 || renderThreads > MAX_RENDER_THREADS) return;
+	ctx->renderThreads = renderThreads;
+}
+
+
+GS1_ENCODERS_API int gs1_encoder_getSheetX(gs1_encoder *ctx) {
+	if (ctx == NULL) return -1;
+	return ctx->sheetX;
+}
+GS1_ENCODERS_API void gs1_encoder_setSheetX(gs1_encoder *ctx, int sheetX) {
+	if (ctx == NULL) return;
+	if (sheetX < 0) return;
+	ctx->sheetX = sheetX;
+}
+
+
+GS1_ENCODERS_API int gs1_encoder_getSheetY(gs1_encoder *ctx) {
+	if (ctx == NULL) return -1;
+	return ctx->sheetY;
+}
+GS1_ENCODERS_API void gs1_encoder_setSheetY(gs1_encoder *ctx, int sheetY) {
+	if (ctx == NULL) return;
+	if (sheetY < 0) return;
+	ctx->sheetY = sheetY;
+}
+
+
+GS1_ENCODERS_API void gs1_encoder_setRowCallback(gs1_encoder *ctx, gs1_encoder_rowCallback rowCallback, void *userData) {
+	if (ctx == NULL) return;
+	ctx->rowCallback = rowCallback;
+	ctx->rowCallbackData = userData;
 }
 
 
@@ -195,14 +363,32 @@ GS1_ENCODERS_API char* gs1_encoder_getErrMsg(gs1_encoder *ctx) {
 }
 
 
-GS1_ENCODERS_API bool gs1_encoder_encode(gs1_encoder *ctx) {
+static bool applyXdimension(gs1_encoder *ctx) {
 
-	FILE *iFile, *oFile;
+	long modPix;
 
-	if (!ctx) return false;
+	if (ctx->Xdimension == 0) {
+		ctx->driver_pixMult = ctx->pixMult;
+		return true;
+	}
 
-	ctx->errMsg[0] = '\0';
-	ctx->errFlag = false;
+	modPix = (long)ctx->Xdimension * ctx->dpi / 25400;
+	if (modPix < 1 || ctx->Xundercut >= modPix) {
+		strcpy(ctx->errMsg, "X-dimension too small for device resolution");
+		ctx->errFlag = true;
+		return false;
+	}
+	// heights remain whole multiples of the nearest pixels per X
+	ctx->driver_pixMult = (int)(((long)ctx->Xdimension * ctx->dpi + 12700) / 25400);
+	return true;
+
+}
+
+
+// reads dataFile into dataStr if selected and sets dataLen
+static bool loadData(gs1_encoder *ctx) {
+
+	FILE *iFile;
 
 	if (ctx->inputFlag == 1) {
 		size_t i;
@@ -214,15 +400,20 @@ GS1_ENCODERS_API bool gs1_encoder_encode(gs1_encoder *ctx) {
 		i = fread(ctx->dataStr, sizeof(char), GS1_ENCODERS_MAX_DATA, iFile);
 		while (i > 0 && ctx->dataStr[i-1] < 32) i--; // strip trailing CRLF etc.
 		ctx->dataStr[i] = '\0';
+		ctx->dataLen = (int)i;
 		fclose(iFile);
 	}
-
-	if ((oFile = fopen(ctx->outFile, "wb")) == NULL) {
-		sprintf(ctx->errMsg, "UNABLE TO OPEN %s FILE", ctx->outFile);
-		ctx->errFlag = true;
-		return false;
+	else {
+		ctx->dataLen = (int)strlen(ctx->dataStr);
 	}
-	ctx->outfp = oFile;
+
+	return true;
+
+}
+
+
+// runs the encoder for the selected symbology
+static void encodeSym(gs1_encoder *ctx) {
 
 	switch (ctx->sym) {
 
@@ -275,8 +466,181 @@ GS1_ENCODERS_API bool gs1_encoder_encode(gs1_encoder *ctx) {
 
 	}
 
-	fclose(oFile);
+}
+
+
+GS1_ENCODERS_API bool gs1_encoder_encode(gs1_encoder *ctx) {
+
+	FILE *oFile;
+
+	if (!ctx) return false;
+
+	ctx->errMsg[0] = '\0';
+	ctx->errFlag = false;
+
+	if (!loadData(ctx)) return false;
+
+	if (!applyXdimension(ctx)) return false;
+
+	if (ctx->driver_sheet != NULL || ctx->rowCallback != NULL) {
+		oFile = NULL; // symbol is placed on the sheet or passed to the callback
+	}
+	else if ((oFile = fopen(ctx->outFile, "wb")) == NULL) {
+		sprintf(ctx->errMsg, "UNABLE TO OPEN %s FILE", ctx->outFile);
+		ctx->errFlag = true;
+		return false;
+	}
+	ctx->outfp = oFile;
+
+	encodeSym(ctx);
+
+	if (oFile != NULL)
+		fclose(oFile);
 
 	return !ctx->errFlag;
 
 }
+
+
+GS1_ENCODERS_API bool gs1_encoder_beginSheet(gs1_encoder *ctx, int width, int height) {
+
+	if (!ctx) return false;
+
+	ctx->errMsg[0] = '\0';
+	ctx->errFlag = false;
+
+	if (!applyXdimension(ctx)) return false;
+
+	gs1_driverBeginSheet(ctx, width, height);
+
+	return !ctx->errFlag;
+
+}
+
+
+GS1_ENCODERS_API bool gs1_encoder_endSheet(gs1_encoder *ctx) {
+
+	FILE *oFile;
+
+	if (!ctx) return false;
+
+	ctx->errMsg[0] = '\0';
+	ctx->errFlag = false;
+
+	if (ctx->driver_sheet == NULL) {
+		strcpy(ctx->errMsg, "No sheet has been started");
+		ctx->errFlag = true;
+		return false;
+	}
+
+	if (ctx->rowCallback != NULL) {
+		oFile = NULL;
+	}
+	else if ((oFile = fopen(ctx->outFile, "wb")) == NULL) {
+		sprintf(ctx->errMsg, "UNABLE TO OPEN %s FILE", ctx->outFile);
+		ctx->errFlag = true;
+		gs1_driverFreeSheet(ctx);
+		return false;
+	}
+	ctx->outfp = oFile;
+
+	gs1_driverEndSheet(ctx);
+
+	if (oFile != NULL)
+		fclose(oFile);
+
+	return !ctx->errFlag;
+
+}
+
+
+GS1_ENCODERS_API bool gs1_encoder_getSize(gs1_encoder *ctx, int *width, int *height) {
+
+	char dataStr[GS1_ENCODERS_MAX_DATA+1];
+
+	if (!ctx) return false;
+
+	ctx->errMsg[0] = '\0';
+	ctx->errFlag = false;
+
+	if (!loadData(ctx)) return false;
+
+	if (!applyXdimension(ctx)) return false;
+
+	// the encoders split and rewrite dataStr so restore it afterwards
+	strcpy(dataStr, ctx->dataStr);
+	ctx->driver_xdim = ctx->driver_ydim = 0;	// stays zero if no symbol is produced
+	ctx->sizeOnly = true;
+	encodeSym(ctx);
+	ctx->sizeOnly = false;
+	strcpy(ctx->dataStr, dataStr);
+	if (ctx->errFlag) return false;
+
+	*width = (int)ctx->driver_xdim;
+	*height = (int)ctx->driver_ydim;
+	return true;
+
+}
+
+
+GS1_ENCODERS_API bool gs1_encoder_getCCCSize(gs1_encoder *ctx, int *rows, int *cols, int *eccCnt) {
+
+	char dataStr[GS1_ENCODERS_MAX_DATA+1];
+	bool ret;
+
+	if (!ctx) return false;
+
+	ctx->errMsg[0] = '\0';
+	ctx->errFlag = false;
+
+	if (ctx->sym != sUCC128_CCC) {
+		strcpy(ctx->errMsg, "CC-C size requires the UCC-128 CC-C symbology");
+		ctx->errFlag = true;
+		return false;
+	}
+
+	if (!loadData(ctx)) return false;
+
+	// sizing splits and rewrites dataStr so restore it afterwards
+	strcpy(dataStr, ctx->dataStr);
+	ret = gs1_U128Csize(ctx);
+	strcpy(ctx->dataStr, dataStr);
+	if (!ret) return false;
+
+	*rows = ctx->rowCnt;
+	*cols = ctx->colCnt;
+	*eccCnt = ctx->eccCnt;
+	return true;
+
+}
+
+
+GS1_ENCODERS_API bool gs1_encoder_getRSSExpSize(gs1_encoder *ctx, char **method, int *bits, int *segs) {
+
+	char dataStr[GS1_ENCODERS_MAX_DATA+1];
+	int n;
+
+	if (!ctx) return false;
+
+	ctx->errMsg[0] = '\0';
+	ctx->errFlag = false;
+
+	if (ctx->sym != sRSSEXP) {
+		strcpy(ctx->errMsg, "RSS Expanded size requires the RSS Expanded symbology");
+		ctx->errFlag = true;
+		return false;
+	}
+
+	if (!loadData(ctx)) return false;
+
+	// sizing splits dataStr so restore it afterwards
+	strcpy(dataStr, ctx->dataStr);
+	n = gs1_RSSExpSize(ctx, bits);
+	strcpy(ctx->dataStr, dataStr);
+	if (!n) return false;
+
+	*method = ctx->rssexp_method;
+	*segs = n;
+	return true;
+
+}
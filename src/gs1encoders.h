@@ -22,6 +22,7 @@
 #define ENC_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #define GS1_ENCODERS_MAX_FNAME 120
 #define GS1_ENCODERS_MAX_DATA (75+2361)
@@ -57,6 +58,23 @@ enum {
 };
 
 
+/*
+ *  Receives each raster line of the symbol, top to bottom, in place of the
+ *  output file. Pixels are packed eight to a byte, most significant bit
+ *  first, with 1 for black. The line is to be printed "repeat" times and
+ *  is only valid for the duration of the call.
+ */
+typedef void (*gs1_encoder_rowCallback)(void *userData, const uint8_t *row, int width, int repeat);
+
+
+enum {
+	fTIF = 0,	// TIFF image
+	fBMP,		// BMP image
+	fZPL,		// ZPL ^GFA graphic for thermal label printers
+	fNUMFORMATS,	// Number of output formats
+};
+
+
 /** @brief A gs1_encoder context.
  */
 typedef struct gs1_encoder gs1_encoder;
@@ -78,6 +96,41 @@ GS1_ENCODERS_API void gs1_encoder_free(gs1_encoder *ctx);
  */
 GS1_ENCODERS_API bool gs1_encoder_encode(gs1_encoder *ctx);
 
+/** @brief Start a sheet onto which subsequent encodes are placed.
+ *  @param ctx gs1_encoder context.
+ *  @param width sheet width in X.
+ *  @param height sheet height in X.
+ */
+GS1_ENCODERS_API bool gs1_encoder_beginSheet(gs1_encoder *ctx, int width, int height);
+
+/** @brief Write the sheet to the output file and leave sheet mode.
+ *  @param ctx gs1_encoder context.
+ */
+GS1_ENCODERS_API bool gs1_encoder_endSheet(gs1_encoder *ctx);
+
+/** @brief Get the image size in pixels that encode would produce, without encoding.
+ *  @param ctx gs1_encoder context.
+ *  @param width set to the image width in pixels.
+ *  @param height set to the image height in pixels.
+ */
+GS1_ENCODERS_API bool gs1_encoder_getSize(gs1_encoder *ctx, int *width, int *height);
+
+/** @brief Size the CC-C component of the UCC-128 CC-C data in dataStr without encoding it.
+ *  @param ctx gs1_encoder context.
+ *  @param rows set to the number of CC-C rows.
+ *  @param cols set to the number of CC-C data columns.
+ *  @param eccCnt set to the number of error correction codewords.
+ */
+GS1_ENCODERS_API bool gs1_encoder_getCCCSize(gs1_encoder *ctx, int *rows, int *cols, int *eccCnt);
+
+/** @brief Pack the RSS Expanded data in dataStr without encoding it.
+ *  @param ctx gs1_encoder context.
+ *  @param method set to the encodation method bits, such as "1" or "0100", valid until the next call.
+ *  @param bits set to the packed bit length before padding, including the linkage bit.
+ *  @param segs set to the number of segments, before any padding of the last row when segWidth is 0.
+ */
+GS1_ENCODERS_API bool gs1_encoder_getRSSExpSize(gs1_encoder *ctx, char **method, int *bits, int *segs);
+
 GS1_ENCODERS_API char* gs1_encoder_getVersion(gs1_encoder *ctx);
 
 GS1_ENCODERS_API int gs1_encoder_getSym(gs1_encoder *ctx);
@@ -98,12 +151,74 @@ GS1_ENCODERS_API void gs1_encoder_setYundercut(gs1_encoder *ctx, int Yundercut);
 GS1_ENCODERS_API int gs1_encoder_getSepHt(gs1_encoder *ctx);
 GS1_ENCODERS_API void gs1_encoder_setSepHt(gs1_encoder *ctx, int sepHt);
 
+// Segments per RSS Expanded row, or 0 for the smallest symbol within maxWidth and maxHeight
 GS1_ENCODERS_API int gs1_encoder_getSegWidth(gs1_encoder *ctx);
 GS1_ENCODERS_API void gs1_encoder_setSegWidth(gs1_encoder *ctx, int segWidth);
 
+// Limits in X on a fitted RSS Expanded symbol, including any composite; 0 for no limit
+GS1_ENCODERS_API int gs1_encoder_getMaxWidth(gs1_encoder *ctx);
+GS1_ENCODERS_API void gs1_encoder_setMaxWidth(gs1_encoder *ctx, int maxWidth);
+
+GS1_ENCODERS_API int gs1_encoder_getMaxHeight(gs1_encoder *ctx);
+GS1_ENCODERS_API void gs1_encoder_setMaxHeight(gs1_encoder *ctx, int maxHeight);
+
 GS1_ENCODERS_API int gs1_encoder_getBmp(gs1_encoder *ctx);
 GS1_ENCODERS_API void gs1_encoder_setBmp(gs1_encoder *ctx, int bmp);
 
+GS1_ENCODERS_API int gs1_encoder_getFormat(gs1_encoder *ctx);
+GS1_ENCODERS_API void gs1_encoder_setFormat(gs1_encoder *ctx, int format);
+
+/*
+ *  The device resolution in dots per inch is written to the image
+ *  resolution tags. When an X-dimension in micrometers (1 mil = 25.4 um) is
+ *  also given the modules are sized to it exactly, with fractional widths
+ *  spread across the row, and heights use the nearest whole number of pixels
+ *  per X in place of pixMult.
+ */
+GS1_ENCODERS_API int gs1_encoder_getDeviceResolution(gs1_encoder *ctx);
+GS1_ENCODERS_API void gs1_encoder_setDeviceResolution(gs1_encoder *ctx, int dpi);
+
+GS1_ENCODERS_API int gs1_encoder_getXdimension(gs1_encoder *ctx);
+GS1_ENCODERS_API void gs1_encoder_setXdimension(gs1_encoder *ctx, int Xdimension);
+
+// Select minimum length rather than greedy general purpose compaction
+GS1_ENCODERS_API int gs1_encoder_getOptimalPack(gs1_encoder *ctx);
+GS1_ENCODERS_API void gs1_encoder_setOptimalPack(gs1_encoder *ctx, int optimalPack);
+
+// Keep the linear component between encodes, for runs where only the 2D data changes
+GS1_ENCODERS_API int gs1_encoder_getReuseLinear(gs1_encoder *ctx);
+GS1_ENCODERS_API void gs1_encoder_setReuseLinear(gs1_encoder *ctx, int reuseLinear);
+
+/*
+ *  Keeps the RSS-14 and RSS Limited linear patterns of up to gtinCacheSize
+ *  recent primaries, for runs that repeat the same GTINs; 0 for no cache.
+ *  Setting the size empties the cache and zeroes the hit and miss counts.
+ *  Lookups answered by reuseLinear from the previous encode are not counted.
+ */
+GS1_ENCODERS_API int gs1_encoder_getGtinCacheSize(gs1_encoder *ctx);
+GS1_ENCODERS_API void gs1_encoder_setGtinCacheSize(gs1_encoder *ctx, int gtinCacheSize);
+
+GS1_ENCODERS_API int64_t gs1_encoder_getGtinCacheHits(gs1_encoder *ctx);
+GS1_ENCODERS_API int64_t gs1_encoder_getGtinCacheMisses(gs1_encoder *ctx);
+
+// Pass a NULL rowCallback to return to writing outFile
+GS1_ENCODERS_API void gs1_encoder_setRowCallback(gs1_encoder *ctx, gs1_encoder_rowCallback rowCallback, void *userData);
+
+/*
+ *  Draws the rows of a symbol placed on a sheet in up to renderThreads bands
+ *  in parallel, for large symbols such as a stacked RSS Expanded at a high
+ *  resolution; 1 to draw them in sequence. The sheet image is the same.
+ */
+GS1_ENCODERS_API int gs1_encoder_getRenderThreads(gs1_encoder *ctx);
+GS1_ENCODERS_API void gs1_encoder_setRenderThreads(gs1_encoder *ctx, int renderThreads);
+
+// Offset in X of the top left of the next symbol placed on a sheet
+GS1_ENCODERS_API int gs1_encoder_getSheetX(gs1_encoder *ctx);
+GS1_ENCODERS_API void gs1_encoder_setSheetX(gs1_encoder *ctx, int sheetX);
+
+GS1_ENCODERS_API int gs1_encoder_getSheetY(gs1_encoder *ctx);
+GS1_ENCODERS_API void gs1_encoder_setSheetY(gs1_encoder *ctx, int sheetY);
+
 GS1_ENCODERS_API int gs1_encoder_getLinHeight(gs1_encoder *ctx);
 GS1_ENCODERS_API void gs1_encoder_setLinHeight(gs1_encoder *ctx, int linHeight);
 
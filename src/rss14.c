@@ -28,6 +28,7 @@
 #include "rss14.h"
 #include "rssutil.h"
 #include "cc.h"
+#include "tables.h"
 
 
 // RSS14 Stacked row separator pattern routine
@@ -135,23 +136,23 @@ static struct sPrints *separator14S(gs1_encoder *ctx, struct sPrints *prints) {
 #define	SEMI_MUL	1597
 
 
+// Copies a table character into bars from pos, in reverse order if step is
+// -1, and returns its parity sum for the 8 element weights.
+static int rss14Char(uint8_t bars[], int pos, int step, const uint8_t pat[8], const int weights[]) {
+
+	int i, parity;
+
+	parity = 0;
+	for (i = 0; i < 8; i++) {
+		bars[pos + i*step] = pat[i];
+		parity += weights[i] * pat[i];
+	}
+	return(parity);
+}
+
+
 // call with str = 13-digit primary, no check digit
-static bool RSS14enc(gs1_encoder *ctx, uint8_t string[], uint8_t bars[], int ccFlag) {
-
-	// stores even elements N & max, odd N & max, even mul, combos
-	static const int tbl154[4*6] = {
-		/* 15,4 */	10,7,	5,2,	4,	336,
-				8,5,	7,4,	20,	700,
-				6,3,	9,6,	48,	480,
-				4,1,	11,8,	81,	81 };
-
-	// stores odd elements N & max, even N & max, odd mul, combos
-	static const int tbl164[5*6] = {
-		/* 16,4 */	12,8,	4,1,	1,	161,
-				10,6,	6,3,	10,	800,
-				8,4,	8,5,	34,	1054,
-				6,3,	10,6,	70,	700,
-				4,1,	12,8,	126,126 };
+static bool RSS14enc(uint8_t string[], uint8_t bars[], int ccFlag) {
 
 	static const uint8_t leftParity[PARITYCHRSIZE * 3] = {
 		3,8,2,
@@ -170,13 +171,9 @@ static bool RSS14enc(gs1_encoder *ctx, uint8_t string[], uint8_t bars[], int ccF
 		16,48,65,37,32,17,51,74,64,34,23,69,49,68,46,59 };
 
 	double data;
-	int value;
-	int i;
-	int elementN, elementMax, parity;
+	int i, parity;
 	int leftPar, rightPar;
-	long chrValue, chrValSave, semiValue, semiValSave, longNum;
-	int iIndex;
-	int *widths;
+	long chrValue, chrValSave, semiValue;
 
 	data = atof((char*)string);
 	if (ccFlag) data += 10000000000000.;
@@ -189,155 +186,19 @@ static bool RSS14enc(gs1_encoder *ctx, uint8_t string[], uint8_t bars[], int ccF
 	// calculate left (high order) symbol half value:
 	chrValue = chrValSave = (long)(data / LEFT_MUL);
 
-	// determine the 1st (left) character
-	// get the 1st char odd elements value
-	semiValue = semiValSave = chrValue / SEMI_MUL;
-
-	// get 1st char index into tbl164
-	iIndex = 0;
-	while (semiValue >= tbl164[iIndex+5]) {
-		semiValue -= tbl164[iIndex+5];
-		iIndex += 6;
-	}
-
-	// get odd elements N and max
-	elementN = tbl164[iIndex];
-	elementMax = tbl164[iIndex+1];
-	longNum = value = (int)(semiValue / tbl164[iIndex+4]);
-
-	// generate and store odd element widths:
-	widths = gs1_getRSSwidths(ctx, value, elementN, K, elementMax, 1);
-	parity = 0l;
-	for (i = 0; i < K; i++) {
-		bars[(i * 2)] = (uint8_t)widths[i];
-		parity += leftWeights[i * 2] * widths[i];
-		parity = parity % PARITY_MOD;
-	}
-
-	// calculate even elements value:
-	value = (int)(semiValue - (tbl164[iIndex+4] * longNum));
-	elementN = tbl164[iIndex+2];
-	elementMax = tbl164[iIndex+3];
-
-	// generate and store even element widths:
-	widths = gs1_getRSSwidths(ctx, value, elementN, K, elementMax, 0);
-	for (i = 0; i < K; i++) {
-		bars[1 + (i * 2)] = (uint8_t)widths[i];
-		parity += leftWeights[(i * 2) + 1] * widths[i];
-		parity = parity % PARITY_MOD;
-	}
-
-	// get the 2nd char value
-	semiValue = chrValue - (semiValSave * SEMI_MUL);
-
-	// get 2nd char index into tbl154
-	iIndex = 0;
-	while (semiValue >= tbl154[iIndex+5]) {
-		semiValue -= tbl154[iIndex+5];
-		iIndex += 6;
-	}
-
-	// get even elements N and max
-	elementN = tbl154[iIndex];
-	elementMax = tbl154[iIndex+1];
-	longNum = value = (int)(semiValue / tbl154[iIndex+4]);
-
-	// generate and store even element widths of the 2nd char:
-	widths = gs1_getRSSwidths(ctx, value, elementN, K, elementMax, 1);
-	for (i = 0; i < K; i++) {
-		bars[19 - (i * 2)] = (uint8_t)widths[i];
-		parity += leftWeights[(i * 2)+1+8] * widths[i];
-		parity = parity % PARITY_MOD;
-	}
-
-	// calculate 2nd char odd elements value:
-	value = (int)(semiValue - (tbl154[iIndex+4] * longNum));
-	elementN = tbl154[iIndex+2];
-	elementMax = tbl154[iIndex+3];
-
-	// generate and store odd element widths:
-	widths = gs1_getRSSwidths(ctx, value, elementN, K, elementMax, 0);
-	for (i = 0; i < K; i++) {
-		bars[20 - (i * 2)] = (uint8_t)widths[i];
-		parity += leftWeights[(i * 2)+8] * widths[i];
-		parity = parity % PARITY_MOD;
-	}
+	// 1st (left) char is an outside char, the 2nd an inside char reversed
+	semiValue = chrValue / SEMI_MUL;
+	parity = rss14Char(bars, 0, 1, gs1_rss14Outside[semiValue], leftWeights);
+	parity += rss14Char(bars, 20, -1, gs1_rss14Inside[chrValue - semiValue * SEMI_MUL], &leftWeights[8]);
 
 	// calculate right (low order) symbol half value:
 	chrValue = (long)(data - ((double)chrValSave * LEFT_MUL));
 
-	// determine the 3rd character
-	// get the 3rd char odd elements value
-	semiValue = semiValSave = chrValue / SEMI_MUL;
-
-	// get 3rd char index into tbl164
-	iIndex = 0;
-	while (semiValue >= tbl164[iIndex+5]) {
-		semiValue -= tbl164[iIndex+5];
-		iIndex += 6;
-	}
-
-	// get odd elements N and max
-	elementN = tbl164[iIndex];
-	elementMax = tbl164[iIndex+1];
-	longNum = value = (int)(semiValue / tbl164[iIndex+4]);
-
-	// generate and store odd element widths:
-	widths = gs1_getRSSwidths(ctx, value, elementN, K, elementMax, 1);
-	for (i = 0; i < K; i++) {
-		bars[41 - (i * 2)] = (uint8_t)widths[i];
-		parity += rightWeights[i * 2] * widths[i];
-		parity = parity % PARITY_MOD;
-	}
-
-	// calculate even elements value:
-	value = (int)(semiValue - (tbl164[iIndex+4] * longNum));
-	elementN = tbl164[iIndex+2];
-	elementMax = tbl164[iIndex+3];
-
-	// generate and store even element widths:
-	widths = gs1_getRSSwidths(ctx, value, elementN, K, elementMax, 0);
-	for (i = 0; i < K; i++) {
-		bars[40 - (i * 2)] = (uint8_t)widths[i];
-		parity += rightWeights[(i * 2) + 1] * widths[i];
-		parity = parity % PARITY_MOD;
-	}
-
-	// get the 4th char value
-	semiValue = chrValue - (semiValSave * SEMI_MUL);
-
-	// get 4th char index into tbl154
-	iIndex = 0;
-	while (semiValue >= tbl154[iIndex+5]) {
-		semiValue -= tbl154[iIndex+5];
-		iIndex += 6;
-	}
-
-	// get even elements N and max
-	elementN = tbl154[iIndex];
-	elementMax = tbl154[iIndex+1];
-	longNum = value = (int)(semiValue / tbl154[iIndex+4]);
-
-	// generate and store even element widths of the 4th char:
-	widths = gs1_getRSSwidths(ctx, value, elementN, K, elementMax, 1);
-	for (i = 0; i < K; i++) {
-		bars[22 + (i * 2)] = (uint8_t)widths[i];
-		parity += rightWeights[(i * 2)+1+8] * widths[i];
-		parity = parity % PARITY_MOD;
-	}
-
-	// calculate 4th char odd elements value:
-	value = (int)(semiValue - (tbl154[iIndex+4] * longNum));
-	elementN = tbl154[iIndex+2];
-	elementMax = tbl154[iIndex+3];
-
-	// generate and store odd element widths:
-	widths = gs1_getRSSwidths(ctx, value, elementN, K, elementMax, 0);
-	for (i = 0; i < K; i++) {
-		bars[21 + (i * 2)] = (uint8_t)widths[i];
-		parity += rightWeights[(i * 2)+8] * widths[i];
-		parity = parity % PARITY_MOD;
-	}
+	// 3rd char is an outside char reversed, the 4th an inside char
+	semiValue = chrValue / SEMI_MUL;
+	parity += rss14Char(bars, 41, -1, gs1_rss14Outside[semiValue], rightWeights);
+	parity += rss14Char(bars, 21, 1, gs1_rss14Inside[chrValue - semiValue * SEMI_MUL], &rightWeights[8]);
+	parity = parity % PARITY_MOD;
 
 	// calculate finders
 	if (parity >= 8) {
@@ -361,6 +222,19 @@ static bool RSS14enc(gs1_encoder *ctx, uint8_t string[], uint8_t bars[], int ccF
 }
 
 
+// gets the linear pattern for primary from whichever cache holds it, else encodes it
+static bool rss14Lin(gs1_encoder *ctx, char primaryStr[], int ccFlag, uint8_t linPattern[]) {
+
+	if (gs1_driverLinGet(ctx, primaryStr, 13, ccFlag, linPattern, RSS14_ELMNTS)) return(true);
+	if (!gs1_rssGtinGet(ctx, sRSS14, primaryStr, ccFlag, linPattern)) {
+		if (ctx->errFlag || !RSS14enc((uint8_t*)primaryStr, linPattern, ccFlag) || ctx->errFlag) return(false);
+		gs1_rssGtinPut(ctx, sRSS14, primaryStr, ccFlag, linPattern);
+	}
+	gs1_driverLinPut(ctx, linPattern, RSS14_ELMNTS, true);
+	return(true);
+}
+
+
 void gs1_RSS14(gs1_encoder *ctx) {
 
 	struct sPrints prints;
@@ -376,6 +250,7 @@ void gs1_RSS14(gs1_encoder *ctx) {
 	int i;
 	int rows, ccFlag;
 	char *ccStr;
+	int primaryLen, ccLen;
 	int symHt;
 
 	if (ctx->sym == sRSS14) {
@@ -384,15 +259,10 @@ void gs1_RSS14(gs1_encoder *ctx) {
 	else {
 		symHt = RSS14_TRNC_H;
 	}
-	ccStr = strchr(ctx->dataStr, '|');
-	if (ccStr == NULL) ccFlag = false;
-	else {
-		ccFlag = true;
-		ccStr[0] = '\0'; // separate primary data
-		ccStr++; // point to secondary data
-	}
+	ccStr = gs1_splitCC(ctx, &primaryLen, &ccLen);
+	ccFlag = (ccStr != NULL);
 
-	if (strlen(ctx->dataStr) > 13) {
+	if (primaryLen > 13) {
 		strcpy(ctx->errMsg, "primary data exceeds 13 digits");
 		ctx->errFlag = true;
 		return;
@@ -402,7 +272,7 @@ void gs1_RSS14(gs1_encoder *ctx) {
 	strcat(tempStr, ctx->dataStr);
 	strcpy(primaryStr, tempStr + strlen(tempStr) - 13);
 
-	if (!RSS14enc(ctx, (uint8_t*)primaryStr, linPattern, ccFlag) || ctx->errFlag) return;
+	if (!rss14Lin(ctx, primaryStr, ccFlag, linPattern)) return;
 
 #if PRNT
 	printf("\n%s", primaryStr);
@@ -412,18 +282,17 @@ void gs1_RSS14(gs1_encoder *ctx) {
 	}
 	printf("\n");
 #endif
-	ctx->line1 = true; // so first line is not Y undercut
 	// init most likely prints values
 	prints.elmCnt = RSS14_ELMNTS;
 	prints.pattern = linPattern;
 	prints.guards = true;
-	prints.height = ctx->pixMult*symHt;
+	prints.height = ctx->driver_pixMult*symHt;
 	prints.leftPad = 0;
 	prints.rightPad = 0;
 	prints.whtFirst = true;
 	prints.reverse = false;
 	if (ccFlag) {
-		if (!((rows = gs1_CC4enc(ctx, (uint8_t*)ccStr, ccPattern)) > 0) || ctx->errFlag) return;
+		if (!((rows = gs1_CC4enc(ctx, (uint8_t*)ccStr, ccLen, ccPattern)) > 0) || ctx->errFlag) return;
 #if PRNT
 		{
 			int j;
@@ -437,96 +306,101 @@ void gs1_RSS14(gs1_encoder *ctx) {
 			}
 		}
 #endif
-		if (ctx->bmp) {
-			// note: BMP is bottom to top inverted
-			gs1_bmpHeader(ctx->pixMult*CCB4_WIDTH,
-					ctx->pixMult*(rows*2+symHt) + ctx->sepHt, ctx->outfp);
-
-			// RSS-14
-			prints.leftPad = RSS14_L_PADR;
-			gs1_printElmnts(ctx, &prints);
-
-			// CC separator
-			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// Composite Component
-			prints.elmCnt = CCB4_ELMNTS;
-			prints.guards = false;
-			prints.height = ctx->pixMult*2;
-			prints.leftPad = 0;
-			for (i = rows-1; i >= 0; i--) {
-				prints.pattern = ccPattern[i];
-				gs1_printElmnts(ctx, &prints);
-			}
+		gs1_driverInit(ctx, CCB4_WIDTH,
+				ctx->driver_pixMult*(rows*2+symHt) + ctx->sepHt);
+
+		// Composite Component
+		prints.elmCnt = CCB4_ELMNTS;
+		prints.guards = false;
+		prints.height = ctx->driver_pixMult*2;
+		for (i = 0; i < rows; i++) {
+			prints.pattern = ccPattern[i];
+			gs1_driverAddCCRow(ctx, &prints);
 		}
-		else {
-			gs1_tifHeader(ctx->pixMult*CCB4_WIDTH,
-					ctx->pixMult*(rows*2+symHt) + ctx->sepHt, ctx->outfp);
-
-			// Composite Component
-			prints.elmCnt = CCB4_ELMNTS;
-			prints.guards = false;
-			prints.height = ctx->pixMult*2;
-			for (i = 0; i < rows; i++) {
-				prints.pattern = ccPattern[i];
-				gs1_printElmnts(ctx, &prints);
-			}
 
-			prints.elmCnt = RSS14_ELMNTS;
-			prints.pattern = linPattern;
-			prints.guards = true;
-			prints.height = ctx->pixMult*symHt;
-			prints.leftPad = RSS14_L_PADR;
+		prints.elmCnt = RSS14_ELMNTS;
+		prints.pattern = linPattern;
+		prints.guards = true;
+		prints.height = ctx->driver_pixMult*symHt;
+		prints.leftPad = RSS14_L_PADR;
 
-			// CC separator
-			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
+		// CC separator
+		prntCnv = gs1_cnvSeparator(ctx, &prints);
+		gs1_driverAddRow(ctx, prntCnv);
 
-			// RSS-14
-			gs1_printElmnts(ctx, &prints);
-		}
+		// RSS-14
+		gs1_driverAddRow(ctx, &prints);
 	}
 	else { // primary only
-		if (ctx->bmp) {
-			gs1_bmpHeader(ctx->pixMult*RSS14_SYM_W, ctx->pixMult*symHt, ctx->outfp);
-		}
-		else {
-			gs1_tifHeader(ctx->pixMult*RSS14_SYM_W, ctx->pixMult*symHt, ctx->outfp);
-		}
+		gs1_driverInit(ctx, RSS14_SYM_W, ctx->driver_pixMult*symHt);
 
 		// RSS-14
-		gs1_printElmnts(ctx, &prints);
+		gs1_driverAddRow(ctx, &prints);
 	}
+
+	gs1_driverFinalise(ctx);
 	return;
 }
 
 
-void gs1_RSS14S(gs1_encoder *ctx) {
+/*
+ * The stacked symbols are described as data, as the rows below any
+ * composite component from top to bottom. Linear rows print one half of the
+ * RSS-14 pattern, the upper starting with a space and the lower with a bar,
+ * and the separator rows are derived from the half given.
+ */
+enum {
+	rowLIN,		// linear row, height in X
+	rowCNV,		// complemented separator of a linear row
+	row14S,		// RSS-14S separator between both halves
+	rowCHEX,	// checkerboard separator
+};
+
+struct stackRowT {
+	int kind;
+	int half;	// 0 = upper, 1 = lower linear half
+	int height;	// in X for linear rows, separators are sepHt
+};
+
+static const struct stackRowT rss14SRows[] = {
+	{ rowLIN, 0, RSS14_ROWS1_H },
+	{ row14S, 0, 0 },
+	{ rowLIN, 1, RSS14_ROWS2_H },
+};
+
+static const struct stackRowT rss14SORows[] = {
+	{ rowLIN, 0, RSS14_SYM_H },
+	{ rowCNV, 0, 0 },
+	{ rowCHEX, 0, 0 },
+	{ rowCNV, 1, 0 },
+	{ rowLIN, 1, RSS14_SYM_H },
+};
+
+
+static void stackedRows(gs1_encoder *ctx, const struct stackRowT rows[], int rowCnt) {
 
 	struct sPrints prints;
+	struct sPrints chexPrnts;
 	struct sPrints *prntCnv;
 
 	uint8_t linPattern[RSS14_ELMNTS];
+	uint8_t chexPattern[RSS14_SYM_W/2+2];
 
 	uint8_t (*ccPattern)[CCB4_ELMNTS] = ctx->ccPattern;
 
 	char primaryStr[14+1];
 	char tempStr[28+1];
 
-	int i;
-	int rows, ccFlag;
+	int i, j;
+	int ccRows, ccFlag;
 	char *ccStr;
+	int primaryLen, ccLen;
+	long ydim;
 
-	ccStr = strchr(ctx->dataStr, '|');
-	if (ccStr == NULL) ccFlag = false;
-	else {
-		ccFlag = true;
-		ccStr[0] = '\0'; // separate primary data
-		ccStr++; // point to secondary data
-	}
+	ccStr = gs1_splitCC(ctx, &primaryLen, &ccLen);
+	ccFlag = (ccStr != NULL);
 
-	if (strlen(ctx->dataStr) > 13) {
+	if (primaryLen > 13) {
 		strcpy(ctx->errMsg, "primary data exceeds 13 digits");
 		ctx->errFlag = true;
 		return;
@@ -536,7 +410,7 @@ void gs1_RSS14S(gs1_encoder *ctx) {
 	strcat(tempStr, ctx->dataStr);
 	strcpy(primaryStr, tempStr + strlen(tempStr) - 13);
 
-	if (!RSS14enc(ctx, (uint8_t*)primaryStr, linPattern, ccFlag) || ctx->errFlag) return;
+	if (!rss14Lin(ctx, primaryStr, ccFlag, linPattern)) return;
 #if PRNT
 	printf("\n%s", primaryStr);
 	printf("\n");
@@ -545,8 +419,12 @@ void gs1_RSS14S(gs1_encoder *ctx) {
 	}
 	printf("\n");
 #endif
-	ctx->line1 = true; // so first line is not Y undercut
-	// init most common RSS14S row prints values
+	ydim = 0;
+	for (i = 0; i < rowCnt; i++) {
+		ydim += (rows[i].kind == rowLIN) ? ctx->driver_pixMult*rows[i].height : ctx->sepHt;
+	}
+
+	// init most common stacked row prints values
 	prints.elmCnt = RSS14_ELMNTS/2;
 	prints.guards = true;
 	prints.leftPad = 0;
@@ -554,360 +432,89 @@ void gs1_RSS14S(gs1_encoder *ctx) {
 	prints.whtFirst = true;
 	prints.reverse = false;
 	if (ccFlag) {
-		if (!((rows = gs1_CC2enc(ctx, (uint8_t*)ccStr, ccPattern)) > 0) || ctx->errFlag) return;
+		if (!((ccRows = gs1_CC2enc(ctx, (uint8_t*)ccStr, ccLen, ccPattern)) > 0) || ctx->errFlag) return;
 #if PRNT
-		{
-			int j;
-			printf("\n%s", ccStr);
-			printf("\n");
-			for (i = 0; i < rows; i++) {
-				for (j = 0; j < CCB2_RSS14_ELMNTS; j++) {
-					printf("%d", ccPattern[i][j]);
-				}
-				printf("\n");
+		printf("\n%s", ccStr);
+		printf("\n");
+		for (i = 0; i < ccRows; i++) {
+			for (j = 0; j < CCB2_RSS14_ELMNTS; j++) {
+				printf("%d", ccPattern[i][j]);
 			}
+			printf("\n");
 		}
 #endif
 
-		if (ctx->bmp) {
-			// note: BMP is bottom to top inverted
-			gs1_bmpHeader(ctx->pixMult*(CCB2_WIDTH),
-				ctx->pixMult*(rows*2+RSS14_ROWS1_H+RSS14_ROWS2_H) + 2*ctx->sepHt, ctx->outfp);
-
-			// RSS14S lower row
-			prints.height = ctx->pixMult*RSS14_ROWS2_H;
-			prints.pattern = &linPattern[RSS14_ELMNTS/2];
-			prints.rightPad = RSS14_R_PADR;
-			prints.whtFirst = false;
-			gs1_printElmnts(ctx, &prints);
+		gs1_driverInit(ctx, (CCB2_WIDTH), ydim + ctx->driver_pixMult*ccRows*2 + ctx->sepHt);
 
-			// RSS14S separator pattern
-			prints.pattern = linPattern;
-			prntCnv = separator14S(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// RSS14S upper row
-			prints.whtFirst = true;
-			prints.height = ctx->pixMult*RSS14_ROWS1_H;
-			gs1_printElmnts(ctx, &prints);
-
-			// CC separator
-			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// Composite Component
-			prints.elmCnt = CCB2_ELMNTS;
-			prints.guards = false;
-			prints.height = ctx->pixMult*2;
-			prints.rightPad = 0;
-			for (i = rows-1; i >= 0; i--) {
-				prints.pattern = ccPattern[i];
-				gs1_printElmnts(ctx, &prints);
-			}
+		// Composite Component
+		prints.elmCnt = CCB2_ELMNTS;
+		prints.guards = false;
+		prints.height = ctx->driver_pixMult*2;
+		for (i = 0; i < ccRows; i++) {
+			prints.pattern = ccPattern[i];
+			gs1_driverAddCCRow(ctx, &prints);
 		}
-		else {
-			gs1_tifHeader(ctx->pixMult*(CCB2_WIDTH),
-					ctx->pixMult*(rows*2+RSS14_ROWS1_H+RSS14_ROWS2_H) + 2*ctx->sepHt, ctx->outfp);
 
-			// Composite Component
-			prints.elmCnt = CCB2_ELMNTS;
-			prints.guards = false;
-			prints.height = ctx->pixMult*2;
-			for (i = 0; i < rows; i++) {
-				prints.pattern = ccPattern[i];
-				gs1_printElmnts(ctx, &prints);
-			}
+		// CC separator
+		prints.elmCnt = RSS14_ELMNTS/2;
+		prints.pattern = linPattern;
+		prints.rightPad = RSS14_R_PADR;
+		prntCnv = gs1_cnvSeparator(ctx, &prints);
+		gs1_driverAddRow(ctx, prntCnv);
 
-			// CC separator
-			prints.elmCnt = RSS14_ELMNTS/2;
-			prints.pattern = linPattern;
-			prints.rightPad = RSS14_R_PADR;
+		prints.guards = true;
+	}
+	else { // primary only
+		gs1_driverInit(ctx, (RSS14_SYM_W/2+2), ydim);
+	}
+
+	for (i = 0; i < rowCnt; i++) {
+		prints.pattern = &linPattern[rows[i].half*RSS14_ELMNTS/2];
+		prints.whtFirst = (rows[i].half == 0);
+		switch (rows[i].kind) {
+		case rowLIN:
+			prints.height = ctx->driver_pixMult*rows[i].height;
+			gs1_driverAddRow(ctx, &prints);
+			break;
+		case rowCNV:
 			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// RSS14S upper row
-			prints.guards = true;
-			prints.height = ctx->pixMult*RSS14_ROWS1_H;
-			gs1_printElmnts(ctx, &prints);
-
-			// RSS14S separator pattern
+			gs1_driverAddRow(ctx, prntCnv);
+			break;
+		case row14S:
 			prntCnv = separator14S(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// RSS14S lower row
-			prints.height = ctx->pixMult*RSS14_ROWS2_H;
-			prints.pattern = &linPattern[RSS14_ELMNTS/2];
-			prints.whtFirst = false;
-			gs1_printElmnts(ctx, &prints);
+			gs1_driverAddRow(ctx, prntCnv);
+			break;
+		case rowCHEX:
+			for (j = 0; j < RSS14_SYM_W/2+2; j++) chexPattern[j] = 1; // chex = all 1X elements
+			chexPattern[0] = 5; // wide space on left
+			chexPattern[RSS14_SYM_W/2+1-7] = 4; // wide space on right
+			chexPrnts.elmCnt = RSS14_SYM_W/2+2-7;
+			chexPrnts.pattern = &chexPattern[0];
+			chexPrnts.guards = false;
+			chexPrnts.height = ctx->sepHt;
+			chexPrnts.whtFirst = true;
+			chexPrnts.leftPad = 0;
+			chexPrnts.rightPad = prints.rightPad; // padded for a composite
+			chexPrnts.reverse = false;
+			gs1_driverAddFixedRow(ctx, &chexPrnts);
+			break;
 		}
 	}
-	else { // primary only
-		if (ctx->bmp) {
-			gs1_bmpHeader(ctx->pixMult*(RSS14_SYM_W/2+2),
-				ctx->pixMult*(RSS14_ROWS1_H+RSS14_ROWS2_H) + ctx->sepHt, ctx->outfp);
 
+	gs1_driverFinalise(ctx);
+	return;
+}
 
-			// RSS14S lower row
-			prints.height = ctx->pixMult*RSS14_ROWS2_H;
-			prints.pattern = &linPattern[RSS14_ELMNTS/2];
-			prints.whtFirst = false;
-			gs1_printElmnts(ctx, &prints);
-
-			// RSS14S separator pattern
-			prints.pattern = linPattern;
-			prntCnv = separator14S(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// RSS14S upper row
-			prints.whtFirst = true;
-			prints.height = ctx->pixMult*RSS14_ROWS1_H;
-			gs1_printElmnts(ctx, &prints);
-		}
-		else {
-			gs1_tifHeader(ctx->pixMult*(RSS14_SYM_W/2+2),
-					ctx->pixMult*(RSS14_ROWS1_H+RSS14_ROWS2_H) + ctx->sepHt, ctx->outfp);
-
-			// RSS14S upper row
-			prints.pattern = linPattern;
-			prints.height = ctx->pixMult*RSS14_ROWS1_H;
-			gs1_printElmnts(ctx, &prints);
 
-			// RSS14S separator pattern
-			prntCnv = separator14S(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
+void gs1_RSS14S(gs1_encoder *ctx) {
 
-			// RSS14S lower row
-			prints.pattern = &linPattern[RSS14_ELMNTS/2];
-			prints.height = ctx->pixMult*RSS14_ROWS2_H;
-			prints.whtFirst = false;
-			gs1_printElmnts(ctx, &prints);
-		}
-	}
+	stackedRows(ctx, rss14SRows, sizeof(rss14SRows)/sizeof(rss14SRows[0]));
 	return;
 }
 
 
 void gs1_RSS14SO(gs1_encoder *ctx) {
 
-	struct sPrints prints;
-	struct sPrints chexPrnts;
-	struct sPrints *prntCnv;
-
-	uint8_t linPattern[RSS14_ELMNTS];
-	uint8_t chexPattern[RSS14_SYM_W/2+2];
-
-	uint8_t (*ccPattern)[CCB4_ELMNTS] = ctx->ccPattern;
-
-	char primaryStr[14+1];
-	char tempStr[28+1];
-
-	int i;
-	int rows, ccFlag;
-	char *ccStr;
-
-	for (i = 0; i < RSS14_SYM_W/2+2; i++) chexPattern[i] = 1; // chex = all 1X elements
-	chexPattern[0] = 5; // wide space on left
-	chexPattern[RSS14_SYM_W/2+1-7] = 4; // wide space on right
-	chexPrnts.elmCnt = RSS14_SYM_W/2+2-7;
-	chexPrnts.pattern = &chexPattern[0];
-	chexPrnts.guards = false;
-	chexPrnts.height = ctx->sepHt;
-	chexPrnts.whtFirst = true;
-	chexPrnts.leftPad = 0;
-	chexPrnts.rightPad = 0; // assume not a composite for now
-	chexPrnts.reverse = false;
-
-	ccStr = strchr(ctx->dataStr, '|');
-	if (ccStr == NULL) ccFlag = false;
-	else {
-		ccFlag = true;
-		ccStr[0] = '\0'; // separate primary data
-		ccStr++; // point to secondary data
-	}
-
-	if (strlen(ctx->dataStr) > 13) {
-		strcpy(ctx->errMsg, "primary data exceeds 13 digits");
-		ctx->errFlag = true;
-		return;
-	}
-
-	strcpy(tempStr, "000000000000");
-	strcat(tempStr, ctx->dataStr);
-	strcpy(primaryStr, tempStr + strlen(tempStr) - 13);
-
-	if (!RSS14enc(ctx, (uint8_t*)primaryStr, linPattern, ccFlag) || ctx->errFlag) return;
-#if PRNT
-	printf("\n%s", primaryStr);
-	printf("\n");
-	for (i = 0; i < RSS14_ELMNTS; i++) {
-		printf("%d", linPattern[i]);
-	}
-	printf("\n");
-#endif
-	ctx->line1 = true; // so first line is not Y undercut
-	// init most common RSS14SO row prints values
-	prints.elmCnt = RSS14_ELMNTS/2;
-	prints.guards = true;
-	prints.leftPad = 0;
-	prints.rightPad = 0;
-	prints.whtFirst = true;
-	prints.reverse = false;
-	if (ccFlag) {
-		chexPrnts.rightPad = RSS14_R_PADR; // pad for composite
-		if (!((rows = gs1_CC2enc(ctx, (uint8_t*)ccStr, ccPattern)) > 0) || ctx->errFlag) return;
-#if PRNT
-		{
-			int j;
-			printf("\n%s", ccStr);
-			printf("\n");
-			for (i = 0; i < rows; i++) {
-				for (j = 0; j < CCB2_RSS14_ELMNTS; j++) {
-					printf("%d", ccPattern[i][j]);
-				}
-				printf("\n");
-			}
-		}
-#endif
-
-		if (ctx->bmp) {
-			// note: BMP is bottom to top inverted
-			gs1_bmpHeader(ctx->pixMult*(CCB2_WIDTH),
-				ctx->pixMult*(rows*2+RSS14_SYM_H*2) + 4*ctx->sepHt, ctx->outfp);
-
-			// RSS14SO lower row
-			prints.height = ctx->pixMult*RSS14_SYM_H;
-			prints.pattern = &linPattern[RSS14_ELMNTS/2];
-			prints.rightPad = RSS14_R_PADR;
-			prints.whtFirst = false;
-			gs1_printElmnts(ctx, &prints);
-
-			// RSS14SO lower row separator pattern
-			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// chex pattern
-			gs1_printElmnts(ctx, &chexPrnts);
-
-			// RSS14SO upper row separator pattern
-			prints.pattern = linPattern;
-			prints.whtFirst = true;
-			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// RSS14SO upper row
-			gs1_printElmnts(ctx, &prints);
-
-			// CC separator
-			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// Composite Component
-			prints.elmCnt = CCB2_ELMNTS;
-			prints.guards = false;
-			prints.height = ctx->pixMult*2;
-			prints.rightPad = 0;
-			for (i = rows-1; i >= 0; i--) {
-				prints.pattern = ccPattern[i];
-				gs1_printElmnts(ctx, &prints);
-			}
-		}
-		else {
-			gs1_tifHeader(ctx->pixMult*(CCB2_WIDTH),
-				ctx->pixMult*(rows*2+RSS14_SYM_H*2) + 4*ctx->sepHt, ctx->outfp);
-
-			// Composite Component
-			prints.elmCnt = CCB2_ELMNTS;
-			prints.guards = false;
-			prints.height = ctx->pixMult*2;
-			for (i = 0; i < rows; i++) {
-				prints.pattern = ccPattern[i];
-				gs1_printElmnts(ctx, &prints);
-			}
-
-			// CC separator
-			prints.elmCnt = RSS14_ELMNTS/2;
-			prints.pattern = linPattern;
-			prints.rightPad = RSS14_R_PADR;
-			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// RSS14SO upper row
-			prints.guards = true;
-			prints.height = ctx->pixMult*RSS14_SYM_H;
-			gs1_printElmnts(ctx, &prints);
-
-			// RSS14SO upper row separator pattern
-			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// chex pattern
-			gs1_printElmnts(ctx, &chexPrnts);
-
-			// RSS14SO lower row separator pattern
-			prints.pattern = &linPattern[RSS14_ELMNTS/2];
-			prints.whtFirst = false;
-			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// RSS14SO lower row
-			prints.height = ctx->pixMult*RSS14_SYM_H;
-			gs1_printElmnts(ctx, &prints);
-		}
-	}
-	else { // primary only
-		if (ctx->bmp) {
-			gs1_bmpHeader(ctx->pixMult*(RSS14_SYM_W/2+2),
-				ctx->pixMult*(RSS14_SYM_H*2) + 3*ctx->sepHt, ctx->outfp);
-
-			// RSS14SO lower row
-			prints.height = ctx->pixMult*RSS14_SYM_H;
-			prints.pattern = &linPattern[RSS14_ELMNTS/2];
-			prints.whtFirst = false;
-			gs1_printElmnts(ctx, &prints);
-
-			// RSS14SO lower row separator pattern
-			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// chex pattern
-			gs1_printElmnts(ctx, &chexPrnts);
-
-			// RSS14SO upper row separator pattern
-			prints.pattern = linPattern;
-			prints.whtFirst = true;
-			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// RSS14SO upper row
-			prints.height = ctx->pixMult*RSS14_SYM_H;
-			gs1_printElmnts(ctx, &prints);
-		}
-		else {
-			gs1_tifHeader(ctx->pixMult*(RSS14_SYM_W/2+2),
-				ctx->pixMult*(RSS14_SYM_H*2) + 3*ctx->sepHt, ctx->outfp);
-
-			// RSS14SO upper row
-			prints.pattern = linPattern;
-			prints.height = ctx->pixMult*RSS14_SYM_H;
-			gs1_printElmnts(ctx, &prints);
-
-			// RSS14SO upper row separator pattern
-			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// chex pattern
-			gs1_printElmnts(ctx, &chexPrnts);
-
-			// RSS14SO lower row separator pattern
-			prints.pattern = &linPattern[RSS14_ELMNTS/2];
-			prints.whtFirst = false;
-			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// RSS14SO lower row
-			prints.height = ctx->pixMult*RSS14_SYM_H;
-			gs1_printElmnts(ctx, &prints);
-		}
-	}
+	stackedRows(ctx, rss14SORows, sizeof(rss14SORows)/sizeof(rss14SORows[0]));
 	return;
 }
@@ -32,6 +32,8 @@
 #define RSS14_ROWS2_H	7
 #define RSS14_L_PADR	5	// RSS-14 left offset
 #define RSS14_R_PADR	7	// RSS-14s right offset
+#define RSS14_OUTSIDE_VALS	2841	// 16,4 outside character values
+#define RSS14_INSIDE_VALS	1597	// 15,4 inside character values
 
 void gs1_RSS14(gs1_encoder *ctx);
 void gs1_RSS14S(gs1_encoder *ctx);
@@ -28,6 +28,7 @@
 #include "driver.h"
 #include "rssexp.h"
 #include "rssutil.h"
+#include "tables.h"
 
 // gets the next 12 bit sym char from bit string
 static int getVal12(uint8_t bitString[], int symNdx) {
@@ -49,10 +50,10 @@ static int getVal12(uint8_t bitString[], int symNdx) {
 
 
 // looks for '^' (symbol separator) in string and returns char index iff found
-static int isSymbolSepatator(uint8_t string[]) {
+static int isSymbolSepatator(uint8_t string[], int len) {
 	int i;
 
-	for (i = 0; i < (int)strlen((char*)string); i++) {
+	for (i = 0; i < len; i++) {
 		if (string[i] == '^') {
 			return(i);
 		}
@@ -66,81 +67,73 @@ static int isSymbolSepatator(uint8_t string[]) {
 #define K	4
 
 // Fills in elements for a symbol character given a element array and
-// and a symbol char value. Updates the parity *weight. Will fill in
-// the array forward or reverse order for odd or even characters.
-// Returns the updated parity.
-static int symCharPat(gs1_encoder *ctx, uint8_t bars[], int symValue, int parity, int weight,
-							 int forwardFlag) {
-
-	// odd elements N & max, even N & max, odd mul, combos:
-	static const int tbl174[5*6] = {
-			/* 17,4 */	12,7,	5,2,	4,	348,
-					10,5,	7,4,	20,	1040,
-					8,4,	9,5,	52,	1560,
-					6,3,	11,6,	104,1040,
-					4,1,	13,8,	204,204 };
-
-	int i, value, saveVal;
-	int elementN, elementMax;
-	int wgtOdd, wgtEven;
-	int iIndex;
-	int *widths;
-
-	wgtOdd = weight;
-	wgtEven = (weight * 3) % PARITY_MOD;
-
-	// get sym char val index into tbl174
-	iIndex = 0;
-	while (symValue >= tbl174[iIndex+5]) {
-		symValue -= tbl174[iIndex+5];
-		iIndex += 6;
-	}
-
-	// get odd elements N and max
-	elementN = tbl174[iIndex];
-	elementMax = tbl174[iIndex+1];
-	saveVal = value = symValue / tbl174[iIndex+4];
-
-	// generate and store odd element widths:
-	widths = gs1_getRSSwidths(ctx, value, elementN, K, elementMax, 0);
-	for (i = 0; i < 4; i++) {
-		if (forwardFlag) {
-			bars[i*2] = (uint8_t)widths[i]; // store in 0,2,4,6
-		}
-		else {
-			bars[7 - i*2] = (uint8_t)widths[i]; // else in 7,5,3,1
+// and a symbol char value, from the generated character table. Will fill in
+// the array forward or reverse order for odd or even characters. Returns the
+// parity updated for the weight.
+static int symCharPat(uint8_t bars[], int symValue, int parity, int weight, int forwardFlag) {
+
+	const uint8_t *pat = gs1_rssExpChars[symValue];
+	int i;
+
+	if (forwardFlag) {
+		memcpy(bars, pat, 8);
+	}
+	else {
+		for (i = 0; i < 8; i++) {
+			bars[i] = pat[7-i];
 		}
-		parity += wgtOdd * widths[i];
-		parity = parity % PARITY_MOD;
-		wgtOdd = (wgtOdd * 9) % PARITY_MOD;
 	}
+	return((parity + weight * pat[8]) % PARITY_MOD);
+}
 
-	// calculate even elements value:
-	value = symValue - (tbl174[iIndex+4] * saveVal);
-	elementN = tbl174[iIndex+2];
-	elementMax = tbl174[iIndex+3];
 
-	// generate and store even element widths:
-	widths = gs1_getRSSwidths(ctx, value, elementN, K, elementMax, 1);
-	for (i = 0; i < 4; i++) {
-		if (forwardFlag) {
-			bars[1 + i*2] = (uint8_t)widths[i]; // store in 1,3,5,7
-		}
-		else {
-			bars[6 - i*2] = (uint8_t)widths[i]; // else in 6,4,2,0
-		}
-		parity += wgtEven * widths[i];
-		parity = parity % PARITY_MOD;
-		wgtEven = (wgtEven * 9) % PARITY_MOD;
+/*
+ * Packs the linear data into bitField, with the variable length symbol bit
+ * field filled in for the methods that have one. Returns the number of data
+ * characters, not segments, or 0 if error.
+ */
+static int packLin(gs1_encoder *ctx, uint8_t string[], int len, uint8_t bitField[], int ccFlag) {
+
+	int i, size;
+
+	ctx->linFlag = true;
+
+	if (((i=gs1_check2DData(string, len)) != 0) || ((i=isSymbolSepatator(string, len)) != 0)) {
+		sprintf(ctx->errMsg, "illegal character in RSS Expanded data = '%c'", string[i]);
+		ctx->errFlag = true;
+		return(0);
+	}
+#if PRNT
+	printf("%s\n", string);
+#endif
+	gs1_putBits(ctx, bitField, 0, 1, (uint16_t)ccFlag); // 2D linkage bit
+	size = gs1_pack(ctx, string, len, bitField);
+	if (size < 0) {
+		strcpy(ctx->errMsg, "data error");
+		ctx->errFlag = true;
+		return(0);
+	}
+
+	if ((bitField[0]&0x40) == 0x40) {
+		// method 1, insert variable length symbol bit field
+		bitField[0] = (uint8_t)(bitField[0] | ((((size+1)&1)<<5) + ((size > 13)?0x10:0)));
+	}
+	if ((bitField[0]&0x60) == 0) {
+		// method 00, insert variable length symbol bit field
+		bitField[0] = (uint8_t)(bitField[0] | ((((size+1)&1)<<4) + ((size > 13)?8:0)));
+	}
+	if ((bitField[0]&0x71) == 0x30) {
+		// method 01100/01101, insert variable length symbol bit field
+		bitField[0] = (uint8_t)(bitField[0] | ((((size+1)&1)<<1) + ((size > 13)?1:0)));
 	}
-	return(parity);
+	return(size);
 }
 
 
 #define FINDER_SIZE 6
 
 // convert AI string to bar widths in dbl segments
-static int RSS14Eenc(gs1_encoder *ctx, uint8_t string[], uint8_t bars[RSSEXP_MAX_DBL_SEGS][RSSEXP_ELMNTS], int ccFlag) {
+static int RSS14Eenc(gs1_encoder *ctx, uint8_t string[], int len, uint8_t bars[RSSEXP_MAX_DBL_SEGS][RSSEXP_ELMNTS], int ccFlag) {
 
 	static const uint8_t finders[FINDER_SIZE][3] = {
 		{ 1,8,4 },
@@ -170,41 +163,12 @@ static int RSS14Eenc(gs1_encoder *ctx, uint8_t string[], uint8_t bars[RSSEXP_MAX
 	int parity, weight;
 	int symValue;
 	int size, fndrNdx, fndrSetNdx;
-	uint8_t bitField[RSSEXP_MAX_DBL_SEGS*3];
+	uint8_t bitField[MAX_CCB4_BYTES]; // gs1_pack may fill this before finding the data too long
 
-	ctx->linFlag = true;
 	parity = 0;
 	weight = 0;
 
-	if (((i=gs1_check2DData(string)) != 0) || ((i=isSymbolSepatator(string)) != 0)) {
-		sprintf(ctx->errMsg, "illegal character in RSS Expanded data = '%c'", string[i]);
-		ctx->errFlag = true;
-		return(0);
-	}
-#if PRNT
-	printf("%s\n", string);
-#endif
-	gs1_putBits(ctx, bitField, 0, 1, (uint16_t)ccFlag); // 2D linkage bit
-	size = gs1_pack(ctx, string, bitField);
-	if (size < 0) {
-		strcpy(ctx->errMsg, "data error");
-		ctx->errFlag = true;
-		return(0);
-	}
-
-	// note size is # of data chars, not segments
-	if ((bitField[0]&0x40) == 0x40) {
-		// method 1, insert variable length symbol bit field
-		bitField[0] = (uint8_t)(bitField[0] | ((((size+1)&1)<<5) + ((size > 13)?0x10:0)));
-	}
-	if ((bitField[0]&0x60) == 0) {
-		// method 00, insert variable length symbol bit field
-		bitField[0] = (uint8_t)(bitField[0] | ((((size+1)&1)<<4) + ((size > 13)?8:0)));
-	}
-	if ((bitField[0]&0x71) == 0x30) {
-		// method 01100/01101, insert variable length symbol bit field
-		bitField[0] = (uint8_t)(bitField[0] | ((((size+1)&1)<<1) + ((size > 13)?1:0)));
-	}
+	if (!(size = packLin(ctx, string, len, bitField, ccFlag))) return(0);
 	fndrSetNdx = (size - 2) / 2;
 
 	for (i = 0; i < (size+2)/2; i++) { // loop through all dbl segments
@@ -214,7 +178,7 @@ static int RSS14Eenc(gs1_encoder *ctx, uint8_t string[], uint8_t bars[RSSEXP_MAX
 		if (i > 0) {
 			weight = parWts[2*(j-2)];
 			symValue = getVal12(bitField, i*2-1);
-			parity = symCharPat(ctx, &bars[i][0], symValue, parity, weight, true);
+			parity = symCharPat(&bars[i][0], symValue, parity, weight, true);
 		}
 		// fill finder for dbl segment
 		if (fndrNdx < 0) { // reversed finder
@@ -235,15 +199,103 @@ static int RSS14Eenc(gs1_encoder *ctx, uint8_t string[], uint8_t bars[RSSEXP_MAX
 		if (size > i*2) {
 			weight = parWts[2*(j-2)+1];
 			symValue = getVal12(bitField, i*2);
-			parity = symCharPat(ctx, &bars[i][8+5], symValue, parity, weight, false);
+			parity = symCharPat(&bars[i][8+5], symValue, parity, weight, false);
 		}
 	}
 	// fill in first parity char
-	symCharPat(ctx, bars[0], (size-3)*PARITY_MOD + parity, 0, weight, true);
+	symCharPat(bars[0], (size-3)*PARITY_MOD + parity, 0, weight, true);
 	return(size+1);
 }
 
 
+// encodes the primary data for ctx->rowWidth segments per row, reusing the last pattern if allowed
+static int linEnc(gs1_encoder *ctx, int primaryLen, int ccFlag, uint8_t dblPattern[RSSEXP_MAX_DBL_SEGS][RSSEXP_ELMNTS]) {
+
+	int segs;
+
+	segs = gs1_driverLinGet(ctx, ctx->dataStr, primaryLen, ccFlag, (uint8_t*)dblPattern, RSSEXP_MAX_DBL_SEGS*RSSEXP_ELMNTS);
+	if (!segs) {
+		if (!((segs = RSS14Eenc(ctx, (uint8_t*)ctx->dataStr, primaryLen, dblPattern, ccFlag)) > 0) || ctx->errFlag) return(0);
+		gs1_driverLinPut(ctx, (uint8_t*)dblPattern, RSSEXP_MAX_DBL_SEGS*RSSEXP_ELMNTS, segs);
+	}
+	return(segs);
+}
+
+
+/*
+ * Packs the primary data without building the symbol, for sizing. Returns
+ * the segment count, with the packed bit length before padding in *bits and
+ * the encodation method in rssexp_method, or 0 if error. With segWidth 0 the
+ * count is that packed at 22 segments per row, which the fit may pad by one.
+ */
+int gs1_RSSExpSize(gs1_encoder *ctx, int *bits) {
+
+	uint8_t bitField[MAX_CCB4_BYTES];
+	int i, n, size, ccLen, primaryLen;
+
+	n = (gs1_splitCC(ctx, &primaryLen, &ccLen) != NULL);
+	if (n && ctx->segWidth != 0 && ctx->segWidth < 4) {
+		strcpy(ctx->errMsg, "Composite must be at least 4 segments wide");
+		ctx->errFlag = true;
+		return(0);
+	}
+	ctx->rowWidth = (ctx->segWidth == 0) ? 22 : ctx->segWidth; // for getUnusedBitCnt
+	if (!(size = packLin(ctx, (uint8_t*)ctx->dataStr, primaryLen, bitField, n))) return(0);
+	*bits = ctx->cc_packBits;
+
+	// method is 1, 00, 010x, 0110x or 0111xxx following the linkage bit
+	if (bitField[0]&0x40) n = 1;
+	else if ((bitField[0]&0x20) == 0) n = 2;
+	else if ((bitField[0]&0x10) == 0) n = 4;
+	else if ((bitField[0]&0x08) == 0) n = 5;
+	else n = 7;
+	for (i = 0; i < n; i++) {
+		ctx->rssexp_method[i] = (char)('0' + ((bitField[0] >> (6-i)) & 1));
+	}
+	ctx->rssexp_method[n] = '\0';
+	return(size+1);
+}
+
+
+/*
+ * Picks the even number of segments per row, from 2 or 4 for a composite up
+ * to 22, that gives the smallest symbol area within maxWidth and maxHeight.
+ * segs is the count packed at 22 per row, which never needs padding. Other
+ * widths gain a segment if one would be left alone on the last row.
+ */
+static int fitSegWidth(gs1_encoder *ctx, int segs, int ccFlag, int ccRows) {
+
+	int w, s, j, rowCnt, mods;
+	int best = 0;
+	long ht, area, bestArea = 0;
+
+	for (w = (ccFlag) ? 4 : 2; w <= 22; w += 2) {
+		s = segs + ((segs%w == 1) ? 1 : 0);
+		j = (s <= w) ? s : w;
+		rowCnt = (s+j-1)/j;
+		mods = 2 + (j/2)*(17+15+17) + (j&1)*(17+15) + 2;
+		ht = (long)ctx->driver_pixMult*rowCnt*RSSEXP_SYM_H + (long)ctx->sepHt*(rowCnt-1)*3;
+		if (ccFlag) {
+			ht += (long)ctx->driver_pixMult*ccRows*2 + ctx->sepHt;
+		}
+		if ((ctx->maxWidth > 0 && mods > ctx->maxWidth) ||
+				(ctx->maxHeight > 0 && ht > (long)ctx->maxHeight*ctx->driver_pixMult)) {
+			continue;
+		}
+		area = mods*ht;
+		if (best == 0 || area < bestArea) {
+			best = w;
+			bestArea = area;
+		}
+	}
+	if (best == 0) {
+		strcpy(ctx->errMsg, "Symbol does not fit the maximum width and height");
+		ctx->errFlag = true;
+	}
+	return(best);
+}
+
+
 void gs1_RSSExp(gs1_encoder *ctx) {
 
 	struct sPrints prints;
@@ -251,7 +303,7 @@ void gs1_RSSExp(gs1_encoder *ctx) {
 	struct sPrints *prntCnv;
 
 	uint8_t linPattern[RSSEXP_MAX_DBL_SEGS*RSSEXP_ELMNTS+4];
-	uint8_t chexPattern[RSSEXP_MAX_DBL_SEGS*RSSEXP_SYM_W+2];
+	uint8_t *chexPattern = ctx->rssexp_chexPattern;
 	uint8_t dblPattern[RSSEXP_MAX_DBL_SEGS][RSSEXP_ELMNTS];
 
 	uint8_t (*ccPattern)[CCB4_ELMNTS] = ctx->ccPattern;
@@ -262,7 +314,9 @@ void gs1_RSSExp(gs1_encoder *ctx) {
 	int evenRow, rev;
 	int chexSize;
 	char *ccStr;
+	int primaryLen, ccLen;
 	int rPadl1, rPadcc;
+	int segWidth;
 
 	// Initialise to avoid compiler warnings
 	lNdx = 0;
@@ -270,21 +324,31 @@ void gs1_RSSExp(gs1_encoder *ctx) {
 	lHeight = 0;
 	rPadcc = 0;
 
-	ccStr = strchr(ctx->dataStr, '|');
-	if (ccStr == NULL) ccFlag = false;
-	else {
-		if (ctx->segWidth < 4) {
-			strcpy(ctx->errMsg, "Composite must be at least 4 segments wide");
-			ctx->errFlag = true;
-			return;
-		}
-		ccFlag = true;
-		ccStr[0] = '\0'; // separate primary data
-		ccStr++; // point to secondary data
+	ccStr = gs1_splitCC(ctx, &primaryLen, &ccLen);
+	ccFlag = (ccStr != NULL);
+	if (ccFlag && ctx->segWidth != 0 && ctx->segWidth < 4) {
+		strcpy(ctx->errMsg, "Composite must be at least 4 segments wide");
+		ctx->errFlag = true;
+		return;
 	}
 
-	ctx->rowWidth = ctx->segWidth; // save for getUnusedBitCnt
-	if (!((segs = RSS14Eenc(ctx, (uint8_t*)ctx->dataStr, dblPattern, ccFlag)) > 0) || ctx->errFlag) return;
+	if (ctx->segWidth == 0) { // fit the symbol to maxWidth and maxHeight
+		if (ccFlag) {
+			if (!((rows = gs1_CC4enc(ctx, (uint8_t*)ccStr, ccLen, ccPattern)) > 0) || ctx->errFlag) return;
+		}
+		ctx->rowWidth = 22; // save for getUnusedBitCnt
+		if (!(segs = linEnc(ctx, primaryLen, ccFlag, dblPattern))) return;
+		if (!(segWidth = fitSegWidth(ctx, segs, ccFlag, rows))) return;
+		if (segs%segWidth == 1) {
+			ctx->rowWidth = segWidth; // repack with the last row padded
+			if (!(segs = linEnc(ctx, primaryLen, ccFlag, dblPattern))) return;
+		}
+	}
+	else {
+		segWidth = ctx->segWidth;
+		ctx->rowWidth = segWidth; // save for getUnusedBitCnt
+		if (!(segs = linEnc(ctx, primaryLen, ccFlag, dblPattern))) return;
+	}
 
 	lNdx = 0;
 	for (i = 0; i < segs-1; i += 2) {
@@ -297,17 +361,23 @@ void gs1_RSSExp(gs1_encoder *ctx) {
 			linPattern[lNdx++] = dblPattern[i/2][j];
 		}
 	}
-	j = (segs <= ctx->segWidth) ? segs : ctx->segWidth;
+	j = (segs <= segWidth) ? segs : segWidth;
 	i = (segs+j-1)/j; // number of linear rows
-	lHeight = ctx->pixMult*i*RSSEXP_SYM_H + ctx->sepHt*(i-1)*3;
+	lHeight = ctx->driver_pixMult*i*RSSEXP_SYM_H + ctx->sepHt*(i-1)*3;
 	lNdx = (j/2)*(8+5+8) + (j&1)*(8+5);
 	lMods = 2 + (j/2)*(17+15+17) + (j&1)*(17+15) + 2;
 
-	// set up checkered seperator pattern and print structure
-	for (i = 0; i < RSSEXP_MAX_DBL_SEGS*RSSEXP_SYM_W+2; i++) {
-		chexPattern[i] = 1; // chex = all 1X elements
+	// set up checkered seperator pattern, kept while the symbol width is unchanged
+	if (ctx->rssexp_chexMods == 0) {
+		for (i = 0; i < RSSEXP_MAX_DBL_SEGS*RSSEXP_SYM_W+2; i++) {
+			chexPattern[i] = 1; // chex = all 1X elements
+		}
+		chexPattern[0] = 5; // except first and last
 	}
-	chexPattern[0] = 5; // except first and last
+	else if (ctx->rssexp_chexMods != lMods) {
+		chexPattern[ctx->rssexp_chexMods-8-(ctx->rssexp_chexMods&1)] = 1; // clear last for previous width
+	}
+	ctx->rssexp_chexMods = lMods;
 	if ((lMods&1) == 0) {
 		chexPattern[lMods-8] = 4;
 		chexSize = lMods-7;
@@ -316,6 +386,8 @@ void gs1_RSSExp(gs1_encoder *ctx) {
 		chexPattern[lMods-9] = 5;
 		chexSize = lMods-8;
 	}
+
+	// print structure
 	chexPrnts.elmCnt = chexSize;
 	chexPrnts.pattern = &chexPattern[0];
 	chexPrnts.guards = false;
@@ -335,10 +407,11 @@ void gs1_RSSExp(gs1_encoder *ctx) {
 	}
 	printf("\n");
 #endif
-	ctx->line1 = true; // so first line is not Y undercut
-	if (ccFlag) {
-		if (!((rows = gs1_CC4enc(ctx, (uint8_t*)ccStr, ccPattern)) > 0) || ctx->errFlag) return;
+	if (ccFlag && ctx->segWidth != 0) { // already encoded when fitting
+		if (!((rows = gs1_CC4enc(ctx, (uint8_t*)ccStr, ccLen, ccPattern)) > 0) || ctx->errFlag) return;
+	}
 #if PRNT
+	if (ccFlag) {
 		printf("\n%s", ccStr);
 		printf("\n");
 		for (i = 0; i < rows; i++) {
@@ -347,227 +420,113 @@ void gs1_RSSExp(gs1_encoder *ctx) {
 			}
 			printf("\n");
 		}
-#endif
 	}
+#endif
 
-	if (ctx->bmp) { // BMP version
-		// note: BMP is bottom to top inverted
-		if (ccFlag) {
-			gs1_bmpHeader(ctx->pixMult*(lMods),
-					ctx->pixMult*rows*2 + ctx->sepHt + lHeight, ctx->outfp);
-		}
-		else {
-			gs1_bmpHeader(ctx->pixMult*lMods, lHeight, ctx->outfp);
+	if (ccFlag) {
+		gs1_driverInit(ctx, (lMods),
+				ctx->driver_pixMult*rows*2 + ctx->sepHt + lHeight);
+
+		// print composite component
+		prints.elmCnt = CCB4_ELMNTS;
+		prints.guards = false;
+		prints.height = ctx->driver_pixMult*2;
+		prints.leftPad = RSSEXP_L_PAD;
+		prints.rightPad = rPadcc;
+		prints.whtFirst = true;
+		prints.reverse = false;
+		for (i = 0; i < rows; i++) {
+			prints.pattern = ccPattern[i];
+			gs1_driverAddCCRow(ctx, &prints);
 		}
+	}
+	else {
+		gs1_driverInit(ctx, lMods, lHeight);
+	}
 
-		// print RSS Exp component
-		i = 0;
-		evenRow = false; // start with odd
-		while (segs > i+ctx->segWidth) {
-			i += ctx->segWidth;
-			evenRow = !evenRow; // alternate row parity
-		}
+	// print RSS Exp
+	evenRow = false; // start with 1st row
+	prints.elmCnt = lNdx;
+	prints.guards = true;
+	prints.height = ctx->driver_pixMult*RSSEXP_SYM_H;
+	prints.leftPad = 0;
+	prints.rightPad = 0;
+
+	for (i = 0; i < segs-segWidth; i += segWidth) {
+		j = i + segWidth; // last segment number + 1 in this row
 
-		// print last or only RSS Expanded row
-		lNdx1 = ((segs/2)*(8+5+8)+(segs&1)*(8+5)) - ((i/2)*(8+5+8)+(i&1)*8);
-		rPadl1 = lMods - 4 -
-			(((segs/2)*(17+15+17)+(segs&1)*(17+15)) - ((i/2)*(17+15+17)+(i&1)*17));
-		prints.elmCnt = lNdx1;
+		rev = evenRow ^ ((i/2)&1);
 		prints.pattern = &linPattern[(i/2)*(8+5+8)+(i&1)*8];
-		prints.guards = true;
-		prints.height = ctx->pixMult*RSSEXP_SYM_H;
 		prints.whtFirst = (i/2+1)&1;
-		rev = evenRow ^ ((i/2)&1);
-		if (rev && (((lNdx1-4)%8)&1)) {
-			// can't reverse odd # finders so offset it right by one
-			prints.leftPad = 1;
-			prints.rightPad = rPadl1-1;
-			prints.reverse = false;
-			// bottom right offset RSS E row
-			gs1_printElmnts(ctx, &prints);
-
-			// bottom complement separator
-			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
+		prints.reverse = rev;
 
+		if (i > 0) {
 			// chex pattern
-			gs1_printElmnts(ctx, &chexPrnts);
-		}
-		else {
-			// otherwise normal bottom or only RSS E row
-			prints.leftPad = 0;
-			prints.rightPad = rPadl1;
-			prints.reverse = rev;
-
-			// bottom or only RSS row
-			gs1_printElmnts(ctx, &prints);
-
-			if ((i > 0) || (ccFlag)) {
-				// CC or lower complement separator
-				prntCnv = gs1_cnvSeparator(ctx, &prints);
-				gs1_printElmnts(ctx, prntCnv);
-			}
-
-			if (i > 0) {
-				// chex pattern
-				gs1_printElmnts(ctx, &chexPrnts);
-			}
+			gs1_driverAddFixedRow(ctx, &chexPrnts);
 		}
-		evenRow = !evenRow;
 
-		// print any remaining RSS Expanded rows
-		prints.elmCnt = lNdx;
-		prints.leftPad = 0;
-		prints.rightPad = 0;
-		for (i -= ctx->segWidth ; i >= 0; i -= ctx->segWidth) {
-			j = i + ctx->segWidth; // last segment number + 1 in this row
-			rev = evenRow ^ ((i/2)&1);
-			prints.pattern = &linPattern[(i/2)*(8+5+8)+(i&1)*8];
-			prints.whtFirst = (i/2+1)&1;
-			prints.reverse = rev;
-
-			// top complement separator
+		if ((i > 0) || (ccFlag)) {
+			// CC or lower complement separator
 			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// upper RSS row
-			gs1_printElmnts(ctx, &prints);
-
-			if ((i > 0) || (ccFlag)) {
-				// CC or lower complement separator
-				prntCnv = gs1_cnvSeparator(ctx, &prints);
-				gs1_printElmnts(ctx, prntCnv);
-			}
-
-			if (i > 0) {
-				// chex pattern
-				gs1_printElmnts(ctx, &chexPrnts);
-			}
-			evenRow = !evenRow;
+			gs1_driverAddRow(ctx, prntCnv);
 		}
 
-		if (ccFlag) {
-			// print composite component
-			prints.elmCnt = CCB4_ELMNTS;
-			prints.guards = false;
-			prints.height = ctx->pixMult*2;
-			prints.leftPad = RSSEXP_L_PAD;
-			prints.rightPad = rPadcc;
-			prints.whtFirst = true;
-			prints.reverse = false;
-			for (i = rows-1; i >= 0; i--) {
-				prints.pattern = ccPattern[i];
-				gs1_printElmnts(ctx, &prints);
-			}
-		}
-	}
+		// upper RSS row
+		gs1_driverAddRow(ctx, &prints);
 
-	else { // TIFF version
-		if (ccFlag) {
-			gs1_tifHeader(ctx->pixMult*(lMods),
-					ctx->pixMult*rows*2 + ctx->sepHt + lHeight, ctx->outfp);
-		}
-		else {
-			gs1_tifHeader(ctx->pixMult*lMods, lHeight, ctx->outfp);
-		}
+		// upper complement separator
+		prntCnv = gs1_cnvSeparator(ctx, &prints);
+		gs1_driverAddRow(ctx, prntCnv);
 
-		if (ccFlag) {
-			// print composite component
-			prints.elmCnt = CCB4_ELMNTS;
-			prints.guards = false;
-			prints.height = ctx->pixMult*2;
-			prints.leftPad = RSSEXP_L_PAD;
-			prints.rightPad = rPadcc;
-			prints.whtFirst = true;
-			prints.reverse = false;
-			for (i = 0; i < rows; i++) {
-				prints.pattern = ccPattern[i];
-				gs1_printElmnts(ctx, &prints);
-			}
-		}
+		evenRow = !evenRow;
+	}
 
-		// print RSS Exp
-		evenRow = false; // start with 1st row
-		prints.elmCnt = lNdx;
-		prints.guards = true;
-		prints.height = ctx->pixMult*RSSEXP_SYM_H;
+	// print last or only RSS Expanded row
+	lNdx1 = ((segs/2)*(8+5+8)+(segs&1)*(8+5)) - ((i/2)*(8+5+8)+(i&1)*8);
+	rPadl1 = lMods - 4 -
+		(((segs/2)*(17+15+17)+(segs&1)*(17+15)) - ((i/2)*(17+15+17)+(i&1)*17));
+	prints.elmCnt = lNdx1;
+	prints.pattern = &linPattern[(i/2)*(8+5+8)+(i&1)*8];
+	prints.whtFirst = (i/2+1)&1;
+	rev = evenRow ^ ((i/2)&1);
+	if (rev && (((lNdx1-4)%8)&1)) {
+		// can't reverse odd # finders so offset it right by one
+		prints.leftPad = 1;
+		prints.rightPad = rPadl1-1;
+		prints.reverse = false;
+
+		// chex pattern
+		gs1_driverAddFixedRow(ctx, &chexPrnts);
+
+		// bottom complement separator
+		prntCnv = gs1_cnvSeparator(ctx, &prints);
+		gs1_driverAddRow(ctx, prntCnv);
+
+		// bottom right offset RSS E row
+		gs1_driverAddRow(ctx, &prints);
+	}
+	else {
+		// otherwise normal row
 		prints.leftPad = 0;
-		prints.rightPad = 0;
-
-		for (i = 0; i < segs-ctx->segWidth; i += ctx->segWidth) {
-			j = i + ctx->segWidth; // last segment number + 1 in this row
-
-			rev = evenRow ^ ((i/2)&1);
-			prints.pattern = &linPattern[(i/2)*(8+5+8)+(i&1)*8];
-			prints.whtFirst = (i/2+1)&1;
-			prints.reverse = rev;
-
-			if (i > 0) {
-				// chex pattern
-				gs1_printElmnts(ctx, &chexPrnts);
-			}
-
-			if ((i > 0) || (ccFlag)) {
-				// CC or lower complement separator
-				prntCnv = gs1_cnvSeparator(ctx, &prints);
-				gs1_printElmnts(ctx, prntCnv);
-			}
-
-			// upper RSS row
-			gs1_printElmnts(ctx, &prints);
-
-			// upper complement separator
-			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			evenRow = !evenRow;
-		}
-
-		// print last or only RSS Expanded row
-		lNdx1 = ((segs/2)*(8+5+8)+(segs&1)*(8+5)) - ((i/2)*(8+5+8)+(i&1)*8);
-		rPadl1 = lMods - 4 -
-			(((segs/2)*(17+15+17)+(segs&1)*(17+15)) - ((i/2)*(17+15+17)+(i&1)*17));
-		prints.elmCnt = lNdx1;
-		prints.pattern = &linPattern[(i/2)*(8+5+8)+(i&1)*8];
-		prints.whtFirst = (i/2+1)&1;
-		rev = evenRow ^ ((i/2)&1);
-		if (rev && (((lNdx1-4)%8)&1)) {
-			// can't reverse odd # finders so offset it right by one
-			prints.leftPad = 1;
-			prints.rightPad = rPadl1-1;
-			prints.reverse = false;
+		prints.rightPad = rPadl1;
+		prints.reverse = rev;
 
+		if (i > 0) {
 			// chex pattern
-			gs1_printElmnts(ctx, &chexPrnts);
+			gs1_driverAddFixedRow(ctx, &chexPrnts);
+		}
 
-			// bottom complement separator
+		if ((i > 0) || (ccFlag)) {
+			// CC or lower complement separator
 			prntCnv = gs1_cnvSeparator(ctx, &prints);
-			gs1_printElmnts(ctx, prntCnv);
-
-			// bottom right offset RSS E row
-			gs1_printElmnts(ctx, &prints);
+			gs1_driverAddRow(ctx, prntCnv);
 		}
-		else {
-			// otherwise normal row
-			prints.leftPad = 0;
-			prints.rightPad = rPadl1;
-			prints.reverse = rev;
-
-			if (i > 0) {
-				// chex pattern
-				gs1_printElmnts(ctx, &chexPrnts);
-			}
 
-			if ((i > 0) || (ccFlag)) {
-				// CC or lower complement separator
-				prntCnv = gs1_cnvSeparator(ctx, &prints);
-				gs1_printElmnts(ctx, prntCnv);
-			}
-
-			// bottom right offset RSS E row
-			gs1_printElmnts(ctx, &prints);
-		}
-		evenRow = !evenRow;
+		// bottom right offset RSS E row
+		gs1_driverAddRow(ctx, &prints);
 	}
+	evenRow = !evenRow;
+
+	gs1_driverFinalise(ctx);
 	return;
 }
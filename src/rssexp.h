@@ -28,7 +28,11 @@
 #define RSSEXP_SYM_H		34	// height
 #define RSSEXP_MAX_DBL_SEGS	12	// max double segments
 #define RSSEXP_L_PAD		1	// CC left offset
+#define RSSEXP_CHAR_VALS	4096	// 12 bit symbol character values
+#define RSSEXP_CHAR_PAT		(8+1)	// character widths and parity sum
+#define RSSEXP_METHOD_LEN	7	// longest encodation method, 0111xxx
 
 void gs1_RSSExp(gs1_encoder *ctx);
+int gs1_RSSExpSize(gs1_encoder *ctx, int *bits);
 
 #endif
@@ -28,6 +28,7 @@
 #include "driver.h"
 #include "rsslim.h"
 #include "rssutil.h"
+#include "tables.h"
 
 static struct sPrints *separatorLim(gs1_encoder *ctx, struct sPrints *prints) {
 
@@ -79,23 +80,60 @@ static struct sPrints *separatorLim(gs1_encoder *ctx, struct sPrints *prints) {
 #define	N	26
 #define	K	7
 #define PARITY_MOD 89
-#define SUPL_VAL 2015133531096.
+#define SUPL_VAL 2015133531096
+#define MAX_ITEM 1999999999999
 
 // left char multiplier
-#define LEFT_MUL 2013571.
+#define LEFT_MUL 2013571
+
+// Fills in the 14 elements of a 26,7 character value, odd elements in even
+// positions, taking each 7 element set from the generated width set table.
+// Returns the character's unreduced parity sum.
+static int limChar(int chrValue, uint8_t bars[], const int weights[]) {
+
+	// odd elements N & max, even N & max, odd mul, combos, gs1_rssLimSets entry of odd sets
+	static const int oddEvenTbl[1*7*7] = { /* 26,7 */
+								17,6,	9,3,	28,		183064,	0,
+								13,5,	13,4,	728,	637000,	6566,
+								9,3,	17,6,	6454,	180712,	8169,
+								15,5,	11,4,	203,	490245,	14651,
+								11,4,	15,5,	2408,	488824,	17269,
+								19,8,	7,1,	1,		17094,	19880,
+								7,1,	19,8,	16632,16632,	36975 };
+
+	uint32_t set;
+	int value, oddValue;
+	int i, iIndex, parity;
+
+	// get char index into oddEvenTbl
+	iIndex = 0;
+	while (chrValue >= oddEvenTbl[iIndex+5]) {
+		chrValue -= oddEvenTbl[iIndex+5];
+		iIndex += 7;
+	}
+	oddValue = chrValue / oddEvenTbl[iIndex+4];
+
+	// odd element widths, even sets follow the odd sets in the table:
+	set = gs1_rssLimSets[oddEvenTbl[iIndex+6] + oddValue];
+	parity = 0;
+	for (i = 0; i < K; i++) {
+		bars[i*2] = (uint8_t)((set >> ((K-1-i)*4)) & 0xF);
+		parity += weights[i*2] * bars[i*2];
+	}
+
+	// even element widths:
+	value = chrValue - oddEvenTbl[iIndex+4] * oddValue;
+	set = gs1_rssLimSets[oddEvenTbl[iIndex+6] + oddEvenTbl[iIndex+5]/oddEvenTbl[iIndex+4] + value];
+	for (i = 0; i < K; i++) {
+		bars[i*2+1] = (uint8_t)((set >> ((K-1-i)*4)) & 0xF);
+		parity += weights[i*2+1] * bars[i*2+1];
+	}
+	return(parity);
+}
+
 
 // call with str = 13-digit primary, no check digit
-static bool RSSLimEnc(gs1_encoder *ctx, uint8_t string[], uint8_t bars[], int ccFlag) {
-
-	// stores odd element N & max, even N & max, odd mul, combos
-	static const long oddEvenTbl[1*7*6] = { /* 26,7 */
-								17,6,	9,3,	28,		183064,
-								13,5,	13,4,	728,	637000,
-								9,3,	17,6,	6454,	180712,
-								15,5,	11,4,	203,	490245,
-								11,4,	15,5,	2408,	488824,
-								19,8,	7,1,	1,		17094,
-								7,1,	19,8,	16632,16632 };
+static bool RSSLimEnc(uint8_t string[], uint8_t bars[], int ccFlag) {
 
 	static const uint8_t parityPattern[PARITY_MOD * 14] = {
 		 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 1, 1,
@@ -192,93 +230,22 @@ static bool RSSLimEnc(gs1_encoder *ctx, uint8_t string[], uint8_t bars[], int cc
 	static const int leftWeights[2*K] = {1,3,9,27,81,65,17,51,64,14,42,37,22,66};
 	static const int rightWeights[2*K] = {20,60,2,6,18,54,73,41,34,13,39,28,84,74};
 
-	double data;
-
-	int value;
-	int i;
-	int elementN, elementMax, parity;
-	long chrValue, chrValSave, longNum;
-	int iIndex;
-	int *widths;
+	int64_t data;
+	int i, parity;
 
-	data = atof((char*)string);
-	if (data > 1999999999999.) {
+	data = 0;
+	for (i = 0; string[i] >= '0' && string[i] <= '9'; i++) {
+		data = data*10 + (string[i] - '0');
+	}
+	if (data > MAX_ITEM) {
 		return(false); // item number too large
 	}
 	if (ccFlag) data += SUPL_VAL;
 
-	// calculate left (high order) symbol half value:
-	chrValue = chrValSave = (long)(data / LEFT_MUL);
-
-	// get 1st char index into oddEvenTbl
-	iIndex = 0;
-	while (chrValue >= oddEvenTbl[iIndex+5]) {
-		chrValue -= oddEvenTbl[iIndex+5];
-		iIndex += 6;
-	}
-
-	// get odd elements N and max
-	elementN = (int)oddEvenTbl[iIndex];
-	elementMax = (int)oddEvenTbl[iIndex+1];
-	longNum = value = (int)(chrValue / oddEvenTbl[iIndex+4]);
-
-	// generate and store odd element widths:
-	widths = gs1_getRSSwidths(ctx, value, elementN, K, elementMax, 1);
-	parity = 0l;
-	for (i = 0; i < K; i++) {
-		bars[(i*2)] = (uint8_t)widths[i];
-		parity += leftWeights[i * 2] * widths[i];
-		parity = parity % PARITY_MOD;
-	}
-
-	// calculate even elements value:
-	value = (int)(chrValue - (oddEvenTbl[iIndex+4] * longNum));
-	elementN = (int)oddEvenTbl[iIndex+2];
-	elementMax = (int)oddEvenTbl[iIndex+3];
-
-	// generate and store even element widths:
-	widths = gs1_getRSSwidths(ctx, value, elementN, K, elementMax, 0);
-	for (i = 0; i < K; i++) {
-		bars[(i*2)+1] = (uint8_t)widths[i];
-		parity += leftWeights[(i * 2) + 1] * widths[i];
-		parity = parity % PARITY_MOD;
-	}
-
-	// calculate right (low order) symbol half value:
-	chrValue = (long)(data - ((double)chrValSave * LEFT_MUL));
-
-	// get 2nd char index into oddEvenTbl
-	iIndex = 0;
-	while (chrValue >= oddEvenTbl[iIndex+5]) {
-		chrValue -= oddEvenTbl[iIndex+5];
-		iIndex += 6;
-	}
-
-	// get odd elements N and max
-	elementN = (int)oddEvenTbl[iIndex];
-	elementMax = (int)oddEvenTbl[iIndex+1];
-	longNum = value = (int)(chrValue / oddEvenTbl[iIndex+4]);
-
-	// generate and store odd element widths:
-	widths = gs1_getRSSwidths(ctx, value, elementN, K, elementMax, 1);
-	for (i = 0; i < K; i++) {
-		bars[(i*2)+28] = (uint8_t)widths[i];
-		parity += rightWeights[i * 2] * widths[i];
-		parity = parity % PARITY_MOD;
-	}
-
-	// calculate even elements value:
-	value = (int)(chrValue - (oddEvenTbl[iIndex+4] * longNum));
-	elementN = (int)oddEvenTbl[iIndex+2];
-	elementMax = (int)oddEvenTbl[iIndex+3];
-
-	// generate and store even element widths:
-	widths = gs1_getRSSwidths(ctx, value, elementN, K, elementMax, 0);
-	for (i = 0; i < K; i++) {
-		bars[(i*2)+1+28] = (uint8_t)widths[i];
-		parity += rightWeights[(i * 2) + 1] * widths[i];
-		parity = parity % PARITY_MOD;
-	}
+	// left (high order) and right (low order) symbol halves:
+	parity = limChar((int)(data / LEFT_MUL), bars, leftWeights);
+	parity += limChar((int)(data % LEFT_MUL), bars+28, rightWeights);
+	parity %= PARITY_MOD;
 
 	// store parity character in bars[]:
 	for (i = 0; i < 14; i++) {
@@ -304,16 +271,12 @@ void gs1_RSSLim(gs1_encoder *ctx) {
 	int i;
 	int rows, ccFlag;
 	char *ccStr;
+	int primaryLen, ccLen;
 
-	ccStr = strchr(ctx->dataStr, '|');
-	if (ccStr == NULL) ccFlag = false;
-	else {
-		ccFlag = true;
-		ccStr[0] = '\0'; // separate primary data
-		ccStr++; // point to secondary data
-	}
+	ccStr = gs1_splitCC(ctx, &primaryLen, &ccLen);
+	ccFlag = (ccStr != NULL);
 
-	if (strlen(ctx->dataStr) > 13) {
+	if (primaryLen > 13) {
 		strcpy(ctx->errMsg, "primary data exceeds 13 digits");
 		ctx->errFlag = true;
 		return;
@@ -323,7 +286,13 @@ void gs1_RSSLim(gs1_encoder *ctx) {
 	strcat(tempStr, ctx->dataStr);
 	strcpy(primaryStr, tempStr + strlen(tempStr) - 13);
 
-	if (!RSSLimEnc(ctx, (uint8_t*)primaryStr, linPattern, ccFlag) || ctx->errFlag) return;
+	if (!gs1_driverLinGet(ctx, primaryStr, 13, ccFlag, linPattern, RSSLIM_ELMNTS)) {
+		if (!gs1_rssGtinGet(ctx, sRSSLIM, primaryStr, ccFlag, linPattern)) {
+			if (ctx->errFlag || !RSSLimEnc((uint8_t*)primaryStr, linPattern, ccFlag) || ctx->errFlag) return;
+			gs1_rssGtinPut(ctx, sRSSLIM, primaryStr, ccFlag, linPattern);
+		}
+		gs1_driverLinPut(ctx, linPattern, RSSLIM_ELMNTS, true);
+	}
 #if PRNT
 	printf("\n%s", primaryStr);
 	printf("\n");
@@ -332,18 +301,17 @@ void gs1_RSSLim(gs1_encoder *ctx) {
 	}
 	printf("\n");
 #endif
-	ctx->line1 = true; // so first line is not Y undercut
 	// init most common RSS Limited row prints values
 	prints.elmCnt = RSSLIM_ELMNTS;
 	prints.pattern = linPattern;
-	prints.height = ctx->pixMult*RSSLIM_SYM_H;
+	prints.height = ctx->driver_pixMult*RSSLIM_SYM_H;
 	prints.guards = true;
 	prints.leftPad = 0;
 	prints.rightPad = 0;
 	prints.whtFirst = true;
 	prints.reverse = false;
 	if (ccFlag) {
-		if (!((rows = gs1_CC3enc(ctx, (uint8_t*)ccStr, ccPattern)) > 0) || ctx->errFlag) return;
+		if (!((rows = gs1_CC3enc(ctx, (uint8_t*)ccStr, ccLen, ccPattern)) > 0) || ctx->errFlag) return;
 #if PRNT
 		{
 			int j;
@@ -365,116 +333,56 @@ void gs1_RSSLim(gs1_encoder *ctx) {
 		}
 #endif
 
-		if (ctx->bmp) {
-			// note: BMP is bottom to top inverted
-			if (rows <= MAX_CCA3_ROWS) { // CCA composite
-				gs1_bmpHeader(ctx->pixMult*RSSLIM_SYM_W,
-						ctx->pixMult*(rows*2+RSSLIM_SYM_H) + ctx->sepHt, ctx->outfp);
-
-				// RSS Limited row
-				gs1_printElmnts(ctx, &prints);
-
-				// RSS Limited CC separator pattern
-				prntCnv = separatorLim(ctx, &prints);
-				gs1_printElmnts(ctx, prntCnv);
-
-				// 2D composite
-				prints.elmCnt = CCA3_ELMNTS;
-				prints.guards = false;
-				prints.height = ctx->pixMult*2;
-				for (i = rows-1; i >= 0; i--) {
-					prints.pattern = ccPattern[i];
-					gs1_printElmnts(ctx, &prints);
-				}
-			}
-			else { // CCB composite, extends beyond RSS14L on left
-				gs1_bmpHeader(ctx->pixMult*(RSSLIM_L_PADB+RSSLIM_SYM_W),
-						ctx->pixMult*(rows*2+RSSLIM_SYM_H) + ctx->sepHt, ctx->outfp);
-
-				// RSS Limited row
-				prints.leftPad = RSSLIM_L_PADB;
-				gs1_printElmnts(ctx, &prints);
-
-				// RSS Limited CC separator pattern
-				prntCnv = separatorLim(ctx, &prints);
-				gs1_printElmnts(ctx, prntCnv);
-
-				// 2D composite
-				prints.elmCnt = CCB3_ELMNTS;
-				prints.guards = false;
-				prints.height = ctx->pixMult*2;
-				prints.leftPad = 0;
-				for (i = rows-1; i >= 0; i--) {
-					prints.pattern = ccPattern[i];
-					gs1_printElmnts(ctx, &prints);
-				}
-			}
-		}
-		else { // TIF format
-			if (rows <= MAX_CCA3_ROWS) { // CCA composite
-				gs1_tifHeader(ctx->pixMult*RSSLIM_SYM_W,
-						ctx->pixMult*(rows*2+RSSLIM_SYM_H) + ctx->sepHt, ctx->outfp);
-
-          // 2D composite
-				prints.elmCnt = CCA3_ELMNTS;
-				prints.guards = false;
-				prints.height = ctx->pixMult*2;
-				for (i = 0; i < rows; i++) {
-					prints.pattern = ccPattern[i];
-					gs1_printElmnts(ctx, &prints);
-				}
-
-				prints.elmCnt = RSSLIM_ELMNTS;
-				prints.pattern = linPattern;
-				prints.height = ctx->pixMult*RSSLIM_SYM_H;
-				prints.guards = true;
+		if (rows <= MAX_CCA3_ROWS) { // CCA composite
+			gs1_driverInit(ctx, RSSLIM_SYM_W,
+					ctx->driver_pixMult*(rows*2+RSSLIM_SYM_H) + ctx->sepHt);
 
-				// RSS Limited CC separator pattern
-				prntCnv = separatorLim(ctx, &prints);
-				gs1_printElmnts(ctx, prntCnv);
-
-				// RSS Limited row
-				gs1_printElmnts(ctx, &prints);
+			// 2D composite
+			prints.elmCnt = CCA3_ELMNTS;
+			prints.guards = false;
+			prints.height = ctx->driver_pixMult*2;
+			for (i = 0; i < rows; i++) {
+				prints.pattern = ccPattern[i];
+				gs1_driverAddCCRow(ctx, &prints);
 			}
-			else { // CCB composite, extends beyond RSS14L on left
-				gs1_tifHeader(ctx->pixMult*(RSSLIM_L_PADB+RSSLIM_SYM_W),
-						ctx->pixMult*(rows*2+RSSLIM_SYM_H) + ctx->sepHt, ctx->outfp);
-
-				// 2D composite
-				prints.elmCnt = CCB3_ELMNTS;
-				prints.guards = false;
-				prints.height = ctx->pixMult*2;
-				prints.leftPad = 0;
-				for (i = 0; i < rows; i++) {
-					prints.pattern = ccPattern[i];
-					gs1_printElmnts(ctx, &prints);
-				}
-
-				prints.elmCnt = RSSLIM_ELMNTS;
-				prints.pattern = linPattern;
-				prints.height = ctx->pixMult*RSSLIM_SYM_H;
-				prints.guards = true;
-				prints.leftPad = RSSLIM_L_PADB;
 
-				// RSS Limited CC separator pattern
-				prntCnv = separatorLim(ctx, &prints);
-				gs1_printElmnts(ctx, prntCnv);
-
-				// RSS Limited row
-				gs1_printElmnts(ctx, &prints);
+			prints.elmCnt = RSSLIM_ELMNTS;
+			prints.pattern = linPattern;
+			prints.height = ctx->driver_pixMult*RSSLIM_SYM_H;
+			prints.guards = true;
+		}
+		else { // CCB composite, extends beyond RSS14L on left
+			gs1_driverInit(ctx, (RSSLIM_L_PADB+RSSLIM_SYM_W),
+					ctx->driver_pixMult*(rows*2+RSSLIM_SYM_H) + ctx->sepHt);
+
+			// 2D composite
+			prints.elmCnt = CCB3_ELMNTS;
+			prints.guards = false;
+			prints.height = ctx->driver_pixMult*2;
+			prints.leftPad = 0;
+			for (i = 0; i < rows; i++) {
+				prints.pattern = ccPattern[i];
+				gs1_driverAddCCRow(ctx, &prints);
 			}
+
+			prints.elmCnt = RSSLIM_ELMNTS;
+			prints.pattern = linPattern;
+			prints.height = ctx->driver_pixMult*RSSLIM_SYM_H;
+			prints.guards = true;
+			prints.leftPad = RSSLIM_L_PADB;
 		}
+
+		// RSS Limited CC separator pattern
+		prntCnv = separatorLim(ctx, &prints);
+		gs1_driverAddRow(ctx, prntCnv);
 	}
 	else { // primary only
-		if (ctx->bmp) {
-			gs1_bmpHeader(ctx->pixMult*RSSLIM_SYM_W, ctx->pixMult*RSSLIM_SYM_H, ctx->outfp);
-		}
-		else {
-			gs1_tifHeader(ctx->pixMult*RSSLIM_SYM_W, ctx->pixMult*RSSLIM_SYM_H, ctx->outfp);
-		}
-
-		// RSS Limited row
-		gs1_printElmnts(ctx, &prints);
+		gs1_driverInit(ctx, RSSLIM_SYM_W, ctx->driver_pixMult*RSSLIM_SYM_H);
 	}
+
+	// RSS Limited row
+	gs1_driverAddRow(ctx, &prints);
+
+	gs1_driverFinalise(ctx);
 	return;
 }
@@ -28,6 +28,8 @@
 #define RSSLIM_SYM_W	74	// symbol width in modules including any quiet zones
 #define RSSLIM_SYM_H	10	// total pixel ht of RSS14L
 #define RSSLIM_L_PADB	10	// RSS Limited left pad for ccb
+#define RSSLIM_WIDTH_SETS	53608	// odd and even width sets of the 26,7 characters
+#define RSSLIM_WIDTH_SET	7	// elements in a width set
 
 void gs1_RSSLim(gs1_encoder *ctx);
 
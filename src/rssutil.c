@@ -20,6 +20,8 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "enc-private.h"
 #include "rssutil.h"
@@ -137,6 +139,9 @@ struct sPrints *gs1_cnvSeparator(gs1_encoder *ctx, struct sPrints *prints)
 	prntSep->height = ctx->sepHt;
 	prntSep->whtFirst = true;
 	prntSep->guards = false;
+	if ((prntSep->elmCnt = gs1_driverSepGet(ctx, prints, sepPattern)) > 0) {
+		return(prntSep);
+	}
 	for (i = 0, k = 2; k <= 4; k += prints->pattern[i], i++);
 	if ((prints->whtFirst && (i&1)==1) || (!prints->whtFirst && (i&1)==0)) {
 		sepPattern[0] = 4;
@@ -149,7 +154,7 @@ struct sPrints *gs1_cnvSeparator(gs1_encoder *ctx, struct sPrints *prints)
 	}
 	for ( ; i < prints->elmCnt; i++, j++) {
 		sepPattern[j] = prints->pattern[i];
-		if (prints->pattern[i] + prints->pattern[i+1] + prints->pattern[i+2] == 13) {
+		if (i+2 < prints->elmCnt && prints->pattern[i] + prints->pattern[i+1] + prints->pattern[i+2] == 13) {
 			if ((j&1)==1) {
 				// finder is light/dark/light
 				for (k = 0; k < prints->pattern[i]; k++) {
@@ -223,5 +228,143 @@ struct sPrints *gs1_cnvSeparator(gs1_encoder *ctx, struct sPrints *prints)
 		sepPattern[j] = (uint8_t)k;
 	}
 	prntSep->elmCnt = j+1;
+	gs1_driverSepPut(ctx, prints, sepPattern, prntSep->elmCnt);
 	return(prntSep);
 }
+
+
+/*
+ * With gtinCacheSize set the linear patterns of RSS-14 and RSS Limited are
+ * kept for that many primaries, keyed by encoder, the 13 digit primary and
+ * whether a composite is linked. Entries are chained from a hash table and
+ * replaced in clock order, passing over those used since the hand last came
+ * round.
+ */
+struct gtinEntryT {
+	int enc;	// sRSS14 for all RSS-14 variants, or sRSSLIM
+	int link;
+	char primary[13];
+	uint8_t pattern[GTIN_ELMNTS];
+	int next;	// next entry in the hash chain, -1 at the end
+	int used;	// looked up since the clock hand passed
+};
+
+struct gtinCacheT {
+	int size;
+	int cnt;
+	int hand;	// next entry to consider for replacement
+	int mask;	// hash table size - 1
+	int *heads;	// first entry of each hash chain, -1 if none
+	struct gtinEntryT *entries;
+};
+
+
+static unsigned int gtinHash(int enc, const char *primary, int link) {
+
+	unsigned int hash = 2166136261u;
+	int i;
+
+	for (i = 0; i < 13; i++) {
+		hash = (hash ^ (uint8_t)primary[i]) * 16777619u;
+	}
+	return((hash ^ (unsigned int)(enc*2 + link)) * 16777619u);
+}
+
+
+static struct gtinCacheT *gtinCache(gs1_encoder *ctx) {
+
+	struct gtinCacheT *gc = ctx->rssutil_gtinCache;
+	int buckets;
+
+	if (gc != NULL) return(gc);
+	for (buckets = 1; buckets < ctx->gtinCacheSize; buckets *= 2);
+	if ((gc = calloc(1, sizeof(struct gtinCacheT))) == NULL ||
+			(gc->heads = malloc((size_t)buckets * sizeof(int))) == NULL ||
+			(gc->entries = malloc((size_t)ctx->gtinCacheSize * sizeof(struct gtinEntryT))) == NULL) {
+		if (gc != NULL) free(gc->heads);
+		free(gc);
+		strcpy(ctx->errMsg, "Out of memory for GTIN cache");
+		ctx->errFlag = true;
+		return(NULL);
+	}
+	memset(gc->heads, 0xFF, (size_t)buckets * sizeof(int)); // all -1
+	gc->size = ctx->gtinCacheSize;
+	gc->mask = buckets-1;
+	ctx->rssutil_gtinCache = gc;
+	return(gc);
+}
+
+
+// fills in pattern from the GTIN cache, returning false if primary is not held
+bool gs1_rssGtinGet(gs1_encoder *ctx, int enc, const char *primary, int link, uint8_t pattern[]) {
+
+	struct gtinCacheT *gc;
+	struct gtinEntryT *e;
+	int i;
+
+	if (ctx->gtinCacheSize <= 0 || (gc = gtinCache(ctx)) == NULL) return(false);
+	for (i = gc->heads[gtinHash(enc, primary, link) & (unsigned int)gc->mask]; i >= 0; i = e->next) {
+		e = &gc->entries[i];
+		if (e->enc == enc && e->link == link && memcmp(e->primary, primary, 13) == 0) {
+			memcpy(pattern, e->pattern, GTIN_ELMNTS);
+			e->used = true;
+			ctx->gtinCacheHits++;
+			return(true);
+		}
+	}
+	ctx->gtinCacheMisses++;
+	return(false);
+}
+
+
+// adds the pattern for primary to the GTIN cache, replacing an entry if full
+void gs1_rssGtinPut(gs1_encoder *ctx, int enc, const char *primary, int link, const uint8_t pattern[]) {
+
+	struct gtinCacheT *gc = ctx->rssutil_gtinCache;
+	struct gtinEntryT *e;
+	int *p;
+	int i;
+
+	if (ctx->gtinCacheSize <= 0 || gc == NULL || ctx->errFlag) return;
+	if (gc->cnt < gc->size) {
+		i = gc->cnt++;
+	}
+	else {
+		while (gc->entries[gc->hand].used) {
+			gc->entries[gc->hand].used = false;
+			gc->hand = (gc->hand+1) % gc->size;
+		}
+		i = gc->hand;
+		gc->hand = (gc->hand+1) % gc->size;
+
+		// unchain the entry being replaced
+		e = &gc->entries[i];
+		for (p = &gc->heads[gtinHash(e->enc, e->primary, e->link) & (unsigned int)gc->mask];
+				*p != i; p = &gc->entries[*p].next);
+		*p = e->next;
+	}
+	e = &gc->entries[i];
+	e->enc = enc;
+	e->link = link;
+	memcpy(e->primary, primary, 13);
+	memcpy(e->pattern, pattern, GTIN_ELMNTS);
+	e->used = false;
+	p = &gc->heads[gtinHash(enc, primary, link) & (unsigned int)gc->mask];
+	e->next = *p;
+	*p = i;
+	return;
+}
+
+
+void gs1_rssFreeGtinCache(gs1_encoder *ctx) {
+
+	struct gtinCacheT *gc = ctx->rssutil_gtinCache;
+
+	if (gc != NULL) {
+		free(gc->heads);
+		free(gc->entries);
+		free(gc);
+	}
+	ctx->rssutil_gtinCache = NULL;
+	return;
+}
@@ -25,11 +25,17 @@
 #include "gs1encoders.h"
 
 struct sPrints;
+struct gtinCacheT;
 
-#define MAX_SEP_ELMNTS (11*21+4) // for 22 segment RSS Exp
+#define MAX_SEP_ELMNTS (11*49+4) // one per module of a 22 segment RSS Exp row
 #define MAX_K 14
+#define GTIN_ELMNTS 42	// RSS-14 and RSS Limited linear elements, without guards
+#define MAX_GTIN_CACHE 1000000	// largest GTIN cache size accepted
 
 int *gs1_getRSSwidths(gs1_encoder *ctx, int val, int n, int elements, int maxWidth, int noNarrow);
 struct sPrints *gs1_cnvSeparator(gs1_encoder *ctx, struct sPrints *prints);
+bool gs1_rssGtinGet(gs1_encoder *ctx, int enc, const char *primary, int link, uint8_t pattern[]);
+void gs1_rssGtinPut(gs1_encoder *ctx, int enc, const char *primary, int link, const uint8_t pattern[]);
+void gs1_rssFreeGtinCache(gs1_encoder *ctx);
 
 #endif /* RSSUTIL_H */
@@ -0,0 +1,9698 @@
+/**
+ * GS1 barcode encoder application
+ *
+ * @author Copyright (c) 2000-2020 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Generated by gentables from its copy of the width routine in rssutil.c and
+ * the packed PDF417 patterns in gentables.c, do not edit.
+ * Run "make tables" to regenerate.
+ */
+
+#include <stdint.h>
+
+#include "tables.h"
+
+// RSS-14 16,4 outside characters, odd elements in even positions
+const uint8_t gs1_rss14Outside[RSS14_OUTSIDE_VALS][8] = {
+	{1,1,1,1,2,1,8,1}, {1,1,1,1,3,1,7,1}, {1,1,1,1,4,1,6,1}, {1,1,1,1,5,1,5,1},
+	{1,1,1,1,6,1,4,1}, {1,1,1,1,7,1,3,1}, {1,1,1,1,8,1,2,1}, {1,1,2,1,1,1,8,1},
+	{1,1,2,1,2,1,7,1}, {1,1,2,1,3,1,6,1}, {1,1,2,1,4,1,5,1}, {1,1,2,1,5,1,4,1},
+	{1,1,2,1,6,1,3,1}, {1,1,2,1,7,1,2,1}, {1,1,2,1,8,1,1,1}, {1,1,3,1,1,1,7,1},
+	{1,1,3,1,2,1,6,1}, {1,1,3,1,3,1,5,1}, {1,1,3,1,4,1,4,1}, {1,1,3,1,5,1,3,1},
+	{1,1,3,1,6,1,2,1}, {1,1,3,1,7,1,1,1}, {1,1,4,1,1,1,6,1}, {1,1,4,1,2,1,5,1},
+	{1,1,4,1,3,1,4,1}, {1,1,4,1,4,1,3,1}, {1,1,4,1,5,1,2,1}, {1,1,4,1,6,1,1,1},
+	{1,1,5,1,1,1,5,1}, {1,1,5,1,2,1,4,1}, {1,1,5,1,3,1,3,1}, {1,1,5,1,4,1,2,1},
+	{1,1,5,1,5,1,1,1}, {1,1,6,1,1,1,4,1}, {1,1,6,1,2,1,3,1}, {1,1,6,1,3,1,2,1},
+	{1,1,6,1,4,1,1,1}, {1,1,7,1,1,1,3,1}, {1,1,7,1,2,1,2,1}, {1,1,7,1,3,1,1,1},
+	{1,1,8,1,1,1,2,1}, {1,1,8,1,2,1,1,1}, {2,1,1,1,1,1,8,1}, {2,1,1,1,2,1,7,1},
+	{2,1,1,1,3,1,6,1}, {2,1,1,1,4,1,5,1}, {2,1,1,1,5,1,4,1}, {2,1,1,1,6,1,3,1},
+	{2,1,1,1,7,1,2,1}, {2,1,1,1,8,1,1,1}, {2,1,2,1,1,1,7,1}, {2,1,2,1,2,1,6,1},
+	{2,1,2,1,3,1,5,1}, {2,1,2,1,4,1,4,1}, {2,1,2,1,5,1,3,1}, {2,1,2,1,6,1,2,1},
+	{2,1,2,1,7,1,1,1}, {2,1,3,1,1,1,6,1}, {2,1,3,1,2,1,5,1}, {2,1,3,1,3,1,4,1},
+	{2,1,3,1,4,1,3,1}, {2,1,3,1,5,1,2,1}, {2,1,3,1,6,1,1,1}, {2,1,4,1,1,1,5,1},
+	{2,1,4,1,2,1,4,1}, {2,1,4,1,3,1,3,1}, {2,1,4,1,4,1,2,1}, {2,1,4,1,5,1,1,1},
+	{2,1,5,1,1,1,4,1}, {2,1,5,1,2,1,3,1}, {2,1,5,1,3,1,2,1}, {2,1,5,1,4,1,1,1},
+	{2,1,6,1,1,1,3,1}, {2,1,6,1,2,1,2,1}, {2,1,6,1,3,1,1,1}, {2,1,7,1,1,1,2,1},
+	{2,1,7,1,2,1,1,1}, {2,1,8,1,1,1,1,1}, {3,1,1,1,1,1,7,1}, {3,1,1,1,2,1,6,1},
+	{3,1,1,1,3,1,5,1}, {3,1,1,1,4,1,4,1}, {3,1,1,1,5,1,3,1}, {3,1,1,1,6,1,2,1},
+	{3,1,1,1,7,1,1,1}, {3,1,2,1,1,1,6,1}, {3,1,2,1,2,1,5,1}, {3,1,2,1,3,1,4,1},
+	{3,1,2,1,4,1,3,1}, {3,1,2,1,5,1,2,1}, {3,1,2,1,6,1,1,1}, {3,1,3,1,1,1,5,1},
+	{3,1,3,1,2,1,4,1}, {3,1,3,1,3,1,3,1}, {3,1,3,1,4,1,2,1}, {3,1,3,1,5,1,1,1},
+	{3,1,4,1,1,1,4,1}, {3,1,4,1,2,1,3,1}, {3,1,4,1,3,1,2,1}, {3,1,4,1,4,1,1,1},
+	{3,1,5,1,1,1,3,1}, {3,1,5,1,2,1,2,1}, {3,1,5,1,3,1,1,1}, {3,1,6,1,1,1,2,1},
+	{3,1,6,1,2,1,1,1}, {3,1,7,1,1,1,1,1}, {4,1,1,1,1,1,6,1}, {4,1,1,1,2,1,5,1},
+	{4,1,1,1,3,1,4,1}, {4,1,1,1,4,1,3,1}, {4,1,1,1,5,1,2,1}, {4,1,1,1,6,1,1,1},
+	{4,1,2,1,1,1,5,1}, {4,1,2,1,2,1,4,1}, {4,1,2,1,3,1,3,1}, {4,1,2,1,4,1,2,1},
+	{4,1,2,1,5,1,1,1}, {4,1,3,1,1,1,4,1}, {4,1,3,1,2,1,3,1}, {4,1,3,1,3,1,2,1},
+	{4,1,3,1,4,1,1,1}, {4,1,4,1,1,1,3,1}, {4,1,4,1,2,1,2,1}, {4,1,4,1,3,1,1,1},
+	{4,1,5,1,1,1,2,1}, {4,1,5,1,2,1,1,1}, {4,1,6,1,1,1,1,1}, {5,1,1,1,1,1,5,1},
+	{5,1,1,1,2,1,4,1}, {5,1,1,1,3,1,3,1}, {5,1,1,1,4,1,2,1}, {5,1,1,1,5,1,1,1},
+	{5,1,2,1,1,1,4,1}, {5,1,2,1,2,1,3,1}, {5,1,2,1,3,1,2,1}, {5,1,2,1,4,1,1,1},
+	{5,1,3,1,1,1,3,1}, {5,1,3,1,2,1,2,1}, {5,1,3,1,3,1,1,1}, {5,1,4,1,1,1,2,1},
+	{5,1,4,1,2,1,1,1}, {5,1,5,1,1,1,1,1}, {6,1,1,1,1,1,4,1}, {6,1,1,1,2,1,3,1},
+	{6,1,1,1,3,1,2,1}, {6,1,1,1,4,1,1,1}, {6,1,2,1,1,1,3,1}, {6,1,2,1,2,1,2,1},
+	{6,1,2,1,3,1,1,1}, {6,1,3,1,1,1,2,1}, {6,1,3,1,2,1,1,1}, {6,1,4,1,1,1,1,1},
+	{7,1,1,1,1,1,3,1}, {7,1,1,1,2,1,2,1}, {7,1,1,1,3,1,1,1}, {7,1,2,1,1,1,2,1},
+	{7,1,2,1,2,1,1,1}, {7,1,3,1,1,1,1,1}, {8,1,1,1,1,1,2,1}, {8,1,1,1,2,1,1,1},
+	{8,1,2,1,1,1,1,1}, {1,1,1,1,2,1,6,3}, {1,1,1,1,2,2,6,2}, {1,1,1,1,2,3,6,1},
+	{1,1,1,2,2,1,6,2}, {1,1,1,2,2,2,6,1}, {1,1,1,3,2,1,6,1}, {1,2,1,1,2,1,6,2},
+	{1,2,1,1,2,2,6,1}, {1,2,1,2,2,1,6,1}, {1,3,1,1,2,1,6,1}, {1,1,1,1,3,1,5,3},
+	{1,1,1,1,3,2,5,2}, {1,1,1,1,3,3,5,1}, {1,1,1,2,3,1,5,2}, {1,1,1,2,3,2,5,1},
+	{1,1,1,3,3,1,5,1}, {1,2,1,1,3,1,5,2}, {1,2,1,1,3,2,5,1}, {1,2,1,2,3,1,5,1},
+	{1,3,1,1,3,1,5,1}, {1,1,1,1,4,1,4,3}, {1,1,1,1,4,2,4,2}, {1,1,1,1,4,3,4,1},
+	{1,1,1,2,4,1,4,2}, {1,1,1,2,4,2,4,1}, {1,1,1,3,4,1,4,1}, {1,2,1,1,4,1,4,2},
+	{1,2,1,1,4,2,4,1}, {1,2,1,2,4,1,4,1}, {1,3,1,1,4,1,4,1}, {1,1,1,1,5,1,3,3},
+	{1,1,1,1,5,2,3,2}, {1,1,1,1,5,3,3,1}, {1,1,1,2,5,1,3,2}, {1,1,1,2,5,2,3,1},
+	{1,1,1,3,5,1,3,1}, {1,2,1,1,5,1,3,2}, {1,2,1,1,5,2,3,1}, {1,2,1,2,5,1,3,1},
+	{1,3,1,1,5,1,3,1}, {1,1,1,1,6,1,2,3}, {1,1,1,1,6,2,2,2}, {1,1,1,1,6,3,2,1},
+	{1,1,1,2,6,1,2,2}, {1,1,1,2,6,2,2,1}, {1,1,1,3,6,1,2,1}, {1,2,1,1,6,1,2,2},
+	{1,2,1,1,6,2,2,1}, {1,2,1,2,6,1,2,1}, {1,3,1,1,6,1,2,1}, {1,1,2,1,1,1,6,3},
+	{1,1,2,1,1,2,6,2}, {1,1,2,1,1,3,6,1}, {1,1,2,2,1,1,6,2}, {1,1,2,2,1,2,6,1},
+	{1,1,2,3,1,1,6,1}, {1,2,2,1,1,1,6,2}, {1,2,2,1,1,2,6,1}, {1,2,2,2,1,1,6,1},
+	{1,3,2,1,1,1,6,1}, {1,1,2,1,2,1,5,3}, {1,1,2,1,2,2,5,2}, {1,1,2,1,2,3,5,1},
+	{1,1,2,2,2,1,5,2}, {1,1,2,2,2,2,5,1}, {1,1,2,3,2,1,5,1}, {1,2,2,1,2,1,5,2},
+	{1,2,2,1,2,2,5,1}, {1,2,2,2,2,1,5,1}, {1,3,2,1,2,1,5,1}, {1,1,2,1,3,1,4,3},
+	{1,1,2,1,3,2,4,2}, {1,1,2,1,3,3,4,1}, {1,1,2,2,3,1,4,2}, {1,1,2,2,3,2,4,1},
+	{1,1,2,3,3,1,4,1}, {1,2,2,1,3,1,4,2}, {1,2,2,1,3,2,4,1}, {1,2,2,2,3,1,4,1},
+	{1,3,2,1,3,1,4,1}, {1,1,2,1,4,1,3,3}, {1,1,2,1,4,2,3,2}, {1,1,2,1,4,3,3,1},
+	{1,1,2,2,4,1,3,2}, {1,1,2,2,4,2,3,1}, {1,1,2,3,4,1,3,1}, {1,2,2,1,4,1,3,2},
+	{1,2,2,1,4,2,3,1}, {1,2,2,2,4,1,3,1}, {1,3,2,1,4,1,3,1}, {1,1,2,1,5,1,2,3},
+	{1,1,2,1,5,2,2,2}, {1,1,2,1,5,3,2,1}, {1,1,2,2,5,1,2,2}, {1,1,2,2,5,2,2,1},
+	{1,1,2,3,5,1,2,1}, {1,2,2,1,5,1,2,2}, {1,2,2,1,5,2,2,1}, {1,2,2,2,5,1,2,1},
+	{1,3,2,1,5,1,2,1}, {1,1,2,1,6,1,1,3}, {1,1,2,1,6,2,1,2}, {1,1,2,1,6,3,1,1},
+	{1,1,2,2,6,1,1,2}, {1,1,2,2,6,2,1,1}, {1,1,2,3,6,1,1,1}, {1,2,2,1,6,1,1,2},
+	{1,2,2,1,6,2,1,1}, {1,2,2,2,6,1,1,1}, {1,3,2,1,6,1,1,1}, {1,1,3,1,1,1,5,3},
+	{1,1,3,1,1,2,5,2}, {1,1,3,1,1,3,5,1}, {1,1,3,2,1,1,5,2}, {1,1,3,2,1,2,5,1},
+	{1,1,3,3,1,1,5,1}, {1,2,3,1,1,1,5,2}, {1,2,3,1,1,2,5,1}, {1,2,3,2,1,1,5,1},
+	{1,3,3,1,1,1,5,1}, {1,1,3,1,2,1,4,3}, {1,1,3,1,2,2,4,2}, {1,1,3,1,2,3,4,1},
+	{1,1,3,2,2,1,4,2}, {1,1,3,2,2,2,4,1}, {1,1,3,3,2,1,4,1}, {1,2,3,1,2,1,4,2},
+	{1,2,3,1,2,2,4,1}, {1,2,3,2,2,1,4,1}, {1,3,3,1,2,1,4,1}, {1,1,3,1,3,1,3,3},
+	{1,1,3,1,3,2,3,2}, {1,1,3,1,3,3,3,1}, {1,1,3,2,3,1,3,2}, {1,1,3,2,3,2,3,1},
+	{1,1,3,3,3,1,3,1}, {1,2,3,1,3,1,3,2}, {1,2,3,1,3,2,3,1}, {1,2,3,2,3,1,3,1},
+	{1,3,3,1,3,1,3,1}, {1,1,3,1,4,1,2,3}, {1,1,3,1,4,2,2,2}, {1,1,3,1,4,3,2,1},
+	{1,1,3,2,4,1,2,2}, {1,1,3,2,4,2,2,1}, {1,1,3,3,4,1,2,1}, {1,2,3,1,4,1,2,2},
+	{1,2,3,1,4,2,2,1}, {1,2,3,2,4,1,2,1}, {1,3,3,1,4,1,2,1}, {1,1,3,1,5,1,1,3},
+	{1,1,3,1,5,2,1,2}, {1,1,3,1,5,3,1,1}, {1,1,3,2,5,1,1,2}, {1,1,3,2,5,2,1,1},
+	{1,1,3,3,5,1,1,1}, {1,2,3,1,5,1,1,2}, {1,2,3,1,5,2,1,1}, {1,2,3,2,5,1,1,1},
+	{1,3,3,1,5,1,1,1}, {1,1,4,1,1,1,4,3}, {1,1,4,1,1,2,4,2}, {1,1,4,1,1,3,4,1},
+	{1,1,4,2,1,1,4,2}, {1,1,4,2,1,2,4,1}, {1,1,4,3,1,1,4,1}, {1,2,4,1,1,1,4,2},
+	{1,2,4,1,1,2,4,1}, {1,2,4,2,1,1,4,1}, {1,3,4,1,1,1,4,1}, {1,1,4,1,2,1,3,3},
+	{1,1,4,1,2,2,3,2}, {1,1,4,1,2,3,3,1}, {1,1,4,2,2,1,3,2}, {1,1,4,2,2,2,3,1},
+	{1,1,4,3,2,1,3,1}, {1,2,4,1,2,1,3,2}, {1,2,4,1,2,2,3,1}, {1,2,4,2,2,1,3,1},
+	{1,3,4,1,2,1,3,1}, {1,1,4,1,3,1,2,3}, {1,1,4,1,3,2,2,2}, {1,1,4,1,3,3,2,1},
+	{1,1,4,2,3,1,2,2}, {1,1,4,2,3,2,2,1}, {1,1,4,3,3,1,2,1}, {1,2,4,1,3,1,2,2},
+	{1,2,4,1,3,2,2,1}, {1,2,4,2,3,1,2,1}, {1,3,4,1,3,1,2,1}, {1,1,4,1,4,1,1,3},
+	{1,1,4,1,4,2,1,2}, {1,1,4,1,4,3,1,1}, {1,1,4,2,4,1,1,2}, {1,1,4,2,4,2,1,1},
+	{1,1,4,3,4,1,1,1}, {1,2,4,1,4,1,1,2}, {1,2,4,1,4,2,1,1}, {1,2,4,2,4,1,1,1},
+	{1,3,4,1,4,1,1,1}, {1,1,5,1,1,1,3,3}, {1,1,5,1,1,2,3,2}, {1,1,5,1,1,3,3,1},
+	{1,1,5,2,1,1,3,2}, {1,1,5,2,1,2,3,1}, {1,1,5,3,1,1,3,1}, {1,2,5,1,1,1,3,2},
+	{1,2,5,1,1,2,3,1}, {1,2,5,2,1,1,3,1}, {1,3,5,1,1,1,3,1}, {1,1,5,1,2,1,2,3},
+	{1,1,5,1,2,2,2,2}, {1,1,5,1,2,3,2,1}, {1,1,5,2,2,1,2,2}, {1,1,5,2,2,2,2,1},
+	{1,1,5,3,2,1,2,1}, {1,2,5,1,2,1,2,2}, {1,2,5,1,2,2,2,1}, {1,2,5,2,2,1,2,1},
+	{1,3,5,1,2,1,2,1}, {1,1,5,1,3,1,1,3}, {1,1,5,1,3,2,1,2}, {1,1,5,1,3,3,1,1},
+	{1,1,5,2,3,1,1,2}, {1,1,5,2,3,2,1,1}, {1,1,5,3,3,1,1,1}, {1,2,5,1,3,1,1,2},
+	{1,2,5,1,3,2,1,1}, {1,2,5,2,3,1,1,1}, {1,3,5,1,3,1,1,1}, {1,1,6,1,1,1,2,3},
+	{1,1,6,1,1,2,2,2}, {1,1,6,1,1,3,2,1}, {1,1,6,2,1,1,2,2}, {1,1,6,2,1,2,2,1},
+	{1,1,6,3,1,1,2,1}, {1,2,6,1,1,1,2,2}, {1,2,6,1,1,2,2,1}, {1,2,6,2,1,1,2,1},
+	{1,3,6,1,1,1,2,1}, {1,1,6,1,2,1,1,3}, {1,1,6,1,2,2,1,2}, {1,1,6,1,2,3,1,1},
+	{1,1,6,2,2,1,1,2}, {1,1,6,2,2,2,1,1}, {1,1,6,3,2,1,1,1}, {1,2,6,1,2,1,1,2},
+	{1,2,6,1,2,2,1,1}, {1,2,6,2,2,1,1,1}, {1,3,6,1,2,1,1,1}, {2,1,1,1,1,1,6,3},
+	{2,1,1,1,1,2,6,2}, {2,1,1,1,1,3,6,1}, {2,1,1,2,1,1,6,2}, {2,1,1,2,1,2,6,1},
+	{2,1,1,3,1,1,6,1}, {2,2,1,1,1,1,6,2}, {2,2,1,1,1,2,6,1}, {2,2,1,2,1,1,6,1},
+	{2,3,1,1,1,1,6,1}, {2,1,1,1,2,1,5,3}, {2,1,1,1,2,2,5,2}, {2,1,1,1,2,3,5,1},
+	{2,1,1,2,2,1,5,2}, {2,1,1,2,2,2,5,1}, {2,1,1,3,2,1,5,1}, {2,2,1,1,2,1,5,2},
+	{2,2,1,1,2,2,5,1}, {2,2,1,2,2,1,5,1}, {2,3,1,1,2,1,5,1}, {2,1,1,1,3,1,4,3},
+	{2,1,1,1,3,2,4,2}, {2,1,1,1,3,3,4,1}, {2,1,1,2,3,1,4,2}, {2,1,1,2,3,2,4,1},
+	{2,1,1,3,3,1,4,1}, {2,2,1,1,3,1,4,2}, {2,2,1,1,3,2,4,1}, {2,2,1,2,3,1,4,1},
+	{2,3,1,1,3,1,4,1}, {2,1,1,1,4,1,3,3}, {2,1,1,1,4,2,3,2}, {2,1,1,1,4,3,3,1},
+	{2,1,1,2,4,1,3,2}, {2,1,1,2,4,2,3,1}, {2,1,1,3,4,1,3,1}, {2,2,1,1,4,1,3,2},
+	{2,2,1,1,4,2,3,1}, {2,2,1,2,4,1,3,1}, {2,3,1,1,4,1,3,1}, {2,1,1,1,5,1,2,3},
+	{2,1,1,1,5,2,2,2}, {2,1,1,1,5,3,2,1}, {2,1,1,2,5,1,2,2}, {2,1,1,2,5,2,2,1},
+	{2,1,1,3,5,1,2,1}, {2,2,1,1,5,1,2,2}, {2,2,1,1,5,2,2,1}, {2,2,1,2,5,1,2,1},
+	{2,3,1,1,5,1,2,1}, {2,1,1,1,6,1,1,3}, {2,1,1,1,6,2,1,2}, {2,1,1,1,6,3,1,1},
+	{2,1,1,2,6,1,1,2}, {2,1,1,2,6,2,1,1}, {2,1,1,3,6,1,1,1}, {2,2,1,1,6,1,1,2},
+	{2,2,1,1,6,2,1,1}, {2,2,1,2,6,1,1,1}, {2,3,1,1,6,1,1,1}, {2,1,2,1,1,1,5,3},
+	{2,1,2,1,1,2,5,2}, {2,1,2,1,1,3,5,1}, {2,1,2,2,1,1,5,2}, {2,1,2,2,1,2,5,1},
+	{2,1,2,3,1,1,5,1}, {2,2,2,1,1,1,5,2}, {2,2,2,1,1,2,5,1}, {2,2,2,2,1,1,5,1},
+	{2,3,2,1,1,1,5,1}, {2,1,2,1,2,1,4,3}, {2,1,2,1,2,2,4,2}, {2,1,2,1,2,3,4,1},
+	{2,1,2,2,2,1,4,2}, {2,1,2,2,2,2,4,1}, {2,1,2,3,2,1,4,1}, {2,2,2,1,2,1,4,2},
+	{2,2,2,1,2,2,4,1}, {2,2,2,2,2,1,4,1}, {2,3,2,1,2,1,4,1}, {2,1,2,1,3,1,3,3},
+	{2,1,2,1,3,2,3,2}, {2,1,2,1,3,3,3,1}, {2,1,2,2,3,1,3,2}, {2,1,2,2,3,2,3,1},
+	{2,1,2,3,3,1,3,1}, {2,2,2,1,3,1,3,2}, {2,2,2,1,3,2,3,1}, {2,2,2,2,3,1,3,1},
+	{2,3,2,1,3,1,3,1}, {2,1,2,1,4,1,2,3}, {2,1,2,1,4,2,2,2}, {2,1,2,1,4,3,2,1},
+	{2,1,2,2,4,1,2,2}, {2,1,2,2,4,2,2,1}, {2,1,2,3,4,1,2,1}, {2,2,2,1,4,1,2,2},
+	{2,2,2,1,4,2,2,1}, {2,2,2,2,4,1,2,1}, {2,3,2,1,4,1,2,1}, {2,1,2,1,5,1,1,3},
+	{2,1,2,1,5,2,1,2}, {2,1,2,1,5,3,1,1}, {2,1,2,2,5,1,1,2}, {2,1,2,2,5,2,1,1},
+	{2,1,2,3,5,1,1,1}, {2,2,2,1,5,1,1,2}, {2,2,2,1,5,2,1,1}, {2,2,2,2,5,1,1,1},
+	{2,3,2,1,5,1,1,1}, {2,1,3,1,1,1,4,3}, {2,1,3,1,1,2,4,2}, {2,1,3,1,1,3,4,1},
+	{2,1,3,2,1,1,4,2}, {2,1,3,2,1,2,4,1}, {2,1,3,3,1,1,4,1}, {2,2,3,1,1,1,4,2},
+	{2,2,3,1,1,2,4,1}, {2,2,3,2,1,1,4,1}, {2,3,3,1,1,1,4,1}, {2,1,3,1,2,1,3,3},
+	{2,1,3,1,2,2,3,2}, {2,1,3,1,2,3,3,1}, {2,1,3,2,2,1,3,2}, {2,1,3,2,2,2,3,1},
+	{2,1,3,3,2,1,3,1}, {2,2,3,1,2,1,3,2}, {2,2,3,1,2,2,3,1}, {2,2,3,2,2,1,3,1},
+	{2,3,3,1,2,1,3,1}, {2,1,3,1,3,1,2,3}, {2,1,3,1,3,2,2,2}, {2,1,3,1,3,3,2,1},
+	{2,1,3,2,3,1,2,2}, {2,1,3,2,3,2,2,1}, {2,1,3,3,3,1,2,1}, {2,2,3,1,3,1,2,2},
+	{2,2,3,1,3,2,2,1}, {2,2,3,2,3,1,2,1}, {2,3,3,1,3,1,2,1}, {2,1,3,1,4,1,1,3},
+	{2,1,3,1,4,2,1,2}, {2,1,3,1,4,3,1,1}, {2,1,3,2,4,1,1,2}, {2,1,3,2,4,2,1,1},
+	{2,1,3,3,4,1,1,1}, {2,2,3,1,4,1,1,2}, {2,2,3,1,4,2,1,1}, {2,2,3,2,4,1,1,1},
+	{2,3,3,1,4,1,1,1}, {2,1,4,1,1,1,3,3}, {2,1,4,1,1,2,3,2}, {2,1,4,1,1,3,3,1},
+	{2,1,4,2,1,1,3,2}, {2,1,4,2,1,2,3,1}, {2,1,4,3,1,1,3,1}, {2,2,4,1,1,1,3,2},
+	{2,2,4,1,1,2,3,1}, {2,2,4,2,1,1,3,1}, {2,3,4,1,1,1,3,1}, {2,1,4,1,2,1,2,3},
+	{2,1,4,1,2,2,2,2}, {2,1,4,1,2,3,2,1}, {2,1,4,2,2,1,2,2}, {2,1,4,2,2,2,2,1},
+	{2,1,4,3,2,1,2,1}, {2,2,4,1,2,1,2,2}, {2,2,4,1,2,2,2,1}, {2,2,4,2,2,1,2,1},
+	{2,3,4,1,2,1,2,1}, {2,1,4,1,3,1,1,3}, {2,1,4,1,3,2,1,2}, {2,1,4,1,3,3,1,1},
+	{2,1,4,2,3,1,1,2}, {2,1,4,2,3,2,1,1}, {2,1,4,3,3,1,1,1}, {2,2,4,1,3,1,1,2},
+	{2,2,4,1,3,2,1,1}, {2,2,4,2,3,1,1,1}, {2,3,4,1,3,1,1,1}, {2,1,5,1,1,1,2,3},
+	{2,1,5,1,1,2,2,2}, {2,1,5,1,1,3,2,1}, {2,1,5,2,1,1,2,2}, {2,1,5,2,1,2,2,1},
+	{2,1,5,3,1,1,2,1}, {2,2,5,1,1,1,2,2}, {2,2,5,1,1,2,2,1}, {2,2,5,2,1,1,2,1},
+	{2,3,5,1,1,1,2,1}, {2,1,5,1,2,1,1,3}, {2,1,5,1,2,2,1,2}, {2,1,5,1,2,3,1,1},
+	{2,1,5,2,2,1,1,2}, {2,1,5,2,2,2,1,1}, {2,1,5,3,2,1,1,1}, {2,2,5,1,2,1,1,2},
+	{2,2,5,1,2,2,1,1}, {2,2,5,2,2,1,1,1}, {2,3,5,1,2,1,1,1}, {2,1,6,1,1,1,1,3},
+	{2,1,6,1,1,2,1,2}, {2,1,6,1,1,3,1,1}, {2,1,6,2,1,1,1,2}, {2,1,6,2,1,2,1,1},
+	{2,1,6,3,1,1,1,1}, {2,2,6,1,1,1,1,2}, {2,2,6,1,1,2,1,1}, {2,2,6,2,1,1,1,1},
+	{2,3,6,1,1,1,1,1}, {3,1,1,1,1,1,5,3}, {3,1,1,1,1,2,5,2}, {3,1,1,1,1,3,5,1},
+	{3,1,1,2,1,1,5,2}, {3,1,1,2,1,2,5,1}, {3,1,1,3,1,1,5,1}, {3,2,1,1,1,1,5,2},
+	{3,2,1,1,1,2,5,1}, {3,2,1,2,1,1,5,1}, {3,3,1,1,1,1,5,1}, {3,1,1,1,2,1,4,3},
+	{3,1,1,1,2,2,4,2}, {3,1,1,1,2,3,4,1}, {3,1,1,2,2,1,4,2}, {3,1,1,2,2,2,4,1},
+	{3,1,1,3,2,1,4,1}, {3,2,1,1,2,1,4,2}, {3,2,1,1,2,2,4,1}, {3,2,1,2,2,1,4,1},
+	{3,3,1,1,2,1,4,1}, {3,1,1,1,3,1,3,3}, {3,1,1,1,3,2,3,2}, {3,1,1,1,3,3,3,1},
+	{3,1,1,2,3,1,3,2}, {3,1,1,2,3,2,3,1}, {3,1,1,3,3,1,3,1}, {3,2,1,1,3,1,3,2},
+	{3,2,1,1,3,2,3,1}, {3,2,1,2,3,1,3,1}, {3,3,1,1,3,1,3,1}, {3,1,1,1,4,1,2,3},
+	{3,1,1,1,4,2,2,2}, {3,1,1,1,4,3,2,1}, {3,1,1,2,4,1,2,2}, {3,1,1,2,4,2,2,1},
+	{3,1,1,3,4,1,2,1}, {3,2,1,1,4,1,2,2}, {3,2,1,1,4,2,2,1}, {3,2,1,2,4,1,2,1},
+	{3,3,1,1,4,1,2,1}, {3,1,1,1,5,1,1,3}, {3,1,1,1,5,2,1,2}, {3,1,1,1,5,3,1,1},
+	{3,1,1,2,5,1,1,2}, {3,1,1,2,5,2,1,1}, {3,1,1,3,5,1,1,1}, {3,2,1,1,5,1,1,2},
+	{3,2,1,1,5,2,1,1}, {3,2,1,2,5,1,1,1}, {3,3,1,1,5,1,1,1}, {3,1,2,1,1,1,4,3},
+	{3,1,2,1,1,2,4,2}, {3,1,2,1,1,3,4,1}, {3,1,2,2,1,1,4,2}, {3,1,2,2,1,2,4,1},
+	{3,1,2,3,1,1,4,1}, {3,2,2,1,1,1,4,2}, {3,2,2,1,1,2,4,1}, {3,2,2,2,1,1,4,1},
+	{3,3,2,1,1,1,4,1}, {3,1,2,1,2,1,3,3}, {3,1,2,1,2,2,3,2}, {3,1,2,1,2,3,3,1},
+	{3,1,2,2,2,1,3,2}, {3,1,2,2,2,2,3,1}, {3,1,2,3,2,1,3,1}, {3,2,2,1,2,1,3,2},
+	{3,2,2,1,2,2,3,1}, {3,2,2,2,2,1,3,1}, {3,3,2,1,2,1,3,1}, {3,1,2,1,3,1,2,3},
+	{3,1,2,1,3,2,2,2}, {3,1,2,1,3,3,2,1}, {3,1,2,2,3,1,2,2}, {3,1,2,2,3,2,2,1},
+	{3,1,2,3,3,1,2,1}, {3,2,2,1,3,1,2,2}, {3,2,2,1,3,2,2,1}, {3,2,2,2,3,1,2,1},
+	{3,3,2,1,3,1,2,1}, {3,1,2,1,4,1,1,3}, {3,1,2,1,4,2,1,2}, {3,1,2,1,4,3,1,1},
+	{3,1,2,2,4,1,1,2}, {3,1,2,2,4,2,1,1}, {3,1,2,3,4,1,1,1}, {3,2,2,1,4,1,1,2},
+	{3,2,2,1,4,2,1,1}, {3,2,2,2,4,1,1,1}, {3,3,2,1,4,1,1,1}, {3,1,3,1,1,1,3,3},
+	{3,1,3,1,1,2,3,2}, {3,1,3,1,1,3,3,1}, {3,1,3,2,1,1,3,2}, {3,1,3,2,1,2,3,1},
+	{3,1,3,3,1,1,3,1}, {3,2,3,1,1,1,3,2}, {3,2,3,1,1,2,3,1}, {3,2,3,2,1,1,3,1},
+	{3,3,3,1,1,1,3,1}, {3,1,3,1,2,1,2,3}, {3,1,3,1,2,2,2,2}, {3,1,3,1,2,3,2,1},
+	{3,1,3,2,2,1,2,2}, {3,1,3,2,2,2,2,1}, {3,1,3,3,2,1,2,1}, {3,2,3,1,2,1,2,2},
+	{3,2,3,1,2,2,2,1}, {3,2,3,2,2,1,2,1}, {3,3,3,1,2,1,2,1}, {3,1,3,1,3,1,1,3},
+	{3,1,3,1,3,2,1,2}, {3,1,3,1,3,3,1,1}, {3,1,3,2,3,1,1,2}, {3,1,3,2,3,2,1,1},
+	{3,1,3,3,3,1,1,1}, {3,2,3,1,3,1,1,2}, {3,2,3,1,3,2,1,1}, {3,2,3,2,3,1,1,1},
+	{3,3,3,1,3,1,1,1}, {3,1,4,1,1,1,2,3}, {3,1,4,1,1,2,2,2}, {3,1,4,1,1,3,2,1},
+	{3,1,4,2,1,1,2,2}, {3,1,4,2,1,2,2,1}, {3,1,4,3,1,1,2,1}, {3,2,4,1,1,1,2,2},
+	{3,2,4,1,1,2,2,1}, {3,2,4,2,1,1,2,1}, {3,3,4,1,1,1,2,1}, {3,1,4,1,2,1,1,3},
+	{3,1,4,1,2,2,1,2}, {3,1,4,1,2,3,1,1}, {3,1,4,2,2,1,1,2}, {3,1,4,2,2,2,1,1},
+	{3,1,4,3,2,1,1,1}, {3,2,4,1,2,1,1,2}, {3,2,4,1,2,2,1,1}, {3,2,4,2,2,1,1,1},
+	{3,3,4,1,2,1,1,1}, {3,1,5,1,1,1,1,3}, {3,1,5,1,1,2,1,2}, {3,1,5,1,1,3,1,1},
+	{3,1,5,2,1,1,1,2}, {3,1,5,2,1,2,1,1}, {3,1,5,3,1,1,1,1}, {3,2,5,1,1,1,1,2},
+	{3,2,5,1,1,2,1,1}, {3,2,5,2,1,1,1,1}, {3,3,5,1,1,1,1,1}, {4,1,1,1,1,1,4,3},
+	{4,1,1,1,1,2,4,2}, {4,1,1,1,1,3,4,1}, {4,1,1,2,1,1,4,2}, {4,1,1,2,1,2,4,1},
+	{4,1,1,3,1,1,4,1}, {4,2,1,1,1,1,4,2}, {4,2,1,1,1,2,4,1}, {4,2,1,2,1,1,4,1},
+	{4,3,1,1,1,1,4,1}, {4,1,1,1,2,1,3,3}, {4,1,1,1,2,2,3,2}, {4,1,1,1,2,3,3,1},
+	{4,1,1,2,2,1,3,2}, {4,1,1,2,2,2,3,1}, {4,1,1,3,2,1,3,1}, {4,2,1,1,2,1,3,2},
+	{4,2,1,1,2,2,3,1}, {4,2,1,2,2,1,3,1}, {4,3,1,1,2,1,3,1}, {4,1,1,1,3,1,2,3},
+	{4,1,1,1,3,2,2,2}, {4,1,1,1,3,3,2,1}, {4,1,1,2,3,1,2,2}, {4,1,1,2,3,2,2,1},
+	{4,1,1,3,3,1,2,1}, {4,2,1,1,3,1,2,2}, {4,2,1,1,3,2,2,1}, {4,2,1,2,3,1,2,1},
+	{4,3,1,1,3,1,2,1}, {4,1,1,1,4,1,1,3}, {4,1,1,1,4,2,1,2}, {4,1,1,1,4,3,1,1},
+	{4,1,1,2,4,1,1,2}, {4,1,1,2,4,2,1,1}, {4,1,1,3,4,1,1,1}, {4,2,1,1,4,1,1,2},
+	{4,2,1,1,4,2,1,1}, {4,2,1,2,4,1,1,1}, {4,3,1,1,4,1,1,1}, {4,1,2,1,1,1,3,3},
+	{4,1,2,1,1,2,3,2}, {4,1,2,1,1,3,3,1}, {4,1,2,2,1,1,3,2}, {4,1,2,2,1,2,3,1},
+	{4,1,2,3,1,1,3,1}, {4,2,2,1,1,1,3,2}, {4,2,2,1,1,2,3,1}, {4,2,2,2,1,1,3,1},
+	{4,3,2,1,1,1,3,1}, {4,1,2,1,2,1,2,3}, {4,1,2,1,2,2,2,2}, {4,1,2,1,2,3,2,1},
+	{4,1,2,2,2,1,2,2}, {4,1,2,2,2,2,2,1}, {4,1,2,3,2,1,2,1}, {4,2,2,1,2,1,2,2},
+	{4,2,2,1,2,2,2,1}, {4,2,2,2,2,1,2,1}, {4,3,2,1,2,1,2,1}, {4,1,2,1,3,1,1,3},
+	{4,1,2,1,3,2,1,2}, {4,1,2,1,3,3,1,1}, {4,1,2,2,3,1,1,2}, {4,1,2,2,3,2,1,1},
+	{4,1,2,3,3,1,1,1}, {4,2,2,1,3,1,1,2}, {4,2,2,1,3,2,1,1}, {4,2,2,2,3,1,1,1},
+	{4,3,2,1,3,1,1,1}, {4,1,3,1,1,1,2,3}, {4,1,3,1,1,2,2,2}, {4,1,3,1,1,3,2,1},
+	{4,1,3,2,1,1,2,2}, {4,1,3,2,1,2,2,1}, {4,1,3,3,1,1,2,1}, {4,2,3,1,1,1,2,2},
+	{4,2,3,1,1,2,2,1}, {4,2,3,2,1,1,2,1}, {4,3,3,1,1,1,2,1}, {4,1,3,1,2,1,1,3},
+	{4,1,3,1,2,2,1,2}, {4,1,3,1,2,3,1,1}, {4,1,3,2,2,1,1,2}, {4,1,3,2,2,2,1,1},
+	{4,1,3,3,2,1,1,1}, {4,2,3,1,2,1,1,2}, {4,2,3,1,2,2,1,1}, {4,2,3,2,2,1,1,1},
+	{4,3,3,1,2,1,1,1}, {4,1,4,1,1,1,1,3}, {4,1,4,1,1,2,1,2}, {4,1,4,1,1,3,1,1},
+	{4,1,4,2,1,1,1,2}, {4,1,4,2,1,2,1,1}, {4,1,4,3,1,1,1,1}, {4,2,4,1,1,1,1,2},
+	{4,2,4,1,1,2,1,1}, {4,2,4,2,1,1,1,1}, {4,3,4,1,1,1,1,1}, {5,1,1,1,1,1,3,3},
+	{5,1,1,1,1,2,3,2}, {5,1,1,1,1,3,3,1}, {5,1,1,2,1,1,3,2}, {5,1,1,2,1,2,3,1},
+	{5,1,1,3,1,1,3,1}, {5,2,1,1,1,1,3,2}, {5,2,1,1,1,2,3,1}, {5,2,1,2,1,1,3,1},
+	{5,3,1,1,1,1,3,1}, {5,1,1,1,2,1,2,3}, {5,1,1,1,2,2,2,2}, {5,1,1,1,2,3,2,1},
+	{5,1,1,2,2,1,2,2}, {5,1,1,2,2,2,2,1}, {5,1,1,3,2,1,2,1}, {5,2,1,1,2,1,2,2},
+	{5,2,1,1,2,2,2,1}, {5,2,1,2,2,1,2,1}, {5,3,1,1,2,1,2,1}, {5,1,1,1,3,1,1,3},
+	{5,1,1,1,3,2,1,2}, {5,1,1,1,3,3,1,1}, {5,1,1,2,3,1,1,2}, {5,1,1,2,3,2,1,1},
+	{5,1,1,3,3,1,1,1}, {5,2,1,1,3,1,1,2}, {5,2,1,1,3,2,1,1}, {5,2,1,2,3,1,1,1},
+	{5,3,1,1,3,1,1,1}, {5,1,2,1,1,1,2,3}, {5,1,2,1,1,2,2,2}, {5,1,2,1,1,3,2,1},
+	{5,1,2,2,1,1,2,2}, {5,1,2,2,1,2,2,1}, {5,1,2,3,1,1,2,1}, {5,2,2,1,1,1,2,2},
+	{5,2,2,1,1,2,2,1}, {5,2,2,2,1,1,2,1}, {5,3,2,1,1,1,2,1}, {5,1,2,1,2,1,1,3},
+	{5,1,2,1,2,2,1,2}, {5,1,2,1,2,3,1,1}, {5,1,2,2,2,1,1,2}, {5,1,2,2,2,2,1,1},
+	{5,1,2,3,2,1,1,1}, {5,2,2,1,2,1,1,2}, {5,2,2,1,2,2,1,1}, {5,2,2,2,2,1,1,1},
+	{5,3,2,1,2,1,1,1}, {5,1,3,1,1,1,1,3}, {5,1,3,1,1,2,1,2}, {5,1,3,1,1,3,1,1},
+	{5,1,3,2,1,1,1,2}, {5,1,3,2,1,2,1,1}, {5,1,3,3,1,1,1,1}, {5,2,3,1,1,1,1,2},
+	{5,2,3,1,1,2,1,1}, {5,2,3,2,1,1,1,1}, {5,3,3,1,1,1,1,1}, {6,1,1,1,1,1,2,3},
+	{6,1,1,1,1,2,2,2}, {6,1,1,1,1,3,2,1}, {6,1,1,2,1,1,2,2}, {6,1,1,2,1,2,2,1},
+	{6,1,1,3,1,1,2,1}, {6,2,1,1,1,1,2,2}, {6,2,1,1,1,2,2,1}, {6,2,1,2,1,1,2,1},
+	{6,3,1,1,1,1,2,1}, {6,1,1,1,2,1,1,3}, {6,1,1,1,2,2,1,2}, {6,1,1,1,2,3,1,1},
+	{6,1,1,2,2,1,1,2}, {6,1,1,2,2,2,1,1}, {6,1,1,3,2,1,1,1}, {6,2,1,1,2,1,1,2},
+	{6,2,1,1,2,2,1,1}, {6,2,1,2,2,1,1,1}, {6,3,1,1,2,1,1,1}, {6,1,2,1,1,1,1,3},
+	{6,1,2,1,1,2,1,2}, {6,1,2,1,1,3,1,1}, {6,1,2,2,1,1,1,2}, {6,1,2,2,1,2,1,1},
+	{6,1,2,3,1,1,1,1}, {6,2,2,1,1,1,1,2}, {6,2,2,1,1,2,1,1}, {6,2,2,2,1,1,1,1},
+	{6,3,2,1,1,1,1,1}, {1,1,1,1,2,1,4,5}, {1,1,1,1,2,2,4,4}, {1,1,1,1,2,3,4,3},
+	{1,1,1,1,2,4,4,2}, {1,1,1,1,2,5,4,1}, {1,1,1,2,2,1,4,4}, {1,1,1,2,2,2,4,3},
+	{1,1,1,2,2,3,4,2}, {1,1,1,2,2,4,4,1}, {1,1,1,3,2,1,4,3}, {1,1,1,3,2,2,4,2},
+	{1,1,1,3,2,3,4,1}, {1,1,1,4,2,1,4,2}, {1,1,1,4,2,2,4,1}, {1,1,1,5,2,1,4,1},
+	{1,2,1,1,2,1,4,4}, {1,2,1,1,2,2,4,3}, {1,2,1,1,2,3,4,2}, {1,2,1,1,2,4,4,1},
+	{1,2,1,2,2,1,4,3}, {1,2,1,2,2,3,4,1}, {1,2,1,3,2,1,4,2}, {1,2,1,3,2,2,4,1},
+	{1,2,1,4,2,1,4,1}, {1,3,1,1,2,1,4,3}, {1,3,1,1,2,2,4,2}, {1,3,1,1,2,3,4,1},
+	{1,3,1,2,2,1,4,2}, {1,3,1,2,2,2,4,1}, {1,3,1,3,2,1,4,1}, {1,4,1,1,2,1,4,2},
+	{1,4,1,1,2,2,4,1}, {1,4,1,2,2,1,4,1}, {1,5,1,1,2,1,4,1}, {1,1,1,1,3,1,3,5},
+	{1,1,1,1,3,2,3,4}, {1,1,1,1,3,3,3,3}, {1,1,1,1,3,4,3,2}, {1,1,1,1,3,5,3,1},
+	{1,1,1,2,3,1,3,4}, {1,1,1,2,3,2,3,3}, {1,1,1,2,3,3,3,2}, {1,1,1,2,3,4,3,1},
+	{1,1,1,3,3,1,3,3}, {1,1,1,3,3,2,3,2}, {1,1,1,3,3,3,3,1}, {1,1,1,4,3,1,3,2},
+	{1,1,1,4,3,2,3,1}, {1,1,1,5,3,1,3,1}, {1,2,1,1,3,1,3,4}, {1,2,1,1,3,2,3,3},
+	{1,2,1,1,3,3,3,2}, {1,2,1,1,3,4,3,1}, {1,2,1,2,3,1,3,3}, {1,2,1,2,3,3,3,1},
+	{1,2,1,3,3,1,3,2}, {1,2,1,3,3,2,3,1}, {1,2,1,4,3,1,3,1}, {1,3,1,1,3,1,3,3},
+	{1,3,1,1,3,2,3,2}, {1,3,1,1,3,3,3,1}, {1,3,1,2,3,1,3,2}, {1,3,1,2,3,2,3,1},
+	{1,3,1,3,3,1,3,1}, {1,4,1,1,3,1,3,2}, {1,4,1,1,3,2,3,1}, {1,4,1,2,3,1,3,1},
+	{1,5,1,1,3,1,3,1}, {1,1,1,1,4,1,2,5}, {1,1,1,1,4,2,2,4}, {1,1,1,1,4,3,2,3},
+	{1,1,1,1,4,4,2,2}, {1,1,1,1,4,5,2,1}, {1,1,1,2,4,1,2,4}, {1,1,1,2,4,2,2,3},
+	{1,1,1,2,4,3,2,2}, {1,1,1,2,4,4,2,1}, {1,1,1,3,4,1,2,3}, {1,1,1,3,4,2,2,2},
+	{1,1,1,3,4,3,2,1}, {1,1,1,4,4,1,2,2}, {1,1,1,4,4,2,2,1}, {1,1,1,5,4,1,2,1},
+	{1,2,1,1,4,1,2,4}, {1,2,1,1,4,2,2,3}, {1,2,1,1,4,3,2,2}, {1,2,1,1,4,4,2,1},
+	{1,2,1,2,4,1,2,3}, {1,2,1,2,4,3,2,1}, {1,2,1,3,4,1,2,2}, {1,2,1,3,4,2,2,1},
+	{1,2,1,4,4,1,2,1}, {1,3,1,1,4,1,2,3}, {1,3,1,1,4,2,2,2}, {1,3,1,1,4,3,2,1},
+	{1,3,1,2,4,1,2,2}, {1,3,1,2,4,2,2,1}, {1,3,1,3,4,1,2,1}, {1,4,1,1,4,1,2,2},
+	{1,4,1,1,4,2,2,1}, {1,4,1,2,4,1,2,1}, {1,5,1,1,4,1,2,1}, {1,1,2,1,1,1,4,5},
+	{1,1,2,1,1,2,4,4}, {1,1,2,1,1,3,4,3}, {1,1,2,1,1,4,4,2}, {1,1,2,1,1,5,4,1},
+	{1,1,2,2,1,1,4,4}, {1,1,2,2,1,2,4,3}, {1,1,2,2,1,3,4,2}, {1,1,2,2,1,4,4,1},
+	{1,1,2,3,1,1,4,3}, {1,1,2,3,1,2,4,2}, {1,1,2,3,1,3,4,1}, {1,1,2,4,1,1,4,2},
+	{1,1,2,4,1,2,4,1}, {1,1,2,5,1,1,4,1}, {1,2,2,1,1,1,4,4}, {1,2,2,1,1,2,4,3},
+	{1,2,2,1,1,3,4,2}, {1,2,2,1,1,4,4,1}, {1,2,2,2,1,1,4,3}, {1,2,2,2,1,3,4,1},
+	{1,2,2,3,1,1,4,2}, {1,2,2,3,1,2,4,1}, {1,2,2,4,1,1,4,1}, {1,3,2,1,1,1,4,3},
+	{1,3,2,1,1,2,4,2}, {1,3,2,1,1,3,4,1}, {1,3,2,2,1,1,4,2}, {1,3,2,2,1,2,4,1},
+	{1,3,2,3,1,1,4,1}, {1,4,2,1,1,1,4,2}, {1,4,2,1,1,2,4,1}, {1,4,2,2,1,1,4,1},
+	{1,5,2,1,1,1,4,1}, {1,1,2,1,2,1,3,5}, {1,1,2,1,2,2,3,4}, {1,1,2,1,2,3,3,3},
+	{1,1,2,1,2,4,3,2}, {1,1,2,1,2,5,3,1}, {1,1,2,2,2,1,3,4}, {1,1,2,2,2,2,3,3},
+	{1,1,2,2,2,3,3,2}, {1,1,2,2,2,4,3,1}, {1,1,2,3,2,1,3,3}, {1,1,2,3,2,2,3,2},
+	{1,1,2,3,2,3,3,1}, {1,1,2,4,2,1,3,2}, {1,1,2,4,2,2,3,1}, {1,1,2,5,2,1,3,1},
+	{1,2,2,1,2,1,3,4}, {1,2,2,1,2,2,3,3}, {1,2,2,1,2,3,3,2}, {1,2,2,1,2,4,3,1},
+	{1,2,2,2,2,1,3,3}, {1,2,2,2,2,3,3,1}, {1,2,2,3,2,1,3,2}, {1,2,2,3,2,2,3,1},
+	{1,2,2,4,2,1,3,1}, {1,3,2,1,2,1,3,3}, {1,3,2,1,2,2,3,2}, {1,3,2,1,2,3,3,1},
+	{1,3,2,2,2,1,3,2}, {1,3,2,2,2,2,3,1}, {1,3,2,3,2,1,3,1}, {1,4,2,1,2,1,3,2},
+	{1,4,2,1,2,2,3,1}, {1,4,2,2,2,1,3,1}, {1,5,2,1,2,1,3,1}, {1,1,2,1,3,1,2,5},
+	{1,1,2,1,3,2,2,4}, {1,1,2,1,3,3,2,3}, {1,1,2,1,3,4,2,2}, {1,1,2,1,3,5,2,1},
+	{1,1,2,2,3,1,2,4}, {1,1,2,2,3,2,2,3}, {1,1,2,2,3,3,2,2}, {1,1,2,2,3,4,2,1},
+	{1,1,2,3,3,1,2,3}, {1,1,2,3,3,2,2,2}, {1,1,2,3,3,3,2,1}, {1,1,2,4,3,1,2,2},
+	{1,1,2,4,3,2,2,1}, {1,1,2,5,3,1,2,1}, {1,2,2,1,3,1,2,4}, {1,2,2,1,3,2,2,3},
+	{1,2,2,1,3,3,2,2}, {1,2,2,1,3,4,2,1}, {1,2,2,2,3,1,2,3}, {1,2,2,2,3,3,2,1},
+	{1,2,2,3,3,1,2,2}, {1,2,2,3,3,2,2,1}, {1,2,2,4,3,1,2,1}, {1,3,2,1,3,1,2,3},
+	{1,3,2,1,3,2,2,2}, {1,3,2,1,3,3,2,1}, {1,3,2,2,3,1,2,2}, {1,3,2,2,3,2,2,1},
+	{1,3,2,3,3,1,2,1}, {1,4,2,1,3,1,2,2}, {1,4,2,1,3,2,2,1}, {1,4,2,2,3,1,2,1},
+	{1,5,2,1,3,1,2,1}, {1,1,2,1,4,1,1,5}, {1,1,2,1,4,2,1,4}, {1,1,2,1,4,3,1,3},
+	{1,1,2,1,4,4,1,2}, {1,1,2,1,4,5,1,1}, {1,1,2,2,4,1,1,4}, {1,1,2,2,4,2,1,3},
+	{1,1,2,2,4,3,1,2}, {1,1,2,2,4,4,1,1}, {1,1,2,3,4,1,1,3}, {1,1,2,3,4,2,1,2},
+	{1,1,2,3,4,3,1,1}, {1,1,2,4,4,1,1,2}, {1,1,2,4,4,2,1,1}, {1,1,2,5,4,1,1,1},
+	{1,2,2,1,4,1,1,4}, {1,2,2,1,4,2,1,3}, {1,2,2,1,4,3,1,2}, {1,2,2,1,4,4,1,1},
+	{1,2,2,2,4,1,1,3}, {1,2,2,2,4,3,1,1}, {1,2,2,3,4,1,1,2}, {1,2,2,3,4,2,1,1},
+	{1,2,2,4,4,1,1,1}, {1,3,2,1,4,1,1,3}, {1,3,2,1,4,2,1,2}, {1,3,2,1,4,3,1,1},
+	{1,3,2,2,4,1,1,2}, {1,3,2,2,4,2,1,1}, {1,3,2,3,4,1,1,1}, {1,4,2,1,4,1,1,2},
+	{1,4,2,1,4,2,1,1}, {1,4,2,2,4,1,1,1}, {1,5,2,1,4,1,1,1}, {1,1,3,1,1,1,3,5},
+	{1,1,3,1,1,2,3,4}, {1,1,3,1,1,3,3,3}, {1,1,3,1,1,4,3,2}, {1,1,3,1,1,5,3,1},
+	{1,1,3,2,1,1,3,4}, {1,1,3,2,1,2,3,3}, {1,1,3,2,1,3,3,2}, {1,1,3,2,1,4,3,1},
+	{1,1,3,3,1,1,3,3}, {1,1,3,3,1,2,3,2}, {1,1,3,3,1,3,3,1}, {1,1,3,4,1,1,3,2},
+	{1,1,3,4,1,2,3,1}, {1,1,3,5,1,1,3,1}, {1,2,3,1,1,1,3,4}, {1,2,3,1,1,2,3,3},
+	{1,2,3,1,1,3,3,2}, {1,2,3,1,1,4,3,1}, {1,2,3,2,1,1,3,3}, {1,2,3,2,1,3,3,1},
+	{1,2,3,3,1,1,3,2}, {1,2,3,3,1,2,3,1}, {1,2,3,4,1,1,3,1}, {1,3,3,1,1,1,3,3},
+	{1,3,3,1,1,2,3,2}, {1,3,3,1,1,3,3,1}, {1,3,3,2,1,1,3,2}, {1,3,3,2,1,2,3,1},
+	{1,3,3,3,1,1,3,1}, {1,4,3,1,1,1,3,2}, {1,4,3,1,1,2,3,1}, {1,4,3,2,1,1,3,1},
+	{1,5,3,1,1,1,3,1}, {1,1,3,1,2,1,2,5}, {1,1,3,1,2,2,2,4}, {1,1,3,1,2,3,2,3},
+	{1,1,3,1,2,4,2,2}, {1,1,3,1,2,5,2,1}, {1,1,3,2,2,1,2,4}, {1,1,3,2,2,2,2,3},
+	{1,1,3,2,2,3,2,2}, {1,1,3,2,2,4,2,1}, {1,1,3,3,2,1,2,3}, {1,1,3,3,2,2,2,2},
+	{1,1,3,3,2,3,2,1}, {1,1,3,4,2,1,2,2}, {1,1,3,4,2,2,2,1}, {1,1,3,5,2,1,2,1},
+	{1,2,3,1,2,1,2,4}, {1,2,3,1,2,2,2,3}, {1,2,3,1,2,3,2,2}, {1,2,3,1,2,4,2,1},
+	{1,2,3,2,2,1,2,3}, {1,2,3,2,2,3,2,1}, {1,2,3,3,2,1,2,2}, {1,2,3,3,2,2,2,1},
+	{1,2,3,4,2,1,2,1}, {1,3,3,1,2,1,2,3}, {1,3,3,1,2,2,2,2}, {1,3,3,1,2,3,2,1},
+	{1,3,3,2,2,1,2,2}, {1,3,3,2,2,2,2,1}, {1,3,3,3,2,1,2,1}, {1,4,3,1,2,1,2,2},
+	{1,4,3,1,2,2,2,1}, {1,4,3,2,2,1,2,1}, {1,5,3,1,2,1,2,1}, {1,1,3,1,3,1,1,5},
+	{1,1,3,1,3,2,1,4}, {1,1,3,1,3,3,1,3}, {1,1,3,1,3,4,1,2}, {1,1,3,1,3,5,1,1},
+	{1,1,3,2,3,1,1,4}, {1,1,3,2,3,2,1,3}, {1,1,3,2,3,3,1,2}, {1,1,3,2,3,4,1,1},
+	{1,1,3,3,3,1,1,3}, {1,1,3,3,3,2,1,2}, {1,1,3,3,3,3,1,1}, {1,1,3,4,3,1,1,2},
+	{1,1,3,4,3,2,1,1}, {1,1,3,5,3,1,1,1}, {1,2,3,1,3,1,1,4}, {1,2,3,1,3,2,1,3},
+	{1,2,3,1,3,3,1,2}, {1,2,3,1,3,4,1,1}, {1,2,3,2,3,1,1,3}, {1,2,3,2,3,3,1,1},
+	{1,2,3,3,3,1,1,2}, {1,2,3,3,3,2,1,1}, {1,2,3,4,3,1,1,1}, {1,3,3,1,3,1,1,3},
+	{1,3,3,1,3,2,1,2}, {1,3,3,1,3,3,1,1}, {1,3,3,2,3,1,1,2}, {1,3,3,2,3,2,1,1},
+	{1,3,3,3,3,1,1,1}, {1,4,3,1,3,1,1,2}, {1,4,3,1,3,2,1,1}, {1,4,3,2,3,1,1,1},
+	{1,5,3,1,3,1,1,1}, {1,1,4,1,1,1,2,5}, {1,1,4,1,1,2,2,4}, {1,1,4,1,1,3,2,3},
+	{1,1,4,1,1,4,2,2}, {1,1,4,1,1,5,2,1}, {1,1,4,2,1,1,2,4}, {1,1,4,2,1,2,2,3},
+	{1,1,4,2,1,3,2,2}, {1,1,4,2,1,4,2,1}, {1,1,4,3,1,1,2,3}, {1,1,4,3,1,2,2,2},
+	{1,1,4,3,1,3,2,1}, {1,1,4,4,1,1,2,2}, {1,1,4,4,1,2,2,1}, {1,1,4,5,1,1,2,1},
+	{1,2,4,1,1,1,2,4}, {1,2,4,1,1,2,2,3}, {1,2,4,1,1,3,2,2}, {1,2,4,1,1,4,2,1},
+	{1,2,4,2,1,1,2,3}, {1,2,4,2,1,3,2,1}, {1,2,4,3,1,1,2,2}, {1,2,4,3,1,2,2,1},
+	{1,2,4,4,1,1,2,1}, {1,3,4,1,1,1,2,3}, {1,3,4,1,1,2,2,2}, {1,3,4,1,1,3,2,1},
+	{1,3,4,2,1,1,2,2}, {1,3,4,2,1,2,2,1}, {1,3,4,3,1,1,2,1}, {1,4,4,1,1,1,2,2},
+	{1,4,4,1,1,2,2,1}, {1,4,4,2,1,1,2,1}, {1,5,4,1,1,1,2,1}, {1,1,4,1,2,1,1,5},
+	{1,1,4,1,2,2,1,4}, {1,1,4,1,2,3,1,3}, {1,1,4,1,2,4,1,2}, {1,1,4,1,2,5,1,1},
+	{1,1,4,2,2,1,1,4}, {1,1,4,2,2,2,1,3}, {1,1,4,2,2,3,1,2}, {1,1,4,2,2,4,1,1},
+	{1,1,4,3,2,1,1,3}, {1,1,4,3,2,2,1,2}, {1,1,4,3,2,3,1,1}, {1,1,4,4,2,1,1,2},
+	{1,1,4,4,2,2,1,1}, {1,1,4,5,2,1,1,1}, {1,2,4,1,2,1,1,4}, {1,2,4,1,2,2,1,3},
+	{1,2,4,1,2,3,1,2}, {1,2,4,1,2,4,1,1}, {1,2,4,2,2,1,1,3}, {1,2,4,2,2,3,1,1},
+	{1,2,4,3,2,1,1,2}, {1,2,4,3,2,2,1,1}, {1,2,4,4,2,1,1,1}, {1,3,4,1,2,1,1,3},
+	{1,3,4,1,2,2,1,2}, {1,3,4,1,2,3,1,1}, {1,3,4,2,2,1,1,2}, {1,3,4,2,2,2,1,1},
+	{1,3,4,3,2,1,1,1}, {1,4,4,1,2,1,1,2}, {1,4,4,1,2,2,1,1}, {1,4,4,2,2,1,1,1},
+	{1,5,4,1,2,1,1,1}, {2,1,1,1,1,1,4,5}, {2,1,1,1,1,2,4,4}, {2,1,1,1,1,3,4,3},
+	{2,1,1,1,1,4,4,2}, {2,1,1,1,1,5,4,1}, {2,1,1,2,1,1,4,4}, {2,1,1,2,1,2,4,3},
+	{2,1,1,2,1,3,4,2}, {2,1,1,2,1,4,4,1}, {2,1,1,3,1,1,4,3}, {2,1,1,3,1,2,4,2},
+	{2,1,1,3,1,3,4,1}, {2,1,1,4,1,1,4,2}, {2,1,1,4,1,2,4,1}, {2,1,1,5,1,1,4,1},
+	{2,2,1,1,1,1,4,4}, {2,2,1,1,1,2,4,3}, {2,2,1,1,1,3,4,2}, {2,2,1,1,1,4,4,1},
+	{2,2,1,2,1,1,4,3}, {2,2,1,2,1,3,4,1}, {2,2,1,3,1,1,4,2}, {2,2,1,3,1,2,4,1},
+	{2,2,1,4,1,1,4,1}, {2,3,1,1,1,1,4,3}, {2,3,1,1,1,2,4,2}, {2,3,1,1,1,3,4,1},
+	{2,3,1,2,1,1,4,2}, {2,3,1,2,1,2,4,1}, {2,3,1,3,1,1,4,1}, {2,4,1,1,1,1,4,2},
+	{2,4,1,1,1,2,4,1}, {2,4,1,2,1,1,4,1}, {2,5,1,1,1,1,4,1}, {2,1,1,1,2,1,3,5},
+	{2,1,1,1,2,2,3,4}, {2,1,1,1,2,3,3,3}, {2,1,1,1,2,4,3,2}, {2,1,1,1,2,5,3,1},
+	{2,1,1,2,2,1,3,4}, {2,1,1,2,2,2,3,3}, {2,1,1,2,2,3,3,2}, {2,1,1,2,2,4,3,1},
+	{2,1,1,3,2,1,3,3}, {2,1,1,3,2,2,3,2}, {2,1,1,3,2,3,3,1}, {2,1,1,4,2,1,3,2},
+	{2,1,1,4,2,2,3,1}, {2,1,1,5,2,1,3,1}, {2,2,1,1,2,1,3,4}, {2,2,1,1,2,2,3,3},
+	{2,2,1,1,2,3,3,2}, {2,2,1,1,2,4,3,1}, {2,2,1,2,2,1,3,3}, {2,2,1,2,2,3,3,1},
+	{2,2,1,3,2,1,3,2}, {2,2,1,3,2,2,3,1}, {2,2,1,4,2,1,3,1}, {2,3,1,1,2,1,3,3},
+	{2,3,1,1,2,2,3,2}, {2,3,1,1,2,3,3,1}, {2,3,1,2,2,1,3,2}, {2,3,1,2,2,2,3,1},
+	{2,3,1,3,2,1,3,1}, {2,4,1,1,2,1,3,2}, {2,4,1,1,2,2,3,1}, {2,4,1,2,2,1,3,1},
+	{2,5,1,1,2,1,3,1}, {2,1,1,1,3,1,2,5}, {2,1,1,1,3,2,2,4}, {2,1,1,1,3,3,2,3},
+	{2,1,1,1,3,4,2,2}, {2,1,1,1,3,5,2,1}, {2,1,1,2,3,1,2,4}, {2,1,1,2,3,2,2,3},
+	{2,1,1,2,3,3,2,2}, {2,1,1,2,3,4,2,1}, {2,1,1,3,3,1,2,3}, {2,1,1,3,3,2,2,2},
+	{2,1,1,3,3,3,2,1}, {2,1,1,4,3,1,2,2}, {2,1,1,4,3,2,2,1}, {2,1,1,5,3,1,2,1},
+	{2,2,1,1,3,1,2,4}, {2,2,1,1,3,2,2,3}, {2,2,1,1,3,3,2,2}, {2,2,1,1,3,4,2,1},
+	{2,2,1,2,3,1,2,3}, {2,2,1,2,3,3,2,1}, {2,2,1,3,3,1,2,2}, {2,2,1,3,3,2,2,1},
+	{2,2,1,4,3,1,2,1}, {2,3,1,1,3,1,2,3}, {2,3,1,1,3,2,2,2}, {2,3,1,1,3,3,2,1},
+	{2,3,1,2,3,1,2,2}, {2,3,1,2,3,2,2,1}, {2,3,1,3,3,1,2,1}, {2,4,1,1,3,1,2,2},
+	{2,4,1,1,3,2,2,1}, {2,4,1,2,3,1,2,1}, {2,5,1,1,3,1,2,1}, {2,1,1,1,4,1,1,5},
+	{2,1,1,1,4,2,1,4}, {2,1,1,1,4,3,1,3}, {2,1,1,1,4,4,1,2}, {2,1,1,1,4,5,1,1},
+	{2,1,1,2,4,1,1,4}, {2,1,1,2,4,2,1,3}, {2,1,1,2,4,3,1,2}, {2,1,1,2,4,4,1,1},
+	{2,1,1,3,4,1,1,3}, {2,1,1,3,4,2,1,2}, {2,1,1,3,4,3,1,1}, {2,1,1,4,4,1,1,2},
+	{2,1,1,4,4,2,1,1}, {2,1,1,5,4,1,1,1}, {2,2,1,1,4,1,1,4}, {2,2,1,1,4,2,1,3},
+	{2,2,1,1,4,3,1,2}, {2,2,1,1,4,4,1,1}, {2,2,1,2,4,1,1,3}, {2,2,1,2,4,3,1,1},
+	{2,2,1,3,4,1,1,2}, {2,2,1,3,4,2,1,1}, {2,2,1,4,4,1,1,1}, {2,3,1,1,4,1,1,3},
+	{2,3,1,1,4,2,1,2}, {2,3,1,1,4,3,1,1}, {2,3,1,2,4,1,1,2}, {2,3,1,2,4,2,1,1},
+	{2,3,1,3,4,1,1,1}, {2,4,1,1,4,1,1,2}, {2,4,1,1,4,2,1,1}, {2,4,1,2,4,1,1,1},
+	{2,5,1,1,4,1,1,1}, {2,1,2,1,1,1,3,5}, {2,1,2,1,1,2,3,4}, {2,1,2,1,1,3,3,3},
+	{2,1,2,1,1,4,3,2}, {2,1,2,1,1,5,3,1}, {2,1,2,2,1,1,3,4}, {2,1,2,2,1,2,3,3},
+	{2,1,2,2,1,3,3,2}, {2,1,2,2,1,4,3,1}, {2,1,2,3,1,1,3,3}, {2,1,2,3,1,2,3,2},
+	{2,1,2,3,1,3,3,1}, {2,1,2,4,1,1,3,2}, {2,1,2,4,1,2,3,1}, {2,1,2,5,1,1,3,1},
+	{2,2,2,1,1,1,3,4}, {2,2,2,1,1,2,3,3}, {2,2,2,1,1,3,3,2}, {2,2,2,1,1,4,3,1},
+	{2,2,2,2,1,1,3,3}, {2,2,2,2,1,3,3,1}, {2,2,2,3,1,1,3,2}, {2,2,2,3,1,2,3,1},
+	{2,2,2,4,1,1,3,1}, {2,3,2,1,1,1,3,3}, {2,3,2,1,1,2,3,2}, {2,3,2,1,1,3,3,1},
+	{2,3,2,2,1,1,3,2}, {2,3,2,2,1,2,3,1}, {2,3,2,3,1,1,3,1}, {2,4,2,1,1,1,3,2},
+	{2,4,2,1,1,2,3,1}, {2,4,2,2,1,1,3,1}, {2,5,2,1,1,1,3,1}, {2,1,2,1,2,1,2,5},
+	{2,1,2,1,2,2,2,4}, {2,1,2,1,2,3,2,3}, {2,1,2,1,2,4,2,2}, {2,1,2,1,2,5,2,1},
+	{2,1,2,2,2,1,2,4}, {2,1,2,2,2,2,2,3}, {2,1,2,2,2,3,2,2}, {2,1,2,2,2,4,2,1},
+	{2,1,2,3,2,1,2,3}, {2,1,2,3,2,2,2,2}, {2,1,2,3,2,3,2,1}, {2,1,2,4,2,1,2,2},
+	{2,1,2,4,2,2,2,1}, {2,1,2,5,2,1,2,1}, {2,2,2,1,2,1,2,4}, {2,2,2,1,2,2,2,3},
+	{2,2,2,1,2,3,2,2}, {2,2,2,1,2,4,2,1}, {2,2,2,2,2,1,2,3}, {2,2,2,2,2,3,2,1},
+	{2,2,2,3,2,1,2,2}, {2,2,2,3,2,2,2,1}, {2,2,2,4,2,1,2,1}, {2,3,2,1,2,1,2,3},
+	{2,3,2,1,2,2,2,2}, {2,3,2,1,2,3,2,1}, {2,3,2,2,2,1,2,2}, {2,3,2,2,2,2,2,1},
+	{2,3,2,3,2,1,2,1}, {2,4,2,1,2,1,2,2}, {2,4,2,1,2,2,2,1}, {2,4,2,2,2,1,2,1},
+	{2,5,2,1,2,1,2,1}, {2,1,2,1,3,1,1,5}, {2,1,2,1,3,2,1,4}, {2,1,2,1,3,3,1,3},
+	{2,1,2,1,3,4,1,2}, {2,1,2,1,3,5,1,1}, {2,1,2,2,3,1,1,4}, {2,1,2,2,3,2,1,3},
+	{2,1,2,2,3,3,1,2}, {2,1,2,2,3,4,1,1}, {2,1,2,3,3,1,1,3}, {2,1,2,3,3,2,1,2},
+	{2,1,2,3,3,3,1,1}, {2,1,2,4,3,1,1,2}, {2,1,2,4,3,2,1,1}, {2,1,2,5,3,1,1,1},
+	{2,2,2,1,3,1,1,4}, {2,2,2,1,3,2,1,3}, {2,2,2,1,3,3,1,2}, {2,2,2,1,3,4,1,1},
+	{2,2,2,2,3,1,1,3}, {2,2,2,2,3,3,1,1}, {2,2,2,3,3,1,1,2}, {2,2,2,3,3,2,1,1},
+	{2,2,2,4,3,1,1,1}, {2,3,2,1,3,1,1,3}, {2,3,2,1,3,2,1,2}, {2,3,2,1,3,3,1,1},
+	{2,3,2,2,3,1,1,2}, {2,3,2,2,3,2,1,1}, {2,3,2,3,3,1,1,1}, {2,4,2,1,3,1,1,2},
+	{2,4,2,1,3,2,1,1}, {2,4,2,2,3,1,1,1}, {2,5,2,1,3,1,1,1}, {2,1,3,1,1,1,2,5},
+	{2,1,3,1,1,2,2,4}, {2,1,3,1,1,3,2,3}, {2,1,3,1,1,4,2,2}, {2,1,3,1,1,5,2,1},
+	{2,1,3,2,1,1,2,4}, {2,1,3,2,1,2,2,3}, {2,1,3,2,1,3,2,2}, {2,1,3,2,1,4,2,1},
+	{2,1,3,3,1,1,2,3}, {2,1,3,3,1,2,2,2}, {2,1,3,3,1,3,2,1}, {2,1,3,4,1,1,2,2},
+	{2,1,3,4,1,2,2,1}, {2,1,3,5,1,1,2,1}, {2,2,3,1,1,1,2,4}, {2,2,3,1,1,2,2,3},
+	{2,2,3,1,1,3,2,2}, {2,2,3,1,1,4,2,1}, {2,2,3,2,1,1,2,3}, {2,2,3,2,1,3,2,1},
+	{2,2,3,3,1,1,2,2}, {2,2,3,3,1,2,2,1}, {2,2,3,4,1,1,2,1}, {2,3,3,1,1,1,2,3},
+	{2,3,3,1,1,2,2,2}, {2,3,3,1,1,3,2,1}, {2,3,3,2,1,1,2,2}, {2,3,3,2,1,2,2,1},
+	{2,3,3,3,1,1,2,1}, {2,4,3,1,1,1,2,2}, {2,4,3,1,1,2,2,1}, {2,4,3,2,1,1,2,1},
+	{2,5,3,1,1,1,2,1}, {2,1,3,1,2,1,1,5}, {2,1,3,1,2,2,1,4}, {2,1,3,1,2,3,1,3},
+	{2,1,3,1,2,4,1,2}, {2,1,3,1,2,5,1,1}, {2,1,3,2,2,1,1,4}, {2,1,3,2,2,2,1,3},
+	{2,1,3,2,2,3,1,2}, {2,1,3,2,2,4,1,1}, {2,1,3,3,2,1,1,3}, {2,1,3,3,2,2,1,2},
+	{2,1,3,3,2,3,1,1}, {2,1,3,4,2,1,1,2}, {2,1,3,4,2,2,1,1}, {2,1,3,5,2,1,1,1},
+	{2,2,3,1,2,1,1,4}, {2,2,3,1,2,2,1,3}, {2,2,3,1,2,3,1,2}, {2,2,3,1,2,4,1,1},
+	{2,2,3,2,2,1,1,3}, {2,2,3,2,2,3,1,1}, {2,2,3,3,2,1,1,2}, {2,2,3,3,2,2,1,1},
+	{2,2,3,4,2,1,1,1}, {2,3,3,1,2,1,1,3}, {2,3,3,1,2,2,1,2}, {2,3,3,1,2,3,1,1},
+	{2,3,3,2,2,1,1,2}, {2,3,3,2,2,2,1,1}, {2,3,3,3,2,1,1,1}, {2,4,3,1,2,1,1,2},
+	{2,4,3,1,2,2,1,1}, {2,4,3,2,2,1,1,1}, {2,5,3,1,2,1,1,1}, {2,1,4,1,1,1,1,5},
+	{2,1,4,1,1,2,1,4}, {2,1,4,1,1,3,1,3}, {2,1,4,1,1,4,1,2}, {2,1,4,1,1,5,1,1},
+	{2,1,4,2,1,1,1,4}, {2,1,4,2,1,2,1,3}, {2,1,4,2,1,3,1,2}, {2,1,4,2,1,4,1,1},
+	{2,1,4,3,1,1,1,3}, {2,1,4,3,1,2,1,2}, {2,1,4,3,1,3,1,1}, {2,1,4,4,1,1,1,2},
+	{2,1,4,4,1,2,1,1}, {2,1,4,5,1,1,1,1}, {2,2,4,1,1,1,1,4}, {2,2,4,1,1,2,1,3},
+	{2,2,4,1,1,3,1,2}, {2,2,4,1,1,4,1,1}, {2,2,4,2,1,1,1,3}, {2,2,4,2,1,3,1,1},
+	{2,2,4,3,1,1,1,2}, {2,2,4,3,1,2,1,1}, {2,2,4,4,1,1,1,1}, {2,3,4,1,1,1,1,3},
+	{2,3,4,1,1,2,1,2}, {2,3,4,1,1,3,1,1}, {2,3,4,2,1,1,1,2}, {2,3,4,2,1,2,1,1},
+	{2,3,4,3,1,1,1,1}, {2,4,4,1,1,1,1,2}, {2,4,4,1,1,2,1,1}, {2,4,4,2,1,1,1,1},
+	{2,5,4,1,1,1,1,1}, {3,1,1,1,1,1,3,5}, {3,1,1,1,1,2,3,4}, {3,1,1,1,1,3,3,3},
+	{3,1,1,1,1,4,3,2}, {3,1,1,1,1,5,3,1}, {3,1,1,2,1,1,3,4}, {3,1,1,2,1,2,3,3},
+	{3,1,1,2,1,3,3,2}, {3,1,1,2,1,4,3,1}, {3,1,1,3,1,1,3,3}, {3,1,1,3,1,2,3,2},
+	{3,1,1,3,1,3,3,1}, {3,1,1,4,1,1,3,2}, {3,1,1,4,1,2,3,1}, {3,1,1,5,1,1,3,1},
+	{3,2,1,1,1,1,3,4}, {3,2,1,1,1,2,3,3}, {3,2,1,1,1,3,3,2}, {3,2,1,1,1,4,3,1},
+	{3,2,1,2,1,1,3,3}, {3,2,1,2,1,3,3,1}, {3,2,1,3,1,1,3,2}, {3,2,1,3,1,2,3,1},
+	{3,2,1,4,1,1,3,1}, {3,3,1,1,1,1,3,3}, {3,3,1,1,1,2,3,2}, {3,3,1,1,1,3,3,1},
+	{3,3,1,2,1,1,3,2}, {3,3,1,2,1,2,3,1}, {3,3,1,3,1,1,3,1}, {3,4,1,1,1,1,3,2},
+	{3,4,1,1,1,2,3,1}, {3,4,1,2,1,1,3,1}, {3,5,1,1,1,1,3,1}, {3,1,1,1,2,1,2,5},
+	{3,1,1,1,2,2,2,4}, {3,1,1,1,2,3,2,3}, {3,1,1,1,2,4,2,2}, {3,1,1,1,2,5,2,1},
+	{3,1,1,2,2,1,2,4}, {3,1,1,2,2,2,2,3}, {3,1,1,2,2,3,2,2}, {3,1,1,2,2,4,2,1},
+	{3,1,1,3,2,1,2,3}, {3,1,1,3,2,2,2,2}, {3,1,1,3,2,3,2,1}, {3,1,1,4,2,1,2,2},
+	{3,1,1,4,2,2,2,1}, {3,1,1,5,2,1,2,1}, {3,2,1,1,2,1,2,4}, {3,2,1,1,2,2,2,3},
+	{3,2,1,1,2,3,2,2}, {3,2,1,1,2,4,2,1}, {3,2,1,2,2,1,2,3}, {3,2,1,2,2,3,2,1},
+	{3,2,1,3,2,1,2,2}, {3,2,1,3,2,2,2,1}, {3,2,1,4,2,1,2,1}, {3,3,1,1,2,1,2,3},
+	{3,3,1,1,2,2,2,2}, {3,3,1,1,2,3,2,1}, {3,3,1,2,2,1,2,2}, {3,3,1,2,2,2,2,1},
+	{3,3,1,3,2,1,2,1}, {3,4,1,1,2,1,2,2}, {3,4,1,1,2,2,2,1}, {3,4,1,2,2,1,2,1},
+	{3,5,1,1,2,1,2,1}, {3,1,1,1,3,1,1,5}, {3,1,1,1,3,2,1,4}, {3,1,1,1,3,3,1,3},
+	{3,1,1,1,3,4,1,2}, {3,1,1,1,3,5,1,1}, {3,1,1,2,3,1,1,4}, {3,1,1,2,3,2,1,3},
+	{3,1,1,2,3,3,1,2}, {3,1,1,2,3,4,1,1}, {3,1,1,3,3,1,1,3}, {3,1,1,3,3,2,1,2},
+	{3,1,1,3,3,3,1,1}, {3,1,1,4,3,1,1,2}, {3,1,1,4,3,2,1,1}, {3,1,1,5,3,1,1,1},
+	{3,2,1,1,3,1,1,4}, {3,2,1,1,3,2,1,3}, {3,2,1,1,3,3,1,2}, {3,2,1,1,3,4,1,1},
+	{3,2,1,2,3,1,1,3}, {3,2,1,2,3,3,1,1}, {3,2,1,3,3,1,1,2}, {3,2,1,3,3,2,1,1},
+	{3,2,1,4,3,1,1,1}, {3,3,1,1,3,1,1,3}, {3,3,1,1,3,2,1,2}, {3,3,1,1,3,3,1,1},
+	{3,3,1,2,3,1,1,2}, {3,3,1,2,3,2,1,1}, {3,3,1,3,3,1,1,1}, {3,4,1,1,3,1,1,2},
+	{3,4,1,1,3,2,1,1}, {3,4,1,2,3,1,1,1}, {3,5,1,1,3,1,1,1}, {3,1,2,1,1,1,2,5},
+	{3,1,2,1,1,2,2,4}, {3,1,2,1,1,3,2,3}, {3,1,2,1,1,4,2,2}, {3,1,2,1,1,5,2,1},
+	{3,1,2,2,1,1,2,4}, {3,1,2,2,1,2,2,3}, {3,1,2,2,1,3,2,2}, {3,1,2,2,1,4,2,1},
+	{3,1,2,3,1,1,2,3}, {3,1,2,3,1,2,2,2}, {3,1,2,3,1,3,2,1}, {3,1,2,4,1,1,2,2},
+	{3,1,2,4,1,2,2,1}, {3,1,2,5,1,1,2,1}, {3,2,2,1,1,1,2,4}, {3,2,2,1,1,2,2,3},
+	{3,2,2,1,1,3,2,2}, {3,2,2,1,1,4,2,1}, {3,2,2,2,1,1,2,3}, {3,2,2,2,1,3,2,1},
+	{3,2,2,3,1,1,2,2}, {3,2,2,3,1,2,2,1}, {3,2,2,4,1,1,2,1}, {3,3,2,1,1,1,2,3},
+	{3,3,2,1,1,2,2,2}, {3,3,2,1,1,3,2,1}, {3,3,2,2,1,1,2,2}, {3,3,2,2,1,2,2,1},
+	{3,3,2,3,1,1,2,1}, {3,4,2,1,1,1,2,2}, {3,4,2,1,1,2,2,1}, {3,4,2,2,1,1,2,1},
+	{3,5,2,1,1,1,2,1}, {3,1,2,1,2,1,1,5}, {3,1,2,1,2,2,1,4}, {3,1,2,1,2,3,1,3},
+	{3,1,2,1,2,4,1,2}, {3,1,2,1,2,5,1,1}, {3,1,2,2,2,1,1,4}, {3,1,2,2,2,2,1,3},
+	{3,1,2,2,2,3,1,2}, {3,1,2,2,2,4,1,1}, {3,1,2,3,2,1,1,3}, {3,1,2,3,2,2,1,2},
+	{3,1,2,3,2,3,1,1}, {3,1,2,4,2,1,1,2}, {3,1,2,4,2,2,1,1}, {3,1,2,5,2,1,1,1},
+	{3,2,2,1,2,1,1,4}, {3,2,2,1,2,2,1,3}, {3,2,2,1,2,3,1,2}, {3,2,2,1,2,4,1,1},
+	{3,2,2,2,2,1,1,3}, {3,2,2,2,2,3,1,1}, {3,2,2,3,2,1,1,2}, {3,2,2,3,2,2,1,1},
+	{3,2,2,4,2,1,1,1}, {3,3,2,1,2,1,1,3}, {3,3,2,1,2,2,1,2}, {3,3,2,1,2,3,1,1},
+	{3,3,2,2,2,1,1,2}, {3,3,2,2,2,2,1,1}, {3,3,2,3,2,1,1,1}, {3,4,2,1,2,1,1,2},
+	{3,4,2,1,2,2,1,1}, {3,4,2,2,2,1,1,1}, {3,5,2,1,2,1,1,1}, {3,1,3,1,1,1,1,5},
+	{3,1,3,1,1,2,1,4}, {3,1,3,1,1,3,1,3}, {3,1,3,1,1,4,1,2}, {3,1,3,1,1,5,1,1},
+	{3,1,3,2,1,1,1,4}, {3,1,3,2,1,2,1,3}, {3,1,3,2,1,3,1,2}, {3,1,3,2,1,4,1,1},
+	{3,1,3,3,1,1,1,3}, {3,1,3,3,1,2,1,2}, {3,1,3,3,1,3,1,1}, {3,1,3,4,1,1,1,2},
+	{3,1,3,4,1,2,1,1}, {3,1,3,5,1,1,1,1}, {3,2,3,1,1,1,1,4}, {3,2,3,1,1,2,1,3},
+	{3,2,3,1,1,3,1,2}, {3,2,3,1,1,4,1,1}, {3,2,3,2,1,1,1,3}, {3,2,3,2,1,3,1,1},
+	{3,2,3,3,1,1,1,2}, {3,2,3,3,1,2,1,1}, {3,2,3,4,1,1,1,1}, {3,3,3,1,1,1,1,3},
+	{3,3,3,1,1,2,1,2}, {3,3,3,1,1,3,1,1}, {3,3,3,2,1,1,1,2}, {3,3,3,2,1,2,1,1},
+	{3,3,3,3,1,1,1,1}, {3,4,3,1,1,1,1,2}, {3,4,3,1,1,2,1,1}, {3,4,3,2,1,1,1,1},
+	{3,5,3,1,1,1,1,1}, {4,1,1,1,1,1,2,5}, {4,1,1,1,1,2,2,4}, {4,1,1,1,1,3,2,3},
+	{4,1,1,1,1,4,2,2}, {4,1,1,1,1,5,2,1}, {4,1,1,2,1,1,2,4}, {4,1,1,2,1,2,2,3},
+	{4,1,1,2,1,3,2,2}, {4,1,1,2,1,4,2,1}, {4,1,1,3,1,1,2,3}, {4,1,1,3,1,2,2,2},
+	{4,1,1,3,1,3,2,1}, {4,1,1,4,1,1,2,2}, {4,1,1,4,1,2,2,1}, {4,1,1,5,1,1,2,1},
+	{4,2,1,1,1,1,2,4}, {4,2,1,1,1,2,2,3}, {4,2,1,1,1,3,2,2}, {4,2,1,1,1,4,2,1},
+	{4,2,1,2,1,1,2,3}, {4,2,1,2,1,3,2,1}, {4,2,1,3,1,1,2,2}, {4,2,1,3,1,2,2,1},
+	{4,2,1,4,1,1,2,1}, {4,3,1,1,1,1,2,3}, {4,3,1,1,1,2,2,2}, {4,3,1,1,1,3,2,1},
+	{4,3,1,2,1,1,2,2}, {4,3,1,2,1,2,2,1}, {4,3,1,3,1,1,2,1}, {4,4,1,1,1,1,2,2},
+	{4,4,1,1,1,2,2,1}, {4,4,1,2,1,1,2,1}, {4,5,1,1,1,1,2,1}, {4,1,1,1,2,1,1,5},
+	{4,1,1,1,2,2,1,4}, {4,1,1,1,2,3,1,3}, {4,1,1,1,2,4,1,2}, {4,1,1,1,2,5,1,1},
+	{4,1,1,2,2,1,1,4}, {4,1,1,2,2,2,1,3}, {4,1,1,2,2,3,1,2}, {4,1,1,2,2,4,1,1},
+	{4,1,1,3,2,1,1,3}, {4,1,1,3,2,2,1,2}, {4,1,1,3,2,3,1,1}, {4,1,1,4,2,1,1,2},
+	{4,1,1,4,2,2,1,1}, {4,1,1,5,2,1,1,1}, {4,2,1,1,2,1,1,4}, {4,2,1,1,2,2,1,3},
+	{4,2,1,1,2,3,1,2}, {4,2,1,1,2,4,1,1}, {4,2,1,2,2,1,1,3}, {4,2,1,2,2,3,1,1},
+	{4,2,1,3,2,1,1,2}, {4,2,1,3,2,2,1,1}, {4,2,1,4,2,1,1,1}, {4,3,1,1,2,1,1,3},
+	{4,3,1,1,2,2,1,2}, {4,3,1,1,2,3,1,1}, {4,3,1,2,2,1,1,2}, {4,3,1,2,2,2,1,1},
+	{4,3,1,3,2,1,1,1}, {4,4,1,1,2,1,1,2}, {4,4,1,1,2,2,1,1}, {4,4,1,2,2,1,1,1},
+	{4,5,1,1,2,1,1,1}, {4,1,2,1,1,1,1,5}, {4,1,2,1,1,2,1,4}, {4,1,2,1,1,3,1,3},
+	{4,1,2,1,1,4,1,2}, {4,1,2,1,1,5,1,1}, {4,1,2,2,1,1,1,4}, {4,1,2,2,1,2,1,3},
+	{4,1,2,2,1,3,1,2}, {4,1,2,2,1,4,1,1}, {4,1,2,3,1,1,1,3}, {4,1,2,3,1,2,1,2},
+	{4,1,2,3,1,3,1,1}, {4,1,2,4,1,1,1,2}, {4,1,2,4,1,2,1,1}, {4,1,2,5,1,1,1,1},
+	{4,2,2,1,1,1,1,4}, {4,2,2,1,1,2,1,3}, {4,2,2,1,1,3,1,2}, {4,2,2,1,1,4,1,1},
+	{4,2,2,2,1,1,1,3}, {4,2,2,2,1,3,1,1}, {4,2,2,3,1,1,1,2}, {4,2,2,3,1,2,1,1},
+	{4,2,2,4,1,1,1,1}, {4,3,2,1,1,1,1,3}, {4,3,2,1,1,2,1,2}, {4,3,2,1,1,3,1,1},
+	{4,3,2,2,1,1,1,2}, {4,3,2,2,1,2,1,1}, {4,3,2,3,1,1,1,1}, {4,4,2,1,1,1,1,2},
+	{4,4,2,1,1,2,1,1}, {4,4,2,2,1,1,1,1}, {4,5,2,1,1,1,1,1}, {1,1,1,1,1,2,3,6},
+	{1,1,1,1,1,3,3,5}, {1,1,1,1,1,4,3,4}, {1,1,1,1,1,5,3,3}, {1,1,1,1,1,6,3,2},
+	{1,1,1,2,1,1,3,6}, {1,1,1,2,1,2,3,5}, {1,1,1,2,1,3,3,4}, {1,1,1,2,1,4,3,3},
+	{1,1,1,2,1,5,3,2}, {1,1,1,2,1,6,3,1}, {1,1,1,3,1,1,3,5}, {1,1,1,3,1,2,3,4},
+	{1,1,1,3,1,3,3,3}, {1,1,1,3,1,4,3,2}, {1,1,1,3,1,5,3,1}, {1,1,1,4,1,1,3,4},
+	{1,1,1,4,1,2,3,3}, {1,1,1,4,1,3,3,2}, {1,1,1,4,1,4,3,1}, {1,1,1,5,1,1,3,3},
+	{1,1,1,5,1,2,3,2}, {1,1,1,5,1,3,3,1}, {1,1,1,6,1,1,3,2}, {1,1,1,6,1,2,3,1},
+	{1,2,1,1,1,1,3,6}, {1,2,1,1,1,2,3,5}, {1,2,1,1,1,3,3,4}, {1,2,1,1,1,4,3,3},
+	{1,2,1,1,1,5,3,2}, {1,2,1,1,1,6,3,1}, {1,2,1,2,1,1,3,5}, {1,2,1,2,1,5,3,1},
+	{1,2,1,3,1,1,3,4}, {1,2,1,3,1,4,3,1}, {1,2,1,4,1,1,3,3}, {1,2,1,4,1,3,3,1},
+	{1,2,1,5,1,1,3,2}, {1,2,1,5,1,2,3,1}, {1,2,1,6,1,1,3,1}, {1,3,1,1,1,1,3,5},
+	{1,3,1,1,1,2,3,4}, {1,3,1,1,1,3,3,3}, {1,3,1,1,1,4,3,2}, {1,3,1,1,1,5,3,1},
+	{1,3,1,2,1,1,3,4}, {1,3,1,2,1,4,3,1}, {1,3,1,3,1,1,3,3}, {1,3,1,3,1,3,3,1},
+	{1,3,1,4,1,1,3,2}, {1,3,1,4,1,2,3,1}, {1,3,1,5,1,1,3,1}, {1,4,1,1,1,1,3,4},
+	{1,4,1,1,1,2,3,3}, {1,4,1,1,1,3,3,2}, {1,4,1,1,1,4,3,1}, {1,4,1,2,1,1,3,3},
+	{1,4,1,2,1,3,3,1}, {1,4,1,3,1,1,3,2}, {1,4,1,3,1,2,3,1}, {1,4,1,4,1,1,3,1},
+	{1,5,1,1,1,1,3,3}, {1,5,1,1,1,2,3,2}, {1,5,1,1,1,3,3,1}, {1,5,1,2,1,1,3,2},
+	{1,5,1,2,1,2,3,1}, {1,5,1,3,1,1,3,1}, {1,6,1,1,1,1,3,2}, {1,6,1,1,1,2,3,1},
+	{1,6,1,2,1,1,3,1}, {1,1,1,1,2,2,2,6}, {1,1,1,1,2,3,2,5}, {1,1,1,1,2,4,2,4},
+	{1,1,1,1,2,5,2,3}, {1,1,1,1,2,6,2,2}, {1,1,1,2,2,1,2,6}, {1,1,1,2,2,2,2,5},
+	{1,1,1,2,2,3,2,4}, {1,1,1,2,2,4,2,3}, {1,1,1,2,2,5,2,2}, {1,1,1,2,2,6,2,1},
+	{1,1,1,3,2,1,2,5}, {1,1,1,3,2,2,2,4}, {1,1,1,3,2,3,2,3}, {1,1,1,3,2,4,2,2},
+	{1,1,1,3,2,5,2,1}, {1,1,1,4,2,1,2,4}, {1,1,1,4,2,2,2,3}, {1,1,1,4,2,3,2,2},
+	{1,1,1,4,2,4,2,1}, {1,1,1,5,2,1,2,3}, {1,1,1,5,2,2,2,2}, {1,1,1,5,2,3,2,1},
+	{1,1,1,6,2,1,2,2}, {1,1,1,6,2,2,2,1}, {1,2,1,1,2,1,2,6}, {1,2,1,1,2,2,2,5},
+	{1,2,1,1,2,3,2,4}, {1,2,1,1,2,4,2,3}, {1,2,1,1,2,5,2,2}, {1,2,1,1,2,6,2,1},
+	{1,2,1,2,2,1,2,5}, {1,2,1,2,2,5,2,1}, {1,2,1,3,2,1,2,4}, {1,2,1,3,2,4,2,1},
+	{1,2,1,4,2,1,2,3}, {1,2,1,4,2,3,2,1}, {1,2,1,5,2,1,2,2}, {1,2,1,5,2,2,2,1},
+	{1,2,1,6,2,1,2,1}, {1,3,1,1,2,1,2,5}, {1,3,1,1,2,2,2,4}, {1,3,1,1,2,3,2,3},
+	{1,3,1,1,2,4,2,2}, {1,3,1,1,2,5,2,1}, {1,3,1,2,2,1,2,4}, {1,3,1,2,2,4,2,1},
+	{1,3,1,3,2,1,2,3}, {1,3,1,3,2,3,2,1}, {1,3,1,4,2,1,2,2}, {1,3,1,4,2,2,2,1},
+	{1,3,1,5,2,1,2,1}, {1,4,1,1,2,1,2,4}, {1,4,1,1,2,2,2,3}, {1,4,1,1,2,3,2,2},
+	{1,4,1,1,2,4,2,1}, {1,4,1,2,2,1,2,3}, {1,4,1,2,2,3,2,1}, {1,4,1,3,2,1,2,2},
+	{1,4,1,3,2,2,2,1}, {1,4,1,4,2,1,2,1}, {1,5,1,1,2,1,2,3}, {1,5,1,1,2,2,2,2},
+	{1,5,1,1,2,3,2,1}, {1,5,1,2,2,1,2,2}, {1,5,1,2,2,2,2,1}, {1,5,1,3,2,1,2,1},
+	{1,6,1,1,2,1,2,2}, {1,6,1,1,2,2,2,1}, {1,6,1,2,2,1,2,1}, {1,1,1,1,3,2,1,6},
+	{1,1,1,1,3,3,1,5}, {1,1,1,1,3,4,1,4}, {1,1,1,1,3,5,1,3}, {1,1,1,1,3,6,1,2},
+	{1,1,1,2,3,1,1,6}, {1,1,1,2,3,2,1,5}, {1,1,1,2,3,3,1,4}, {1,1,1,2,3,4,1,3},
+	{1,1,1,2,3,5,1,2}, {1,1,1,2,3,6,1,1}, {1,1,1,3,3,1,1,5}, {1,1,1,3,3,2,1,4},
+	{1,1,1,3,3,3,1,3}, {1,1,1,3,3,4,1,2}, {1,1,1,3,3,5,1,1}, {1,1,1,4,3,1,1,4},
+	{1,1,1,4,3,2,1,3}, {1,1,1,4,3,3,1,2}, {1,1,1,4,3,4,1,1}, {1,1,1,5,3,1,1,3},
+	{1,1,1,5,3,2,1,2}, {1,1,1,5,3,3,1,1}, {1,1,1,6,3,1,1,2}, {1,1,1,6,3,2,1,1},
+	{1,2,1,1,3,1,1,6}, {1,2,1,1,3,2,1,5}, {1,2,1,1,3,3,1,4}, {1,2,1,1,3,4,1,3},
+	{1,2,1,1,3,5,1,2}, {1,2,1,1,3,6,1,1}, {1,2,1,2,3,1,1,5}, {1,2,1,2,3,5,1,1},
+	{1,2,1,3,3,1,1,4}, {1,2,1,3,3,4,1,1}, {1,2,1,4,3,1,1,3}, {1,2,1,4,3,3,1,1},
+	{1,2,1,5,3,1,1,2}, {1,2,1,5,3,2,1,1}, {1,2,1,6,3,1,1,1}, {1,3,1,1,3,1,1,5},
+	{1,3,1,1,3,2,1,4}, {1,3,1,1,3,3,1,3}, {1,3,1,1,3,4,1,2}, {1,3,1,1,3,5,1,1},
+	{1,3,1,2,3,1,1,4}, {1,3,1,2,3,4,1,1}, {1,3,1,3,3,1,1,3}, {1,3,1,3,3,3,1,1},
+	{1,3,1,4,3,1,1,2}, {1,3,1,4,3,2,1,1}, {1,3,1,5,3,1,1,1}, {1,4,1,1,3,1,1,4},
+	{1,4,1,1,3,2,1,3}, {1,4,1,1,3,3,1,2}, {1,4,1,1,3,4,1,1}, {1,4,1,2,3,1,1,3},
+	{1,4,1,2,3,3,1,1}, {1,4,1,3,3,1,1,2}, {1,4,1,3,3,2,1,1}, {1,4,1,4,3,1,1,1},
+	{1,5,1,1,3,1,1,3}, {1,5,1,1,3,2,1,2}, {1,5,1,1,3,3,1,1}, {1,5,1,2,3,1,1,2},
+	{1,5,1,2,3,2,1,1}, {1,5,1,3,3,1,1,1}, {1,6,1,1,3,1,1,2}, {1,6,1,1,3,2,1,1},
+	{1,6,1,2,3,1,1,1}, {1,1,2,1,1,2,2,6}, {1,1,2,1,1,3,2,5}, {1,1,2,1,1,4,2,4},
+	{1,1,2,1,1,5,2,3}, {1,1,2,1,1,6,2,2}, {1,1,2,2,1,1,2,6}, {1,1,2,2,1,2,2,5},
+	{1,1,2,2,1,3,2,4}, {1,1,2,2,1,4,2,3}, {1,1,2,2,1,5,2,2}, {1,1,2,2,1,6,2,1},
+	{1,1,2,3,1,1,2,5}, {1,1,2,3,1,2,2,4}, {1,1,2,3,1,3,2,3}, {1,1,2,3,1,4,2,2},
+	{1,1,2,3,1,5,2,1}, {1,1,2,4,1,1,2,4}, {1,1,2,4,1,2,2,3}, {1,1,2,4,1,3,2,2},
+	{1,1,2,4,1,4,2,1}, {1,1,2,5,1,1,2,3}, {1,1,2,5,1,2,2,2}, {1,1,2,5,1,3,2,1},
+	{1,1,2,6,1,1,2,2}, {1,1,2,6,1,2,2,1}, {1,2,2,1,1,1,2,6}, {1,2,2,1,1,2,2,5},
+	{1,2,2,1,1,3,2,4}, {1,2,2,1,1,4,2,3}, {1,2,2,1,1,5,2,2}, {1,2,2,1,1,6,2,1},
+	{1,2,2,2,1,1,2,5}, {1,2,2,2,1,5,2,1}, {1,2,2,3,1,1,2,4}, {1,2,2,3,1,4,2,1},
+	{1,2,2,4,1,1,2,3}, {1,2,2,4,1,3,2,1}, {1,2,2,5,1,1,2,2}, {1,2,2,5,1,2,2,1},
+	{1,2,2,6,1,1,2,1}, {1,3,2,1,1,1,2,5}, {1,3,2,1,1,2,2,4}, {1,3,2,1,1,3,2,3},
+	{1,3,2,1,1,4,2,2}, {1,3,2,1,1,5,2,1}, {1,3,2,2,1,1,2,4}, {1,3,2,2,1,4,2,1},
+	{1,3,2,3,1,1,2,3}, {1,3,2,3,1,3,2,1}, {1,3,2,4,1,1,2,2}, {1,3,2,4,1,2,2,1},
+	{1,3,2,5,1,1,2,1}, {1,4,2,1,1,1,2,4}, {1,4,2,1,1,2,2,3}, {1,4,2,1,1,3,2,2},
+	{1,4,2,1,1,4,2,1}, {1,4,2,2,1,1,2,3}, {1,4,2,2,1,3,2,1}, {1,4,2,3,1,1,2,2},
+	{1,4,2,3,1,2,2,1}, {1,4,2,4,1,1,2,1}, {1,5,2,1,1,1,2,3}, {1,5,2,1,1,2,2,2},
+	{1,5,2,1,1,3,2,1}, {1,5,2,2,1,1,2,2}, {1,5,2,2,1,2,2,1}, {1,5,2,3,1,1,2,1},
+	{1,6,2,1,1,1,2,2}, {1,6,2,1,1,2,2,1}, {1,6,2,2,1,1,2,1}, {1,1,2,1,2,2,1,6},
+	{1,1,2,1,2,3,1,5}, {1,1,2,1,2,4,1,4}, {1,1,2,1,2,5,1,3}, {1,1,2,1,2,6,1,2},
+	{1,1,2,2,2,1,1,6}, {1,1,2,2,2,2,1,5}, {1,1,2,2,2,3,1,4}, {1,1,2,2,2,4,1,3},
+	{1,1,2,2,2,5,1,2}, {1,1,2,2,2,6,1,1}, {1,1,2,3,2,1,1,5}, {1,1,2,3,2,2,1,4},
+	{1,1,2,3,2,3,1,3}, {1,1,2,3,2,4,1,2}, {1,1,2,3,2,5,1,1}, {1,1,2,4,2,1,1,4},
+	{1,1,2,4,2,2,1,3}, {1,1,2,4,2,3,1,2}, {1,1,2,4,2,4,1,1}, {1,1,2,5,2,1,1,3},
+	{1,1,2,5,2,2,1,2}, {1,1,2,5,2,3,1,1}, {1,1,2,6,2,1,1,2}, {1,1,2,6,2,2,1,1},
+	{1,2,2,1,2,1,1,6}, {1,2,2,1,2,2,1,5}, {1,2,2,1,2,3,1,4}, {1,2,2,1,2,4,1,3},
+	{1,2,2,1,2,5,1,2}, {1,2,2,1,2,6,1,1}, {1,2,2,2,2,1,1,5}, {1,2,2,2,2,5,1,1},
+	{1,2,2,3,2,1,1,4}, {1,2,2,3,2,4,1,1}, {1,2,2,4,2,1,1,3}, {1,2,2,4,2,3,1,1},
+	{1,2,2,5,2,1,1,2}, {1,2,2,5,2,2,1,1}, {1,2,2,6,2,1,1,1}, {1,3,2,1,2,1,1,5},
+	{1,3,2,1,2,2,1,4}, {1,3,2,1,2,3,1,3}, {1,3,2,1,2,4,1,2}, {1,3,2,1,2,5,1,1},
+	{1,3,2,2,2,1,1,4}, {1,3,2,2,2,4,1,1}, {1,3,2,3,2,1,1,3}, {1,3,2,3,2,3,1,1},
+	{1,3,2,4,2,1,1,2}, {1,3,2,4,2,2,1,1}, {1,3,2,5,2,1,1,1}, {1,4,2,1,2,1,1,4},
+	{1,4,2,1,2,2,1,3}, {1,4,2,1,2,3,1,2}, {1,4,2,1,2,4,1,1}, {1,4,2,2,2,1,1,3},
+	{1,4,2,2,2,3,1,1}, {1,4,2,3,2,1,1,2}, {1,4,2,3,2,2,1,1}, {1,4,2,4,2,1,1,1},
+	{1,5,2,1,2,1,1,3}, {1,5,2,1,2,2,1,2}, {1,5,2,1,2,3,1,1}, {1,5,2,2,2,1,1,2},
+	{1,5,2,2,2,2,1,1}, {1,5,2,3,2,1,1,1}, {1,6,2,1,2,1,1,2}, {1,6,2,1,2,2,1,1},
+	{1,6,2,2,2,1,1,1}, {1,1,3,1,1,2,1,6}, {1,1,3,1,1,3,1,5}, {1,1,3,1,1,4,1,4},
+	{1,1,3,1,1,5,1,3}, {1,1,3,1,1,6,1,2}, {1,1,3,2,1,1,1,6}, {1,1,3,2,1,2,1,5},
+	{1,1,3,2,1,3,1,4}, {1,1,3,2,1,4,1,3}, {1,1,3,2,1,5,1,2}, {1,1,3,2,1,6,1,1},
+	{1,1,3,3,1,1,1,5}, {1,1,3,3,1,2,1,4}, {1,1,3,3,1,3,1,3}, {1,1,3,3,1,4,1,2},
+	{1,1,3,3,1,5,1,1}, {1,1,3,4,1,1,1,4}, {1,1,3,4,1,2,1,3}, {1,1,3,4,1,3,1,2},
+	{1,1,3,4,1,4,1,1}, {1,1,3,5,1,1,1,3}, {1,1,3,5,1,2,1,2}, {1,1,3,5,1,3,1,1},
+	{1,1,3,6,1,1,1,2}, {1,1,3,6,1,2,1,1}, {1,2,3,1,1,1,1,6}, {1,2,3,1,1,2,1,5},
+	{1,2,3,1,1,3,1,4}, {1,2,3,1,1,4,1,3}, {1,2,3,1,1,5,1,2}, {1,2,3,1,1,6,1,1},
+	{1,2,3,2,1,1,1,5}, {1,2,3,2,1,5,1,1}, {1,2,3,3,1,1,1,4}, {1,2,3,3,1,4,1,1},
+	{1,2,3,4,1,1,1,3}, {1,2,3,4,1,3,1,1}, {1,2,3,5,1,1,1,2}, {1,2,3,5,1,2,1,1},
+	{1,2,3,6,1,1,1,1}, {1,3,3,1,1,1,1,5}, {1,3,3,1,1,2,1,4}, {1,3,3,1,1,3,1,3},
+	{1,3,3,1,1,4,1,2}, {1,3,3,1,1,5,1,1}, {1,3,3,2,1,1,1,4}, {1,3,3,2,1,4,1,1},
+	{1,3,3,3,1,1,1,3}, {1,3,3,3,1,3,1,1}, {1,3,3,4,1,1,1,2}, {1,3,3,4,1,2,1,1},
+	{1,3,3,5,1,1,1,1}, {1,4,3,1,1,1,1,4}, {1,4,3,1,1,2,1,3}, {1,4,3,1,1,3,1,2},
+	{1,4,3,1,1,4,1,1}, {1,4,3,2,1,1,1,3}, {1,4,3,2,1,3,1,1}, {1,4,3,3,1,1,1,2},
+	{1,4,3,3,1,2,1,1}, {1,4,3,4,1,1,1,1}, {1,5,3,1,1,1,1,3}, {1,5,3,1,1,2,1,2},
+	{1,5,3,1,1,3,1,1}, {1,5,3,2,1,1,1,2}, {1,5,3,2,1,2,1,1}, {1,5,3,3,1,1,1,1},
+	{1,6,3,1,1,1,1,2}, {1,6,3,1,1,2,1,1}, {1,6,3,2,1,1,1,1}, {2,1,1,1,1,2,2,6},
+	{2,1,1,1,1,3,2,5}, {2,1,1,1,1,4,2,4}, {2,1,1,1,1,5,2,3}, {2,1,1,1,1,6,2,2},
+	{2,1,1,2,1,1,2,6}, {2,1,1,2,1,2,2,5}, {2,1,1,2,1,3,2,4}, {2,1,1,2,1,4,2,3},
+	{2,1,1,2,1,5,2,2}, {2,1,1,2,1,6,2,1}, {2,1,1,3,1,1,2,5}, {2,1,1,3,1,2,2,4},
+	{2,1,1,3,1,3,2,3}, {2,1,1,3,1,4,2,2}, {2,1,1,3,1,5,2,1}, {2,1,1,4,1,1,2,4},
+	{2,1,1,4,1,2,2,3}, {2,1,1,4,1,3,2,2}, {2,1,1,4,1,4,2,1}, {2,1,1,5,1,1,2,3},
+	{2,1,1,5,1,2,2,2}, {2,1,1,5,1,3,2,1}, {2,1,1,6,1,1,2,2}, {2,1,1,6,1,2,2,1},
+	{2,2,1,1,1,1,2,6}, {2,2,1,1,1,2,2,5}, {2,2,1,1,1,3,2,4}, {2,2,1,1,1,4,2,3},
+	{2,2,1,1,1,5,2,2}, {2,2,1,1,1,6,2,1}, {2,2,1,2,1,1,2,5}, {2,2,1,2,1,5,2,1},
+	{2,2,1,3,1,1,2,4}, {2,2,1,3,1,4,2,1}, {2,2,1,4,1,1,2,3}, {2,2,1,4,1,3,2,1},
+	{2,2,1,5,1,1,2,2}, {2,2,1,5,1,2,2,1}, {2,2,1,6,1,1,2,1}, {2,3,1,1,1,1,2,5},
+	{2,3,1,1,1,2,2,4}, {2,3,1,1,1,3,2,3}, {2,3,1,1,1,4,2,2}, {2,3,1,1,1,5,2,1},
+	{2,3,1,2,1,1,2,4}, {2,3,1,2,1,4,2,1}, {2,3,1,3,1,1,2,3}, {2,3,1,3,1,3,2,1},
+	{2,3,1,4,1,1,2,2}, {2,3,1,4,1,2,2,1}, {2,3,1,5,1,1,2,1}, {2,4,1,1,1,1,2,4},
+	{2,4,1,1,1,2,2,3}, {2,4,1,1,1,3,2,2}, {2,4,1,1,1,4,2,1}, {2,4,1,2,1,1,2,3},
+	{2,4,1,2,1,3,2,1}, {2,4,1,3,1,1,2,2}, {2,4,1,3,1,2,2,1}, {2,4,1,4,1,1,2,1},
+	{2,5,1,1,1,1,2,3}, {2,5,1,1,1,2,2,2}, {2,5,1,1,1,3,2,1}, {2,5,1,2,1,1,2,2},
+	{2,5,1,2,1,2,2,1}, {2,5,1,3,1,1,2,1}, {2,6,1,1,1,1,2,2}, {2,6,1,1,1,2,2,1},
+	{2,6,1,2,1,1,2,1}, {2,1,1,1,2,2,1,6}, {2,1,1,1,2,3,1,5}, {2,1,1,1,2,4,1,4},
+	{2,1,1,1,2,5,1,3}, {2,1,1,1,2,6,1,2}, {2,1,1,2,2,1,1,6}, {2,1,1,2,2,2,1,5},
+	{2,1,1,2,2,3,1,4}, {2,1,1,2,2,4,1,3}, {2,1,1,2,2,5,1,2}, {2,1,1,2,2,6,1,1},
+	{2,1,1,3,2,1,1,5}, {2,1,1,3,2,2,1,4}, {2,1,1,3,2,3,1,3}, {2,1,1,3,2,4,1,2},
+	{2,1,1,3,2,5,1,1}, {2,1,1,4,2,1,1,4}, {2,1,1,4,2,2,1,3}, {2,1,1,4,2,3,1,2},
+	{2,1,1,4,2,4,1,1}, {2,1,1,5,2,1,1,3}, {2,1,1,5,2,2,1,2}, {2,1,1,5,2,3,1,1},
+	{2,1,1,6,2,1,1,2}, {2,1,1,6,2,2,1,1}, {2,2,1,1,2,1,1,6}, {2,2,1,1,2,2,1,5},
+	{2,2,1,1,2,3,1,4}, {2,2,1,1,2,4,1,3}, {2,2,1,1,2,5,1,2}, {2,2,1,1,2,6,1,1},
+	{2,2,1,2,2,1,1,5}, {2,2,1,2,2,5,1,1}, {2,2,1,3,2,1,1,4}, {2,2,1,3,2,4,1,1},
+	{2,2,1,4,2,1,1,3}, {2,2,1,4,2,3,1,1}, {2,2,1,5,2,1,1,2}, {2,2,1,5,2,2,1,1},
+	{2,2,1,6,2,1,1,1}, {2,3,1,1,2,1,1,5}, {2,3,1,1,2,2,1,4}, {2,3,1,1,2,3,1,3},
+	{2,3,1,1,2,4,1,2}, {2,3,1,1,2,5,1,1}, {2,3,1,2,2,1,1,4}, {2,3,1,2,2,4,1,1},
+	{2,3,1,3,2,1,1,3}, {2,3,1,3,2,3,1,1}, {2,3,1,4,2,1,1,2}, {2,3,1,4,2,2,1,1},
+	{2,3,1,5,2,1,1,1}, {2,4,1,1,2,1,1,4}, {2,4,1,1,2,2,1,3}, {2,4,1,1,2,3,1,2},
+	{2,4,1,1,2,4,1,1}, {2,4,1,2,2,1,1,3}, {2,4,1,2,2,3,1,1}, {2,4,1,3,2,1,1,2},
+	{2,4,1,3,2,2,1,1}, {2,4,1,4,2,1,1,1}, {2,5,1,1,2,1,1,3}, {2,5,1,1,2,2,1,2},
+	{2,5,1,1,2,3,1,1}, {2,5,1,2,2,1,1,2}, {2,5,1,2,2,2,1,1}, {2,5,1,3,2,1,1,1},
+	{2,6,1,1,2,1,1,2}, {2,6,1,1,2,2,1,1}, {2,6,1,2,2,1,1,1}, {2,1,2,1,1,2,1,6},
+	{2,1,2,1,1,3,1,5}, {2,1,2,1,1,4,1,4}, {2,1,2,1,1,5,1,3}, {2,1,2,1,1,6,1,2},
+	{2,1,2,2,1,1,1,6}, {2,1,2,2,1,2,1,5}, {2,1,2,2,1,3,1,4}, {2,1,2,2,1,4,1,3},
+	{2,1,2,2,1,5,1,2}, {2,1,2,2,1,6,1,1}, {2,1,2,3,1,1,1,5}, {2,1,2,3,1,2,1,4},
+	{2,1,2,3,1,3,1,3}, {2,1,2,3,1,4,1,2}, {2,1,2,3,1,5,1,1}, {2,1,2,4,1,1,1,4},
+	{2,1,2,4,1,2,1,3}, {2,1,2,4,1,3,1,2}, {2,1,2,4,1,4,1,1}, {2,1,2,5,1,1,1,3},
+	{2,1,2,5,1,2,1,2}, {2,1,2,5,1,3,1,1}, {2,1,2,6,1,1,1,2}, {2,1,2,6,1,2,1,1},
+	{2,2,2,1,1,1,1,6}, {2,2,2,1,1,2,1,5}, {2,2,2,1,1,3,1,4}, {2,2,2,1,1,4,1,3},
+	{2,2,2,1,1,5,1,2}, {2,2,2,1,1,6,1,1}, {2,2,2,2,1,1,1,5}, {2,2,2,2,1,5,1,1},
+	{2,2,2,3,1,1,1,4}, {2,2,2,3,1,4,1,1}, {2,2,2,4,1,1,1,3}, {2,2,2,4,1,3,1,1},
+	{2,2,2,5,1,1,1,2}, {2,2,2,5,1,2,1,1}, {2,2,2,6,1,1,1,1}, {2,3,2,1,1,1,1,5},
+	{2,3,2,1,1,2,1,4}, {2,3,2,1,1,3,1,3}, {2,3,2,1,1,4,1,2}, {2,3,2,1,1,5,1,1},
+	{2,3,2,2,1,1,1,4}, {2,3,2,2,1,4,1,1}, {2,3,2,3,1,1,1,3}, {2,3,2,3,1,3,1,1},
+	{2,3,2,4,1,1,1,2}, {2,3,2,4,1,2,1,1}, {2,3,2,5,1,1,1,1}, {2,4,2,1,1,1,1,4},
+	{2,4,2,1,1,2,1,3}, {2,4,2,1,1,3,1,2}, {2,4,2,1,1,4,1,1}, {2,4,2,2,1,1,1,3},
+	{2,4,2,2,1,3,1,1}, {2,4,2,3,1,1,1,2}, {2,4,2,3,1,2,1,1}, {2,4,2,4,1,1,1,1},
+	{2,5,2,1,1,1,1,3}, {2,5,2,1,1,2,1,2}, {2,5,2,1,1,3,1,1}, {2,5,2,2,1,1,1,2},
+	{2,5,2,2,1,2,1,1}, {2,5,2,3,1,1,1,1}, {2,6,2,1,1,1,1,2}, {2,6,2,1,1,2,1,1},
+	{2,6,2,2,1,1,1,1}, {3,1,1,1,1,2,1,6}, {3,1,1,1,1,3,1,5}, {3,1,1,1,1,4,1,4},
+	{3,1,1,1,1,5,1,3}, {3,1,1,1,1,6,1,2}, {3,1,1,2,1,1,1,6}, {3,1,1,2,1,2,1,5},
+	{3,1,1,2,1,3,1,4}, {3,1,1,2,1,4,1,3}, {3,1,1,2,1,5,1,2}, {3,1,1,2,1,6,1,1},
+	{3,1,1,3,1,1,1,5}, {3,1,1,3,1,2,1,4}, {3,1,1,3,1,3,1,3}, {3,1,1,3,1,4,1,2},
+	{3,1,1,3,1,5,1,1}, {3,1,1,4,1,1,1,4}, {3,1,1,4,1,2,1,3}, {3,1,1,4,1,3,1,2},
+	{3,1,1,4,1,4,1,1}, {3,1,1,5,1,1,1,3}, {3,1,1,5,1,2,1,2}, {3,1,1,5,1,3,1,1},
+	{3,1,1,6,1,1,1,2}, {3,1,1,6,1,2,1,1}, {3,2,1,1,1,1,1,6}, {3,2,1,1,1,2,1,5},
+	{3,2,1,1,1,3,1,4}, {3,2,1,1,1,4,1,3}, {3,2,1,1,1,5,1,2}, {3,2,1,1,1,6,1,1},
+	{3,2,1,2,1,1,1,5}, {3,2,1,2,1,5,1,1}, {3,2,1,3,1,1,1,4}, {3,2,1,3,1,4,1,1},
+	{3,2,1,4,1,1,1,3}, {3,2,1,4,1,3,1,1}, {3,2,1,5,1,1,1,2}, {3,2,1,5,1,2,1,1},
+	{3,2,1,6,1,1,1,1}, {3,3,1,1,1,1,1,5}, {3,3,1,1,1,2,1,4}, {3,3,1,1,1,3,1,3},
+	{3,3,1,1,1,4,1,2}, {3,3,1,1,1,5,1,1}, {3,3,1,2,1,1,1,4}, {3,3,1,2,1,4,1,1},
+	{3,3,1,3,1,1,1,3}, {3,3,1,3,1,3,1,1}, {3,3,1,4,1,1,1,2}, {3,3,1,4,1,2,1,1},
+	{3,3,1,5,1,1,1,1}, {3,4,1,1,1,1,1,4}, {3,4,1,1,1,2,1,3}, {3,4,1,1,1,3,1,2},
+	{3,4,1,1,1,4,1,1}, {3,4,1,2,1,1,1,3}, {3,4,1,2,1,3,1,1}, {3,4,1,3,1,1,1,2},
+	{3,4,1,3,1,2,1,1}, {3,4,1,4,1,1,1,1}, {3,5,1,1,1,1,1,3}, {3,5,1,1,1,2,1,2},
+	{3,5,1,1,1,3,1,1}, {3,5,1,2,1,1,1,2}, {3,5,1,2,1,2,1,1}, {3,5,1,3,1,1,1,1},
+	{3,6,1,1,1,1,1,2}, {3,6,1,1,1,2,1,1}, {3,6,1,2,1,1,1,1}, {1,1,1,1,1,2,1,8},
+	{1,1,1,1,1,3,1,7}, {1,1,1,1,1,4,1,6}, {1,1,1,1,1,5,1,5}, {1,1,1,1,1,6,1,4},
+	{1,1,1,1,1,7,1,3}, {1,1,1,1,1,8,1,2}, {1,1,1,2,1,1,1,8}, {1,1,1,2,1,2,1,7},
+	{1,1,1,2,1,3,1,6}, {1,1,1,2,1,4,1,5}, {1,1,1,2,1,5,1,4}, {1,1,1,2,1,6,1,3},
+	{1,1,1,2,1,7,1,2}, {1,1,1,2,1,8,1,1}, {1,1,1,3,1,1,1,7}, {1,1,1,3,1,2,1,6},
+	{1,1,1,3,1,3,1,5}, {1,1,1,3,1,4,1,4}, {1,1,1,3,1,5,1,3}, {1,1,1,3,1,6,1,2},
+	{1,1,1,3,1,7,1,1}, {1,1,1,4,1,1,1,6}, {1,1,1,4,1,2,1,5}, {1,1,1,4,1,3,1,4},
+	{1,1,1,4,1,4,1,3}, {1,1,1,4,1,5,1,2}, {1,1,1,4,1,6,1,1}, {1,1,1,5,1,1,1,5},
+	{1,1,1,5,1,2,1,4}, {1,1,1,5,1,3,1,3}, {1,1,1,5,1,4,1,2}, {1,1,1,5,1,5,1,1},
+	{1,1,1,6,1,1,1,4}, {1,1,1,6,1,2,1,3}, {1,1,1,6,1,3,1,2}, {1,1,1,6,1,4,1,1},
+	{1,1,1,7,1,1,1,3}, {1,1,1,7,1,2,1,2}, {1,1,1,7,1,3,1,1}, {1,1,1,8,1,1,1,2},
+	{1,1,1,8,1,2,1,1}, {1,2,1,1,1,1,1,8}, {1,2,1,1,1,2,1,7}, {1,2,1,1,1,3,1,6},
+	{1,2,1,1,1,4,1,5}, {1,2,1,1,1,5,1,4}, {1,2,1,1,1,6,1,3}, {1,2,1,1,1,7,1,2},
+	{1,2,1,1,1,8,1,1}, {1,2,1,2,1,1,1,7}, {1,2,1,2,1,7,1,1}, {1,2,1,3,1,1,1,6},
+	{1,2,1,3,1,6,1,1}, {1,2,1,4,1,1,1,5}, {1,2,1,4,1,5,1,1}, {1,2,1,5,1,1,1,4},
+	{1,2,1,5,1,4,1,1}, {1,2,1,6,1,1,1,3}, {1,2,1,6,1,3,1,1}, {1,2,1,7,1,1,1,2},
+	{1,2,1,7,1,2,1,1}, {1,2,1,8,1,1,1,1}, {1,3,1,1,1,1,1,7}, {1,3,1,1,1,2,1,6},
+	{1,3,1,1,1,3,1,5}, {1,3,1,1,1,4,1,4}, {1,3,1,1,1,5,1,3}, {1,3,1,1,1,6,1,2},
+	{1,3,1,1,1,7,1,1}, {1,3,1,2,1,1,1,6}, {1,3,1,2,1,6,1,1}, {1,3,1,3,1,1,1,5},
+	{1,3,1,3,1,5,1,1}, {1,3,1,4,1,1,1,4}, {1,3,1,4,1,4,1,1}, {1,3,1,5,1,1,1,3},
+	{1,3,1,5,1,3,1,1}, {1,3,1,6,1,1,1,2}, {1,3,1,6,1,2,1,1}, {1,3,1,7,1,1,1,1},
+	{1,4,1,1,1,1,1,6}, {1,4,1,1,1,2,1,5}, {1,4,1,1,1,3,1,4}, {1,4,1,1,1,4,1,3},
+	{1,4,1,1,1,5,1,2}, {1,4,1,1,1,6,1,1}, {1,4,1,2,1,1,1,5}, {1,4,1,2,1,5,1,1},
+	{1,4,1,3,1,1,1,4}, {1,4,1,3,1,4,1,1}, {1,4,1,4,1,1,1,3}, {1,4,1,4,1,3,1,1},
+	{1,4,1,5,1,1,1,2}, {1,4,1,5,1,2,1,1}, {1,4,1,6,1,1,1,1}, {1,5,1,1,1,1,1,5},
+	{1,5,1,1,1,2,1,4}, {1,5,1,1,1,3,1,3}, {1,5,1,1,1,4,1,2}, {1,5,1,1,1,5,1,1},
+	{1,5,1,2,1,1,1,4}, {1,5,1,2,1,4,1,1}, {1,5,1,3,1,1,1,3}, {1,5,1,3,1,3,1,1},
+	{1,5,1,4,1,1,1,2}, {1,5,1,4,1,2,1,1}, {1,5,1,5,1,1,1,1}, {1,6,1,1,1,1,1,4},
+	{1,6,1,1,1,2,1,3}, {1,6,1,1,1,3,1,2}, {1,6,1,1,1,4,1,1}, {1,6,1,2,1,1,1,3},
+	{1,6,1,2,1,3,1,1}, {1,6,1,3,1,1,1,2}, {1,6,1,3,1,2,1,1}, {1,6,1,4,1,1,1,1},
+	{1,7,1,1,1,1,1,3}, {1,7,1,1,1,2,1,2}, {1,7,1,1,1,3,1,1}, {1,7,1,2,1,1,1,2},
+	{1,7,1,2,1,2,1,1}, {1,7,1,3,1,1,1,1}, {1,8,1,1,1,1,1,2}, {1,8,1,1,1,2,1,1},
+	{1,8,1,2,1,1,1,1}
+};
+
+// RSS-14 15,4 inside characters, odd elements in even positions
+const uint8_t gs1_rss14Inside[RSS14_INSIDE_VALS][8] = {
+	{1,1,1,1,1,1,2,7}, {1,1,1,1,2,1,1,7}, {1,1,2,1,1,1,1,7}, {2,1,1,1,1,1,1,7},
+	{1,1,1,1,1,2,2,6}, {1,1,1,1,2,2,1,6}, {1,1,2,1,1,2,1,6}, {2,1,1,1,1,2,1,6},
+	{1,1,1,1,1,3,2,5}, {1,1,1,1,2,3,1,5}, {1,1,2,1,1,3,1,5}, {2,1,1,1,1,3,1,5},
+	{1,1,1,1,1,4,2,4}, {1,1,1,1,2,4,1,4}, {1,1,2,1,1,4,1,4}, {2,1,1,1,1,4,1,4},
+	{1,1,1,1,1,5,2,3}, {1,1,1,1,2,5,1,3}, {1,1,2,1,1,5,1,3}, {2,1,1,1,1,5,1,3},
+	{1,1,1,1,1,6,2,2}, {1,1,1,1,2,6,1,2}, {1,1,2,1,1,6,1,2}, {2,1,1,1,1,6,1,2},
+	{1,1,1,1,1,7,2,1}, {1,1,1,1,2,7,1,1}, {1,1,2,1,1,7,1,1}, {2,1,1,1,1,7,1,1},
+	{1,1,1,2,1,1,2,6}, {1,1,1,2,2,1,1,6}, {1,1,2,2,1,1,1,6}, {2,1,1,2,1,1,1,6},
+	{1,1,1,2,1,2,2,5}, {1,1,1,2,2,2,1,5}, {1,1,2,2,1,2,1,5}, {2,1,1,2,1,2,1,5},
+	{1,1,1,2,1,3,2,4}, {1,1,1,2,2,3,1,4}, {1,1,2,2,1,3,1,4}, {2,1,1,2,1,3,1,4},
+	{1,1,1,2,1,4,2,3}, {1,1,1,2,2,4,1,3}, {1,1,2,2,1,4,1,3}, {2,1,1,2,1,4,1,3},
+	{1,1,1,2,1,5,2,2}, {1,1,1,2,2,5,1,2}, {1,1,2,2,1,5,1,2}, {2,1,1,2,1,5,1,2},
+	{1,1,1,2,1,6,2,1}, {1,1,1,2,2,6,1,1}, {1,1,2,2,1,6,1,1}, {2,1,1,2,1,6,1,1},
+	{1,1,1,3,1,1,2,5}, {1,1,1,3,2,1,1,5}, {1,1,2,3,1,1,1,5}, {2,1,1,3,1,1,1,5},
+	{1,1,1,3,1,2,2,4}, {1,1,1,3,2,2,1,4}, {1,1,2,3,1,2,1,4}, {2,1,1,3,1,2,1,4},
+	{1,1,1,3,1,3,2,3}, {1,1,1,3,2,3,1,3}, {1,1,2,3,1,3,1,3}, {2,1,1,3,1,3,1,3},
+	{1,1,1,3,1,4,2,2}, {1,1,1,3,2,4,1,2}, {1,1,2,3,1,4,1,2}, {2,1,1,3,1,4,1,2},
+	{1,1,1,3,1,5,2,1}, {1,1,1,3,2,5,1,1}, {1,1,2,3,1,5,1,1}, {2,1,1,3,1,5,1,1},
+	{1,1,1,4,1,1,2,4}, {1,1,1,4,2,1,1,4}, {1,1,2,4,1,1,1,4}, {2,1,1,4,1,1,1,4},
+	{1,1,1,4,1,2,2,3}, {1,1,1,4,2,2,1,3}, {1,1,2,4,1,2,1,3}, {2,1,1,4,1,2,1,3},
+	{1,1,1,4,1,3,2,2}, {1,1,1,4,2,3,1,2}, {1,1,2,4,1,3,1,2}, {2,1,1,4,1,3,1,2},
+	{1,1,1,4,1,4,2,1}, {1,1,1,4,2,4,1,1}, {1,1,2,4,1,4,1,1}, {2,1,1,4,1,4,1,1},
+	{1,1,1,5,1,1,2,3}, {1,1,1,5,2,1,1,3}, {1,1,2,5,1,1,1,3}, {2,1,1,5,1,1,1,3},
+	{1,1,1,5,1,2,2,2}, {1,1,1,5,2,2,1,2}, {1,1,2,5,1,2,1,2}, {2,1,1,5,1,2,1,2},
+	{1,1,1,5,1,3,2,1}, {1,1,1,5,2,3,1,1}, {1,1,2,5,1,3,1,1}, {2,1,1,5,1,3,1,1},
+	{1,1,1,6,1,1,2,2}, {1,1,1,6,2,1,1,2}, {1,1,2,6,1,1,1,2}, {2,1,1,6,1,1,1,2},
+	{1,1,1,6,1,2,2,1}, {1,1,1,6,2,2,1,1}, {1,1,2,6,1,2,1,1}, {2,1,1,6,1,2,1,1},
+	{1,1,1,7,1,1,2,1}, {1,1,1,7,2,1,1,1}, {1,1,2,7,1,1,1,1}, {2,1,1,7,1,1,1,1},
+	{1,2,1,1,1,1,2,6}, {1,2,1,1,2,1,1,6}, {1,2,2,1,1,1,1,6}, {2,2,1,1,1,1,1,6},
+	{1,2,1,1,1,2,2,5}, {1,2,1,1,2,2,1,5}, {1,2,2,1,1,2,1,5}, {2,2,1,1,1,2,1,5},
+	{1,2,1,1,1,3,2,4}, {1,2,1,1,2,3,1,4}, {1,2,2,1,1,3,1,4}, {2,2,1,1,1,3,1,4},
+	{1,2,1,1,1,4,2,3}, {1,2,1,1,2,4,1,3}, {1,2,2,1,1,4,1,3}, {2,2,1,1,1,4,1,3},
+	{1,2,1,1,1,5,2,2}, {1,2,1,1,2,5,1,2}, {1,2,2,1,1,5,1,2}, {2,2,1,1,1,5,1,2},
+	{1,2,1,1,1,6,2,1}, {1,2,1,1,2,6,1,1}, {1,2,2,1,1,6,1,1}, {2,2,1,1,1,6,1,1},
+	{1,2,1,2,1,1,2,5}, {1,2,1,2,2,1,1,5}, {1,2,2,2,1,1,1,5}, {2,2,1,2,1,1,1,5},
+	{1,2,1,2,1,2,2,4}, {1,2,1,2,2,2,1,4}, {1,2,2,2,1,2,1,4}, {2,2,1,2,1,2,1,4},
+	{1,2,1,2,1,3,2,3}, {1,2,1,2,2,3,1,3}, {1,2,2,2,1,3,1,3}, {2,2,1,2,1,3,1,3},
+	{1,2,1,2,1,4,2,2}, {1,2,1,2,2,4,1,2}, {1,2,2,2,1,4,1,2}, {2,2,1,2,1,4,1,2},
+	{1,2,1,2,1,5,2,1}, {1,2,1,2,2,5,1,1}, {1,2,2,2,1,5,1,1}, {2,2,1,2,1,5,1,1},
+	{1,2,1,3,1,1,2,4}, {1,2,1,3,2,1,1,4}, {1,2,2,3,1,1,1,4}, {2,2,1,3,1,1,1,4},
+	{1,2,1,3,1,2,2,3}, {1,2,1,3,2,2,1,3}, {1,2,2,3,1,2,1,3}, {2,2,1,3,1,2,1,3},
+	{1,2,1,3,1,3,2,2}, {1,2,1,3,2,3,1,2}, {1,2,2,3,1,3,1,2}, {2,2,1,3,1,3,1,2},
+	{1,2,1,3,1,4,2,1}, {1,2,1,3,2,4,1,1}, {1,2,2,3,1,4,1,1}, {2,2,1,3,1,4,1,1},
+	{1,2,1,4,1,1,2,3}, {1,2,1,4,2,1,1,3}, {1,2,2,4,1,1,1,3}, {2,2,1,4,1,1,1,3},
+	{1,2,1,4,1,2,2,2}, {1,2,1,4,2,2,1,2}, {1,2,2,4,1,2,1,2}, {2,2,1,4,1,2,1,2},
+	{1,2,1,4,1,3,2,1}, {1,2,1,4,2,3,1,1}, {1,2,2,4,1,3,1,1}, {2,2,1,4,1,3,1,1},
+	{1,2,1,5,1,1,2,2}, {1,2,1,5,2,1,1,2}, {1,2,2,5,1,1,1,2}, {2,2,1,5,1,1,1,2},
+	{1,2,1,5,1,2,2,1}, {1,2,1,5,2,2,1,1}, {1,2,2,5,1,2,1,1}, {2,2,1,5,1,2,1,1},
+	{1,2,1,6,1,1,2,1}, {1,2,1,6,2,1,1,1}, {1,2,2,6,1,1,1,1}, {2,2,1,6,1,1,1,1},
+	{1,3,1,1,1,1,2,5}, {1,3,1,1,2,1,1,5}, {1,3,2,1,1,1,1,5}, {2,3,1,1,1,1,1,5},
+	{1,3,1,1,1,2,2,4}, {1,3,1,1,2,2,1,4}, {1,3,2,1,1,2,1,4}, {2,3,1,1,1,2,1,4},
+	{1,3,1,1,1,3,2,3}, {1,3,1,1,2,3,1,3}, {1,3,2,1,1,3,1,3}, {2,3,1,1,1,3,1,3},
+	{1,3,1,1,1,4,2,2}, {1,3,1,1,2,4,1,2}, {1,3,2,1,1,4,1,2}, {2,3,1,1,1,4,1,2},
+	{1,3,1,1,1,5,2,1}, {1,3,1,1,2,5,1,1}, {1,3,2,1,1,5,1,1}, {2,3,1,1,1,5,1,1},
+	{1,3,1,2,1,1,2,4}, {1,3,1,2,2,1,1,4}, {1,3,2,2,1,1,1,4}, {2,3,1,2,1,1,1,4},
+	{1,3,1,2,1,2,2,3}, {1,3,1,2,2,2,1,3}, {1,3,2,2,1,2,1,3}, {2,3,1,2,1,2,1,3},
+	{1,3,1,2,1,3,2,2}, {1,3,1,2,2,3,1,2}, {1,3,2,2,1,3,1,2}, {2,3,1,2,1,3,1,2},
+	{1,3,1,2,1,4,2,1}, {1,3,1,2,2,4,1,1}, {1,3,2,2,1,4,1,1}, {2,3,1,2,1,4,1,1},
+	{1,3,1,3,1,1,2,3}, {1,3,1,3,2,1,1,3}, {1,3,2,3,1,1,1,3}, {2,3,1,3,1,1,1,3},
+	{1,3,1,3,1,2,2,2}, {1,3,1,3,2,2,1,2}, {1,3,2,3,1,2,1,2}, {2,3,1,3,1,2,1,2},
+	{1,3,1,3,1,3,2,1}, {1,3,1,3,2,3,1,1}, {1,3,2,3,1,3,1,1}, {2,3,1,3,1,3,1,1},
+	{1,3,1,4,1,1,2,2}, {1,3,1,4,2,1,1,2}, {1,3,2,4,1,1,1,2}, {2,3,1,4,1,1,1,2},
+	{1,3,1,4,1,2,2,1}, {1,3,1,4,2,2,1,1}, {1,3,2,4,1,2,1,1}, {2,3,1,4,1,2,1,1},
+	{1,3,1,5,1,1,2,1}, {1,3,1,5,2,1,1,1}, {1,3,2,5,1,1,1,1}, {2,3,1,5,1,1,1,1},
+	{1,4,1,1,1,1,2,4}, {1,4,1,1,2,1,1,4}, {1,4,2,1,1,1,1,4}, {2,4,1,1,1,1,1,4},
+	{1,4,1,1,1,2,2,3}, {1,4,1,1,2,2,1,3}, {1,4,2,1,1,2,1,3}, {2,4,1,1,1,2,1,3},
+	{1,4,1,1,1,3,2,2}, {1,4,1,1,2,3,1,2}, {1,4,2,1,1,3,1,2}, {2,4,1,1,1,3,1,2},
+	{1,4,1,1,1,4,2,1}, {1,4,1,1,2,4,1,1}, {1,4,2,1,1,4,1,1}, {2,4,1,1,1,4,1,1},
+	{1,4,1,2,1,1,2,3}, {1,4,1,2,2,1,1,3}, {1,4,2,2,1,1,1,3}, {2,4,1,2,1,1,1,3},
+	{1,4,1,2,1,2,2,2}, {1,4,1,2,2,2,1,2}, {1,4,2,2,1,2,1,2}, {2,4,1,2,1,2,1,2},
+	{1,4,1,2,1,3,2,1}, {1,4,1,2,2,3,1,1}, {1,4,2,2,1,3,1,1}, {2,4,1,2,1,3,1,1},
+	{1,4,1,3,1,1,2,2}, {1,4,1,3,2,1,1,2}, {1,4,2,3,1,1,1,2}, {2,4,1,3,1,1,1,2},
+	{1,4,1,3,1,2,2,1}, {1,4,1,3,2,2,1,1}, {1,4,2,3,1,2,1,1}, {2,4,1,3,1,2,1,1},
+	{1,4,1,4,1,1,2,1}, {1,4,1,4,2,1,1,1}, {1,4,2,4,1,1,1,1}, {2,4,1,4,1,1,1,1},
+	{1,5,1,1,1,1,2,3}, {1,5,1,1,2,1,1,3}, {1,5,2,1,1,1,1,3}, {2,5,1,1,1,1,1,3},
+	{1,5,1,1,1,2,2,2}, {1,5,1,1,2,2,1,2}, {1,5,2,1,1,2,1,2}, {2,5,1,1,1,2,1,2},
+	{1,5,1,1,1,3,2,1}, {1,5,1,1,2,3,1,1}, {1,5,2,1,1,3,1,1}, {2,5,1,1,1,3,1,1},
+	{1,5,1,2,1,1,2,2}, {1,5,1,2,2,1,1,2}, {1,5,2,2,1,1,1,2}, {2,5,1,2,1,1,1,2},
+	{1,5,1,2,1,2,2,1}, {1,5,1,2,2,2,1,1}, {1,5,2,2,1,2,1,1}, {2,5,1,2,1,2,1,1},
+	{1,5,1,3,1,1,2,1}, {1,5,1,3,2,1,1,1}, {1,5,2,3,1,1,1,1}, {2,5,1,3,1,1,1,1},
+	{1,6,1,1,1,1,2,2}, {1,6,1,1,2,1,1,2}, {1,6,2,1,1,1,1,2}, {2,6,1,1,1,1,1,2},
+	{1,6,1,1,1,2,2,1}, {1,6,1,1,2,2,1,1}, {1,6,2,1,1,2,1,1}, {2,6,1,1,1,2,1,1},
+	{1,6,1,2,1,1,2,1}, {1,6,1,2,2,1,1,1}, {1,6,2,2,1,1,1,1}, {2,6,1,2,1,1,1,1},
+	{1,7,1,1,1,1,2,1}, {1,7,1,1,2,1,1,1}, {1,7,2,1,1,1,1,1}, {2,7,1,1,1,1,1,1},
+	{1,1,1,1,1,1,4,5}, {1,1,1,1,2,1,3,5}, {1,1,1,1,3,1,2,5}, {1,1,1,1,4,1,1,5},
+	{1,1,2,1,1,1,3,5}, {1,1,2,1,2,1,2,5}, {1,1,2,1,3,1,1,5}, {1,1,3,1,1,1,2,5},
+	{1,1,3,1,2,1,1,5}, {1,1,4,1,1,1,1,5}, {2,1,1,1,1,1,3,5}, {2,1,1,1,2,1,2,5},
+	{2,1,1,1,3,1,1,5}, {2,1,2,1,1,1,2,5}, {2,1,2,1,2,1,1,5}, {2,1,3,1,1,1,1,5},
+	{3,1,1,1,1,1,2,5}, {3,1,1,1,2,1,1,5}, {3,1,2,1,1,1,1,5}, {4,1,1,1,1,1,1,5},
+	{1,1,1,1,1,2,4,4}, {1,1,1,1,2,2,3,4}, {1,1,1,1,3,2,2,4}, {1,1,1,1,4,2,1,4},
+	{1,1,2,1,1,2,3,4}, {1,1,2,1,2,2,2,4}, {1,1,2,1,3,2,1,4}, {1,1,3,1,1,2,2,4},
+	{1,1,3,1,2,2,1,4}, {1,1,4,1,1,2,1,4}, {2,1,1,1,1,2,3,4}, {2,1,1,1,2,2,2,4},
+	{2,1,1,1,3,2,1,4}, {2,1,2,1,1,2,2,4}, {2,1,2,1,2,2,1,4}, {2,1,3,1,1,2,1,4},
+	{3,1,1,1,1,2,2,4}, {3,1,1,1,2,2,1,4}, {3,1,2,1,1,2,1,4}, {4,1,1,1,1,2,1,4},
+	{1,1,1,1,1,3,4,3}, {1,1,1,1,2,3,3,3}, {1,1,1,1,3,3,2,3}, {1,1,1,1,4,3,1,3},
+	{1,1,2,1,1,3,3,3}, {1,1,2,1,2,3,2,3}, {1,1,2,1,3,3,1,3}, {1,1,3,1,1,3,2,3},
+	{1,1,3,1,2,3,1,3}, {1,1,4,1,1,3,1,3}, {2,1,1,1,1,3,3,3}, {2,1,1,1,2,3,2,3},
+	{2,1,1,1,3,3,1,3}, {2,1,2,1,1,3,2,3}, {2,1,2,1,2,3,1,3}, {2,1,3,1,1,3,1,3},
+	{3,1,1,1,1,3,2,3}, {3,1,1,1,2,3,1,3}, {3,1,2,1,1,3,1,3}, {4,1,1,1,1,3,1,3},
+	{1,1,1,1,1,4,4,2}, {1,1,1,1,2,4,3,2}, {1,1,1,1,3,4,2,2}, {1,1,1,1,4,4,1,2},
+	{1,1,2,1,1,4,3,2}, {1,1,2,1,2,4,2,2}, {1,1,2,1,3,4,1,2}, {1,1,3,1,1,4,2,2},
+	{1,1,3,1,2,4,1,2}, {1,1,4,1,1,4,1,2}, {2,1,1,1,1,4,3,2}, {2,1,1,1,2,4,2,2},
+	{2,1,1,1,3,4,1,2}, {2,1,2,1,1,4,2,2}, {2,1,2,1,2,4,1,2}, {2,1,3,1,1,4,1,2},
+	{3,1,1,1,1,4,2,2}, {3,1,1,1,2,4,1,2}, {3,1,2,1,1,4,1,2}, {4,1,1,1,1,4,1,2},
+	{1,1,1,1,1,5,4,1}, {1,1,1,1,2,5,3,1}, {1,1,1,1,3,5,2,1}, {1,1,1,1,4,5,1,1},
+	{1,1,2,1,1,5,3,1}, {1,1,2,1,2,5,2,1}, {1,1,2,1,3,5,1,1}, {1,1,3,1,1,5,2,1},
+	{1,1,3,1,2,5,1,1}, {1,1,4,1,1,5,1,1}, {2,1,1,1,1,5,3,1}, {2,1,1,1,2,5,2,1},
+	{2,1,1,1,3,5,1,1}, {2,1,2,1,1,5,2,1}, {2,1,2,1,2,5,1,1}, {2,1,3,1,1,5,1,1},
+	{3,1,1,1,1,5,2,1}, {3,1,1,1,2,5,1,1}, {3,1,2,1,1,5,1,1}, {4,1,1,1,1,5,1,1},
+	{1,1,1,2,1,1,4,4}, {1,1,1,2,2,1,3,4}, {1,1,1,2,3,1,2,4}, {1,1,1,2,4,1,1,4},
+	{1,1,2,2,1,1,3,4}, {1,1,2,2,2,1,2,4}, {1,1,2,2,3,1,1,4}, {1,1,3,2,1,1,2,4},
+	{1,1,3,2,2,1,1,4}, {1,1,4,2,1,1,1,4}, {2,1,1,2,1,1,3,4}, {2,1,1,2,2,1,2,4},
+	{2,1,1,2,3,1,1,4}, {2,1,2,2,1,1,2,4}, {2,1,2,2,2,1,1,4}, {2,1,3,2,1,1,1,4},
+	{3,1,1,2,1,1,2,4}, {3,1,1,2,2,1,1,4}, {3,1,2,2,1,1,1,4}, {4,1,1,2,1,1,1,4},
+	{1,1,1,2,1,2,4,3}, {1,1,1,2,2,2,3,3}, {1,1,1,2,3,2,2,3}, {1,1,1,2,4,2,1,3},
+	{1,1,2,2,1,2,3,3}, {1,1,2,2,2,2,2,3}, {1,1,2,2,3,2,1,3}, {1,1,3,2,1,2,2,3},
+	{1,1,3,2,2,2,1,3}, {1,1,4,2,1,2,1,3}, {2,1,1,2,1,2,3,3}, {2,1,1,2,2,2,2,3},
+	{2,1,1,2,3,2,1,3}, {2,1,2,2,1,2,2,3}, {2,1,2,2,2,2,1,3}, {2,1,3,2,1,2,1,3},
+	{3,1,1,2,1,2,2,3}, {3,1,1,2,2,2,1,3}, {3,1,2,2,1,2,1,3}, {4,1,1,2,1,2,1,3},
+	{1,1,1,2,1,3,4,2}, {1,1,1,2,2,3,3,2}, {1,1,1,2,3,3,2,2}, {1,1,1,2,4,3,1,2},
+	{1,1,2,2,1,3,3,2}, {1,1,2,2,2,3,2,2}, {1,1,2,2,3,3,1,2}, {1,1,3,2,1,3,2,2},
+	{1,1,3,2,2,3,1,2}, {1,1,4,2,1,3,1,2}, {2,1,1,2,1,3,3,2}, {2,1,1,2,2,3,2,2},
+	{2,1,1,2,3,3,1,2}, {2,1,2,2,1,3,2,2}, {2,1,2,2,2,3,1,2}, {2,1,3,2,1,3,1,2},
+	{3,1,1,2,1,3,2,2}, {3,1,1,2,2,3,1,2}, {3,1,2,2,1,3,1,2}, {4,1,1,2,1,3,1,2},
+	{1,1,1,2,1,4,4,1}, {1,1,1,2,2,4,3,1}, {1,1,1,2,3,4,2,1}, {1,1,1,2,4,4,1,1},
+	{1,1,2,2,1,4,3,1}, {1,1,2,2,2,4,2,1}, {1,1,2,2,3,4,1,1}, {1,1,3,2,1,4,2,1},
+	{1,1,3,2,2,4,1,1}, {1,1,4,2,1,4,1,1}, {2,1,1,2,1,4,3,1}, {2,1,1,2,2,4,2,1},
+	{2,1,1,2,3,4,1,1}, {2,1,2,2,1,4,2,1}, {2,1,2,2,2,4,1,1}, {2,1,3,2,1,4,1,1},
+	{3,1,1,2,1,4,2,1}, {3,1,1,2,2,4,1,1}, {3,1,2,2,1,4,1,1}, {4,1,1,2,1,4,1,1},
+	{1,1,1,3,1,1,4,3}, {1,1,1,3,2,1,3,3}, {1,1,1,3,3,1,2,3}, {1,1,1,3,4,1,1,3},
+	{1,1,2,3,1,1,3,3}, {1,1,2,3,2,1,2,3}, {1,1,2,3,3,1,1,3}, {1,1,3,3,1,1,2,3},
+	{1,1,3,3,2,1,1,3}, {1,1,4,3,1,1,1,3}, {2,1,1,3,1,1,3,3}, {2,1,1,3,2,1,2,3},
+	{2,1,1,3,3,1,1,3}, {2,1,2,3,1,1,2,3}, {2,1,2,3,2,1,1,3}, {2,1,3,3,1,1,1,3},
+	{3,1,1,3,1,1,2,3}, {3,1,1,3,2,1,1,3}, {3,1,2,3,1,1,1,3}, {4,1,1,3,1,1,1,3},
+	{1,1,1,3,1,2,4,2}, {1,1,1,3,2,2,3,2}, {1,1,1,3,3,2,2,2}, {1,1,1,3,4,2,1,2},
+	{1,1,2,3,1,2,3,2}, {1,1,2,3,2,2,2,2}, {1,1,2,3,3,2,1,2}, {1,1,3,3,1,2,2,2},
+	{1,1,3,3,2,2,1,2}, {1,1,4,3,1,2,1,2}, {2,1,1,3,1,2,3,2}, {2,1,1,3,2,2,2,2},
+	{2,1,1,3,3,2,1,2}, {2,1,2,3,1,2,2,2}, {2,1,2,3,2,2,1,2}, {2,1,3,3,1,2,1,2},
+	{3,1,1,3,1,2,2,2}, {3,1,1,3,2,2,1,2}, {3,1,2,3,1,2,1,2}, {4,1,1,3,1,2,1,2},
+	{1,1,1,3,1,3,4,1}, {1,1,1,3,2,3,3,1}, {1,1,1,3,3,3,2,1}, {1,1,1,3,4,3,1,1},
+	{1,1,2,3,1,3,3,1}, {1,1,2,3,2,3,2,1}, {1,1,2,3,3,3,1,1}, {1,1,3,3,1,3,2,1},
+	{1,1,3,3,2,3,1,1}, {1,1,4,3,1,3,1,1}, {2,1,1,3,1,3,3,1}, {2,1,1,3,2,3,2,1},
+	{2,1,1,3,3,3,1,1}, {2,1,2,3,1,3,2,1}, {2,1,2,3,2,3,1,1}, {2,1,3,3,1,3,1,1},
+	{3,1,1,3,1,3,2,1}, {3,1,1,3,2,3,1,1}, {3,1,2,3,1,3,1,1}, {4,1,1,3,1,3,1,1},
+	{1,1,1,4,1,1,4,2}, {1,1,1,4,2,1,3,2}, {1,1,1,4,3,1,2,2}, {1,1,1,4,4,1,1,2},
+	{1,1,2,4,1,1,3,2}, {1,1,2,4,2,1,2,2}, {1,1,2,4,3,1,1,2}, {1,1,3,4,1,1,2,2},
+	{1,1,3,4,2,1,1,2}, {1,1,4,4,1,1,1,2}, {2,1,1,4,1,1,3,2}, {2,1,1,4,2,1,2,2},
+	{2,1,1,4,3,1,1,2}, {2,1,2,4,1,1,2,2}, {2,1,2,4,2,1,1,2}, {2,1,3,4,1,1,1,2},
+	{3,1,1,4,1,1,2,2}, {3,1,1,4,2,1,1,2}, {3,1,2,4,1,1,1,2}, {4,1,1,4,1,1,1,2},
+	{1,1,1,4,1,2,4,1}, {1,1,1,4,2,2,3,1}, {1,1,1,4,3,2,2,1}, {1,1,1,4,4,2,1,1},
+	{1,1,2,4,1,2,3,1}, {1,1,2,4,2,2,2,1}, {1,1,2,4,3,2,1,1}, {1,1,3,4,1,2,2,1},
+	{1,1,3,4,2,2,1,1}, {1,1,4,4,1,2,1,1}, {2,1,1,4,1,2,3,1}, {2,1,1,4,2,2,2,1},
+	{2,1,1,4,3,2,1,1}, {2,1,2,4,1,2,2,1}, {2,1,2,4,2,2,1,1}, {2,1,3,4,1,2,1,1},
+	{3,1,1,4,1,2,2,1}, {3,1,1,4,2,2,1,1}, {3,1,2,4,1,2,1,1}, {4,1,1,4,1,2,1,1},
+	{1,1,1,5,1,1,4,1}, {1,1,1,5,2,1,3,1}, {1,1,1,5,3,1,2,1}, {1,1,1,5,4,1,1,1},
+	{1,1,2,5,1,1,3,1}, {1,1,2,5,2,1,2,1}, {1,1,2,5,3,1,1,1}, {1,1,3,5,1,1,2,1},
+	{1,1,3,5,2,1,1,1}, {1,1,4,5,1,1,1,1}, {2,1,1,5,1,1,3,1}, {2,1,1,5,2,1,2,1},
+	{2,1,1,5,3,1,1,1}, {2,1,2,5,1,1,2,1}, {2,1,2,5,2,1,1,1}, {2,1,3,5,1,1,1,1},
+	{3,1,1,5,1,1,2,1}, {3,1,1,5,2,1,1,1}, {3,1,2,5,1,1,1,1}, {4,1,1,5,1,1,1,1},
+	{1,2,1,1,1,1,4,4}, {1,2,1,1,2,1,3,4}, {1,2,1,1,3,1,2,4}, {1,2,1,1,4,1,1,4},
+	{1,2,2,1,1,1,3,4}, {1,2,2,1,2,1,2,4}, {1,2,2,1,3,1,1,4}, {1,2,3,1,1,1,2,4},
+	{1,2,3,1,2,1,1,4}, {1,2,4,1,1,1,1,4}, {2,2,1,1,1,1,3,4}, {2,2,1,1,2,1,2,4},
+	{2,2,1,1,3,1,1,4}, {2,2,2,1,1,1,2,4}, {2,2,2,1,2,1,1,4}, {2,2,3,1,1,1,1,4},
+	{3,2,1,1,1,1,2,4}, {3,2,1,1,2,1,1,4}, {3,2,2,1,1,1,1,4}, {4,2,1,1,1,1,1,4},
+	{1,2,1,1,1,2,4,3}, {1,2,1,1,2,2,3,3}, {1,2,1,1,3,2,2,3}, {1,2,1,1,4,2,1,3},
+	{1,2,2,1,1,2,3,3}, {1,2,2,1,2,2,2,3}, {1,2,2,1,3,2,1,3}, {1,2,3,1,1,2,2,3},
+	{1,2,3,1,2,2,1,3}, {1,2,4,1,1,2,1,3}, {2,2,1,1,1,2,3,3}, {2,2,1,1,2,2,2,3},
+	{2,2,1,1,3,2,1,3}, {2,2,2,1,1,2,2,3}, {2,2,2,1,2,2,1,3}, {2,2,3,1,1,2,1,3},
+	{3,2,1,1,1,2,2,3}, {3,2,1,1,2,2,1,3}, {3,2,2,1,1,2,1,3}, {4,2,1,1,1,2,1,3},
+	{1,2,1,1,1,3,4,2}, {1,2,1,1,2,3,3,2}, {1,2,1,1,3,3,2,2}, {1,2,1,1,4,3,1,2},
+	{1,2,2,1,1,3,3,2}, {1,2,2,1,2,3,2,2}, {1,2,2,1,3,3,1,2}, {1,2,3,1,1,3,2,2},
+	{1,2,3,1,2,3,1,2}, {1,2,4,1,1,3,1,2}, {2,2,1,1,1,3,3,2}, {2,2,1,1,2,3,2,2},
+	{2,2,1,1,3,3,1,2}, {2,2,2,1,1,3,2,2}, {2,2,2,1,2,3,1,2}, {2,2,3,1,1,3,1,2},
+	{3,2,1,1,1,3,2,2}, {3,2,1,1,2,3,1,2}, {3,2,2,1,1,3,1,2}, {4,2,1,1,1,3,1,2},
+	{1,2,1,1,1,4,4,1}, {1,2,1,1,2,4,3,1}, {1,2,1,1,3,4,2,1}, {1,2,1,1,4,4,1,1},
+	{1,2,2,1,1,4,3,1}, {1,2,2,1,2,4,2,1}, {1,2,2,1,3,4,1,1}, {1,2,3,1,1,4,2,1},
+	{1,2,3,1,2,4,1,1}, {1,2,4,1,1,4,1,1}, {2,2,1,1,1,4,3,1}, {2,2,1,1,2,4,2,1},
+	{2,2,1,1,3,4,1,1}, {2,2,2,1,1,4,2,1}, {2,2,2,1,2,4,1,1}, {2,2,3,1,1,4,1,1},
+	{3,2,1,1,1,4,2,1}, {3,2,1,1,2,4,1,1}, {3,2,2,1,1,4,1,1}, {4,2,1,1,1,4,1,1},
+	{1,2,1,2,1,1,4,3}, {1,2,1,2,2,1,3,3}, {1,2,1,2,3,1,2,3}, {1,2,1,2,4,1,1,3},
+	{1,2,2,2,1,1,3,3}, {1,2,2,2,2,1,2,3}, {1,2,2,2,3,1,1,3}, {1,2,3,2,1,1,2,3},
+	{1,2,3,2,2,1,1,3}, {1,2,4,2,1,1,1,3}, {2,2,1,2,1,1,3,3}, {2,2,1,2,2,1,2,3},
+	{2,2,1,2,3,1,1,3}, {2,2,2,2,1,1,2,3}, {2,2,2,2,2,1,1,3}, {2,2,3,2,1,1,1,3},
+	{3,2,1,2,1,1,2,3}, {3,2,1,2,2,1,1,3}, {3,2,2,2,1,1,1,3}, {4,2,1,2,1,1,1,3},
+	{1,2,1,2,1,2,4,2}, {1,2,1,2,2,2,3,2}, {1,2,1,2,3,2,2,2}, {1,2,1,2,4,2,1,2},
+	{1,2,2,2,1,2,3,2}, {1,2,2,2,2,2,2,2}, {1,2,2,2,3,2,1,2}, {1,2,3,2,1,2,2,2},
+	{1,2,3,2,2,2,1,2}, {1,2,4,2,1,2,1,2}, {2,2,1,2,1,2,3,2}, {2,2,1,2,2,2,2,2},
+	{2,2,1,2,3,2,1,2}, {2,2,2,2,1,2,2,2}, {2,2,2,2,2,2,1,2}, {2,2,3,2,1,2,1,2},
+	{3,2,1,2,1,2,2,2}, {3,2,1,2,2,2,1,2}, {3,2,2,2,1,2,1,2}, {4,2,1,2,1,2,1,2},
+	{1,2,1,2,1,3,4,1}, {1,2,1,2,2,3,3,1}, {1,2,1,2,3,3,2,1}, {1,2,1,2,4,3,1,1},
+	{1,2,2,2,1,3,3,1}, {1,2,2,2,2,3,2,1}, {1,2,2,2,3,3,1,1}, {1,2,3,2,1,3,2,1},
+	{1,2,3,2,2,3,1,1}, {1,2,4,2,1,3,1,1}, {2,2,1,2,1,3,3,1}, {2,2,1,2,2,3,2,1},
+	{2,2,1,2,3,3,1,1}, {2,2,2,2,1,3,2,1}, {2,2,2,2,2,3,1,1}, {2,2,3,2,1,3,1,1},
+	{3,2,1,2,1,3,2,1}, {3,2,1,2,2,3,1,1}, {3,2,2,2,1,3,1,1}, {4,2,1,2,1,3,1,1},
+	{1,2,1,3,1,1,4,2}, {1,2,1,3,2,1,3,2}, {1,2,1,3,3,1,2,2}, {1,2,1,3,4,1,1,2},
+	{1,2,2,3,1,1,3,2}, {1,2,2,3,2,1,2,2}, {1,2,2,3,3,1,1,2}, {1,2,3,3,1,1,2,2},
+	{1,2,3,3,2,1,1,2}, {1,2,4,3,1,1,1,2}, {2,2,1,3,1,1,3,2}, {2,2,1,3,2,1,2,2},
+	{2,2,1,3,3,1,1,2}, {2,2,2,3,1,1,2,2}, {2,2,2,3,2,1,1,2}, {2,2,3,3,1,1,1,2},
+	{3,2,1,3,1,1,2,2}, {3,2,1,3,2,1,1,2}, {3,2,2,3,1,1,1,2}, {4,2,1,3,1,1,1,2},
+	{1,2,1,3,1,2,4,1}, {1,2,1,3,2,2,3,1}, {1,2,1,3,3,2,2,1}, {1,2,1,3,4,2,1,1},
+	{1,2,2,3,1,2,3,1}, {1,2,2,3,2,2,2,1}, {1,2,2,3,3,2,1,1}, {1,2,3,3,1,2,2,1},
+	{1,2,3,3,2,2,1,1}, {1,2,4,3,1,2,1,1}, {2,2,1,3,1,2,3,1}, {2,2,1,3,2,2,2,1},
+	{2,2,1,3,3,2,1,1}, {2,2,2,3,1,2,2,1}, {2,2,2,3,2,2,1,1}, {2,2,3,3,1,2,1,1},
+	{3,2,1,3,1,2,2,1}, {3,2,1,3,2,2,1,1}, {3,2,2,3,1,2,1,1}, {4,2,1,3,1,2,1,1},
+	{1,2,1,4,1,1,4,1}, {1,2,1,4,2,1,3,1}, {1,2,1,4,3,1,2,1}, {1,2,1,4,4,1,1,1},
+	{1,2,2,4,1,1,3,1}, {1,2,2,4,2,1,2,1}, {1,2,2,4,3,1,1,1}, {1,2,3,4,1,1,2,1},
+	{1,2,3,4,2,1,1,1}, {1,2,4,4,1,1,1,1}, {2,2,1,4,1,1,3,1}, {2,2,1,4,2,1,2,1},
+	{2,2,1,4,3,1,1,1}, {2,2,2,4,1,1,2,1}, {2,2,2,4,2,1,1,1}, {2,2,3,4,1,1,1,1},
+	{3,2,1,4,1,1,2,1}, {3,2,1,4,2,1,1,1}, {3,2,2,4,1,1,1,1}, {4,2,1,4,1,1,1,1},
+	{1,3,1,1,1,1,4,3}, {1,3,1,1,2,1,3,3}, {1,3,1,1,3,1,2,3}, {1,3,1,1,4,1,1,3},
+	{1,3,2,1,1,1,3,3}, {1,3,2,1,2,1,2,3}, {1,3,2,1,3,1,1,3}, {1,3,3,1,1,1,2,3},
+	{1,3,3,1,2,1,1,3}, {1,3,4,1,1,1,1,3}, {2,3,1,1,1,1,3,3}, {2,3,1,1,2,1,2,3},
+	{2,3,1,1,3,1,1,3}, {2,3,2,1,1,1,2,3}, {2,3,2,1,2,1,1,3}, {2,3,3,1,1,1,1,3},
+	{3,3,1,1,1,1,2,3}, {3,3,1,1,2,1,1,3}, {3,3,2,1,1,1,1,3}, {4,3,1,1,1,1,1,3},
+	{1,3,1,1,1,2,4,2}, {1,3,1,1,2,2,3,2}, {1,3,1,1,3,2,2,2}, {1,3,1,1,4,2,1,2},
+	{1,3,2,1,1,2,3,2}, {1,3,2,1,2,2,2,2}, {1,3,2,1,3,2,1,2}, {1,3,3,1,1,2,2,2},
+	{1,3,3,1,2,2,1,2}, {1,3,4,1,1,2,1,2}, {2,3,1,1,1,2,3,2}, {2,3,1,1,2,2,2,2},
+	{2,3,1,1,3,2,1,2}, {2,3,2,1,1,2,2,2}, {2,3,2,1,2,2,1,2}, {2,3,3,1,1,2,1,2},
+	{3,3,1,1,1,2,2,2}, {3,3,1,1,2,2,1,2}, {3,3,2,1,1,2,1,2}, {4,3,1,1,1,2,1,2},
+	{1,3,1,1,1,3,4,1}, {1,3,1,1,2,3,3,1}, {1,3,1,1,3,3,2,1}, {1,3,1,1,4,3,1,1},
+	{1,3,2,1,1,3,3,1}, {1,3,2,1,2,3,2,1}, {1,3,2,1,3,3,1,1}, {1,3,3,1,1,3,2,1},
+	{1,3,3,1,2,3,1,1}, {1,3,4,1,1,3,1,1}, {2,3,1,1,1,3,3,1}, {2,3,1,1,2,3,2,1},
+	{2,3,1,1,3,3,1,1}, {2,3,2,1,1,3,2,1}, {2,3,2,1,2,3,1,1}, {2,3,3,1,1,3,1,1},
+	{3,3,1,1,1,3,2,1}, {3,3,1,1,2,3,1,1}, {3,3,2,1,1,3,1,1}, {4,3,1,1,1,3,1,1},
+	{1,3,1,2,1,1,4,2}, {1,3,1,2,2,1,3,2}, {1,3,1,2,3,1,2,2}, {1,3,1,2,4,1,1,2},
+	{1,3,2,2,1,1,3,2}, {1,3,2,2,2,1,2,2}, {1,3,2,2,3,1,1,2}, {1,3,3,2,1,1,2,2},
+	{1,3,3,2,2,1,1,2}, {1,3,4,2,1,1,1,2}, {2,3,1,2,1,1,3,2}, {2,3,1,2,2,1,2,2},
+	{2,3,1,2,3,1,1,2}, {2,3,2,2,1,1,2,2}, {2,3,2,2,2,1,1,2}, {2,3,3,2,1,1,1,2},
+	{3,3,1,2,1,1,2,2}, {3,3,1,2,2,1,1,2}, {3,3,2,2,1,1,1,2}, {4,3,1,2,1,1,1,2},
+	{1,3,1,2,1,2,4,1}, {1,3,1,2,2,2,3,1}, {1,3,1,2,3,2,2,1}, {1,3,1,2,4,2,1,1},
+	{1,3,2,2,1,2,3,1}, {1,3,2,2,2,2,2,1}, {1,3,2,2,3,2,1,1}, {1,3,3,2,1,2,2,1},
+	{1,3,3,2,2,2,1,1}, {1,3,4,2,1,2,1,1}, {2,3,1,2,1,2,3,1}, {2,3,1,2,2,2,2,1},
+	{2,3,1,2,3,2,1,1}, {2,3,2,2,1,2,2,1}, {2,3,2,2,2,2,1,1}, {2,3,3,2,1,2,1,1},
+	{3,3,1,2,1,2,2,1}, {3,3,1,2,2,2,1,1}, {3,3,2,2,1,2,1,1}, {4,3,1,2,1,2,1,1},
+	{1,3,1,3,1,1,4,1}, {1,3,1,3,2,1,3,1}, {1,3,1,3,3,1,2,1}, {1,3,1,3,4,1,1,1},
+	{1,3,2,3,1,1,3,1}, {1,3,2,3,2,1,2,1}, {1,3,2,3,3,1,1,1}, {1,3,3,3,1,1,2,1},
+	{1,3,3,3,2,1,1,1}, {1,3,4,3,1,1,1,1}, {2,3,1,3,1,1,3,1}, {2,3,1,3,2,1,2,1},
+	{2,3,1,3,3,1,1,1}, {2,3,2,3,1,1,2,1}, {2,3,2,3,2,1,1,1}, {2,3,3,3,1,1,1,1},
+	{3,3,1,3,1,1,2,1}, {3,3,1,3,2,1,1,1}, {3,3,2,3,1,1,1,1}, {4,3,1,3,1,1,1,1},
+	{1,4,1,1,1,1,4,2}, {1,4,1,1,2,1,3,2}, {1,4,1,1,3,1,2,2}, {1,4,1,1,4,1,1,2},
+	{1,4,2,1,1,1,3,2}, {1,4,2,1,2,1,2,2}, {1,4,2,1,3,1,1,2}, {1,4,3,1,1,1,2,2},
+	{1,4,3,1,2,1,1,2}, {1,4,4,1,1,1,1,2}, {2,4,1,1,1,1,3,2}, {2,4,1,1,2,1,2,2},
+	{2,4,1,1,3,1,1,2}, {2,4,2,1,1,1,2,2}, {2,4,2,1,2,1,1,2}, {2,4,3,1,1,1,1,2},
+	{3,4,1,1,1,1,2,2}, {3,4,1,1,2,1,1,2}, {3,4,2,1,1,1,1,2}, {4,4,1,1,1,1,1,2},
+	{1,4,1,1,1,2,4,1}, {1,4,1,1,2,2,3,1}, {1,4,1,1,3,2,2,1}, {1,4,1,1,4,2,1,1},
+	{1,4,2,1,1,2,3,1}, {1,4,2,1,2,2,2,1}, {1,4,2,1,3,2,1,1}, {1,4,3,1,1,2,2,1},
+	{1,4,3,1,2,2,1,1}, {1,4,4,1,1,2,1,1}, {2,4,1,1,1,2,3,1}, {2,4,1,1,2,2,2,1},
+	{2,4,1,1,3,2,1,1}, {2,4,2,1,1,2,2,1}, {2,4,2,1,2,2,1,1}, {2,4,3,1,1,2,1,1},
+	{3,4,1,1,1,2,2,1}, {3,4,1,1,2,2,1,1}, {3,4,2,1,1,2,1,1}, {4,4,1,1,1,2,1,1},
+	{1,4,1,2,1,1,4,1}, {1,4,1,2,2,1,3,1}, {1,4,1,2,3,1,2,1}, {1,4,1,2,4,1,1,1},
+	{1,4,2,2,1,1,3,1}, {1,4,2,2,2,1,2,1}, {1,4,2,2,3,1,1,1}, {1,4,3,2,1,1,2,1},
+	{1,4,3,2,2,1,1,1}, {1,4,4,2,1,1,1,1}, {2,4,1,2,1,1,3,1}, {2,4,1,2,2,1,2,1},
+	{2,4,1,2,3,1,1,1}, {2,4,2,2,1,1,2,1}, {2,4,2,2,2,1,1,1}, {2,4,3,2,1,1,1,1},
+	{3,4,1,2,1,1,2,1}, {3,4,1,2,2,1,1,1}, {3,4,2,2,1,1,1,1}, {4,4,1,2,1,1,1,1},
+	{1,5,1,1,1,1,4,1}, {1,5,1,1,2,1,3,1}, {1,5,1,1,3,1,2,1}, {1,5,1,1,4,1,1,1},
+	{1,5,2,1,1,1,3,1}, {1,5,2,1,2,1,2,1}, {1,5,2,1,3,1,1,1}, {1,5,3,1,1,1,2,1},
+	{1,5,3,1,2,1,1,1}, {1,5,4,1,1,1,1,1}, {2,5,1,1,1,1,3,1}, {2,5,1,1,2,1,2,1},
+	{2,5,1,1,3,1,1,1}, {2,5,2,1,1,1,2,1}, {2,5,2,1,2,1,1,1}, {2,5,3,1,1,1,1,1},
+	{3,5,1,1,1,1,2,1}, {3,5,1,1,2,1,1,1}, {3,5,2,1,1,1,1,1}, {4,5,1,1,1,1,1,1},
+	{1,1,1,1,1,1,6,3}, {1,1,1,1,2,1,5,3}, {1,1,1,1,3,1,4,3}, {1,1,1,1,4,1,3,3},
+	{1,1,1,1,5,1,2,3}, {1,1,1,1,6,1,1,3}, {1,1,2,1,1,1,5,3}, {1,1,2,1,2,1,4,3},
+	{1,1,2,1,3,1,3,3}, {1,1,2,1,4,1,2,3}, {1,1,2,1,5,1,1,3}, {1,1,3,1,1,1,4,3},
+	{1,1,3,1,2,1,3,3}, {1,1,3,1,3,1,2,3}, {1,1,3,1,4,1,1,3}, {1,1,4,1,1,1,3,3},
+	{1,1,4,1,2,1,2,3}, {1,1,4,1,3,1,1,3}, {1,1,5,1,1,1,2,3}, {1,1,5,1,2,1,1,3},
+	{1,1,6,1,1,1,1,3}, {2,1,1,1,1,1,5,3}, {2,1,1,1,2,1,4,3}, {2,1,1,1,3,1,3,3},
+	{2,1,1,1,4,1,2,3}, {2,1,1,1,5,1,1,3}, {2,1,2,1,1,1,4,3}, {2,1,2,1,4,1,1,3},
+	{2,1,3,1,1,1,3,3}, {2,1,3,1,3,1,1,3}, {2,1,4,1,1,1,2,3}, {2,1,4,1,2,1,1,3},
+	{2,1,5,1,1,1,1,3}, {3,1,1,1,1,1,4,3}, {3,1,1,1,2,1,3,3}, {3,1,1,1,3,1,2,3},
+	{3,1,1,1,4,1,1,3}, {3,1,2,1,1,1,3,3}, {3,1,2,1,3,1,1,3}, {3,1,3,1,1,1,2,3},
+	{3,1,3,1,2,1,1,3}, {3,1,4,1,1,1,1,3}, {4,1,1,1,1,1,3,3}, {4,1,1,1,2,1,2,3},
+	{4,1,1,1,3,1,1,3}, {4,1,2,1,1,1,2,3}, {4,1,2,1,2,1,1,3}, {4,1,3,1,1,1,1,3},
+	{1,1,1,1,1,2,6,2}, {1,1,1,1,2,2,5,2}, {1,1,1,1,3,2,4,2}, {1,1,1,1,4,2,3,2},
+	{1,1,1,1,5,2,2,2}, {1,1,1,1,6,2,1,2}, {1,1,2,1,1,2,5,2}, {1,1,2,1,2,2,4,2},
+	{1,1,2,1,3,2,3,2}, {1,1,2,1,4,2,2,2}, {1,1,2,1,5,2,1,2}, {1,1,3,1,1,2,4,2},
+	{1,1,3,1,2,2,3,2}, {1,1,3,1,3,2,2,2}, {1,1,3,1,4,2,1,2}, {1,1,4,1,1,2,3,2},
+	{1,1,4,1,2,2,2,2}, {1,1,4,1,3,2,1,2}, {1,1,5,1,1,2,2,2}, {1,1,5,1,2,2,1,2},
+	{1,1,6,1,1,2,1,2}, {2,1,1,1,1,2,5,2}, {2,1,1,1,2,2,4,2}, {2,1,1,1,3,2,3,2},
+	{2,1,1,1,4,2,2,2}, {2,1,1,1,5,2,1,2}, {2,1,2,1,1,2,4,2}, {2,1,2,1,4,2,1,2},
+	{2,1,3,1,1,2,3,2}, {2,1,3,1,3,2,1,2}, {2,1,4,1,1,2,2,2}, {2,1,4,1,2,2,1,2},
+	{2,1,5,1,1,2,1,2}, {3,1,1,1,1,2,4,2}, {3,1,1,1,2,2,3,2}, {3,1,1,1,3,2,2,2},
+	{3,1,1,1,4,2,1,2}, {3,1,2,1,1,2,3,2}, {3,1,2,1,3,2,1,2}, {3,1,3,1,1,2,2,2},
+	{3,1,3,1,2,2,1,2}, {3,1,4,1,1,2,1,2}, {4,1,1,1,1,2,3,2}, {4,1,1,1,2,2,2,2},
+	{4,1,1,1,3,2,1,2}, {4,1,2,1,1,2,2,2}, {4,1,2,1,2,2,1,2}, {4,1,3,1,1,2,1,2},
+	{1,1,1,1,1,3,6,1}, {1,1,1,1,2,3,5,1}, {1,1,1,1,3,3,4,1}, {1,1,1,1,4,3,3,1},
+	{1,1,1,1,5,3,2,1}, {1,1,1,1,6,3,1,1}, {1,1,2,1,1,3,5,1}, {1,1,2,1,2,3,4,1},
+	{1,1,2,1,3,3,3,1}, {1,1,2,1,4,3,2,1}, {1,1,2,1,5,3,1,1}, {1,1,3,1,1,3,4,1},
+	{1,1,3,1,2,3,3,1}, {1,1,3,1,3,3,2,1}, {1,1,3,1,4,3,1,1}, {1,1,4,1,1,3,3,1},
+	{1,1,4,1,2,3,2,1}, {1,1,4,1,3,3,1,1}, {1,1,5,1,1,3,2,1}, {1,1,5,1,2,3,1,1},
+	{1,1,6,1,1,3,1,1}, {2,1,1,1,1,3,5,1}, {2,1,1,1,2,3,4,1}, {2,1,1,1,3,3,3,1},
+	{2,1,1,1,4,3,2,1}, {2,1,1,1,5,3,1,1}, {2,1,2,1,1,3,4,1}, {2,1,2,1,4,3,1,1},
+	{2,1,3,1,1,3,3,1}, {2,1,3,1,3,3,1,1}, {2,1,4,1,1,3,2,1}, {2,1,4,1,2,3,1,1},
+	{2,1,5,1,1,3,1,1}, {3,1,1,1,1,3,4,1}, {3,1,1,1,2,3,3,1}, {3,1,1,1,3,3,2,1},
+	{3,1,1,1,4,3,1,1}, {3,1,2,1,1,3,3,1}, {3,1,2,1,3,3,1,1}, {3,1,3,1,1,3,2,1},
+	{3,1,3,1,2,3,1,1}, {3,1,4,1,1,3,1,1}, {4,1,1,1,1,3,3,1}, {4,1,1,1,2,3,2,1},
+	{4,1,1,1,3,3,1,1}, {4,1,2,1,1,3,2,1}, {4,1,2,1,2,3,1,1}, {4,1,3,1,1,3,1,1},
+	{1,1,1,2,1,1,6,2}, {1,1,1,2,2,1,5,2}, {1,1,1,2,3,1,4,2}, {1,1,1,2,4,1,3,2},
+	{1,1,1,2,5,1,2,2}, {1,1,1,2,6,1,1,2}, {1,1,2,2,1,1,5,2}, {1,1,2,2,2,1,4,2},
+	{1,1,2,2,3,1,3,2}, {1,1,2,2,4,1,2,2}, {1,1,2,2,5,1,1,2}, {1,1,3,2,1,1,4,2},
+	{1,1,3,2,2,1,3,2}, {1,1,3,2,3,1,2,2}, {1,1,3,2,4,1,1,2}, {1,1,4,2,1,1,3,2},
+	{1,1,4,2,2,1,2,2}, {1,1,4,2,3,1,1,2}, {1,1,5,2,1,1,2,2}, {1,1,5,2,2,1,1,2},
+	{1,1,6,2,1,1,1,2}, {2,1,1,2,1,1,5,2}, {2,1,1,2,2,1,4,2}, {2,1,1,2,3,1,3,2},
+	{2,1,1,2,4,1,2,2}, {2,1,1,2,5,1,1,2}, {2,1,2,2,1,1,4,2}, {2,1,2,2,4,1,1,2},
+	{2,1,3,2,1,1,3,2}, {2,1,3,2,3,1,1,2}, {2,1,4,2,1,1,2,2}, {2,1,4,2,2,1,1,2},
+	{2,1,5,2,1,1,1,2}, {3,1,1,2,1,1,4,2}, {3,1,1,2,2,1,3,2}, {3,1,1,2,3,1,2,2},
+	{3,1,1,2,4,1,1,2}, {3,1,2,2,1,1,3,2}, {3,1,2,2,3,1,1,2}, {3,1,3,2,1,1,2,2},
+	{3,1,3,2,2,1,1,2}, {3,1,4,2,1,1,1,2}, {4,1,1,2,1,1,3,2}, {4,1,1,2,2,1,2,2},
+	{4,1,1,2,3,1,1,2}, {4,1,2,2,1,1,2,2}, {4,1,2,2,2,1,1,2}, {4,1,3,2,1,1,1,2},
+	{1,1,1,2,1,2,6,1}, {1,1,1,2,2,2,5,1}, {1,1,1,2,3,2,4,1}, {1,1,1,2,4,2,3,1},
+	{1,1,1,2,5,2,2,1}, {1,1,1,2,6,2,1,1}, {1,1,2,2,1,2,5,1}, {1,1,2,2,2,2,4,1},
+	{1,1,2,2,3,2,3,1}, {1,1,2,2,4,2,2,1}, {1,1,2,2,5,2,1,1}, {1,1,3,2,1,2,4,1},
+	{1,1,3,2,2,2,3,1}, {1,1,3,2,3,2,2,1}, {1,1,3,2,4,2,1,1}, {1,1,4,2,1,2,3,1},
+	{1,1,4,2,2,2,2,1}, {1,1,4,2,3,2,1,1}, {1,1,5,2,1,2,2,1}, {1,1,5,2,2,2,1,1},
+	{1,1,6,2,1,2,1,1}, {2,1,1,2,1,2,5,1}, {2,1,1,2,2,2,4,1}, {2,1,1,2,3,2,3,1},
+	{2,1,1,2,4,2,2,1}, {2,1,1,2,5,2,1,1}, {2,1,2,2,1,2,4,1}, {2,1,2,2,4,2,1,1},
+	{2,1,3,2,1,2,3,1}, {2,1,3,2,3,2,1,1}, {2,1,4,2,1,2,2,1}, {2,1,4,2,2,2,1,1},
+	{2,1,5,2,1,2,1,1}, {3,1,1,2,1,2,4,1}, {3,1,1,2,2,2,3,1}, {3,1,1,2,3,2,2,1},
+	{3,1,1,2,4,2,1,1}, {3,1,2,2,1,2,3,1}, {3,1,2,2,3,2,1,1}, {3,1,3,2,1,2,2,1},
+	{3,1,3,2,2,2,1,1}, {3,1,4,2,1,2,1,1}, {4,1,1,2,1,2,3,1}, {4,1,1,2,2,2,2,1},
+	{4,1,1,2,3,2,1,1}, {4,1,2,2,1,2,2,1}, {4,1,2,2,2,2,1,1}, {4,1,3,2,1,2,1,1},
+	{1,1,1,3,1,1,6,1}, {1,1,1,3,2,1,5,1}, {1,1,1,3,3,1,4,1}, {1,1,1,3,4,1,3,1},
+	{1,1,1,3,5,1,2,1}, {1,1,1,3,6,1,1,1}, {1,1,2,3,1,1,5,1}, {1,1,2,3,2,1,4,1},
+	{1,1,2,3,3,1,3,1}, {1,1,2,3,4,1,2,1}, {1,1,2,3,5,1,1,1}, {1,1,3,3,1,1,4,1},
+	{1,1,3,3,2,1,3,1}, {1,1,3,3,3,1,2,1}, {1,1,3,3,4,1,1,1}, {1,1,4,3,1,1,3,1},
+	{1,1,4,3,2,1,2,1}, {1,1,4,3,3,1,1,1}, {1,1,5,3,1,1,2,1}, {1,1,5,3,2,1,1,1},
+	{1,1,6,3,1,1,1,1}, {2,1,1,3,1,1,5,1}, {2,1,1,3,2,1,4,1}, {2,1,1,3,3,1,3,1},
+	{2,1,1,3,4,1,2,1}, {2,1,1,3,5,1,1,1}, {2,1,2,3,1,1,4,1}, {2,1,2,3,4,1,1,1},
+	{2,1,3,3,1,1,3,1}, {2,1,3,3,3,1,1,1}, {2,1,4,3,1,1,2,1}, {2,1,4,3,2,1,1,1},
+	{2,1,5,3,1,1,1,1}, {3,1,1,3,1,1,4,1}, {3,1,1,3,2,1,3,1}, {3,1,1,3,3,1,2,1},
+	{3,1,1,3,4,1,1,1}, {3,1,2,3,1,1,3,1}, {3,1,2,3,3,1,1,1}, {3,1,3,3,1,1,2,1},
+	{3,1,3,3,2,1,1,1}, {3,1,4,3,1,1,1,1}, {4,1,1,3,1,1,3,1}, {4,1,1,3,2,1,2,1},
+	{4,1,1,3,3,1,1,1}, {4,1,2,3,1,1,2,1}, {4,1,2,3,2,1,1,1}, {4,1,3,3,1,1,1,1},
+	{1,2,1,1,1,1,6,2}, {1,2,1,1,2,1,5,2}, {1,2,1,1,3,1,4,2}, {1,2,1,1,4,1,3,2},
+	{1,2,1,1,5,1,2,2}, {1,2,1,1,6,1,1,2}, {1,2,2,1,1,1,5,2}, {1,2,2,1,2,1,4,2},
+	{1,2,2,1,3,1,3,2}, {1,2,2,1,4,1,2,2}, {1,2,2,1,5,1,1,2}, {1,2,3,1,1,1,4,2},
+	{1,2,3,1,2,1,3,2}, {1,2,3,1,3,1,2,2}, {1,2,3,1,4,1,1,2}, {1,2,4,1,1,1,3,2},
+	{1,2,4,1,2,1,2,2}, {1,2,4,1,3,1,1,2}, {1,2,5,1,1,1,2,2}, {1,2,5,1,2,1,1,2},
+	{1,2,6,1,1,1,1,2}, {2,2,1,1,1,1,5,2}, {2,2,1,1,2,1,4,2}, {2,2,1,1,3,1,3,2},
+	{2,2,1,1,4,1,2,2}, {2,2,1,1,5,1,1,2}, {2,2,2,1,1,1,4,2}, {2,2,2,1,4,1,1,2},
+	{2,2,3,1,1,1,3,2}, {2,2,3,1,3,1,1,2}, {2,2,4,1,1,1,2,2}, {2,2,4,1,2,1,1,2},
+	{2,2,5,1,1,1,1,2}, {3,2,1,1,1,1,4,2}, {3,2,1,1,2,1,3,2}, {3,2,1,1,3,1,2,2},
+	{3,2,1,1,4,1,1,2}, {3,2,2,1,1,1,3,2}, {3,2,2,1,3,1,1,2}, {3,2,3,1,1,1,2,2},
+	{3,2,3,1,2,1,1,2}, {3,2,4,1,1,1,1,2}, {4,2,1,1,1,1,3,2}, {4,2,1,1,2,1,2,2},
+	{4,2,1,1,3,1,1,2}, {4,2,2,1,1,1,2,2}, {4,2,2,1,2,1,1,2}, {4,2,3,1,1,1,1,2},
+	{1,2,1,1,1,2,6,1}, {1,2,1,1,2,2,5,1}, {1,2,1,1,3,2,4,1}, {1,2,1,1,4,2,3,1},
+	{1,2,1,1,5,2,2,1}, {1,2,1,1,6,2,1,1}, {1,2,2,1,1,2,5,1}, {1,2,2,1,2,2,4,1},
+	{1,2,2,1,3,2,3,1}, {1,2,2,1,4,2,2,1}, {1,2,2,1,5,2,1,1}, {1,2,3,1,1,2,4,1},
+	{1,2,3,1,2,2,3,1}, {1,2,3,1,3,2,2,1}, {1,2,3,1,4,2,1,1}, {1,2,4,1,1,2,3,1},
+	{1,2,4,1,2,2,2,1}, {1,2,4,1,3,2,1,1}, {1,2,5,1,1,2,2,1}, {1,2,5,1,2,2,1,1},
+	{1,2,6,1,1,2,1,1}, {2,2,1,1,1,2,5,1}, {2,2,1,1,2,2,4,1}, {2,2,1,1,3,2,3,1},
+	{2,2,1,1,4,2,2,1}, {2,2,1,1,5,2,1,1}, {2,2,2,1,1,2,4,1}, {2,2,2,1,4,2,1,1},
+	{2,2,3,1,1,2,3,1}, {2,2,3,1,3,2,1,1}, {2,2,4,1,1,2,2,1}, {2,2,4,1,2,2,1,1},
+	{2,2,5,1,1,2,1,1}, {3,2,1,1,1,2,4,1}, {3,2,1,1,2,2,3,1}, {3,2,1,1,3,2,2,1},
+	{3,2,1,1,4,2,1,1}, {3,2,2,1,1,2,3,1}, {3,2,2,1,3,2,1,1}, {3,2,3,1,1,2,2,1},
+	{3,2,3,1,2,2,1,1}, {3,2,4,1,1,2,1,1}, {4,2,1,1,1,2,3,1}, {4,2,1,1,2,2,2,1},
+	{4,2,1,1,3,2,1,1}, {4,2,2,1,1,2,2,1}, {4,2,2,1,2,2,1,1}, {4,2,3,1,1,2,1,1},
+	{1,2,1,2,1,1,6,1}, {1,2,1,2,2,1,5,1}, {1,2,1,2,3,1,4,1}, {1,2,1,2,4,1,3,1},
+	{1,2,1,2,5,1,2,1}, {1,2,1,2,6,1,1,1}, {1,2,2,2,1,1,5,1}, {1,2,2,2,2,1,4,1},
+	{1,2,2,2,3,1,3,1}, {1,2,2,2,4,1,2,1}, {1,2,2,2,5,1,1,1}, {1,2,3,2,1,1,4,1},
+	{1,2,3,2,2,1,3,1}, {1,2,3,2,3,1,2,1}, {1,2,3,2,4,1,1,1}, {1,2,4,2,1,1,3,1},
+	{1,2,4,2,2,1,2,1}, {1,2,4,2,3,1,1,1}, {1,2,5,2,1,1,2,1}, {1,2,5,2,2,1,1,1},
+	{1,2,6,2,1,1,1,1}, {2,2,1,2,1,1,5,1}, {2,2,1,2,2,1,4,1}, {2,2,1,2,3,1,3,1},
+	{2,2,1,2,4,1,2,1}, {2,2,1,2,5,1,1,1}, {2,2,2,2,1,1,4,1}, {2,2,2,2,4,1,1,1},
+	{2,2,3,2,1,1,3,1}, {2,2,3,2,3,1,1,1}, {2,2,4,2,1,1,2,1}, {2,2,4,2,2,1,1,1},
+	{2,2,5,2,1,1,1,1}, {3,2,1,2,1,1,4,1}, {3,2,1,2,2,1,3,1}, {3,2,1,2,3,1,2,1},
+	{3,2,1,2,4,1,1,1}, {3,2,2,2,1,1,3,1}, {3,2,2,2,3,1,1,1}, {3,2,3,2,1,1,2,1},
+	{3,2,3,2,2,1,1,1}, {3,2,4,2,1,1,1,1}, {4,2,1,2,1,1,3,1}, {4,2,1,2,2,1,2,1},
+	{4,2,1,2,3,1,1,1}, {4,2,2,2,1,1,2,1}, {4,2,2,2,2,1,1,1}, {4,2,3,2,1,1,1,1},
+	{1,3,1,1,1,1,6,1}, {1,3,1,1,2,1,5,1}, {1,3,1,1,3,1,4,1}, {1,3,1,1,4,1,3,1},
+	{1,3,1,1,5,1,2,1}, {1,3,1,1,6,1,1,1}, {1,3,2,1,1,1,5,1}, {1,3,2,1,2,1,4,1},
+	{1,3,2,1,3,1,3,1}, {1,3,2,1,4,1,2,1}, {1,3,2,1,5,1,1,1}, {1,3,3,1,1,1,4,1},
+	{1,3,3,1,2,1,3,1}, {1,3,3,1,3,1,2,1}, {1,3,3,1,4,1,1,1}, {1,3,4,1,1,1,3,1},
+	{1,3,4,1,2,1,2,1}, {1,3,4,1,3,1,1,1}, {1,3,5,1,1,1,2,1}, {1,3,5,1,2,1,1,1},
+	{1,3,6,1,1,1,1,1}, {2,3,1,1,1,1,5,1}, {2,3,1,1,2,1,4,1}, {2,3,1,1,3,1,3,1},
+	{2,3,1,1,4,1,2,1}, {2,3,1,1,5,1,1,1}, {2,3,2,1,1,1,4,1}, {2,3,2,1,4,1,1,1},
+	{2,3,3,1,1,1,3,1}, {2,3,3,1,3,1,1,1}, {2,3,4,1,1,1,2,1}, {2,3,4,1,2,1,1,1},
+	{2,3,5,1,1,1,1,1}, {3,3,1,1,1,1,4,1}, {3,3,1,1,2,1,3,1}, {3,3,1,1,3,1,2,1},
+	{3,3,1,1,4,1,1,1}, {3,3,2,1,1,1,3,1}, {3,3,2,1,3,1,1,1}, {3,3,3,1,1,1,2,1},
+	{3,3,3,1,2,1,1,1}, {3,3,4,1,1,1,1,1}, {4,3,1,1,1,1,3,1}, {4,3,1,1,2,1,2,1},
+	{4,3,1,1,3,1,1,1}, {4,3,2,1,1,1,2,1}, {4,3,2,1,2,1,1,1}, {4,3,3,1,1,1,1,1},
+	{1,1,1,1,1,1,8,1}, {1,1,1,1,2,1,7,1}, {1,1,1,1,3,1,6,1}, {1,1,1,1,4,1,5,1},
+	{1,1,1,1,5,1,4,1}, {1,1,1,1,6,1,3,1}, {1,1,1,1,7,1,2,1}, {1,1,1,1,8,1,1,1},
+	{1,1,2,1,1,1,7,1}, {1,1,2,1,2,1,6,1}, {1,1,2,1,3,1,5,1}, {1,1,2,1,4,1,4,1},
+	{1,1,2,1,5,1,3,1}, {1,1,2,1,6,1,2,1}, {1,1,2,1,7,1,1,1}, {1,1,3,1,1,1,6,1},
+	{1,1,3,1,2,1,5,1}, {1,1,3,1,3,1,4,1}, {1,1,3,1,4,1,3,1}, {1,1,3,1,5,1,2,1},
+	{1,1,3,1,6,1,1,1}, {1,1,4,1,1,1,5,1}, {1,1,4,1,2,1,4,1}, {1,1,4,1,3,1,3,1},
+	{1,1,4,1,4,1,2,1}, {1,1,4,1,5,1,1,1}, {1,1,5,1,1,1,4,1}, {1,1,5,1,2,1,3,1},
+	{1,1,5,1,3,1,2,1}, {1,1,5,1,4,1,1,1}, {1,1,6,1,1,1,3,1}, {1,1,6,1,2,1,2,1},
+	{1,1,6,1,3,1,1,1}, {1,1,7,1,1,1,2,1}, {1,1,7,1,2,1,1,1}, {1,1,8,1,1,1,1,1},
+	{2,1,1,1,1,1,7,1}, {2,1,1,1,2,1,6,1}, {2,1,1,1,3,1,5,1}, {2,1,1,1,4,1,4,1},
+	{2,1,1,1,5,1,3,1}, {2,1,1,1,6,1,2,1}, {2,1,1,1,7,1,1,1}, {2,1,2,1,1,1,6,1},
+	{2,1,2,1,6,1,1,1}, {2,1,3,1,1,1,5,1}, {2,1,3,1,5,1,1,1}, {2,1,4,1,1,1,4,1},
+	{2,1,4,1,4,1,1,1}, {2,1,5,1,1,1,3,1}, {2,1,5,1,3,1,1,1}, {2,1,6,1,1,1,2,1},
+	{2,1,6,1,2,1,1,1}, {2,1,7,1,1,1,1,1}, {3,1,1,1,1,1,6,1}, {3,1,1,1,2,1,5,1},
+	{3,1,1,1,3,1,4,1}, {3,1,1,1,4,1,3,1}, {3,1,1,1,5,1,2,1}, {3,1,1,1,6,1,1,1},
+	{3,1,2,1,1,1,5,1}, {3,1,2,1,5,1,1,1}, {3,1,3,1,1,1,4,1}, {3,1,3,1,4,1,1,1},
+	{3,1,4,1,1,1,3,1}, {3,1,4,1,3,1,1,1}, {3,1,5,1,1,1,2,1}, {3,1,5,1,2,1,1,1},
+	{3,1,6,1,1,1,1,1}, {4,1,1,1,1,1,5,1}, {4,1,1,1,2,1,4,1}, {4,1,1,1,3,1,3,1},
+	{4,1,1,1,4,1,2,1}, {4,1,1,1,5,1,1,1}, {4,1,2,1,1,1,4,1}, {4,1,2,1,4,1,1,1},
+	{4,1,3,1,1,1,3,1}, {4,1,3,1,3,1,1,1}, {4,1,4,1,1,1,2,1}, {4,1,4,1,2,1,1,1},
+	{4,1,5,1,1,1,1,1}
+};
+
+// RSS Expanded 17,4 characters, odd elements in even positions, parity sum in [8]
+const uint8_t gs1_rssExpChars[RSSEXP_CHAR_VALS][RSSEXP_CHAR_PAT] = {
+	{1,1,1,1,3,1,7,2,86}, {1,1,1,1,3,2,7,1,41}, {1,1,1,2,3,1,7,1,36}, {1,2,1,1,3,1,7,1,12},
+	{1,1,1,1,4,1,6,2,71}, {1,1,1,1,4,2,6,1,26}, {1,1,1,2,4,1,6,1,21}, {1,2,1,1,4,1,6,1,208},
+	{1,1,1,1,5,1,5,2,56}, {1,1,1,1,5,2,5,1,11}, {1,1,1,2,5,1,5,1,6}, {1,2,1,1,5,1,5,1,193},
+	{1,1,1,1,6,1,4,2,41}, {1,1,1,1,6,2,4,1,207}, {1,1,1,2,6,1,4,1,202}, {1,2,1,1,6,1,4,1,178},
+	{1,1,1,1,7,1,3,2,26}, {1,1,1,1,7,2,3,1,192}, {1,1,1,2,7,1,3,1,187}, {1,2,1,1,7,1,3,1,163},
+	{1,1,2,1,2,1,7,2,14}, {1,1,2,1,2,2,7,1,180}, {1,1,2,2,2,1,7,1,175}, {1,2,2,1,2,1,7,1,151},
+	{1,1,2,1,3,1,6,2,210}, {1,1,2,1,3,2,6,1,165}, {1,1,2,2,3,1,6,1,160}, {1,2,2,1,3,1,6,1,136},
+	{1,1,2,1,4,1,5,2,195}, {1,1,2,1,4,2,5,1,150}, {1,1,2,2,4,1,5,1,145}, {1,2,2,1,4,1,5,1,121},
+	{1,1,2,1,5,1,4,2,180}, {1,1,2,1,5,2,4,1,135}, {1,1,2,2,5,1,4,1,130}, {1,2,2,1,5,1,4,1,106},
+	{1,1,2,1,6,1,3,2,165}, {1,1,2,1,6,2,3,1,120}, {1,1,2,2,6,1,3,1,115}, {1,2,2,1,6,1,3,1,91},
+	{1,1,2,1,7,1,2,2,150}, {1,1,2,1,7,2,2,1,105}, {1,1,2,2,7,1,2,1,100}, {1,2,2,1,7,1,2,1,76},
+	{1,1,3,1,1,1,7,2,153}, {1,1,3,1,1,2,7,1,108}, {1,1,3,2,1,1,7,1,103}, {1,2,3,1,1,1,7,1,79},
+	{1,1,3,1,2,1,6,2,138}, {1,1,3,1,2,2,6,1,93}, {1,1,3,2,2,1,6,1,88}, {1,2,3,1,2,1,6,1,64},
+	{1,1,3,1,3,1,5,2,123}, {1,1,3,1,3,2,5,1,78}, {1,1,3,2,3,1,5,1,73}, {1,2,3,1,3,1,5,1,49},
+	{1,1,3,1,4,1,4,2,108}, {1,1,3,1,4,2,4,1,63}, {1,1,3,2,4,1,4,1,58}, {1,2,3,1,4,1,4,1,34},
+	{1,1,3,1,5,1,3,2,93}, {1,1,3,1,5,2,3,1,48}, {1,1,3,2,5,1,3,1,43}, {1,2,3,1,5,1,3,1,19},
+	{1,1,3,1,6,1,2,2,78}, {1,1,3,1,6,2,2,1,33}, {1,1,3,2,6,1,2,1,28}, {1,2,3,1,6,1,2,1,4},
+	{1,1,3,1,7,1,1,2,63}, {1,1,3,1,7,2,1,1,18}, {1,1,3,2,7,1,1,1,13}, {1,2,3,1,7,1,1,1,200},
+	{1,1,4,1,1,1,6,2,66}, {1,1,4,1,1,2,6,1,21}, {1,1,4,2,1,1,6,1,16}, {1,2,4,1,1,1,6,1,203},
+	{1,1,4,1,2,1,5,2,51}, {1,1,4,1,2,2,5,1,6}, {1,1,4,2,2,1,5,1,1}, {1,2,4,1,2,1,5,1,188},
+	{1,1,4,1,3,1,4,2,36}, {1,1,4,1,3,2,4,1,202}, {1,1,4,2,3,1,4,1,197}, {1,2,4,1,3,1,4,1,173},
+	{1,1,4,1,4,1,3,2,21}, {1,1,4,1,4,2,3,1,187}, {1,1,4,2,4,1,3,1,182}, {1,2,4,1,4,1,3,1,158},
+	{1,1,4,1,5,1,2,2,6}, {1,1,4,1,5,2,2,1,172}, {1,1,4,2,5,1,2,1,167}, {1,2,4,1,5,1,2,1,143},
+	{1,1,4,1,6,1,1,2,202}, {1,1,4,1,6,2,1,1,157}, {1,1,4,2,6,1,1,1,152}, {1,2,4,1,6,1,1,1,128},
+	{1,1,5,1,1,1,5,2,190}, {1,1,5,1,1,2,5,1,145}, {1,1,5,2,1,1,5,1,140}, {1,2,5,1,1,1,5,1,116},
+	{1,1,5,1,2,1,4,2,175}, {1,1,5,1,2,2,4,1,130}, {1,1,5,2,2,1,4,1,125}, {1,2,5,1,2,1,4,1,101},
+	{1,1,5,1,3,1,3,2,160}, {1,1,5,1,3,2,3,1,115}, {1,1,5,2,3,1,3,1,110}, {1,2,5,1,3,1,3,1,86},
+	{1,1,5,1,4,1,2,2,145}, {1,1,5,1,4,2,2,1,100}, {1,1,5,2,4,1,2,1,95}, {1,2,5,1,4,1,2,1,71},
+	{1,1,5,1,5,1,1,2,130}, {1,1,5,1,5,2,1,1,85}, {1,1,5,2,5,1,1,1,80}, {1,2,5,1,5,1,1,1,56},
+	{1,1,6,1,1,1,4,2,103}, {1,1,6,1,1,2,4,1,58}, {1,1,6,2,1,1,4,1,53}, {1,2,6,1,1,1,4,1,29},
+	{1,1,6,1,2,1,3,2,88}, {1,1,6,1,2,2,3,1,43}, {1,1,6,2,2,1,3,1,38}, {1,2,6,1,2,1,3,1,14},
+	{1,1,6,1,3,1,2,2,73}, {1,1,6,1,3,2,2,1,28}, {1,1,6,2,3,1,2,1,23}, {1,2,6,1,3,1,2,1,210},
+	{1,1,6,1,4,1,1,2,58}, {1,1,6,1,4,2,1,1,13}, {1,1,6,2,4,1,1,1,8}, {1,2,6,1,4,1,1,1,195},
+	{1,1,7,1,1,1,3,2,16}, {1,1,7,1,1,2,3,1,182}, {1,1,7,2,1,1,3,1,177}, {1,2,7,1,1,1,3,1,153},
+	{1,1,7,1,2,1,2,2,1}, {1,1,7,1,2,2,2,1,167}, {1,1,7,2,2,1,2,1,162}, {1,2,7,1,2,1,2,1,138},
+	{1,1,7,1,3,1,1,2,197}, {1,1,7,1,3,2,1,1,152}, {1,1,7,2,3,1,1,1,147}, {1,2,7,1,3,1,1,1,123},
+	{2,1,1,1,2,1,7,2,6}, {2,1,1,1,2,2,7,1,172}, {2,1,1,2,2,1,7,1,167}, {2,2,1,1,2,1,7,1,143},
+	{2,1,1,1,3,1,6,2,202}, {2,1,1,1,3,2,6,1,157}, {2,1,1,2,3,1,6,1,152}, {2,2,1,1,3,1,6,1,128},
+	{2,1,1,1,4,1,5,2,187}, {2,1,1,1,4,2,5,1,142}, {2,1,1,2,4,1,5,1,137}, {2,2,1,1,4,1,5,1,113},
+	{2,1,1,1,5,1,4,2,172}, {2,1,1,1,5,2,4,1,127}, {2,1,1,2,5,1,4,1,122}, {2,2,1,1,5,1,4,1,98},
+	{2,1,1,1,6,1,3,2,157}, {2,1,1,1,6,2,3,1,112}, {2,1,1,2,6,1,3,1,107}, {2,2,1,1,6,1,3,1,83},
+	{2,1,1,1,7,1,2,2,142}, {2,1,1,1,7,2,2,1,97}, {2,1,1,2,7,1,2,1,92}, {2,2,1,1,7,1,2,1,68},
+	{2,1,2,1,1,1,7,2,145}, {2,1,2,1,1,2,7,1,100}, {2,1,2,2,1,1,7,1,95}, {2,2,2,1,1,1,7,1,71},
+	{2,1,2,1,7,1,1,2,55}, {2,1,2,1,7,2,1,1,10}, {2,1,2,2,7,1,1,1,5}, {2,2,2,1,7,1,1,1,192},
+	{2,1,3,1,1,1,6,2,58}, {2,1,3,1,1,2,6,1,13}, {2,1,3,2,1,1,6,1,8}, {2,2,3,1,1,1,6,1,195},
+	{2,1,3,1,6,1,1,2,194}, {2,1,3,1,6,2,1,1,149}, {2,1,3,2,6,1,1,1,144}, {2,2,3,1,6,1,1,1,120},
+	{2,1,4,1,1,1,5,2,182}, {2,1,4,1,1,2,5,1,137}, {2,1,4,2,1,1,5,1,132}, {2,2,4,1,1,1,5,1,108},
+	{2,1,4,1,5,1,1,2,122}, {2,1,4,1,5,2,1,1,77}, {2,1,4,2,5,1,1,1,72}, {2,2,4,1,5,1,1,1,48},
+	{2,1,5,1,1,1,4,2,95}, {2,1,5,1,1,2,4,1,50}, {2,1,5,2,1,1,4,1,45}, {2,2,5,1,1,1,4,1,21},
+	{2,1,5,1,4,1,1,2,50}, {2,1,5,1,4,2,1,1,5}, {2,1,5,2,4,1,1,1,0}, {2,2,5,1,4,1,1,1,187},
+	{2,1,6,1,1,1,3,2,8}, {2,1,6,1,1,2,3,1,174}, {2,1,6,2,1,1,3,1,169}, {2,2,6,1,1,1,3,1,145},
+	{2,1,6,1,3,1,1,2,189}, {2,1,6,1,3,2,1,1,144}, {2,1,6,2,3,1,1,1,139}, {2,2,6,1,3,1,1,1,115},
+	{2,1,7,1,1,1,2,2,132}, {2,1,7,1,1,2,2,1,87}, {2,1,7,2,1,1,2,1,82}, {2,2,7,1,1,1,2,1,58},
+	{2,1,7,1,2,1,1,2,117}, {2,1,7,1,2,2,1,1,72}, {2,1,7,2,2,1,1,1,67}, {2,2,7,1,2,1,1,1,43},
+	{3,1,1,1,1,1,7,2,137}, {3,1,1,1,1,2,7,1,92}, {3,1,1,2,1,1,7,1,87}, {3,2,1,1,1,1,7,1,63},
+	{3,1,1,1,2,1,6,2,122}, {3,1,1,1,2,2,6,1,77}, {3,1,1,2,2,1,6,1,72}, {3,2,1,1,2,1,6,1,48},
+	{3,1,1,1,3,1,5,2,107}, {3,1,1,1,3,2,5,1,62}, {3,1,1,2,3,1,5,1,57}, {3,2,1,1,3,1,5,1,33},
+	{3,1,1,1,4,1,4,2,92}, {3,1,1,1,4,2,4,1,47}, {3,1,1,2,4,1,4,1,42}, {3,2,1,1,4,1,4,1,18},
+	{3,1,1,1,5,1,3,2,77}, {3,1,1,1,5,2,3,1,32}, {3,1,1,2,5,1,3,1,27}, {3,2,1,1,5,1,3,1,3},
+	{3,1,1,1,6,1,2,2,62}, {3,1,1,1,6,2,2,1,17}, {3,1,1,2,6,1,2,1,12}, {3,2,1,1,6,1,2,1,199},
+	{3,1,1,1,7,1,1,2,47}, {3,1,1,1,7,2,1,1,2}, {3,1,1,2,7,1,1,1,208}, {3,2,1,1,7,1,1,1,184},
+	{3,1,2,1,1,1,6,2,50}, {3,1,2,1,1,2,6,1,5}, {3,1,2,2,1,1,6,1,0}, {3,2,2,1,1,1,6,1,187},
+	{3,1,2,1,6,1,1,2,186}, {3,1,2,1,6,2,1,1,141}, {3,1,2,2,6,1,1,1,136}, {3,2,2,1,6,1,1,1,112},
+	{3,1,3,1,1,1,5,2,174}, {3,1,3,1,1,2,5,1,129}, {3,1,3,2,1,1,5,1,124}, {3,2,3,1,1,1,5,1,100},
+	{3,1,3,1,5,1,1,2,114}, {3,1,3,1,5,2,1,1,69}, {3,1,3,2,5,1,1,1,64}, {3,2,3,1,5,1,1,1,40},
+	{3,1,4,1,1,1,4,2,87}, {3,1,4,1,1,2,4,1,42}, {3,1,4,2,1,1,4,1,37}, {3,2,4,1,1,1,4,1,13},
+	{3,1,4,1,4,1,1,2,42}, {3,1,4,1,4,2,1,1,208}, {3,1,4,2,4,1,1,1,203}, {3,2,4,1,4,1,1,1,179},
+	{3,1,5,1,1,1,3,2,0}, {3,1,5,1,1,2,3,1,166}, {3,1,5,2,1,1,3,1,161}, {3,2,5,1,1,1,3,1,137},
+	{3,1,5,1,3,1,1,2,181}, {3,1,5,1,3,2,1,1,136}, {3,1,5,2,3,1,1,1,131}, {3,2,5,1,3,1,1,1,107},
+	{3,1,6,1,1,1,2,2,124}, {3,1,6,1,1,2,2,1,79}, {3,1,6,2,1,1,2,1,74}, {3,2,6,1,1,1,2,1,50},
+	{3,1,6,1,2,1,1,2,109}, {3,1,6,1,2,2,1,1,64}, {3,1,6,2,2,1,1,1,59}, {3,2,6,1,2,1,1,1,35},
+	{3,1,7,1,1,1,1,2,37}, {3,1,7,1,1,2,1,1,203}, {3,1,7,2,1,1,1,1,198}, {3,2,7,1,1,1,1,1,174},
+	{4,1,1,1,1,1,6,2,42}, {4,1,1,1,1,2,6,1,208}, {4,1,1,2,1,1,6,1,203}, {4,2,1,1,1,1,6,1,179},
+	{4,1,1,1,2,1,5,2,27}, {4,1,1,1,2,2,5,1,193}, {4,1,1,2,2,1,5,1,188}, {4,2,1,1,2,1,5,1,164},
+	{4,1,1,1,3,1,4,2,12}, {4,1,1,1,3,2,4,1,178}, {4,1,1,2,3,1,4,1,173}, {4,2,1,1,3,1,4,1,149},
+	{4,1,1,1,4,1,3,2,208}, {4,1,1,1,4,2,3,1,163}, {4,1,1,2,4,1,3,1,158}, {4,2,1,1,4,1,3,1,134},
+	{4,1,1,1,5,1,2,2,193}, {4,1,1,1,5,2,2,1,148}, {4,1,1,2,5,1,2,1,143}, {4,2,1,1,5,1,2,1,119},
+	{4,1,1,1,6,1,1,2,178}, {4,1,1,1,6,2,1,1,133}, {4,1,1,2,6,1,1,1,128}, {4,2,1,1,6,1,1,1,104},
+	{4,1,2,1,1,1,5,2,166}, {4,1,2,1,1,2,5,1,121}, {4,1,2,2,1,1,5,1,116}, {4,2,2,1,1,1,5,1,92},
+	{4,1,2,1,5,1,1,2,106}, {4,1,2,1,5,2,1,1,61}, {4,1,2,2,5,1,1,1,56}, {4,2,2,1,5,1,1,1,32},
+	{4,1,3,1,1,1,4,2,79}, {4,1,3,1,1,2,4,1,34}, {4,1,3,2,1,1,4,1,29}, {4,2,3,1,1,1,4,1,5},
+	{4,1,3,1,4,1,1,2,34}, {4,1,3,1,4,2,1,1,200}, {4,1,3,2,4,1,1,1,195}, {4,2,3,1,4,1,1,1,171},
+	{4,1,4,1,1,1,3,2,203}, {4,1,4,1,1,2,3,1,158}, {4,1,4,2,1,1,3,1,153}, {4,2,4,1,1,1,3,1,129},
+	{4,1,4,1,3,1,1,2,173}, {4,1,4,1,3,2,1,1,128}, {4,1,4,2,3,1,1,1,123}, {4,2,4,1,3,1,1,1,99},
+	{4,1,5,1,1,1,2,2,116}, {4,1,5,1,1,2,2,1,71}, {4,1,5,2,1,1,2,1,66}, {4,2,5,1,1,1,2,1,42},
+	{4,1,5,1,2,1,1,2,101}, {4,1,5,1,2,2,1,1,56}, {4,1,5,2,2,1,1,1,51}, {4,2,5,1,2,1,1,1,27},
+	{4,1,6,1,1,1,1,2,29}, {4,1,6,1,1,2,1,1,195}, {4,1,6,2,1,1,1,1,190}, {4,2,6,1,1,1,1,1,166},
+	{1,1,1,1,3,1,5,4,48}, {1,1,1,1,3,2,5,3,3}, {1,1,1,1,3,3,5,2,169}, {1,1,1,1,3,4,5,1,124},
+	{1,1,1,2,3,1,5,3,209}, {1,1,1,2,3,2,5,2,164}, {1,1,1,2,3,3,5,1,119}, {1,1,1,3,3,1,5,2,159},
+	{1,1,1,3,3,2,5,1,114}, {1,1,1,4,3,1,5,1,109}, {1,2,1,1,3,1,5,3,185}, {1,2,1,1,3,2,5,2,140},
+	{1,2,1,1,3,3,5,1,95}, {1,2,1,2,3,1,5,2,135}, {1,2,1,2,3,2,5,1,90}, {1,2,1,3,3,1,5,1,85},
+	{1,3,1,1,3,1,5,2,111}, {1,3,1,1,3,2,5,1,66}, {1,3,1,2,3,1,5,1,61}, {1,4,1,1,3,1,5,1,37},
+	{1,1,1,1,4,1,4,4,33}, {1,1,1,1,4,2,4,3,199}, {1,1,1,1,4,3,4,2,154}, {1,1,1,1,4,4,4,1,109},
+	{1,1,1,2,4,1,4,3,194}, {1,1,1,2,4,2,4,2,149}, {1,1,1,2,4,3,4,1,104}, {1,1,1,3,4,1,4,2,144},
+	{1,1,1,3,4,2,4,1,99}, {1,1,1,4,4,1,4,1,94}, {1,2,1,1,4,1,4,3,170}, {1,2,1,1,4,2,4,2,125},
+	{1,2,1,1,4,3,4,1,80}, {1,2,1,2,4,1,4,2,120}, {1,2,1,2,4,2,4,1,75}, {1,2,1,3,4,1,4,1,70},
+	{1,3,1,1,4,1,4,2,96}, {1,3,1,1,4,2,4,1,51}, {1,3,1,2,4,1,4,1,46}, {1,4,1,1,4,1,4,1,22},
+	{1,1,1,1,5,1,3,4,18}, {1,1,1,1,5,2,3,3,184}, {1,1,1,1,5,3,3,2,139}, {1,1,1,1,5,4,3,1,94},
+	{1,1,1,2,5,1,3,3,179}, {1,1,1,2,5,2,3,2,134}, {1,1,1,2,5,3,3,1,89}, {1,1,1,3,5,1,3,2,129},
+	{1,1,1,3,5,2,3,1,84}, {1,1,1,4,5,1,3,1,79}, {1,2,1,1,5,1,3,3,155}, {1,2,1,1,5,2,3,2,110},
+	{1,2,1,1,5,3,3,1,65}, {1,2,1,2,5,1,3,2,105}, {1,2,1,2,5,2,3,1,60}, {1,2,1,3,5,1,3,1,55},
+	{1,3,1,1,5,1,3,2,81}, {1,3,1,1,5,2,3,1,36}, {1,3,1,2,5,1,3,1,31}, {1,4,1,1,5,1,3,1,7},
+	{1,1,2,1,2,1,5,4,187}, {1,1,2,1,2,2,5,3,142}, {1,1,2,1,2,3,5,2,97}, {1,1,2,1,2,4,5,1,52},
+	{1,1,2,2,2,1,5,3,137}, {1,1,2,2,2,2,5,2,92}, {1,1,2,2,2,3,5,1,47}, {1,1,2,3,2,1,5,2,87},
+	{1,1,2,3,2,2,5,1,42}, {1,1,2,4,2,1,5,1,37}, {1,2,2,1,2,1,5,3,113}, {1,2,2,1,2,2,5,2,68},
+	{1,2,2,1,2,3,5,1,23}, {1,2,2,2,2,1,5,2,63}, {1,2,2,2,2,2,5,1,18}, {1,2,2,3,2,1,5,1,13},
+	{1,3,2,1,2,1,5,2,39}, {1,3,2,1,2,2,5,1,205}, {1,3,2,2,2,1,5,1,200}, {1,4,2,1,2,1,5,1,176},
+	{1,1,2,1,3,1,4,4,172}, {1,1,2,1,3,2,4,3,127}, {1,1,2,1,3,3,4,2,82}, {1,1,2,1,3,4,4,1,37},
+	{1,1,2,2,3,1,4,3,122}, {1,1,2,2,3,2,4,2,77}, {1,1,2,2,3,3,4,1,32}, {1,1,2,3,3,1,4,2,72},
+	{1,1,2,3,3,2,4,1,27}, {1,1,2,4,3,1,4,1,22}, {1,2,2,1,3,1,4,3,98}, {1,2,2,1,3,2,4,2,53},
+	{1,2,2,1,3,3,4,1,8}, {1,2,2,2,3,1,4,2,48}, {1,2,2,2,3,2,4,1,3}, {1,2,2,3,3,1,4,1,209},
+	{1,3,2,1,3,1,4,2,24}, {1,3,2,1,3,2,4,1,190}, {1,3,2,2,3,1,4,1,185}, {1,4,2,1,3,1,4,1,161},
+	{1,1,2,1,4,1,3,4,157}, {1,1,2,1,4,2,3,3,112}, {1,1,2,1,4,3,3,2,67}, {1,1,2,1,4,4,3,1,22},
+	{1,1,2,2,4,1,3,3,107}, {1,1,2,2,4,2,3,2,62}, {1,1,2,2,4,3,3,1,17}, {1,1,2,3,4,1,3,2,57},
+	{1,1,2,3,4,2,3,1,12}, {1,1,2,4,4,1,3,1,7}, {1,2,2,1,4,1,3,3,83}, {1,2,2,1,4,2,3,2,38},
+	{1,2,2,1,4,3,3,1,204}, {1,2,2,2,4,1,3,2,33}, {1,2,2,2,4,2,3,1,199}, {1,2,2,3,4,1,3,1,194},
+	{1,3,2,1,4,1,3,2,9}, {1,3,2,1,4,2,3,1,175}, {1,3,2,2,4,1,3,1,170}, {1,4,2,1,4,1,3,1,146},
+	{1,1,2,1,5,1,2,4,142}, {1,1,2,1,5,2,2,3,97}, {1,1,2,1,5,3,2,2,52}, {1,1,2,1,5,4,2,1,7},
+	{1,1,2,2,5,1,2,3,92}, {1,1,2,2,5,2,2,2,47}, {1,1,2,2,5,3,2,1,2}, {1,1,2,3,5,1,2,2,42},
+	{1,1,2,3,5,2,2,1,208}, {1,1,2,4,5,1,2,1,203}, {1,2,2,1,5,1,2,3,68}, {1,2,2,1,5,2,2,2,23},
+	{1,2,2,1,5,3,2,1,189}, {1,2,2,2,5,1,2,2,18}, {1,2,2,2,5,2,2,1,184}, {1,2,2,3,5,1,2,1,179},
+	{1,3,2,1,5,1,2,2,205}, {1,3,2,1,5,2,2,1,160}, {1,3,2,2,5,1,2,1,155}, {1,4,2,1,5,1,2,1,131},
+	{1,1,3,1,1,1,5,4,115}, {1,1,3,1,1,2,5,3,70}, {1,1,3,1,1,3,5,2,25}, {1,1,3,1,1,4,5,1,191},
+	{1,1,3,2,1,1,5,3,65}, {1,1,3,2,1,2,5,2,20}, {1,1,3,2,1,3,5,1,186}, {1,1,3,3,1,1,5,2,15},
+	{1,1,3,3,1,2,5,1,181}, {1,1,3,4,1,1,5,1,176}, {1,2,3,1,1,1,5,3,41}, {1,2,3,1,1,2,5,2,207},
+	{1,2,3,1,1,3,5,1,162}, {1,2,3,2,1,1,5,2,202}, {1,2,3,2,1,2,5,1,157}, {1,2,3,3,1,1,5,1,152},
+	{1,3,3,1,1,1,5,2,178}, {1,3,3,1,1,2,5,1,133}, {1,3,3,2,1,1,5,1,128}, {1,4,3,1,1,1,5,1,104},
+	{1,1,3,1,2,1,4,4,100}, {1,1,3,1,2,2,4,3,55}, {1,1,3,1,2,3,4,2,10}, {1,1,3,1,2,4,4,1,176},
+	{1,1,3,2,2,1,4,3,50}, {1,1,3,2,2,2,4,2,5}, {1,1,3,2,2,3,4,1,171}, {1,1,3,3,2,1,4,2,0},
+	{1,1,3,3,2,2,4,1,166}, {1,1,3,4,2,1,4,1,161}, {1,2,3,1,2,1,4,3,26}, {1,2,3,1,2,2,4,2,192},
+	{1,2,3,1,2,3,4,1,147}, {1,2,3,2,2,1,4,2,187}, {1,2,3,2,2,2,4,1,142}, {1,2,3,3,2,1,4,1,137},
+	{1,3,3,1,2,1,4,2,163}, {1,3,3,1,2,2,4,1,118}, {1,3,3,2,2,1,4,1,113}, {1,4,3,1,2,1,4,1,89},
+	{1,1,3,1,3,1,3,4,85}, {1,1,3,1,3,2,3,3,40}, {1,1,3,1,3,3,3,2,206}, {1,1,3,1,3,4,3,1,161},
+	{1,1,3,2,3,1,3,3,35}, {1,1,3,2,3,2,3,2,201}, {1,1,3,2,3,3,3,1,156}, {1,1,3,3,3,1,3,2,196},
+	{1,1,3,3,3,2,3,1,151}, {1,1,3,4,3,1,3,1,146}, {1,2,3,1,3,1,3,3,11}, {1,2,3,1,3,2,3,2,177},
+	{1,2,3,1,3,3,3,1,132}, {1,2,3,2,3,1,3,2,172}, {1,2,3,2,3,2,3,1,127}, {1,2,3,3,3,1,3,1,122},
+	{1,3,3,1,3,1,3,2,148}, {1,3,3,1,3,2,3,1,103}, {1,3,3,2,3,1,3,1,98}, {1,4,3,1,3,1,3,1,74},
+	{1,1,3,1,4,1,2,4,70}, {1,1,3,1,4,2,2,3,25}, {1,1,3,1,4,3,2,2,191}, {1,1,3,1,4,4,2,1,146},
+	{1,1,3,2,4,1,2,3,20}, {1,1,3,2,4,2,2,2,186}, {1,1,3,2,4,3,2,1,141}, {1,1,3,3,4,1,2,2,181},
+	{1,1,3,3,4,2,2,1,136}, {1,1,3,4,4,1,2,1,131}, {1,2,3,1,4,1,2,3,207}, {1,2,3,1,4,2,2,2,162},
+	{1,2,3,1,4,3,2,1,117}, {1,2,3,2,4,1,2,2,157}, {1,2,3,2,4,2,2,1,112}, {1,2,3,3,4,1,2,1,107},
+	{1,3,3,1,4,1,2,2,133}, {1,3,3,1,4,2,2,1,88}, {1,3,3,2,4,1,2,1,83}, {1,4,3,1,4,1,2,1,59},
+	{1,1,3,1,5,1,1,4,55}, {1,1,3,1,5,2,1,3,10}, {1,1,3,1,5,3,1,2,176}, {1,1,3,1,5,4,1,1,131},
+	{1,1,3,2,5,1,1,3,5}, {1,1,3,2,5,2,1,2,171}, {1,1,3,2,5,3,1,1,126}, {1,1,3,3,5,1,1,2,166},
+	{1,1,3,3,5,2,1,1,121}, {1,1,3,4,5,1,1,1,116}, {1,2,3,1,5,1,1,3,192}, {1,2,3,1,5,2,1,2,147},
+	{1,2,3,1,5,3,1,1,102}, {1,2,3,2,5,1,1,2,142}, {1,2,3,2,5,2,1,1,97}, {1,2,3,3,5,1,1,1,92},
+	{1,3,3,1,5,1,1,2,118}, {1,3,3,1,5,2,1,1,73}, {1,3,3,2,5,1,1,1,68}, {1,4,3,1,5,1,1,1,44},
+	{1,1,4,1,1,1,4,4,28}, {1,1,4,1,1,2,4,3,194}, {1,1,4,1,1,3,4,2,149}, {1,1,4,1,1,4,4,1,104},
+	{1,1,4,2,1,1,4,3,189}, {1,1,4,2,1,2,4,2,144}, {1,1,4,2,1,3,4,1,99}, {1,1,4,3,1,1,4,2,139},
+	{1,1,4,3,1,2,4,1,94}, {1,1,4,4,1,1,4,1,89}, {1,2,4,1,1,1,4,3,165}, {1,2,4,1,1,2,4,2,120},
+	{1,2,4,1,1,3,4,1,75}, {1,2,4,2,1,1,4,2,115}, {1,2,4,2,1,2,4,1,70}, {1,2,4,3,1,1,4,1,65},
+	{1,3,4,1,1,1,4,2,91}, {1,3,4,1,1,2,4,1,46}, {1,3,4,2,1,1,4,1,41}, {1,4,4,1,1,1,4,1,17},
+	{1,1,4,1,2,1,3,4,13}, {1,1,4,1,2,2,3,3,179}, {1,1,4,1,2,3,3,2,134}, {1,1,4,1,2,4,3,1,89},
+	{1,1,4,2,2,1,3,3,174}, {1,1,4,2,2,2,3,2,129}, {1,1,4,2,2,3,3,1,84}, {1,1,4,3,2,1,3,2,124},
+	{1,1,4,3,2,2,3,1,79}, {1,1,4,4,2,1,3,1,74}, {1,2,4,1,2,1,3,3,150}, {1,2,4,1,2,2,3,2,105},
+	{1,2,4,1,2,3,3,1,60}, {1,2,4,2,2,1,3,2,100}, {1,2,4,2,2,2,3,1,55}, {1,2,4,3,2,1,3,1,50},
+	{1,3,4,1,2,1,3,2,76}, {1,3,4,1,2,2,3,1,31}, {1,3,4,2,2,1,3,1,26}, {1,4,4,1,2,1,3,1,2},
+	{1,1,4,1,3,1,2,4,209}, {1,1,4,1,3,2,2,3,164}, {1,1,4,1,3,3,2,2,119}, {1,1,4,1,3,4,2,1,74},
+	{1,1,4,2,3,1,2,3,159}, {1,1,4,2,3,2,2,2,114}, {1,1,4,2,3,3,2,1,69}, {1,1,4,3,3,1,2,2,109},
+	{1,1,4,3,3,2,2,1,64}, {1,1,4,4,3,1,2,1,59}, {1,2,4,1,3,1,2,3,135}, {1,2,4,1,3,2,2,2,90},
+	{1,2,4,1,3,3,2,1,45}, {1,2,4,2,3,1,2,2,85}, {1,2,4,2,3,2,2,1,40}, {1,2,4,3,3,1,2,1,35},
+	{1,3,4,1,3,1,2,2,61}, {1,3,4,1,3,2,2,1,16}, {1,3,4,2,3,1,2,1,11}, {1,4,4,1,3,1,2,1,198},
+	{1,1,4,1,4,1,1,4,194}, {1,1,4,1,4,2,1,3,149}, {1,1,4,1,4,3,1,2,104}, {1,1,4,1,4,4,1,1,59},
+	{1,1,4,2,4,1,1,3,144}, {1,1,4,2,4,2,1,2,99}, {1,1,4,2,4,3,1,1,54}, {1,1,4,3,4,1,1,2,94},
+	{1,1,4,3,4,2,1,1,49}, {1,1,4,4,4,1,1,1,44}, {1,2,4,1,4,1,1,3,120}, {1,2,4,1,4,2,1,2,75},
+	{1,2,4,1,4,3,1,1,30}, {1,2,4,2,4,1,1,2,70}, {1,2,4,2,4,2,1,1,25}, {1,2,4,3,4,1,1,1,20},
+	{1,3,4,1,4,1,1,2,46}, {1,3,4,1,4,2,1,1,1}, {1,3,4,2,4,1,1,1,207}, {1,4,4,1,4,1,1,1,183},
+	{1,1,5,1,1,1,3,4,152}, {1,1,5,1,1,2,3,3,107}, {1,1,5,1,1,3,3,2,62}, {1,1,5,1,1,4,3,1,17},
+	{1,1,5,2,1,1,3,3,102}, {1,1,5,2,1,2,3,2,57}, {1,1,5,2,1,3,3,1,12}, {1,1,5,3,1,1,3,2,52},
+	{1,1,5,3,1,2,3,1,7}, {1,1,5,4,1,1,3,1,2}, {1,2,5,1,1,1,3,3,78}, {1,2,5,1,1,2,3,2,33},
+	{1,2,5,1,1,3,3,1,199}, {1,2,5,2,1,1,3,2,28}, {1,2,5,2,1,2,3,1,194}, {1,2,5,3,1,1,3,1,189},
+	{1,3,5,1,1,1,3,2,4}, {1,3,5,1,1,2,3,1,170}, {1,3,5,2,1,1,3,1,165}, {1,4,5,1,1,1,3,1,141},
+	{1,1,5,1,2,1,2,4,137}, {1,1,5,1,2,2,2,3,92}, {1,1,5,1,2,3,2,2,47}, {1,1,5,1,2,4,2,1,2},
+	{1,1,5,2,2,1,2,3,87}, {1,1,5,2,2,2,2,2,42}, {1,1,5,2,2,3,2,1,208}, {1,1,5,3,2,1,2,2,37},
+	{1,1,5,3,2,2,2,1,203}, {1,1,5,4,2,1,2,1,198}, {1,2,5,1,2,1,2,3,63}, {1,2,5,1,2,2,2,2,18},
+	{1,2,5,1,2,3,2,1,184}, {1,2,5,2,2,1,2,2,13}, {1,2,5,2,2,2,2,1,179}, {1,2,5,3,2,1,2,1,174},
+	{1,3,5,1,2,1,2,2,200}, {1,3,5,1,2,2,2,1,155}, {1,3,5,2,2,1,2,1,150}, {1,4,5,1,2,1,2,1,126},
+	{1,1,5,1,3,1,1,4,122}, {1,1,5,1,3,2,1,3,77}, {1,1,5,1,3,3,1,2,32}, {1,1,5,1,3,4,1,1,198},
+	{1,1,5,2,3,1,1,3,72}, {1,1,5,2,3,2,1,2,27}, {1,1,5,2,3,3,1,1,193}, {1,1,5,3,3,1,1,2,22},
+	{1,1,5,3,3,2,1,1,188}, {1,1,5,4,3,1,1,1,183}, {1,2,5,1,3,1,1,3,48}, {1,2,5,1,3,2,1,2,3},
+	{1,2,5,1,3,3,1,1,169}, {1,2,5,2,3,1,1,2,209}, {1,2,5,2,3,2,1,1,164}, {1,2,5,3,3,1,1,1,159},
+	{1,3,5,1,3,1,1,2,185}, {1,3,5,1,3,2,1,1,140}, {1,3,5,2,3,1,1,1,135}, {1,4,5,1,3,1,1,1,111},
+	{2,1,1,1,2,1,5,4,179}, {2,1,1,1,2,2,5,3,134}, {2,1,1,1,2,3,5,2,89}, {2,1,1,1,2,4,5,1,44},
+	{2,1,1,2,2,1,5,3,129}, {2,1,1,2,2,2,5,2,84}, {2,1,1,2,2,3,5,1,39}, {2,1,1,3,2,1,5,2,79},
+	{2,1,1,3,2,2,5,1,34}, {2,1,1,4,2,1,5,1,29}, {2,2,1,1,2,1,5,3,105}, {2,2,1,1,2,2,5,2,60},
+	{2,2,1,1,2,3,5,1,15}, {2,2,1,2,2,1,5,2,55}, {2,2,1,2,2,2,5,1,10}, {2,2,1,3,2,1,5,1,5},
+	{2,3,1,1,2,1,5,2,31}, {2,3,1,1,2,2,5,1,197}, {2,3,1,2,2,1,5,1,192}, {2,4,1,1,2,1,5,1,168},
+	{2,1,1,1,3,1,4,4,164}, {2,1,1,1,3,2,4,3,119}, {2,1,1,1,3,3,4,2,74}, {2,1,1,1,3,4,4,1,29},
+	{2,1,1,2,3,1,4,3,114}, {2,1,1,2,3,2,4,2,69}, {2,1,1,2,3,3,4,1,24}, {2,1,1,3,3,1,4,2,64},
+	{2,1,1,3,3,2,4,1,19}, {2,1,1,4,3,1,4,1,14}, {2,2,1,1,3,1,4,3,90}, {2,2,1,1,3,2,4,2,45},
+	{2,2,1,1,3,3,4,1,0}, {2,2,1,2,3,1,4,2,40}, {2,2,1,2,3,2,4,1,206}, {2,2,1,3,3,1,4,1,201},
+	{2,3,1,1,3,1,4,2,16}, {2,3,1,1,3,2,4,1,182}, {2,3,1,2,3,1,4,1,177}, {2,4,1,1,3,1,4,1,153},
+	{2,1,1,1,4,1,3,4,149}, {2,1,1,1,4,2,3,3,104}, {2,1,1,1,4,3,3,2,59}, {2,1,1,1,4,4,3,1,14},
+	{2,1,1,2,4,1,3,3,99}, {2,1,1,2,4,2,3,2,54}, {2,1,1,2,4,3,3,1,9}, {2,1,1,3,4,1,3,2,49},
+	{2,1,1,3,4,2,3,1,4}, {2,1,1,4,4,1,3,1,210}, {2,2,1,1,4,1,3,3,75}, {2,2,1,1,4,2,3,2,30},
+	{2,2,1,1,4,3,3,1,196}, {2,2,1,2,4,1,3,2,25}, {2,2,1,2,4,2,3,1,191}, {2,2,1,3,4,1,3,1,186},
+	{2,3,1,1,4,1,3,2,1}, {2,3,1,1,4,2,3,1,167}, {2,3,1,2,4,1,3,1,162}, {2,4,1,1,4,1,3,1,138},
+	{2,1,1,1,5,1,2,4,134}, {2,1,1,1,5,2,2,3,89}, {2,1,1,1,5,3,2,2,44}, {2,1,1,1,5,4,2,1,210},
+	{2,1,1,2,5,1,2,3,84}, {2,1,1,2,5,2,2,2,39}, {2,1,1,2,5,3,2,1,205}, {2,1,1,3,5,1,2,2,34},
+	{2,1,1,3,5,2,2,1,200}, {2,1,1,4,5,1,2,1,195}, {2,2,1,1,5,1,2,3,60}, {2,2,1,1,5,2,2,2,15},
+	{2,2,1,1,5,3,2,1,181}, {2,2,1,2,5,1,2,2,10}, {2,2,1,2,5,2,2,1,176}, {2,2,1,3,5,1,2,1,171},
+	{2,3,1,1,5,1,2,2,197}, {2,3,1,1,5,2,2,1,152}, {2,3,1,2,5,1,2,1,147}, {2,4,1,1,5,1,2,1,123},
+	{2,1,2,1,1,1,5,4,107}, {2,1,2,1,1,2,5,3,62}, {2,1,2,1,1,3,5,2,17}, {2,1,2,1,1,4,5,1,183},
+	{2,1,2,2,1,1,5,3,57}, {2,1,2,2,1,2,5,2,12}, {2,1,2,2,1,3,5,1,178}, {2,1,2,3,1,1,5,2,7},
+	{2,1,2,3,1,2,5,1,173}, {2,1,2,4,1,1,5,1,168}, {2,2,2,1,1,1,5,3,33}, {2,2,2,1,1,2,5,2,199},
+	{2,2,2,1,1,3,5,1,154}, {2,2,2,2,1,1,5,2,194}, {2,2,2,2,1,2,5,1,149}, {2,2,2,3,1,1,5,1,144},
+	{2,3,2,1,1,1,5,2,170}, {2,3,2,1,1,2,5,1,125}, {2,3,2,2,1,1,5,1,120}, {2,4,2,1,1,1,5,1,96},
+	{2,1,2,1,5,1,1,4,47}, {2,1,2,1,5,2,1,3,2}, {2,1,2,1,5,3,1,2,168}, {2,1,2,1,5,4,1,1,123},
+	{2,1,2,2,5,1,1,3,208}, {2,1,2,2,5,2,1,2,163}, {2,1,2,2,5,3,1,1,118}, {2,1,2,3,5,1,1,2,158},
+	{2,1,2,3,5,2,1,1,113}, {2,1,2,4,5,1,1,1,108}, {2,2,2,1,5,1,1,3,184}, {2,2,2,1,5,2,1,2,139},
+	{2,2,2,1,5,3,1,1,94}, {2,2,2,2,5,1,1,2,134}, {2,2,2,2,5,2,1,1,89}, {2,2,2,3,5,1,1,1,84},
+	{2,3,2,1,5,1,1,2,110}, {2,3,2,1,5,2,1,1,65}, {2,3,2,2,5,1,1,1,60}, {2,4,2,1,5,1,1,1,36},
+	{2,1,3,1,1,1,4,4,20}, {2,1,3,1,1,2,4,3,186}, {2,1,3,1,1,3,4,2,141}, {2,1,3,1,1,4,4,1,96},
+	{2,1,3,2,1,1,4,3,181}, {2,1,3,2,1,2,4,2,136}, {2,1,3,2,1,3,4,1,91}, {2,1,3,3,1,1,4,2,131},
+	{2,1,3,3,1,2,4,1,86}, {2,1,3,4,1,1,4,1,81}, {2,2,3,1,1,1,4,3,157}, {2,2,3,1,1,2,4,2,112},
+	{2,2,3,1,1,3,4,1,67}, {2,2,3,2,1,1,4,2,107}, {2,2,3,2,1,2,4,1,62}, {2,2,3,3,1,1,4,1,57},
+	{2,3,3,1,1,1,4,2,83}, {2,3,3,1,1,2,4,1,38}, {2,3,3,2,1,1,4,1,33}, {2,4,3,1,1,1,4,1,9},
+	{2,1,3,1,4,1,1,4,186}, {2,1,3,1,4,2,1,3,141}, {2,1,3,1,4,3,1,2,96}, {2,1,3,1,4,4,1,1,51},
+	{2,1,3,2,4,1,1,3,136}, {2,1,3,2,4,2,1,2,91}, {2,1,3,2,4,3,1,1,46}, {2,1,3,3,4,1,1,2,86},
+	{2,1,3,3,4,2,1,1,41}, {2,1,3,4,4,1,1,1,36}, {2,2,3,1,4,1,1,3,112}, {2,2,3,1,4,2,1,2,67},
+	{2,2,3,1,4,3,1,1,22}, {2,2,3,2,4,1,1,2,62}, {2,2,3,2,4,2,1,1,17}, {2,2,3,3,4,1,1,1,12},
+	{2,3,3,1,4,1,1,2,38}, {2,3,3,1,4,2,1,1,204}, {2,3,3,2,4,1,1,1,199}, {2,4,3,1,4,1,1,1,175},
+	{2,1,4,1,1,1,3,4,144}, {2,1,4,1,1,2,3,3,99}, {2,1,4,1,1,3,3,2,54}, {2,1,4,1,1,4,3,1,9},
+	{2,1,4,2,1,1,3,3,94}, {2,1,4,2,1,2,3,2,49}, {2,1,4,2,1,3,3,1,4}, {2,1,4,3,1,1,3,2,44},
+	{2,1,4,3,1,2,3,1,210}, {2,1,4,4,1,1,3,1,205}, {2,2,4,1,1,1,3,3,70}, {2,2,4,1,1,2,3,2,25},
+	{2,2,4,1,1,3,3,1,191}, {2,2,4,2,1,1,3,2,20}, {2,2,4,2,1,2,3,1,186}, {2,2,4,3,1,1,3,1,181},
+	{2,3,4,1,1,1,3,2,207}, {2,3,4,1,1,2,3,1,162}, {2,3,4,2,1,1,3,1,157}, {2,4,4,1,1,1,3,1,133},
+	{2,1,4,1,3,1,1,4,114}, {2,1,4,1,3,2,1,3,69}, {2,1,4,1,3,3,1,2,24}, {2,1,4,1,3,4,1,1,190},
+	{2,1,4,2,3,1,1,3,64}, {2,1,4,2,3,2,1,2,19}, {2,1,4,2,3,3,1,1,185}, {2,1,4,3,3,1,1,2,14},
+	{2,1,4,3,3,2,1,1,180}, {2,1,4,4,3,1,1,1,175}, {2,2,4,1,3,1,1,3,40}, {2,2,4,1,3,2,1,2,206},
+	{2,2,4,1,3,3,1,1,161}, {2,2,4,2,3,1,1,2,201}, {2,2,4,2,3,2,1,1,156}, {2,2,4,3,3,1,1,1,151},
+	{2,3,4,1,3,1,1,2,177}, {2,3,4,1,3,2,1,1,132}, {2,3,4,2,3,1,1,1,127}, {2,4,4,1,3,1,1,1,103},
+	{2,1,5,1,1,1,2,4,57}, {2,1,5,1,1,2,2,3,12}, {2,1,5,1,1,3,2,2,178}, {2,1,5,1,1,4,2,1,133},
+	{2,1,5,2,1,1,2,3,7}, {2,1,5,2,1,2,2,2,173}, {2,1,5,2,1,3,2,1,128}, {2,1,5,3,1,1,2,2,168},
+	{2,1,5,3,1,2,2,1,123}, {2,1,5,4,1,1,2,1,118}, {2,2,5,1,1,1,2,3,194}, {2,2,5,1,1,2,2,2,149},
+	{2,2,5,1,1,3,2,1,104}, {2,2,5,2,1,1,2,2,144}, {2,2,5,2,1,2,2,1,99}, {2,2,5,3,1,1,2,1,94},
+	{2,3,5,1,1,1,2,2,120}, {2,3,5,1,1,2,2,1,75}, {2,3,5,2,1,1,2,1,70}, {2,4,5,1,1,1,2,1,46},
+	{2,1,5,1,2,1,1,4,42}, {2,1,5,1,2,2,1,3,208}, {2,1,5,1,2,3,1,2,163}, {2,1,5,1,2,4,1,1,118},
+	{2,1,5,2,2,1,1,3,203}, {2,1,5,2,2,2,1,2,158}, {2,1,5,2,2,3,1,1,113}, {2,1,5,3,2,1,1,2,153},
+	{2,1,5,3,2,2,1,1,108}, {2,1,5,4,2,1,1,1,103}, {2,2,5,1,2,1,1,3,179}, {2,2,5,1,2,2,1,2,134},
+	{2,2,5,1,2,3,1,1,89}, {2,2,5,2,2,1,1,2,129}, {2,2,5,2,2,2,1,1,84}, {2,2,5,3,2,1,1,1,79},
+	{2,3,5,1,2,1,1,2,105}, {2,3,5,1,2,2,1,1,60}, {2,3,5,2,2,1,1,1,55}, {2,4,5,1,2,1,1,1,31},
+	{3,1,1,1,1,1,5,4,99}, {3,1,1,1,1,2,5,3,54}, {3,1,1,1,1,3,5,2,9}, {3,1,1,1,1,4,5,1,175},
+	{3,1,1,2,1,1,5,3,49}, {3,1,1,2,1,2,5,2,4}, {3,1,1,2,1,3,5,1,170}, {3,1,1,3,1,1,5,2,210},
+	{3,1,1,3,1,2,5,1,165}, {3,1,1,4,1,1,5,1,160}, {3,2,1,1,1,1,5,3,25}, {3,2,1,1,1,2,5,2,191},
+	{3,2,1,1,1,3,5,1,146}, {3,2,1,2,1,1,5,2,186}, {3,2,1,2,1,2,5,1,141}, {3,2,1,3,1,1,5,1,136},
+	{3,3,1,1,1,1,5,2,162}, {3,3,1,1,1,2,5,1,117}, {3,3,1,2,1,1,5,1,112}, {3,4,1,1,1,1,5,1,88},
+	{3,1,1,1,2,1,4,4,84}, {3,1,1,1,2,2,4,3,39}, {3,1,1,1,2,3,4,2,205}, {3,1,1,1,2,4,4,1,160},
+	{3,1,1,2,2,1,4,3,34}, {3,1,1,2,2,2,4,2,200}, {3,1,1,2,2,3,4,1,155}, {3,1,1,3,2,1,4,2,195},
+	{3,1,1,3,2,2,4,1,150}, {3,1,1,4,2,1,4,1,145}, {3,2,1,1,2,1,4,3,10}, {3,2,1,1,2,2,4,2,176},
+	{3,2,1,1,2,3,4,1,131}, {3,2,1,2,2,1,4,2,171}, {3,2,1,2,2,2,4,1,126}, {3,2,1,3,2,1,4,1,121},
+	{3,3,1,1,2,1,4,2,147}, {3,3,1,1,2,2,4,1,102}, {3,3,1,2,2,1,4,1,97}, {3,4,1,1,2,1,4,1,73},
+	{3,1,1,1,3,1,3,4,69}, {3,1,1,1,3,2,3,3,24}, {3,1,1,1,3,3,3,2,190}, {3,1,1,1,3,4,3,1,145},
+	{3,1,1,2,3,1,3,3,19}, {3,1,1,2,3,2,3,2,185}, {3,1,1,2,3,3,3,1,140}, {3,1,1,3,3,1,3,2,180},
+	{3,1,1,3,3,2,3,1,135}, {3,1,1,4,3,1,3,1,130}, {3,2,1,1,3,1,3,3,206}, {3,2,1,1,3,2,3,2,161},
+	{3,2,1,1,3,3,3,1,116}, {3,2,1,2,3,1,3,2,156}, {3,2,1,2,3,2,3,1,111}, {3,2,1,3,3,1,3,1,106},
+	{3,3,1,1,3,1,3,2,132}, {3,3,1,1,3,2,3,1,87}, {3,3,1,2,3,1,3,1,82}, {3,4,1,1,3,1,3,1,58},
+	{3,1,1,1,4,1,2,4,54}, {3,1,1,1,4,2,2,3,9}, {3,1,1,1,4,3,2,2,175}, {3,1,1,1,4,4,2,1,130},
+	{3,1,1,2,4,1,2,3,4}, {3,1,1,2,4,2,2,2,170}, {3,1,1,2,4,3,2,1,125}, {3,1,1,3,4,1,2,2,165},
+	{3,1,1,3,4,2,2,1,120}, {3,1,1,4,4,1,2,1,115}, {3,2,1,1,4,1,2,3,191}, {3,2,1,1,4,2,2,2,146},
+	{3,2,1,1,4,3,2,1,101}, {3,2,1,2,4,1,2,2,141}, {3,2,1,2,4,2,2,1,96}, {3,2,1,3,4,1,2,1,91},
+	{3,3,1,1,4,1,2,2,117}, {3,3,1,1,4,2,2,1,72}, {3,3,1,2,4,1,2,1,67}, {3,4,1,1,4,1,2,1,43},
+	{3,1,1,1,5,1,1,4,39}, {3,1,1,1,5,2,1,3,205}, {3,1,1,1,5,3,1,2,160}, {3,1,1,1,5,4,1,1,115},
+	{3,1,1,2,5,1,1,3,200}, {3,1,1,2,5,2,1,2,155}, {3,1,1,2,5,3,1,1,110}, {3,1,1,3,5,1,1,2,150},
+	{3,1,1,3,5,2,1,1,105}, {3,1,1,4,5,1,1,1,100}, {3,2,1,1,5,1,1,3,176}, {3,2,1,1,5,2,1,2,131},
+	{3,2,1,1,5,3,1,1,86}, {3,2,1,2,5,1,1,2,126}, {3,2,1,2,5,2,1,1,81}, {3,2,1,3,5,1,1,1,76},
+	{3,3,1,1,5,1,1,2,102}, {3,3,1,1,5,2,1,1,57}, {3,3,1,2,5,1,1,1,52}, {3,4,1,1,5,1,1,1,28},
+	{3,1,2,1,1,1,4,4,12}, {3,1,2,1,1,2,4,3,178}, {3,1,2,1,1,3,4,2,133}, {3,1,2,1,1,4,4,1,88},
+	{3,1,2,2,1,1,4,3,173}, {3,1,2,2,1,2,4,2,128}, {3,1,2,2,1,3,4,1,83}, {3,1,2,3,1,1,4,2,123},
+	{3,1,2,3,1,2,4,1,78}, {3,1,2,4,1,1,4,1,73}, {3,2,2,1,1,1,4,3,149}, {3,2,2,1,1,2,4,2,104},
+	{3,2,2,1,1,3,4,1,59}, {3,2,2,2,1,1,4,2,99}, {3,2,2,2,1,2,4,1,54}, {3,2,2,3,1,1,4,1,49},
+	{3,3,2,1,1,1,4,2,75}, {3,3,2,1,1,2,4,1,30}, {3,3,2,2,1,1,4,1,25}, {3,4,2,1,1,1,4,1,1},
+	{3,1,2,1,4,1,1,4,178}, {3,1,2,1,4,2,1,3,133}, {3,1,2,1,4,3,1,2,88}, {3,1,2,1,4,4,1,1,43},
+	{3,1,2,2,4,1,1,3,128}, {3,1,2,2,4,2,1,2,83}, {3,1,2,2,4,3,1,1,38}, {3,1,2,3,4,1,1,2,78},
+	{3,1,2,3,4,2,1,1,33}, {3,1,2,4,4,1,1,1,28}, {3,2,2,1,4,1,1,3,104}, {3,2,2,1,4,2,1,2,59},
+	{3,2,2,1,4,3,1,1,14}, {3,2,2,2,4,1,1,2,54}, {3,2,2,2,4,2,1,1,9}, {3,2,2,3,4,1,1,1,4},
+	{3,3,2,1,4,1,1,2,30}, {3,3,2,1,4,2,1,1,196}, {3,3,2,2,4,1,1,1,191}, {3,4,2,1,4,1,1,1,167},
+	{3,1,3,1,1,1,3,4,136}, {3,1,3,1,1,2,3,3,91}, {3,1,3,1,1,3,3,2,46}, {3,1,3,1,1,4,3,1,1},
+	{3,1,3,2,1,1,3,3,86}, {3,1,3,2,1,2,3,2,41}, {3,1,3,2,1,3,3,1,207}, {3,1,3,3,1,1,3,2,36},
+	{3,1,3,3,1,2,3,1,202}, {3,1,3,4,1,1,3,1,197}, {3,2,3,1,1,1,3,3,62}, {3,2,3,1,1,2,3,2,17},
+	{3,2,3,1,1,3,3,1,183}, {3,2,3,2,1,1,3,2,12}, {3,2,3,2,1,2,3,1,178}, {3,2,3,3,1,1,3,1,173},
+	{3,3,3,1,1,1,3,2,199}, {3,3,3,1,1,2,3,1,154}, {3,3,3,2,1,1,3,1,149}, {3,4,3,1,1,1,3,1,125},
+	{3,1,3,1,3,1,1,4,106}, {3,1,3,1,3,2,1,3,61}, {3,1,3,1,3,3,1,2,16}, {3,1,3,1,3,4,1,1,182},
+	{3,1,3,2,3,1,1,3,56}, {3,1,3,2,3,2,1,2,11}, {3,1,3,2,3,3,1,1,177}, {3,1,3,3,3,1,1,2,6},
+	{3,1,3,3,3,2,1,1,172}, {3,1,3,4,3,1,1,1,167}, {3,2,3,1,3,1,1,3,32}, {3,2,3,1,3,2,1,2,198},
+	{3,2,3,1,3,3,1,1,153}, {3,2,3,2,3,1,1,2,193}, {3,2,3,2,3,2,1,1,148}, {3,2,3,3,3,1,1,1,143},
+	{3,3,3,1,3,1,1,2,169}, {3,3,3,1,3,2,1,1,124}, {3,3,3,2,3,1,1,1,119}, {3,4,3,1,3,1,1,1,95},
+	{3,1,4,1,1,1,2,4,49}, {3,1,4,1,1,2,2,3,4}, {3,1,4,1,1,3,2,2,170}, {3,1,4,1,1,4,2,1,125},
+	{3,1,4,2,1,1,2,3,210}, {3,1,4,2,1,2,2,2,165}, {3,1,4,2,1,3,2,1,120}, {3,1,4,3,1,1,2,2,160},
+	{3,1,4,3,1,2,2,1,115}, {3,1,4,4,1,1,2,1,110}, {3,2,4,1,1,1,2,3,186}, {3,2,4,1,1,2,2,2,141},
+	{3,2,4,1,1,3,2,1,96}, {3,2,4,2,1,1,2,2,136}, {3,2,4,2,1,2,2,1,91}, {3,2,4,3,1,1,2,1,86},
+	{3,3,4,1,1,1,2,2,112}, {3,3,4,1,1,2,2,1,67}, {3,3,4,2,1,1,2,1,62}, {3,4,4,1,1,1,2,1,38},
+	{3,1,4,1,2,1,1,4,34}, {3,1,4,1,2,2,1,3,200}, {3,1,4,1,2,3,1,2,155}, {3,1,4,1,2,4,1,1,110},
+	{3,1,4,2,2,1,1,3,195}, {3,1,4,2,2,2,1,2,150}, {3,1,4,2,2,3,1,1,105}, {3,1,4,3,2,1,1,2,145},
+	{3,1,4,3,2,2,1,1,100}, {3,1,4,4,2,1,1,1,95}, {3,2,4,1,2,1,1,3,171}, {3,2,4,1,2,2,1,2,126},
+	{3,2,4,1,2,3,1,1,81}, {3,2,4,2,2,1,1,2,121}, {3,2,4,2,2,2,1,1,76}, {3,2,4,3,2,1,1,1,71},
+	{3,3,4,1,2,1,1,2,97}, {3,3,4,1,2,2,1,1,52}, {3,3,4,2,2,1,1,1,47}, {3,4,4,1,2,1,1,1,23},
+	{3,1,5,1,1,1,1,4,173}, {3,1,5,1,1,2,1,3,128}, {3,1,5,1,1,3,1,2,83}, {3,1,5,1,1,4,1,1,38},
+	{3,1,5,2,1,1,1,3,123}, {3,1,5,2,1,2,1,2,78}, {3,1,5,2,1,3,1,1,33}, {3,1,5,3,1,1,1,2,73},
+	{3,1,5,3,1,2,1,1,28}, {3,1,5,4,1,1,1,1,23}, {3,2,5,1,1,1,1,3,99}, {3,2,5,1,1,2,1,2,54},
+	{3,2,5,1,1,3,1,1,9}, {3,2,5,2,1,1,1,2,49}, {3,2,5,2,1,2,1,1,4}, {3,2,5,3,1,1,1,1,210},
+	{3,3,5,1,1,1,1,2,25}, {3,3,5,1,1,2,1,1,191}, {3,3,5,2,1,1,1,1,186}, {3,4,5,1,1,1,1,1,162},
+	{4,1,1,1,1,1,4,4,4}, {4,1,1,1,1,2,4,3,170}, {4,1,1,1,1,3,4,2,125}, {4,1,1,1,1,4,4,1,80},
+	{4,1,1,2,1,1,4,3,165}, {4,1,1,2,1,2,4,2,120}, {4,1,1,2,1,3,4,1,75}, {4,1,1,3,1,1,4,2,115},
+	{4,1,1,3,1,2,4,1,70}, {4,1,1,4,1,1,4,1,65}, {4,2,1,1,1,1,4,3,141}, {4,2,1,1,1,2,4,2,96},
+	{4,2,1,1,1,3,4,1,51}, {4,2,1,2,1,1,4,2,91}, {4,2,1,2,1,2,4,1,46}, {4,2,1,3,1,1,4,1,41},
+	{4,3,1,1,1,1,4,2,67}, {4,3,1,1,1,2,4,1,22}, {4,3,1,2,1,1,4,1,17}, {4,4,1,1,1,1,4,1,204},
+	{4,1,1,1,2,1,3,4,200}, {4,1,1,1,2,2,3,3,155}, {4,1,1,1,2,3,3,2,110}, {4,1,1,1,2,4,3,1,65},
+	{4,1,1,2,2,1,3,3,150}, {4,1,1,2,2,2,3,2,105}, {4,1,1,2,2,3,3,1,60}, {4,1,1,3,2,1,3,2,100},
+	{4,1,1,3,2,2,3,1,55}, {4,1,1,4,2,1,3,1,50}, {4,2,1,1,2,1,3,3,126}, {4,2,1,1,2,2,3,2,81},
+	{4,2,1,1,2,3,3,1,36}, {4,2,1,2,2,1,3,2,76}, {4,2,1,2,2,2,3,1,31}, {4,2,1,3,2,1,3,1,26},
+	{4,3,1,1,2,1,3,2,52}, {4,3,1,1,2,2,3,1,7}, {4,3,1,2,2,1,3,1,2}, {4,4,1,1,2,1,3,1,189},
+	{4,1,1,1,3,1,2,4,185}, {4,1,1,1,3,2,2,3,140}, {4,1,1,1,3,3,2,2,95}, {4,1,1,1,3,4,2,1,50},
+	{4,1,1,2,3,1,2,3,135}, {4,1,1,2,3,2,2,2,90}, {4,1,1,2,3,3,2,1,45}, {4,1,1,3,3,1,2,2,85},
+	{4,1,1,3,3,2,2,1,40}, {4,1,1,4,3,1,2,1,35}, {4,2,1,1,3,1,2,3,111}, {4,2,1,1,3,2,2,2,66},
+	{4,2,1,1,3,3,2,1,21}, {4,2,1,2,3,1,2,2,61}, {4,2,1,2,3,2,2,1,16}, {4,2,1,3,3,1,2,1,11},
+	{4,3,1,1,3,1,2,2,37}, {4,3,1,1,3,2,2,1,203}, {4,3,1,2,3,1,2,1,198}, {4,4,1,1,3,1,2,1,174},
+	{4,1,1,1,4,1,1,4,170}, {4,1,1,1,4,2,1,3,125}, {4,1,1,1,4,3,1,2,80}, {4,1,1,1,4,4,1,1,35},
+	{4,1,1,2,4,1,1,3,120}, {4,1,1,2,4,2,1,2,75}, {4,1,1,2,4,3,1,1,30}, {4,1,1,3,4,1,1,2,70},
+	{4,1,1,3,4,2,1,1,25}, {4,1,1,4,4,1,1,1,20}, {4,2,1,1,4,1,1,3,96}, {4,2,1,1,4,2,1,2,51},
+	{4,2,1,1,4,3,1,1,6}, {4,2,1,2,4,1,1,2,46}, {4,2,1,2,4,2,1,1,1}, {4,2,1,3,4,1,1,1,207},
+	{4,3,1,1,4,1,1,2,22}, {4,3,1,1,4,2,1,1,188}, {4,3,1,2,4,1,1,1,183}, {4,4,1,1,4,1,1,1,159},
+	{4,1,2,1,1,1,3,4,128}, {4,1,2,1,1,2,3,3,83}, {4,1,2,1,1,3,3,2,38}, {4,1,2,1,1,4,3,1,204},
+	{4,1,2,2,1,1,3,3,78}, {4,1,2,2,1,2,3,2,33}, {4,1,2,2,1,3,3,1,199}, {4,1,2,3,1,1,3,2,28},
+	{4,1,2,3,1,2,3,1,194}, {4,1,2,4,1,1,3,1,189}, {4,2,2,1,1,1,3,3,54}, {4,2,2,1,1,2,3,2,9},
+	{4,2,2,1,1,3,3,1,175}, {4,2,2,2,1,1,3,2,4}, {4,2,2,2,1,2,3,1,170}, {4,2,2,3,1,1,3,1,165},
+	{4,3,2,1,1,1,3,2,191}, {4,3,2,1,1,2,3,1,146}, {4,3,2,2,1,1,3,1,141}, {4,4,2,1,1,1,3,1,117},
+	{4,1,2,1,3,1,1,4,98}, {4,1,2,1,3,2,1,3,53}, {4,1,2,1,3,3,1,2,8}, {4,1,2,1,3,4,1,1,174},
+	{4,1,2,2,3,1,1,3,48}, {4,1,2,2,3,2,1,2,3}, {4,1,2,2,3,3,1,1,169}, {4,1,2,3,3,1,1,2,209},
+	{4,1,2,3,3,2,1,1,164}, {4,1,2,4,3,1,1,1,159}, {4,2,2,1,3,1,1,3,24}, {4,2,2,1,3,2,1,2,190},
+	{4,2,2,1,3,3,1,1,145}, {4,2,2,2,3,1,1,2,185}, {4,2,2,2,3,2,1,1,140}, {4,2,2,3,3,1,1,1,135},
+	{4,3,2,1,3,1,1,2,161}, {4,3,2,1,3,2,1,1,116}, {4,3,2,2,3,1,1,1,111}, {4,4,2,1,3,1,1,1,87},
+	{4,1,3,1,1,1,2,4,41}, {4,1,3,1,1,2,2,3,207}, {4,1,3,1,1,3,2,2,162}, {4,1,3,1,1,4,2,1,117},
+	{4,1,3,2,1,1,2,3,202}, {4,1,3,2,1,2,2,2,157}, {4,1,3,2,1,3,2,1,112}, {4,1,3,3,1,1,2,2,152},
+	{4,1,3,3,1,2,2,1,107}, {4,1,3,4,1,1,2,1,102}, {4,2,3,1,1,1,2,3,178}, {4,2,3,1,1,2,2,2,133},
+	{4,2,3,1,1,3,2,1,88}, {4,2,3,2,1,1,2,2,128}, {4,2,3,2,1,2,2,1,83}, {4,2,3,3,1,1,2,1,78},
+	{4,3,3,1,1,1,2,2,104}, {4,3,3,1,1,2,2,1,59}, {4,3,3,2,1,1,2,1,54}, {4,4,3,1,1,1,2,1,30},
+	{4,1,3,1,2,1,1,4,26}, {4,1,3,1,2,2,1,3,192}, {4,1,3,1,2,3,1,2,147}, {4,1,3,1,2,4,1,1,102},
+	{4,1,3,2,2,1,1,3,187}, {4,1,3,2,2,2,1,2,142}, {4,1,3,2,2,3,1,1,97}, {4,1,3,3,2,1,1,2,137},
+	{4,1,3,3,2,2,1,1,92}, {4,1,3,4,2,1,1,1,87}, {4,2,3,1,2,1,1,3,163}, {4,2,3,1,2,2,1,2,118},
+	{4,2,3,1,2,3,1,1,73}, {4,2,3,2,2,1,1,2,113}, {4,2,3,2,2,2,1,1,68}, {4,2,3,3,2,1,1,1,63},
+	{4,3,3,1,2,1,1,2,89}, {4,3,3,1,2,2,1,1,44}, {4,3,3,2,2,1,1,1,39}, {4,4,3,1,2,1,1,1,15},
+	{4,1,4,1,1,1,1,4,165}, {4,1,4,1,1,2,1,3,120}, {4,1,4,1,1,3,1,2,75}, {4,1,4,1,1,4,1,1,30},
+	{4,1,4,2,1,1,1,3,115}, {4,1,4,2,1,2,1,2,70}, {4,1,4,2,1,3,1,1,25}, {4,1,4,3,1,1,1,2,65},
+	{4,1,4,3,1,2,1,1,20}, {4,1,4,4,1,1,1,1,15}, {4,2,4,1,1,1,1,3,91}, {4,2,4,1,1,2,1,2,46},
+	{4,2,4,1,1,3,1,1,1}, {4,2,4,2,1,1,1,2,41}, {4,2,4,2,1,2,1,1,207}, {4,2,4,3,1,1,1,1,202},
+	{4,3,4,1,1,1,1,2,17}, {4,3,4,1,1,2,1,1,183}, {4,3,4,2,1,1,1,1,178}, {4,4,4,1,1,1,1,1,154},
+	{1,1,1,1,2,2,4,5,191}, {1,1,1,1,2,3,4,4,146}, {1,1,1,1,2,4,4,3,101}, {1,1,1,1,2,5,4,2,56},
+	{1,1,1,2,2,1,4,5,186}, {1,1,1,2,2,2,4,4,141}, {1,1,1,2,2,3,4,3,96}, {1,1,1,2,2,4,4,2,51},
+	{1,1,1,2,2,5,4,1,6}, {1,1,1,3,2,1,4,4,136}, {1,1,1,3,2,2,4,3,91}, {1,1,1,3,2,3,4,2,46},
+	{1,1,1,3,2,4,4,1,1}, {1,1,1,4,2,1,4,3,86}, {1,1,1,4,2,2,4,2,41}, {1,1,1,4,2,3,4,1,207},
+	{1,1,1,5,2,1,4,2,36}, {1,1,1,5,2,2,4,1,202}, {1,2,1,1,2,1,4,5,162}, {1,2,1,1,2,2,4,4,117},
+	{1,2,1,1,2,3,4,3,72}, {1,2,1,1,2,4,4,2,27}, {1,2,1,1,2,5,4,1,193}, {1,2,1,2,2,1,4,4,112},
+	{1,2,1,2,2,2,4,3,67}, {1,2,1,2,2,3,4,2,22}, {1,2,1,2,2,4,4,1,188}, {1,2,1,3,2,1,4,3,62},
+	{1,2,1,3,2,2,4,2,17}, {1,2,1,3,2,3,4,1,183}, {1,2,1,4,2,1,4,2,12}, {1,2,1,4,2,2,4,1,178},
+	{1,2,1,5,2,1,4,1,173}, {1,3,1,1,2,1,4,4,88}, {1,3,1,1,2,2,4,3,43}, {1,3,1,1,2,3,4,2,209},
+	{1,3,1,1,2,4,4,1,164}, {1,3,1,2,2,1,4,3,38}, {1,3,1,2,2,2,4,2,204}, {1,3,1,2,2,3,4,1,159},
+	{1,3,1,3,2,1,4,2,199}, {1,3,1,3,2,2,4,1,154}, {1,3,1,4,2,1,4,1,149}, {1,4,1,1,2,1,4,3,14},
+	{1,4,1,1,2,2,4,2,180}, {1,4,1,1,2,3,4,1,135}, {1,4,1,2,2,1,4,2,175}, {1,4,1,2,2,2,4,1,130},
+	{1,4,1,3,2,1,4,1,125}, {1,5,1,1,2,1,4,2,151}, {1,5,1,1,2,2,4,1,106}, {1,5,1,2,2,1,4,1,101},
+	{1,1,1,1,3,2,3,5,176}, {1,1,1,1,3,3,3,4,131}, {1,1,1,1,3,4,3,3,86}, {1,1,1,1,3,5,3,2,41},
+	{1,1,1,2,3,1,3,5,171}, {1,1,1,2,3,2,3,4,126}, {1,1,1,2,3,3,3,3,81}, {1,1,1,2,3,4,3,2,36},
+	{1,1,1,2,3,5,3,1,202}, {1,1,1,3,3,1,3,4,121}, {1,1,1,3,3,2,3,3,76}, {1,1,1,3,3,3,3,2,31},
+	{1,1,1,3,3,4,3,1,197}, {1,1,1,4,3,1,3,3,71}, {1,1,1,4,3,2,3,2,26}, {1,1,1,4,3,3,3,1,192},
+	{1,1,1,5,3,1,3,2,21}, {1,1,1,5,3,2,3,1,187}, {1,2,1,1,3,1,3,5,147}, {1,2,1,1,3,2,3,4,102},
+	{1,2,1,1,3,3,3,3,57}, {1,2,1,1,3,4,3,2,12}, {1,2,1,1,3,5,3,1,178}, {1,2,1,2,3,1,3,4,97},
+	{1,2,1,2,3,2,3,3,52}, {1,2,1,2,3,3,3,2,7}, {1,2,1,2,3,4,3,1,173}, {1,2,1,3,3,1,3,3,47},
+	{1,2,1,3,3,2,3,2,2}, {1,2,1,3,3,3,3,1,168}, {1,2,1,4,3,1,3,2,208}, {1,2,1,4,3,2,3,1,163},
+	{1,2,1,5,3,1,3,1,158}, {1,3,1,1,3,1,3,4,73}, {1,3,1,1,3,2,3,3,28}, {1,3,1,1,3,3,3,2,194},
+	{1,3,1,1,3,4,3,1,149}, {1,3,1,2,3,1,3,3,23}, {1,3,1,2,3,2,3,2,189}, {1,3,1,2,3,3,3,1,144},
+	{1,3,1,3,3,1,3,2,184}, {1,3,1,3,3,2,3,1,139}, {1,3,1,4,3,1,3,1,134}, {1,4,1,1,3,1,3,3,210},
+	{1,4,1,1,3,2,3,2,165}, {1,4,1,1,3,3,3,1,120}, {1,4,1,2,3,1,3,2,160}, {1,4,1,2,3,2,3,1,115},
+	{1,4,1,3,3,1,3,1,110}, {1,5,1,1,3,1,3,2,136}, {1,5,1,1,3,2,3,1,91}, {1,5,1,2,3,1,3,1,86},
+	{1,1,1,1,4,2,2,5,161}, {1,1,1,1,4,3,2,4,116}, {1,1,1,1,4,4,2,3,71}, {1,1,1,1,4,5,2,2,26},
+	{1,1,1,2,4,1,2,5,156}, {1,1,1,2,4,2,2,4,111}, {1,1,1,2,4,3,2,3,66}, {1,1,1,2,4,4,2,2,21},
+	{1,1,1,2,4,5,2,1,187}, {1,1,1,3,4,1,2,4,106}, {1,1,1,3,4,2,2,3,61}, {1,1,1,3,4,3,2,2,16},
+	{1,1,1,3,4,4,2,1,182}, {1,1,1,4,4,1,2,3,56}, {1,1,1,4,4,2,2,2,11}, {1,1,1,4,4,3,2,1,177},
+	{1,1,1,5,4,1,2,2,6}, {1,1,1,5,4,2,2,1,172}, {1,2,1,1,4,1,2,5,132}, {1,2,1,1,4,2,2,4,87},
+	{1,2,1,1,4,3,2,3,42}, {1,2,1,1,4,4,2,2,208}, {1,2,1,1,4,5,2,1,163}, {1,2,1,2,4,1,2,4,82},
+	{1,2,1,2,4,2,2,3,37}, {1,2,1,2,4,3,2,2,203}, {1,2,1,2,4,4,2,1,158}, {1,2,1,3,4,1,2,3,32},
+	{1,2,1,3,4,2,2,2,198}, {1,2,1,3,4,3,2,1,153}, {1,2,1,4,4,1,2,2,193}, {1,2,1,4,4,2,2,1,148},
+	{1,2,1,5,4,1,2,1,143}, {1,3,1,1,4,1,2,4,58}, {1,3,1,1,4,2,2,3,13}, {1,3,1,1,4,3,2,2,179},
+	{1,3,1,1,4,4,2,1,134}, {1,3,1,2,4,1,2,3,8}, {1,3,1,2,4,2,2,2,174}, {1,3,1,2,4,3,2,1,129},
+	{1,3,1,3,4,1,2,2,169}, {1,3,1,3,4,2,2,1,124}, {1,3,1,4,4,1,2,1,119}, {1,4,1,1,4,1,2,3,195},
+	{1,4,1,1,4,2,2,2,150}, {1,4,1,1,4,3,2,1,105}, {1,4,1,2,4,1,2,2,145}, {1,4,1,2,4,2,2,1,100},
+	{1,4,1,3,4,1,2,1,95}, {1,5,1,1,4,1,2,2,121}, {1,5,1,1,4,2,2,1,76}, {1,5,1,2,4,1,2,1,71},
+	{1,1,2,1,1,2,4,5,119}, {1,1,2,1,1,3,4,4,74}, {1,1,2,1,1,4,4,3,29}, {1,1,2,1,1,5,4,2,195},
+	{1,1,2,2,1,1,4,5,114}, {1,1,2,2,1,2,4,4,69}, {1,1,2,2,1,3,4,3,24}, {1,1,2,2,1,4,4,2,190},
+	{1,1,2,2,1,5,4,1,145}, {1,1,2,3,1,1,4,4,64}, {1,1,2,3,1,2,4,3,19}, {1,1,2,3,1,3,4,2,185},
+	{1,1,2,3,1,4,4,1,140}, {1,1,2,4,1,1,4,3,14}, {1,1,2,4,1,2,4,2,180}, {1,1,2,4,1,3,4,1,135},
+	{1,1,2,5,1,1,4,2,175}, {1,1,2,5,1,2,4,1,130}, {1,2,2,1,1,1,4,5,90}, {1,2,2,1,1,2,4,4,45},
+	{1,2,2,1,1,3,4,3,0}, {1,2,2,1,1,4,4,2,166}, {1,2,2,1,1,5,4,1,121}, {1,2,2,2,1,1,4,4,40},
+	{1,2,2,2,1,2,4,3,206}, {1,2,2,2,1,3,4,2,161}, {1,2,2,2,1,4,4,1,116}, {1,2,2,3,1,1,4,3,201},
+	{1,2,2,3,1,2,4,2,156}, {1,2,2,3,1,3,4,1,111}, {1,2,2,4,1,1,4,2,151}, {1,2,2,4,1,2,4,1,106},
+	{1,2,2,5,1,1,4,1,101}, {1,3,2,1,1,1,4,4,16}, {1,3,2,1,1,2,4,3,182}, {1,3,2,1,1,3,4,2,137},
+	{1,3,2,1,1,4,4,1,92}, {1,3,2,2,1,1,4,3,177}, {1,3,2,2,1,2,4,2,132}, {1,3,2,2,1,3,4,1,87},
+	{1,3,2,3,1,1,4,2,127}, {1,3,2,3,1,2,4,1,82}, {1,3,2,4,1,1,4,1,77}, {1,4,2,1,1,1,4,3,153},
+	{1,4,2,1,1,2,4,2,108}, {1,4,2,1,1,3,4,1,63}, {1,4,2,2,1,1,4,2,103}, {1,4,2,2,1,2,4,1,58},
+	{1,4,2,3,1,1,4,1,53}, {1,5,2,1,1,1,4,2,79}, {1,5,2,1,1,2,4,1,34}, {1,5,2,2,1,1,4,1,29},
+	{1,1,2,1,2,2,3,5,104}, {1,1,2,1,2,3,3,4,59}, {1,1,2,1,2,4,3,3,14}, {1,1,2,1,2,5,3,2,180},
+	{1,1,2,2,2,1,3,5,99}, {1,1,2,2,2,2,3,4,54}, {1,1,2,2,2,3,3,3,9}, {1,1,2,2,2,4,3,2,175},
+	{1,1,2,2,2,5,3,1,130}, {1,1,2,3,2,1,3,4,49}, {1,1,2,3,2,2,3,3,4}, {1,1,2,3,2,3,3,2,170},
+	{1,1,2,3,2,4,3,1,125}, {1,1,2,4,2,1,3,3,210}, {1,1,2,4,2,2,3,2,165}, {1,1,2,4,2,3,3,1,120},
+	{1,1,2,5,2,1,3,2,160}, {1,1,2,5,2,2,3,1,115}, {1,2,2,1,2,1,3,5,75}, {1,2,2,1,2,2,3,4,30},
+	{1,2,2,1,2,3,3,3,196}, {1,2,2,1,2,4,3,2,151}, {1,2,2,1,2,5,3,1,106}, {1,2,2,2,2,1,3,4,25},
+	{1,2,2,2,2,2,3,3,191}, {1,2,2,2,2,3,3,2,146}, {1,2,2,2,2,4,3,1,101}, {1,2,2,3,2,1,3,3,186},
+	{1,2,2,3,2,2,3,2,141}, {1,2,2,3,2,3,3,1,96}, {1,2,2,4,2,1,3,2,136}, {1,2,2,4,2,2,3,1,91},
+	{1,2,2,5,2,1,3,1,86}, {1,3,2,1,2,1,3,4,1}, {1,3,2,1,2,2,3,3,167}, {1,3,2,1,2,3,3,2,122},
+	{1,3,2,1,2,4,3,1,77}, {1,3,2,2,2,1,3,3,162}, {1,3,2,2,2,2,3,2,117}, {1,3,2,2,2,3,3,1,72},
+	{1,3,2,3,2,1,3,2,112}, {1,3,2,3,2,2,3,1,67}, {1,3,2,4,2,1,3,1,62}, {1,4,2,1,2,1,3,3,138},
+	{1,4,2,1,2,2,3,2,93}, {1,4,2,1,2,3,3,1,48}, {1,4,2,2,2,1,3,2,88}, {1,4,2,2,2,2,3,1,43},
+	{1,4,2,3,2,1,3,1,38}, {1,5,2,1,2,1,3,2,64}, {1,5,2,1,2,2,3,1,19}, {1,5,2,2,2,1,3,1,14},
+	{1,1,2,1,3,2,2,5,89}, {1,1,2,1,3,3,2,4,44}, {1,1,2,1,3,4,2,3,210}, {1,1,2,1,3,5,2,2,165},
+	{1,1,2,2,3,1,2,5,84}, {1,1,2,2,3,2,2,4,39}, {1,1,2,2,3,3,2,3,205}, {1,1,2,2,3,4,2,2,160},
+	{1,1,2,2,3,5,2,1,115}, {1,1,2,3,3,1,2,4,34}, {1,1,2,3,3,2,2,3,200}, {1,1,2,3,3,3,2,2,155},
+	{1,1,2,3,3,4,2,1,110}, {1,1,2,4,3,1,2,3,195}, {1,1,2,4,3,2,2,2,150}, {1,1,2,4,3,3,2,1,105},
+	{1,1,2,5,3,1,2,2,145}, {1,1,2,5,3,2,2,1,100}, {1,2,2,1,3,1,2,5,60}, {1,2,2,1,3,2,2,4,15},
+	{1,2,2,1,3,3,2,3,181}, {1,2,2,1,3,4,2,2,136}, {1,2,2,1,3,5,2,1,91}, {1,2,2,2,3,1,2,4,10},
+	{1,2,2,2,3,2,2,3,176}, {1,2,2,2,3,3,2,2,131}, {1,2,2,2,3,4,2,1,86}, {1,2,2,3,3,1,2,3,171},
+	{1,2,2,3,3,2,2,2,126}, {1,2,2,3,3,3,2,1,81}, {1,2,2,4,3,1,2,2,121}, {1,2,2,4,3,2,2,1,76},
+	{1,2,2,5,3,1,2,1,71}, {1,3,2,1,3,1,2,4,197}, {1,3,2,1,3,2,2,3,152}, {1,3,2,1,3,3,2,2,107},
+	{1,3,2,1,3,4,2,1,62}, {1,3,2,2,3,1,2,3,147}, {1,3,2,2,3,2,2,2,102}, {1,3,2,2,3,3,2,1,57},
+	{1,3,2,3,3,1,2,2,97}, {1,3,2,3,3,2,2,1,52}, {1,3,2,4,3,1,2,1,47}, {1,4,2,1,3,1,2,3,123},
+	{1,4,2,1,3,2,2,2,78}, {1,4,2,1,3,3,2,1,33}, {1,4,2,2,3,1,2,2,73}, {1,4,2,2,3,2,2,1,28},
+	{1,4,2,3,3,1,2,1,23}, {1,5,2,1,3,1,2,2,49}, {1,5,2,1,3,2,2,1,4}, {1,5,2,2,3,1,2,1,210},
+	{1,1,2,1,4,2,1,5,74}, {1,1,2,1,4,3,1,4,29}, {1,1,2,1,4,4,1,3,195}, {1,1,2,1,4,5,1,2,150},
+	{1,1,2,2,4,1,1,5,69}, {1,1,2,2,4,2,1,4,24}, {1,1,2,2,4,3,1,3,190}, {1,1,2,2,4,4,1,2,145},
+	{1,1,2,2,4,5,1,1,100}, {1,1,2,3,4,1,1,4,19}, {1,1,2,3,4,2,1,3,185}, {1,1,2,3,4,3,1,2,140},
+	{1,1,2,3,4,4,1,1,95}, {1,1,2,4,4,1,1,3,180}, {1,1,2,4,4,2,1,2,135}, {1,1,2,4,4,3,1,1,90},
+	{1,1,2,5,4,1,1,2,130}, {1,1,2,5,4,2,1,1,85}, {1,2,2,1,4,1,1,5,45}, {1,2,2,1,4,2,1,4,0},
+	{1,2,2,1,4,3,1,3,166}, {1,2,2,1,4,4,1,2,121}, {1,2,2,1,4,5,1,1,76}, {1,2,2,2,4,1,1,4,206},
+	{1,2,2,2,4,2,1,3,161}, {1,2,2,2,4,3,1,2,116}, {1,2,2,2,4,4,1,1,71}, {1,2,2,3,4,1,1,3,156},
+	{1,2,2,3,4,2,1,2,111}, {1,2,2,3,4,3,1,1,66}, {1,2,2,4,4,1,1,2,106}, {1,2,2,4,4,2,1,1,61},
+	{1,2,2,5,4,1,1,1,56}, {1,3,2,1,4,1,1,4,182}, {1,3,2,1,4,2,1,3,137}, {1,3,2,1,4,3,1,2,92},
+	{1,3,2,1,4,4,1,1,47}, {1,3,2,2,4,1,1,3,132}, {1,3,2,2,4,2,1,2,87}, {1,3,2,2,4,3,1,1,42},
+	{1,3,2,3,4,1,1,2,82}, {1,3,2,3,4,2,1,1,37}, {1,3,2,4,4,1,1,1,32}, {1,4,2,1,4,1,1,3,108},
+	{1,4,2,1,4,2,1,2,63}, {1,4,2,1,4,3,1,1,18}, {1,4,2,2,4,1,1,2,58}, {1,4,2,2,4,2,1,1,13},
+	{1,4,2,3,4,1,1,1,8}, {1,5,2,1,4,1,1,2,34}, {1,5,2,1,4,2,1,1,200}, {1,5,2,2,4,1,1,1,195},
+	{1,1,3,1,1,2,3,5,32}, {1,1,3,1,1,3,3,4,198}, {1,1,3,1,1,4,3,3,153}, {1,1,3,1,1,5,3,2,108},
+	{1,1,3,2,1,1,3,5,27}, {1,1,3,2,1,2,3,4,193}, {1,1,3,2,1,3,3,3,148}, {1,1,3,2,1,4,3,2,103},
+	{1,1,3,2,1,5,3,1,58}, {1,1,3,3,1,1,3,4,188}, {1,1,3,3,1,2,3,3,143}, {1,1,3,3,1,3,3,2,98},
+	{1,1,3,3,1,4,3,1,53}, {1,1,3,4,1,1,3,3,138}, {1,1,3,4,1,2,3,2,93}, {1,1,3,4,1,3,3,1,48},
+	{1,1,3,5,1,1,3,2,88}, {1,1,3,5,1,2,3,1,43}, {1,2,3,1,1,1,3,5,3}, {1,2,3,1,1,2,3,4,169},
+	{1,2,3,1,1,3,3,3,124}, {1,2,3,1,1,4,3,2,79}, {1,2,3,1,1,5,3,1,34}, {1,2,3,2,1,1,3,4,164},
+	{1,2,3,2,1,2,3,3,119}, {1,2,3,2,1,3,3,2,74}, {1,2,3,2,1,4,3,1,29}, {1,2,3,3,1,1,3,3,114},
+	{1,2,3,3,1,2,3,2,69}, {1,2,3,3,1,3,3,1,24}, {1,2,3,4,1,1,3,2,64}, {1,2,3,4,1,2,3,1,19},
+	{1,2,3,5,1,1,3,1,14}, {1,3,3,1,1,1,3,4,140}, {1,3,3,1,1,2,3,3,95}, {1,3,3,1,1,3,3,2,50},
+	{1,3,3,1,1,4,3,1,5}, {1,3,3,2,1,1,3,3,90}, {1,3,3,2,1,2,3,2,45}, {1,3,3,2,1,3,3,1,0},
+	{1,3,3,3,1,1,3,2,40}, {1,3,3,3,1,2,3,1,206}, {1,3,3,4,1,1,3,1,201}, {1,4,3,1,1,1,3,3,66},
+	{1,4,3,1,1,2,3,2,21}, {1,4,3,1,1,3,3,1,187}, {1,4,3,2,1,1,3,2,16}, {1,4,3,2,1,2,3,1,182},
+	{1,4,3,3,1,1,3,1,177}, {1,5,3,1,1,1,3,2,203}, {1,5,3,1,1,2,3,1,158}, {1,5,3,2,1,1,3,1,153},
+	{1,1,3,1,2,2,2,5,17}, {1,1,3,1,2,3,2,4,183}, {1,1,3,1,2,4,2,3,138}, {1,1,3,1,2,5,2,2,93},
+	{1,1,3,2,2,1,2,5,12}, {1,1,3,2,2,2,2,4,178}, {1,1,3,2,2,3,2,3,133}, {1,1,3,2,2,4,2,2,88},
+	{1,1,3,2,2,5,2,1,43}, {1,1,3,3,2,1,2,4,173}, {1,1,3,3,2,2,2,3,128}, {1,1,3,3,2,3,2,2,83},
+	{1,1,3,3,2,4,2,1,38}, {1,1,3,4,2,1,2,3,123}, {1,1,3,4,2,2,2,2,78}, {1,1,3,4,2,3,2,1,33},
+	{1,1,3,5,2,1,2,2,73}, {1,1,3,5,2,2,2,1,28}, {1,2,3,1,2,1,2,5,199}, {1,2,3,1,2,2,2,4,154},
+	{1,2,3,1,2,3,2,3,109}, {1,2,3,1,2,4,2,2,64}, {1,2,3,1,2,5,2,1,19}, {1,2,3,2,2,1,2,4,149},
+	{1,2,3,2,2,2,2,3,104}, {1,2,3,2,2,3,2,2,59}, {1,2,3,2,2,4,2,1,14}, {1,2,3,3,2,1,2,3,99},
+	{1,2,3,3,2,2,2,2,54}, {1,2,3,3,2,3,2,1,9}, {1,2,3,4,2,1,2,2,49}, {1,2,3,4,2,2,2,1,4},
+	{1,2,3,5,2,1,2,1,210}, {1,3,3,1,2,1,2,4,125}, {1,3,3,1,2,2,2,3,80}, {1,3,3,1,2,3,2,2,35},
+	{1,3,3,1,2,4,2,1,201}, {1,3,3,2,2,1,2,3,75}, {1,3,3,2,2,2,2,2,30}, {1,3,3,2,2,3,2,1,196},
+	{1,3,3,3,2,1,2,2,25}, {1,3,3,3,2,2,2,1,191}, {1,3,3,4,2,1,2,1,186}, {1,4,3,1,2,1,2,3,51},
+	{1,4,3,1,2,2,2,2,6}, {1,4,3,1,2,3,2,1,172}, {1,4,3,2,2,1,2,2,1}, {1,4,3,2,2,2,2,1,167},
+	{1,4,3,3,2,1,2,1,162}, {1,5,3,1,2,1,2,2,188}, {1,5,3,1,2,2,2,1,143}, {1,5,3,2,2,1,2,1,138},
+	{1,1,3,1,3,2,1,5,2}, {1,1,3,1,3,3,1,4,168}, {1,1,3,1,3,4,1,3,123}, {1,1,3,1,3,5,1,2,78},
+	{1,1,3,2,3,1,1,5,208}, {1,1,3,2,3,2,1,4,163}, {1,1,3,2,3,3,1,3,118}, {1,1,3,2,3,4,1,2,73},
+	{1,1,3,2,3,5,1,1,28}, {1,1,3,3,3,1,1,4,158}, {1,1,3,3,3,2,1,3,113}, {1,1,3,3,3,3,1,2,68},
+	{1,1,3,3,3,4,1,1,23}, {1,1,3,4,3,1,1,3,108}, {1,1,3,4,3,2,1,2,63}, {1,1,3,4,3,3,1,1,18},
+	{1,1,3,5,3,1,1,2,58}, {1,1,3,5,3,2,1,1,13}, {1,2,3,1,3,1,1,5,184}, {1,2,3,1,3,2,1,4,139},
+	{1,2,3,1,3,3,1,3,94}, {1,2,3,1,3,4,1,2,49}, {1,2,3,1,3,5,1,1,4}, {1,2,3,2,3,1,1,4,134},
+	{1,2,3,2,3,2,1,3,89}, {1,2,3,2,3,3,1,2,44}, {1,2,3,2,3,4,1,1,210}, {1,2,3,3,3,1,1,3,84},
+	{1,2,3,3,3,2,1,2,39}, {1,2,3,3,3,3,1,1,205}, {1,2,3,4,3,1,1,2,34}, {1,2,3,4,3,2,1,1,200},
+	{1,2,3,5,3,1,1,1,195}, {1,3,3,1,3,1,1,4,110}, {1,3,3,1,3,2,1,3,65}, {1,3,3,1,3,3,1,2,20},
+	{1,3,3,1,3,4,1,1,186}, {1,3,3,2,3,1,1,3,60}, {1,3,3,2,3,2,1,2,15}, {1,3,3,2,3,3,1,1,181},
+	{1,3,3,3,3,1,1,2,10}, {1,3,3,3,3,2,1,1,176}, {1,3,3,4,3,1,1,1,171}, {1,4,3,1,3,1,1,3,36},
+	{1,4,3,1,3,2,1,2,202}, {1,4,3,1,3,3,1,1,157}, {1,4,3,2,3,1,1,2,197}, {1,4,3,2,3,2,1,1,152},
+	{1,4,3,3,3,1,1,1,147}, {1,5,3,1,3,1,1,2,173}, {1,5,3,1,3,2,1,1,128}, {1,5,3,2,3,1,1,1,123},
+	{1,1,4,1,1,2,2,5,156}, {1,1,4,1,1,3,2,4,111}, {1,1,4,1,1,4,2,3,66}, {1,1,4,1,1,5,2,2,21},
+	{1,1,4,2,1,1,2,5,151}, {1,1,4,2,1,2,2,4,106}, {1,1,4,2,1,3,2,3,61}, {1,1,4,2,1,4,2,2,16},
+	{1,1,4,2,1,5,2,1,182}, {1,1,4,3,1,1,2,4,101}, {1,1,4,3,1,2,2,3,56}, {1,1,4,3,1,3,2,2,11},
+	{1,1,4,3,1,4,2,1,177}, {1,1,4,4,1,1,2,3,51}, {1,1,4,4,1,2,2,2,6}, {1,1,4,4,1,3,2,1,172},
+	{1,1,4,5,1,1,2,2,1}, {1,1,4,5,1,2,2,1,167}, {1,2,4,1,1,1,2,5,127}, {1,2,4,1,1,2,2,4,82},
+	{1,2,4,1,1,3,2,3,37}, {1,2,4,1,1,4,2,2,203}, {1,2,4,1,1,5,2,1,158}, {1,2,4,2,1,1,2,4,77},
+	{1,2,4,2,1,2,2,3,32}, {1,2,4,2,1,3,2,2,198}, {1,2,4,2,1,4,2,1,153}, {1,2,4,3,1,1,2,3,27},
+	{1,2,4,3,1,2,2,2,193}, {1,2,4,3,1,3,2,1,148}, {1,2,4,4,1,1,2,2,188}, {1,2,4,4,1,2,2,1,143},
+	{1,2,4,5,1,1,2,1,138}, {1,3,4,1,1,1,2,4,53}, {1,3,4,1,1,2,2,3,8}, {1,3,4,1,1,3,2,2,174},
+	{1,3,4,1,1,4,2,1,129}, {1,3,4,2,1,1,2,3,3}, {1,3,4,2,1,2,2,2,169}, {1,3,4,2,1,3,2,1,124},
+	{1,3,4,3,1,1,2,2,164}, {1,3,4,3,1,2,2,1,119}, {1,3,4,4,1,1,2,1,114}, {1,4,4,1,1,1,2,3,190},
+	{1,4,4,1,1,2,2,2,145}, {1,4,4,1,1,3,2,1,100}, {1,4,4,2,1,1,2,2,140}, {1,4,4,2,1,2,2,1,95},
+	{1,4,4,3,1,1,2,1,90}, {1,5,4,1,1,1,2,2,116}, {1,5,4,1,1,2,2,1,71}, {1,5,4,2,1,1,2,1,66},
+	{1,1,4,1,2,2,1,5,141}, {1,1,4,1,2,3,1,4,96}, {1,1,4,1,2,4,1,3,51}, {1,1,4,1,2,5,1,2,6},
+	{1,1,4,2,2,1,1,5,136}, {1,1,4,2,2,2,1,4,91}, {1,1,4,2,2,3,1,3,46}, {1,1,4,2,2,4,1,2,1},
+	{1,1,4,2,2,5,1,1,167}, {1,1,4,3,2,1,1,4,86}, {1,1,4,3,2,2,1,3,41}, {1,1,4,3,2,3,1,2,207},
+	{1,1,4,3,2,4,1,1,162}, {1,1,4,4,2,1,1,3,36}, {1,1,4,4,2,2,1,2,202}, {1,1,4,4,2,3,1,1,157},
+	{1,1,4,5,2,1,1,2,197}, {1,1,4,5,2,2,1,1,152}, {1,2,4,1,2,1,1,5,112}, {1,2,4,1,2,2,1,4,67},
+	{1,2,4,1,2,3,1,3,22}, {1,2,4,1,2,4,1,2,188}, {1,2,4,1,2,5,1,1,143}, {1,2,4,2,2,1,1,4,62},
+	{1,2,4,2,2,2,1,3,17}, {1,2,4,2,2,3,1,2,183}, {1,2,4,2,2,4,1,1,138}, {1,2,4,3,2,1,1,3,12},
+	{1,2,4,3,2,2,1,2,178}, {1,2,4,3,2,3,1,1,133}, {1,2,4,4,2,1,1,2,173}, {1,2,4,4,2,2,1,1,128},
+	{1,2,4,5,2,1,1,1,123}, {1,3,4,1,2,1,1,4,38}, {1,3,4,1,2,2,1,3,204}, {1,3,4,1,2,3,1,2,159},
+	{1,3,4,1,2,4,1,1,114}, {1,3,4,2,2,1,1,3,199}, {1,3,4,2,2,2,1,2,154}, {1,3,4,2,2,3,1,1,109},
+	{1,3,4,3,2,1,1,2,149}, {1,3,4,3,2,2,1,1,104}, {1,3,4,4,2,1,1,1,99}, {1,4,4,1,2,1,1,3,175},
+	{1,4,4,1,2,2,1,2,130}, {1,4,4,1,2,3,1,1,85}, {1,4,4,2,2,1,1,2,125}, {1,4,4,2,2,2,1,1,80},
+	{1,4,4,3,2,1,1,1,75}, {1,5,4,1,2,1,1,2,101}, {1,5,4,1,2,2,1,1,56}, {1,5,4,2,2,1,1,1,51},
+	{2,1,1,1,1,2,4,5,111}, {2,1,1,1,1,3,4,4,66}, {2,1,1,1,1,4,4,3,21}, {2,1,1,1,1,5,4,2,187},
+	{2,1,1,2,1,1,4,5,106}, {2,1,1,2,1,2,4,4,61}, {2,1,1,2,1,3,4,3,16}, {2,1,1,2,1,4,4,2,182},
+	{2,1,1,2,1,5,4,1,137}, {2,1,1,3,1,1,4,4,56}, {2,1,1,3,1,2,4,3,11}, {2,1,1,3,1,3,4,2,177},
+	{2,1,1,3,1,4,4,1,132}, {2,1,1,4,1,1,4,3,6}, {2,1,1,4,1,2,4,2,172}, {2,1,1,4,1,3,4,1,127},
+	{2,1,1,5,1,1,4,2,167}, {2,1,1,5,1,2,4,1,122}, {2,2,1,1,1,1,4,5,82}, {2,2,1,1,1,2,4,4,37},
+	{2,2,1,1,1,3,4,3,203}, {2,2,1,1,1,4,4,2,158}, {2,2,1,1,1,5,4,1,113}, {2,2,1,2,1,1,4,4,32},
+	{2,2,1,2,1,2,4,3,198}, {2,2,1,2,1,3,4,2,153}, {2,2,1,2,1,4,4,1,108}, {2,2,1,3,1,1,4,3,193},
+	{2,2,1,3,1,2,4,2,148}, {2,2,1,3,1,3,4,1,103}, {2,2,1,4,1,1,4,2,143}, {2,2,1,4,1,2,4,1,98},
+	{2,2,1,5,1,1,4,1,93}, {2,3,1,1,1,1,4,4,8}, {2,3,1,1,1,2,4,3,174}, {2,3,1,1,1,3,4,2,129},
+	{2,3,1,1,1,4,4,1,84}, {2,3,1,2,1,1,4,3,169}, {2,3,1,2,1,2,4,2,124}, {2,3,1,2,1,3,4,1,79},
+	{2,3,1,3,1,1,4,2,119}, {2,3,1,3,1,2,4,1,74}, {2,3,1,4,1,1,4,1,69}, {2,4,1,1,1,1,4,3,145},
+	{2,4,1,1,1,2,4,2,100}, {2,4,1,1,1,3,4,1,55}, {2,4,1,2,1,1,4,2,95}, {2,4,1,2,1,2,4,1,50},
+	{2,4,1,3,1,1,4,1,45}, {2,5,1,1,1,1,4,2,71}, {2,5,1,1,1,2,4,1,26}, {2,5,1,2,1,1,4,1,21},
+	{2,1,1,1,2,2,3,5,96}, {2,1,1,1,2,3,3,4,51}, {2,1,1,1,2,4,3,3,6}, {2,1,1,1,2,5,3,2,172},
+	{2,1,1,2,2,1,3,5,91}, {2,1,1,2,2,2,3,4,46}, {2,1,1,2,2,3,3,3,1}, {2,1,1,2,2,4,3,2,167},
+	{2,1,1,2,2,5,3,1,122}, {2,1,1,3,2,1,3,4,41}, {2,1,1,3,2,2,3,3,207}, {2,1,1,3,2,3,3,2,162},
+	{2,1,1,3,2,4,3,1,117}, {2,1,1,4,2,1,3,3,202}, {2,1,1,4,2,2,3,2,157}, {2,1,1,4,2,3,3,1,112},
+	{2,1,1,5,2,1,3,2,152}, {2,1,1,5,2,2,3,1,107}, {2,2,1,1,2,1,3,5,67}, {2,2,1,1,2,2,3,4,22},
+	{2,2,1,1,2,3,3,3,188}, {2,2,1,1,2,4,3,2,143}, {2,2,1,1,2,5,3,1,98}, {2,2,1,2,2,1,3,4,17},
+	{2,2,1,2,2,2,3,3,183}, {2,2,1,2,2,3,3,2,138}, {2,2,1,2,2,4,3,1,93}, {2,2,1,3,2,1,3,3,178},
+	{2,2,1,3,2,2,3,2,133}, {2,2,1,3,2,3,3,1,88}, {2,2,1,4,2,1,3,2,128}, {2,2,1,4,2,2,3,1,83},
+	{2,2,1,5,2,1,3,1,78}, {2,3,1,1,2,1,3,4,204}, {2,3,1,1,2,2,3,3,159}, {2,3,1,1,2,3,3,2,114},
+	{2,3,1,1,2,4,3,1,69}, {2,3,1,2,2,1,3,3,154}, {2,3,1,2,2,2,3,2,109}, {2,3,1,2,2,3,3,1,64},
+	{2,3,1,3,2,1,3,2,104}, {2,3,1,3,2,2,3,1,59}, {2,3,1,4,2,1,3,1,54}, {2,4,1,1,2,1,3,3,130},
+	{2,4,1,1,2,2,3,2,85}, {2,4,1,1,2,3,3,1,40}, {2,4,1,2,2,1,3,2,80}, {2,4,1,2,2,2,3,1,35},
+	{2,4,1,3,2,1,3,1,30}, {2,5,1,1,2,1,3,2,56}, {2,5,1,1,2,2,3,1,11}, {2,5,1,2,2,1,3,1,6},
+	{2,1,1,1,3,2,2,5,81}, {2,1,1,1,3,3,2,4,36}, {2,1,1,1,3,4,2,3,202}, {2,1,1,1,3,5,2,2,157},
+	{2,1,1,2,3,1,2,5,76}, {2,1,1,2,3,2,2,4,31}, {2,1,1,2,3,3,2,3,197}, {2,1,1,2,3,4,2,2,152},
+	{2,1,1,2,3,5,2,1,107}, {2,1,1,3,3,1,2,4,26}, {2,1,1,3,3,2,2,3,192}, {2,1,1,3,3,3,2,2,147},
+	{2,1,1,3,3,4,2,1,102}, {2,1,1,4,3,1,2,3,187}, {2,1,1,4,3,2,2,2,142}, {2,1,1,4,3,3,2,1,97},
+	{2,1,1,5,3,1,2,2,137}, {2,1,1,5,3,2,2,1,92}, {2,2,1,1,3,1,2,5,52}, {2,2,1,1,3,2,2,4,7},
+	{2,2,1,1,3,3,2,3,173}, {2,2,1,1,3,4,2,2,128}, {2,2,1,1,3,5,2,1,83}, {2,2,1,2,3,1,2,4,2},
+	{2,2,1,2,3,2,2,3,168}, {2,2,1,2,3,3,2,2,123}, {2,2,1,2,3,4,2,1,78}, {2,2,1,3,3,1,2,3,163},
+	{2,2,1,3,3,2,2,2,118}, {2,2,1,3,3,3,2,1,73}, {2,2,1,4,3,1,2,2,113}, {2,2,1,4,3,2,2,1,68},
+	{2,2,1,5,3,1,2,1,63}, {2,3,1,1,3,1,2,4,189}, {2,3,1,1,3,2,2,3,144}, {2,3,1,1,3,3,2,2,99},
+	{2,3,1,1,3,4,2,1,54}, {2,3,1,2,3,1,2,3,139}, {2,3,1,2,3,2,2,2,94}, {2,3,1,2,3,3,2,1,49},
+	{2,3,1,3,3,1,2,2,89}, {2,3,1,3,3,2,2,1,44}, {2,3,1,4,3,1,2,1,39}, {2,4,1,1,3,1,2,3,115},
+	{2,4,1,1,3,2,2,2,70}, {2,4,1,1,3,3,2,1,25}, {2,4,1,2,3,1,2,2,65}, {2,4,1,2,3,2,2,1,20},
+	{2,4,1,3,3,1,2,1,15}, {2,5,1,1,3,1,2,2,41}, {2,5,1,1,3,2,2,1,207}, {2,5,1,2,3,1,2,1,202},
+	{2,1,1,1,4,2,1,5,66}, {2,1,1,1,4,3,1,4,21}, {2,1,1,1,4,4,1,3,187}, {2,1,1,1,4,5,1,2,142},
+	{2,1,1,2,4,1,1,5,61}, {2,1,1,2,4,2,1,4,16}, {2,1,1,2,4,3,1,3,182}, {2,1,1,2,4,4,1,2,137},
+	{2,1,1,2,4,5,1,1,92}, {2,1,1,3,4,1,1,4,11}, {2,1,1,3,4,2,1,3,177}, {2,1,1,3,4,3,1,2,132},
+	{2,1,1,3,4,4,1,1,87}, {2,1,1,4,4,1,1,3,172}, {2,1,1,4,4,2,1,2,127}, {2,1,1,4,4,3,1,1,82},
+	{2,1,1,5,4,1,1,2,122}, {2,1,1,5,4,2,1,1,77}, {2,2,1,1,4,1,1,5,37}, {2,2,1,1,4,2,1,4,203},
+	{2,2,1,1,4,3,1,3,158}, {2,2,1,1,4,4,1,2,113}, {2,2,1,1,4,5,1,1,68}, {2,2,1,2,4,1,1,4,198},
+	{2,2,1,2,4,2,1,3,153}, {2,2,1,2,4,3,1,2,108}, {2,2,1,2,4,4,1,1,63}, {2,2,1,3,4,1,1,3,148},
+	{2,2,1,3,4,2,1,2,103}, {2,2,1,3,4,3,1,1,58}, {2,2,1,4,4,1,1,2,98}, {2,2,1,4,4,2,1,1,53},
+	{2,2,1,5,4,1,1,1,48}, {2,3,1,1,4,1,1,4,174}, {2,3,1,1,4,2,1,3,129}, {2,3,1,1,4,3,1,2,84},
+	{2,3,1,1,4,4,1,1,39}, {2,3,1,2,4,1,1,3,124}, {2,3,1,2,4,2,1,2,79}, {2,3,1,2,4,3,1,1,34},
+	{2,3,1,3,4,1,1,2,74}, {2,3,1,3,4,2,1,1,29}, {2,3,1,4,4,1,1,1,24}, {2,4,1,1,4,1,1,3,100},
+	{2,4,1,1,4,2,1,2,55}, {2,4,1,1,4,3,1,1,10}, {2,4,1,2,4,1,1,2,50}, {2,4,1,2,4,2,1,1,5},
+	{2,4,1,3,4,1,1,1,0}, {2,5,1,1,4,1,1,2,26}, {2,5,1,1,4,2,1,1,192}, {2,5,1,2,4,1,1,1,187},
+	{2,1,2,1,1,2,3,5,24}, {2,1,2,1,1,3,3,4,190}, {2,1,2,1,1,4,3,3,145}, {2,1,2,1,1,5,3,2,100},
+	{2,1,2,2,1,1,3,5,19}, {2,1,2,2,1,2,3,4,185}, {2,1,2,2,1,3,3,3,140}, {2,1,2,2,1,4,3,2,95},
+	{2,1,2,2,1,5,3,1,50}, {2,1,2,3,1,1,3,4,180}, {2,1,2,3,1,2,3,3,135}, {2,1,2,3,1,3,3,2,90},
+	{2,1,2,3,1,4,3,1,45}, {2,1,2,4,1,1,3,3,130}, {2,1,2,4,1,2,3,2,85}, {2,1,2,4,1,3,3,1,40},
+	{2,1,2,5,1,1,3,2,80}, {2,1,2,5,1,2,3,1,35}, {2,2,2,1,1,1,3,5,206}, {2,2,2,1,1,2,3,4,161},
+	{2,2,2,1,1,3,3,3,116}, {2,2,2,1,1,4,3,2,71}, {2,2,2,1,1,5,3,1,26}, {2,2,2,2,1,1,3,4,156},
+	{2,2,2,2,1,2,3,3,111}, {2,2,2,2,1,3,3,2,66}, {2,2,2,2,1,4,3,1,21}, {2,2,2,3,1,1,3,3,106},
+	{2,2,2,3,1,2,3,2,61}, {2,2,2,3,1,3,3,1,16}, {2,2,2,4,1,1,3,2,56}, {2,2,2,4,1,2,3,1,11},
+	{2,2,2,5,1,1,3,1,6}, {2,3,2,1,1,1,3,4,132}, {2,3,2,1,1,2,3,3,87}, {2,3,2,1,1,3,3,2,42},
+	{2,3,2,1,1,4,3,1,208}, {2,3,2,2,1,1,3,3,82}, {2,3,2,2,1,2,3,2,37}, {2,3,2,2,1,3,3,1,203},
+	{2,3,2,3,1,1,3,2,32}, {2,3,2,3,1,2,3,1,198}, {2,3,2,4,1,1,3,1,193}, {2,4,2,1,1,1,3,3,58},
+	{2,4,2,1,1,2,3,2,13}, {2,4,2,1,1,3,3,1,179}, {2,4,2,2,1,1,3,2,8}, {2,4,2,2,1,2,3,1,174},
+	{2,4,2,3,1,1,3,1,169}, {2,5,2,1,1,1,3,2,195}, {2,5,2,1,1,2,3,1,150}, {2,5,2,2,1,1,3,1,145},
+	{2,1,2,1,3,2,1,5,205}, {2,1,2,1,3,3,1,4,160}, {2,1,2,1,3,4,1,3,115}, {2,1,2,1,3,5,1,2,70},
+	{2,1,2,2,3,1,1,5,200}, {2,1,2,2,3,2,1,4,155}, {2,1,2,2,3,3,1,3,110}, {2,1,2,2,3,4,1,2,65},
+	{2,1,2,2,3,5,1,1,20}, {2,1,2,3,3,1,1,4,150}, {2,1,2,3,3,2,1,3,105}, {2,1,2,3,3,3,1,2,60},
+	{2,1,2,3,3,4,1,1,15}, {2,1,2,4,3,1,1,3,100}, {2,1,2,4,3,2,1,2,55}, {2,1,2,4,3,3,1,1,10},
+	{2,1,2,5,3,1,1,2,50}, {2,1,2,5,3,2,1,1,5}, {2,2,2,1,3,1,1,5,176}, {2,2,2,1,3,2,1,4,131},
+	{2,2,2,1,3,3,1,3,86}, {2,2,2,1,3,4,1,2,41}, {2,2,2,1,3,5,1,1,207}, {2,2,2,2,3,1,1,4,126},
+	{2,2,2,2,3,2,1,3,81}, {2,2,2,2,3,3,1,2,36}, {2,2,2,2,3,4,1,1,202}, {2,2,2,3,3,1,1,3,76},
+	{2,2,2,3,3,2,1,2,31}, {2,2,2,3,3,3,1,1,197}, {2,2,2,4,3,1,1,2,26}, {2,2,2,4,3,2,1,1,192},
+	{2,2,2,5,3,1,1,1,187}, {2,3,2,1,3,1,1,4,102}, {2,3,2,1,3,2,1,3,57}, {2,3,2,1,3,3,1,2,12},
+	{2,3,2,1,3,4,1,1,178}, {2,3,2,2,3,1,1,3,52}, {2,3,2,2,3,2,1,2,7}, {2,3,2,2,3,3,1,1,173},
+	{2,3,2,3,3,1,1,2,2}, {2,3,2,3,3,2,1,1,168}, {2,3,2,4,3,1,1,1,163}, {2,4,2,1,3,1,1,3,28},
+	{2,4,2,1,3,2,1,2,194}, {2,4,2,1,3,3,1,1,149}, {2,4,2,2,3,1,1,2,189}, {2,4,2,2,3,2,1,1,144},
+	{2,4,2,3,3,1,1,1,139}, {2,5,2,1,3,1,1,2,165}, {2,5,2,1,3,2,1,1,120}, {2,5,2,2,3,1,1,1,115},
+	{2,1,3,1,1,2,2,5,148}, {2,1,3,1,1,3,2,4,103}, {2,1,3,1,1,4,2,3,58}, {2,1,3,1,1,5,2,2,13},
+	{2,1,3,2,1,1,2,5,143}, {2,1,3,2,1,2,2,4,98}, {2,1,3,2,1,3,2,3,53}, {2,1,3,2,1,4,2,2,8},
+	{2,1,3,2,1,5,2,1,174}, {2,1,3,3,1,1,2,4,93}, {2,1,3,3,1,2,2,3,48}, {2,1,3,3,1,3,2,2,3},
+	{2,1,3,3,1,4,2,1,169}, {2,1,3,4,1,1,2,3,43}, {2,1,3,4,1,2,2,2,209}, {2,1,3,4,1,3,2,1,164},
+	{2,1,3,5,1,1,2,2,204}, {2,1,3,5,1,2,2,1,159}, {2,2,3,1,1,1,2,5,119}, {2,2,3,1,1,2,2,4,74},
+	{2,2,3,1,1,3,2,3,29}, {2,2,3,1,1,4,2,2,195}, {2,2,3,1,1,5,2,1,150}, {2,2,3,2,1,1,2,4,69},
+	{2,2,3,2,1,2,2,3,24}, {2,2,3,2,1,3,2,2,190}, {2,2,3,2,1,4,2,1,145}, {2,2,3,3,1,1,2,3,19},
+	{2,2,3,3,1,2,2,2,185}, {2,2,3,3,1,3,2,1,140}, {2,2,3,4,1,1,2,2,180}, {2,2,3,4,1,2,2,1,135},
+	{2,2,3,5,1,1,2,1,130}, {2,3,3,1,1,1,2,4,45}, {2,3,3,1,1,2,2,3,0}, {2,3,3,1,1,3,2,2,166},
+	{2,3,3,1,1,4,2,1,121}, {2,3,3,2,1,1,2,3,206}, {2,3,3,2,1,2,2,2,161}, {2,3,3,2,1,3,2,1,116},
+	{2,3,3,3,1,1,2,2,156}, {2,3,3,3,1,2,2,1,111}, {2,3,3,4,1,1,2,1,106}, {2,4,3,1,1,1,2,3,182},
+	{2,4,3,1,1,2,2,2,137}, {2,4,3,1,1,3,2,1,92}, {2,4,3,2,1,1,2,2,132}, {2,4,3,2,1,2,2,1,87},
+	{2,4,3,3,1,1,2,1,82}, {2,5,3,1,1,1,2,2,108}, {2,5,3,1,1,2,2,1,63}, {2,5,3,2,1,1,2,1,58},
+	{2,1,3,1,2,2,1,5,133}, {2,1,3,1,2,3,1,4,88}, {2,1,3,1,2,4,1,3,43}, {2,1,3,1,2,5,1,2,209},
+	{2,1,3,2,2,1,1,5,128}, {2,1,3,2,2,2,1,4,83}, {2,1,3,2,2,3,1,3,38}, {2,1,3,2,2,4,1,2,204},
+	{2,1,3,2,2,5,1,1,159}, {2,1,3,3,2,1,1,4,78}, {2,1,3,3,2,2,1,3,33}, {2,1,3,3,2,3,1,2,199},
+	{2,1,3,3,2,4,1,1,154}, {2,1,3,4,2,1,1,3,28}, {2,1,3,4,2,2,1,2,194}, {2,1,3,4,2,3,1,1,149},
+	{2,1,3,5,2,1,1,2,189}, {2,1,3,5,2,2,1,1,144}, {2,2,3,1,2,1,1,5,104}, {2,2,3,1,2,2,1,4,59},
+	{2,2,3,1,2,3,1,3,14}, {2,2,3,1,2,4,1,2,180}, {2,2,3,1,2,5,1,1,135}, {2,2,3,2,2,1,1,4,54},
+	{2,2,3,2,2,2,1,3,9}, {2,2,3,2,2,3,1,2,175}, {2,2,3,2,2,4,1,1,130}, {2,2,3,3,2,1,1,3,4},
+	{2,2,3,3,2,2,1,2,170}, {2,2,3,3,2,3,1,1,125}, {2,2,3,4,2,1,1,2,165}, {2,2,3,4,2,2,1,1,120},
+	{2,2,3,5,2,1,1,1,115}, {2,3,3,1,2,1,1,4,30}, {2,3,3,1,2,2,1,3,196}, {2,3,3,1,2,3,1,2,151},
+	{2,3,3,1,2,4,1,1,106}, {2,3,3,2,2,1,1,3,191}, {2,3,3,2,2,2,1,2,146}, {2,3,3,2,2,3,1,1,101},
+	{2,3,3,3,2,1,1,2,141}, {2,3,3,3,2,2,1,1,96}, {2,3,3,4,2,1,1,1,91}, {2,4,3,1,2,1,1,3,167},
+	{2,4,3,1,2,2,1,2,122}, {2,4,3,1,2,3,1,1,77}, {2,4,3,2,2,1,1,2,117}, {2,4,3,2,2,2,1,1,72},
+	{2,4,3,3,2,1,1,1,67}, {2,5,3,1,2,1,1,2,93}, {2,5,3,1,2,2,1,1,48}, {2,5,3,2,2,1,1,1,43},
+	{2,1,4,1,1,2,1,5,61}, {2,1,4,1,1,3,1,4,16}, {2,1,4,1,1,4,1,3,182}, {2,1,4,1,1,5,1,2,137},
+	{2,1,4,2,1,1,1,5,56}, {2,1,4,2,1,2,1,4,11}, {2,1,4,2,1,3,1,3,177}, {2,1,4,2,1,4,1,2,132},
+	{2,1,4,2,1,5,1,1,87}, {2,1,4,3,1,1,1,4,6}, {2,1,4,3,1,2,1,3,172}, {2,1,4,3,1,3,1,2,127},
+	{2,1,4,3,1,4,1,1,82}, {2,1,4,4,1,1,1,3,167}, {2,1,4,4,1,2,1,2,122}, {2,1,4,4,1,3,1,1,77},
+	{2,1,4,5,1,1,1,2,117}, {2,1,4,5,1,2,1,1,72}, {2,2,4,1,1,1,1,5,32}, {2,2,4,1,1,2,1,4,198},
+	{2,2,4,1,1,3,1,3,153}, {2,2,4,1,1,4,1,2,108}, {2,2,4,1,1,5,1,1,63}, {2,2,4,2,1,1,1,4,193},
+	{2,2,4,2,1,2,1,3,148}, {2,2,4,2,1,3,1,2,103}, {2,2,4,2,1,4,1,1,58}, {2,2,4,3,1,1,1,3,143},
+	{2,2,4,3,1,2,1,2,98}, {2,2,4,3,1,3,1,1,53}, {2,2,4,4,1,1,1,2,93}, {2,2,4,4,1,2,1,1,48},
+	{2,2,4,5,1,1,1,1,43}, {2,3,4,1,1,1,1,4,169}, {2,3,4,1,1,2,1,3,124}, {2,3,4,1,1,3,1,2,79},
+	{2,3,4,1,1,4,1,1,34}, {2,3,4,2,1,1,1,3,119}, {2,3,4,2,1,2,1,2,74}, {2,3,4,2,1,3,1,1,29},
+	{2,3,4,3,1,1,1,2,69}, {2,3,4,3,1,2,1,1,24}, {2,3,4,4,1,1,1,1,19}, {2,4,4,1,1,1,1,3,95},
+	{2,4,4,1,1,2,1,2,50}, {2,4,4,1,1,3,1,1,5}, {2,4,4,2,1,1,1,2,45}, {2,4,4,2,1,2,1,1,0},
+	{2,4,4,3,1,1,1,1,206}, {2,5,4,1,1,1,1,2,21}, {2,5,4,1,1,2,1,1,187}, {2,5,4,2,1,1,1,1,182},
+	{3,1,1,1,1,2,3,5,16}, {3,1,1,1,1,3,3,4,182}, {3,1,1,1,1,4,3,3,137}, {3,1,1,1,1,5,3,2,92},
+	{3,1,1,2,1,1,3,5,11}, {3,1,1,2,1,2,3,4,177}, {3,1,1,2,1,3,3,3,132}, {3,1,1,2,1,4,3,2,87},
+	{3,1,1,2,1,5,3,1,42}, {3,1,1,3,1,1,3,4,172}, {3,1,1,3,1,2,3,3,127}, {3,1,1,3,1,3,3,2,82},
+	{3,1,1,3,1,4,3,1,37}, {3,1,1,4,1,1,3,3,122}, {3,1,1,4,1,2,3,2,77}, {3,1,1,4,1,3,3,1,32},
+	{3,1,1,5,1,1,3,2,72}, {3,1,1,5,1,2,3,1,27}, {3,2,1,1,1,1,3,5,198}, {3,2,1,1,1,2,3,4,153},
+	{3,2,1,1,1,3,3,3,108}, {3,2,1,1,1,4,3,2,63}, {3,2,1,1,1,5,3,1,18}, {3,2,1,2,1,1,3,4,148},
+	{3,2,1,2,1,2,3,3,103}, {3,2,1,2,1,3,3,2,58}, {3,2,1,2,1,4,3,1,13}, {3,2,1,3,1,1,3,3,98},
+	{3,2,1,3,1,2,3,2,53}, {3,2,1,3,1,3,3,1,8}, {3,2,1,4,1,1,3,2,48}, {3,2,1,4,1,2,3,1,3},
+	{3,2,1,5,1,1,3,1,209}, {3,3,1,1,1,1,3,4,124}, {3,3,1,1,1,2,3,3,79}, {3,3,1,1,1,3,3,2,34},
+	{3,3,1,1,1,4,3,1,200}, {3,3,1,2,1,1,3,3,74}, {3,3,1,2,1,2,3,2,29}, {3,3,1,2,1,3,3,1,195},
+	{3,3,1,3,1,1,3,2,24}, {3,3,1,3,1,2,3,1,190}, {3,3,1,4,1,1,3,1,185}, {3,4,1,1,1,1,3,3,50},
+	{3,4,1,1,1,2,3,2,5}, {3,4,1,1,1,3,3,1,171}, {3,4,1,2,1,1,3,2,0}, {3,4,1,2,1,2,3,1,166},
+	{3,4,1,3,1,1,3,1,161}, {3,5,1,1,1,1,3,2,187}, {3,5,1,1,1,2,3,1,142}, {3,5,1,2,1,1,3,1,137},
+	{3,1,1,1,2,2,2,5,1}, {3,1,1,1,2,3,2,4,167}, {3,1,1,1,2,4,2,3,122}, {3,1,1,1,2,5,2,2,77},
+	{3,1,1,2,2,1,2,5,207}, {3,1,1,2,2,2,2,4,162}, {3,1,1,2,2,3,2,3,117}, {3,1,1,2,2,4,2,2,72},
+	{3,1,1,2,2,5,2,1,27}, {3,1,1,3,2,1,2,4,157}, {3,1,1,3,2,2,2,3,112}, {3,1,1,3,2,3,2,2,67},
+	{3,1,1,3,2,4,2,1,22}, {3,1,1,4,2,1,2,3,107}, {3,1,1,4,2,2,2,2,62}, {3,1,1,4,2,3,2,1,17},
+	{3,1,1,5,2,1,2,2,57}, {3,1,1,5,2,2,2,1,12}, {3,2,1,1,2,1,2,5,183}, {3,2,1,1,2,2,2,4,138},
+	{3,2,1,1,2,3,2,3,93}, {3,2,1,1,2,4,2,2,48}, {3,2,1,1,2,5,2,1,3}, {3,2,1,2,2,1,2,4,133},
+	{3,2,1,2,2,2,2,3,88}, {3,2,1,2,2,3,2,2,43}, {3,2,1,2,2,4,2,1,209}, {3,2,1,3,2,1,2,3,83},
+	{3,2,1,3,2,2,2,2,38}, {3,2,1,3,2,3,2,1,204}, {3,2,1,4,2,1,2,2,33}, {3,2,1,4,2,2,2,1,199},
+	{3,2,1,5,2,1,2,1,194}, {3,3,1,1,2,1,2,4,109}, {3,3,1,1,2,2,2,3,64}, {3,3,1,1,2,3,2,2,19},
+	{3,3,1,1,2,4,2,1,185}, {3,3,1,2,2,1,2,3,59}, {3,3,1,2,2,2,2,2,14}, {3,3,1,2,2,3,2,1,180},
+	{3,3,1,3,2,1,2,2,9}, {3,3,1,3,2,2,2,1,175}, {3,3,1,4,2,1,2,1,170}, {3,4,1,1,2,1,2,3,35},
+	{3,4,1,1,2,2,2,2,201}, {3,4,1,1,2,3,2,1,156}, {3,4,1,2,2,1,2,2,196}, {3,4,1,2,2,2,2,1,151},
+	{3,4,1,3,2,1,2,1,146}, {3,5,1,1,2,1,2,2,172}, {3,5,1,1,2,2,2,1,127}, {3,5,1,2,2,1,2,1,122},
+	{3,1,1,1,3,2,1,5,197}, {3,1,1,1,3,3,1,4,152}, {3,1,1,1,3,4,1,3,107}, {3,1,1,1,3,5,1,2,62},
+	{3,1,1,2,3,1,1,5,192}, {3,1,1,2,3,2,1,4,147}, {3,1,1,2,3,3,1,3,102}, {3,1,1,2,3,4,1,2,57},
+	{3,1,1,2,3,5,1,1,12}, {3,1,1,3,3,1,1,4,142}, {3,1,1,3,3,2,1,3,97}, {3,1,1,3,3,3,1,2,52},
+	{3,1,1,3,3,4,1,1,7}, {3,1,1,4,3,1,1,3,92}, {3,1,1,4,3,2,1,2,47}, {3,1,1,4,3,3,1,1,2},
+	{3,1,1,5,3,1,1,2,42}, {3,1,1,5,3,2,1,1,208}, {3,2,1,1,3,1,1,5,168}, {3,2,1,1,3,2,1,4,123},
+	{3,2,1,1,3,3,1,3,78}, {3,2,1,1,3,4,1,2,33}, {3,2,1,1,3,5,1,1,199}, {3,2,1,2,3,1,1,4,118},
+	{3,2,1,2,3,2,1,3,73}, {3,2,1,2,3,3,1,2,28}, {3,2,1,2,3,4,1,1,194}, {3,2,1,3,3,1,1,3,68},
+	{3,2,1,3,3,2,1,2,23}, {3,2,1,3,3,3,1,1,189}, {3,2,1,4,3,1,1,2,18}, {3,2,1,4,3,2,1,1,184},
+	{3,2,1,5,3,1,1,1,179}, {3,3,1,1,3,1,1,4,94}, {3,3,1,1,3,2,1,3,49}, {3,3,1,1,3,3,1,2,4},
+	{3,3,1,1,3,4,1,1,170}, {3,3,1,2,3,1,1,3,44}, {3,3,1,2,3,2,1,2,210}, {3,3,1,2,3,3,1,1,165},
+	{3,3,1,3,3,1,1,2,205}, {3,3,1,3,3,2,1,1,160}, {3,3,1,4,3,1,1,1,155}, {3,4,1,1,3,1,1,3,20},
+	{3,4,1,1,3,2,1,2,186}, {3,4,1,1,3,3,1,1,141}, {3,4,1,2,3,1,1,2,181}, {3,4,1,2,3,2,1,1,136},
+	{3,4,1,3,3,1,1,1,131}, {3,5,1,1,3,1,1,2,157}, {3,5,1,1,3,2,1,1,112}, {3,5,1,2,3,1,1,1,107},
+	{3,1,2,1,1,2,2,5,140}, {3,1,2,1,1,3,2,4,95}, {3,1,2,1,1,4,2,3,50}, {3,1,2,1,1,5,2,2,5},
+	{3,1,2,2,1,1,2,5,135}, {3,1,2,2,1,2,2,4,90}, {3,1,2,2,1,3,2,3,45}, {3,1,2,2,1,4,2,2,0},
+	{3,1,2,2,1,5,2,1,166}, {3,1,2,3,1,1,2,4,85}, {3,1,2,3,1,2,2,3,40}, {3,1,2,3,1,3,2,2,206},
+	{3,1,2,3,1,4,2,1,161}, {3,1,2,4,1,1,2,3,35}, {3,1,2,4,1,2,2,2,201}, {3,1,2,4,1,3,2,1,156},
+	{3,1,2,5,1,1,2,2,196}, {3,1,2,5,1,2,2,1,151}, {3,2,2,1,1,1,2,5,111}, {3,2,2,1,1,2,2,4,66},
+	{3,2,2,1,1,3,2,3,21}, {3,2,2,1,1,4,2,2,187}, {3,2,2,1,1,5,2,1,142}, {3,2,2,2,1,1,2,4,61},
+	{3,2,2,2,1,2,2,3,16}, {3,2,2,2,1,3,2,2,182}, {3,2,2,2,1,4,2,1,137}, {3,2,2,3,1,1,2,3,11},
+	{3,2,2,3,1,2,2,2,177}, {3,2,2,3,1,3,2,1,132}, {3,2,2,4,1,1,2,2,172}, {3,2,2,4,1,2,2,1,127},
+	{3,2,2,5,1,1,2,1,122}, {3,3,2,1,1,1,2,4,37}, {3,3,2,1,1,2,2,3,203}, {3,3,2,1,1,3,2,2,158},
+	{3,3,2,1,1,4,2,1,113}, {3,3,2,2,1,1,2,3,198}, {3,3,2,2,1,2,2,2,153}, {3,3,2,2,1,3,2,1,108},
+	{3,3,2,3,1,1,2,2,148}, {3,3,2,3,1,2,2,1,103}, {3,3,2,4,1,1,2,1,98}, {3,4,2,1,1,1,2,3,174},
+	{3,4,2,1,1,2,2,2,129}, {3,4,2,1,1,3,2,1,84}, {3,4,2,2,1,1,2,2,124}, {3,4,2,2,1,2,2,1,79},
+	{3,4,2,3,1,1,2,1,74}, {3,5,2,1,1,1,2,2,100}, {3,5,2,1,1,2,2,1,55}, {3,5,2,2,1,1,2,1,50},
+	{3,1,2,1,2,2,1,5,125}, {3,1,2,1,2,3,1,4,80}, {3,1,2,1,2,4,1,3,35}, {3,1,2,1,2,5,1,2,201},
+	{3,1,2,2,2,1,1,5,120}, {3,1,2,2,2,2,1,4,75}, {3,1,2,2,2,3,1,3,30}, {3,1,2,2,2,4,1,2,196},
+	{3,1,2,2,2,5,1,1,151}, {3,1,2,3,2,1,1,4,70}, {3,1,2,3,2,2,1,3,25}, {3,1,2,3,2,3,1,2,191},
+	{3,1,2,3,2,4,1,1,146}, {3,1,2,4,2,1,1,3,20}, {3,1,2,4,2,2,1,2,186}, {3,1,2,4,2,3,1,1,141},
+	{3,1,2,5,2,1,1,2,181}, {3,1,2,5,2,2,1,1,136}, {3,2,2,1,2,1,1,5,96}, {3,2,2,1,2,2,1,4,51},
+	{3,2,2,1,2,3,1,3,6}, {3,2,2,1,2,4,1,2,172}, {3,2,2,1,2,5,1,1,127}, {3,2,2,2,2,1,1,4,46},
+	{3,2,2,2,2,2,1,3,1}, {3,2,2,2,2,3,1,2,167}, {3,2,2,2,2,4,1,1,122}, {3,2,2,3,2,1,1,3,207},
+	{3,2,2,3,2,2,1,2,162}, {3,2,2,3,2,3,1,1,117}, {3,2,2,4,2,1,1,2,157}, {3,2,2,4,2,2,1,1,112},
+	{3,2,2,5,2,1,1,1,107}, {3,3,2,1,2,1,1,4,22}, {3,3,2,1,2,2,1,3,188}, {3,3,2,1,2,3,1,2,143},
+	{3,3,2,1,2,4,1,1,98}, {3,3,2,2,2,1,1,3,183}, {3,3,2,2,2,2,1,2,138}, {3,3,2,2,2,3,1,1,93},
+	{3,3,2,3,2,1,1,2,133}, {3,3,2,3,2,2,1,1,88}, {3,3,2,4,2,1,1,1,83}, {3,4,2,1,2,1,1,3,159},
+	{3,4,2,1,2,2,1,2,114}, {3,4,2,1,2,3,1,1,69}, {3,4,2,2,2,1,1,2,109}, {3,4,2,2,2,2,1,1,64},
+	{3,4,2,3,2,1,1,1,59}, {3,5,2,1,2,1,1,2,85}, {3,5,2,1,2,2,1,1,40}, {3,5,2,2,2,1,1,1,35},
+	{3,1,3,1,1,2,1,5,53}, {3,1,3,1,1,3,1,4,8}, {3,1,3,1,1,4,1,3,174}, {3,1,3,1,1,5,1,2,129},
+	{3,1,3,2,1,1,1,5,48}, {3,1,3,2,1,2,1,4,3}, {3,1,3,2,1,3,1,3,169}, {3,1,3,2,1,4,1,2,124},
+	{3,1,3,2,1,5,1,1,79}, {3,1,3,3,1,1,1,4,209}, {3,1,3,3,1,2,1,3,164}, {3,1,3,3,1,3,1,2,119},
+	{3,1,3,3,1,4,1,1,74}, {3,1,3,4,1,1,1,3,159}, {3,1,3,4,1,2,1,2,114}, {3,1,3,4,1,3,1,1,69},
+	{3,1,3,5,1,1,1,2,109}, {3,1,3,5,1,2,1,1,64}, {3,2,3,1,1,1,1,5,24}, {3,2,3,1,1,2,1,4,190},
+	{3,2,3,1,1,3,1,3,145}, {3,2,3,1,1,4,1,2,100}, {3,2,3,1,1,5,1,1,55}, {3,2,3,2,1,1,1,4,185},
+	{3,2,3,2,1,2,1,3,140}, {3,2,3,2,1,3,1,2,95}, {3,2,3,2,1,4,1,1,50}, {3,2,3,3,1,1,1,3,135},
+	{3,2,3,3,1,2,1,2,90}, {3,2,3,3,1,3,1,1,45}, {3,2,3,4,1,1,1,2,85}, {3,2,3,4,1,2,1,1,40},
+	{3,2,3,5,1,1,1,1,35}, {3,3,3,1,1,1,1,4,161}, {3,3,3,1,1,2,1,3,116}, {3,3,3,1,1,3,1,2,71},
+	{3,3,3,1,1,4,1,1,26}, {3,3,3,2,1,1,1,3,111}, {3,3,3,2,1,2,1,2,66}, {3,3,3,2,1,3,1,1,21},
+	{3,3,3,3,1,1,1,2,61}, {3,3,3,3,1,2,1,1,16}, {3,3,3,4,1,1,1,1,11}, {3,4,3,1,1,1,1,3,87},
+	{3,4,3,1,1,2,1,2,42}, {3,4,3,1,1,3,1,1,208}, {3,4,3,2,1,1,1,2,37}, {3,4,3,2,1,2,1,1,203},
+	{3,4,3,3,1,1,1,1,198}, {3,5,3,1,1,1,1,2,13}, {3,5,3,1,1,2,1,1,179}, {3,5,3,2,1,1,1,1,174},
+	{4,1,1,1,1,2,2,5,132}, {4,1,1,1,1,3,2,4,87}, {4,1,1,1,1,4,2,3,42}, {4,1,1,1,1,5,2,2,208},
+	{4,1,1,2,1,1,2,5,127}, {4,1,1,2,1,2,2,4,82}, {4,1,1,2,1,3,2,3,37}, {4,1,1,2,1,4,2,2,203},
+	{4,1,1,2,1,5,2,1,158}, {4,1,1,3,1,1,2,4,77}, {4,1,1,3,1,2,2,3,32}, {4,1,1,3,1,3,2,2,198},
+	{4,1,1,3,1,4,2,1,153}, {4,1,1,4,1,1,2,3,27}, {4,1,1,4,1,2,2,2,193}, {4,1,1,4,1,3,2,1,148},
+	{4,1,1,5,1,1,2,2,188}, {4,1,1,5,1,2,2,1,143}, {4,2,1,1,1,1,2,5,103}, {4,2,1,1,1,2,2,4,58},
+	{4,2,1,1,1,3,2,3,13}, {4,2,1,1,1,4,2,2,179}, {4,2,1,1,1,5,2,1,134}, {4,2,1,2,1,1,2,4,53},
+	{4,2,1,2,1,2,2,3,8}, {4,2,1,2,1,3,2,2,174}, {4,2,1,2,1,4,2,1,129}, {4,2,1,3,1,1,2,3,3},
+	{4,2,1,3,1,2,2,2,169}, {4,2,1,3,1,3,2,1,124}, {4,2,1,4,1,1,2,2,164}, {4,2,1,4,1,2,2,1,119},
+	{4,2,1,5,1,1,2,1,114}, {4,3,1,1,1,1,2,4,29}, {4,3,1,1,1,2,2,3,195}, {4,3,1,1,1,3,2,2,150},
+	{4,3,1,1,1,4,2,1,105}, {4,3,1,2,1,1,2,3,190}, {4,3,1,2,1,2,2,2,145}, {4,3,1,2,1,3,2,1,100},
+	{4,3,1,3,1,1,2,2,140}, {4,3,1,3,1,2,2,1,95}, {4,3,1,4,1,1,2,1,90}, {4,4,1,1,1,1,2,3,166},
+	{4,4,1,1,1,2,2,2,121}, {4,4,1,1,1,3,2,1,76}, {4,4,1,2,1,1,2,2,116}, {4,4,1,2,1,2,2,1,71},
+	{4,4,1,3,1,1,2,1,66}, {4,5,1,1,1,1,2,2,92}, {4,5,1,1,1,2,2,1,47}, {4,5,1,2,1,1,2,1,42},
+	{4,1,1,1,2,2,1,5,117}, {4,1,1,1,2,3,1,4,72}, {4,1,1,1,2,4,1,3,27}, {4,1,1,1,2,5,1,2,193},
+	{4,1,1,2,2,1,1,5,112}, {4,1,1,2,2,2,1,4,67}, {4,1,1,2,2,3,1,3,22}, {4,1,1,2,2,4,1,2,188},
+	{4,1,1,2,2,5,1,1,143}, {4,1,1,3,2,1,1,4,62}, {4,1,1,3,2,2,1,3,17}, {4,1,1,3,2,3,1,2,183},
+	{4,1,1,3,2,4,1,1,138}, {4,1,1,4,2,1,1,3,12}, {4,1,1,4,2,2,1,2,178}, {4,1,1,4,2,3,1,1,133},
+	{4,1,1,5,2,1,1,2,173}, {4,1,1,5,2,2,1,1,128}, {4,2,1,1,2,1,1,5,88}, {4,2,1,1,2,2,1,4,43},
+	{4,2,1,1,2,3,1,3,209}, {4,2,1,1,2,4,1,2,164}, {4,2,1,1,2,5,1,1,119}, {4,2,1,2,2,1,1,4,38},
+	{4,2,1,2,2,2,1,3,204}, {4,2,1,2,2,3,1,2,159}, {4,2,1,2,2,4,1,1,114}, {4,2,1,3,2,1,1,3,199},
+	{4,2,1,3,2,2,1,2,154}, {4,2,1,3,2,3,1,1,109}, {4,2,1,4,2,1,1,2,149}, {4,2,1,4,2,2,1,1,104},
+	{4,2,1,5,2,1,1,1,99}, {4,3,1,1,2,1,1,4,14}, {4,3,1,1,2,2,1,3,180}, {4,3,1,1,2,3,1,2,135},
+	{4,3,1,1,2,4,1,1,90}, {4,3,1,2,2,1,1,3,175}, {4,3,1,2,2,2,1,2,130}, {4,3,1,2,2,3,1,1,85},
+	{4,3,1,3,2,1,1,2,125}, {4,3,1,3,2,2,1,1,80}, {4,3,1,4,2,1,1,1,75}, {4,4,1,1,2,1,1,3,151},
+	{4,4,1,1,2,2,1,2,106}, {4,4,1,1,2,3,1,1,61}, {4,4,1,2,2,1,1,2,101}, {4,4,1,2,2,2,1,1,56},
+	{4,4,1,3,2,1,1,1,51}, {4,5,1,1,2,1,1,2,77}, {4,5,1,1,2,2,1,1,32}, {4,5,1,2,2,1,1,1,27},
+	{4,1,2,1,1,2,1,5,45}, {4,1,2,1,1,3,1,4,0}, {4,1,2,1,1,4,1,3,166}, {4,1,2,1,1,5,1,2,121},
+	{4,1,2,2,1,1,1,5,40}, {4,1,2,2,1,2,1,4,206}, {4,1,2,2,1,3,1,3,161}, {4,1,2,2,1,4,1,2,116},
+	{4,1,2,2,1,5,1,1,71}, {4,1,2,3,1,1,1,4,201}, {4,1,2,3,1,2,1,3,156}, {4,1,2,3,1,3,1,2,111},
+	{4,1,2,3,1,4,1,1,66}, {4,1,2,4,1,1,1,3,151}, {4,1,2,4,1,2,1,2,106}, {4,1,2,4,1,3,1,1,61},
+	{4,1,2,5,1,1,1,2,101}, {4,1,2,5,1,2,1,1,56}, {4,2,2,1,1,1,1,5,16}, {4,2,2,1,1,2,1,4,182},
+	{4,2,2,1,1,3,1,3,137}, {4,2,2,1,1,4,1,2,92}, {4,2,2,1,1,5,1,1,47}, {4,2,2,2,1,1,1,4,177},
+	{4,2,2,2,1,2,1,3,132}, {4,2,2,2,1,3,1,2,87}, {4,2,2,2,1,4,1,1,42}, {4,2,2,3,1,1,1,3,127},
+	{4,2,2,3,1,2,1,2,82}, {4,2,2,3,1,3,1,1,37}, {4,2,2,4,1,1,1,2,77}, {4,2,2,4,1,2,1,1,32},
+	{4,2,2,5,1,1,1,1,27}, {4,3,2,1,1,1,1,4,153}, {4,3,2,1,1,2,1,3,108}, {4,3,2,1,1,3,1,2,63},
+	{4,3,2,1,1,4,1,1,18}, {4,3,2,2,1,1,1,3,103}, {4,3,2,2,1,2,1,2,58}, {4,3,2,2,1,3,1,1,13},
+	{4,3,2,3,1,1,1,2,53}, {4,3,2,3,1,2,1,1,8}, {4,3,2,4,1,1,1,1,3}, {4,4,2,1,1,1,1,3,79},
+	{4,4,2,1,1,2,1,2,34}, {4,4,2,1,1,3,1,1,200}, {4,4,2,2,1,1,1,2,29}, {4,4,2,2,1,2,1,1,195},
+	{4,4,2,3,1,1,1,1,190}, {4,5,2,1,1,1,1,2,5}, {4,5,2,1,1,2,1,1,171}, {4,5,2,2,1,1,1,1,166},
+	{1,1,1,1,1,3,3,6,123}, {1,1,1,1,1,4,3,5,78}, {1,1,1,1,1,5,3,4,33}, {1,1,1,1,1,6,3,3,199},
+	{1,1,1,2,1,2,3,6,118}, {1,1,1,2,1,3,3,5,73}, {1,1,1,2,1,4,3,4,28}, {1,1,1,2,1,5,3,3,194},
+	{1,1,1,2,1,6,3,2,149}, {1,1,1,3,1,1,3,6,113}, {1,1,1,3,1,2,3,5,68}, {1,1,1,3,1,3,3,4,23},
+	{1,1,1,3,1,4,3,3,189}, {1,1,1,3,1,5,3,2,144}, {1,1,1,3,1,6,3,1,99}, {1,1,1,4,1,1,3,5,63},
+	{1,1,1,4,1,2,3,4,18}, {1,1,1,4,1,3,3,3,184}, {1,1,1,4,1,4,3,2,139}, {1,1,1,4,1,5,3,1,94},
+	{1,1,1,5,1,1,3,4,13}, {1,1,1,5,1,2,3,3,179}, {1,1,1,5,1,3,3,2,134}, {1,1,1,5,1,4,3,1,89},
+	{1,1,1,6,1,1,3,3,174}, {1,1,1,6,1,2,3,2,129}, {1,1,1,6,1,3,3,1,84}, {1,2,1,1,1,2,3,6,94},
+	{1,2,1,1,1,3,3,5,49}, {1,2,1,1,1,4,3,4,4}, {1,2,1,1,1,5,3,3,170}, {1,2,1,1,1,6,3,2,125},
+	{1,2,1,2,1,1,3,6,89}, {1,2,1,2,1,2,3,5,44}, {1,2,1,2,1,3,3,4,210}, {1,2,1,2,1,4,3,3,165},
+	{1,2,1,2,1,5,3,2,120}, {1,2,1,2,1,6,3,1,75}, {1,2,1,3,1,1,3,5,39}, {1,2,1,3,1,2,3,4,205},
+	{1,2,1,3,1,3,3,3,160}, {1,2,1,3,1,4,3,2,115}, {1,2,1,3,1,5,3,1,70}, {1,2,1,4,1,1,3,4,200},
+	{1,2,1,4,1,2,3,3,155}, {1,2,1,4,1,3,3,2,110}, {1,2,1,4,1,4,3,1,65}, {1,2,1,5,1,1,3,3,150},
+	{1,2,1,5,1,2,3,2,105}, {1,2,1,5,1,3,3,1,60}, {1,2,1,6,1,1,3,2,100}, {1,2,1,6,1,2,3,1,55},
+	{1,3,1,1,1,1,3,6,65}, {1,3,1,1,1,2,3,5,20}, {1,3,1,1,1,3,3,4,186}, {1,3,1,1,1,4,3,3,141},
+	{1,3,1,1,1,5,3,2,96}, {1,3,1,1,1,6,3,1,51}, {1,3,1,2,1,1,3,5,15}, {1,3,1,2,1,2,3,4,181},
+	{1,3,1,2,1,3,3,3,136}, {1,3,1,2,1,4,3,2,91}, {1,3,1,2,1,5,3,1,46}, {1,3,1,3,1,1,3,4,176},
+	{1,3,1,3,1,2,3,3,131}, {1,3,1,3,1,3,3,2,86}, {1,3,1,3,1,4,3,1,41}, {1,3,1,4,1,1,3,3,126},
+	{1,3,1,4,1,2,3,2,81}, {1,3,1,4,1,3,3,1,36}, {1,3,1,5,1,1,3,2,76}, {1,3,1,5,1,2,3,1,31},
+	{1,3,1,6,1,1,3,1,26}, {1,4,1,1,1,1,3,5,202}, {1,4,1,1,1,2,3,4,157}, {1,4,1,1,1,3,3,3,112},
+	{1,4,1,1,1,4,3,2,67}, {1,4,1,1,1,5,3,1,22}, {1,4,1,2,1,1,3,4,152}, {1,4,1,2,1,2,3,3,107},
+	{1,4,1,2,1,3,3,2,62}, {1,4,1,2,1,4,3,1,17}, {1,4,1,3,1,1,3,3,102}, {1,4,1,3,1,2,3,2,57},
+	{1,4,1,3,1,3,3,1,12}, {1,4,1,4,1,1,3,2,52}, {1,4,1,4,1,2,3,1,7}, {1,4,1,5,1,1,3,1,2},
+	{1,5,1,1,1,1,3,4,128}, {1,5,1,1,1,2,3,3,83}, {1,5,1,1,1,3,3,2,38}, {1,5,1,1,1,4,3,1,204},
+	{1,5,1,2,1,1,3,3,78}, {1,5,1,2,1,2,3,2,33}, {1,5,1,2,1,3,3,1,199}, {1,5,1,3,1,1,3,2,28},
+	{1,5,1,3,1,2,3,1,194}, {1,5,1,4,1,1,3,1,189}, {1,6,1,1,1,1,3,3,54}, {1,6,1,1,1,2,3,2,9},
+	{1,6,1,1,1,3,3,1,175}, {1,6,1,2,1,1,3,2,4}, {1,6,1,2,1,2,3,1,170}, {1,6,1,3,1,1,3,1,165},
+	{1,1,1,1,2,3,2,6,108}, {1,1,1,1,2,4,2,5,63}, {1,1,1,1,2,5,2,4,18}, {1,1,1,1,2,6,2,3,184},
+	{1,1,1,2,2,2,2,6,103}, {1,1,1,2,2,3,2,5,58}, {1,1,1,2,2,4,2,4,13}, {1,1,1,2,2,5,2,3,179},
+	{1,1,1,2,2,6,2,2,134}, {1,1,1,3,2,1,2,6,98}, {1,1,1,3,2,2,2,5,53}, {1,1,1,3,2,3,2,4,8},
+	{1,1,1,3,2,4,2,3,174}, {1,1,1,3,2,5,2,2,129}, {1,1,1,3,2,6,2,1,84}, {1,1,1,4,2,1,2,5,48},
+	{1,1,1,4,2,2,2,4,3}, {1,1,1,4,2,3,2,3,169}, {1,1,1,4,2,4,2,2,124}, {1,1,1,4,2,5,2,1,79},
+	{1,1,1,5,2,1,2,4,209}, {1,1,1,5,2,2,2,3,164}, {1,1,1,5,2,3,2,2,119}, {1,1,1,5,2,4,2,1,74},
+	{1,1,1,6,2,1,2,3,159}, {1,1,1,6,2,2,2,2,114}, {1,1,1,6,2,3,2,1,69}, {1,2,1,1,2,2,2,6,79},
+	{1,2,1,1,2,3,2,5,34}, {1,2,1,1,2,4,2,4,200}, {1,2,1,1,2,5,2,3,155}, {1,2,1,1,2,6,2,2,110},
+	{1,2,1,2,2,1,2,6,74}, {1,2,1,2,2,2,2,5,29}, {1,2,1,2,2,3,2,4,195}, {1,2,1,2,2,4,2,3,150},
+	{1,2,1,2,2,5,2,2,105}, {1,2,1,2,2,6,2,1,60}, {1,2,1,3,2,1,2,5,24}, {1,2,1,3,2,2,2,4,190},
+	{1,2,1,3,2,3,2,3,145}, {1,2,1,3,2,4,2,2,100}, {1,2,1,3,2,5,2,1,55}, {1,2,1,4,2,1,2,4,185},
+	{1,2,1,4,2,2,2,3,140}, {1,2,1,4,2,3,2,2,95}, {1,2,1,4,2,4,2,1,50}, {1,2,1,5,2,1,2,3,135},
+	{1,2,1,5,2,2,2,2,90}, {1,2,1,5,2,3,2,1,45}, {1,2,1,6,2,1,2,2,85}, {1,2,1,6,2,2,2,1,40},
+	{1,3,1,1,2,1,2,6,50}, {1,3,1,1,2,2,2,5,5}, {1,3,1,1,2,3,2,4,171}, {1,3,1,1,2,4,2,3,126},
+	{1,3,1,1,2,5,2,2,81}, {1,3,1,1,2,6,2,1,36}, {1,3,1,2,2,1,2,5,0}, {1,3,1,2,2,2,2,4,166},
+	{1,3,1,2,2,3,2,3,121}, {1,3,1,2,2,4,2,2,76}, {1,3,1,2,2,5,2,1,31}, {1,3,1,3,2,1,2,4,161},
+	{1,3,1,3,2,2,2,3,116}, {1,3,1,3,2,3,2,2,71}, {1,3,1,3,2,4,2,1,26}, {1,3,1,4,2,1,2,3,111},
+	{1,3,1,4,2,2,2,2,66}, {1,3,1,4,2,3,2,1,21}, {1,3,1,5,2,1,2,2,61}, {1,3,1,5,2,2,2,1,16},
+	{1,3,1,6,2,1,2,1,11}, {1,4,1,1,2,1,2,5,187}, {1,4,1,1,2,2,2,4,142}, {1,4,1,1,2,3,2,3,97},
+	{1,4,1,1,2,4,2,2,52}, {1,4,1,1,2,5,2,1,7}, {1,4,1,2,2,1,2,4,137}, {1,4,1,2,2,2,2,3,92},
+	{1,4,1,2,2,3,2,2,47}, {1,4,1,2,2,4,2,1,2}, {1,4,1,3,2,1,2,3,87}, {1,4,1,3,2,2,2,2,42},
+	{1,4,1,3,2,3,2,1,208}, {1,4,1,4,2,1,2,2,37}, {1,4,1,4,2,2,2,1,203}, {1,4,1,5,2,1,2,1,198},
+	{1,5,1,1,2,1,2,4,113}, {1,5,1,1,2,2,2,3,68}, {1,5,1,1,2,3,2,2,23}, {1,5,1,1,2,4,2,1,189},
+	{1,5,1,2,2,1,2,3,63}, {1,5,1,2,2,2,2,2,18}, {1,5,1,2,2,3,2,1,184}, {1,5,1,3,2,1,2,2,13},
+	{1,5,1,3,2,2,2,1,179}, {1,5,1,4,2,1,2,1,174}, {1,6,1,1,2,1,2,3,39}, {1,6,1,1,2,2,2,2,205},
+	{1,6,1,1,2,3,2,1,160}, {1,6,1,2,2,1,2,2,200}, {1,6,1,2,2,2,2,1,155}, {1,6,1,3,2,1,2,1,150},
+	{1,1,1,1,3,3,1,6,93}, {1,1,1,1,3,4,1,5,48}, {1,1,1,1,3,5,1,4,3}, {1,1,1,1,3,6,1,3,169},
+	{1,1,1,2,3,2,1,6,88}, {1,1,1,2,3,3,1,5,43}, {1,1,1,2,3,4,1,4,209}, {1,1,1,2,3,5,1,3,164},
+	{1,1,1,2,3,6,1,2,119}, {1,1,1,3,3,1,1,6,83}, {1,1,1,3,3,2,1,5,38}, {1,1,1,3,3,3,1,4,204},
+	{1,1,1,3,3,4,1,3,159}, {1,1,1,3,3,5,1,2,114}, {1,1,1,3,3,6,1,1,69}, {1,1,1,4,3,1,1,5,33},
+	{1,1,1,4,3,2,1,4,199}, {1,1,1,4,3,3,1,3,154}, {1,1,1,4,3,4,1,2,109}, {1,1,1,4,3,5,1,1,64},
+	{1,1,1,5,3,1,1,4,194}, {1,1,1,5,3,2,1,3,149}, {1,1,1,5,3,3,1,2,104}, {1,1,1,5,3,4,1,1,59},
+	{1,1,1,6,3,1,1,3,144}, {1,1,1,6,3,2,1,2,99}, {1,1,1,6,3,3,1,1,54}, {1,2,1,1,3,2,1,6,64},
+	{1,2,1,1,3,3,1,5,19}, {1,2,1,1,3,4,1,4,185}, {1,2,1,1,3,5,1,3,140}, {1,2,1,1,3,6,1,2,95},
+	{1,2,1,2,3,1,1,6,59}, {1,2,1,2,3,2,1,5,14}, {1,2,1,2,3,3,1,4,180}, {1,2,1,2,3,4,1,3,135},
+	{1,2,1,2,3,5,1,2,90}, {1,2,1,2,3,6,1,1,45}, {1,2,1,3,3,1,1,5,9}, {1,2,1,3,3,2,1,4,175},
+	{1,2,1,3,3,3,1,3,130}, {1,2,1,3,3,4,1,2,85}, {1,2,1,3,3,5,1,1,40}, {1,2,1,4,3,1,1,4,170},
+	{1,2,1,4,3,2,1,3,125}, {1,2,1,4,3,3,1,2,80}, {1,2,1,4,3,4,1,1,35}, {1,2,1,5,3,1,1,3,120},
+	{1,2,1,5,3,2,1,2,75}, {1,2,1,5,3,3,1,1,30}, {1,2,1,6,3,1,1,2,70}, {1,2,1,6,3,2,1,1,25},
+	{1,3,1,1,3,1,1,6,35}, {1,3,1,1,3,2,1,5,201}, {1,3,1,1,3,3,1,4,156}, {1,3,1,1,3,4,1,3,111},
+	{1,3,1,1,3,5,1,2,66}, {1,3,1,1,3,6,1,1,21}, {1,3,1,2,3,1,1,5,196}, {1,3,1,2,3,2,1,4,151},
+	{1,3,1,2,3,3,1,3,106}, {1,3,1,2,3,4,1,2,61}, {1,3,1,2,3,5,1,1,16}, {1,3,1,3,3,1,1,4,146},
+	{1,3,1,3,3,2,1,3,101}, {1,3,1,3,3,3,1,2,56}, {1,3,1,3,3,4,1,1,11}, {1,3,1,4,3,1,1,3,96},
+	{1,3,1,4,3,2,1,2,51}, {1,3,1,4,3,3,1,1,6}, {1,3,1,5,3,1,1,2,46}, {1,3,1,5,3,2,1,1,1},
+	{1,3,1,6,3,1,1,1,207}, {1,4,1,1,3,1,1,5,172}, {1,4,1,1,3,2,1,4,127}, {1,4,1,1,3,3,1,3,82},
+	{1,4,1,1,3,4,1,2,37}, {1,4,1,1,3,5,1,1,203}, {1,4,1,2,3,1,1,4,122}, {1,4,1,2,3,2,1,3,77},
+	{1,4,1,2,3,3,1,2,32}, {1,4,1,2,3,4,1,1,198}, {1,4,1,3,3,1,1,3,72}, {1,4,1,3,3,2,1,2,27},
+	{1,4,1,3,3,3,1,1,193}, {1,4,1,4,3,1,1,2,22}, {1,4,1,4,3,2,1,1,188}, {1,4,1,5,3,1,1,1,183},
+	{1,5,1,1,3,1,1,4,98}, {1,5,1,1,3,2,1,3,53}, {1,5,1,1,3,3,1,2,8}, {1,5,1,1,3,4,1,1,174},
+	{1,5,1,2,3,1,1,3,48}, {1,5,1,2,3,2,1,2,3}, {1,5,1,2,3,3,1,1,169}, {1,5,1,3,3,1,1,2,209},
+	{1,5,1,3,3,2,1,1,164}, {1,5,1,4,3,1,1,1,159}, {1,6,1,1,3,1,1,3,24}, {1,6,1,1,3,2,1,2,190},
+	{1,6,1,1,3,3,1,1,145}, {1,6,1,2,3,1,1,2,185}, {1,6,1,2,3,2,1,1,140}, {1,6,1,3,3,1,1,1,135},
+	{1,1,2,1,1,3,2,6,36}, {1,1,2,1,1,4,2,5,202}, {1,1,2,1,1,5,2,4,157}, {1,1,2,1,1,6,2,3,112},
+	{1,1,2,2,1,2,2,6,31}, {1,1,2,2,1,3,2,5,197}, {1,1,2,2,1,4,2,4,152}, {1,1,2,2,1,5,2,3,107},
+	{1,1,2,2,1,6,2,2,62}, {1,1,2,3,1,1,2,6,26}, {1,1,2,3,1,2,2,5,192}, {1,1,2,3,1,3,2,4,147},
+	{1,1,2,3,1,4,2,3,102}, {1,1,2,3,1,5,2,2,57}, {1,1,2,3,1,6,2,1,12}, {1,1,2,4,1,1,2,5,187},
+	{1,1,2,4,1,2,2,4,142}, {1,1,2,4,1,3,2,3,97}, {1,1,2,4,1,4,2,2,52}, {1,1,2,4,1,5,2,1,7},
+	{1,1,2,5,1,1,2,4,137}, {1,1,2,5,1,2,2,3,92}, {1,1,2,5,1,3,2,2,47}, {1,1,2,5,1,4,2,1,2},
+	{1,1,2,6,1,1,2,3,87}, {1,1,2,6,1,2,2,2,42}, {1,1,2,6,1,3,2,1,208}, {1,2,2,1,1,2,2,6,7},
+	{1,2,2,1,1,3,2,5,173}, {1,2,2,1,1,4,2,4,128}, {1,2,2,1,1,5,2,3,83}, {1,2,2,1,1,6,2,2,38},
+	{1,2,2,2,1,1,2,6,2}, {1,2,2,2,1,2,2,5,168}, {1,2,2,2,1,3,2,4,123}, {1,2,2,2,1,4,2,3,78},
+	{1,2,2,2,1,5,2,2,33}, {1,2,2,2,1,6,2,1,199}, {1,2,2,3,1,1,2,5,163}, {1,2,2,3,1,2,2,4,118},
+	{1,2,2,3,1,3,2,3,73}, {1,2,2,3,1,4,2,2,28}, {1,2,2,3,1,5,2,1,194}, {1,2,2,4,1,1,2,4,113},
+	{1,2,2,4,1,2,2,3,68}, {1,2,2,4,1,3,2,2,23}, {1,2,2,4,1,4,2,1,189}, {1,2,2,5,1,1,2,3,63},
+	{1,2,2,5,1,2,2,2,18}, {1,2,2,5,1,3,2,1,184}, {1,2,2,6,1,1,2,2,13}, {1,2,2,6,1,2,2,1,179},
+	{1,3,2,1,1,1,2,6,189}, {1,3,2,1,1,2,2,5,144}, {1,3,2,1,1,3,2,4,99}, {1,3,2,1,1,4,2,3,54},
+	{1,3,2,1,1,5,2,2,9}, {1,3,2,1,1,6,2,1,175}, {1,3,2,2,1,1,2,5,139}, {1,3,2,2,1,2,2,4,94},
+	{1,3,2,2,1,3,2,3,49}, {1,3,2,2,1,4,2,2,4}, {1,3,2,2,1,5,2,1,170}, {1,3,2,3,1,1,2,4,89},
+	{1,3,2,3,1,2,2,3,44}, {1,3,2,3,1,3,2,2,210}, {1,3,2,3,1,4,2,1,165}, {1,3,2,4,1,1,2,3,39},
+	{1,3,2,4,1,2,2,2,205}, {1,3,2,4,1,3,2,1,160}, {1,3,2,5,1,1,2,2,200}, {1,3,2,5,1,2,2,1,155},
+	{1,3,2,6,1,1,2,1,150}, {1,4,2,1,1,1,2,5,115}, {1,4,2,1,1,2,2,4,70}, {1,4,2,1,1,3,2,3,25},
+	{1,4,2,1,1,4,2,2,191}, {1,4,2,1,1,5,2,1,146}, {1,4,2,2,1,1,2,4,65}, {1,4,2,2,1,2,2,3,20},
+	{1,4,2,2,1,3,2,2,186}, {1,4,2,2,1,4,2,1,141}, {1,4,2,3,1,1,2,3,15}, {1,4,2,3,1,2,2,2,181},
+	{1,4,2,3,1,3,2,1,136}, {1,4,2,4,1,1,2,2,176}, {1,4,2,4,1,2,2,1,131}, {1,4,2,5,1,1,2,1,126},
+	{1,5,2,1,1,1,2,4,41}, {1,5,2,1,1,2,2,3,207}, {1,5,2,1,1,3,2,2,162}, {1,5,2,1,1,4,2,1,117},
+	{1,5,2,2,1,1,2,3,202}, {1,5,2,2,1,2,2,2,157}, {1,5,2,2,1,3,2,1,112}, {1,5,2,3,1,1,2,2,152},
+	{1,5,2,3,1,2,2,1,107}, {1,5,2,4,1,1,2,1,102}, {1,6,2,1,1,1,2,3,178}, {1,6,2,1,1,2,2,2,133},
+	{1,6,2,1,1,3,2,1,88}, {1,6,2,2,1,1,2,2,128}, {1,6,2,2,1,2,2,1,83}, {1,6,2,3,1,1,2,1,78},
+	{1,1,2,1,2,3,1,6,21}, {1,1,2,1,2,4,1,5,187}, {1,1,2,1,2,5,1,4,142}, {1,1,2,1,2,6,1,3,97},
+	{1,1,2,2,2,2,1,6,16}, {1,1,2,2,2,3,1,5,182}, {1,1,2,2,2,4,1,4,137}, {1,1,2,2,2,5,1,3,92},
+	{1,1,2,2,2,6,1,2,47}, {1,1,2,3,2,1,1,6,11}, {1,1,2,3,2,2,1,5,177}, {1,1,2,3,2,3,1,4,132},
+	{1,1,2,3,2,4,1,3,87}, {1,1,2,3,2,5,1,2,42}, {1,1,2,3,2,6,1,1,208}, {1,1,2,4,2,1,1,5,172},
+	{1,1,2,4,2,2,1,4,127}, {1,1,2,4,2,3,1,3,82}, {1,1,2,4,2,4,1,2,37}, {1,1,2,4,2,5,1,1,203},
+	{1,1,2,5,2,1,1,4,122}, {1,1,2,5,2,2,1,3,77}, {1,1,2,5,2,3,1,2,32}, {1,1,2,5,2,4,1,1,198},
+	{1,1,2,6,2,1,1,3,72}, {1,1,2,6,2,2,1,2,27}, {1,1,2,6,2,3,1,1,193}, {1,2,2,1,2,2,1,6,203},
+	{1,2,2,1,2,3,1,5,158}, {1,2,2,1,2,4,1,4,113}, {1,2,2,1,2,5,1,3,68}, {1,2,2,1,2,6,1,2,23},
+	{1,2,2,2,2,1,1,6,198}, {1,2,2,2,2,2,1,5,153}, {1,2,2,2,2,3,1,4,108}, {1,2,2,2,2,4,1,3,63},
+	{1,2,2,2,2,5,1,2,18}, {1,2,2,2,2,6,1,1,184}, {1,2,2,3,2,1,1,5,148}, {1,2,2,3,2,2,1,4,103},
+	{1,2,2,3,2,3,1,3,58}, {1,2,2,3,2,4,1,2,13}, {1,2,2,3,2,5,1,1,179}, {1,2,2,4,2,1,1,4,98},
+	{1,2,2,4,2,2,1,3,53}, {1,2,2,4,2,3,1,2,8}, {1,2,2,4,2,4,1,1,174}, {1,2,2,5,2,1,1,3,48},
+	{1,2,2,5,2,2,1,2,3}, {1,2,2,5,2,3,1,1,169}, {1,2,2,6,2,1,1,2,209}, {1,2,2,6,2,2,1,1,164},
+	{1,3,2,1,2,1,1,6,174}, {1,3,2,1,2,2,1,5,129}, {1,3,2,1,2,3,1,4,84}, {1,3,2,1,2,4,1,3,39},
+	{1,3,2,1,2,5,1,2,205}, {1,3,2,1,2,6,1,1,160}, {1,3,2,2,2,1,1,5,124}, {1,3,2,2,2,2,1,4,79},
+	{1,3,2,2,2,3,1,3,34}, {1,3,2,2,2,4,1,2,200}, {1,3,2,2,2,5,1,1,155}, {1,3,2,3,2,1,1,4,74},
+	{1,3,2,3,2,2,1,3,29}, {1,3,2,3,2,3,1,2,195}, {1,3,2,3,2,4,1,1,150}, {1,3,2,4,2,1,1,3,24},
+	{1,3,2,4,2,2,1,2,190}, {1,3,2,4,2,3,1,1,145}, {1,3,2,5,2,1,1,2,185}, {1,3,2,5,2,2,1,1,140},
+	{1,3,2,6,2,1,1,1,135}, {1,4,2,1,2,1,1,5,100}, {1,4,2,1,2,2,1,4,55}, {1,4,2,1,2,3,1,3,10},
+	{1,4,2,1,2,4,1,2,176}, {1,4,2,1,2,5,1,1,131}, {1,4,2,2,2,1,1,4,50}, {1,4,2,2,2,2,1,3,5},
+	{1,4,2,2,2,3,1,2,171}, {1,4,2,2,2,4,1,1,126}, {1,4,2,3,2,1,1,3,0}, {1,4,2,3,2,2,1,2,166},
+	{1,4,2,3,2,3,1,1,121}, {1,4,2,4,2,1,1,2,161}, {1,4,2,4,2,2,1,1,116}, {1,4,2,5,2,1,1,1,111},
+	{1,5,2,1,2,1,1,4,26}, {1,5,2,1,2,2,1,3,192}, {1,5,2,1,2,3,1,2,147}, {1,5,2,1,2,4,1,1,102},
+	{1,5,2,2,2,1,1,3,187}, {1,5,2,2,2,2,1,2,142}, {1,5,2,2,2,3,1,1,97}, {1,5,2,3,2,1,1,2,137},
+	{1,5,2,3,2,2,1,1,92}, {1,5,2,4,2,1,1,1,87}, {1,6,2,1,2,1,1,3,163}, {1,6,2,1,2,2,1,2,118},
+	{1,6,2,1,2,3,1,1,73}, {1,6,2,2,2,1,1,2,113}, {1,6,2,2,2,2,1,1,68}, {1,6,2,3,2,1,1,1,63},
+	{1,1,3,1,1,3,1,6,160}, {1,1,3,1,1,4,1,5,115}, {1,1,3,1,1,5,1,4,70}, {1,1,3,1,1,6,1,3,25},
+	{1,1,3,2,1,2,1,6,155}, {1,1,3,2,1,3,1,5,110}, {1,1,3,2,1,4,1,4,65}, {1,1,3,2,1,5,1,3,20},
+	{1,1,3,2,1,6,1,2,186}, {1,1,3,3,1,1,1,6,150}, {1,1,3,3,1,2,1,5,105}, {1,1,3,3,1,3,1,4,60},
+	{1,1,3,3,1,4,1,3,15}, {1,1,3,3,1,5,1,2,181}, {1,1,3,3,1,6,1,1,136}, {1,1,3,4,1,1,1,5,100},
+	{1,1,3,4,1,2,1,4,55}, {1,1,3,4,1,3,1,3,10}, {1,1,3,4,1,4,1,2,176}, {1,1,3,4,1,5,1,1,131},
+	{1,1,3,5,1,1,1,4,50}, {1,1,3,5,1,2,1,3,5}, {1,1,3,5,1,3,1,2,171}, {1,1,3,5,1,4,1,1,126},
+	{1,1,3,6,1,1,1,3,0}, {1,1,3,6,1,2,1,2,166}, {1,1,3,6,1,3,1,1,121}, {1,2,3,1,1,2,1,6,131},
+	{1,2,3,1,1,3,1,5,86}, {1,2,3,1,1,4,1,4,41}, {1,2,3,1,1,5,1,3,207}, {1,2,3,1,1,6,1,2,162},
+	{1,2,3,2,1,1,1,6,126}, {1,2,3,2,1,2,1,5,81}, {1,2,3,2,1,3,1,4,36}, {1,2,3,2,1,4,1,3,202},
+	{1,2,3,2,1,5,1,2,157}, {1,2,3,2,1,6,1,1,112}, {1,2,3,3,1,1,1,5,76}, {1,2,3,3,1,2,1,4,31},
+	{1,2,3,3,1,3,1,3,197}, {1,2,3,3,1,4,1,2,152}, {1,2,3,3,1,5,1,1,107}, {1,2,3,4,1,1,1,4,26},
+	{1,2,3,4,1,2,1,3,192}, {1,2,3,4,1,3,1,2,147}, {1,2,3,4,1,4,1,1,102}, {1,2,3,5,1,1,1,3,187},
+	{1,2,3,5,1,2,1,2,142}, {1,2,3,5,1,3,1,1,97}, {1,2,3,6,1,1,1,2,137}, {1,2,3,6,1,2,1,1,92},
+	{1,3,3,1,1,1,1,6,102}, {1,3,3,1,1,2,1,5,57}, {1,3,3,1,1,3,1,4,12}, {1,3,3,1,1,4,1,3,178},
+	{1,3,3,1,1,5,1,2,133}, {1,3,3,1,1,6,1,1,88}, {1,3,3,2,1,1,1,5,52}, {1,3,3,2,1,2,1,4,7},
+	{1,3,3,2,1,3,1,3,173}, {1,3,3,2,1,4,1,2,128}, {1,3,3,2,1,5,1,1,83}, {1,3,3,3,1,1,1,4,2},
+	{1,3,3,3,1,2,1,3,168}, {1,3,3,3,1,3,1,2,123}, {1,3,3,3,1,4,1,1,78}, {1,3,3,4,1,1,1,3,163},
+	{1,3,3,4,1,2,1,2,118}, {1,3,3,4,1,3,1,1,73}, {1,3,3,5,1,1,1,2,113}, {1,3,3,5,1,2,1,1,68},
+	{1,3,3,6,1,1,1,1,63}, {1,4,3,1,1,1,1,5,28}, {1,4,3,1,1,2,1,4,194}, {1,4,3,1,1,3,1,3,149},
+	{1,4,3,1,1,4,1,2,104}, {1,4,3,1,1,5,1,1,59}, {1,4,3,2,1,1,1,4,189}, {1,4,3,2,1,2,1,3,144},
+	{1,4,3,2,1,3,1,2,99}, {1,4,3,2,1,4,1,1,54}, {1,4,3,3,1,1,1,3,139}, {1,4,3,3,1,2,1,2,94},
+	{1,4,3,3,1,3,1,1,49}, {1,4,3,4,1,1,1,2,89}, {1,4,3,4,1,2,1,1,44}, {1,4,3,5,1,1,1,1,39},
+	{1,5,3,1,1,1,1,4,165}, {1,5,3,1,1,2,1,3,120}, {1,5,3,1,1,3,1,2,75}, {1,5,3,1,1,4,1,1,30},
+	{1,5,3,2,1,1,1,3,115}, {1,5,3,2,1,2,1,2,70}, {1,5,3,2,1,3,1,1,25}, {1,5,3,3,1,1,1,2,65},
+	{1,5,3,3,1,2,1,1,20}, {1,5,3,4,1,1,1,1,15}, {1,6,3,1,1,1,1,3,91}, {1,6,3,1,1,2,1,2,46},
+	{1,6,3,1,1,3,1,1,1}, {1,6,3,2,1,1,1,2,41}, {1,6,3,2,1,2,1,1,207}, {1,6,3,3,1,1,1,1,202},
+	{2,1,1,1,1,3,2,6,28}, {2,1,1,1,1,4,2,5,194}, {2,1,1,1,1,5,2,4,149}, {2,1,1,1,1,6,2,3,104},
+	{2,1,1,2,1,2,2,6,23}, {2,1,1,2,1,3,2,5,189}, {2,1,1,2,1,4,2,4,144}, {2,1,1,2,1,5,2,3,99},
+	{2,1,1,2,1,6,2,2,54}, {2,1,1,3,1,1,2,6,18}, {2,1,1,3,1,2,2,5,184}, {2,1,1,3,1,3,2,4,139},
+	{2,1,1,3,1,4,2,3,94}, {2,1,1,3,1,5,2,2,49}, {2,1,1,3,1,6,2,1,4}, {2,1,1,4,1,1,2,5,179},
+	{2,1,1,4,1,2,2,4,134}, {2,1,1,4,1,3,2,3,89}, {2,1,1,4,1,4,2,2,44}, {2,1,1,4,1,5,2,1,210},
+	{2,1,1,5,1,1,2,4,129}, {2,1,1,5,1,2,2,3,84}, {2,1,1,5,1,3,2,2,39}, {2,1,1,5,1,4,2,1,205},
+	{2,1,1,6,1,1,2,3,79}, {2,1,1,6,1,2,2,2,34}, {2,1,1,6,1,3,2,1,200}, {2,2,1,1,1,2,2,6,210},
+	{2,2,1,1,1,3,2,5,165}, {2,2,1,1,1,4,2,4,120}, {2,2,1,1,1,5,2,3,75}, {2,2,1,1,1,6,2,2,30},
+	{2,2,1,2,1,1,2,6,205}, {2,2,1,2,1,2,2,5,160}, {2,2,1,2,1,3,2,4,115}, {2,2,1,2,1,4,2,3,70},
+	{2,2,1,2,1,5,2,2,25}, {2,2,1,2,1,6,2,1,191}, {2,2,1,3,1,1,2,5,155}, {2,2,1,3,1,2,2,4,110},
+	{2,2,1,3,1,3,2,3,65}, {2,2,1,3,1,4,2,2,20}, {2,2,1,3,1,5,2,1,186}, {2,2,1,4,1,1,2,4,105},
+	{2,2,1,4,1,2,2,3,60}, {2,2,1,4,1,3,2,2,15}, {2,2,1,4,1,4,2,1,181}, {2,2,1,5,1,1,2,3,55},
+	{2,2,1,5,1,2,2,2,10}, {2,2,1,5,1,3,2,1,176}, {2,2,1,6,1,1,2,2,5}, {2,2,1,6,1,2,2,1,171},
+	{2,3,1,1,1,1,2,6,181}, {2,3,1,1,1,2,2,5,136}, {2,3,1,1,1,3,2,4,91}, {2,3,1,1,1,4,2,3,46},
+	{2,3,1,1,1,5,2,2,1}, {2,3,1,1,1,6,2,1,167}, {2,3,1,2,1,1,2,5,131}, {2,3,1,2,1,2,2,4,86},
+	{2,3,1,2,1,3,2,3,41}, {2,3,1,2,1,4,2,2,207}, {2,3,1,2,1,5,2,1,162}, {2,3,1,3,1,1,2,4,81},
+	{2,3,1,3,1,2,2,3,36}, {2,3,1,3,1,3,2,2,202}, {2,3,1,3,1,4,2,1,157}, {2,3,1,4,1,1,2,3,31},
+	{2,3,1,4,1,2,2,2,197}, {2,3,1,4,1,3,2,1,152}, {2,3,1,5,1,1,2,2,192}, {2,3,1,5,1,2,2,1,147},
+	{2,3,1,6,1,1,2,1,142}, {2,4,1,1,1,1,2,5,107}, {2,4,1,1,1,2,2,4,62}, {2,4,1,1,1,3,2,3,17},
+	{2,4,1,1,1,4,2,2,183}, {2,4,1,1,1,5,2,1,138}, {2,4,1,2,1,1,2,4,57}, {2,4,1,2,1,2,2,3,12},
+	{2,4,1,2,1,3,2,2,178}, {2,4,1,2,1,4,2,1,133}, {2,4,1,3,1,1,2,3,7}, {2,4,1,3,1,2,2,2,173},
+	{2,4,1,3,1,3,2,1,128}, {2,4,1,4,1,1,2,2,168}, {2,4,1,4,1,2,2,1,123}, {2,4,1,5,1,1,2,1,118},
+	{2,5,1,1,1,1,2,4,33}, {2,5,1,1,1,2,2,3,199}, {2,5,1,1,1,3,2,2,154}, {2,5,1,1,1,4,2,1,109},
+	{2,5,1,2,1,1,2,3,194}, {2,5,1,2,1,2,2,2,149}, {2,5,1,2,1,3,2,1,104}, {2,5,1,3,1,1,2,2,144},
+	{2,5,1,3,1,2,2,1,99}, {2,5,1,4,1,1,2,1,94}, {2,6,1,1,1,1,2,3,170}, {2,6,1,1,1,2,2,2,125},
+	{2,6,1,1,1,3,2,1,80}, {2,6,1,2,1,1,2,2,120}, {2,6,1,2,1,2,2,1,75}, {2,6,1,3,1,1,2,1,70},
+	{2,1,1,1,2,3,1,6,13}, {2,1,1,1,2,4,1,5,179}, {2,1,1,1,2,5,1,4,134}, {2,1,1,1,2,6,1,3,89},
+	{2,1,1,2,2,2,1,6,8}, {2,1,1,2,2,3,1,5,174}, {2,1,1,2,2,4,1,4,129}, {2,1,1,2,2,5,1,3,84},
+	{2,1,1,2,2,6,1,2,39}, {2,1,1,3,2,1,1,6,3}, {2,1,1,3,2,2,1,5,169}, {2,1,1,3,2,3,1,4,124},
+	{2,1,1,3,2,4,1,3,79}, {2,1,1,3,2,5,1,2,34}, {2,1,1,3,2,6,1,1,200}, {2,1,1,4,2,1,1,5,164},
+	{2,1,1,4,2,2,1,4,119}, {2,1,1,4,2,3,1,3,74}, {2,1,1,4,2,4,1,2,29}, {2,1,1,4,2,5,1,1,195},
+	{2,1,1,5,2,1,1,4,114}, {2,1,1,5,2,2,1,3,69}, {2,1,1,5,2,3,1,2,24}, {2,1,1,5,2,4,1,1,190},
+	{2,1,1,6,2,1,1,3,64}, {2,1,1,6,2,2,1,2,19}, {2,1,1,6,2,3,1,1,185}, {2,2,1,1,2,2,1,6,195},
+	{2,2,1,1,2,3,1,5,150}, {2,2,1,1,2,4,1,4,105}, {2,2,1,1,2,5,1,3,60}, {2,2,1,1,2,6,1,2,15},
+	{2,2,1,2,2,1,1,6,190}, {2,2,1,2,2,2,1,5,145}, {2,2,1,2,2,3,1,4,100}, {2,2,1,2,2,4,1,3,55},
+	{2,2,1,2,2,5,1,2,10}, {2,2,1,2,2,6,1,1,176}, {2,2,1,3,2,1,1,5,140}, {2,2,1,3,2,2,1,4,95},
+	{2,2,1,3,2,3,1,3,50}, {2,2,1,3,2,4,1,2,5}, {2,2,1,3,2,5,1,1,171}, {2,2,1,4,2,1,1,4,90},
+	{2,2,1,4,2,2,1,3,45}, {2,2,1,4,2,3,1,2,0}, {2,2,1,4,2,4,1,1,166}, {2,2,1,5,2,1,1,3,40},
+	{2,2,1,5,2,2,1,2,206}, {2,2,1,5,2,3,1,1,161}, {2,2,1,6,2,1,1,2,201}, {2,2,1,6,2,2,1,1,156},
+	{2,3,1,1,2,1,1,6,166}, {2,3,1,1,2,2,1,5,121}, {2,3,1,1,2,3,1,4,76}, {2,3,1,1,2,4,1,3,31},
+	{2,3,1,1,2,5,1,2,197}, {2,3,1,1,2,6,1,1,152}, {2,3,1,2,2,1,1,5,116}, {2,3,1,2,2,2,1,4,71},
+	{2,3,1,2,2,3,1,3,26}, {2,3,1,2,2,4,1,2,192}, {2,3,1,2,2,5,1,1,147}, {2,3,1,3,2,1,1,4,66},
+	{2,3,1,3,2,2,1,3,21}, {2,3,1,3,2,3,1,2,187}, {2,3,1,3,2,4,1,1,142}, {2,3,1,4,2,1,1,3,16},
+	{2,3,1,4,2,2,1,2,182}, {2,3,1,4,2,3,1,1,137}, {2,3,1,5,2,1,1,2,177}, {2,3,1,5,2,2,1,1,132},
+	{2,3,1,6,2,1,1,1,127}, {2,4,1,1,2,1,1,5,92}, {2,4,1,1,2,2,1,4,47}, {2,4,1,1,2,3,1,3,2},
+	{2,4,1,1,2,4,1,2,168}, {2,4,1,1,2,5,1,1,123}, {2,4,1,2,2,1,1,4,42}, {2,4,1,2,2,2,1,3,208},
+	{2,4,1,2,2,3,1,2,163}, {2,4,1,2,2,4,1,1,118}, {2,4,1,3,2,1,1,3,203}, {2,4,1,3,2,2,1,2,158},
+	{2,4,1,3,2,3,1,1,113}, {2,4,1,4,2,1,1,2,153}, {2,4,1,4,2,2,1,1,108}, {2,4,1,5,2,1,1,1,103},
+	{2,5,1,1,2,1,1,4,18}, {2,5,1,1,2,2,1,3,184}, {2,5,1,1,2,3,1,2,139}, {2,5,1,1,2,4,1,1,94},
+	{2,5,1,2,2,1,1,3,179}, {2,5,1,2,2,2,1,2,134}, {2,5,1,2,2,3,1,1,89}, {2,5,1,3,2,1,1,2,129},
+	{2,5,1,3,2,2,1,1,84}, {2,5,1,4,2,1,1,1,79}, {2,6,1,1,2,1,1,3,155}, {2,6,1,1,2,2,1,2,110},
+	{2,6,1,1,2,3,1,1,65}, {2,6,1,2,2,1,1,2,105}, {2,6,1,2,2,2,1,1,60}, {2,6,1,3,2,1,1,1,55},
+	{2,1,2,1,1,3,1,6,152}, {2,1,2,1,1,4,1,5,107}, {2,1,2,1,1,5,1,4,62}, {2,1,2,1,1,6,1,3,17},
+	{2,1,2,2,1,2,1,6,147}, {2,1,2,2,1,3,1,5,102}, {2,1,2,2,1,4,1,4,57}, {2,1,2,2,1,5,1,3,12},
+	{2,1,2,2,1,6,1,2,178}, {2,1,2,3,1,1,1,6,142}, {2,1,2,3,1,2,1,5,97}, {2,1,2,3,1,3,1,4,52},
+	{2,1,2,3,1,4,1,3,7}, {2,1,2,3,1,5,1,2,173}, {2,1,2,3,1,6,1,1,128}, {2,1,2,4,1,1,1,5,92},
+	{2,1,2,4,1,2,1,4,47}, {2,1,2,4,1,3,1,3,2}, {2,1,2,4,1,4,1,2,168}, {2,1,2,4,1,5,1,1,123},
+	{2,1,2,5,1,1,1,4,42}, {2,1,2,5,1,2,1,3,208}, {2,1,2,5,1,3,1,2,163}, {2,1,2,5,1,4,1,1,118},
+	{2,1,2,6,1,1,1,3,203}, {2,1,2,6,1,2,1,2,158}, {2,1,2,6,1,3,1,1,113}, {2,2,2,1,1,2,1,6,123},
+	{2,2,2,1,1,3,1,5,78}, {2,2,2,1,1,4,1,4,33}, {2,2,2,1,1,5,1,3,199}, {2,2,2,1,1,6,1,2,154},
+	{2,2,2,2,1,1,1,6,118}, {2,2,2,2,1,2,1,5,73}, {2,2,2,2,1,3,1,4,28}, {2,2,2,2,1,4,1,3,194},
+	{2,2,2,2,1,5,1,2,149}, {2,2,2,2,1,6,1,1,104}, {2,2,2,3,1,1,1,5,68}, {2,2,2,3,1,2,1,4,23},
+	{2,2,2,3,1,3,1,3,189}, {2,2,2,3,1,4,1,2,144}, {2,2,2,3,1,5,1,1,99}, {2,2,2,4,1,1,1,4,18},
+	{2,2,2,4,1,2,1,3,184}, {2,2,2,4,1,3,1,2,139}, {2,2,2,4,1,4,1,1,94}, {2,2,2,5,1,1,1,3,179},
+	{2,2,2,5,1,2,1,2,134}, {2,2,2,5,1,3,1,1,89}, {2,2,2,6,1,1,1,2,129}, {2,2,2,6,1,2,1,1,84},
+	{2,3,2,1,1,1,1,6,94}, {2,3,2,1,1,2,1,5,49}, {2,3,2,1,1,3,1,4,4}, {2,3,2,1,1,4,1,3,170},
+	{2,3,2,1,1,5,1,2,125}, {2,3,2,1,1,6,1,1,80}, {2,3,2,2,1,1,1,5,44}, {2,3,2,2,1,2,1,4,210},
+	{2,3,2,2,1,3,1,3,165}, {2,3,2,2,1,4,1,2,120}, {2,3,2,2,1,5,1,1,75}, {2,3,2,3,1,1,1,4,205},
+	{2,3,2,3,1,2,1,3,160}, {2,3,2,3,1,3,1,2,115}, {2,3,2,3,1,4,1,1,70}, {2,3,2,4,1,1,1,3,155},
+	{2,3,2,4,1,2,1,2,110}, {2,3,2,4,1,3,1,1,65}, {2,3,2,5,1,1,1,2,105}, {2,3,2,5,1,2,1,1,60},
+	{2,3,2,6,1,1,1,1,55}, {2,4,2,1,1,1,1,5,20}, {2,4,2,1,1,2,1,4,186}, {2,4,2,1,1,3,1,3,141},
+	{2,4,2,1,1,4,1,2,96}, {2,4,2,1,1,5,1,1,51}, {2,4,2,2,1,1,1,4,181}, {2,4,2,2,1,2,1,3,136},
+	{2,4,2,2,1,3,1,2,91}, {2,4,2,2,1,4,1,1,46}, {2,4,2,3,1,1,1,3,131}, {2,4,2,3,1,2,1,2,86},
+	{2,4,2,3,1,3,1,1,41}, {2,4,2,4,1,1,1,2,81}, {2,4,2,4,1,2,1,1,36}, {2,4,2,5,1,1,1,1,31},
+	{2,5,2,1,1,1,1,4,157}, {2,5,2,1,1,2,1,3,112}, {2,5,2,1,1,3,1,2,67}, {2,5,2,1,1,4,1,1,22},
+	{2,5,2,2,1,1,1,3,107}, {2,5,2,2,1,2,1,2,62}, {2,5,2,2,1,3,1,1,17}, {2,5,2,3,1,1,1,2,57},
+	{2,5,2,3,1,2,1,1,12}, {2,5,2,4,1,1,1,1,7}, {2,6,2,1,1,1,1,3,83}, {2,6,2,1,1,2,1,2,38},
+	{2,6,2,1,1,3,1,1,204}, {2,6,2,2,1,1,1,2,33}, {2,6,2,2,1,2,1,1,199}, {2,6,2,3,1,1,1,1,194},
+	{3,1,1,1,1,3,1,6,144}, {3,1,1,1,1,4,1,5,99}, {3,1,1,1,1,5,1,4,54}, {3,1,1,1,1,6,1,3,9},
+	{3,1,1,2,1,2,1,6,139}, {3,1,1,2,1,3,1,5,94}, {3,1,1,2,1,4,1,4,49}, {3,1,1,2,1,5,1,3,4},
+	{3,1,1,2,1,6,1,2,170}, {3,1,1,3,1,1,1,6,134}, {3,1,1,3,1,2,1,5,89}, {3,1,1,3,1,3,1,4,44},
+	{3,1,1,3,1,4,1,3,210}, {3,1,1,3,1,5,1,2,165}, {3,1,1,3,1,6,1,1,120}, {3,1,1,4,1,1,1,5,84},
+	{3,1,1,4,1,2,1,4,39}, {3,1,1,4,1,3,1,3,205}, {3,1,1,4,1,4,1,2,160}, {3,1,1,4,1,5,1,1,115},
+	{3,1,1,5,1,1,1,4,34}, {3,1,1,5,1,2,1,3,200}, {3,1,1,5,1,3,1,2,155}, {3,1,1,5,1,4,1,1,110},
+	{3,1,1,6,1,1,1,3,195}, {3,1,1,6,1,2,1,2,150}, {3,1,1,6,1,3,1,1,105}, {3,2,1,1,1,2,1,6,115},
+	{3,2,1,1,1,3,1,5,70}, {3,2,1,1,1,4,1,4,25}, {3,2,1,1,1,5,1,3,191}, {3,2,1,1,1,6,1,2,146},
+	{3,2,1,2,1,1,1,6,110}, {3,2,1,2,1,2,1,5,65}, {3,2,1,2,1,3,1,4,20}, {3,2,1,2,1,4,1,3,186},
+	{3,2,1,2,1,5,1,2,141}, {3,2,1,2,1,6,1,1,96}, {3,2,1,3,1,1,1,5,60}, {3,2,1,3,1,2,1,4,15},
+	{3,2,1,3,1,3,1,3,181}, {3,2,1,3,1,4,1,2,136}, {3,2,1,3,1,5,1,1,91}, {3,2,1,4,1,1,1,4,10},
+	{3,2,1,4,1,2,1,3,176}, {3,2,1,4,1,3,1,2,131}, {3,2,1,4,1,4,1,1,86}, {3,2,1,5,1,1,1,3,171},
+	{3,2,1,5,1,2,1,2,126}, {3,2,1,5,1,3,1,1,81}, {3,2,1,6,1,1,1,2,121}, {3,2,1,6,1,2,1,1,76},
+	{3,3,1,1,1,1,1,6,86}, {3,3,1,1,1,2,1,5,41}, {3,3,1,1,1,3,1,4,207}, {3,3,1,1,1,4,1,3,162},
+	{3,3,1,1,1,5,1,2,117}, {3,3,1,1,1,6,1,1,72}, {3,3,1,2,1,1,1,5,36}, {3,3,1,2,1,2,1,4,202},
+	{3,3,1,2,1,3,1,3,157}, {3,3,1,2,1,4,1,2,112}, {3,3,1,2,1,5,1,1,67}, {3,3,1,3,1,1,1,4,197},
+	{3,3,1,3,1,2,1,3,152}, {3,3,1,3,1,3,1,2,107}, {3,3,1,3,1,4,1,1,62}, {3,3,1,4,1,1,1,3,147},
+	{3,3,1,4,1,2,1,2,102}, {3,3,1,4,1,3,1,1,57}, {3,3,1,5,1,1,1,2,97}, {3,3,1,5,1,2,1,1,52},
+	{3,3,1,6,1,1,1,1,47}, {3,4,1,1,1,1,1,5,12}, {3,4,1,1,1,2,1,4,178}, {3,4,1,1,1,3,1,3,133},
+	{3,4,1,1,1,4,1,2,88}, {3,4,1,1,1,5,1,1,43}, {3,4,1,2,1,1,1,4,173}, {3,4,1,2,1,2,1,3,128},
+	{3,4,1,2,1,3,1,2,83}, {3,4,1,2,1,4,1,1,38}, {3,4,1,3,1,1,1,3,123}, {3,4,1,3,1,2,1,2,78},
+	{3,4,1,3,1,3,1,1,33}, {3,4,1,4,1,1,1,2,73}, {3,4,1,4,1,2,1,1,28}, {3,4,1,5,1,1,1,1,23},
+	{3,5,1,1,1,1,1,4,149}, {3,5,1,1,1,2,1,3,104}, {3,5,1,1,1,3,1,2,59}, {3,5,1,1,1,4,1,1,14},
+	{3,5,1,2,1,1,1,3,99}, {3,5,1,2,1,2,1,2,54}, {3,5,1,2,1,3,1,1,9}, {3,5,1,3,1,1,1,2,49},
+	{3,5,1,3,1,2,1,1,4}, {3,5,1,4,1,1,1,1,210}, {3,6,1,1,1,1,1,3,75}, {3,6,1,1,1,2,1,2,30},
+	{3,6,1,1,1,3,1,1,196}, {3,6,1,2,1,1,1,2,25}, {3,6,1,2,1,2,1,1,191}, {3,6,1,3,1,1,1,1,186},
+	{1,1,1,1,1,3,1,8,85}, {1,1,1,1,1,4,1,7,40}, {1,1,1,1,1,5,1,6,206}, {1,1,1,1,1,6,1,5,161},
+	{1,1,1,1,1,7,1,4,116}, {1,1,1,1,1,8,1,3,71}, {1,1,1,2,1,2,1,8,80}, {1,1,1,2,1,3,1,7,35},
+	{1,1,1,2,1,4,1,6,201}, {1,1,1,2,1,5,1,5,156}, {1,1,1,2,1,6,1,4,111}, {1,1,1,2,1,7,1,3,66},
+	{1,1,1,2,1,8,1,2,21}, {1,1,1,3,1,1,1,8,75}, {1,1,1,3,1,2,1,7,30}, {1,1,1,3,1,3,1,6,196},
+	{1,1,1,3,1,4,1,5,151}, {1,1,1,3,1,5,1,4,106}, {1,1,1,3,1,6,1,3,61}, {1,1,1,3,1,7,1,2,16},
+	{1,1,1,3,1,8,1,1,182}, {1,1,1,4,1,1,1,7,25}, {1,1,1,4,1,2,1,6,191}, {1,1,1,4,1,3,1,5,146},
+	{1,1,1,4,1,4,1,4,101}, {1,1,1,4,1,5,1,3,56}, {1,1,1,4,1,6,1,2,11}, {1,1,1,4,1,7,1,1,177},
+	{1,1,1,5,1,1,1,6,186}, {1,1,1,5,1,2,1,5,141}, {1,1,1,5,1,3,1,4,96}, {1,1,1,5,1,4,1,3,51},
+	{1,1,1,5,1,5,1,2,6}, {1,1,1,5,1,6,1,1,172}, {1,1,1,6,1,1,1,5,136}, {1,1,1,6,1,2,1,4,91},
+	{1,1,1,6,1,3,1,3,46}, {1,1,1,6,1,4,1,2,1}, {1,1,1,6,1,5,1,1,167}, {1,1,1,7,1,1,1,4,86},
+	{1,1,1,7,1,2,1,3,41}, {1,1,1,7,1,3,1,2,207}, {1,1,1,7,1,4,1,1,162}, {1,1,1,8,1,1,1,3,36},
+	{1,1,1,8,1,2,1,2,202}, {1,1,1,8,1,3,1,1,157}, {1,2,1,1,1,2,1,8,56}, {1,2,1,1,1,3,1,7,11},
+	{1,2,1,1,1,4,1,6,177}, {1,2,1,1,1,5,1,5,132}, {1,2,1,1,1,6,1,4,87}, {1,2,1,1,1,7,1,3,42},
+	{1,2,1,1,1,8,1,2,208}, {1,2,1,2,1,1,1,8,51}, {1,2,1,2,1,2,1,7,6}, {1,2,1,2,1,3,1,6,172},
+	{1,2,1,2,1,4,1,5,127}, {1,2,1,2,1,5,1,4,82}, {1,2,1,2,1,6,1,3,37}, {1,2,1,2,1,7,1,2,203},
+	{1,2,1,2,1,8,1,1,158}, {1,2,1,3,1,1,1,7,1}, {1,2,1,3,1,2,1,6,167}, {1,2,1,3,1,3,1,5,122},
+	{1,2,1,3,1,4,1,4,77}, {1,2,1,3,1,5,1,3,32}, {1,2,1,3,1,6,1,2,198}, {1,2,1,3,1,7,1,1,153},
+	{1,2,1,4,1,1,1,6,162}, {1,2,1,4,1,2,1,5,117}, {1,2,1,4,1,3,1,4,72}, {1,2,1,4,1,4,1,3,27},
+	{1,2,1,4,1,5,1,2,193}, {1,2,1,4,1,6,1,1,148}, {1,2,1,5,1,1,1,5,112}, {1,2,1,5,1,2,1,4,67},
+	{1,2,1,5,1,3,1,3,22}, {1,2,1,5,1,4,1,2,188}, {1,2,1,5,1,5,1,1,143}, {1,2,1,6,1,1,1,4,62},
+	{1,2,1,6,1,2,1,3,17}, {1,2,1,6,1,3,1,2,183}, {1,2,1,6,1,4,1,1,138}, {1,2,1,7,1,1,1,3,12},
+	{1,2,1,7,1,2,1,2,178}, {1,2,1,7,1,3,1,1,133}, {1,2,1,8,1,1,1,2,173}, {1,2,1,8,1,2,1,1,128},
+	{1,3,1,1,1,1,1,8,27}, {1,3,1,1,1,2,1,7,193}, {1,3,1,1,1,3,1,6,148}, {1,3,1,1,1,4,1,5,103},
+	{1,3,1,1,1,5,1,4,58}, {1,3,1,1,1,6,1,3,13}, {1,3,1,1,1,7,1,2,179}, {1,3,1,1,1,8,1,1,134},
+	{1,3,1,2,1,1,1,7,188}, {1,3,1,2,1,2,1,6,143}, {1,3,1,2,1,3,1,5,98}, {1,3,1,2,1,4,1,4,53},
+	{1,3,1,2,1,5,1,3,8}, {1,3,1,2,1,6,1,2,174}, {1,3,1,2,1,7,1,1,129}, {1,3,1,3,1,1,1,6,138},
+	{1,3,1,3,1,2,1,5,93}, {1,3,1,3,1,3,1,4,48}, {1,3,1,3,1,4,1,3,3}, {1,3,1,3,1,5,1,2,169}
+};
+
+// RSS Limited 26,7 odd and even width sets by group, four bits per element,
+// first element highest
+const uint32_t gs1_rssLimSets[RSSLIM_WIDTH_SETS] = {
+	0x1111166, 0x1111256, 0x1111265, 0x1111346, 0x1111355, 0x1111364, 0x1111436, 0x1111445,
+	0x1111454, 0x1111463, 0x1111526, 0x1111535, 0x1111544, 0x1111553, 0x1111562, 0x1111616,
+	0x1111625, 0x1111634, 0x1111643, 0x1111652, 0x1111661, 0x1112156, 0x1112165, 0x1112246,
+	0x1112255, 0x1112264, 0x1112336, 0x1112345, 0x1112354, 0x1112363, 0x1112426, 0x1112435,
+	0x1112444, 0x1112453, 0x1112462, 0x1112516, 0x1112525, 0x1112534, 0x1112543, 0x1112552,
+	0x1112561, 0x1112615, 0x1112624, 0x1112633, 0x1112642, 0x1112651, 0x1113146, 0x1113155,
+	0x1113164, 0x1113236, 0x1113245, 0x1113254, 0x1113263, 0x1113326, 0x1113335, 0x1113344,
+	0x1113353, 0x1113362, 0x1113416, 0x1113425, 0x1113434, 0x1113443, 0x1113452, 0x1113461,
+	0x1113515, 0x1113524, 0x1113533, 0x1113542, 0x1113551, 0x1113614, 0x1113623, 0x1113632,
+	0x1113641, 0x1114136, 0x1114145, 0x1114154, 0x1114163, 0x1114226, 0x1114235, 0x1114244,
+	0x1114253, 0x1114262, 0x1114316, 0x1114325, 0x1114334, 0x1114343, 0x1114352, 0x1114361,
+	0x1114415, 0x1114424, 0x1114433, 0x1114442, 0x1114451, 0x1114514, 0x1114523, 0x1114532,
+	0x1114541, 0x1114613, 0x1114622, 0x1114631, 0x1115126, 0x1115135, 0x1115144, 0x1115153,
+	0x1115162, 0x1115216, 0x1115225, 0x1115234, 0x1115243, 0x1115252, 0x1115261, 0x1115315,
+	0x1115324, 0x1115333, 0x1115342, 0x1115351, 0x1115414, 0x1115423, 0x1115432, 0x1115441,
+	0x1115513, 0x1115522, 0x1115531, 0x1115612, 0x1115621, 0x1116116, 0x1116125, 0x1116134,
+	0x1116143, 0x1116152, 0x1116161, 0x1116215, 0x1116224, 0x1116233, 0x1116242, 0x1116251,
+	0x1116314, 0x1116323, 0x1116332, 0x1116341, 0x1116413, 0x1116422, 0x1116431, 0x1116512,
+	0x1116521, 0x1116611, 0x1121156, 0x1121165, 0x1121246, 0x1121255, 0x1121264, 0x1121336,
+	0x1121345, 0x1121354, 0x1121363, 0x1121426, 0x1121435, 0x1121444, 0x1121453, 0x1121462,
+	0x1121516, 0x1121525, 0x1121534, 0x1121543, 0x1121552, 0x1121561, 0x1121615, 0x1121624,
+	0x1121633, 0x1121642, 0x1121651, 0x1122146, 0x1122155, 0x1122164, 0x1122236, 0x1122245,
+	0x1122254, 0x1122263, 0x1122326, 0x1122335, 0x1122344, 0x1122353, 0x1122362, 0x1122416,
+	0x1122425, 0x1122434, 0x1122443, 0x1122452, 0x1122461, 0x1122515, 0x1122524, 0x1122533,
+	0x1122542, 0x1122551, 0x1122614, 0x1122623, 0x1122632, 0x1122641, 0x1123136, 0x1123145,
+	0x1123154, 0x1123163, 0x1123226, 0x1123235, 0x1123244, 0x1123253, 0x1123262, 0x1123316,
+	0x1123325, 0x1123334, 0x1123343, 0x1123352, 0x1123361, 0x1123415, 0x1123424, 0x1123433,
+	0x1123442, 0x1123451, 0x1123514, 0x1123523, 0x1123532, 0x1123541, 0x1123613, 0x1123622,
+	0x1123631, 0x1124126, 0x1124135, 0x1124144, 0x1124153, 0x1124162, 0x1124216, 0x1124225,
+	0x1124234, 0x1124243, 0x1124252, 0x1124261, 0x1124315, 0x1124324, 0x1124333, 0x1124342,
+	0x1124351, 0x1124414, 0x1124423, 0x1124432, 0x1124441, 0x1124513, 0x1124522, 0x1124531,
+	0x1124612, 0x1124621, 0x1125116, 0x1125125, 0x1125134, 0x1125143, 0x1125152, 0x1125161,
+	0x1125215, 0x1125224, 0x1125233, 0x1125242, 0x1125251, 0x1125314, 0x1125323, 0x1125332,
+	0x1125341, 0x1125413, 0x1125422, 0x1125431, 0x1125512, 0x1125521, 0x1125611, 0x1126115,
+	0x1126124, 0x1126133, 0x1126142, 0x1126151, 0x1126214, 0x1126223, 0x1126232, 0x1126241,
+	0x1126313, 0x1126322, 0x1126331, 0x1126412, 0x1126421, 0x1126511, 0x1131146, 0x1131155,
+	0x1131164, 0x1131236, 0x1131245, 0x1131254, 0x1131263, 0x1131326, 0x1131335, 0x1131344,
+	0x1131353, 0x1131362, 0x1131416, 0x1131425, 0x1131434, 0x1131443, 0x1131452, 0x1131461,
+	0x1131515, 0x1131524, 0x1131533, 0x1131542, 0x1131551, 0x1131614, 0x1131623, 0x1131632,
+	0x1131641, 0x1132136, 0x1132145, 0x1132154, 0x1132163, 0x1132226, 0x1132235, 0x1132244,
+	0x1132253, 0x1132262, 0x1132316, 0x1132325, 0x1132334, 0x1132343, 0x1132352, 0x1132361,
+	0x1132415, 0x1132424, 0x1132433, 0x1132442, 0x1132451, 0x1132514, 0x1132523, 0x1132532,
+	0x1132541, 0x1132613, 0x1132622, 0x1132631, 0x1133126, 0x1133135, 0x1133144, 0x1133153,
+	0x1133162, 0x1133216, 0x1133225, 0x1133234, 0x1133243, 0x1133252, 0x1133261, 0x1133315,
+	0x1133324, 0x1133333, 0x1133342, 0x1133351, 0x1133414, 0x1133423, 0x1133432, 0x1133441,
+	0x1133513, 0x1133522, 0x1133531, 0x1133612, 0x1133621, 0x1134116, 0x1134125, 0x1134134,
+	0x1134143, 0x1134152, 0x1134161, 0x1134215, 0x1134224, 0x1134233, 0x1134242, 0x1134251,
+	0x1134314, 0x1134323, 0x1134332, 0x1134341, 0x1134413, 0x1134422, 0x1134431, 0x1134512,
+	0x1134521, 0x1134611, 0x1135115, 0x1135124, 0x1135133, 0x1135142, 0x1135151, 0x1135214,
+	0x1135223, 0x1135232, 0x1135241, 0x1135313, 0x1135322, 0x1135331, 0x1135412, 0x1135421,
+	0x1135511, 0x1136114, 0x1136123, 0x1136132, 0x1136141, 0x1136213, 0x1136222, 0x1136231,
+	0x1136312, 0x1136321, 0x1136411, 0x1141136, 0x1141145, 0x1141154, 0x1141163, 0x1141226,
+	0x1141235, 0x1141244, 0x1141253, 0x1141262, 0x1141316, 0x1141325, 0x1141334, 0x1141343,
+	0x1141352, 0x1141361, 0x1141415, 0x1141424, 0x1141433, 0x1141442, 0x1141451, 0x1141514,
+	0x1141523, 0x1141532, 0x1141541, 0x1141613, 0x1141622, 0x1141631, 0x1142126, 0x1142135,
+	0x1142144, 0x1142153, 0x1142162, 0x1142216, 0x1142225, 0x1142234, 0x1142243, 0x1142252,
+	0x1142261, 0x1142315, 0x1142324, 0x1142333, 0x1142342, 0x1142351, 0x1142414, 0x1142423,
+	0x1142432, 0x1142441, 0x1142513, 0x1142522, 0x1142531, 0x1142612, 0x1142621, 0x1143116,
+	0x1143125, 0x1143134, 0x1143143, 0x1143152, 0x1143161, 0x1143215, 0x1143224, 0x1143233,
+	0x1143242, 0x1143251, 0x1143314, 0x1143323, 0x1143332, 0x1143341, 0x1143413, 0x1143422,
+	0x1143431, 0x1143512, 0x1143521, 0x1143611, 0x1144115, 0x1144124, 0x1144133, 0x1144142,
+	0x1144151, 0x1144214, 0x1144223, 0x1144232, 0x1144241, 0x1144313, 0x1144322, 0x1144331,
+	0x1144412, 0x1144421, 0x1144511, 0x1145114, 0x1145123, 0x1145132, 0x1145141, 0x1145213,
+	0x1145222, 0x1145231, 0x1145312, 0x1145321, 0x1145411, 0x1146113, 0x1146122, 0x1146131,
+	0x1146212, 0x1146221, 0x1146311, 0x1151126, 0x1151135, 0x1151144, 0x1151153, 0x1151162,
+	0x1151216, 0x1151225, 0x1151234, 0x1151243, 0x1151252, 0x1151261, 0x1151315, 0x1151324,
+	0x1151333, 0x1151342, 0x1151351, 0x1151414, 0x1151423, 0x1151432, 0x1151441, 0x1151513,
+	0x1151522, 0x1151531, 0x1151612, 0x1151621, 0x1152116, 0x1152125, 0x1152134, 0x1152143,
+	0x1152152, 0x1152161, 0x1152215, 0x1152224, 0x1152233, 0x1152242, 0x1152251, 0x1152314,
+	0x1152323, 0x1152332, 0x1152341, 0x1152413, 0x1152422, 0x1152431, 0x1152512, 0x1152521,
+	0x1152611, 0x1153115, 0x1153124, 0x1153133, 0x1153142, 0x1153151, 0x1153214, 0x1153223,
+	0x1153232, 0x1153241, 0x1153313, 0x1153322, 0x1153331, 0x1153412, 0x1153421, 0x1153511,
+	0x1154114, 0x1154123, 0x1154132, 0x1154141, 0x1154213, 0x1154222, 0x1154231, 0x1154312,
+	0x1154321, 0x1154411, 0x1155113, 0x1155122, 0x1155131, 0x1155212, 0x1155221, 0x1155311,
+	0x1156112, 0x1156121, 0x1156211, 0x1161116, 0x1161125, 0x1161134, 0x1161143, 0x1161152,
+	0x1161161, 0x1161215, 0x1161224, 0x1161233, 0x1161242, 0x1161251, 0x1161314, 0x1161323,
+	0x1161332, 0x1161341, 0x1161413, 0x1161422, 0x1161431, 0x1161512, 0x1161521, 0x1161611,
+	0x1162115, 0x1162124, 0x1162133, 0x1162142, 0x1162151, 0x1162214, 0x1162223, 0x1162232,
+	0x1162241, 0x1162313, 0x1162322, 0x1162331, 0x1162412, 0x1162421, 0x1162511, 0x1163114,
+	0x1163123, 0x1163132, 0x1163141, 0x1163213, 0x1163222, 0x1163231, 0x1163312, 0x1163321,
+	0x1163411, 0x1164113, 0x1164122, 0x1164131, 0x1164212, 0x1164221, 0x1164311, 0x1165112,
+	0x1165121, 0x1165211, 0x1166111, 0x1211156, 0x1211165, 0x1211246, 0x1211255, 0x1211264,
+	0x1211336, 0x1211345, 0x1211354, 0x1211363, 0x1211426, 0x1211435, 0x1211444, 0x1211453,
+	0x1211462, 0x1211516, 0x1211525, 0x1211534, 0x1211543, 0x1211552, 0x1211561, 0x1211615,
+	0x1211624, 0x1211633, 0x1211642, 0x1211651, 0x1212146, 0x1212155, 0x1212164, 0x1212236,
+	0x1212245, 0x1212254, 0x1212263, 0x1212326, 0x1212335, 0x1212344, 0x1212353, 0x1212362,
+	0x1212416, 0x1212425, 0x1212434, 0x1212443, 0x1212452, 0x1212461, 0x1212515, 0x1212524,
+	0x1212533, 0x1212542, 0x1212551, 0x1212614, 0x1212623, 0x1212632, 0x1212641, 0x1213136,
+	0x1213145, 0x1213154, 0x1213163, 0x1213226, 0x1213235, 0x1213244, 0x1213253, 0x1213262,
+	0x1213316, 0x1213325, 0x1213334, 0x1213343, 0x1213352, 0x1213361, 0x1213415, 0x1213424,
+	0x1213433, 0x1213442, 0x1213451, 0x1213514, 0x1213523, 0x1213532, 0x1213541, 0x1213613,
+	0x1213622, 0x1213631, 0x1214126, 0x1214135, 0x1214144, 0x1214153, 0x1214162, 0x1214216,
+	0x1214225, 0x1214234, 0x1214243, 0x1214252, 0x1214261, 0x1214315, 0x1214324, 0x1214333,
+	0x1214342, 0x1214351, 0x1214414, 0x1214423, 0x1214432, 0x1214441, 0x1214513, 0x1214522,
+	0x1214531, 0x1214612, 0x1214621, 0x1215116, 0x1215125, 0x1215134, 0x1215143, 0x1215152,
+	0x1215161, 0x1215215, 0x1215224, 0x1215233, 0x1215242, 0x1215251, 0x1215314, 0x1215323,
+	0x1215332, 0x1215341, 0x1215413, 0x1215422, 0x1215431, 0x1215512, 0x1215521, 0x1215611,
+	0x1216115, 0x1216124, 0x1216133, 0x1216142, 0x1216151, 0x1216214, 0x1216223, 0x1216232,
+	0x1216241, 0x1216313, 0x1216322, 0x1216331, 0x1216412, 0x1216421, 0x1216511, 0x1221146,
+	0x1221155, 0x1221164, 0x1221236, 0x1221245, 0x1221254, 0x1221263, 0x1221326, 0x1221335,
+	0x1221344, 0x1221353, 0x1221362, 0x1221416, 0x1221425, 0x1221434, 0x1221443, 0x1221452,
+	0x1221461, 0x1221515, 0x1221524, 0x1221533, 0x1221542, 0x1221551, 0x1221614, 0x1221623,
+	0x1221632, 0x1221641, 0x1222136, 0x1222145, 0x1222154, 0x1222163, 0x1222226, 0x1222235,
+	0x1222244, 0x1222253, 0x1222262, 0x1222316, 0x1222325, 0x1222334, 0x1222343, 0x1222352,
+	0x1222361, 0x1222415, 0x1222424, 0x1222433, 0x1222442, 0x1222451, 0x1222514, 0x1222523,
+	0x1222532, 0x1222541, 0x1222613, 0x1222622, 0x1222631, 0x1223126, 0x1223135, 0x1223144,
+	0x1223153, 0x1223162, 0x1223216, 0x1223225, 0x1223234, 0x1223243, 0x1223252, 0x1223261,
+	0x1223315, 0x1223324, 0x1223333, 0x1223342, 0x1223351, 0x1223414, 0x1223423, 0x1223432,
+	0x1223441, 0x1223513, 0x1223522, 0x1223531, 0x1223612, 0x1223621, 0x1224116, 0x1224125,
+	0x1224134, 0x1224143, 0x1224152, 0x1224161, 0x1224215, 0x1224224, 0x1224233, 0x1224242,
+	0x1224251, 0x1224314, 0x1224323, 0x1224332, 0x1224341, 0x1224413, 0x1224422, 0x1224431,
+	0x1224512, 0x1224521, 0x1224611, 0x1225115, 0x1225124, 0x1225133, 0x1225142, 0x1225151,
+	0x1225214, 0x1225223, 0x1225232, 0x1225241, 0x1225313, 0x1225322, 0x1225331, 0x1225412,
+	0x1225421, 0x1225511, 0x1226114, 0x1226123, 0x1226132, 0x1226141, 0x1226213, 0x1226222,
+	0x1226231, 0x1226312, 0x1226321, 0x1226411, 0x1231136, 0x1231145, 0x1231154, 0x1231163,
+	0x1231226, 0x1231235, 0x1231244, 0x1231253, 0x1231262, 0x1231316, 0x1231325, 0x1231334,
+	0x1231343, 0x1231352, 0x1231361, 0x1231415, 0x1231424, 0x1231433, 0x1231442, 0x1231451,
+	0x1231514, 0x1231523, 0x1231532, 0x1231541, 0x1231613, 0x1231622, 0x1231631, 0x1232126,
+	0x1232135, 0x1232144, 0x1232153, 0x1232162, 0x1232216, 0x1232225, 0x1232234, 0x1232243,
+	0x1232252, 0x1232261, 0x1232315, 0x1232324, 0x1232333, 0x1232342, 0x1232351, 0x1232414,
+	0x1232423, 0x1232432, 0x1232441, 0x1232513, 0x1232522, 0x1232531, 0x1232612, 0x1232621,
+	0x1233116, 0x1233125, 0x1233134, 0x1233143, 0x1233152, 0x1233161, 0x1233215, 0x1233224,
+	0x1233233, 0x1233242, 0x1233251, 0x1233314, 0x1233323, 0x1233332, 0x1233341, 0x1233413,
+	0x1233422, 0x1233431, 0x1233512, 0x1233521, 0x1233611, 0x1234115, 0x1234124, 0x1234133,
+	0x1234142, 0x1234151, 0x1234214, 0x1234223, 0x1234232, 0x1234241, 0x1234313, 0x1234322,
+	0x1234331, 0x1234412, 0x1234421, 0x1234511, 0x1235114, 0x1235123, 0x1235132, 0x1235141,
+	0x1235213, 0x1235222, 0x1235231, 0x1235312, 0x1235321, 0x1235411, 0x1236113, 0x1236122,
+	0x1236131, 0x1236212, 0x1236221, 0x1236311, 0x1241126, 0x1241135, 0x1241144, 0x1241153,
+	0x1241162, 0x1241216, 0x1241225, 0x1241234, 0x1241243, 0x1241252, 0x1241261, 0x1241315,
+	0x1241324, 0x1241333, 0x1241342, 0x1241351, 0x1241414, 0x1241423, 0x1241432, 0x1241441,
+	0x1241513, 0x1241522, 0x1241531, 0x1241612, 0x1241621, 0x1242116, 0x1242125, 0x1242134,
+	0x1242143, 0x1242152, 0x1242161, 0x1242215, 0x1242224, 0x1242233, 0x1242242, 0x1242251,
+	0x1242314, 0x1242323, 0x1242332, 0x1242341, 0x1242413, 0x1242422, 0x1242431, 0x1242512,
+	0x1242521, 0x1242611, 0x1243115, 0x1243124, 0x1243133, 0x1243142, 0x1243151, 0x1243214,
+	0x1243223, 0x1243232, 0x1243241, 0x1243313, 0x1243322, 0x1243331, 0x1243412, 0x1243421,
+	0x1243511, 0x1244114, 0x1244123, 0x1244132, 0x1244141, 0x1244213, 0x1244222, 0x1244231,
+	0x1244312, 0x1244321, 0x1244411, 0x1245113, 0x1245122, 0x1245131, 0x1245212, 0x1245221,
+	0x1245311, 0x1246112, 0x1246121, 0x1246211, 0x1251116, 0x1251125, 0x1251134, 0x1251143,
+	0x1251152, 0x1251161, 0x1251215, 0x1251224, 0x1251233, 0x1251242, 0x1251251, 0x1251314,
+	0x1251323, 0x1251332, 0x1251341, 0x1251413, 0x1251422, 0x1251431, 0x1251512, 0x1251521,
+	0x1251611, 0x1252115, 0x1252124, 0x1252133, 0x1252142, 0x1252151, 0x1252214, 0x1252223,
+	0x1252232, 0x1252241, 0x1252313, 0x1252322, 0x1252331, 0x1252412, 0x1252421, 0x1252511,
+	0x1253114, 0x1253123, 0x1253132, 0x1253141, 0x1253213, 0x1253222, 0x1253231, 0x1253312,
+	0x1253321, 0x1253411, 0x1254113, 0x1254122, 0x1254131, 0x1254212, 0x1254221, 0x1254311,
+	0x1255112, 0x1255121, 0x1255211, 0x1256111, 0x1261115, 0x1261124, 0x1261133, 0x1261142,
+	0x1261151, 0x1261214, 0x1261223, 0x1261232, 0x1261241, 0x1261313, 0x1261322, 0x1261331,
+	0x1261412, 0x1261421, 0x1261511, 0x1262114, 0x1262123, 0x1262132, 0x1262141, 0x1262213,
+	0x1262222, 0x1262231, 0x1262312, 0x1262321, 0x1262411, 0x1263113, 0x1263122, 0x1263131,
+	0x1263212, 0x1263221, 0x1263311, 0x1264112, 0x1264121, 0x1264211, 0x1265111, 0x1311146,
+	0x1311155, 0x1311164, 0x1311236, 0x1311245, 0x1311254, 0x1311263, 0x1311326, 0x1311335,
+	0x1311344, 0x1311353, 0x1311362, 0x1311416, 0x1311425, 0x1311434, 0x1311443, 0x1311452,
+	0x1311461, 0x1311515, 0x1311524, 0x1311533, 0x1311542, 0x1311551, 0x1311614, 0x1311623,
+	0x1311632, 0x1311641, 0x1312136, 0x1312145, 0x1312154, 0x1312163, 0x1312226, 0x1312235,
+	0x1312244, 0x1312253, 0x1312262, 0x1312316, 0x1312325, 0x1312334, 0x1312343, 0x1312352,
+	0x1312361, 0x1312415, 0x1312424, 0x1312433, 0x1312442, 0x1312451, 0x1312514, 0x1312523,
+	0x1312532, 0x1312541, 0x1312613, 0x1312622, 0x1312631, 0x1313126, 0x1313135, 0x1313144,
+	0x1313153, 0x1313162, 0x1313216, 0x1313225, 0x1313234, 0x1313243, 0x1313252, 0x1313261,
+	0x1313315, 0x1313324, 0x1313333, 0x1313342, 0x1313351, 0x1313414, 0x1313423, 0x1313432,
+	0x1313441, 0x1313513, 0x1313522, 0x1313531, 0x1313612, 0x1313621, 0x1314116, 0x1314125,
+	0x1314134, 0x1314143, 0x1314152, 0x1314161, 0x1314215, 0x1314224, 0x1314233, 0x1314242,
+	0x1314251, 0x1314314, 0x1314323, 0x1314332, 0x1314341, 0x1314413, 0x1314422, 0x1314431,
+	0x1314512, 0x1314521, 0x1314611, 0x1315115, 0x1315124, 0x1315133, 0x1315142, 0x1315151,
+	0x1315214, 0x1315223, 0x1315232, 0x1315241, 0x1315313, 0x1315322, 0x1315331, 0x1315412,
+	0x1315421, 0x1315511, 0x1316114, 0x1316123, 0x1316132, 0x1316141, 0x1316213, 0x1316222,
+	0x1316231, 0x1316312, 0x1316321, 0x1316411, 0x1321136, 0x1321145, 0x1321154, 0x1321163,
+	0x1321226, 0x1321235, 0x1321244, 0x1321253, 0x1321262, 0x1321316, 0x1321325, 0x1321334,
+	0x1321343, 0x1321352, 0x1321361, 0x1321415, 0x1321424, 0x1321433, 0x1321442, 0x1321451,
+	0x1321514, 0x1321523, 0x1321532, 0x1321541, 0x1321613, 0x1321622, 0x1321631, 0x1322126,
+	0x1322135, 0x1322144, 0x1322153, 0x1322162, 0x1322216, 0x1322225, 0x1322234, 0x1322243,
+	0x1322252, 0x1322261, 0x1322315, 0x1322324, 0x1322333, 0x1322342, 0x1322351, 0x1322414,
+	0x1322423, 0x1322432, 0x1322441, 0x1322513, 0x1322522, 0x1322531, 0x1322612, 0x1322621,
+	0x1323116, 0x1323125, 0x1323134, 0x1323143, 0x1323152, 0x1323161, 0x1323215, 0x1323224,
+	0x1323233, 0x1323242, 0x1323251, 0x1323314, 0x1323323, 0x1323332, 0x1323341, 0x1323413,
+	0x1323422, 0x1323431, 0x1323512, 0x1323521, 0x1323611, 0x1324115, 0x1324124, 0x1324133,
+	0x1324142, 0x1324151, 0x1324214, 0x1324223, 0x1324232, 0x1324241, 0x1324313, 0x1324322,
+	0x1324331, 0x1324412, 0x1324421, 0x1324511, 0x1325114, 0x1325123, 0x1325132, 0x1325141,
+	0x1325213, 0x1325222, 0x1325231, 0x1325312, 0x1325321, 0x1325411, 0x1326113, 0x1326122,
+	0x1326131, 0x1326212, 0x1326221, 0x1326311, 0x1331126, 0x1331135, 0x1331144, 0x1331153,
+	0x1331162, 0x1331216, 0x1331225, 0x1331234, 0x1331243, 0x1331252, 0x1331261, 0x1331315,
+	0x1331324, 0x1331333, 0x1331342, 0x1331351, 0x1331414, 0x1331423, 0x1331432, 0x1331441,
+	0x1331513, 0x1331522, 0x1331531, 0x1331612, 0x1331621, 0x1332116, 0x1332125, 0x1332134,
+	0x1332143, 0x1332152, 0x1332161, 0x1332215, 0x1332224, 0x1332233, 0x1332242, 0x1332251,
+	0x1332314, 0x1332323, 0x1332332, 0x1332341, 0x1332413, 0x1332422, 0x1332431, 0x1332512,
+	0x1332521, 0x1332611, 0x1333115, 0x1333124, 0x1333133, 0x1333142, 0x1333151, 0x1333214,
+	0x1333223, 0x1333232, 0x1333241, 0x1333313, 0x1333322, 0x1333331, 0x1333412, 0x1333421,
+	0x1333511, 0x1334114, 0x1334123, 0x1334132, 0x1334141, 0x1334213, 0x1334222, 0x1334231,
+	0x1334312, 0x1334321, 0x1334411, 0x1335113, 0x1335122, 0x1335131, 0x1335212, 0x1335221,
+	0x1335311, 0x1336112, 0x1336121, 0x1336211, 0x1341116, 0x1341125, 0x1341134, 0x1341143,
+	0x1341152, 0x1341161, 0x1341215, 0x1341224, 0x1341233, 0x1341242, 0x1341251, 0x1341314,
+	0x1341323, 0x1341332, 0x1341341, 0x1341413, 0x1341422, 0x1341431, 0x1341512, 0x1341521,
+	0x1341611, 0x1342115, 0x1342124, 0x1342133, 0x1342142, 0x1342151, 0x1342214, 0x1342223,
+	0x1342232, 0x1342241, 0x1342313, 0x1342322, 0x1342331, 0x1342412, 0x1342421, 0x1342511,
+	0x1343114, 0x1343123, 0x1343132, 0x1343141, 0x1343213, 0x1343222, 0x1343231, 0x1343312,
+	0x1343321, 0x1343411, 0x1344113, 0x1344122, 0x1344131, 0x1344212, 0x1344221, 0x1344311,
+	0x1345112, 0x1345121, 0x1345211, 0x1346111, 0x1351115, 0x1351124, 0x1351133, 0x1351142,
+	0x1351151, 0x1351214, 0x1351223, 0x1351232, 0x1351241, 0x1351313, 0x1351322, 0x1351331,
+	0x1351412, 0x1351421, 0x1351511, 0x1352114, 0x1352123, 0x1352132, 0x1352141, 0x1352213,
+	0x1352222, 0x1352231, 0x1352312, 0x1352321, 0x1352411, 0x1353113, 0x1353122, 0x1353131,
+	0x1353212, 0x1353221, 0x1353311, 0x1354112, 0x1354121, 0x1354211, 0x1355111, 0x1361114,
+	0x1361123, 0x1361132, 0x1361141, 0x1361213, 0x1361222, 0x1361231, 0x1361312, 0x1361321,
+	0x1361411, 0x1362113, 0x1362122, 0x1362131, 0x1362212, 0x1362221, 0x1362311, 0x1363112,
+	0x1363121, 0x1363211, 0x1364111, 0x1411136, 0x1411145, 0x1411154, 0x1411163, 0x1411226,
+	0x1411235, 0x1411244, 0x1411253, 0x1411262, 0x1411316, 0x1411325, 0x1411334, 0x1411343,
+	0x1411352, 0x1411361, 0x1411415, 0x1411424, 0x1411433, 0x1411442, 0x1411451, 0x1411514,
+	0x1411523, 0x1411532, 0x1411541, 0x1411613, 0x1411622, 0x1411631, 0x1412126, 0x1412135,
+	0x1412144, 0x1412153, 0x1412162, 0x1412216, 0x1412225, 0x1412234, 0x1412243, 0x1412252,
+	0x1412261, 0x1412315, 0x1412324, 0x1412333, 0x1412342, 0x1412351, 0x1412414, 0x1412423,
+	0x1412432, 0x1412441, 0x1412513, 0x1412522, 0x1412531, 0x1412612, 0x1412621, 0x1413116,
+	0x1413125, 0x1413134, 0x1413143, 0x1413152, 0x1413161, 0x1413215, 0x1413224, 0x1413233,
+	0x1413242, 0x1413251, 0x1413314, 0x1413323, 0x1413332, 0x1413341, 0x1413413, 0x1413422,
+	0x1413431, 0x1413512, 0x1413521, 0x1413611, 0x1414115, 0x1414124, 0x1414133, 0x1414142,
+	0x1414151, 0x1414214, 0x1414223, 0x1414232, 0x1414241, 0x1414313, 0x1414322, 0x1414331,
+	0x1414412, 0x1414421, 0x1414511, 0x1415114, 0x1415123, 0x1415132, 0x1415141, 0x1415213,
+	0x1415222, 0x1415231, 0x1415312, 0x1415321, 0x1415411, 0x1416113, 0x1416122, 0x1416131,
+	0x1416212, 0x1416221, 0x1416311, 0x1421126, 0x1421135, 0x1421144, 0x1421153, 0x1421162,
+	0x1421216, 0x1421225, 0x1421234, 0x1421243, 0x1421252, 0x1421261, 0x1421315, 0x1421324,
+	0x1421333, 0x1421342, 0x1421351, 0x1421414, 0x1421423, 0x1421432, 0x1421441, 0x1421513,
+	0x1421522, 0x1421531, 0x1421612, 0x1421621, 0x1422116, 0x1422125, 0x1422134, 0x1422143,
+	0x1422152, 0x1422161, 0x1422215, 0x1422224, 0x1422233, 0x1422242, 0x1422251, 0x1422314,
+	0x1422323, 0x1422332, 0x1422341, 0x1422413, 0x1422422, 0x1422431, 0x1422512, 0x1422521,
+	0x1422611, 0x1423115, 0x1423124, 0x1423133, 0x1423142, 0x1423151, 0x1423214, 0x1423223,
+	0x1423232, 0x1423241, 0x1423313, 0x1423322, 0x1423331, 0x1423412, 0x1423421, 0x1423511,
+	0x1424114, 0x1424123, 0x1424132, 0x1424141, 0x1424213, 0x1424222, 0x1424231, 0x1424312,
+	0x1424321, 0x1424411, 0x1425113, 0x1425122, 0x1425131, 0x1425212, 0x1425221, 0x1425311,
+	0x1426112, 0x1426121, 0x1426211, 0x1431116, 0x1431125, 0x1431134, 0x1431143, 0x1431152,
+	0x1431161, 0x1431215, 0x1431224, 0x1431233, 0x1431242, 0x1431251, 0x1431314, 0x1431323,
+	0x1431332, 0x1431341, 0x1431413, 0x1431422, 0x1431431, 0x1431512, 0x1431521, 0x1431611,
+	0x1432115, 0x1432124, 0x1432133, 0x1432142, 0x1432151, 0x1432214, 0x1432223, 0x1432232,
+	0x1432241, 0x1432313, 0x1432322, 0x1432331, 0x1432412, 0x1432421, 0x1432511, 0x1433114,
+	0x1433123, 0x1433132, 0x1433141, 0x1433213, 0x1433222, 0x1433231, 0x1433312, 0x1433321,
+	0x1433411, 0x1434113, 0x1434122, 0x1434131, 0x1434212, 0x1434221, 0x1434311, 0x1435112,
+	0x1435121, 0x1435211, 0x1436111, 0x1441115, 0x1441124, 0x1441133, 0x1441142, 0x1441151,
+	0x1441214, 0x1441223, 0x1441232, 0x1441241, 0x1441313, 0x1441322, 0x1441331, 0x1441412,
+	0x1441421, 0x1441511, 0x1442114, 0x1442123, 0x1442132, 0x1442141, 0x1442213, 0x1442222,
+	0x1442231, 0x1442312, 0x1442321, 0x1442411, 0x1443113, 0x1443122, 0x1443131, 0x1443212,
+	0x1443221, 0x1443311, 0x1444112, 0x1444121, 0x1444211, 0x1445111, 0x1451114, 0x1451123,
+	0x1451132, 0x1451141, 0x1451213, 0x1451222, 0x1451231, 0x1451312, 0x1451321, 0x1451411,
+	0x1452113, 0x1452122, 0x1452131, 0x1452212, 0x1452221, 0x1452311, 0x1453112, 0x1453121,
+	0x1453211, 0x1454111, 0x1461113, 0x1461122, 0x1461131, 0x1461212, 0x1461221, 0x1461311,
+	0x1462112, 0x1462121, 0x1462211, 0x1463111, 0x1511126, 0x1511135, 0x1511144, 0x1511153,
+	0x1511162, 0x1511216, 0x1511225, 0x1511234, 0x1511243, 0x1511252, 0x1511261, 0x1511315,
+	0x1511324, 0x1511333, 0x1511342, 0x1511351, 0x1511414, 0x1511423, 0x1511432, 0x1511441,
+	0x1511513, 0x1511522, 0x1511531, 0x1511612, 0x1511621, 0x1512116, 0x1512125, 0x1512134,
+	0x1512143, 0x1512152, 0x1512161, 0x1512215, 0x1512224, 0x1512233, 0x1512242, 0x1512251,
+	0x1512314, 0x1512323, 0x1512332, 0x1512341, 0x1512413, 0x1512422, 0x1512431, 0x1512512,
+	0x1512521, 0x1512611, 0x1513115, 0x1513124, 0x1513133, 0x1513142, 0x1513151, 0x1513214,
+	0x1513223, 0x1513232, 0x1513241, 0x1513313, 0x1513322, 0x1513331, 0x1513412, 0x1513421,
+	0x1513511, 0x1514114, 0x1514123, 0x1514132, 0x1514141, 0x1514213, 0x1514222, 0x1514231,
+	0x1514312, 0x1514321, 0x1514411, 0x1515113, 0x1515122, 0x1515131, 0x1515212, 0x1515221,
+	0x1515311, 0x1516112, 0x1516121, 0x1516211, 0x1521116, 0x1521125, 0x1521134, 0x1521143,
+	0x1521152, 0x1521161, 0x1521215, 0x1521224, 0x1521233, 0x1521242, 0x1521251, 0x1521314,
+	0x1521323, 0x1521332, 0x1521341, 0x1521413, 0x1521422, 0x1521431, 0x1521512, 0x1521521,
+	0x1521611, 0x1522115, 0x1522124, 0x1522133, 0x1522142, 0x1522151, 0x1522214, 0x1522223,
+	0x1522232, 0x1522241, 0x1522313, 0x1522322, 0x1522331, 0x1522412, 0x1522421, 0x1522511,
+	0x1523114, 0x1523123, 0x1523132, 0x1523141, 0x1523213, 0x1523222, 0x1523231, 0x1523312,
+	0x1523321, 0x1523411, 0x1524113, 0x1524122, 0x1524131, 0x1524212, 0x1524221, 0x1524311,
+	0x1525112, 0x1525121, 0x1525211, 0x1526111, 0x1531115, 0x1531124, 0x1531133, 0x1531142,
+	0x1531151, 0x1531214, 0x1531223, 0x1531232, 0x1531241, 0x1531313, 0x1531322, 0x1531331,
+	0x1531412, 0x1531421, 0x1531511, 0x1532114, 0x1532123, 0x1532132, 0x1532141, 0x1532213,
+	0x1532222, 0x1532231, 0x1532312, 0x1532321, 0x1532411, 0x1533113, 0x1533122, 0x1533131,
+	0x1533212, 0x1533221, 0x1533311, 0x1534112, 0x1534121, 0x1534211, 0x1535111, 0x1541114,
+	0x1541123, 0x1541132, 0x1541141, 0x1541213, 0x1541222, 0x1541231, 0x1541312, 0x1541321,
+	0x1541411, 0x1542113, 0x1542122, 0x1542131, 0x1542212, 0x1542221, 0x1542311, 0x1543112,
+	0x1543121, 0x1543211, 0x1544111, 0x1551113, 0x1551122, 0x1551131, 0x1551212, 0x1551221,
+	0x1551311, 0x1552112, 0x1552121, 0x1552211, 0x1553111, 0x1561112, 0x1561121, 0x1561211,
+	0x1562111, 0x1611116, 0x1611125, 0x1611134, 0x1611143, 0x1611152, 0x1611161, 0x1611215,
+	0x1611224, 0x1611233, 0x1611242, 0x1611251, 0x1611314, 0x1611323, 0x1611332, 0x1611341,
+	0x1611413, 0x1611422, 0x1611431, 0x1611512, 0x1611521, 0x1611611, 0x1612115, 0x1612124,
+	0x1612133, 0x1612142, 0x1612151, 0x1612214, 0x1612223, 0x1612232, 0x1612241, 0x1612313,
+	0x1612322, 0x1612331, 0x1612412, 0x1612421, 0x1612511, 0x1613114, 0x1613123, 0x1613132,
+	0x1613141, 0x1613213, 0x1613222, 0x1613231, 0x1613312, 0x1613321, 0x1613411, 0x1614113,
+	0x1614122, 0x1614131, 0x1614212, 0x1614221, 0x1614311, 0x1615112, 0x1615121, 0x1615211,
+	0x1616111, 0x1621115, 0x1621124, 0x1621133, 0x1621142, 0x1621151, 0x1621214, 0x1621223,
+	0x1621232, 0x1621241, 0x1621313, 0x1621322, 0x1621331, 0x1621412, 0x1621421, 0x1621511,
+	0x1622114, 0x1622123, 0x1622132, 0x1622141, 0x1622213, 0x1622222, 0x1622231, 0x1622312,
+	0x1622321, 0x1622411, 0x1623113, 0x1623122, 0x1623131, 0x1623212, 0x1623221, 0x1623311,
+	0x1624112, 0x1624121, 0x1624211, 0x1625111, 0x1631114, 0x1631123, 0x1631132, 0x1631141,
+	0x1631213, 0x1631222, 0x1631231, 0x1631312, 0x1631321, 0x1631411, 0x1632113, 0x1632122,
+	0x1632131, 0x1632212, 0x1632221, 0x1632311, 0x1633112, 0x1633121, 0x1633211, 0x1634111,
+	0x1641113, 0x1641122, 0x1641131, 0x1641212, 0x1641221, 0x1641311, 0x1642112, 0x1642121,
+	0x1642211, 0x1643111, 0x1651112, 0x1651121, 0x1651211, 0x1652111, 0x1661111, 0x2111156,
+	0x2111165, 0x2111246, 0x2111255, 0x2111264, 0x2111336, 0x2111345, 0x2111354, 0x2111363,
+	0x2111426, 0x2111435, 0x2111444, 0x2111453, 0x2111462, 0x2111516, 0x2111525, 0x2111534,
+	0x2111543, 0x2111552, 0x2111561, 0x2111615, 0x2111624, 0x2111633, 0x2111642, 0x2111651,
+	0x2112146, 0x2112155, 0x2112164, 0x2112236, 0x2112245, 0x2112254, 0x2112263, 0x2112326,
+	0x2112335, 0x2112344, 0x2112353, 0x2112362, 0x2112416, 0x2112425, 0x2112434, 0x2112443,
+	0x2112452, 0x2112461, 0x2112515, 0x2112524, 0x2112533, 0x2112542, 0x2112551, 0x2112614,
+	0x2112623, 0x2112632, 0x2112641, 0x2113136, 0x2113145, 0x2113154, 0x2113163, 0x2113226,
+	0x2113235, 0x2113244, 0x2113253, 0x2113262, 0x2113316, 0x2113325, 0x2113334, 0x2113343,
+	0x2113352, 0x2113361, 0x2113415, 0x2113424, 0x2113433, 0x2113442, 0x2113451, 0x2113514,
+	0x2113523, 0x2113532, 0x2113541, 0x2113613, 0x2113622, 0x2113631, 0x2114126, 0x2114135,
+	0x2114144, 0x2114153, 0x2114162, 0x2114216, 0x2114225, 0x2114234, 0x2114243, 0x2114252,
+	0x2114261, 0x2114315, 0x2114324, 0x2114333, 0x2114342, 0x2114351, 0x2114414, 0x2114423,
+	0x2114432, 0x2114441, 0x2114513, 0x2114522, 0x2114531, 0x2114612, 0x2114621, 0x2115116,
+	0x2115125, 0x2115134, 0x2115143, 0x2115152, 0x2115161, 0x2115215, 0x2115224, 0x2115233,
+	0x2115242, 0x2115251, 0x2115314, 0x2115323, 0x2115332, 0x2115341, 0x2115413, 0x2115422,
+	0x2115431, 0x2115512, 0x2115521, 0x2115611, 0x2116115, 0x2116124, 0x2116133, 0x2116142,
+	0x2116151, 0x2116214, 0x2116223, 0x2116232, 0x2116241, 0x2116313, 0x2116322, 0x2116331,
+	0x2116412, 0x2116421, 0x2116511, 0x2121146, 0x2121155, 0x2121164, 0x2121236, 0x2121245,
+	0x2121254, 0x2121263, 0x2121326, 0x2121335, 0x2121344, 0x2121353, 0x2121362, 0x2121416,
+	0x2121425, 0x2121434, 0x2121443, 0x2121452, 0x2121461, 0x2121515, 0x2121524, 0x2121533,
+	0x2121542, 0x2121551, 0x2121614, 0x2121623, 0x2121632, 0x2121641, 0x2122136, 0x2122145,
+	0x2122154, 0x2122163, 0x2122226, 0x2122235, 0x2122244, 0x2122253, 0x2122262, 0x2122316,
+	0x2122325, 0x2122334, 0x2122343, 0x2122352, 0x2122361, 0x2122415, 0x2122424, 0x2122433,
+	0x2122442, 0x2122451, 0x2122514, 0x2122523, 0x2122532, 0x2122541, 0x2122613, 0x2122622,
+	0x2122631, 0x2123126, 0x2123135, 0x2123144, 0x2123153, 0x2123162, 0x2123216, 0x2123225,
+	0x2123234, 0x2123243, 0x2123252, 0x2123261, 0x2123315, 0x2123324, 0x2123333, 0x2123342,
+	0x2123351, 0x2123414, 0x2123423, 0x2123432, 0x2123441, 0x2123513, 0x2123522, 0x2123531,
+	0x2123612, 0x2123621, 0x2124116, 0x2124125, 0x2124134, 0x2124143, 0x2124152, 0x2124161,
+	0x2124215, 0x2124224, 0x2124233, 0x2124242, 0x2124251, 0x2124314, 0x2124323, 0x2124332,
+	0x2124341, 0x2124413, 0x2124422, 0x2124431, 0x2124512, 0x2124521, 0x2124611, 0x2125115,
+	0x2125124, 0x2125133, 0x2125142, 0x2125151, 0x2125214, 0x2125223, 0x2125232, 0x2125241,
+	0x2125313, 0x2125322, 0x2125331, 0x2125412, 0x2125421, 0x2125511, 0x2126114, 0x2126123,
+	0x2126132, 0x2126141, 0x2126213, 0x2126222, 0x2126231, 0x2126312, 0x2126321, 0x2126411,
+	0x2131136, 0x2131145, 0x2131154, 0x2131163, 0x2131226, 0x2131235, 0x2131244, 0x2131253,
+	0x2131262, 0x2131316, 0x2131325, 0x2131334, 0x2131343, 0x2131352, 0x2131361, 0x2131415,
+	0x2131424, 0x2131433, 0x2131442, 0x2131451, 0x2131514, 0x2131523, 0x2131532, 0x2131541,
+	0x2131613, 0x2131622, 0x2131631, 0x2132126, 0x2132135, 0x2132144, 0x2132153, 0x2132162,
+	0x2132216, 0x2132225, 0x2132234, 0x2132243, 0x2132252, 0x2132261, 0x2132315, 0x2132324,
+	0x2132333, 0x2132342, 0x2132351, 0x2132414, 0x2132423, 0x2132432, 0x2132441, 0x2132513,
+	0x2132522, 0x2132531, 0x2132612, 0x2132621, 0x2133116, 0x2133125, 0x2133134, 0x2133143,
+	0x2133152, 0x2133161, 0x2133215, 0x2133224, 0x2133233, 0x2133242, 0x2133251, 0x2133314,
+	0x2133323, 0x2133332, 0x2133341, 0x2133413, 0x2133422, 0x2133431, 0x2133512, 0x2133521,
+	0x2133611, 0x2134115, 0x2134124, 0x2134133, 0x2134142, 0x2134151, 0x2134214, 0x2134223,
+	0x2134232, 0x2134241, 0x2134313, 0x2134322, 0x2134331, 0x2134412, 0x2134421, 0x2134511,
+	0x2135114, 0x2135123, 0x2135132, 0x2135141, 0x2135213, 0x2135222, 0x2135231, 0x2135312,
+	0x2135321, 0x2135411, 0x2136113, 0x2136122, 0x2136131, 0x2136212, 0x2136221, 0x2136311,
+	0x2141126, 0x2141135, 0x2141144, 0x2141153, 0x2141162, 0x2141216, 0x2141225, 0x2141234,
+	0x2141243, 0x2141252, 0x2141261, 0x2141315, 0x2141324, 0x2141333, 0x2141342, 0x2141351,
+	0x2141414, 0x2141423, 0x2141432, 0x2141441, 0x2141513, 0x2141522, 0x2141531, 0x2141612,
+	0x2141621, 0x2142116, 0x2142125, 0x2142134, 0x2142143, 0x2142152, 0x2142161, 0x2142215,
+	0x2142224, 0x2142233, 0x2142242, 0x2142251, 0x2142314, 0x2142323, 0x2142332, 0x2142341,
+	0x2142413, 0x2142422, 0x2142431, 0x2142512, 0x2142521, 0x2142611, 0x2143115, 0x2143124,
+	0x2143133, 0x2143142, 0x2143151, 0x2143214, 0x2143223, 0x2143232, 0x2143241, 0x2143313,
+	0x2143322, 0x2143331, 0x2143412, 0x2143421, 0x2143511, 0x2144114, 0x2144123, 0x2144132,
+	0x2144141, 0x2144213, 0x2144222, 0x2144231, 0x2144312, 0x2144321, 0x2144411, 0x2145113,
+	0x2145122, 0x2145131, 0x2145212, 0x2145221, 0x2145311, 0x2146112, 0x2146121, 0x2146211,
+	0x2151116, 0x2151125, 0x2151134, 0x2151143, 0x2151152, 0x2151161, 0x2151215, 0x2151224,
+	0x2151233, 0x2151242, 0x2151251, 0x2151314, 0x2151323, 0x2151332, 0x2151341, 0x2151413,
+	0x2151422, 0x2151431, 0x2151512, 0x2151521, 0x2151611, 0x2152115, 0x2152124, 0x2152133,
+	0x2152142, 0x2152151, 0x2152214, 0x2152223, 0x2152232, 0x2152241, 0x2152313, 0x2152322,
+	0x2152331, 0x2152412, 0x2152421, 0x2152511, 0x2153114, 0x2153123, 0x2153132, 0x2153141,
+	0x2153213, 0x2153222, 0x2153231, 0x2153312, 0x2153321, 0x2153411, 0x2154113, 0x2154122,
+	0x2154131, 0x2154212, 0x2154221, 0x2154311, 0x2155112, 0x2155121, 0x2155211, 0x2156111,
+	0x2161115, 0x2161124, 0x2161133, 0x2161142, 0x2161151, 0x2161214, 0x2161223, 0x2161232,
+	0x2161241, 0x2161313, 0x2161322, 0x2161331, 0x2161412, 0x2161421, 0x2161511, 0x2162114,
+	0x2162123, 0x2162132, 0x2162141, 0x2162213, 0x2162222, 0x2162231, 0x2162312, 0x2162321,
+	0x2162411, 0x2163113, 0x2163122, 0x2163131, 0x2163212, 0x2163221, 0x2163311, 0x2164112,
+	0x2164121, 0x2164211, 0x2165111, 0x2211146, 0x2211155, 0x2211164, 0x2211236, 0x2211245,
+	0x2211254, 0x2211263, 0x2211326, 0x2211335, 0x2211344, 0x2211353, 0x2211362, 0x2211416,
+	0x2211425, 0x2211434, 0x2211443, 0x2211452, 0x2211461, 0x2211515, 0x2211524, 0x2211533,
+	0x2211542, 0x2211551, 0x2211614, 0x2211623, 0x2211632, 0x2211641, 0x2212136, 0x2212145,
+	0x2212154, 0x2212163, 0x2212226, 0x2212235, 0x2212244, 0x2212253, 0x2212262, 0x2212316,
+	0x2212325, 0x2212334, 0x2212343, 0x2212352, 0x2212361, 0x2212415, 0x2212424, 0x2212433,
+	0x2212442, 0x2212451, 0x2212514, 0x2212523, 0x2212532, 0x2212541, 0x2212613, 0x2212622,
+	0x2212631, 0x2213126, 0x2213135, 0x2213144, 0x2213153, 0x2213162, 0x2213216, 0x2213225,
+	0x2213234, 0x2213243, 0x2213252, 0x2213261, 0x2213315, 0x2213324, 0x2213333, 0x2213342,
+	0x2213351, 0x2213414, 0x2213423, 0x2213432, 0x2213441, 0x2213513, 0x2213522, 0x2213531,
+	0x2213612, 0x2213621, 0x2214116, 0x2214125, 0x2214134, 0x2214143, 0x2214152, 0x2214161,
+	0x2214215, 0x2214224, 0x2214233, 0x2214242, 0x2214251, 0x2214314, 0x2214323, 0x2214332,
+	0x2214341, 0x2214413, 0x2214422, 0x2214431, 0x2214512, 0x2214521, 0x2214611, 0x2215115,
+	0x2215124, 0x2215133, 0x2215142, 0x2215151, 0x2215214, 0x2215223, 0x2215232, 0x2215241,
+	0x2215313, 0x2215322, 0x2215331, 0x2215412, 0x2215421, 0x2215511, 0x2216114, 0x2216123,
+	0x2216132, 0x2216141, 0x2216213, 0x2216222, 0x2216231, 0x2216312, 0x2216321, 0x2216411,
+	0x2221136, 0x2221145, 0x2221154, 0x2221163, 0x2221226, 0x2221235, 0x2221244, 0x2221253,
+	0x2221262, 0x2221316, 0x2221325, 0x2221334, 0x2221343, 0x2221352, 0x2221361, 0x2221415,
+	0x2221424, 0x2221433, 0x2221442, 0x2221451, 0x2221514, 0x2221523, 0x2221532, 0x2221541,
+	0x2221613, 0x2221622, 0x2221631, 0x2222126, 0x2222135, 0x2222144, 0x2222153, 0x2222162,
+	0x2222216, 0x2222225, 0x2222234, 0x2222243, 0x2222252, 0x2222261, 0x2222315, 0x2222324,
+	0x2222333, 0x2222342, 0x2222351, 0x2222414, 0x2222423, 0x2222432, 0x2222441, 0x2222513,
+	0x2222522, 0x2222531, 0x2222612, 0x2222621, 0x2223116, 0x2223125, 0x2223134, 0x2223143,
+	0x2223152, 0x2223161, 0x2223215, 0x2223224, 0x2223233, 0x2223242, 0x2223251, 0x2223314,
+	0x2223323, 0x2223332, 0x2223341, 0x2223413, 0x2223422, 0x2223431, 0x2223512, 0x2223521,
+	0x2223611, 0x2224115, 0x2224124, 0x2224133, 0x2224142, 0x2224151, 0x2224214, 0x2224223,
+	0x2224232, 0x2224241, 0x2224313, 0x2224322, 0x2224331, 0x2224412, 0x2224421, 0x2224511,
+	0x2225114, 0x2225123, 0x2225132, 0x2225141, 0x2225213, 0x2225222, 0x2225231, 0x2225312,
+	0x2225321, 0x2225411, 0x2226113, 0x2226122, 0x2226131, 0x2226212, 0x2226221, 0x2226311,
+	0x2231126, 0x2231135, 0x2231144, 0x2231153, 0x2231162, 0x2231216, 0x2231225, 0x2231234,
+	0x2231243, 0x2231252, 0x2231261, 0x2231315, 0x2231324, 0x2231333, 0x2231342, 0x2231351,
+	0x2231414, 0x2231423, 0x2231432, 0x2231441, 0x2231513, 0x2231522, 0x2231531, 0x2231612,
+	0x2231621, 0x2232116, 0x2232125, 0x2232134, 0x2232143, 0x2232152, 0x2232161, 0x2232215,
+	0x2232224, 0x2232233, 0x2232242, 0x2232251, 0x2232314, 0x2232323, 0x2232332, 0x2232341,
+	0x2232413, 0x2232422, 0x2232431, 0x2232512, 0x2232521, 0x2232611, 0x2233115, 0x2233124,
+	0x2233133, 0x2233142, 0x2233151, 0x2233214, 0x2233223, 0x2233232, 0x2233241, 0x2233313,
+	0x2233322, 0x2233331, 0x2233412, 0x2233421, 0x2233511, 0x2234114, 0x2234123, 0x2234132,
+	0x2234141, 0x2234213, 0x2234222, 0x2234231, 0x2234312, 0x2234321, 0x2234411, 0x2235113,
+	0x2235122, 0x2235131, 0x2235212, 0x2235221, 0x2235311, 0x2236112, 0x2236121, 0x2236211,
+	0x2241116, 0x2241125, 0x2241134, 0x2241143, 0x2241152, 0x2241161, 0x2241215, 0x2241224,
+	0x2241233, 0x2241242, 0x2241251, 0x2241314, 0x2241323, 0x2241332, 0x2241341, 0x2241413,
+	0x2241422, 0x2241431, 0x2241512, 0x2241521, 0x2241611, 0x2242115, 0x2242124, 0x2242133,
+	0x2242142, 0x2242151, 0x2242214, 0x2242223, 0x2242232, 0x2242241, 0x2242313, 0x2242322,
+	0x2242331, 0x2242412, 0x2242421, 0x2242511, 0x2243114, 0x2243123, 0x2243132, 0x2243141,
+	0x2243213, 0x2243222, 0x2243231, 0x2243312, 0x2243321, 0x2243411, 0x2244113, 0x2244122,
+	0x2244131, 0x2244212, 0x2244221, 0x2244311, 0x2245112, 0x2245121, 0x2245211, 0x2246111,
+	0x2251115, 0x2251124, 0x2251133, 0x2251142, 0x2251151, 0x2251214, 0x2251223, 0x2251232,
+	0x2251241, 0x2251313, 0x2251322, 0x2251331, 0x2251412, 0x2251421, 0x2251511, 0x2252114,
+	0x2252123, 0x2252132, 0x2252141, 0x2252213, 0x2252222, 0x2252231, 0x2252312, 0x2252321,
+	0x2252411, 0x2253113, 0x2253122, 0x2253131, 0x2253212, 0x2253221, 0x2253311, 0x2254112,
+	0x2254121, 0x2254211, 0x2255111, 0x2261114, 0x2261123, 0x2261132, 0x2261141, 0x2261213,
+	0x2261222, 0x2261231, 0x2261312, 0x2261321, 0x2261411, 0x2262113, 0x2262122, 0x2262131,
+	0x2262212, 0x2262221, 0x2262311, 0x2263112, 0x2263121, 0x2263211, 0x2264111, 0x2311136,
+	0x2311145, 0x2311154, 0x2311163, 0x2311226, 0x2311235, 0x2311244, 0x2311253, 0x2311262,
+	0x2311316, 0x2311325, 0x2311334, 0x2311343, 0x2311352, 0x2311361, 0x2311415, 0x2311424,
+	0x2311433, 0x2311442, 0x2311451, 0x2311514, 0x2311523, 0x2311532, 0x2311541, 0x2311613,
+	0x2311622, 0x2311631, 0x2312126, 0x2312135, 0x2312144, 0x2312153, 0x2312162, 0x2312216,
+	0x2312225, 0x2312234, 0x2312243, 0x2312252, 0x2312261, 0x2312315, 0x2312324, 0x2312333,
+	0x2312342, 0x2312351, 0x2312414, 0x2312423, 0x2312432, 0x2312441, 0x2312513, 0x2312522,
+	0x2312531, 0x2312612, 0x2312621, 0x2313116, 0x2313125, 0x2313134, 0x2313143, 0x2313152,
+	0x2313161, 0x2313215, 0x2313224, 0x2313233, 0x2313242, 0x2313251, 0x2313314, 0x2313323,
+	0x2313332, 0x2313341, 0x2313413, 0x2313422, 0x2313431, 0x2313512, 0x2313521, 0x2313611,
+	0x2314115, 0x2314124, 0x2314133, 0x2314142, 0x2314151, 0x2314214, 0x2314223, 0x2314232,
+	0x2314241, 0x2314313, 0x2314322, 0x2314331, 0x2314412, 0x2314421, 0x2314511, 0x2315114,
+	0x2315123, 0x2315132, 0x2315141, 0x2315213, 0x2315222, 0x2315231, 0x2315312, 0x2315321,
+	0x2315411, 0x2316113, 0x2316122, 0x2316131, 0x2316212, 0x2316221, 0x2316311, 0x2321126,
+	0x2321135, 0x2321144, 0x2321153, 0x2321162, 0x2321216, 0x2321225, 0x2321234, 0x2321243,
+	0x2321252, 0x2321261, 0x2321315, 0x2321324, 0x2321333, 0x2321342, 0x2321351, 0x2321414,
+	0x2321423, 0x2321432, 0x2321441, 0x2321513, 0x2321522, 0x2321531, 0x2321612, 0x2321621,
+	0x2322116, 0x2322125, 0x2322134, 0x2322143, 0x2322152, 0x2322161, 0x2322215, 0x2322224,
+	0x2322233, 0x2322242, 0x2322251, 0x2322314, 0x2322323, 0x2322332, 0x2322341, 0x2322413,
+	0x2322422, 0x2322431, 0x2322512, 0x2322521, 0x2322611, 0x2323115, 0x2323124, 0x2323133,
+	0x2323142, 0x2323151, 0x2323214, 0x2323223, 0x2323232, 0x2323241, 0x2323313, 0x2323322,
+	0x2323331, 0x2323412, 0x2323421, 0x2323511, 0x2324114, 0x2324123, 0x2324132, 0x2324141,
+	0x2324213, 0x2324222, 0x2324231, 0x2324312, 0x2324321, 0x2324411, 0x2325113, 0x2325122,
+	0x2325131, 0x2325212, 0x2325221, 0x2325311, 0x2326112, 0x2326121, 0x2326211, 0x2331116,
+	0x2331125, 0x2331134, 0x2331143, 0x2331152, 0x2331161, 0x2331215, 0x2331224, 0x2331233,
+	0x2331242, 0x2331251, 0x2331314, 0x2331323, 0x2331332, 0x2331341, 0x2331413, 0x2331422,
+	0x2331431, 0x2331512, 0x2331521, 0x2331611, 0x2332115, 0x2332124, 0x2332133, 0x2332142,
+	0x2332151, 0x2332214, 0x2332223, 0x2332232, 0x2332241, 0x2332313, 0x2332322, 0x2332331,
+	0x2332412, 0x2332421, 0x2332511, 0x2333114, 0x2333123, 0x2333132, 0x2333141, 0x2333213,
+	0x2333222, 0x2333231, 0x2333312, 0x2333321, 0x2333411, 0x2334113, 0x2334122, 0x2334131,
+	0x2334212, 0x2334221, 0x2334311, 0x2335112, 0x2335121, 0x2335211, 0x2336111, 0x2341115,
+	0x2341124, 0x2341133, 0x2341142, 0x2341151, 0x2341214, 0x2341223, 0x2341232, 0x2341241,
+	0x2341313, 0x2341322, 0x2341331, 0x2341412, 0x2341421, 0x2341511, 0x2342114, 0x2342123,
+	0x2342132, 0x2342141, 0x2342213, 0x2342222, 0x2342231, 0x2342312, 0x2342321, 0x2342411,
+	0x2343113, 0x2343122, 0x2343131, 0x2343212, 0x2343221, 0x2343311, 0x2344112, 0x2344121,
+	0x2344211, 0x2345111, 0x2351114, 0x2351123, 0x2351132, 0x2351141, 0x2351213, 0x2351222,
+	0x2351231, 0x2351312, 0x2351321, 0x2351411, 0x2352113, 0x2352122, 0x2352131, 0x2352212,
+	0x2352221, 0x2352311, 0x2353112, 0x2353121, 0x2353211, 0x2354111, 0x2361113, 0x2361122,
+	0x2361131, 0x2361212, 0x2361221, 0x2361311, 0x2362112, 0x2362121, 0x2362211, 0x2363111,
+	0x2411126, 0x2411135, 0x2411144, 0x2411153, 0x2411162, 0x2411216, 0x2411225, 0x2411234,
+	0x2411243, 0x2411252, 0x2411261, 0x2411315, 0x2411324, 0x2411333, 0x2411342, 0x2411351,
+	0x2411414, 0x2411423, 0x2411432, 0x2411441, 0x2411513, 0x2411522, 0x2411531, 0x2411612,
+	0x2411621, 0x2412116, 0x2412125, 0x2412134, 0x2412143, 0x2412152, 0x2412161, 0x2412215,
+	0x2412224, 0x2412233, 0x2412242, 0x2412251, 0x2412314, 0x2412323, 0x2412332, 0x2412341,
+	0x2412413, 0x2412422, 0x2412431, 0x2412512, 0x2412521, 0x2412611, 0x2413115, 0x2413124,
+	0x2413133, 0x2413142, 0x2413151, 0x2413214, 0x2413223, 0x2413232, 0x2413241, 0x2413313,
+	0x2413322, 0x2413331, 0x2413412, 0x2413421, 0x2413511, 0x2414114, 0x2414123, 0x2414132,
+	0x2414141, 0x2414213, 0x2414222, 0x2414231, 0x2414312, 0x2414321, 0x2414411, 0x2415113,
+	0x2415122, 0x2415131, 0x2415212, 0x2415221, 0x2415311, 0x2416112, 0x2416121, 0x2416211,
+	0x2421116, 0x2421125, 0x2421134, 0x2421143, 0x2421152, 0x2421161, 0x2421215, 0x2421224,
+	0x2421233, 0x2421242, 0x2421251, 0x2421314, 0x2421323, 0x2421332, 0x2421341, 0x2421413,
+	0x2421422, 0x2421431, 0x2421512, 0x2421521, 0x2421611, 0x2422115, 0x2422124, 0x2422133,
+	0x2422142, 0x2422151, 0x2422214, 0x2422223, 0x2422232, 0x2422241, 0x2422313, 0x2422322,
+	0x2422331, 0x2422412, 0x2422421, 0x2422511, 0x2423114, 0x2423123, 0x2423132, 0x2423141,
+	0x2423213, 0x2423222, 0x2423231, 0x2423312, 0x2423321, 0x2423411, 0x2424113, 0x2424122,
+	0x2424131, 0x2424212, 0x2424221, 0x2424311, 0x2425112, 0x2425121, 0x2425211, 0x2426111,
+	0x2431115, 0x2431124, 0x2431133, 0x2431142, 0x2431151, 0x2431214, 0x2431223, 0x2431232,
+	0x2431241, 0x2431313, 0x2431322, 0x2431331, 0x2431412, 0x2431421, 0x2431511, 0x2432114,
+	0x2432123, 0x2432132, 0x2432141, 0x2432213, 0x2432222, 0x2432231, 0x2432312, 0x2432321,
+	0x2432411, 0x2433113, 0x2433122, 0x2433131, 0x2433212, 0x2433221, 0x2433311, 0x2434112,
+	0x2434121, 0x2434211, 0x2435111, 0x2441114, 0x2441123, 0x2441132, 0x2441141, 0x2441213,
+	0x2441222, 0x2441231, 0x2441312, 0x2441321, 0x2441411, 0x2442113, 0x2442122, 0x2442131,
+	0x2442212, 0x2442221, 0x2442311, 0x2443112, 0x2443121, 0x2443211, 0x2444111, 0x2451113,
+	0x2451122, 0x2451131, 0x2451212, 0x2451221, 0x2451311, 0x2452112, 0x2452121, 0x2452211,
+	0x2453111, 0x2461112, 0x2461121, 0x2461211, 0x2462111, 0x2511116, 0x2511125, 0x2511134,
+	0x2511143, 0x2511152, 0x2511161, 0x2511215, 0x2511224, 0x2511233, 0x2511242, 0x2511251,
+	0x2511314, 0x2511323, 0x2511332, 0x2511341, 0x2511413, 0x2511422, 0x2511431, 0x2511512,
+	0x2511521, 0x2511611, 0x2512115, 0x2512124, 0x2512133, 0x2512142, 0x2512151, 0x2512214,
+	0x2512223, 0x2512232, 0x2512241, 0x2512313, 0x2512322, 0x2512331, 0x2512412, 0x2512421,
+	0x2512511, 0x2513114, 0x2513123, 0x2513132, 0x2513141, 0x2513213, 0x2513222, 0x2513231,
+	0x2513312, 0x2513321, 0x2513411, 0x2514113, 0x2514122, 0x2514131, 0x2514212, 0x2514221,
+	0x2514311, 0x2515112, 0x2515121, 0x2515211, 0x2516111, 0x2521115, 0x2521124, 0x2521133,
+	0x2521142, 0x2521151, 0x2521214, 0x2521223, 0x2521232, 0x2521241, 0x2521313, 0x2521322,
+	0x2521331, 0x2521412, 0x2521421, 0x2521511, 0x2522114, 0x2522123, 0x2522132, 0x2522141,
+	0x2522213, 0x2522222, 0x2522231, 0x2522312, 0x2522321, 0x2522411, 0x2523113, 0x2523122,
+	0x2523131, 0x2523212, 0x2523221, 0x2523311, 0x2524112, 0x2524121, 0x2524211, 0x2525111,
+	0x2531114, 0x2531123, 0x2531132, 0x2531141, 0x2531213, 0x2531222, 0x2531231, 0x2531312,
+	0x2531321, 0x2531411, 0x2532113, 0x2532122, 0x2532131, 0x2532212, 0x2532221, 0x2532311,
+	0x2533112, 0x2533121, 0x2533211, 0x2534111, 0x2541113, 0x2541122, 0x2541131, 0x2541212,
+	0x2541221, 0x2541311, 0x2542112, 0x2542121, 0x2542211, 0x2543111, 0x2551112, 0x2551121,
+	0x2551211, 0x2552111, 0x2561111, 0x2611115, 0x2611124, 0x2611133, 0x2611142, 0x2611151,
+	0x2611214, 0x2611223, 0x2611232, 0x2611241, 0x2611313, 0x2611322, 0x2611331, 0x2611412,
+	0x2611421, 0x2611511, 0x2612114, 0x2612123, 0x2612132, 0x2612141, 0x2612213, 0x2612222,
+	0x2612231, 0x2612312, 0x2612321, 0x2612411, 0x2613113, 0x2613122, 0x2613131, 0x2613212,
+	0x2613221, 0x2613311, 0x2614112, 0x2614121, 0x2614211, 0x2615111, 0x2621114, 0x2621123,
+	0x2621132, 0x2621141, 0x2621213, 0x2621222, 0x2621231, 0x2621312, 0x2621321, 0x2621411,
+	0x2622113, 0x2622122, 0x2622131, 0x2622212, 0x2622221, 0x2622311, 0x2623112, 0x2623121,
+	0x2623211, 0x2624111, 0x2631113, 0x2631122, 0x2631131, 0x2631212, 0x2631221, 0x2631311,
+	0x2632112, 0x2632121, 0x2632211, 0x2633111, 0x2641112, 0x2641121, 0x2641211, 0x2642111,
+	0x2651111, 0x3111146, 0x3111155, 0x3111164, 0x3111236, 0x3111245, 0x3111254, 0x3111263,
+	0x3111326, 0x3111335, 0x3111344, 0x3111353, 0x3111362, 0x3111416, 0x3111425, 0x3111434,
+	0x3111443, 0x3111452, 0x3111461, 0x3111515, 0x3111524, 0x3111533, 0x3111542, 0x3111551,
+	0x3111614, 0x3111623, 0x3111632, 0x3111641, 0x3112136, 0x3112145, 0x3112154, 0x3112163,
+	0x3112226, 0x3112235, 0x3112244, 0x3112253, 0x3112262, 0x3112316, 0x3112325, 0x3112334,
+	0x3112343, 0x3112352, 0x3112361, 0x3112415, 0x3112424, 0x3112433, 0x3112442, 0x3112451,
+	0x3112514, 0x3112523, 0x3112532, 0x3112541, 0x3112613, 0x3112622, 0x3112631, 0x3113126,
+	0x3113135, 0x3113144, 0x3113153, 0x3113162, 0x3113216, 0x3113225, 0x3113234, 0x3113243,
+	0x3113252, 0x3113261, 0x3113315, 0x3113324, 0x3113333, 0x3113342, 0x3113351, 0x3113414,
+	0x3113423, 0x3113432, 0x3113441, 0x3113513, 0x3113522, 0x3113531, 0x3113612, 0x3113621,
+	0x3114116, 0x3114125, 0x3114134, 0x3114143, 0x3114152, 0x3114161, 0x3114215, 0x3114224,
+	0x3114233, 0x3114242, 0x3114251, 0x3114314, 0x3114323, 0x3114332, 0x3114341, 0x3114413,
+	0x3114422, 0x3114431, 0x3114512, 0x3114521, 0x3114611, 0x3115115, 0x3115124, 0x3115133,
+	0x3115142, 0x3115151, 0x3115214, 0x3115223, 0x3115232, 0x3115241, 0x3115313, 0x3115322,
+	0x3115331, 0x3115412, 0x3115421, 0x3115511, 0x3116114, 0x3116123, 0x3116132, 0x3116141,
+	0x3116213, 0x3116222, 0x3116231, 0x3116312, 0x3116321, 0x3116411, 0x3121136, 0x3121145,
+	0x3121154, 0x3121163, 0x3121226, 0x3121235, 0x3121244, 0x3121253, 0x3121262, 0x3121316,
+	0x3121325, 0x3121334, 0x3121343, 0x3121352, 0x3121361, 0x3121415, 0x3121424, 0x3121433,
+	0x3121442, 0x3121451, 0x3121514, 0x3121523, 0x3121532, 0x3121541, 0x3121613, 0x3121622,
+	0x3121631, 0x3122126, 0x3122135, 0x3122144, 0x3122153, 0x3122162, 0x3122216, 0x3122225,
+	0x3122234, 0x3122243, 0x3122252, 0x3122261, 0x3122315, 0x3122324, 0x3122333, 0x3122342,
+	0x3122351, 0x3122414, 0x3122423, 0x3122432, 0x3122441, 0x3122513, 0x3122522, 0x3122531,
+	0x3122612, 0x3122621, 0x3123116, 0x3123125, 0x3123134, 0x3123143, 0x3123152, 0x3123161,
+	0x3123215, 0x3123224, 0x3123233, 0x3123242, 0x3123251, 0x3123314, 0x3123323, 0x3123332,
+	0x3123341, 0x3123413, 0x3123422, 0x3123431, 0x3123512, 0x3123521, 0x3123611, 0x3124115,
+	0x3124124, 0x3124133, 0x3124142, 0x3124151, 0x3124214, 0x3124223, 0x3124232, 0x3124241,
+	0x3124313, 0x3124322, 0x3124331, 0x3124412, 0x3124421, 0x3124511, 0x3125114, 0x3125123,
+	0x3125132, 0x3125141, 0x3125213, 0x3125222, 0x3125231, 0x3125312, 0x3125321, 0x3125411,
+	0x3126113, 0x3126122, 0x3126131, 0x3126212, 0x3126221, 0x3126311, 0x3131126, 0x3131135,
+	0x3131144, 0x3131153, 0x3131162, 0x3131216, 0x3131225, 0x3131234, 0x3131243, 0x3131252,
+	0x3131261, 0x3131315, 0x3131324, 0x3131333, 0x3131342, 0x3131351, 0x3131414, 0x3131423,
+	0x3131432, 0x3131441, 0x3131513, 0x3131522, 0x3131531, 0x3131612, 0x3131621, 0x3132116,
+	0x3132125, 0x3132134, 0x3132143, 0x3132152, 0x3132161, 0x3132215, 0x3132224, 0x3132233,
+	0x3132242, 0x3132251, 0x3132314, 0x3132323, 0x3132332, 0x3132341, 0x3132413, 0x3132422,
+	0x3132431, 0x3132512, 0x3132521, 0x3132611, 0x3133115, 0x3133124, 0x3133133, 0x3133142,
+	0x3133151, 0x3133214, 0x3133223, 0x3133232, 0x3133241, 0x3133313, 0x3133322, 0x3133331,
+	0x3133412, 0x3133421, 0x3133511, 0x3134114, 0x3134123, 0x3134132, 0x3134141, 0x3134213,
+	0x3134222, 0x3134231, 0x3134312, 0x3134321, 0x3134411, 0x3135113, 0x3135122, 0x3135131,
+	0x3135212, 0x3135221, 0x3135311, 0x3136112, 0x3136121, 0x3136211, 0x3141116, 0x3141125,
+	0x3141134, 0x3141143, 0x3141152, 0x3141161, 0x3141215, 0x3141224, 0x3141233, 0x3141242,
+	0x3141251, 0x3141314, 0x3141323, 0x3141332, 0x3141341, 0x3141413, 0x3141422, 0x3141431,
+	0x3141512, 0x3141521, 0x3141611, 0x3142115, 0x3142124, 0x3142133, 0x3142142, 0x3142151,
+	0x3142214, 0x3142223, 0x3142232, 0x3142241, 0x3142313, 0x3142322, 0x3142331, 0x3142412,
+	0x3142421, 0x3142511, 0x3143114, 0x3143123, 0x3143132, 0x3143141, 0x3143213, 0x3143222,
+	0x3143231, 0x3143312, 0x3143321, 0x3143411, 0x3144113, 0x3144122, 0x3144131, 0x3144212,
+	0x3144221, 0x3144311, 0x3145112, 0x3145121, 0x3145211, 0x3146111, 0x3151115, 0x3151124,
+	0x3151133, 0x3151142, 0x3151151, 0x3151214, 0x3151223, 0x3151232, 0x3151241, 0x3151313,
+	0x3151322, 0x3151331, 0x3151412, 0x3151421, 0x3151511, 0x3152114, 0x3152123, 0x3152132,
+	0x3152141, 0x3152213, 0x3152222, 0x3152231, 0x3152312, 0x3152321, 0x3152411, 0x3153113,
+	0x3153122, 0x3153131, 0x3153212, 0x3153221, 0x3153311, 0x3154112, 0x3154121, 0x3154211,
+	0x3155111, 0x3161114, 0x3161123, 0x3161132, 0x3161141, 0x3161213, 0x3161222, 0x3161231,
+	0x3161312, 0x3161321, 0x3161411, 0x3162113, 0x3162122, 0x3162131, 0x3162212, 0x3162221,
+	0x3162311, 0x3163112, 0x3163121, 0x3163211, 0x3164111, 0x3211136, 0x3211145, 0x3211154,
+	0x3211163, 0x3211226, 0x3211235, 0x3211244, 0x3211253, 0x3211262, 0x3211316, 0x3211325,
+	0x3211334, 0x3211343, 0x3211352, 0x3211361, 0x3211415, 0x3211424, 0x3211433, 0x3211442,
+	0x3211451, 0x3211514, 0x3211523, 0x3211532, 0x3211541, 0x3211613, 0x3211622, 0x3211631,
+	0x3212126, 0x3212135, 0x3212144, 0x3212153, 0x3212162, 0x3212216, 0x3212225, 0x3212234,
+	0x3212243, 0x3212252, 0x3212261, 0x3212315, 0x3212324, 0x3212333, 0x3212342, 0x3212351,
+	0x3212414, 0x3212423, 0x3212432, 0x3212441, 0x3212513, 0x3212522, 0x3212531, 0x3212612,
+	0x3212621, 0x3213116, 0x3213125, 0x3213134, 0x3213143, 0x3213152, 0x3213161, 0x3213215,
+	0x3213224, 0x3213233, 0x3213242, 0x3213251, 0x3213314, 0x3213323, 0x3213332, 0x3213341,
+	0x3213413, 0x3213422, 0x3213431, 0x3213512, 0x3213521, 0x3213611, 0x3214115, 0x3214124,
+	0x3214133, 0x3214142, 0x3214151, 0x3214214, 0x3214223, 0x3214232, 0x3214241, 0x3214313,
+	0x3214322, 0x3214331, 0x3214412, 0x3214421, 0x3214511, 0x3215114, 0x3215123, 0x3215132,
+	0x3215141, 0x3215213, 0x3215222, 0x3215231, 0x3215312, 0x3215321, 0x3215411, 0x3216113,
+	0x3216122, 0x3216131, 0x3216212, 0x3216221, 0x3216311, 0x3221126, 0x3221135, 0x3221144,
+	0x3221153, 0x3221162, 0x3221216, 0x3221225, 0x3221234, 0x3221243, 0x3221252, 0x3221261,
+	0x3221315, 0x3221324, 0x3221333, 0x3221342, 0x3221351, 0x3221414, 0x3221423, 0x3221432,
+	0x3221441, 0x3221513, 0x3221522, 0x3221531, 0x3221612, 0x3221621, 0x3222116, 0x3222125,
+	0x3222134, 0x3222143, 0x3222152, 0x3222161, 0x3222215, 0x3222224, 0x3222233, 0x3222242,
+	0x3222251, 0x3222314, 0x3222323, 0x3222332, 0x3222341, 0x3222413, 0x3222422, 0x3222431,
+	0x3222512, 0x3222521, 0x3222611, 0x3223115, 0x3223124, 0x3223133, 0x3223142, 0x3223151,
+	0x3223214, 0x3223223, 0x3223232, 0x3223241, 0x3223313, 0x3223322, 0x3223331, 0x3223412,
+	0x3223421, 0x3223511, 0x3224114, 0x3224123, 0x3224132, 0x3224141, 0x3224213, 0x3224222,
+	0x3224231, 0x3224312, 0x3224321, 0x3224411, 0x3225113, 0x3225122, 0x3225131, 0x3225212,
+	0x3225221, 0x3225311, 0x3226112, 0x3226121, 0x3226211, 0x3231116, 0x3231125, 0x3231134,
+	0x3231143, 0x3231152, 0x3231161, 0x3231215, 0x3231224, 0x3231233, 0x3231242, 0x3231251,
+	0x3231314, 0x3231323, 0x3231332, 0x3231341, 0x3231413, 0x3231422, 0x3231431, 0x3231512,
+	0x3231521, 0x3231611, 0x3232115, 0x3232124, 0x3232133, 0x3232142, 0x3232151, 0x3232214,
+	0x3232223, 0x3232232, 0x3232241, 0x3232313, 0x3232322, 0x3232331, 0x3232412, 0x3232421,
+	0x3232511, 0x3233114, 0x3233123, 0x3233132, 0x3233141, 0x3233213, 0x3233222, 0x3233231,
+	0x3233312, 0x3233321, 0x3233411, 0x3234113, 0x3234122, 0x3234131, 0x3234212, 0x3234221,
+	0x3234311, 0x3235112, 0x3235121, 0x3235211, 0x3236111, 0x3241115, 0x3241124, 0x3241133,
+	0x3241142, 0x3241151, 0x3241214, 0x3241223, 0x3241232, 0x3241241, 0x3241313, 0x3241322,
+	0x3241331, 0x3241412, 0x3241421, 0x3241511, 0x3242114, 0x3242123, 0x3242132, 0x3242141,
+	0x3242213, 0x3242222, 0x3242231, 0x3242312, 0x3242321, 0x3242411, 0x3243113, 0x3243122,
+	0x3243131, 0x3243212, 0x3243221, 0x3243311, 0x3244112, 0x3244121, 0x3244211, 0x3245111,
+	0x3251114, 0x3251123, 0x3251132, 0x3251141, 0x3251213, 0x3251222, 0x3251231, 0x3251312,
+	0x3251321, 0x3251411, 0x3252113, 0x3252122, 0x3252131, 0x3252212, 0x3252221, 0x3252311,
+	0x3253112, 0x3253121, 0x3253211, 0x3254111, 0x3261113, 0x3261122, 0x3261131, 0x3261212,
+	0x3261221, 0x3261311, 0x3262112, 0x3262121, 0x3262211, 0x3263111, 0x3311126, 0x3311135,
+	0x3311144, 0x3311153, 0x3311162, 0x3311216, 0x3311225, 0x3311234, 0x3311243, 0x3311252,
+	0x3311261, 0x3311315, 0x3311324, 0x3311333, 0x3311342, 0x3311351, 0x3311414, 0x3311423,
+	0x3311432, 0x3311441, 0x3311513, 0x3311522, 0x3311531, 0x3311612, 0x3311621, 0x3312116,
+	0x3312125, 0x3312134, 0x3312143, 0x3312152, 0x3312161, 0x3312215, 0x3312224, 0x3312233,
+	0x3312242, 0x3312251, 0x3312314, 0x3312323, 0x3312332, 0x3312341, 0x3312413, 0x3312422,
+	0x3312431, 0x3312512, 0x3312521, 0x3312611, 0x3313115, 0x3313124, 0x3313133, 0x3313142,
+	0x3313151, 0x3313214, 0x3313223, 0x3313232, 0x3313241, 0x3313313, 0x3313322, 0x3313331,
+	0x3313412, 0x3313421, 0x3313511, 0x3314114, 0x3314123, 0x3314132, 0x3314141, 0x3314213,
+	0x3314222, 0x3314231, 0x3314312, 0x3314321, 0x3314411, 0x3315113, 0x3315122, 0x3315131,
+	0x3315212, 0x3315221, 0x3315311, 0x3316112, 0x3316121, 0x3316211, 0x3321116, 0x3321125,
+	0x3321134, 0x3321143, 0x3321152, 0x3321161, 0x3321215, 0x3321224, 0x3321233, 0x3321242,
+	0x3321251, 0x3321314, 0x3321323, 0x3321332, 0x3321341, 0x3321413, 0x3321422, 0x3321431,
+	0x3321512, 0x3321521, 0x3321611, 0x3322115, 0x3322124, 0x3322133, 0x3322142, 0x3322151,
+	0x3322214, 0x3322223, 0x3322232, 0x3322241, 0x3322313, 0x3322322, 0x3322331, 0x3322412,
+	0x3322421, 0x3322511, 0x3323114, 0x3323123, 0x3323132, 0x3323141, 0x3323213, 0x3323222,
+	0x3323231, 0x3323312, 0x3323321, 0x3323411, 0x3324113, 0x3324122, 0x3324131, 0x3324212,
+	0x3324221, 0x3324311, 0x3325112, 0x3325121, 0x3325211, 0x3326111, 0x3331115, 0x3331124,
+	0x3331133, 0x3331142, 0x3331151, 0x3331214, 0x3331223, 0x3331232, 0x3331241, 0x3331313,
+	0x3331322, 0x3331331, 0x3331412, 0x3331421, 0x3331511, 0x3332114, 0x3332123, 0x3332132,
+	0x3332141, 0x3332213, 0x3332222, 0x3332231, 0x3332312, 0x3332321, 0x3332411, 0x3333113,
+	0x3333122, 0x3333131, 0x3333212, 0x3333221, 0x3333311, 0x3334112, 0x3334121, 0x3334211,
+	0x3335111, 0x3341114, 0x3341123, 0x3341132, 0x3341141, 0x3341213, 0x3341222, 0x3341231,
+	0x3341312, 0x3341321, 0x3341411, 0x3342113, 0x3342122, 0x3342131, 0x3342212, 0x3342221,
+	0x3342311, 0x3343112, 0x3343121, 0x3343211, 0x3344111, 0x3351113, 0x3351122, 0x3351131,
+	0x3351212, 0x3351221, 0x3351311, 0x3352112, 0x3352121, 0x3352211, 0x3353111, 0x3361112,
+	0x3361121, 0x3361211, 0x3362111, 0x3411116, 0x3411125, 0x3411134, 0x3411143, 0x3411152,
+	0x3411161, 0x3411215, 0x3411224, 0x3411233, 0x3411242, 0x3411251, 0x3411314, 0x3411323,
+	0x3411332, 0x3411341, 0x3411413, 0x3411422, 0x3411431, 0x3411512, 0x3411521, 0x3411611,
+	0x3412115, 0x3412124, 0x3412133, 0x3412142, 0x3412151, 0x3412214, 0x3412223, 0x3412232,
+	0x3412241, 0x3412313, 0x3412322, 0x3412331, 0x3412412, 0x3412421, 0x3412511, 0x3413114,
+	0x3413123, 0x3413132, 0x3413141, 0x3413213, 0x3413222, 0x3413231, 0x3413312, 0x3413321,
+	0x3413411, 0x3414113, 0x3414122, 0x3414131, 0x3414212, 0x3414221, 0x3414311, 0x3415112,
+	0x3415121, 0x3415211, 0x3416111, 0x3421115, 0x3421124, 0x3421133, 0x3421142, 0x3421151,
+	0x3421214, 0x3421223, 0x3421232, 0x3421241, 0x3421313, 0x3421322, 0x3421331, 0x3421412,
+	0x3421421, 0x3421511, 0x3422114, 0x3422123, 0x3422132, 0x3422141, 0x3422213, 0x3422222,
+	0x3422231, 0x3422312, 0x3422321, 0x3422411, 0x3423113, 0x3423122, 0x3423131, 0x3423212,
+	0x3423221, 0x3423311, 0x3424112, 0x3424121, 0x3424211, 0x3425111, 0x3431114, 0x3431123,
+	0x3431132, 0x3431141, 0x3431213, 0x3431222, 0x3431231, 0x3431312, 0x3431321, 0x3431411,
+	0x3432113, 0x3432122, 0x3432131, 0x3432212, 0x3432221, 0x3432311, 0x3433112, 0x3433121,
+	0x3433211, 0x3434111, 0x3441113, 0x3441122, 0x3441131, 0x3441212, 0x3441221, 0x3441311,
+	0x3442112, 0x3442121, 0x3442211, 0x3443111, 0x3451112, 0x3451121, 0x3451211, 0x3452111,
+	0x3461111, 0x3511115, 0x3511124, 0x3511133, 0x3511142, 0x3511151, 0x3511214, 0x3511223,
+	0x3511232, 0x3511241, 0x3511313, 0x3511322, 0x3511331, 0x3511412, 0x3511421, 0x3511511,
+	0x3512114, 0x3512123, 0x3512132, 0x3512141, 0x3512213, 0x3512222, 0x3512231, 0x3512312,
+	0x3512321, 0x3512411, 0x3513113, 0x3513122, 0x3513131, 0x3513212, 0x3513221, 0x3513311,
+	0x3514112, 0x3514121, 0x3514211, 0x3515111, 0x3521114, 0x3521123, 0x3521132, 0x3521141,
+	0x3521213, 0x3521222, 0x3521231, 0x3521312, 0x3521321, 0x3521411, 0x3522113, 0x3522122,
+	0x3522131, 0x3522212, 0x3522221, 0x3522311, 0x3523112, 0x3523121, 0x3523211, 0x3524111,
+	0x3531113, 0x3531122, 0x3531131, 0x3531212, 0x3531221, 0x3531311, 0x3532112, 0x3532121,
+	0x3532211, 0x3533111, 0x3541112, 0x3541121, 0x3541211, 0x3542111, 0x3551111, 0x3611114,
+	0x3611123, 0x3611132, 0x3611141, 0x3611213, 0x3611222, 0x3611231, 0x3611312, 0x3611321,
+	0x3611411, 0x3612113, 0x3612122, 0x3612131, 0x3612212, 0x3612221, 0x3612311, 0x3613112,
+	0x3613121, 0x3613211, 0x3614111, 0x3621113, 0x3621122, 0x3621131, 0x3621212, 0x3621221,
+	0x3621311, 0x3622112, 0x3622121, 0x3622211, 0x3623111, 0x3631112, 0x3631121, 0x3631211,
+	0x3632111, 0x3641111, 0x4111136, 0x4111145, 0x4111154, 0x4111163, 0x4111226, 0x4111235,
+	0x4111244, 0x4111253, 0x4111262, 0x4111316, 0x4111325, 0x4111334, 0x4111343, 0x4111352,
+	0x4111361, 0x4111415, 0x4111424, 0x4111433, 0x4111442, 0x4111451, 0x4111514, 0x4111523,
+	0x4111532, 0x4111541, 0x4111613, 0x4111622, 0x4111631, 0x4112126, 0x4112135, 0x4112144,
+	0x4112153, 0x4112162, 0x4112216, 0x4112225, 0x4112234, 0x4112243, 0x4112252, 0x4112261,
+	0x4112315, 0x4112324, 0x4112333, 0x4112342, 0x4112351, 0x4112414, 0x4112423, 0x4112432,
+	0x4112441, 0x4112513, 0x4112522, 0x4112531, 0x4112612, 0x4112621, 0x4113116, 0x4113125,
+	0x4113134, 0x4113143, 0x4113152, 0x4113161, 0x4113215, 0x4113224, 0x4113233, 0x4113242,
+	0x4113251, 0x4113314, 0x4113323, 0x4113332, 0x4113341, 0x4113413, 0x4113422, 0x4113431,
+	0x4113512, 0x4113521, 0x4113611, 0x4114115, 0x4114124, 0x4114133, 0x4114142, 0x4114151,
+	0x4114214, 0x4114223, 0x4114232, 0x4114241, 0x4114313, 0x4114322, 0x4114331, 0x4114412,
+	0x4114421, 0x4114511, 0x4115114, 0x4115123, 0x4115132, 0x4115141, 0x4115213, 0x4115222,
+	0x4115231, 0x4115312, 0x4115321, 0x4115411, 0x4116113, 0x4116122, 0x4116131, 0x4116212,
+	0x4116221, 0x4116311, 0x4121126, 0x4121135, 0x4121144, 0x4121153, 0x4121162, 0x4121216,
+	0x4121225, 0x4121234, 0x4121243, 0x4121252, 0x4121261, 0x4121315, 0x4121324, 0x4121333,
+	0x4121342, 0x4121351, 0x4121414, 0x4121423, 0x4121432, 0x4121441, 0x4121513, 0x4121522,
+	0x4121531, 0x4121612, 0x4121621, 0x4122116, 0x4122125, 0x4122134, 0x4122143, 0x4122152,
+	0x4122161, 0x4122215, 0x4122224, 0x4122233, 0x4122242, 0x4122251, 0x4122314, 0x4122323,
+	0x4122332, 0x4122341, 0x4122413, 0x4122422, 0x4122431, 0x4122512, 0x4122521, 0x4122611,
+	0x4123115, 0x4123124, 0x4123133, 0x4123142, 0x4123151, 0x4123214, 0x4123223, 0x4123232,
+	0x4123241, 0x4123313, 0x4123322, 0x4123331, 0x4123412, 0x4123421, 0x4123511, 0x4124114,
+	0x4124123, 0x4124132, 0x4124141, 0x4124213, 0x4124222, 0x4124231, 0x4124312, 0x4124321,
+	0x4124411, 0x4125113, 0x4125122, 0x4125131, 0x4125212, 0x4125221, 0x4125311, 0x4126112,
+	0x4126121, 0x4126211, 0x4131116, 0x4131125, 0x4131134, 0x4131143, 0x4131152, 0x4131161,
+	0x4131215, 0x4131224, 0x4131233, 0x4131242, 0x4131251, 0x4131314, 0x4131323, 0x4131332,
+	0x4131341, 0x4131413, 0x4131422, 0x4131431, 0x4131512, 0x4131521, 0x4131611, 0x4132115,
+	0x4132124, 0x4132133, 0x4132142, 0x4132151, 0x4132214, 0x4132223, 0x4132232, 0x4132241,
+	0x4132313, 0x4132322, 0x4132331, 0x4132412, 0x4132421, 0x4132511, 0x4133114, 0x4133123,
+	0x4133132, 0x4133141, 0x4133213, 0x4133222, 0x4133231, 0x4133312, 0x4133321, 0x4133411,
+	0x4134113, 0x4134122, 0x4134131, 0x4134212, 0x4134221, 0x4134311, 0x4135112, 0x4135121,
+	0x4135211, 0x4136111, 0x4141115, 0x4141124, 0x4141133, 0x4141142, 0x4141151, 0x4141214,
+	0x4141223, 0x4141232, 0x4141241, 0x4141313, 0x4141322, 0x4141331, 0x4141412, 0x4141421,
+	0x4141511, 0x4142114, 0x4142123, 0x4142132, 0x4142141, 0x4142213, 0x4142222, 0x4142231,
+	0x4142312, 0x4142321, 0x4142411, 0x4143113, 0x4143122, 0x4143131, 0x4143212, 0x4143221,
+	0x4143311, 0x4144112, 0x4144121, 0x4144211, 0x4145111, 0x4151114, 0x4151123, 0x4151132,
+	0x4151141, 0x4151213, 0x4151222, 0x4151231, 0x4151312, 0x4151321, 0x4151411, 0x4152113,
+	0x4152122, 0x4152131, 0x4152212, 0x4152221, 0x4152311, 0x4153112, 0x4153121, 0x4153211,
+	0x4154111, 0x4161113, 0x4161122, 0x4161131, 0x4161212, 0x4161221, 0x4161311, 0x4162112,
+	0x4162121, 0x4162211, 0x4163111, 0x4211126, 0x4211135, 0x4211144, 0x4211153, 0x4211162,
+	0x4211216, 0x4211225, 0x4211234, 0x4211243, 0x4211252, 0x4211261, 0x4211315, 0x4211324,
+	0x4211333, 0x4211342, 0x4211351, 0x4211414, 0x4211423, 0x4211432, 0x4211441, 0x4211513,
+	0x4211522, 0x4211531, 0x4211612, 0x4211621, 0x4212116, 0x4212125, 0x4212134, 0x4212143,
+	0x4212152, 0x4212161, 0x4212215, 0x4212224, 0x4212233, 0x4212242, 0x4212251, 0x4212314,
+	0x4212323, 0x4212332, 0x4212341, 0x4212413, 0x4212422, 0x4212431, 0x4212512, 0x4212521,
+	0x4212611, 0x4213115, 0x4213124, 0x4213133, 0x4213142, 0x4213151, 0x4213214, 0x4213223,
+	0x4213232, 0x4213241, 0x4213313, 0x4213322, 0x4213331, 0x4213412, 0x4213421, 0x4213511,
+	0x4214114, 0x4214123, 0x4214132, 0x4214141, 0x4214213, 0x4214222, 0x4214231, 0x4214312,
+	0x4214321, 0x4214411, 0x4215113, 0x4215122, 0x4215131, 0x4215212, 0x4215221, 0x4215311,
+	0x4216112, 0x4216121, 0x4216211, 0x4221116, 0x4221125, 0x4221134, 0x4221143, 0x4221152,
+	0x4221161, 0x4221215, 0x4221224, 0x4221233, 0x4221242, 0x4221251, 0x4221314, 0x4221323,
+	0x4221332, 0x4221341, 0x4221413, 0x4221422, 0x4221431, 0x4221512, 0x4221521, 0x4221611,
+	0x4222115, 0x4222124, 0x4222133, 0x4222142, 0x4222151, 0x4222214, 0x4222223, 0x4222232,
+	0x4222241, 0x4222313, 0x4222322, 0x4222331, 0x4222412, 0x4222421, 0x4222511, 0x4223114,
+	0x4223123, 0x4223132, 0x4223141, 0x4223213, 0x4223222, 0x4223231, 0x4223312, 0x4223321,
+	0x4223411, 0x4224113, 0x4224122, 0x4224131, 0x4224212, 0x4224221, 0x4224311, 0x4225112,
+	0x4225121, 0x4225211, 0x4226111, 0x4231115, 0x4231124, 0x4231133, 0x4231142, 0x4231151,
+	0x4231214, 0x4231223, 0x4231232, 0x4231241, 0x4231313, 0x4231322, 0x4231331, 0x4231412,
+	0x4231421, 0x4231511, 0x4232114, 0x4232123, 0x4232132, 0x4232141, 0x4232213, 0x4232222,
+	0x4232231, 0x4232312, 0x4232321, 0x4232411, 0x4233113, 0x4233122, 0x4233131, 0x4233212,
+	0x4233221, 0x4233311, 0x4234112, 0x4234121, 0x4234211, 0x4235111, 0x4241114, 0x4241123,
+	0x4241132, 0x4241141, 0x4241213, 0x4241222, 0x4241231, 0x4241312, 0x4241321, 0x4241411,
+	0x4242113, 0x4242122, 0x4242131, 0x4242212, 0x4242221, 0x4242311, 0x4243112, 0x4243121,
+	0x4243211, 0x4244111, 0x4251113, 0x4251122, 0x4251131, 0x4251212, 0x4251221, 0x4251311,
+	0x4252112, 0x4252121, 0x4252211, 0x4253111, 0x4261112, 0x4261121, 0x4261211, 0x4262111,
+	0x4311116, 0x4311125, 0x4311134, 0x4311143, 0x4311152, 0x4311161, 0x4311215, 0x4311224,
+	0x4311233, 0x4311242, 0x4311251, 0x4311314, 0x4311323, 0x4311332, 0x4311341, 0x4311413,
+	0x4311422, 0x4311431, 0x4311512, 0x4311521, 0x4311611, 0x4312115, 0x4312124, 0x4312133,
+	0x4312142, 0x4312151, 0x4312214, 0x4312223, 0x4312232, 0x4312241, 0x4312313, 0x4312322,
+	0x4312331, 0x4312412, 0x4312421, 0x4312511, 0x4313114, 0x4313123, 0x4313132, 0x4313141,
+	0x4313213, 0x4313222, 0x4313231, 0x4313312, 0x4313321, 0x4313411, 0x4314113, 0x4314122,
+	0x4314131, 0x4314212, 0x4314221, 0x4314311, 0x4315112, 0x4315121, 0x4315211, 0x4316111,
+	0x4321115, 0x4321124, 0x4321133, 0x4321142, 0x4321151, 0x4321214, 0x4321223, 0x4321232,
+	0x4321241, 0x4321313, 0x4321322, 0x4321331, 0x4321412, 0x4321421, 0x4321511, 0x4322114,
+	0x4322123, 0x4322132, 0x4322141, 0x4322213, 0x4322222, 0x4322231, 0x4322312, 0x4322321,
+	0x4322411, 0x4323113, 0x4323122, 0x4323131, 0x4323212, 0x4323221, 0x4323311, 0x4324112,
+	0x4324121, 0x4324211, 0x4325111, 0x4331114, 0x4331123, 0x4331132, 0x4331141, 0x4331213,
+	0x4331222, 0x4331231, 0x4331312, 0x4331321, 0x4331411, 0x4332113, 0x4332122, 0x4332131,
+	0x4332212, 0x4332221, 0x4332311, 0x4333112, 0x4333121, 0x4333211, 0x4334111, 0x4341113,
+	0x4341122, 0x4341131, 0x4341212, 0x4341221, 0x4341311, 0x4342112, 0x4342121, 0x4342211,
+	0x4343111, 0x4351112, 0x4351121, 0x4351211, 0x4352111, 0x4361111, 0x4411115, 0x4411124,
+	0x4411133, 0x4411142, 0x4411151, 0x4411214, 0x4411223, 0x4411232, 0x4411241, 0x4411313,
+	0x4411322, 0x4411331, 0x4411412, 0x4411421, 0x4411511, 0x4412114, 0x4412123, 0x4412132,
+	0x4412141, 0x4412213, 0x4412222, 0x4412231, 0x4412312, 0x4412321, 0x4412411, 0x4413113,
+	0x4413122, 0x4413131, 0x4413212, 0x4413221, 0x4413311, 0x4414112, 0x4414121, 0x4414211,
+	0x4415111, 0x4421114, 0x4421123, 0x4421132, 0x4421141, 0x4421213, 0x4421222, 0x4421231,
+	0x4421312, 0x4421321, 0x4421411, 0x4422113, 0x4422122, 0x4422131, 0x4422212, 0x4422221,
+	0x4422311, 0x4423112, 0x4423121, 0x4423211, 0x4424111, 0x4431113, 0x4431122, 0x4431131,
+	0x4431212, 0x4431221, 0x4431311, 0x4432112, 0x4432121, 0x4432211, 0x4433111, 0x4441112,
+	0x4441121, 0x4441211, 0x4442111, 0x4451111, 0x4511114, 0x4511123, 0x4511132, 0x4511141,
+	0x4511213, 0x4511222, 0x4511231, 0x4511312, 0x4511321, 0x4511411, 0x4512113, 0x4512122,
+	0x4512131, 0x4512212, 0x4512221, 0x4512311, 0x4513112, 0x4513121, 0x4513211, 0x4514111,
+	0x4521113, 0x4521122, 0x4521131, 0x4521212, 0x4521221, 0x4521311, 0x4522112, 0x4522121,
+	0x4522211, 0x4523111, 0x4531112, 0x4531121, 0x4531211, 0x4532111, 0x4541111, 0x4611113,
+	0x4611122, 0x4611131, 0x4611212, 0x4611221, 0x4611311, 0x4612112, 0x4612121, 0x4612211,
+	0x4613111, 0x4621112, 0x4621121, 0x4621211, 0x4622111, 0x4631111, 0x5111126, 0x5111135,
+	0x5111144, 0x5111153, 0x5111162, 0x5111216, 0x5111225, 0x5111234, 0x5111243, 0x5111252,
+	0x5111261, 0x5111315, 0x5111324, 0x5111333, 0x5111342, 0x5111351, 0x5111414, 0x5111423,
+	0x5111432, 0x5111441, 0x5111513, 0x5111522, 0x5111531, 0x5111612, 0x5111621, 0x5112116,
+	0x5112125, 0x5112134, 0x5112143, 0x5112152, 0x5112161, 0x5112215, 0x5112224, 0x5112233,
+	0x5112242, 0x5112251, 0x5112314, 0x5112323, 0x5112332, 0x5112341, 0x5112413, 0x5112422,
+	0x5112431, 0x5112512, 0x5112521, 0x5112611, 0x5113115, 0x5113124, 0x5113133, 0x5113142,
+	0x5113151, 0x5113214, 0x5113223, 0x5113232, 0x5113241, 0x5113313, 0x5113322, 0x5113331,
+	0x5113412, 0x5113421, 0x5113511, 0x5114114, 0x5114123, 0x5114132, 0x5114141, 0x5114213,
+	0x5114222, 0x5114231, 0x5114312, 0x5114321, 0x5114411, 0x5115113, 0x5115122, 0x5115131,
+	0x5115212, 0x5115221, 0x5115311, 0x5116112, 0x5116121, 0x5116211, 0x5121116, 0x5121125,
+	0x5121134, 0x5121143, 0x5121152, 0x5121161, 0x5121215, 0x5121224, 0x5121233, 0x5121242,
+	0x5121251, 0x5121314, 0x5121323, 0x5121332, 0x5121341, 0x5121413, 0x5121422, 0x5121431,
+	0x5121512, 0x5121521, 0x5121611, 0x5122115, 0x5122124, 0x5122133, 0x5122142, 0x5122151,
+	0x5122214, 0x5122223, 0x5122232, 0x5122241, 0x5122313, 0x5122322, 0x5122331, 0x5122412,
+	0x5122421, 0x5122511, 0x5123114, 0x5123123, 0x5123132, 0x5123141, 0x5123213, 0x5123222,
+	0x5123231, 0x5123312, 0x5123321, 0x5123411, 0x5124113, 0x5124122, 0x5124131, 0x5124212,
+	0x5124221, 0x5124311, 0x5125112, 0x5125121, 0x5125211, 0x5126111, 0x5131115, 0x5131124,
+	0x5131133, 0x5131142, 0x5131151, 0x5131214, 0x5131223, 0x5131232, 0x5131241, 0x5131313,
+	0x5131322, 0x5131331, 0x5131412, 0x5131421, 0x5131511, 0x5132114, 0x5132123, 0x5132132,
+	0x5132141, 0x5132213, 0x5132222, 0x5132231, 0x5132312, 0x5132321, 0x5132411, 0x5133113,
+	0x5133122, 0x5133131, 0x5133212, 0x5133221, 0x5133311, 0x5134112, 0x5134121, 0x5134211,
+	0x5135111, 0x5141114, 0x5141123, 0x5141132, 0x5141141, 0x5141213, 0x5141222, 0x5141231,
+	0x5141312, 0x5141321, 0x5141411, 0x5142113, 0x5142122, 0x5142131, 0x5142212, 0x5142221,
+	0x5142311, 0x5143112, 0x5143121, 0x5143211, 0x5144111, 0x5151113, 0x5151122, 0x5151131,
+	0x5151212, 0x5151221, 0x5151311, 0x5152112, 0x5152121, 0x5152211, 0x5153111, 0x5161112,
+	0x5161121, 0x5161211, 0x5162111, 0x5211116, 0x5211125, 0x5211134, 0x5211143, 0x5211152,
+	0x5211161, 0x5211215, 0x5211224, 0x5211233, 0x5211242, 0x5211251, 0x5211314, 0x5211323,
+	0x5211332, 0x5211341, 0x5211413, 0x5211422, 0x5211431, 0x5211512, 0x5211521, 0x5211611,
+	0x5212115, 0x5212124, 0x5212133, 0x5212142, 0x5212151, 0x5212214, 0x5212223, 0x5212232,
+	0x5212241, 0x5212313, 0x5212322, 0x5212331, 0x5212412, 0x5212421, 0x5212511, 0x5213114,
+	0x5213123, 0x5213132, 0x5213141, 0x5213213, 0x5213222, 0x5213231, 0x5213312, 0x5213321,
+	0x5213411, 0x5214113, 0x5214122, 0x5214131, 0x5214212, 0x5214221, 0x5214311, 0x5215112,
+	0x5215121, 0x5215211, 0x5216111, 0x5221115, 0x5221124, 0x5221133, 0x5221142, 0x5221151,
+	0x5221214, 0x5221223, 0x5221232, 0x5221241, 0x5221313, 0x5221322, 0x5221331, 0x5221412,
+	0x5221421, 0x5221511, 0x5222114, 0x5222123, 0x5222132, 0x5222141, 0x5222213, 0x5222222,
+	0x5222231, 0x5222312, 0x5222321, 0x5222411, 0x5223113, 0x5223122, 0x5223131, 0x5223212,
+	0x5223221, 0x5223311, 0x5224112, 0x5224121, 0x5224211, 0x5225111, 0x5231114, 0x5231123,
+	0x5231132, 0x5231141, 0x5231213, 0x5231222, 0x5231231, 0x5231312, 0x5231321, 0x5231411,
+	0x5232113, 0x5232122, 0x5232131, 0x5232212, 0x5232221, 0x5232311, 0x5233112, 0x5233121,
+	0x5233211, 0x5234111, 0x5241113, 0x5241122, 0x5241131, 0x5241212, 0x5241221, 0x5241311,
+	0x5242112, 0x5242121, 0x5242211, 0x5243111, 0x5251112, 0x5251121, 0x5251211, 0x5252111,
+	0x5261111, 0x5311115, 0x5311124, 0x5311133, 0x5311142, 0x5311151, 0x5311214, 0x5311223,
+	0x5311232, 0x5311241, 0x5311313, 0x5311322, 0x5311331, 0x5311412, 0x5311421, 0x5311511,
+	0x5312114, 0x5312123, 0x5312132, 0x5312141, 0x5312213, 0x5312222, 0x5312231, 0x5312312,
+	0x5312321, 0x5312411, 0x5313113, 0x5313122, 0x5313131, 0x5313212, 0x5313221, 0x5313311,
+	0x5314112, 0x5314121, 0x5314211, 0x5315111, 0x5321114, 0x5321123, 0x5321132, 0x5321141,
+	0x5321213, 0x5321222, 0x5321231, 0x5321312, 0x5321321, 0x5321411, 0x5322113, 0x5322122,
+	0x5322131, 0x5322212, 0x5322221, 0x5322311, 0x5323112, 0x5323121, 0x5323211, 0x5324111,
+	0x5331113, 0x5331122, 0x5331131, 0x5331212, 0x5331221, 0x5331311, 0x5332112, 0x5332121,
+	0x5332211, 0x5333111, 0x5341112, 0x5341121, 0x5341211, 0x5342111, 0x5351111, 0x5411114,
+	0x5411123, 0x5411132, 0x5411141, 0x5411213, 0x5411222, 0x5411231, 0x5411312, 0x5411321,
+	0x5411411, 0x5412113, 0x5412122, 0x5412131, 0x5412212, 0x5412221, 0x5412311, 0x5413112,
+	0x5413121, 0x5413211, 0x5414111, 0x5421113, 0x5421122, 0x5421131, 0x5421212, 0x5421221,
+	0x5421311, 0x5422112, 0x5422121, 0x5422211, 0x5423111, 0x5431112, 0x5431121, 0x5431211,
+	0x5432111, 0x5441111, 0x5511113, 0x5511122, 0x5511131, 0x5511212, 0x5511221, 0x5511311,
+	0x5512112, 0x5512121, 0x5512211, 0x5513111, 0x5521112, 0x5521121, 0x5521211, 0x5522111,
+	0x5531111, 0x5611112, 0x5611121, 0x5611211, 0x5612111, 0x5621111, 0x6111116, 0x6111125,
+	0x6111134, 0x6111143, 0x6111152, 0x6111161, 0x6111215, 0x6111224, 0x6111233, 0x6111242,
+	0x6111251, 0x6111314, 0x6111323, 0x6111332, 0x6111341, 0x6111413, 0x6111422, 0x6111431,
+	0x6111512, 0x6111521, 0x6111611, 0x6112115, 0x6112124, 0x6112133, 0x6112142, 0x6112151,
+	0x6112214, 0x6112223, 0x6112232, 0x6112241, 0x6112313, 0x6112322, 0x6112331, 0x6112412,
+	0x6112421, 0x6112511, 0x6113114, 0x6113123, 0x6113132, 0x6113141, 0x6113213, 0x6113222,
+	0x6113231, 0x6113312, 0x6113321, 0x6113411, 0x6114113, 0x6114122, 0x6114131, 0x6114212,
+	0x6114221, 0x6114311, 0x6115112, 0x6115121, 0x6115211, 0x6116111, 0x6121115, 0x6121124,
+	0x6121133, 0x6121142, 0x6121151, 0x6121214, 0x6121223, 0x6121232, 0x6121241, 0x6121313,
+	0x6121322, 0x6121331, 0x6121412, 0x6121421, 0x6121511, 0x6122114, 0x6122123, 0x6122132,
+	0x6122141, 0x6122213, 0x6122222, 0x6122231, 0x6122312, 0x6122321, 0x6122411, 0x6123113,
+	0x6123122, 0x6123131, 0x6123212, 0x6123221, 0x6123311, 0x6124112, 0x6124121, 0x6124211,
+	0x6125111, 0x6131114, 0x6131123, 0x6131132, 0x6131141, 0x6131213, 0x6131222, 0x6131231,
+	0x6131312, 0x6131321, 0x6131411, 0x6132113, 0x6132122, 0x6132131, 0x6132212, 0x6132221,
+	0x6132311, 0x6133112, 0x6133121, 0x6133211, 0x6134111, 0x6141113, 0x6141122, 0x6141131,
+	0x6141212, 0x6141221, 0x6141311, 0x6142112, 0x6142121, 0x6142211, 0x6143111, 0x6151112,
+	0x6151121, 0x6151211, 0x6152111, 0x6161111, 0x6211115, 0x6211124, 0x6211133, 0x6211142,
+	0x6211151, 0x6211214, 0x6211223, 0x6211232, 0x6211241, 0x6211313, 0x6211322, 0x6211331,
+	0x6211412, 0x6211421, 0x6211511, 0x6212114, 0x6212123, 0x6212132, 0x6212141, 0x6212213,
+	0x6212222, 0x6212231, 0x6212312, 0x6212321, 0x6212411, 0x6213113, 0x6213122, 0x6213131,
+	0x6213212, 0x6213221, 0x6213311, 0x6214112, 0x6214121, 0x6214211, 0x6215111, 0x6221114,
+	0x6221123, 0x6221132, 0x6221141, 0x6221213, 0x6221222, 0x6221231, 0x6221312, 0x6221321,
+	0x6221411, 0x6222113, 0x6222122, 0x6222131, 0x6222212, 0x6222221, 0x6222311, 0x6223112,
+	0x6223121, 0x6223211, 0x6224111, 0x6231113, 0x6231122, 0x6231131, 0x6231212, 0x6231221,
+	0x6231311, 0x6232112, 0x6232121, 0x6232211, 0x6233111, 0x6241112, 0x6241121, 0x6241211,
+	0x6242111, 0x6251111, 0x6311114, 0x6311123, 0x6311132, 0x6311141, 0x6311213, 0x6311222,
+	0x6311231, 0x6311312, 0x6311321, 0x6311411, 0x6312113, 0x6312122, 0x6312131, 0x6312212,
+	0x6312221, 0x6312311, 0x6313112, 0x6313121, 0x6313211, 0x6314111, 0x6321113, 0x6321122,
+	0x6321131, 0x6321212, 0x6321221, 0x6321311, 0x6322112, 0x6322121, 0x6322211, 0x6323111,
+	0x6331112, 0x6331121, 0x6331211, 0x6332111, 0x6341111, 0x6411113, 0x6411122, 0x6411131,
+	0x6411212, 0x6411221, 0x6411311, 0x6412112, 0x6412121, 0x6412211, 0x6413111, 0x6421112,
+	0x6421121, 0x6421211, 0x6422111, 0x6431111, 0x6511112, 0x6511121, 0x6511211, 0x6512111,
+	0x6521111, 0x6611111, 0x1111113, 0x1111122, 0x1111131, 0x1111212, 0x1111221, 0x1111311,
+	0x1112112, 0x1112121, 0x1112211, 0x1113111, 0x1121112, 0x1121121, 0x1121211, 0x1122111,
+	0x1131111, 0x1211112, 0x1211121, 0x1211211, 0x1212111, 0x1221111, 0x1311111, 0x2111112,
+	0x2111121, 0x2111211, 0x2112111, 0x2121111, 0x2211111, 0x3111111, 0x1111135, 0x1111144,
+	0x1111153, 0x1111225, 0x1111234, 0x1111243, 0x1111252, 0x1111315, 0x1111324, 0x1111333,
+	0x1111342, 0x1111351, 0x1111414, 0x1111423, 0x1111432, 0x1111441, 0x1111513, 0x1111522,
+	0x1111531, 0x1112125, 0x1112134, 0x1112143, 0x1112152, 0x1112215, 0x1112224, 0x1112233,
+	0x1112242, 0x1112251, 0x1112314, 0x1112323, 0x1112332, 0x1112341, 0x1112413, 0x1112422,
+	0x1112431, 0x1112512, 0x1112521, 0x1113115, 0x1113124, 0x1113133, 0x1113142, 0x1113151,
+	0x1113214, 0x1113223, 0x1113232, 0x1113241, 0x1113313, 0x1113322, 0x1113331, 0x1113412,
+	0x1113421, 0x1113511, 0x1114114, 0x1114123, 0x1114132, 0x1114141, 0x1114213, 0x1114222,
+	0x1114231, 0x1114312, 0x1114321, 0x1114411, 0x1115113, 0x1115122, 0x1115131, 0x1115212,
+	0x1115221, 0x1115311, 0x1121125, 0x1121134, 0x1121143, 0x1121152, 0x1121215, 0x1121224,
+	0x1121233, 0x1121242, 0x1121251, 0x1121314, 0x1121323, 0x1121332, 0x1121341, 0x1121413,
+	0x1121422, 0x1121431, 0x1121512, 0x1121521, 0x1122115, 0x1122124, 0x1122133, 0x1122142,
+	0x1122151, 0x1122214, 0x1122223, 0x1122232, 0x1122241, 0x1122313, 0x1122322, 0x1122331,
+	0x1122412, 0x1122421, 0x1122511, 0x1123114, 0x1123123, 0x1123132, 0x1123141, 0x1123213,
+	0x1123222, 0x1123231, 0x1123312, 0x1123321, 0x1123411, 0x1124113, 0x1124122, 0x1124131,
+	0x1124212, 0x1124221, 0x1124311, 0x1125112, 0x1125121, 0x1125211, 0x1131115, 0x1131124,
+	0x1131133, 0x1131142, 0x1131151, 0x1131214, 0x1131223, 0x1131232, 0x1131241, 0x1131313,
+	0x1131322, 0x1131331, 0x1131412, 0x1131421, 0x1131511, 0x1132114, 0x1132123, 0x1132132,
+	0x1132141, 0x1132213, 0x1132222, 0x1132231, 0x1132312, 0x1132321, 0x1132411, 0x1133113,
+	0x1133122, 0x1133131, 0x1133212, 0x1133221, 0x1133311, 0x1134112, 0x1134121, 0x1134211,
+	0x1135111, 0x1141114, 0x1141123, 0x1141132, 0x1141141, 0x1141213, 0x1141222, 0x1141231,
+	0x1141312, 0x1141321, 0x1141411, 0x1142113, 0x1142122, 0x1142131, 0x1142212, 0x1142221,
+	0x1142311, 0x1143112, 0x1143121, 0x1143211, 0x1144111, 0x1151113, 0x1151122, 0x1151131,
+	0x1151212, 0x1151221, 0x1151311, 0x1152112, 0x1152121, 0x1152211, 0x1153111, 0x1211125,
+	0x1211134, 0x1211143, 0x1211152, 0x1211215, 0x1211224, 0x1211233, 0x1211242, 0x1211251,
+	0x1211314, 0x1211323, 0x1211332, 0x1211341, 0x1211413, 0x1211422, 0x1211431, 0x1211512,
+	0x1211521, 0x1212115, 0x1212124, 0x1212133, 0x1212142, 0x1212151, 0x1212214, 0x1212223,
+	0x1212232, 0x1212241, 0x1212313, 0x1212322, 0x1212331, 0x1212412, 0x1212421, 0x1212511,
+	0x1213114, 0x1213123, 0x1213132, 0x1213141, 0x1213213, 0x1213222, 0x1213231, 0x1213312,
+	0x1213321, 0x1213411, 0x1214113, 0x1214122, 0x1214131, 0x1214212, 0x1214221, 0x1214311,
+	0x1215112, 0x1215121, 0x1215211, 0x1221115, 0x1221124, 0x1221133, 0x1221142, 0x1221151,
+	0x1221214, 0x1221223, 0x1221232, 0x1221241, 0x1221313, 0x1221322, 0x1221331, 0x1221412,
+	0x1221421, 0x1221511, 0x1222114, 0x1222123, 0x1222132, 0x1222141, 0x1222213, 0x1222222,
+	0x1222231, 0x1222312, 0x1222321, 0x1222411, 0x1223113, 0x1223122, 0x1223131, 0x1223212,
+	0x1223221, 0x1223311, 0x1224112, 0x1224121, 0x1224211, 0x1225111, 0x1231114, 0x1231123,
+	0x1231132, 0x1231141, 0x1231213, 0x1231222, 0x1231231, 0x1231312, 0x1231321, 0x1231411,
+	0x1232113, 0x1232122, 0x1232131, 0x1232212, 0x1232221, 0x1232311, 0x1233112, 0x1233121,
+	0x1233211, 0x1234111, 0x1241113, 0x1241122, 0x1241131, 0x1241212, 0x1241221, 0x1241311,
+	0x1242112, 0x1242121, 0x1242211, 0x1243111, 0x1251112, 0x1251121, 0x1251211, 0x1252111,
+	0x1311115, 0x1311124, 0x1311133, 0x1311142, 0x1311151, 0x1311214, 0x1311223, 0x1311232,
+	0x1311241, 0x1311313, 0x1311322, 0x1311331, 0x1311412, 0x1311421, 0x1311511, 0x1312114,
+	0x1312123, 0x1312132, 0x1312141, 0x1312213, 0x1312222, 0x1312231, 0x1312312, 0x1312321,
+	0x1312411, 0x1313113, 0x1313122, 0x1313131, 0x1313212, 0x1313221, 0x1313311, 0x1314112,
+	0x1314121, 0x1314211, 0x1315111, 0x1321114, 0x1321123, 0x1321132, 0x1321141, 0x1321213,
+	0x1321222, 0x1321231, 0x1321312, 0x1321321, 0x1321411, 0x1322113, 0x1322122, 0x1322131,
+	0x1322212, 0x1322221, 0x1322311, 0x1323112, 0x1323121, 0x1323211, 0x1324111, 0x1331113,
+	0x1331122, 0x1331131, 0x1331212, 0x1331221, 0x1331311, 0x1332112, 0x1332121, 0x1332211,
+	0x1333111, 0x1341112, 0x1341121, 0x1341211, 0x1342111, 0x1351111, 0x1411114, 0x1411123,
+	0x1411132, 0x1411141, 0x1411213, 0x1411222, 0x1411231, 0x1411312, 0x1411321, 0x1411411,
+	0x1412113, 0x1412122, 0x1412131, 0x1412212, 0x1412221, 0x1412311, 0x1413112, 0x1413121,
+	0x1413211, 0x1414111, 0x1421113, 0x1421122, 0x1421131, 0x1421212, 0x1421221, 0x1421311,
+	0x1422112, 0x1422121, 0x1422211, 0x1423111, 0x1431112, 0x1431121, 0x1431211, 0x1432111,
+	0x1441111, 0x1511113, 0x1511122, 0x1511131, 0x1511212, 0x1511221, 0x1511311, 0x1512112,
+	0x1512121, 0x1512211, 0x1513111, 0x1521112, 0x1521121, 0x1521211, 0x1522111, 0x1531111,
+	0x2111125, 0x2111134, 0x2111143, 0x2111152, 0x2111215, 0x2111224, 0x2111233, 0x2111242,
+	0x2111251, 0x2111314, 0x2111323, 0x2111332, 0x2111341, 0x2111413, 0x2111422, 0x2111431,
+	0x2111512, 0x2111521, 0x2112115, 0x2112124, 0x2112133, 0x2112142, 0x2112151, 0x2112214,
+	0x2112223, 0x2112232, 0x2112241, 0x2112313, 0x2112322, 0x2112331, 0x2112412, 0x2112421,
+	0x2112511, 0x2113114, 0x2113123, 0x2113132, 0x2113141, 0x2113213, 0x2113222, 0x2113231,
+	0x2113312, 0x2113321, 0x2113411, 0x2114113, 0x2114122, 0x2114131, 0x2114212, 0x2114221,
+	0x2114311, 0x2115112, 0x2115121, 0x2115211, 0x2121115, 0x2121124, 0x2121133, 0x2121142,
+	0x2121151, 0x2121214, 0x2121223, 0x2121232, 0x2121241, 0x2121313, 0x2121322, 0x2121331,
+	0x2121412, 0x2121421, 0x2121511, 0x2122114, 0x2122123, 0x2122132, 0x2122141, 0x2122213,
+	0x2122222, 0x2122231, 0x2122312, 0x2122321, 0x2122411, 0x2123113, 0x2123122, 0x2123131,
+	0x2123212, 0x2123221, 0x2123311, 0x2124112, 0x2124121, 0x2124211, 0x2125111, 0x2131114,
+	0x2131123, 0x2131132, 0x2131141, 0x2131213, 0x2131222, 0x2131231, 0x2131312, 0x2131321,
+	0x2131411, 0x2132113, 0x2132122, 0x2132131, 0x2132212, 0x2132221, 0x2132311, 0x2133112,
+	0x2133121, 0x2133211, 0x2134111, 0x2141113, 0x2141122, 0x2141131, 0x2141212, 0x2141221,
+	0x2141311, 0x2142112, 0x2142121, 0x2142211, 0x2143111, 0x2151112, 0x2151121, 0x2151211,
+	0x2152111, 0x2211115, 0x2211124, 0x2211133, 0x2211142, 0x2211151, 0x2211214, 0x2211223,
+	0x2211232, 0x2211241, 0x2211313, 0x2211322, 0x2211331, 0x2211412, 0x2211421, 0x2211511,
+	0x2212114, 0x2212123, 0x2212132, 0x2212141, 0x2212213, 0x2212222, 0x2212231, 0x2212312,
+	0x2212321, 0x2212411, 0x2213113, 0x2213122, 0x2213131, 0x2213212, 0x2213221, 0x2213311,
+	0x2214112, 0x2214121, 0x2214211, 0x2215111, 0x2221114, 0x2221123, 0x2221132, 0x2221141,
+	0x2221213, 0x2221222, 0x2221231, 0x2221312, 0x2221321, 0x2221411, 0x2222113, 0x2222122,
+	0x2222131, 0x2222212, 0x2222221, 0x2222311, 0x2223112, 0x2223121, 0x2223211, 0x2224111,
+	0x2231113, 0x2231122, 0x2231131, 0x2231212, 0x2231221, 0x2231311, 0x2232112, 0x2232121,
+	0x2232211, 0x2233111, 0x2241112, 0x2241121, 0x2241211, 0x2242111, 0x2251111, 0x2311114,
+	0x2311123, 0x2311132, 0x2311141, 0x2311213, 0x2311222, 0x2311231, 0x2311312, 0x2311321,
+	0x2311411, 0x2312113, 0x2312122, 0x2312131, 0x2312212, 0x2312221, 0x2312311, 0x2313112,
+	0x2313121, 0x2313211, 0x2314111, 0x2321113, 0x2321122, 0x2321131, 0x2321212, 0x2321221,
+	0x2321311, 0x2322112, 0x2322121, 0x2322211, 0x2323111, 0x2331112, 0x2331121, 0x2331211,
+	0x2332111, 0x2341111, 0x2411113, 0x2411122, 0x2411131, 0x2411212, 0x2411221, 0x2411311,
+	0x2412112, 0x2412121, 0x2412211, 0x2413111, 0x2421112, 0x2421121, 0x2421211, 0x2422111,
+	0x2431111, 0x2511112, 0x2511121, 0x2511211, 0x2512111, 0x2521111, 0x3111115, 0x3111124,
+	0x3111133, 0x3111142, 0x3111151, 0x3111214, 0x3111223, 0x3111232, 0x3111241, 0x3111313,
+	0x3111322, 0x3111331, 0x3111412, 0x3111421, 0x3111511, 0x3112114, 0x3112123, 0x3112132,
+	0x3112141, 0x3112213, 0x3112222, 0x3112231, 0x3112312, 0x3112321, 0x3112411, 0x3113113,
+	0x3113122, 0x3113131, 0x3113212, 0x3113221, 0x3113311, 0x3114112, 0x3114121, 0x3114211,
+	0x3115111, 0x3121114, 0x3121123, 0x3121132, 0x3121141, 0x3121213, 0x3121222, 0x3121231,
+	0x3121312, 0x3121321, 0x3121411, 0x3122113, 0x3122122, 0x3122131, 0x3122212, 0x3122221,
+	0x3122311, 0x3123112, 0x3123121, 0x3123211, 0x3124111, 0x3131113, 0x3131122, 0x3131131,
+	0x3131212, 0x3131221, 0x3131311, 0x3132112, 0x3132121, 0x3132211, 0x3133111, 0x3141112,
+	0x3141121, 0x3141211, 0x3142111, 0x3151111, 0x3211114, 0x3211123, 0x3211132, 0x3211141,
+	0x3211213, 0x3211222, 0x3211231, 0x3211312, 0x3211321, 0x3211411, 0x3212113, 0x3212122,
+	0x3212131, 0x3212212, 0x3212221, 0x3212311, 0x3213112, 0x3213121, 0x3213211, 0x3214111,
+	0x3221113, 0x3221122, 0x3221131, 0x3221212, 0x3221221, 0x3221311, 0x3222112, 0x3222121,
+	0x3222211, 0x3223111, 0x3231112, 0x3231121, 0x3231211, 0x3232111, 0x3241111, 0x3311113,
+	0x3311122, 0x3311131, 0x3311212, 0x3311221, 0x3311311, 0x3312112, 0x3312121, 0x3312211,
+	0x3313111, 0x3321112, 0x3321121, 0x3321211, 0x3322111, 0x3331111, 0x3411112, 0x3411121,
+	0x3411211, 0x3412111, 0x3421111, 0x3511111, 0x4111114, 0x4111123, 0x4111132, 0x4111141,
+	0x4111213, 0x4111222, 0x4111231, 0x4111312, 0x4111321, 0x4111411, 0x4112113, 0x4112122,
+	0x4112131, 0x4112212, 0x4112221, 0x4112311, 0x4113112, 0x4113121, 0x4113211, 0x4114111,
+	0x4121113, 0x4121122, 0x4121131, 0x4121212, 0x4121221, 0x4121311, 0x4122112, 0x4122121,
+	0x4122211, 0x4123111, 0x4131112, 0x4131121, 0x4131211, 0x4132111, 0x4141111, 0x4211113,
+	0x4211122, 0x4211131, 0x4211212, 0x4211221, 0x4211311, 0x4212112, 0x4212121, 0x4212211,
+	0x4213111, 0x4221112, 0x4221121, 0x4221211, 0x4222111, 0x4231111, 0x4311112, 0x4311121,
+	0x4311211, 0x4312111, 0x4321111, 0x4411111, 0x5111113, 0x5111122, 0x5111131, 0x5111212,
+	0x5111221, 0x5111311, 0x5112112, 0x5112121, 0x5112211, 0x5113111, 0x5121112, 0x5121121,
+	0x5121211, 0x5122111, 0x5131111, 0x5211112, 0x5211121, 0x5211211, 0x5212111, 0x5221111,
+	0x5311111, 0x1111144, 0x1111234, 0x1111243, 0x1111324, 0x1111333, 0x1111342, 0x1111414,
+	0x1111423, 0x1111432, 0x1111441, 0x1112134, 0x1112143, 0x1112224, 0x1112233, 0x1112242,
+	0x1112314, 0x1112323, 0x1112332, 0x1112341, 0x1112413, 0x1112422, 0x1112431, 0x1113124,
+	0x1113133, 0x1113142, 0x1113214, 0x1113223, 0x1113232, 0x1113241, 0x1113313, 0x1113322,
+	0x1113331, 0x1113412, 0x1113421, 0x1114114, 0x1114123, 0x1114132, 0x1114141, 0x1114213,
+	0x1114222, 0x1114231, 0x1114312, 0x1114321, 0x1114411, 0x1121134, 0x1121143, 0x1121224,
+	0x1121233, 0x1121242, 0x1121314, 0x1121323, 0x1121332, 0x1121341, 0x1121413, 0x1121422,
+	0x1121431, 0x1122124, 0x1122133, 0x1122142, 0x1122214, 0x1122223, 0x1122232, 0x1122241,
+	0x1122313, 0x1122322, 0x1122331, 0x1122412, 0x1122421, 0x1123114, 0x1123123, 0x1123132,
+	0x1123141, 0x1123213, 0x1123222, 0x1123231, 0x1123312, 0x1123321, 0x1123411, 0x1124113,
+	0x1124122, 0x1124131, 0x1124212, 0x1124221, 0x1124311, 0x1131124, 0x1131133, 0x1131142,
+	0x1131214, 0x1131223, 0x1131232, 0x1131241, 0x1131313, 0x1131322, 0x1131331, 0x1131412,
+	0x1131421, 0x1132114, 0x1132123, 0x1132132, 0x1132141, 0x1132213, 0x1132222, 0x1132231,
+	0x1132312, 0x1132321, 0x1132411, 0x1133113, 0x1133122, 0x1133131, 0x1133212, 0x1133221,
+	0x1133311, 0x1134112, 0x1134121, 0x1134211, 0x1141114, 0x1141123, 0x1141132, 0x1141141,
+	0x1141213, 0x1141222, 0x1141231, 0x1141312, 0x1141321, 0x1141411, 0x1142113, 0x1142122,
+	0x1142131, 0x1142212, 0x1142221, 0x1142311, 0x1143112, 0x1143121, 0x1143211, 0x1144111,
+	0x1211134, 0x1211143, 0x1211224, 0x1211233, 0x1211242, 0x1211314, 0x1211323, 0x1211332,
+	0x1211341, 0x1211413, 0x1211422, 0x1211431, 0x1212124, 0x1212133, 0x1212142, 0x1212214,
+	0x1212223, 0x1212232, 0x1212241, 0x1212313, 0x1212322, 0x1212331, 0x1212412, 0x1212421,
+	0x1213114, 0x1213123, 0x1213132, 0x1213141, 0x1213213, 0x1213222, 0x1213231, 0x1213312,
+	0x1213321, 0x1213411, 0x1214113, 0x1214122, 0x1214131, 0x1214212, 0x1214221, 0x1214311,
+	0x1221124, 0x1221133, 0x1221142, 0x1221214, 0x1221223, 0x1221232, 0x1221241, 0x1221313,
+	0x1221322, 0x1221331, 0x1221412, 0x1221421, 0x1222114, 0x1222123, 0x1222132, 0x1222141,
+	0x1222213, 0x1222222, 0x1222231, 0x1222312, 0x1222321, 0x1222411, 0x1223113, 0x1223122,
+	0x1223131, 0x1223212, 0x1223221, 0x1223311, 0x1224112, 0x1224121, 0x1224211, 0x1231114,
+	0x1231123, 0x1231132, 0x1231141, 0x1231213, 0x1231222, 0x1231231, 0x1231312, 0x1231321,
+	0x1231411, 0x1232113, 0x1232122, 0x1232131, 0x1232212, 0x1232221, 0x1232311, 0x1233112,
+	0x1233121, 0x1233211, 0x1234111, 0x1241113, 0x1241122, 0x1241131, 0x1241212, 0x1241221,
+	0x1241311, 0x1242112, 0x1242121, 0x1242211, 0x1243111, 0x1311124, 0x1311133, 0x1311142,
+	0x1311214, 0x1311223, 0x1311232, 0x1311241, 0x1311313, 0x1311322, 0x1311331, 0x1311412,
+	0x1311421, 0x1312114, 0x1312123, 0x1312132, 0x1312141, 0x1312213, 0x1312222, 0x1312231,
+	0x1312312, 0x1312321, 0x1312411, 0x1313113, 0x1313122, 0x1313131, 0x1313212, 0x1313221,
+	0x1313311, 0x1314112, 0x1314121, 0x1314211, 0x1321114, 0x1321123, 0x1321132, 0x1321141,
+	0x1321213, 0x1321222, 0x1321231, 0x1321312, 0x1321321, 0x1321411, 0x1322113, 0x1322122,
+	0x1322131, 0x1322212, 0x1322221, 0x1322311, 0x1323112, 0x1323121, 0x1323211, 0x1324111,
+	0x1331113, 0x1331122, 0x1331131, 0x1331212, 0x1331221, 0x1331311, 0x1332112, 0x1332121,
+	0x1332211, 0x1333111, 0x1341112, 0x1341121, 0x1341211, 0x1342111, 0x1411114, 0x1411123,
+	0x1411132, 0x1411141, 0x1411213, 0x1411222, 0x1411231, 0x1411312, 0x1411321, 0x1411411,
+	0x1412113, 0x1412122, 0x1412131, 0x1412212, 0x1412221, 0x1412311, 0x1413112, 0x1413121,
+	0x1413211, 0x1414111, 0x1421113, 0x1421122, 0x1421131, 0x1421212, 0x1421221, 0x1421311,
+	0x1422112, 0x1422121, 0x1422211, 0x1423111, 0x1431112, 0x1431121, 0x1431211, 0x1432111,
+	0x1441111, 0x2111134, 0x2111143, 0x2111224, 0x2111233, 0x2111242, 0x2111314, 0x2111323,
+	0x2111332, 0x2111341, 0x2111413, 0x2111422, 0x2111431, 0x2112124, 0x2112133, 0x2112142,
+	0x2112214, 0x2112223, 0x2112232, 0x2112241, 0x2112313, 0x2112322, 0x2112331, 0x2112412,
+	0x2112421, 0x2113114, 0x2113123, 0x2113132, 0x2113141, 0x2113213, 0x2113222, 0x2113231,
+	0x2113312, 0x2113321, 0x2113411, 0x2114113, 0x2114122, 0x2114131, 0x2114212, 0x2114221,
+	0x2114311, 0x2121124, 0x2121133, 0x2121142, 0x2121214, 0x2121223, 0x2121232, 0x2121241,
+	0x2121313, 0x2121322, 0x2121331, 0x2121412, 0x2121421, 0x2122114, 0x2122123, 0x2122132,
+	0x2122141, 0x2122213, 0x2122222, 0x2122231, 0x2122312, 0x2122321, 0x2122411, 0x2123113,
+	0x2123122, 0x2123131, 0x2123212, 0x2123221, 0x2123311, 0x2124112, 0x2124121, 0x2124211,
+	0x2131114, 0x2131123, 0x2131132, 0x2131141, 0x2131213, 0x2131222, 0x2131231, 0x2131312,
+	0x2131321, 0x2131411, 0x2132113, 0x2132122, 0x2132131, 0x2132212, 0x2132221, 0x2132311,
+	0x2133112, 0x2133121, 0x2133211, 0x2134111, 0x2141113, 0x2141122, 0x2141131, 0x2141212,
+	0x2141221, 0x2141311, 0x2142112, 0x2142121, 0x2142211, 0x2143111, 0x2211124, 0x2211133,
+	0x2211142, 0x2211214, 0x2211223, 0x2211232, 0x2211241, 0x2211313, 0x2211322, 0x2211331,
+	0x2211412, 0x2211421, 0x2212114, 0x2212123, 0x2212132, 0x2212141, 0x2212213, 0x2212222,
+	0x2212231, 0x2212312, 0x2212321, 0x2212411, 0x2213113, 0x2213122, 0x2213131, 0x2213212,
+	0x2213221, 0x2213311, 0x2214112, 0x2214121, 0x2214211, 0x2221114, 0x2221123, 0x2221132,
+	0x2221141, 0x2221213, 0x2221222, 0x2221231, 0x2221312, 0x2221321, 0x2221411, 0x2222113,
+	0x2222122, 0x2222131, 0x2222212, 0x2222221, 0x2222311, 0x2223112, 0x2223121, 0x2223211,
+	0x2224111, 0x2231113, 0x2231122, 0x2231131, 0x2231212, 0x2231221, 0x2231311, 0x2232112,
+	0x2232121, 0x2232211, 0x2233111, 0x2241112, 0x2241121, 0x2241211, 0x2242111, 0x2311114,
+	0x2311123, 0x2311132, 0x2311141, 0x2311213, 0x2311222, 0x2311231, 0x2311312, 0x2311321,
+	0x2311411, 0x2312113, 0x2312122, 0x2312131, 0x2312212, 0x2312221, 0x2312311, 0x2313112,
+	0x2313121, 0x2313211, 0x2314111, 0x2321113, 0x2321122, 0x2321131, 0x2321212, 0x2321221,
+	0x2321311, 0x2322112, 0x2322121, 0x2322211, 0x2323111, 0x2331112, 0x2331121, 0x2331211,
+	0x2332111, 0x2341111, 0x2411113, 0x2411122, 0x2411131, 0x2411212, 0x2411221, 0x2411311,
+	0x2412112, 0x2412121, 0x2412211, 0x2413111, 0x2421112, 0x2421121, 0x2421211, 0x2422111,
+	0x2431111, 0x3111124, 0x3111133, 0x3111142, 0x3111214, 0x3111223, 0x3111232, 0x3111241,
+	0x3111313, 0x3111322, 0x3111331, 0x3111412, 0x3111421, 0x3112114, 0x3112123, 0x3112132,
+	0x3112141, 0x3112213, 0x3112222, 0x3112231, 0x3112312, 0x3112321, 0x3112411, 0x3113113,
+	0x3113122, 0x3113131, 0x3113212, 0x3113221, 0x3113311, 0x3114112, 0x3114121, 0x3114211,
+	0x3121114, 0x3121123, 0x3121132, 0x3121141, 0x3121213, 0x3121222, 0x3121231, 0x3121312,
+	0x3121321, 0x3121411, 0x3122113, 0x3122122, 0x3122131, 0x3122212, 0x3122221, 0x3122311,
+	0x3123112, 0x3123121, 0x3123211, 0x3124111, 0x3131113, 0x3131122, 0x3131131, 0x3131212,
+	0x3131221, 0x3131311, 0x3132112, 0x3132121, 0x3132211, 0x3133111, 0x3141112, 0x3141121,
+	0x3141211, 0x3142111, 0x3211114, 0x3211123, 0x3211132, 0x3211141, 0x3211213, 0x3211222,
+	0x3211231, 0x3211312, 0x3211321, 0x3211411, 0x3212113, 0x3212122, 0x3212131, 0x3212212,
+	0x3212221, 0x3212311, 0x3213112, 0x3213121, 0x3213211, 0x3214111, 0x3221113, 0x3221122,
+	0x3221131, 0x3221212, 0x3221221, 0x3221311, 0x3222112, 0x3222121, 0x3222211, 0x3223111,
+	0x3231112, 0x3231121, 0x3231211, 0x3232111, 0x3241111, 0x3311113, 0x3311122, 0x3311131,
+	0x3311212, 0x3311221, 0x3311311, 0x3312112, 0x3312121, 0x3312211, 0x3313111, 0x3321112,
+	0x3321121, 0x3321211, 0x3322111, 0x3331111, 0x3411112, 0x3411121, 0x3411211, 0x3412111,
+	0x3421111, 0x4111114, 0x4111123, 0x4111132, 0x4111141, 0x4111213, 0x4111222, 0x4111231,
+	0x4111312, 0x4111321, 0x4111411, 0x4112113, 0x4112122, 0x4112131, 0x4112212, 0x4112221,
+	0x4112311, 0x4113112, 0x4113121, 0x4113211, 0x4114111, 0x4121113, 0x4121122, 0x4121131,
+	0x4121212, 0x4121221, 0x4121311, 0x4122112, 0x4122121, 0x4122211, 0x4123111, 0x4131112,
+	0x4131121, 0x4131211, 0x4132111, 0x4141111, 0x4211113, 0x4211122, 0x4211131, 0x4211212,
+	0x4211221, 0x4211311, 0x4212112, 0x4212121, 0x4212211, 0x4213111, 0x4221112, 0x4221121,
+	0x4221211, 0x4222111, 0x4231111, 0x4311112, 0x4311121, 0x4311211, 0x4312111, 0x4321111,
+	0x4411111, 0x1111113, 0x1111122, 0x1111131, 0x1111212, 0x1111221, 0x1111311, 0x1112112,
+	0x1112121, 0x1112211, 0x1113111, 0x1121112, 0x1121121, 0x1121211, 0x1122111, 0x1131111,
+	0x1211112, 0x1211121, 0x1211211, 0x1212111, 0x1221111, 0x1311111, 0x2111112, 0x2111121,
+	0x2111211, 0x2112111, 0x2121111, 0x2211111, 0x3111111, 0x1111166, 0x1111256, 0x1111265,
+	0x1111346, 0x1111355, 0x1111364, 0x1111436, 0x1111445, 0x1111454, 0x1111463, 0x1111526,
+	0x1111535, 0x1111544, 0x1111553, 0x1111562, 0x1111616, 0x1111625, 0x1111634, 0x1111643,
+	0x1111652, 0x1111661, 0x1112156, 0x1112165, 0x1112246, 0x1112255, 0x1112264, 0x1112336,
+	0x1112345, 0x1112354, 0x1112363, 0x1112426, 0x1112435, 0x1112444, 0x1112453, 0x1112462,
+	0x1112516, 0x1112525, 0x1112534, 0x1112543, 0x1112552, 0x1112561, 0x1112615, 0x1112624,
+	0x1112633, 0x1112642, 0x1112651, 0x1113146, 0x1113155, 0x1113164, 0x1113236, 0x1113245,
+	0x1113254, 0x1113263, 0x1113326, 0x1113335, 0x1113344, 0x1113353, 0x1113362, 0x1113416,
+	0x1113425, 0x1113434, 0x1113443, 0x1113452, 0x1113461, 0x1113515, 0x1113524, 0x1113533,
+	0x1113542, 0x1113551, 0x1113614, 0x1113623, 0x1113632, 0x1113641, 0x1114136, 0x1114145,
+	0x1114154, 0x1114163, 0x1114226, 0x1114235, 0x1114244, 0x1114253, 0x1114262, 0x1114316,
+	0x1114325, 0x1114334, 0x1114343, 0x1114352, 0x1114361, 0x1114415, 0x1114424, 0x1114433,
+	0x1114442, 0x1114451, 0x1114514, 0x1114523, 0x1114532, 0x1114541, 0x1114613, 0x1114622,
+	0x1114631, 0x1115126, 0x1115135, 0x1115144, 0x1115153, 0x1115162, 0x1115216, 0x1115225,
+	0x1115234, 0x1115243, 0x1115252, 0x1115261, 0x1115315, 0x1115324, 0x1115333, 0x1115342,
+	0x1115351, 0x1115414, 0x1115423, 0x1115432, 0x1115441, 0x1115513, 0x1115522, 0x1115531,
+	0x1115612, 0x1115621, 0x1116116, 0x1116125, 0x1116134, 0x1116143, 0x1116152, 0x1116161,
+	0x1116215, 0x1116224, 0x1116233, 0x1116242, 0x1116251, 0x1116314, 0x1116323, 0x1116332,
+	0x1116341, 0x1116413, 0x1116422, 0x1116431, 0x1116512, 0x1116521, 0x1116611, 0x1121156,
+	0x1121165, 0x1121246, 0x1121255, 0x1121264, 0x1121336, 0x1121345, 0x1121354, 0x1121363,
+	0x1121426, 0x1121435, 0x1121444, 0x1121453, 0x1121462, 0x1121516, 0x1121525, 0x1121534,
+	0x1121543, 0x1121552, 0x1121561, 0x1121615, 0x1121624, 0x1121633, 0x1121642, 0x1121651,
+	0x1122146, 0x1122155, 0x1122164, 0x1122236, 0x1122245, 0x1122254, 0x1122263, 0x1122326,
+	0x1122335, 0x1122344, 0x1122353, 0x1122362, 0x1122416, 0x1122425, 0x1122434, 0x1122443,
+	0x1122452, 0x1122461, 0x1122515, 0x1122524, 0x1122533, 0x1122542, 0x1122551, 0x1122614,
+	0x1122623, 0x1122632, 0x1122641, 0x1123136, 0x1123145, 0x1123154, 0x1123163, 0x1123226,
+	0x1123235, 0x1123244, 0x1123253, 0x1123262, 0x1123316, 0x1123325, 0x1123334, 0x1123343,
+	0x1123352, 0x1123361, 0x1123415, 0x1123424, 0x1123433, 0x1123442, 0x1123451, 0x1123514,
+	0x1123523, 0x1123532, 0x1123541, 0x1123613, 0x1123622, 0x1123631, 0x1124126, 0x1124135,
+	0x1124144, 0x1124153, 0x1124162, 0x1124216, 0x1124225, 0x1124234, 0x1124243, 0x1124252,
+	0x1124261, 0x1124315, 0x1124324, 0x1124333, 0x1124342, 0x1124351, 0x1124414, 0x1124423,
+	0x1124432, 0x1124441, 0x1124513, 0x1124522, 0x1124531, 0x1124612, 0x1124621, 0x1125116,
+	0x1125125, 0x1125134, 0x1125143, 0x1125152, 0x1125161, 0x1125215, 0x1125224, 0x1125233,
+	0x1125242, 0x1125251, 0x1125314, 0x1125323, 0x1125332, 0x1125341, 0x1125413, 0x1125422,
+	0x1125431, 0x1125512, 0x1125521, 0x1125611, 0x1126115, 0x1126124, 0x1126133, 0x1126142,
+	0x1126151, 0x1126214, 0x1126223, 0x1126232, 0x1126241, 0x1126313, 0x1126322, 0x1126331,
+	0x1126412, 0x1126421, 0x1126511, 0x1131146, 0x1131155, 0x1131164, 0x1131236, 0x1131245,
+	0x1131254, 0x1131263, 0x1131326, 0x1131335, 0x1131344, 0x1131353, 0x1131362, 0x1131416,
+	0x1131425, 0x1131434, 0x1131443, 0x1131452, 0x1131461, 0x1131515, 0x1131524, 0x1131533,
+	0x1131542, 0x1131551, 0x1131614, 0x1131623, 0x1131632, 0x1131641, 0x1132136, 0x1132145,
+	0x1132154, 0x1132163, 0x1132226, 0x1132235, 0x1132244, 0x1132253, 0x1132262, 0x1132316,
+	0x1132325, 0x1132334, 0x1132343, 0x1132352, 0x1132361, 0x1132415, 0x1132424, 0x1132433,
+	0x1132442, 0x1132451, 0x1132514, 0x1132523, 0x1132532, 0x1132541, 0x1132613, 0x1132622,
+	0x1132631, 0x1133126, 0x1133135, 0x1133144, 0x1133153, 0x1133162, 0x1133216, 0x1133225,
+	0x1133234, 0x1133243, 0x1133252, 0x1133261, 0x1133315, 0x1133324, 0x1133333, 0x1133342,
+	0x1133351, 0x1133414, 0x1133423, 0x1133432, 0x1133441, 0x1133513, 0x1133522, 0x1133531,
+	0x1133612, 0x1133621, 0x1134116, 0x1134125, 0x1134134, 0x1134143, 0x1134152, 0x1134161,
+	0x1134215, 0x1134224, 0x1134233, 0x1134242, 0x1134251, 0x1134314, 0x1134323, 0x1134332,
+	0x1134341, 0x1134413, 0x1134422, 0x1134431, 0x1134512, 0x1134521, 0x1134611, 0x1135115,
+	0x1135124, 0x1135133, 0x1135142, 0x1135151, 0x1135214, 0x1135223, 0x1135232, 0x1135241,
+	0x1135313, 0x1135322, 0x1135331, 0x1135412, 0x1135421, 0x1135511, 0x1136114, 0x1136123,
+	0x1136132, 0x1136141, 0x1136213, 0x1136222, 0x1136231, 0x1136312, 0x1136321, 0x1136411,
+	0x1141136, 0x1141145, 0x1141154, 0x1141163, 0x1141226, 0x1141235, 0x1141244, 0x1141253,
+	0x1141262, 0x1141316, 0x1141325, 0x1141334, 0x1141343, 0x1141352, 0x1141361, 0x1141415,
+	0x1141424, 0x1141433, 0x1141442, 0x1141451, 0x1141514, 0x1141523, 0x1141532, 0x1141541,
+	0x1141613, 0x1141622, 0x1141631, 0x1142126, 0x1142135, 0x1142144, 0x1142153, 0x1142162,
+	0x1142216, 0x1142225, 0x1142234, 0x1142243, 0x1142252, 0x1142261, 0x1142315, 0x1142324,
+	0x1142333, 0x1142342, 0x1142351, 0x1142414, 0x1142423, 0x1142432, 0x1142441, 0x1142513,
+	0x1142522, 0x1142531, 0x1142612, 0x1142621, 0x1143116, 0x1143125, 0x1143134, 0x1143143,
+	0x1143152, 0x1143161, 0x1143215, 0x1143224, 0x1143233, 0x1143242, 0x1143251, 0x1143314,
+	0x1143323, 0x1143332, 0x1143341, 0x1143413, 0x1143422, 0x1143431, 0x1143512, 0x1143521,
+	0x1143611, 0x1144115, 0x1144124, 0x1144133, 0x1144142, 0x1144151, 0x1144214, 0x1144223,
+	0x1144232, 0x1144241, 0x1144313, 0x1144322, 0x1144331, 0x1144412, 0x1144421, 0x1144511,
+	0x1145114, 0x1145123, 0x1145132, 0x1145141, 0x1145213, 0x1145222, 0x1145231, 0x1145312,
+	0x1145321, 0x1145411, 0x1146113, 0x1146122, 0x1146131, 0x1146212, 0x1146221, 0x1146311,
+	0x1151126, 0x1151135, 0x1151144, 0x1151153, 0x1151162, 0x1151216, 0x1151225, 0x1151234,
+	0x1151243, 0x1151252, 0x1151261, 0x1151315, 0x1151324, 0x1151333, 0x1151342, 0x1151351,
+	0x1151414, 0x1151423, 0x1151432, 0x1151441, 0x1151513, 0x1151522, 0x1151531, 0x1151612,
+	0x1151621, 0x1152116, 0x1152125, 0x1152134, 0x1152143, 0x1152152, 0x1152161, 0x1152215,
+	0x1152224, 0x1152233, 0x1152242, 0x1152251, 0x1152314, 0x1152323, 0x1152332, 0x1152341,
+	0x1152413, 0x1152422, 0x1152431, 0x1152512, 0x1152521, 0x1152611, 0x1153115, 0x1153124,
+	0x1153133, 0x1153142, 0x1153151, 0x1153214, 0x1153223, 0x1153232, 0x1153241, 0x1153313,
+	0x1153322, 0x1153331, 0x1153412, 0x1153421, 0x1153511, 0x1154114, 0x1154123, 0x1154132,
+	0x1154141, 0x1154213, 0x1154222, 0x1154231, 0x1154312, 0x1154321, 0x1154411, 0x1155113,
+	0x1155122, 0x1155131, 0x1155212, 0x1155221, 0x1155311, 0x1156112, 0x1156121, 0x1156211,
+	0x1161116, 0x1161125, 0x1161134, 0x1161143, 0x1161152, 0x1161161, 0x1161215, 0x1161224,
+	0x1161233, 0x1161242, 0x1161251, 0x1161314, 0x1161323, 0x1161332, 0x1161341, 0x1161413,
+	0x1161422, 0x1161431, 0x1161512, 0x1161521, 0x1161611, 0x1162115, 0x1162124, 0x1162133,
+	0x1162142, 0x1162151, 0x1162214, 0x1162223, 0x1162232, 0x1162241, 0x1162313, 0x1162322,
+	0x1162331, 0x1162412, 0x1162421, 0x1162511, 0x1163114, 0x1163123, 0x1163132, 0x1163141,
+	0x1163213, 0x1163222, 0x1163231, 0x1163312, 0x1163321, 0x1163411, 0x1164113, 0x1164122,
+	0x1164131, 0x1164212, 0x1164221, 0x1164311, 0x1165112, 0x1165121, 0x1165211, 0x1166111,
+	0x1211156, 0x1211165, 0x1211246, 0x1211255, 0x1211264, 0x1211336, 0x1211345, 0x1211354,
+	0x1211363, 0x1211426, 0x1211435, 0x1211444, 0x1211453, 0x1211462, 0x1211516, 0x1211525,
+	0x1211534, 0x1211543, 0x1211552, 0x1211561, 0x1211615, 0x1211624, 0x1211633, 0x1211642,
+	0x1211651, 0x1212146, 0x1212155, 0x1212164, 0x1212236, 0x1212245, 0x1212254, 0x1212263,
+	0x1212326, 0x1212335, 0x1212344, 0x1212353, 0x1212362, 0x1212416, 0x1212425, 0x1212434,
+	0x1212443, 0x1212452, 0x1212461, 0x1212515, 0x1212524, 0x1212533, 0x1212542, 0x1212551,
+	0x1212614, 0x1212623, 0x1212632, 0x1212641, 0x1213136, 0x1213145, 0x1213154, 0x1213163,
+	0x1213226, 0x1213235, 0x1213244, 0x1213253, 0x1213262, 0x1213316, 0x1213325, 0x1213334,
+	0x1213343, 0x1213352, 0x1213361, 0x1213415, 0x1213424, 0x1213433, 0x1213442, 0x1213451,
+	0x1213514, 0x1213523, 0x1213532, 0x1213541, 0x1213613, 0x1213622, 0x1213631, 0x1214126,
+	0x1214135, 0x1214144, 0x1214153, 0x1214162, 0x1214216, 0x1214225, 0x1214234, 0x1214243,
+	0x1214252, 0x1214261, 0x1214315, 0x1214324, 0x1214333, 0x1214342, 0x1214351, 0x1214414,
+	0x1214423, 0x1214432, 0x1214441, 0x1214513, 0x1214522, 0x1214531, 0x1214612, 0x1214621,
+	0x1215116, 0x1215125, 0x1215134, 0x1215143, 0x1215152, 0x1215161, 0x1215215, 0x1215224,
+	0x1215233, 0x1215242, 0x1215251, 0x1215314, 0x1215323, 0x1215332, 0x1215341, 0x1215413,
+	0x1215422, 0x1215431, 0x1215512, 0x1215521, 0x1215611, 0x1216115, 0x1216124, 0x1216133,
+	0x1216142, 0x1216151, 0x1216214, 0x1216223, 0x1216232, 0x1216241, 0x1216313, 0x1216322,
+	0x1216331, 0x1216412, 0x1216421, 0x1216511, 0x1221146, 0x1221155, 0x1221164, 0x1221236,
+	0x1221245, 0x1221254, 0x1221263, 0x1221326, 0x1221335, 0x1221344, 0x1221353, 0x1221362,
+	0x1221416, 0x1221425, 0x1221434, 0x1221443, 0x1221452, 0x1221461, 0x1221515, 0x1221524,
+	0x1221533, 0x1221542, 0x1221551, 0x1221614, 0x1221623, 0x1221632, 0x1221641, 0x1222136,
+	0x1222145, 0x1222154, 0x1222163, 0x1222226, 0x1222235, 0x1222244, 0x1222253, 0x1222262,
+	0x1222316, 0x1222325, 0x1222334, 0x1222343, 0x1222352, 0x1222361, 0x1222415, 0x1222424,
+	0x1222433, 0x1222442, 0x1222451, 0x1222514, 0x1222523, 0x1222532, 0x1222541, 0x1222613,
+	0x1222622, 0x1222631, 0x1223126, 0x1223135, 0x1223144, 0x1223153, 0x1223162, 0x1223216,
+	0x1223225, 0x1223234, 0x1223243, 0x1223252, 0x1223261, 0x1223315, 0x1223324, 0x1223333,
+	0x1223342, 0x1223351, 0x1223414, 0x1223423, 0x1223432, 0x1223441, 0x1223513, 0x1223522,
+	0x1223531, 0x1223612, 0x1223621, 0x1224116, 0x1224125, 0x1224134, 0x1224143, 0x1224152,
+	0x1224161, 0x1224215, 0x1224224, 0x1224233, 0x1224242, 0x1224251, 0x1224314, 0x1224323,
+	0x1224332, 0x1224341, 0x1224413, 0x1224422, 0x1224431, 0x1224512, 0x1224521, 0x1224611,
+	0x1225115, 0x1225124, 0x1225133, 0x1225142, 0x1225151, 0x1225214, 0x1225223, 0x1225232,
+	0x1225241, 0x1225313, 0x1225322, 0x1225331, 0x1225412, 0x1225421, 0x1225511, 0x1226114,
+	0x1226123, 0x1226132, 0x1226141, 0x1226213, 0x1226222, 0x1226231, 0x1226312, 0x1226321,
+	0x1226411, 0x1231136, 0x1231145, 0x1231154, 0x1231163, 0x1231226, 0x1231235, 0x1231244,
+	0x1231253, 0x1231262, 0x1231316, 0x1231325, 0x1231334, 0x1231343, 0x1231352, 0x1231361,
+	0x1231415, 0x1231424, 0x1231433, 0x1231442, 0x1231451, 0x1231514, 0x1231523, 0x1231532,
+	0x1231541, 0x1231613, 0x1231622, 0x1231631, 0x1232126, 0x1232135, 0x1232144, 0x1232153,
+	0x1232162, 0x1232216, 0x1232225, 0x1232234, 0x1232243, 0x1232252, 0x1232261, 0x1232315,
+	0x1232324, 0x1232333, 0x1232342, 0x1232351, 0x1232414, 0x1232423, 0x1232432, 0x1232441,
+	0x1232513, 0x1232522, 0x1232531, 0x1232612, 0x1232621, 0x1233116, 0x1233125, 0x1233134,
+	0x1233143, 0x1233152, 0x1233161, 0x1233215, 0x1233224, 0x1233233, 0x1233242, 0x1233251,
+	0x1233314, 0x1233323, 0x1233332, 0x1233341, 0x1233413, 0x1233422, 0x1233431, 0x1233512,
+	0x1233521, 0x1233611, 0x1234115, 0x1234124, 0x1234133, 0x1234142, 0x1234151, 0x1234214,
+	0x1234223, 0x1234232, 0x1234241, 0x1234313, 0x1234322, 0x1234331, 0x1234412, 0x1234421,
+	0x1234511, 0x1235114, 0x1235123, 0x1235132, 0x1235141, 0x1235213, 0x1235222, 0x1235231,
+	0x1235312, 0x1235321, 0x1235411, 0x1236113, 0x1236122, 0x1236131, 0x1236212, 0x1236221,
+	0x1236311, 0x1241126, 0x1241135, 0x1241144, 0x1241153, 0x1241162, 0x1241216, 0x1241225,
+	0x1241234, 0x1241243, 0x1241252, 0x1241261, 0x1241315, 0x1241324, 0x1241333, 0x1241342,
+	0x1241351, 0x1241414, 0x1241423, 0x1241432, 0x1241441, 0x1241513, 0x1241522, 0x1241531,
+	0x1241612, 0x1241621, 0x1242116, 0x1242125, 0x1242134, 0x1242143, 0x1242152, 0x1242161,
+	0x1242215, 0x1242224, 0x1242233, 0x1242242, 0x1242251, 0x1242314, 0x1242323, 0x1242332,
+	0x1242341, 0x1242413, 0x1242422, 0x1242431, 0x1242512, 0x1242521, 0x1242611, 0x1243115,
+	0x1243124, 0x1243133, 0x1243142, 0x1243151, 0x1243214, 0x1243223, 0x1243232, 0x1243241,
+	0x1243313, 0x1243322, 0x1243331, 0x1243412, 0x1243421, 0x1243511, 0x1244114, 0x1244123,
+	0x1244132, 0x1244141, 0x1244213, 0x1244222, 0x1244231, 0x1244312, 0x1244321, 0x1244411,
+	0x1245113, 0x1245122, 0x1245131, 0x1245212, 0x1245221, 0x1245311, 0x1246112, 0x1246121,
+	0x1246211, 0x1251116, 0x1251125, 0x1251134, 0x1251143, 0x1251152, 0x1251161, 0x1251215,
+	0x1251224, 0x1251233, 0x1251242, 0x1251251, 0x1251314, 0x1251323, 0x1251332, 0x1251341,
+	0x1251413, 0x1251422, 0x1251431, 0x1251512, 0x1251521, 0x1251611, 0x1252115, 0x1252124,
+	0x1252133, 0x1252142, 0x1252151, 0x1252214, 0x1252223, 0x1252232, 0x1252241, 0x1252313,
+	0x1252322, 0x1252331, 0x1252412, 0x1252421, 0x1252511, 0x1253114, 0x1253123, 0x1253132,
+	0x1253141, 0x1253213, 0x1253222, 0x1253231, 0x1253312, 0x1253321, 0x1253411, 0x1254113,
+	0x1254122, 0x1254131, 0x1254212, 0x1254221, 0x1254311, 0x1255112, 0x1255121, 0x1255211,
+	0x1256111, 0x1261115, 0x1261124, 0x1261133, 0x1261142, 0x1261151, 0x1261214, 0x1261223,
+	0x1261232, 0x1261241, 0x1261313, 0x1261322, 0x1261331, 0x1261412, 0x1261421, 0x1261511,
+	0x1262114, 0x1262123, 0x1262132, 0x1262141, 0x1262213, 0x1262222, 0x1262231, 0x1262312,
+	0x1262321, 0x1262411, 0x1263113, 0x1263122, 0x1263131, 0x1263212, 0x1263221, 0x1263311,
+	0x1264112, 0x1264121, 0x1264211, 0x1265111, 0x1311146, 0x1311155, 0x1311164, 0x1311236,
+	0x1311245, 0x1311254, 0x1311263, 0x1311326, 0x1311335, 0x1311344, 0x1311353, 0x1311362,
+	0x1311416, 0x1311425, 0x1311434, 0x1311443, 0x1311452, 0x1311461, 0x1311515, 0x1311524,
+	0x1311533, 0x1311542, 0x1311551, 0x1311614, 0x1311623, 0x1311632, 0x1311641, 0x1312136,
+	0x1312145, 0x1312154, 0x1312163, 0x1312226, 0x1312235, 0x1312244, 0x1312253, 0x1312262,
+	0x1312316, 0x1312325, 0x1312334, 0x1312343, 0x1312352, 0x1312361, 0x1312415, 0x1312424,
+	0x1312433, 0x1312442, 0x1312451, 0x1312514, 0x1312523, 0x1312532, 0x1312541, 0x1312613,
+	0x1312622, 0x1312631, 0x1313126, 0x1313135, 0x1313144, 0x1313153, 0x1313162, 0x1313216,
+	0x1313225, 0x1313234, 0x1313243, 0x1313252, 0x1313261, 0x1313315, 0x1313324, 0x1313333,
+	0x1313342, 0x1313351, 0x1313414, 0x1313423, 0x1313432, 0x1313441, 0x1313513, 0x1313522,
+	0x1313531, 0x1313612, 0x1313621, 0x1314116, 0x1314125, 0x1314134, 0x1314143, 0x1314152,
+	0x1314161, 0x1314215, 0x1314224, 0x1314233, 0x1314242, 0x1314251, 0x1314314, 0x1314323,
+	0x1314332, 0x1314341, 0x1314413, 0x1314422, 0x1314431, 0x1314512, 0x1314521, 0x1314611,
+	0x1315115, 0x1315124, 0x1315133, 0x1315142, 0x1315151, 0x1315214, 0x1315223, 0x1315232,
+	0x1315241, 0x1315313, 0x1315322, 0x1315331, 0x1315412, 0x1315421, 0x1315511, 0x1316114,
+	0x1316123, 0x1316132, 0x1316141, 0x1316213, 0x1316222, 0x1316231, 0x1316312, 0x1316321,
+	0x1316411, 0x1321136, 0x1321145, 0x1321154, 0x1321163, 0x1321226, 0x1321235, 0x1321244,
+	0x1321253, 0x1321262, 0x1321316, 0x1321325, 0x1321334, 0x1321343, 0x1321352, 0x1321361,
+	0x1321415, 0x1321424, 0x1321433, 0x1321442, 0x1321451, 0x1321514, 0x1321523, 0x1321532,
+	0x1321541, 0x1321613, 0x1321622, 0x1321631, 0x1322126, 0x1322135, 0x1322144, 0x1322153,
+	0x1322162, 0x1322216, 0x1322225, 0x1322234, 0x1322243, 0x1322252, 0x1322261, 0x1322315,
+	0x1322324, 0x1322333, 0x1322342, 0x1322351, 0x1322414, 0x1322423, 0x1322432, 0x1322441,
+	0x1322513, 0x1322522, 0x1322531, 0x1322612, 0x1322621, 0x1323116, 0x1323125, 0x1323134,
+	0x1323143, 0x1323152, 0x1323161, 0x1323215, 0x1323224, 0x1323233, 0x1323242, 0x1323251,
+	0x1323314, 0x1323323, 0x1323332, 0x1323341, 0x1323413, 0x1323422, 0x1323431, 0x1323512,
+	0x1323521, 0x1323611, 0x1324115, 0x1324124, 0x1324133, 0x1324142, 0x1324151, 0x1324214,
+	0x1324223, 0x1324232, 0x1324241, 0x1324313, 0x1324322, 0x1324331, 0x1324412, 0x1324421,
+	0x1324511, 0x1325114, 0x1325123, 0x1325132, 0x1325141, 0x1325213, 0x1325222, 0x1325231,
+	0x1325312, 0x1325321, 0x1325411, 0x1326113, 0x1326122, 0x1326131, 0x1326212, 0x1326221,
+	0x1326311, 0x1331126, 0x1331135, 0x1331144, 0x1331153, 0x1331162, 0x1331216, 0x1331225,
+	0x1331234, 0x1331243, 0x1331252, 0x1331261, 0x1331315, 0x1331324, 0x1331333, 0x1331342,
+	0x1331351, 0x1331414, 0x1331423, 0x1331432, 0x1331441, 0x1331513, 0x1331522, 0x1331531,
+	0x1331612, 0x1331621, 0x1332116, 0x1332125, 0x1332134, 0x1332143, 0x1332152, 0x1332161,
+	0x1332215, 0x1332224, 0x1332233, 0x1332242, 0x1332251, 0x1332314, 0x1332323, 0x1332332,
+	0x1332341, 0x1332413, 0x1332422, 0x1332431, 0x1332512, 0x1332521, 0x1332611, 0x1333115,
+	0x1333124, 0x1333133, 0x1333142, 0x1333151, 0x1333214, 0x1333223, 0x1333232, 0x1333241,
+	0x1333313, 0x1333322, 0x1333331, 0x1333412, 0x1333421, 0x1333511, 0x1334114, 0x1334123,
+	0x1334132, 0x1334141, 0x1334213, 0x1334222, 0x1334231, 0x1334312, 0x1334321, 0x1334411,
+	0x1335113, 0x1335122, 0x1335131, 0x1335212, 0x1335221, 0x1335311, 0x1336112, 0x1336121,
+	0x1336211, 0x1341116, 0x1341125, 0x1341134, 0x1341143, 0x1341152, 0x1341161, 0x1341215,
+	0x1341224, 0x1341233, 0x1341242, 0x1341251, 0x1341314, 0x1341323, 0x1341332, 0x1341341,
+	0x1341413, 0x1341422, 0x1341431, 0x1341512, 0x1341521, 0x1341611, 0x1342115, 0x1342124,
+	0x1342133, 0x1342142, 0x1342151, 0x1342214, 0x1342223, 0x1342232, 0x1342241, 0x1342313,
+	0x1342322, 0x1342331, 0x1342412, 0x1342421, 0x1342511, 0x1343114, 0x1343123, 0x1343132,
+	0x1343141, 0x1343213, 0x1343222, 0x1343231, 0x1343312, 0x1343321, 0x1343411, 0x1344113,
+	0x1344122, 0x1344131, 0x1344212, 0x1344221, 0x1344311, 0x1345112, 0x1345121, 0x1345211,
+	0x1346111, 0x1351115, 0x1351124, 0x1351133, 0x1351142, 0x1351151, 0x1351214, 0x1351223,
+	0x1351232, 0x1351241, 0x1351313, 0x1351322, 0x1351331, 0x1351412, 0x1351421, 0x1351511,
+	0x1352114, 0x1352123, 0x1352132, 0x1352141, 0x1352213, 0x1352222, 0x1352231, 0x1352312,
+	0x1352321, 0x1352411, 0x1353113, 0x1353122, 0x1353131, 0x1353212, 0x1353221, 0x1353311,
+	0x1354112, 0x1354121, 0x1354211, 0x1355111, 0x1361114, 0x1361123, 0x1361132, 0x1361141,
+	0x1361213, 0x1361222, 0x1361231, 0x1361312, 0x1361321, 0x1361411, 0x1362113, 0x1362122,
+	0x1362131, 0x1362212, 0x1362221, 0x1362311, 0x1363112, 0x1363121, 0x1363211, 0x1364111,
+	0x1411136, 0x1411145, 0x1411154, 0x1411163, 0x1411226, 0x1411235, 0x1411244, 0x1411253,
+	0x1411262, 0x1411316, 0x1411325, 0x1411334, 0x1411343, 0x1411352, 0x1411361, 0x1411415,
+	0x1411424, 0x1411433, 0x1411442, 0x1411451, 0x1411514, 0x1411523, 0x1411532, 0x1411541,
+	0x1411613, 0x1411622, 0x1411631, 0x1412126, 0x1412135, 0x1412144, 0x1412153, 0x1412162,
+	0x1412216, 0x1412225, 0x1412234, 0x1412243, 0x1412252, 0x1412261, 0x1412315, 0x1412324,
+	0x1412333, 0x1412342, 0x1412351, 0x1412414, 0x1412423, 0x1412432, 0x1412441, 0x1412513,
+	0x1412522, 0x1412531, 0x1412612, 0x1412621, 0x1413116, 0x1413125, 0x1413134, 0x1413143,
+	0x1413152, 0x1413161, 0x1413215, 0x1413224, 0x1413233, 0x1413242, 0x1413251, 0x1413314,
+	0x1413323, 0x1413332, 0x1413341, 0x1413413, 0x1413422, 0x1413431, 0x1413512, 0x1413521,
+	0x1413611, 0x1414115, 0x1414124, 0x1414133, 0x1414142, 0x1414151, 0x1414214, 0x1414223,
+	0x1414232, 0x1414241, 0x1414313, 0x1414322, 0x1414331, 0x1414412, 0x1414421, 0x1414511,
+	0x1415114, 0x1415123, 0x1415132, 0x1415141, 0x1415213, 0x1415222, 0x1415231, 0x1415312,
+	0x1415321, 0x1415411, 0x1416113, 0x1416122, 0x1416131, 0x1416212, 0x1416221, 0x1416311,
+	0x1421126, 0x1421135, 0x1421144, 0x1421153, 0x1421162, 0x1421216, 0x1421225, 0x1421234,
+	0x1421243, 0x1421252, 0x1421261, 0x1421315, 0x1421324, 0x1421333, 0x1421342, 0x1421351,
+	0x1421414, 0x1421423, 0x1421432, 0x1421441, 0x1421513, 0x1421522, 0x1421531, 0x1421612,
+	0x1421621, 0x1422116, 0x1422125, 0x1422134, 0x1422143, 0x1422152, 0x1422161, 0x1422215,
+	0x1422224, 0x1422233, 0x1422242, 0x1422251, 0x1422314, 0x1422323, 0x1422332, 0x1422341,
+	0x1422413, 0x1422422, 0x1422431, 0x1422512, 0x1422521, 0x1422611, 0x1423115, 0x1423124,
+	0x1423133, 0x1423142, 0x1423151, 0x1423214, 0x1423223, 0x1423232, 0x1423241, 0x1423313,
+	0x1423322, 0x1423331, 0x1423412, 0x1423421, 0x1423511, 0x1424114, 0x1424123, 0x1424132,
+	0x1424141, 0x1424213, 0x1424222, 0x1424231, 0x1424312, 0x1424321, 0x1424411, 0x1425113,
+	0x1425122, 0x1425131, 0x1425212, 0x1425221, 0x1425311, 0x1426112, 0x1426121, 0x1426211,
+	0x1431116, 0x1431125, 0x1431134, 0x1431143, 0x1431152, 0x1431161, 0x1431215, 0x1431224,
+	0x1431233, 0x1431242, 0x1431251, 0x1431314, 0x1431323, 0x1431332, 0x1431341, 0x1431413,
+	0x1431422, 0x1431431, 0x1431512, 0x1431521, 0x1431611, 0x1432115, 0x1432124, 0x1432133,
+	0x1432142, 0x1432151, 0x1432214, 0x1432223, 0x1432232, 0x1432241, 0x1432313, 0x1432322,
+	0x1432331, 0x1432412, 0x1432421, 0x1432511, 0x1433114, 0x1433123, 0x1433132, 0x1433141,
+	0x1433213, 0x1433222, 0x1433231, 0x1433312, 0x1433321, 0x1433411, 0x1434113, 0x1434122,
+	0x1434131, 0x1434212, 0x1434221, 0x1434311, 0x1435112, 0x1435121, 0x1435211, 0x1436111,
+	0x1441115, 0x1441124, 0x1441133, 0x1441142, 0x1441151, 0x1441214, 0x1441223, 0x1441232,
+	0x1441241, 0x1441313, 0x1441322, 0x1441331, 0x1441412, 0x1441421, 0x1441511, 0x1442114,
+	0x1442123, 0x1442132, 0x1442141, 0x1442213, 0x1442222, 0x1442231, 0x1442312, 0x1442321,
+	0x1442411, 0x1443113, 0x1443122, 0x1443131, 0x1443212, 0x1443221, 0x1443311, 0x1444112,
+	0x1444121, 0x1444211, 0x1445111, 0x1451114, 0x1451123, 0x1451132, 0x1451141, 0x1451213,
+	0x1451222, 0x1451231, 0x1451312, 0x1451321, 0x1451411, 0x1452113, 0x1452122, 0x1452131,
+	0x1452212, 0x1452221, 0x1452311, 0x1453112, 0x1453121, 0x1453211, 0x1454111, 0x1461113,
+	0x1461122, 0x1461131, 0x1461212, 0x1461221, 0x1461311, 0x1462112, 0x1462121, 0x1462211,
+	0x1463111, 0x1511126, 0x1511135, 0x1511144, 0x1511153, 0x1511162, 0x1511216, 0x1511225,
+	0x1511234, 0x1511243, 0x1511252, 0x1511261, 0x1511315, 0x1511324, 0x1511333, 0x1511342,
+	0x1511351, 0x1511414, 0x1511423, 0x1511432, 0x1511441, 0x1511513, 0x1511522, 0x1511531,
+	0x1511612, 0x1511621, 0x1512116, 0x1512125, 0x1512134, 0x1512143, 0x1512152, 0x1512161,
+	0x1512215, 0x1512224, 0x1512233, 0x1512242, 0x1512251, 0x1512314, 0x1512323, 0x1512332,
+	0x1512341, 0x1512413, 0x1512422, 0x1512431, 0x1512512, 0x1512521, 0x1512611, 0x1513115,
+	0x1513124, 0x1513133, 0x1513142, 0x1513151, 0x1513214, 0x1513223, 0x1513232, 0x1513241,
+	0x1513313, 0x1513322, 0x1513331, 0x1513412, 0x1513421, 0x1513511, 0x1514114, 0x1514123,
+	0x1514132, 0x1514141, 0x1514213, 0x1514222, 0x1514231, 0x1514312, 0x1514321, 0x1514411,
+	0x1515113, 0x1515122, 0x1515131, 0x1515212, 0x1515221, 0x1515311, 0x1516112, 0x1516121,
+	0x1516211, 0x1521116, 0x1521125, 0x1521134, 0x1521143, 0x1521152, 0x1521161, 0x1521215,
+	0x1521224, 0x1521233, 0x1521242, 0x1521251, 0x1521314, 0x1521323, 0x1521332, 0x1521341,
+	0x1521413, 0x1521422, 0x1521431, 0x1521512, 0x1521521, 0x1521611, 0x1522115, 0x1522124,
+	0x1522133, 0x1522142, 0x1522151, 0x1522214, 0x1522223, 0x1522232, 0x1522241, 0x1522313,
+	0x1522322, 0x1522331, 0x1522412, 0x1522421, 0x1522511, 0x1523114, 0x1523123, 0x1523132,
+	0x1523141, 0x1523213, 0x1523222, 0x1523231, 0x1523312, 0x1523321, 0x1523411, 0x1524113,
+	0x1524122, 0x1524131, 0x1524212, 0x1524221, 0x1524311, 0x1525112, 0x1525121, 0x1525211,
+	0x1526111, 0x1531115, 0x1531124, 0x1531133, 0x1531142, 0x1531151, 0x1531214, 0x1531223,
+	0x1531232, 0x1531241, 0x1531313, 0x1531322, 0x1531331, 0x1531412, 0x1531421, 0x1531511,
+	0x1532114, 0x1532123, 0x1532132, 0x1532141, 0x1532213, 0x1532222, 0x1532231, 0x1532312,
+	0x1532321, 0x1532411, 0x1533113, 0x1533122, 0x1533131, 0x1533212, 0x1533221, 0x1533311,
+	0x1534112, 0x1534121, 0x1534211, 0x1535111, 0x1541114, 0x1541123, 0x1541132, 0x1541141,
+	0x1541213, 0x1541222, 0x1541231, 0x1541312, 0x1541321, 0x1541411, 0x1542113, 0x1542122,
+	0x1542131, 0x1542212, 0x1542221, 0x1542311, 0x1543112, 0x1543121, 0x1543211, 0x1544111,
+	0x1551113, 0x1551122, 0x1551131, 0x1551212, 0x1551221, 0x1551311, 0x1552112, 0x1552121,
+	0x1552211, 0x1553111, 0x1561112, 0x1561121, 0x1561211, 0x1562111, 0x1611116, 0x1611125,
+	0x1611134, 0x1611143, 0x1611152, 0x1611161, 0x1611215, 0x1611224, 0x1611233, 0x1611242,
+	0x1611251, 0x1611314, 0x1611323, 0x1611332, 0x1611341, 0x1611413, 0x1611422, 0x1611431,
+	0x1611512, 0x1611521, 0x1611611, 0x1612115, 0x1612124, 0x1612133, 0x1612142, 0x1612151,
+	0x1612214, 0x1612223, 0x1612232, 0x1612241, 0x1612313, 0x1612322, 0x1612331, 0x1612412,
+	0x1612421, 0x1612511, 0x1613114, 0x1613123, 0x1613132, 0x1613141, 0x1613213, 0x1613222,
+	0x1613231, 0x1613312, 0x1613321, 0x1613411, 0x1614113, 0x1614122, 0x1614131, 0x1614212,
+	0x1614221, 0x1614311, 0x1615112, 0x1615121, 0x1615211, 0x1616111, 0x1621115, 0x1621124,
+	0x1621133, 0x1621142, 0x1621151, 0x1621214, 0x1621223, 0x1621232, 0x1621241, 0x1621313,
+	0x1621322, 0x1621331, 0x1621412, 0x1621421, 0x1621511, 0x1622114, 0x1622123, 0x1622132,
+	0x1622141, 0x1622213, 0x1622222, 0x1622231, 0x1622312, 0x1622321, 0x1622411, 0x1623113,
+	0x1623122, 0x1623131, 0x1623212, 0x1623221, 0x1623311, 0x1624112, 0x1624121, 0x1624211,
+	0x1625111, 0x1631114, 0x1631123, 0x1631132, 0x1631141, 0x1631213, 0x1631222, 0x1631231,
+	0x1631312, 0x1631321, 0x1631411, 0x1632113, 0x1632122, 0x1632131, 0x1632212, 0x1632221,
+	0x1632311, 0x1633112, 0x1633121, 0x1633211, 0x1634111, 0x1641113, 0x1641122, 0x1641131,
+	0x1641212, 0x1641221, 0x1641311, 0x1642112, 0x1642121, 0x1642211, 0x1643111, 0x1651112,
+	0x1651121, 0x1651211, 0x1652111, 0x1661111, 0x2111156, 0x2111165, 0x2111246, 0x2111255,
+	0x2111264, 0x2111336, 0x2111345, 0x2111354, 0x2111363, 0x2111426, 0x2111435, 0x2111444,
+	0x2111453, 0x2111462, 0x2111516, 0x2111525, 0x2111534, 0x2111543, 0x2111552, 0x2111561,
+	0x2111615, 0x2111624, 0x2111633, 0x2111642, 0x2111651, 0x2112146, 0x2112155, 0x2112164,
+	0x2112236, 0x2112245, 0x2112254, 0x2112263, 0x2112326, 0x2112335, 0x2112344, 0x2112353,
+	0x2112362, 0x2112416, 0x2112425, 0x2112434, 0x2112443, 0x2112452, 0x2112461, 0x2112515,
+	0x2112524, 0x2112533, 0x2112542, 0x2112551, 0x2112614, 0x2112623, 0x2112632, 0x2112641,
+	0x2113136, 0x2113145, 0x2113154, 0x2113163, 0x2113226, 0x2113235, 0x2113244, 0x2113253,
+	0x2113262, 0x2113316, 0x2113325, 0x2113334, 0x2113343, 0x2113352, 0x2113361, 0x2113415,
+	0x2113424, 0x2113433, 0x2113442, 0x2113451, 0x2113514, 0x2113523, 0x2113532, 0x2113541,
+	0x2113613, 0x2113622, 0x2113631, 0x2114126, 0x2114135, 0x2114144, 0x2114153, 0x2114162,
+	0x2114216, 0x2114225, 0x2114234, 0x2114243, 0x2114252, 0x2114261, 0x2114315, 0x2114324,
+	0x2114333, 0x2114342, 0x2114351, 0x2114414, 0x2114423, 0x2114432, 0x2114441, 0x2114513,
+	0x2114522, 0x2114531, 0x2114612, 0x2114621, 0x2115116, 0x2115125, 0x2115134, 0x2115143,
+	0x2115152, 0x2115161, 0x2115215, 0x2115224, 0x2115233, 0x2115242, 0x2115251, 0x2115314,
+	0x2115323, 0x2115332, 0x2115341, 0x2115413, 0x2115422, 0x2115431, 0x2115512, 0x2115521,
+	0x2115611, 0x2116115, 0x2116124, 0x2116133, 0x2116142, 0x2116151, 0x2116214, 0x2116223,
+	0x2116232, 0x2116241, 0x2116313, 0x2116322, 0x2116331, 0x2116412, 0x2116421, 0x2116511,
+	0x2121146, 0x2121155, 0x2121164, 0x2121236, 0x2121245, 0x2121254, 0x2121263, 0x2121326,
+	0x2121335, 0x2121344, 0x2121353, 0x2121362, 0x2121416, 0x2121425, 0x2121434, 0x2121443,
+	0x2121452, 0x2121461, 0x2121515, 0x2121524, 0x2121533, 0x2121542, 0x2121551, 0x2121614,
+	0x2121623, 0x2121632, 0x2121641, 0x2122136, 0x2122145, 0x2122154, 0x2122163, 0x2122226,
+	0x2122235, 0x2122244, 0x2122253, 0x2122262, 0x2122316, 0x2122325, 0x2122334, 0x2122343,
+	0x2122352, 0x2122361, 0x2122415, 0x2122424, 0x2122433, 0x2122442, 0x2122451, 0x2122514,
+	0x2122523, 0x2122532, 0x2122541, 0x2122613, 0x2122622, 0x2122631, 0x2123126, 0x2123135,
+	0x2123144, 0x2123153, 0x2123162, 0x2123216, 0x2123225, 0x2123234, 0x2123243, 0x2123252,
+	0x2123261, 0x2123315, 0x2123324, 0x2123333, 0x2123342, 0x2123351, 0x2123414, 0x2123423,
+	0x2123432, 0x2123441, 0x2123513, 0x2123522, 0x2123531, 0x2123612, 0x2123621, 0x2124116,
+	0x2124125, 0x2124134, 0x2124143, 0x2124152, 0x2124161, 0x2124215, 0x2124224, 0x2124233,
+	0x2124242, 0x2124251, 0x2124314, 0x2124323, 0x2124332, 0x2124341, 0x2124413, 0x2124422,
+	0x2124431, 0x2124512, 0x2124521, 0x2124611, 0x2125115, 0x2125124, 0x2125133, 0x2125142,
+	0x2125151, 0x2125214, 0x2125223, 0x2125232, 0x2125241, 0x2125313, 0x2125322, 0x2125331,
+	0x2125412, 0x2125421, 0x2125511, 0x2126114, 0x2126123, 0x2126132, 0x2126141, 0x2126213,
+	0x2126222, 0x2126231, 0x2126312, 0x2126321, 0x2126411, 0x2131136, 0x2131145, 0x2131154,
+	0x2131163, 0x2131226, 0x2131235, 0x2131244, 0x2131253, 0x2131262, 0x2131316, 0x2131325,
+	0x2131334, 0x2131343, 0x2131352, 0x2131361, 0x2131415, 0x2131424, 0x2131433, 0x2131442,
+	0x2131451, 0x2131514, 0x2131523, 0x2131532, 0x2131541, 0x2131613, 0x2131622, 0x2131631,
+	0x2132126, 0x2132135, 0x2132144, 0x2132153, 0x2132162, 0x2132216, 0x2132225, 0x2132234,
+	0x2132243, 0x2132252, 0x2132261, 0x2132315, 0x2132324, 0x2132333, 0x2132342, 0x2132351,
+	0x2132414, 0x2132423, 0x2132432, 0x2132441, 0x2132513, 0x2132522, 0x2132531, 0x2132612,
+	0x2132621, 0x2133116, 0x2133125, 0x2133134, 0x2133143, 0x2133152, 0x2133161, 0x2133215,
+	0x2133224, 0x2133233, 0x2133242, 0x2133251, 0x2133314, 0x2133323, 0x2133332, 0x2133341,
+	0x2133413, 0x2133422, 0x2133431, 0x2133512, 0x2133521, 0x2133611, 0x2134115, 0x2134124,
+	0x2134133, 0x2134142, 0x2134151, 0x2134214, 0x2134223, 0x2134232, 0x2134241, 0x2134313,
+	0x2134322, 0x2134331, 0x2134412, 0x2134421, 0x2134511, 0x2135114, 0x2135123, 0x2135132,
+	0x2135141, 0x2135213, 0x2135222, 0x2135231, 0x2135312, 0x2135321, 0x2135411, 0x2136113,
+	0x2136122, 0x2136131, 0x2136212, 0x2136221, 0x2136311, 0x2141126, 0x2141135, 0x2141144,
+	0x2141153, 0x2141162, 0x2141216, 0x2141225, 0x2141234, 0x2141243, 0x2141252, 0x2141261,
+	0x2141315, 0x2141324, 0x2141333, 0x2141342, 0x2141351, 0x2141414, 0x2141423, 0x2141432,
+	0x2141441, 0x2141513, 0x2141522, 0x2141531, 0x2141612, 0x2141621, 0x2142116, 0x2142125,
+	0x2142134, 0x2142143, 0x2142152, 0x2142161, 0x2142215, 0x2142224, 0x2142233, 0x2142242,
+	0x2142251, 0x2142314, 0x2142323, 0x2142332, 0x2142341, 0x2142413, 0x2142422, 0x2142431,
+	0x2142512, 0x2142521, 0x2142611, 0x2143115, 0x2143124, 0x2143133, 0x2143142, 0x2143151,
+	0x2143214, 0x2143223, 0x2143232, 0x2143241, 0x2143313, 0x2143322, 0x2143331, 0x2143412,
+	0x2143421, 0x2143511, 0x2144114, 0x2144123, 0x2144132, 0x2144141, 0x2144213, 0x2144222,
+	0x2144231, 0x2144312, 0x2144321, 0x2144411, 0x2145113, 0x2145122, 0x2145131, 0x2145212,
+	0x2145221, 0x2145311, 0x2146112, 0x2146121, 0x2146211, 0x2151116, 0x2151125, 0x2151134,
+	0x2151143, 0x2151152, 0x2151161, 0x2151215, 0x2151224, 0x2151233, 0x2151242, 0x2151251,
+	0x2151314, 0x2151323, 0x2151332, 0x2151341, 0x2151413, 0x2151422, 0x2151431, 0x2151512,
+	0x2151521, 0x2151611, 0x2152115, 0x2152124, 0x2152133, 0x2152142, 0x2152151, 0x2152214,
+	0x2152223, 0x2152232, 0x2152241, 0x2152313, 0x2152322, 0x2152331, 0x2152412, 0x2152421,
+	0x2152511, 0x2153114, 0x2153123, 0x2153132, 0x2153141, 0x2153213, 0x2153222, 0x2153231,
+	0x2153312, 0x2153321, 0x2153411, 0x2154113, 0x2154122, 0x2154131, 0x2154212, 0x2154221,
+	0x2154311, 0x2155112, 0x2155121, 0x2155211, 0x2156111, 0x2161115, 0x2161124, 0x2161133,
+	0x2161142, 0x2161151, 0x2161214, 0x2161223, 0x2161232, 0x2161241, 0x2161313, 0x2161322,
+	0x2161331, 0x2161412, 0x2161421, 0x2161511, 0x2162114, 0x2162123, 0x2162132, 0x2162141,
+	0x2162213, 0x2162222, 0x2162231, 0x2162312, 0x2162321, 0x2162411, 0x2163113, 0x2163122,
+	0x2163131, 0x2163212, 0x2163221, 0x2163311, 0x2164112, 0x2164121, 0x2164211, 0x2165111,
+	0x2211146, 0x2211155, 0x2211164, 0x2211236, 0x2211245, 0x2211254, 0x2211263, 0x2211326,
+	0x2211335, 0x2211344, 0x2211353, 0x2211362, 0x2211416, 0x2211425, 0x2211434, 0x2211443,
+	0x2211452, 0x2211461, 0x2211515, 0x2211524, 0x2211533, 0x2211542, 0x2211551, 0x2211614,
+	0x2211623, 0x2211632, 0x2211641, 0x2212136, 0x2212145, 0x2212154, 0x2212163, 0x2212226,
+	0x2212235, 0x2212244, 0x2212253, 0x2212262, 0x2212316, 0x2212325, 0x2212334, 0x2212343,
+	0x2212352, 0x2212361, 0x2212415, 0x2212424, 0x2212433, 0x2212442, 0x2212451, 0x2212514,
+	0x2212523, 0x2212532, 0x2212541, 0x2212613, 0x2212622, 0x2212631, 0x2213126, 0x2213135,
+	0x2213144, 0x2213153, 0x2213162, 0x2213216, 0x2213225, 0x2213234, 0x2213243, 0x2213252,
+	0x2213261, 0x2213315, 0x2213324, 0x2213333, 0x2213342, 0x2213351, 0x2213414, 0x2213423,
+	0x2213432, 0x2213441, 0x2213513, 0x2213522, 0x2213531, 0x2213612, 0x2213621, 0x2214116,
+	0x2214125, 0x2214134, 0x2214143, 0x2214152, 0x2214161, 0x2214215, 0x2214224, 0x2214233,
+	0x2214242, 0x2214251, 0x2214314, 0x2214323, 0x2214332, 0x2214341, 0x2214413, 0x2214422,
+	0x2214431, 0x2214512, 0x2214521, 0x2214611, 0x2215115, 0x2215124, 0x2215133, 0x2215142,
+	0x2215151, 0x2215214, 0x2215223, 0x2215232, 0x2215241, 0x2215313, 0x2215322, 0x2215331,
+	0x2215412, 0x2215421, 0x2215511, 0x2216114, 0x2216123, 0x2216132, 0x2216141, 0x2216213,
+	0x2216222, 0x2216231, 0x2216312, 0x2216321, 0x2216411, 0x2221136, 0x2221145, 0x2221154,
+	0x2221163, 0x2221226, 0x2221235, 0x2221244, 0x2221253, 0x2221262, 0x2221316, 0x2221325,
+	0x2221334, 0x2221343, 0x2221352, 0x2221361, 0x2221415, 0x2221424, 0x2221433, 0x2221442,
+	0x2221451, 0x2221514, 0x2221523, 0x2221532, 0x2221541, 0x2221613, 0x2221622, 0x2221631,
+	0x2222126, 0x2222135, 0x2222144, 0x2222153, 0x2222162, 0x2222216, 0x2222261, 0x2222315,
+	0x2222351, 0x2222414, 0x2222441, 0x2222513, 0x2222531, 0x2222612, 0x2222621, 0x2223116,
+	0x2223125, 0x2223134, 0x2223143, 0x2223152, 0x2223161, 0x2223215, 0x2223251, 0x2223314,
+	0x2223341, 0x2223413, 0x2223431, 0x2223512, 0x2223521, 0x2223611, 0x2224115, 0x2224124,
+	0x2224133, 0x2224142, 0x2224151, 0x2224214, 0x2224241, 0x2224313, 0x2224331, 0x2224412,
+	0x2224421, 0x2224511, 0x2225114, 0x2225123, 0x2225132, 0x2225141, 0x2225213, 0x2225231,
+	0x2225312, 0x2225321, 0x2225411, 0x2226113, 0x2226122, 0x2226131, 0x2226212, 0x2226221,
+	0x2226311, 0x2231126, 0x2231135, 0x2231144, 0x2231153, 0x2231162, 0x2231216, 0x2231225,
+	0x2231234, 0x2231243, 0x2231252, 0x2231261, 0x2231315, 0x2231324, 0x2231333, 0x2231342,
+	0x2231351, 0x2231414, 0x2231423, 0x2231432, 0x2231441, 0x2231513, 0x2231522, 0x2231531,
+	0x2231612, 0x2231621, 0x2232116, 0x2232125, 0x2232134, 0x2232143, 0x2232152, 0x2232161,
+	0x2232215, 0x2232251, 0x2232314, 0x2232341, 0x2232413, 0x2232431, 0x2232512, 0x2232521,
+	0x2232611, 0x2233115, 0x2233124, 0x2233133, 0x2233142, 0x2233151, 0x2233214, 0x2233241,
+	0x2233313, 0x2233331, 0x2233412, 0x2233421, 0x2233511, 0x2234114, 0x2234123, 0x2234132,
+	0x2234141, 0x2234213, 0x2234231, 0x2234312, 0x2234321, 0x2234411, 0x2235113, 0x2235122,
+	0x2235131, 0x2235212, 0x2235221, 0x2235311, 0x2236112, 0x2236121, 0x2236211, 0x2241116,
+	0x2241125, 0x2241134, 0x2241143, 0x2241152, 0x2241161, 0x2241215, 0x2241224, 0x2241233,
+	0x2241242, 0x2241251, 0x2241314, 0x2241323, 0x2241332, 0x2241341, 0x2241413, 0x2241422,
+	0x2241431, 0x2241512, 0x2241521, 0x2241611, 0x2242115, 0x2242124, 0x2242133, 0x2242142,
+	0x2242151, 0x2242214, 0x2242241, 0x2242313, 0x2242331, 0x2242412, 0x2242421, 0x2242511,
+	0x2243114, 0x2243123, 0x2243132, 0x2243141, 0x2243213, 0x2243231, 0x2243312, 0x2243321,
+	0x2243411, 0x2244113, 0x2244122, 0x2244131, 0x2244212, 0x2244221, 0x2244311, 0x2245112,
+	0x2245121, 0x2245211, 0x2246111, 0x2251115, 0x2251124, 0x2251133, 0x2251142, 0x2251151,
+	0x2251214, 0x2251223, 0x2251232, 0x2251241, 0x2251313, 0x2251322, 0x2251331, 0x2251412,
+	0x2251421, 0x2251511, 0x2252114, 0x2252123, 0x2252132, 0x2252141, 0x2252213, 0x2252231,
+	0x2252312, 0x2252321, 0x2252411, 0x2253113, 0x2253122, 0x2253131, 0x2253212, 0x2253221,
+	0x2253311, 0x2254112, 0x2254121, 0x2254211, 0x2255111, 0x2261114, 0x2261123, 0x2261132,
+	0x2261141, 0x2261213, 0x2261222, 0x2261231, 0x2261312, 0x2261321, 0x2261411, 0x2262113,
+	0x2262122, 0x2262131, 0x2262212, 0x2262221, 0x2262311, 0x2263112, 0x2263121, 0x2263211,
+	0x2264111, 0x2311136, 0x2311145, 0x2311154, 0x2311163, 0x2311226, 0x2311235, 0x2311244,
+	0x2311253, 0x2311262, 0x2311316, 0x2311325, 0x2311334, 0x2311343, 0x2311352, 0x2311361,
+	0x2311415, 0x2311424, 0x2311433, 0x2311442, 0x2311451, 0x2311514, 0x2311523, 0x2311532,
+	0x2311541, 0x2311613, 0x2311622, 0x2311631, 0x2312126, 0x2312135, 0x2312144, 0x2312153,
+	0x2312162, 0x2312216, 0x2312225, 0x2312234, 0x2312243, 0x2312252, 0x2312261, 0x2312315,
+	0x2312324, 0x2312333, 0x2312342, 0x2312351, 0x2312414, 0x2312423, 0x2312432, 0x2312441,
+	0x2312513, 0x2312522, 0x2312531, 0x2312612, 0x2312621, 0x2313116, 0x2313125, 0x2313134,
+	0x2313143, 0x2313152, 0x2313161, 0x2313215, 0x2313224, 0x2313233, 0x2313242, 0x2313251,
+	0x2313314, 0x2313323, 0x2313332, 0x2313341, 0x2313413, 0x2313422, 0x2313431, 0x2313512,
+	0x2313521, 0x2313611, 0x2314115, 0x2314124, 0x2314133, 0x2314142, 0x2314151, 0x2314214,
+	0x2314223, 0x2314232, 0x2314241, 0x2314313, 0x2314322, 0x2314331, 0x2314412, 0x2314421,
+	0x2314511, 0x2315114, 0x2315123, 0x2315132, 0x2315141, 0x2315213, 0x2315222, 0x2315231,
+	0x2315312, 0x2315321, 0x2315411, 0x2316113, 0x2316122, 0x2316131, 0x2316212, 0x2316221,
+	0x2316311, 0x2321126, 0x2321135, 0x2321144, 0x2321153, 0x2321162, 0x2321216, 0x2321225,
+	0x2321234, 0x2321243, 0x2321252, 0x2321261, 0x2321315, 0x2321324, 0x2321333, 0x2321342,
+	0x2321351, 0x2321414, 0x2321423, 0x2321432, 0x2321441, 0x2321513, 0x2321522, 0x2321531,
+	0x2321612, 0x2321621, 0x2322116, 0x2322125, 0x2322134, 0x2322143, 0x2322152, 0x2322161,
+	0x2322215, 0x2322251, 0x2322314, 0x2322341, 0x2322413, 0x2322431, 0x2322512, 0x2322521,
+	0x2322611, 0x2323115, 0x2323124, 0x2323133, 0x2323142, 0x2323151, 0x2323214, 0x2323241,
+	0x2323313, 0x2323331, 0x2323412, 0x2323421, 0x2323511, 0x2324114, 0x2324123, 0x2324132,
+	0x2324141, 0x2324213, 0x2324231, 0x2324312, 0x2324321, 0x2324411, 0x2325113, 0x2325122,
+	0x2325131, 0x2325212, 0x2325221, 0x2325311, 0x2326112, 0x2326121, 0x2326211, 0x2331116,
+	0x2331125, 0x2331134, 0x2331143, 0x2331152, 0x2331161, 0x2331215, 0x2331224, 0x2331233,
+	0x2331242, 0x2331251, 0x2331314, 0x2331323, 0x2331332, 0x2331341, 0x2331413, 0x2331422,
+	0x2331431, 0x2331512, 0x2331521, 0x2331611, 0x2332115, 0x2332124, 0x2332133, 0x2332142,
+	0x2332151, 0x2332214, 0x2332241, 0x2332313, 0x2332331, 0x2332412, 0x2332421, 0x2332511,
+	0x2333114, 0x2333123, 0x2333132, 0x2333141, 0x2333213, 0x2333231, 0x2333312, 0x2333321,
+	0x2333411, 0x2334113, 0x2334122, 0x2334131, 0x2334212, 0x2334221, 0x2334311, 0x2335112,
+	0x2335121, 0x2335211, 0x2336111, 0x2341115, 0x2341124, 0x2341133, 0x2341142, 0x2341151,
+	0x2341214, 0x2341223, 0x2341232, 0x2341241, 0x2341313, 0x2341322, 0x2341331, 0x2341412,
+	0x2341421, 0x2341511, 0x2342114, 0x2342123, 0x2342132, 0x2342141, 0x2342213, 0x2342231,
+	0x2342312, 0x2342321, 0x2342411, 0x2343113, 0x2343122, 0x2343131, 0x2343212, 0x2343221,
+	0x2343311, 0x2344112, 0x2344121, 0x2344211, 0x2345111, 0x2351114, 0x2351123, 0x2351132,
+	0x2351141, 0x2351213, 0x2351222, 0x2351231, 0x2351312, 0x2351321, 0x2351411, 0x2352113,
+	0x2352122, 0x2352131, 0x2352212, 0x2352221, 0x2352311, 0x2353112, 0x2353121, 0x2353211,
+	0x2354111, 0x2361113, 0x2361122, 0x2361131, 0x2361212, 0x2361221, 0x2361311, 0x2362112,
+	0x2362121, 0x2362211, 0x2363111, 0x2411126, 0x2411135, 0x2411144, 0x2411153, 0x2411162,
+	0x2411216, 0x2411225, 0x2411234, 0x2411243, 0x2411252, 0x2411261, 0x2411315, 0x2411324,
+	0x2411333, 0x2411342, 0x2411351, 0x2411414, 0x2411423, 0x2411432, 0x2411441, 0x2411513,
+	0x2411522, 0x2411531, 0x2411612, 0x2411621, 0x2412116, 0x2412125, 0x2412134, 0x2412143,
+	0x2412152, 0x2412161, 0x2412215, 0x2412224, 0x2412233, 0x2412242, 0x2412251, 0x2412314,
+	0x2412323, 0x2412332, 0x2412341, 0x2412413, 0x2412422, 0x2412431, 0x2412512, 0x2412521,
+	0x2412611, 0x2413115, 0x2413124, 0x2413133, 0x2413142, 0x2413151, 0x2413214, 0x2413223,
+	0x2413232, 0x2413241, 0x2413313, 0x2413322, 0x2413331, 0x2413412, 0x2413421, 0x2413511,
+	0x2414114, 0x2414123, 0x2414132, 0x2414141, 0x2414213, 0x2414222, 0x2414231, 0x2414312,
+	0x2414321, 0x2414411, 0x2415113, 0x2415122, 0x2415131, 0x2415212, 0x2415221, 0x2415311,
+	0x2416112, 0x2416121, 0x2416211, 0x2421116, 0x2421125, 0x2421134, 0x2421143, 0x2421152,
+	0x2421161, 0x2421215, 0x2421224, 0x2421233, 0x2421242, 0x2421251, 0x2421314, 0x2421323,
+	0x2421332, 0x2421341, 0x2421413, 0x2421422, 0x2421431, 0x2421512, 0x2421521, 0x2421611,
+	0x2422115, 0x2422124, 0x2422133, 0x2422142, 0x2422151, 0x2422214, 0x2422241, 0x2422313,
+	0x2422331, 0x2422412, 0x2422421, 0x2422511, 0x2423114, 0x2423123, 0x2423132, 0x2423141,
+	0x2423213, 0x2423231, 0x2423312, 0x2423321, 0x2423411, 0x2424113, 0x2424122, 0x2424131,
+	0x2424212, 0x2424221, 0x2424311, 0x2425112, 0x2425121, 0x2425211, 0x2426111, 0x2431115,
+	0x2431124, 0x2431133, 0x2431142, 0x2431151, 0x2431214, 0x2431223, 0x2431232, 0x2431241,
+	0x2431313, 0x2431322, 0x2431331, 0x2431412, 0x2431421, 0x2431511, 0x2432114, 0x2432123,
+	0x2432132, 0x2432141, 0x2432213, 0x2432231, 0x2432312, 0x2432321, 0x2432411, 0x2433113,
+	0x2433122, 0x2433131, 0x2433212, 0x2433221, 0x2433311, 0x2434112, 0x2434121, 0x2434211,
+	0x2435111, 0x2441114, 0x2441123, 0x2441132, 0x2441141, 0x2441213, 0x2441222, 0x2441231,
+	0x2441312, 0x2441321, 0x2441411, 0x2442113, 0x2442122, 0x2442131, 0x2442212, 0x2442221,
+	0x2442311, 0x2443112, 0x2443121, 0x2443211, 0x2444111, 0x2451113, 0x2451122, 0x2451131,
+	0x2451212, 0x2451221, 0x2451311, 0x2452112, 0x2452121, 0x2452211, 0x2453111, 0x2461112,
+	0x2461121, 0x2461211, 0x2462111, 0x2511116, 0x2511125, 0x2511134, 0x2511143, 0x2511152,
+	0x2511161, 0x2511215, 0x2511224, 0x2511233, 0x2511242, 0x2511251, 0x2511314, 0x2511323,
+	0x2511332, 0x2511341, 0x2511413, 0x2511422, 0x2511431, 0x2511512, 0x2511521, 0x2511611,
+	0x2512115, 0x2512124, 0x2512133, 0x2512142, 0x2512151, 0x2512214, 0x2512223, 0x2512232,
+	0x2512241, 0x2512313, 0x2512322, 0x2512331, 0x2512412, 0x2512421, 0x2512511, 0x2513114,
+	0x2513123, 0x2513132, 0x2513141, 0x2513213, 0x2513222, 0x2513231, 0x2513312, 0x2513321,
+	0x2513411, 0x2514113, 0x2514122, 0x2514131, 0x2514212, 0x2514221, 0x2514311, 0x2515112,
+	0x2515121, 0x2515211, 0x2516111, 0x2521115, 0x2521124, 0x2521133, 0x2521142, 0x2521151,
+	0x2521214, 0x2521223, 0x2521232, 0x2521241, 0x2521313, 0x2521322, 0x2521331, 0x2521412,
+	0x2521421, 0x2521511, 0x2522114, 0x2522123, 0x2522132, 0x2522141, 0x2522213, 0x2522231,
+	0x2522312, 0x2522321, 0x2522411, 0x2523113, 0x2523122, 0x2523131, 0x2523212, 0x2523221,
+	0x2523311, 0x2524112, 0x2524121, 0x2524211, 0x2525111, 0x2531114, 0x2531123, 0x2531132,
+	0x2531141, 0x2531213, 0x2531222, 0x2531231, 0x2531312, 0x2531321, 0x2531411, 0x2532113,
+	0x2532122, 0x2532131, 0x2532212, 0x2532221, 0x2532311, 0x2533112, 0x2533121, 0x2533211,
+	0x2534111, 0x2541113, 0x2541122, 0x2541131, 0x2541212, 0x2541221, 0x2541311, 0x2542112,
+	0x2542121, 0x2542211, 0x2543111, 0x2551112, 0x2551121, 0x2551211, 0x2552111, 0x2561111,
+	0x2611115, 0x2611124, 0x2611133, 0x2611142, 0x2611151, 0x2611214, 0x2611223, 0x2611232,
+	0x2611241, 0x2611313, 0x2611322, 0x2611331, 0x2611412, 0x2611421, 0x2611511, 0x2612114,
+	0x2612123, 0x2612132, 0x2612141, 0x2612213, 0x2612222, 0x2612231, 0x2612312, 0x2612321,
+	0x2612411, 0x2613113, 0x2613122, 0x2613131, 0x2613212, 0x2613221, 0x2613311, 0x2614112,
+	0x2614121, 0x2614211, 0x2615111, 0x2621114, 0x2621123, 0x2621132, 0x2621141, 0x2621213,
+	0x2621222, 0x2621231, 0x2621312, 0x2621321, 0x2621411, 0x2622113, 0x2622122, 0x2622131,
+	0x2622212, 0x2622221, 0x2622311, 0x2623112, 0x2623121, 0x2623211, 0x2624111, 0x2631113,
+	0x2631122, 0x2631131, 0x2631212, 0x2631221, 0x2631311, 0x2632112, 0x2632121, 0x2632211,
+	0x2633111, 0x2641112, 0x2641121, 0x2641211, 0x2642111, 0x2651111, 0x3111146, 0x3111155,
+	0x3111164, 0x3111236, 0x3111245, 0x3111254, 0x3111263, 0x3111326, 0x3111335, 0x3111344,
+	0x3111353, 0x3111362, 0x3111416, 0x3111425, 0x3111434, 0x3111443, 0x3111452, 0x3111461,
+	0x3111515, 0x3111524, 0x3111533, 0x3111542, 0x3111551, 0x3111614, 0x3111623, 0x3111632,
+	0x3111641, 0x3112136, 0x3112145, 0x3112154, 0x3112163, 0x3112226, 0x3112235, 0x3112244,
+	0x3112253, 0x3112262, 0x3112316, 0x3112325, 0x3112334, 0x3112343, 0x3112352, 0x3112361,
+	0x3112415, 0x3112424, 0x3112433, 0x3112442, 0x3112451, 0x3112514, 0x3112523, 0x3112532,
+	0x3112541, 0x3112613, 0x3112622, 0x3112631, 0x3113126, 0x3113135, 0x3113144, 0x3113153,
+	0x3113162, 0x3113216, 0x3113225, 0x3113234, 0x3113243, 0x3113252, 0x3113261, 0x3113315,
+	0x3113324, 0x3113333, 0x3113342, 0x3113351, 0x3113414, 0x3113423, 0x3113432, 0x3113441,
+	0x3113513, 0x3113522, 0x3113531, 0x3113612, 0x3113621, 0x3114116, 0x3114125, 0x3114134,
+	0x3114143, 0x3114152, 0x3114161, 0x3114215, 0x3114224, 0x3114233, 0x3114242, 0x3114251,
+	0x3114314, 0x3114323, 0x3114332, 0x3114341, 0x3114413, 0x3114422, 0x3114431, 0x3114512,
+	0x3114521, 0x3114611, 0x3115115, 0x3115124, 0x3115133, 0x3115142, 0x3115151, 0x3115214,
+	0x3115223, 0x3115232, 0x3115241, 0x3115313, 0x3115322, 0x3115331, 0x3115412, 0x3115421,
+	0x3115511, 0x3116114, 0x3116123, 0x3116132, 0x3116141, 0x3116213, 0x3116222, 0x3116231,
+	0x3116312, 0x3116321, 0x3116411, 0x3121136, 0x3121145, 0x3121154, 0x3121163, 0x3121226,
+	0x3121235, 0x3121244, 0x3121253, 0x3121262, 0x3121316, 0x3121325, 0x3121334, 0x3121343,
+	0x3121352, 0x3121361, 0x3121415, 0x3121424, 0x3121433, 0x3121442, 0x3121451, 0x3121514,
+	0x3121523, 0x3121532, 0x3121541, 0x3121613, 0x3121622, 0x3121631, 0x3122126, 0x3122135,
+	0x3122144, 0x3122153, 0x3122162, 0x3122216, 0x3122225, 0x3122234, 0x3122243, 0x3122252,
+	0x3122261, 0x3122315, 0x3122324, 0x3122333, 0x3122342, 0x3122351, 0x3122414, 0x3122423,
+	0x3122432, 0x3122441, 0x3122513, 0x3122522, 0x3122531, 0x3122612, 0x3122621, 0x3123116,
+	0x3123125, 0x3123134, 0x3123143, 0x3123152, 0x3123161, 0x3123215, 0x3123224, 0x3123233,
+	0x3123242, 0x3123251, 0x3123314, 0x3123323, 0x3123332, 0x3123341, 0x3123413, 0x3123422,
+	0x3123431, 0x3123512, 0x3123521, 0x3123611, 0x3124115, 0x3124124, 0x3124133, 0x3124142,
+	0x3124151, 0x3124214, 0x3124223, 0x3124232, 0x3124241, 0x3124313, 0x3124322, 0x3124331,
+	0x3124412, 0x3124421, 0x3124511, 0x3125114, 0x3125123, 0x3125132, 0x3125141, 0x3125213,
+	0x3125222, 0x3125231, 0x3125312, 0x3125321, 0x3125411, 0x3126113, 0x3126122, 0x3126131,
+	0x3126212, 0x3126221, 0x3126311, 0x3131126, 0x3131135, 0x3131144, 0x3131153, 0x3131162,
+	0x3131216, 0x3131225, 0x3131234, 0x3131243, 0x3131252, 0x3131261, 0x3131315, 0x3131324,
+	0x3131333, 0x3131342, 0x3131351, 0x3131414, 0x3131423, 0x3131432, 0x3131441, 0x3131513,
+	0x3131522, 0x3131531, 0x3131612, 0x3131621, 0x3132116, 0x3132125, 0x3132134, 0x3132143,
+	0x3132152, 0x3132161, 0x3132215, 0x3132224, 0x3132233, 0x3132242, 0x3132251, 0x3132314,
+	0x3132323, 0x3132332, 0x3132341, 0x3132413, 0x3132422, 0x3132431, 0x3132512, 0x3132521,
+	0x3132611, 0x3133115, 0x3133124, 0x3133133, 0x3133142, 0x3133151, 0x3133214, 0x3133223,
+	0x3133232, 0x3133241, 0x3133313, 0x3133322, 0x3133331, 0x3133412, 0x3133421, 0x3133511,
+	0x3134114, 0x3134123, 0x3134132, 0x3134141, 0x3134213, 0x3134222, 0x3134231, 0x3134312,
+	0x3134321, 0x3134411, 0x3135113, 0x3135122, 0x3135131, 0x3135212, 0x3135221, 0x3135311,
+	0x3136112, 0x3136121, 0x3136211, 0x3141116, 0x3141125, 0x3141134, 0x3141143, 0x3141152,
+	0x3141161, 0x3141215, 0x3141224, 0x3141233, 0x3141242, 0x3141251, 0x3141314, 0x3141323,
+	0x3141332, 0x3141341, 0x3141413, 0x3141422, 0x3141431, 0x3141512, 0x3141521, 0x3141611,
+	0x3142115, 0x3142124, 0x3142133, 0x3142142, 0x3142151, 0x3142214, 0x3142223, 0x3142232,
+	0x3142241, 0x3142313, 0x3142322, 0x3142331, 0x3142412, 0x3142421, 0x3142511, 0x3143114,
+	0x3143123, 0x3143132, 0x3143141, 0x3143213, 0x3143222, 0x3143231, 0x3143312, 0x3143321,
+	0x3143411, 0x3144113, 0x3144122, 0x3144131, 0x3144212, 0x3144221, 0x3144311, 0x3145112,
+	0x3145121, 0x3145211, 0x3146111, 0x3151115, 0x3151124, 0x3151133, 0x3151142, 0x3151151,
+	0x3151214, 0x3151223, 0x3151232, 0x3151241, 0x3151313, 0x3151322, 0x3151331, 0x3151412,
+	0x3151421, 0x3151511, 0x3152114, 0x3152123, 0x3152132, 0x3152141, 0x3152213, 0x3152222,
+	0x3152231, 0x3152312, 0x3152321, 0x3152411, 0x3153113, 0x3153122, 0x3153131, 0x3153212,
+	0x3153221, 0x3153311, 0x3154112, 0x3154121, 0x3154211, 0x3155111, 0x3161114, 0x3161123,
+	0x3161132, 0x3161141, 0x3161213, 0x3161222, 0x3161231, 0x3161312, 0x3161321, 0x3161411,
+	0x3162113, 0x3162122, 0x3162131, 0x3162212, 0x3162221, 0x3162311, 0x3163112, 0x3163121,
+	0x3163211, 0x3164111, 0x3211136, 0x3211145, 0x3211154, 0x3211163, 0x3211226, 0x3211235,
+	0x3211244, 0x3211253, 0x3211262, 0x3211316, 0x3211325, 0x3211334, 0x3211343, 0x3211352,
+	0x3211361, 0x3211415, 0x3211424, 0x3211433, 0x3211442, 0x3211451, 0x3211514, 0x3211523,
+	0x3211532, 0x3211541, 0x3211613, 0x3211622, 0x3211631, 0x3212126, 0x3212135, 0x3212144,
+	0x3212153, 0x3212162, 0x3212216, 0x3212225, 0x3212234, 0x3212243, 0x3212252, 0x3212261,
+	0x3212315, 0x3212324, 0x3212333, 0x3212342, 0x3212351, 0x3212414, 0x3212423, 0x3212432,
+	0x3212441, 0x3212513, 0x3212522, 0x3212531, 0x3212612, 0x3212621, 0x3213116, 0x3213125,
+	0x3213134, 0x3213143, 0x3213152, 0x3213161, 0x3213215, 0x3213224, 0x3213233, 0x3213242,
+	0x3213251, 0x3213314, 0x3213323, 0x3213332, 0x3213341, 0x3213413, 0x3213422, 0x3213431,
+	0x3213512, 0x3213521, 0x3213611, 0x3214115, 0x3214124, 0x3214133, 0x3214142, 0x3214151,
+	0x3214214, 0x3214223, 0x3214232, 0x3214241, 0x3214313, 0x3214322, 0x3214331, 0x3214412,
+	0x3214421, 0x3214511, 0x3215114, 0x3215123, 0x3215132, 0x3215141, 0x3215213, 0x3215222,
+	0x3215231, 0x3215312, 0x3215321, 0x3215411, 0x3216113, 0x3216122, 0x3216131, 0x3216212,
+	0x3216221, 0x3216311, 0x3221126, 0x3221135, 0x3221144, 0x3221153, 0x3221162, 0x3221216,
+	0x3221225, 0x3221234, 0x3221243, 0x3221252, 0x3221261, 0x3221315, 0x3221324, 0x3221333,
+	0x3221342, 0x3221351, 0x3221414, 0x3221423, 0x3221432, 0x3221441, 0x3221513, 0x3221522,
+	0x3221531, 0x3221612, 0x3221621, 0x3222116, 0x3222125, 0x3222134, 0x3222143, 0x3222152,
+	0x3222161, 0x3222215, 0x3222251, 0x3222314, 0x3222341, 0x3222413, 0x3222431, 0x3222512,
+	0x3222521, 0x3222611, 0x3223115, 0x3223124, 0x3223133, 0x3223142, 0x3223151, 0x3223214,
+	0x3223241, 0x3223313, 0x3223331, 0x3223412, 0x3223421, 0x3223511, 0x3224114, 0x3224123,
+	0x3224132, 0x3224141, 0x3224213, 0x3224231, 0x3224312, 0x3224321, 0x3224411, 0x3225113,
+	0x3225122, 0x3225131, 0x3225212, 0x3225221, 0x3225311, 0x3226112, 0x3226121, 0x3226211,
+	0x3231116, 0x3231125, 0x3231134, 0x3231143, 0x3231152, 0x3231161, 0x3231215, 0x3231224,
+	0x3231233, 0x3231242, 0x3231251, 0x3231314, 0x3231323, 0x3231332, 0x3231341, 0x3231413,
+	0x3231422, 0x3231431, 0x3231512, 0x3231521, 0x3231611, 0x3232115, 0x3232124, 0x3232133,
+	0x3232142, 0x3232151, 0x3232214, 0x3232241, 0x3232313, 0x3232331, 0x3232412, 0x3232421,
+	0x3232511, 0x3233114, 0x3233123, 0x3233132, 0x3233141, 0x3233213, 0x3233231, 0x3233312,
+	0x3233321, 0x3233411, 0x3234113, 0x3234122, 0x3234131, 0x3234212, 0x3234221, 0x3234311,
+	0x3235112, 0x3235121, 0x3235211, 0x3236111, 0x3241115, 0x3241124, 0x3241133, 0x3241142,
+	0x3241151, 0x3241214, 0x3241223, 0x3241232, 0x3241241, 0x3241313, 0x3241322, 0x3241331,
+	0x3241412, 0x3241421, 0x3241511, 0x3242114, 0x3242123, 0x3242132, 0x3242141, 0x3242213,
+	0x3242231, 0x3242312, 0x3242321, 0x3242411, 0x3243113, 0x3243122, 0x3243131, 0x3243212,
+	0x3243221, 0x3243311, 0x3244112, 0x3244121, 0x3244211, 0x3245111, 0x3251114, 0x3251123,
+	0x3251132, 0x3251141, 0x3251213, 0x3251222, 0x3251231, 0x3251312, 0x3251321, 0x3251411,
+	0x3252113, 0x3252122, 0x3252131, 0x3252212, 0x3252221, 0x3252311, 0x3253112, 0x3253121,
+	0x3253211, 0x3254111, 0x3261113, 0x3261122, 0x3261131, 0x3261212, 0x3261221, 0x3261311,
+	0x3262112, 0x3262121, 0x3262211, 0x3263111, 0x3311126, 0x3311135, 0x3311144, 0x3311153,
+	0x3311162, 0x3311216, 0x3311225, 0x3311234, 0x3311243, 0x3311252, 0x3311261, 0x3311315,
+	0x3311324, 0x3311333, 0x3311342, 0x3311351, 0x3311414, 0x3311423, 0x3311432, 0x3311441,
+	0x3311513, 0x3311522, 0x3311531, 0x3311612, 0x3311621, 0x3312116, 0x3312125, 0x3312134,
+	0x3312143, 0x3312152, 0x3312161, 0x3312215, 0x3312224, 0x3312233, 0x3312242, 0x3312251,
+	0x3312314, 0x3312323, 0x3312332, 0x3312341, 0x3312413, 0x3312422, 0x3312431, 0x3312512,
+	0x3312521, 0x3312611, 0x3313115, 0x3313124, 0x3313133, 0x3313142, 0x3313151, 0x3313214,
+	0x3313223, 0x3313232, 0x3313241, 0x3313313, 0x3313322, 0x3313331, 0x3313412, 0x3313421,
+	0x3313511, 0x3314114, 0x3314123, 0x3314132, 0x3314141, 0x3314213, 0x3314222, 0x3314231,
+	0x3314312, 0x3314321, 0x3314411, 0x3315113, 0x3315122, 0x3315131, 0x3315212, 0x3315221,
+	0x3315311, 0x3316112, 0x3316121, 0x3316211, 0x3321116, 0x3321125, 0x3321134, 0x3321143,
+	0x3321152, 0x3321161, 0x3321215, 0x3321224, 0x3321233, 0x3321242, 0x3321251, 0x3321314,
+	0x3321323, 0x3321332, 0x3321341, 0x3321413, 0x3321422, 0x3321431, 0x3321512, 0x3321521,
+	0x3321611, 0x3322115, 0x3322124, 0x3322133, 0x3322142, 0x3322151, 0x3322214, 0x3322241,
+	0x3322313, 0x3322331, 0x3322412, 0x3322421, 0x3322511, 0x3323114, 0x3323123, 0x3323132,
+	0x3323141, 0x3323213, 0x3323231, 0x3323312, 0x3323321, 0x3323411, 0x3324113, 0x3324122,
+	0x3324131, 0x3324212, 0x3324221, 0x3324311, 0x3325112, 0x3325121, 0x3325211, 0x3326111,
+	0x3331115, 0x3331124, 0x3331133, 0x3331142, 0x3331151, 0x3331214, 0x3331223, 0x3331232,
+	0x3331241, 0x3331313, 0x3331322, 0x3331331, 0x3331412, 0x3331421, 0x3331511, 0x3332114,
+	0x3332123, 0x3332132, 0x3332141, 0x3332213, 0x3332231, 0x3332312, 0x3332321, 0x3332411,
+	0x3333113, 0x3333122, 0x3333131, 0x3333212, 0x3333221, 0x3333311, 0x3334112, 0x3334121,
+	0x3334211, 0x3335111, 0x3341114, 0x3341123, 0x3341132, 0x3341141, 0x3341213, 0x3341222,
+	0x3341231, 0x3341312, 0x3341321, 0x3341411, 0x3342113, 0x3342122, 0x3342131, 0x3342212,
+	0x3342221, 0x3342311, 0x3343112, 0x3343121, 0x3343211, 0x3344111, 0x3351113, 0x3351122,
+	0x3351131, 0x3351212, 0x3351221, 0x3351311, 0x3352112, 0x3352121, 0x3352211, 0x3353111,
+	0x3361112, 0x3361121, 0x3361211, 0x3362111, 0x3411116, 0x3411125, 0x3411134, 0x3411143,
+	0x3411152, 0x3411161, 0x3411215, 0x3411224, 0x3411233, 0x3411242, 0x3411251, 0x3411314,
+	0x3411323, 0x3411332, 0x3411341, 0x3411413, 0x3411422, 0x3411431, 0x3411512, 0x3411521,
+	0x3411611, 0x3412115, 0x3412124, 0x3412133, 0x3412142, 0x3412151, 0x3412214, 0x3412223,
+	0x3412232, 0x3412241, 0x3412313, 0x3412322, 0x3412331, 0x3412412, 0x3412421, 0x3412511,
+	0x3413114, 0x3413123, 0x3413132, 0x3413141, 0x3413213, 0x3413222, 0x3413231, 0x3413312,
+	0x3413321, 0x3413411, 0x3414113, 0x3414122, 0x3414131, 0x3414212, 0x3414221, 0x3414311,
+	0x3415112, 0x3415121, 0x3415211, 0x3416111, 0x3421115, 0x3421124, 0x3421133, 0x3421142,
+	0x3421151, 0x3421214, 0x3421223, 0x3421232, 0x3421241, 0x3421313, 0x3421322, 0x3421331,
+	0x3421412, 0x3421421, 0x3421511, 0x3422114, 0x3422123, 0x3422132, 0x3422141, 0x3422213,
+	0x3422231, 0x3422312, 0x3422321, 0x3422411, 0x3423113, 0x3423122, 0x3423131, 0x3423212,
+	0x3423221, 0x3423311, 0x3424112, 0x3424121, 0x3424211, 0x3425111, 0x3431114, 0x3431123,
+	0x3431132, 0x3431141, 0x3431213, 0x3431222, 0x3431231, 0x3431312, 0x3431321, 0x3431411,
+	0x3432113, 0x3432122, 0x3432131, 0x3432212, 0x3432221, 0x3432311, 0x3433112, 0x3433121,
+	0x3433211, 0x3434111, 0x3441113, 0x3441122, 0x3441131, 0x3441212, 0x3441221, 0x3441311,
+	0x3442112, 0x3442121, 0x3442211, 0x3443111, 0x3451112, 0x3451121, 0x3451211, 0x3452111,
+	0x3461111, 0x3511115, 0x3511124, 0x3511133, 0x3511142, 0x3511151, 0x3511214, 0x3511223,
+	0x3511232, 0x3511241, 0x3511313, 0x3511322, 0x3511331, 0x3511412, 0x3511421, 0x3511511,
+	0x3512114, 0x3512123, 0x3512132, 0x3512141, 0x3512213, 0x3512222, 0x3512231, 0x3512312,
+	0x3512321, 0x3512411, 0x3513113, 0x3513122, 0x3513131, 0x3513212, 0x3513221, 0x3513311,
+	0x3514112, 0x3514121, 0x3514211, 0x3515111, 0x3521114, 0x3521123, 0x3521132, 0x3521141,
+	0x3521213, 0x3521222, 0x3521231, 0x3521312, 0x3521321, 0x3521411, 0x3522113, 0x3522122,
+	0x3522131, 0x3522212, 0x3522221, 0x3522311, 0x3523112, 0x3523121, 0x3523211, 0x3524111,
+	0x3531113, 0x3531122, 0x3531131, 0x3531212, 0x3531221, 0x3531311, 0x3532112, 0x3532121,
+	0x3532211, 0x3533111, 0x3541112, 0x3541121, 0x3541211, 0x3542111, 0x3551111, 0x3611114,
+	0x3611123, 0x3611132, 0x3611141, 0x3611213, 0x3611222, 0x3611231, 0x3611312, 0x3611321,
+	0x3611411, 0x3612113, 0x3612122, 0x3612131, 0x3612212, 0x3612221, 0x3612311, 0x3613112,
+	0x3613121, 0x3613211, 0x3614111, 0x3621113, 0x3621122, 0x3621131, 0x3621212, 0x3621221,
+	0x3621311, 0x3622112, 0x3622121, 0x3622211, 0x3623111, 0x3631112, 0x3631121, 0x3631211,
+	0x3632111, 0x3641111, 0x4111136, 0x4111145, 0x4111154, 0x4111163, 0x4111226, 0x4111235,
+	0x4111244, 0x4111253, 0x4111262, 0x4111316, 0x4111325, 0x4111334, 0x4111343, 0x4111352,
+	0x4111361, 0x4111415, 0x4111424, 0x4111433, 0x4111442, 0x4111451, 0x4111514, 0x4111523,
+	0x4111532, 0x4111541, 0x4111613, 0x4111622, 0x4111631, 0x4112126, 0x4112135, 0x4112144,
+	0x4112153, 0x4112162, 0x4112216, 0x4112225, 0x4112234, 0x4112243, 0x4112252, 0x4112261,
+	0x4112315, 0x4112324, 0x4112333, 0x4112342, 0x4112351, 0x4112414, 0x4112423, 0x4112432,
+	0x4112441, 0x4112513, 0x4112522, 0x4112531, 0x4112612, 0x4112621, 0x4113116, 0x4113125,
+	0x4113134, 0x4113143, 0x4113152, 0x4113161, 0x4113215, 0x4113224, 0x4113233, 0x4113242,
+	0x4113251, 0x4113314, 0x4113323, 0x4113332, 0x4113341, 0x4113413, 0x4113422, 0x4113431,
+	0x4113512, 0x4113521, 0x4113611, 0x4114115, 0x4114124, 0x4114133, 0x4114142, 0x4114151,
+	0x4114214, 0x4114223, 0x4114232, 0x4114241, 0x4114313, 0x4114322, 0x4114331, 0x4114412,
+	0x4114421, 0x4114511, 0x4115114, 0x4115123, 0x4115132, 0x4115141, 0x4115213, 0x4115222,
+	0x4115231, 0x4115312, 0x4115321, 0x4115411, 0x4116113, 0x4116122, 0x4116131, 0x4116212,
+	0x4116221, 0x4116311, 0x4121126, 0x4121135, 0x4121144, 0x4121153, 0x4121162, 0x4121216,
+	0x4121225, 0x4121234, 0x4121243, 0x4121252, 0x4121261, 0x4121315, 0x4121324, 0x4121333,
+	0x4121342, 0x4121351, 0x4121414, 0x4121423, 0x4121432, 0x4121441, 0x4121513, 0x4121522,
+	0x4121531, 0x4121612, 0x4121621, 0x4122116, 0x4122125, 0x4122134, 0x4122143, 0x4122152,
+	0x4122161, 0x4122215, 0x4122224, 0x4122233, 0x4122242, 0x4122251, 0x4122314, 0x4122323,
+	0x4122332, 0x4122341, 0x4122413, 0x4122422, 0x4122431, 0x4122512, 0x4122521, 0x4122611,
+	0x4123115, 0x4123124, 0x4123133, 0x4123142, 0x4123151, 0x4123214, 0x4123223, 0x4123232,
+	0x4123241, 0x4123313, 0x4123322, 0x4123331, 0x4123412, 0x4123421, 0x4123511, 0x4124114,
+	0x4124123, 0x4124132, 0x4124141, 0x4124213, 0x4124222, 0x4124231, 0x4124312, 0x4124321,
+	0x4124411, 0x4125113, 0x4125122, 0x4125131, 0x4125212, 0x4125221, 0x4125311, 0x4126112,
+	0x4126121, 0x4126211, 0x4131116, 0x4131125, 0x4131134, 0x4131143, 0x4131152, 0x4131161,
+	0x4131215, 0x4131224, 0x4131233, 0x4131242, 0x4131251, 0x4131314, 0x4131323, 0x4131332,
+	0x4131341, 0x4131413, 0x4131422, 0x4131431, 0x4131512, 0x4131521, 0x4131611, 0x4132115,
+	0x4132124, 0x4132133, 0x4132142, 0x4132151, 0x4132214, 0x4132223, 0x4132232, 0x4132241,
+	0x4132313, 0x4132322, 0x4132331, 0x4132412, 0x4132421, 0x4132511, 0x4133114, 0x4133123,
+	0x4133132, 0x4133141, 0x4133213, 0x4133222, 0x4133231, 0x4133312, 0x4133321, 0x4133411,
+	0x4134113, 0x4134122, 0x4134131, 0x4134212, 0x4134221, 0x4134311, 0x4135112, 0x4135121,
+	0x4135211, 0x4136111, 0x4141115, 0x4141124, 0x4141133, 0x4141142, 0x4141151, 0x4141214,
+	0x4141223, 0x4141232, 0x4141241, 0x4141313, 0x4141322, 0x4141331, 0x4141412, 0x4141421,
+	0x4141511, 0x4142114, 0x4142123, 0x4142132, 0x4142141, 0x4142213, 0x4142222, 0x4142231,
+	0x4142312, 0x4142321, 0x4142411, 0x4143113, 0x4143122, 0x4143131, 0x4143212, 0x4143221,
+	0x4143311, 0x4144112, 0x4144121, 0x4144211, 0x4145111, 0x4151114, 0x4151123, 0x4151132,
+	0x4151141, 0x4151213, 0x4151222, 0x4151231, 0x4151312, 0x4151321, 0x4151411, 0x4152113,
+	0x4152122, 0x4152131, 0x4152212, 0x4152221, 0x4152311, 0x4153112, 0x4153121, 0x4153211,
+	0x4154111, 0x4161113, 0x4161122, 0x4161131, 0x4161212, 0x4161221, 0x4161311, 0x4162112,
+	0x4162121, 0x4162211, 0x4163111, 0x4211126, 0x4211135, 0x4211144, 0x4211153, 0x4211162,
+	0x4211216, 0x4211225, 0x4211234, 0x4211243, 0x4211252, 0x4211261, 0x4211315, 0x4211324,
+	0x4211333, 0x4211342, 0x4211351, 0x4211414, 0x4211423, 0x4211432, 0x4211441, 0x4211513,
+	0x4211522, 0x4211531, 0x4211612, 0x4211621, 0x4212116, 0x4212125, 0x4212134, 0x4212143,
+	0x4212152, 0x4212161, 0x4212215, 0x4212224, 0x4212233, 0x4212242, 0x4212251, 0x4212314,
+	0x4212323, 0x4212332, 0x4212341, 0x4212413, 0x4212422, 0x4212431, 0x4212512, 0x4212521,
+	0x4212611, 0x4213115, 0x4213124, 0x4213133, 0x4213142, 0x4213151, 0x4213214, 0x4213223,
+	0x4213232, 0x4213241, 0x4213313, 0x4213322, 0x4213331, 0x4213412, 0x4213421, 0x4213511,
+	0x4214114, 0x4214123, 0x4214132, 0x4214141, 0x4214213, 0x4214222, 0x4214231, 0x4214312,
+	0x4214321, 0x4214411, 0x4215113, 0x4215122, 0x4215131, 0x4215212, 0x4215221, 0x4215311,
+	0x4216112, 0x4216121, 0x4216211, 0x4221116, 0x4221125, 0x4221134, 0x4221143, 0x4221152,
+	0x4221161, 0x4221215, 0x4221224, 0x4221233, 0x4221242, 0x4221251, 0x4221314, 0x4221323,
+	0x4221332, 0x4221341, 0x4221413, 0x4221422, 0x4221431, 0x4221512, 0x4221521, 0x4221611,
+	0x4222115, 0x4222124, 0x4222133, 0x4222142, 0x4222151, 0x4222214, 0x4222241, 0x4222313,
+	0x4222331, 0x4222412, 0x4222421, 0x4222511, 0x4223114, 0x4223123, 0x4223132, 0x4223141,
+	0x4223213, 0x4223231, 0x4223312, 0x4223321, 0x4223411, 0x4224113, 0x4224122, 0x4224131,
+	0x4224212, 0x4224221, 0x4224311, 0x4225112, 0x4225121, 0x4225211, 0x4226111, 0x4231115,
+	0x4231124, 0x4231133, 0x4231142, 0x4231151, 0x4231214, 0x4231223, 0x4231232, 0x4231241,
+	0x4231313, 0x4231322, 0x4231331, 0x4231412, 0x4231421, 0x4231511, 0x4232114, 0x4232123,
+	0x4232132, 0x4232141, 0x4232213, 0x4232231, 0x4232312, 0x4232321, 0x4232411, 0x4233113,
+	0x4233122, 0x4233131, 0x4233212, 0x4233221, 0x4233311, 0x4234112, 0x4234121, 0x4234211,
+	0x4235111, 0x4241114, 0x4241123, 0x4241132, 0x4241141, 0x4241213, 0x4241222, 0x4241231,
+	0x4241312, 0x4241321, 0x4241411, 0x4242113, 0x4242122, 0x4242131, 0x4242212, 0x4242221,
+	0x4242311, 0x4243112, 0x4243121, 0x4243211, 0x4244111, 0x4251113, 0x4251122, 0x4251131,
+	0x4251212, 0x4251221, 0x4251311, 0x4252112, 0x4252121, 0x4252211, 0x4253111, 0x4261112,
+	0x4261121, 0x4261211, 0x4262111, 0x4311116, 0x4311125, 0x4311134, 0x4311143, 0x4311152,
+	0x4311161, 0x4311215, 0x4311224, 0x4311233, 0x4311242, 0x4311251, 0x4311314, 0x4311323,
+	0x4311332, 0x4311341, 0x4311413, 0x4311422, 0x4311431, 0x4311512, 0x4311521, 0x4311611,
+	0x4312115, 0x4312124, 0x4312133, 0x4312142, 0x4312151, 0x4312214, 0x4312223, 0x4312232,
+	0x4312241, 0x4312313, 0x4312322, 0x4312331, 0x4312412, 0x4312421, 0x4312511, 0x4313114,
+	0x4313123, 0x4313132, 0x4313141, 0x4313213, 0x4313222, 0x4313231, 0x4313312, 0x4313321,
+	0x4313411, 0x4314113, 0x4314122, 0x4314131, 0x4314212, 0x4314221, 0x4314311, 0x4315112,
+	0x4315121, 0x4315211, 0x4316111, 0x4321115, 0x4321124, 0x4321133, 0x4321142, 0x4321151,
+	0x4321214, 0x4321223, 0x4321232, 0x4321241, 0x4321313, 0x4321322, 0x4321331, 0x4321412,
+	0x4321421, 0x4321511, 0x4322114, 0x4322123, 0x4322132, 0x4322141, 0x4322213, 0x4322231,
+	0x4322312, 0x4322321, 0x4322411, 0x4323113, 0x4323122, 0x4323131, 0x4323212, 0x4323221,
+	0x4323311, 0x4324112, 0x4324121, 0x4324211, 0x4325111, 0x4331114, 0x4331123, 0x4331132,
+	0x4331141, 0x4331213, 0x4331222, 0x4331231, 0x4331312, 0x4331321, 0x4331411, 0x4332113,
+	0x4332122, 0x4332131, 0x4332212, 0x4332221, 0x4332311, 0x4333112, 0x4333121, 0x4333211,
+	0x4334111, 0x4341113, 0x4341122, 0x4341131, 0x4341212, 0x4341221, 0x4341311, 0x4342112,
+	0x4342121, 0x4342211, 0x4343111, 0x4351112, 0x4351121, 0x4351211, 0x4352111, 0x4361111,
+	0x4411115, 0x4411124, 0x4411133, 0x4411142, 0x4411151, 0x4411214, 0x4411223, 0x4411232,
+	0x4411241, 0x4411313, 0x4411322, 0x4411331, 0x4411412, 0x4411421, 0x4411511, 0x4412114,
+	0x4412123, 0x4412132, 0x4412141, 0x4412213, 0x4412222, 0x4412231, 0x4412312, 0x4412321,
+	0x4412411, 0x4413113, 0x4413122, 0x4413131, 0x4413212, 0x4413221, 0x4413311, 0x4414112,
+	0x4414121, 0x4414211, 0x4415111, 0x4421114, 0x4421123, 0x4421132, 0x4421141, 0x4421213,
+	0x4421222, 0x4421231, 0x4421312, 0x4421321, 0x4421411, 0x4422113, 0x4422122, 0x4422131,
+	0x4422212, 0x4422221, 0x4422311, 0x4423112, 0x4423121, 0x4423211, 0x4424111, 0x4431113,
+	0x4431122, 0x4431131, 0x4431212, 0x4431221, 0x4431311, 0x4432112, 0x4432121, 0x4432211,
+	0x4433111, 0x4441112, 0x4441121, 0x4441211, 0x4442111, 0x4451111, 0x4511114, 0x4511123,
+	0x4511132, 0x4511141, 0x4511213, 0x4511222, 0x4511231, 0x4511312, 0x4511321, 0x4511411,
+	0x4512113, 0x4512122, 0x4512131, 0x4512212, 0x4512221, 0x4512311, 0x4513112, 0x4513121,
+	0x4513211, 0x4514111, 0x4521113, 0x4521122, 0x4521131, 0x4521212, 0x4521221, 0x4521311,
+	0x4522112, 0x4522121, 0x4522211, 0x4523111, 0x4531112, 0x4531121, 0x4531211, 0x4532111,
+	0x4541111, 0x4611113, 0x4611122, 0x4611131, 0x4611212, 0x4611221, 0x4611311, 0x4612112,
+	0x4612121, 0x4612211, 0x4613111, 0x4621112, 0x4621121, 0x4621211, 0x4622111, 0x4631111,
+	0x5111126, 0x5111135, 0x5111144, 0x5111153, 0x5111162, 0x5111216, 0x5111225, 0x5111234,
+	0x5111243, 0x5111252, 0x5111261, 0x5111315, 0x5111324, 0x5111333, 0x5111342, 0x5111351,
+	0x5111414, 0x5111423, 0x5111432, 0x5111441, 0x5111513, 0x5111522, 0x5111531, 0x5111612,
+	0x5111621, 0x5112116, 0x5112125, 0x5112134, 0x5112143, 0x5112152, 0x5112161, 0x5112215,
+	0x5112224, 0x5112233, 0x5112242, 0x5112251, 0x5112314, 0x5112323, 0x5112332, 0x5112341,
+	0x5112413, 0x5112422, 0x5112431, 0x5112512, 0x5112521, 0x5112611, 0x5113115, 0x5113124,
+	0x5113133, 0x5113142, 0x5113151, 0x5113214, 0x5113223, 0x5113232, 0x5113241, 0x5113313,
+	0x5113322, 0x5113331, 0x5113412, 0x5113421, 0x5113511, 0x5114114, 0x5114123, 0x5114132,
+	0x5114141, 0x5114213, 0x5114222, 0x5114231, 0x5114312, 0x5114321, 0x5114411, 0x5115113,
+	0x5115122, 0x5115131, 0x5115212, 0x5115221, 0x5115311, 0x5116112, 0x5116121, 0x5116211,
+	0x5121116, 0x5121125, 0x5121134, 0x5121143, 0x5121152, 0x5121161, 0x5121215, 0x5121224,
+	0x5121233, 0x5121242, 0x5121251, 0x5121314, 0x5121323, 0x5121332, 0x5121341, 0x5121413,
+	0x5121422, 0x5121431, 0x5121512, 0x5121521, 0x5121611, 0x5122115, 0x5122124, 0x5122133,
+	0x5122142, 0x5122151, 0x5122214, 0x5122223, 0x5122232, 0x5122241, 0x5122313, 0x5122322,
+	0x5122331, 0x5122412, 0x5122421, 0x5122511, 0x5123114, 0x5123123, 0x5123132, 0x5123141,
+	0x5123213, 0x5123222, 0x5123231, 0x5123312, 0x5123321, 0x5123411, 0x5124113, 0x5124122,
+	0x5124131, 0x5124212, 0x5124221, 0x5124311, 0x5125112, 0x5125121, 0x5125211, 0x5126111,
+	0x5131115, 0x5131124, 0x5131133, 0x5131142, 0x5131151, 0x5131214, 0x5131223, 0x5131232,
+	0x5131241, 0x5131313, 0x5131322, 0x5131331, 0x5131412, 0x5131421, 0x5131511, 0x5132114,
+	0x5132123, 0x5132132, 0x5132141, 0x5132213, 0x5132222, 0x5132231, 0x5132312, 0x5132321,
+	0x5132411, 0x5133113, 0x5133122, 0x5133131, 0x5133212, 0x5133221, 0x5133311, 0x5134112,
+	0x5134121, 0x5134211, 0x5135111, 0x5141114, 0x5141123, 0x5141132, 0x5141141, 0x5141213,
+	0x5141222, 0x5141231, 0x5141312, 0x5141321, 0x5141411, 0x5142113, 0x5142122, 0x5142131,
+	0x5142212, 0x5142221, 0x5142311, 0x5143112, 0x5143121, 0x5143211, 0x5144111, 0x5151113,
+	0x5151122, 0x5151131, 0x5151212, 0x5151221, 0x5151311, 0x5152112, 0x5152121, 0x5152211,
+	0x5153111, 0x5161112, 0x5161121, 0x5161211, 0x5162111, 0x5211116, 0x5211125, 0x5211134,
+	0x5211143, 0x5211152, 0x5211161, 0x5211215, 0x5211224, 0x5211233, 0x5211242, 0x5211251,
+	0x5211314, 0x5211323, 0x5211332, 0x5211341, 0x5211413, 0x5211422, 0x5211431, 0x5211512,
+	0x5211521, 0x5211611, 0x5212115, 0x5212124, 0x5212133, 0x5212142, 0x5212151, 0x5212214,
+	0x5212223, 0x5212232, 0x5212241, 0x5212313, 0x5212322, 0x5212331, 0x5212412, 0x5212421,
+	0x5212511, 0x5213114, 0x5213123, 0x5213132, 0x5213141, 0x5213213, 0x5213222, 0x5213231,
+	0x5213312, 0x5213321, 0x5213411, 0x5214113, 0x5214122, 0x5214131, 0x5214212, 0x5214221,
+	0x5214311, 0x5215112, 0x5215121, 0x5215211, 0x5216111, 0x5221115, 0x5221124, 0x5221133,
+	0x5221142, 0x5221151, 0x5221214, 0x5221223, 0x5221232, 0x5221241, 0x5221313, 0x5221322,
+	0x5221331, 0x5221412, 0x5221421, 0x5221511, 0x5222114, 0x5222123, 0x5222132, 0x5222141,
+	0x5222213, 0x5222231, 0x5222312, 0x5222321, 0x5222411, 0x5223113, 0x5223122, 0x5223131,
+	0x5223212, 0x5223221, 0x5223311, 0x5224112, 0x5224121, 0x5224211, 0x5225111, 0x5231114,
+	0x5231123, 0x5231132, 0x5231141, 0x5231213, 0x5231222, 0x5231231, 0x5231312, 0x5231321,
+	0x5231411, 0x5232113, 0x5232122, 0x5232131, 0x5232212, 0x5232221, 0x5232311, 0x5233112,
+	0x5233121, 0x5233211, 0x5234111, 0x5241113, 0x5241122, 0x5241131, 0x5241212, 0x5241221,
+	0x5241311, 0x5242112, 0x5242121, 0x5242211, 0x5243111, 0x5251112, 0x5251121, 0x5251211,
+	0x5252111, 0x5261111, 0x5311115, 0x5311124, 0x5311133, 0x5311142, 0x5311151, 0x5311214,
+	0x5311223, 0x5311232, 0x5311241, 0x5311313, 0x5311322, 0x5311331, 0x5311412, 0x5311421,
+	0x5311511, 0x5312114, 0x5312123, 0x5312132, 0x5312141, 0x5312213, 0x5312222, 0x5312231,
+	0x5312312, 0x5312321, 0x5312411, 0x5313113, 0x5313122, 0x5313131, 0x5313212, 0x5313221,
+	0x5313311, 0x5314112, 0x5314121, 0x5314211, 0x5315111, 0x5321114, 0x5321123, 0x5321132,
+	0x5321141, 0x5321213, 0x5321222, 0x5321231, 0x5321312, 0x5321321, 0x5321411, 0x5322113,
+	0x5322122, 0x5322131, 0x5322212, 0x5322221, 0x5322311, 0x5323112, 0x5323121, 0x5323211,
+	0x5324111, 0x5331113, 0x5331122, 0x5331131, 0x5331212, 0x5331221, 0x5331311, 0x5332112,
+	0x5332121, 0x5332211, 0x5333111, 0x5341112, 0x5341121, 0x5341211, 0x5342111, 0x5351111,
+	0x5411114, 0x5411123, 0x5411132, 0x5411141, 0x5411213, 0x5411222, 0x5411231, 0x5411312,
+	0x5411321, 0x5411411, 0x5412113, 0x5412122, 0x5412131, 0x5412212, 0x5412221, 0x5412311,
+	0x5413112, 0x5413121, 0x5413211, 0x5414111, 0x5421113, 0x5421122, 0x5421131, 0x5421212,
+	0x5421221, 0x5421311, 0x5422112, 0x5422121, 0x5422211, 0x5423111, 0x5431112, 0x5431121,
+	0x5431211, 0x5432111, 0x5441111, 0x5511113, 0x5511122, 0x5511131, 0x5511212, 0x5511221,
+	0x5511311, 0x5512112, 0x5512121, 0x5512211, 0x5513111, 0x5521112, 0x5521121, 0x5521211,
+	0x5522111, 0x5531111, 0x5611112, 0x5611121, 0x5611211, 0x5612111, 0x5621111, 0x6111116,
+	0x6111125, 0x6111134, 0x6111143, 0x6111152, 0x6111161, 0x6111215, 0x6111224, 0x6111233,
+	0x6111242, 0x6111251, 0x6111314, 0x6111323, 0x6111332, 0x6111341, 0x6111413, 0x6111422,
+	0x6111431, 0x6111512, 0x6111521, 0x6111611, 0x6112115, 0x6112124, 0x6112133, 0x6112142,
+	0x6112151, 0x6112214, 0x6112223, 0x6112232, 0x6112241, 0x6112313, 0x6112322, 0x6112331,
+	0x6112412, 0x6112421, 0x6112511, 0x6113114, 0x6113123, 0x6113132, 0x6113141, 0x6113213,
+	0x6113222, 0x6113231, 0x6113312, 0x6113321, 0x6113411, 0x6114113, 0x6114122, 0x6114131,
+	0x6114212, 0x6114221, 0x6114311, 0x6115112, 0x6115121, 0x6115211, 0x6116111, 0x6121115,
+	0x6121124, 0x6121133, 0x6121142, 0x6121151, 0x6121214, 0x6121223, 0x6121232, 0x6121241,
+	0x6121313, 0x6121322, 0x6121331, 0x6121412, 0x6121421, 0x6121511, 0x6122114, 0x6122123,
+	0x6122132, 0x6122141, 0x6122213, 0x6122222, 0x6122231, 0x6122312, 0x6122321, 0x6122411,
+	0x6123113, 0x6123122, 0x6123131, 0x6123212, 0x6123221, 0x6123311, 0x6124112, 0x6124121,
+	0x6124211, 0x6125111, 0x6131114, 0x6131123, 0x6131132, 0x6131141, 0x6131213, 0x6131222,
+	0x6131231, 0x6131312, 0x6131321, 0x6131411, 0x6132113, 0x6132122, 0x6132131, 0x6132212,
+	0x6132221, 0x6132311, 0x6133112, 0x6133121, 0x6133211, 0x6134111, 0x6141113, 0x6141122,
+	0x6141131, 0x6141212, 0x6141221, 0x6141311, 0x6142112, 0x6142121, 0x6142211, 0x6143111,
+	0x6151112, 0x6151121, 0x6151211, 0x6152111, 0x6161111, 0x6211115, 0x6211124, 0x6211133,
+	0x6211142, 0x6211151, 0x6211214, 0x6211223, 0x6211232, 0x6211241, 0x6211313, 0x6211322,
+	0x6211331, 0x6211412, 0x6211421, 0x6211511, 0x6212114, 0x6212123, 0x6212132, 0x6212141,
+	0x6212213, 0x6212222, 0x6212231, 0x6212312, 0x6212321, 0x6212411, 0x6213113, 0x6213122,
+	0x6213131, 0x6213212, 0x6213221, 0x6213311, 0x6214112, 0x6214121, 0x6214211, 0x6215111,
+	0x6221114, 0x6221123, 0x6221132, 0x6221141, 0x6221213, 0x6221222, 0x6221231, 0x6221312,
+	0x6221321, 0x6221411, 0x6222113, 0x6222122, 0x6222131, 0x6222212, 0x6222221, 0x6222311,
+	0x6223112, 0x6223121, 0x6223211, 0x6224111, 0x6231113, 0x6231122, 0x6231131, 0x6231212,
+	0x6231221, 0x6231311, 0x6232112, 0x6232121, 0x6232211, 0x6233111, 0x6241112, 0x6241121,
+	0x6241211, 0x6242111, 0x6251111, 0x6311114, 0x6311123, 0x6311132, 0x6311141, 0x6311213,
+	0x6311222, 0x6311231, 0x6311312, 0x6311321, 0x6311411, 0x6312113, 0x6312122, 0x6312131,
+	0x6312212, 0x6312221, 0x6312311, 0x6313112, 0x6313121, 0x6313211, 0x6314111, 0x6321113,
+	0x6321122, 0x6321131, 0x6321212, 0x6321221, 0x6321311, 0x6322112, 0x6322121, 0x6322211,
+	0x6323111, 0x6331112, 0x6331121, 0x6331211, 0x6332111, 0x6341111, 0x6411113, 0x6411122,
+	0x6411131, 0x6411212, 0x6411221, 0x6411311, 0x6412112, 0x6412121, 0x6412211, 0x6413111,
+	0x6421112, 0x6421121, 0x6421211, 0x6422111, 0x6431111, 0x6511112, 0x6511121, 0x6511211,
+	0x6512111, 0x6521111, 0x6611111, 0x1111155, 0x1111245, 0x1111254, 0x1111335, 0x1111344,
+	0x1111353, 0x1111425, 0x1111434, 0x1111443, 0x1111452, 0x1111515, 0x1111524, 0x1111533,
+	0x1111542, 0x1111551, 0x1112145, 0x1112154, 0x1112235, 0x1112244, 0x1112253, 0x1112325,
+	0x1112334, 0x1112343, 0x1112352, 0x1112415, 0x1112424, 0x1112433, 0x1112442, 0x1112451,
+	0x1112514, 0x1112523, 0x1112532, 0x1112541, 0x1113135, 0x1113144, 0x1113153, 0x1113225,
+	0x1113234, 0x1113243, 0x1113252, 0x1113315, 0x1113324, 0x1113333, 0x1113342, 0x1113351,
+	0x1113414, 0x1113423, 0x1113432, 0x1113441, 0x1113513, 0x1113522, 0x1113531, 0x1114125,
+	0x1114134, 0x1114143, 0x1114152, 0x1114215, 0x1114224, 0x1114233, 0x1114242, 0x1114251,
+	0x1114314, 0x1114323, 0x1114332, 0x1114341, 0x1114413, 0x1114422, 0x1114431, 0x1114512,
+	0x1114521, 0x1115115, 0x1115124, 0x1115133, 0x1115142, 0x1115151, 0x1115214, 0x1115223,
+	0x1115232, 0x1115241, 0x1115313, 0x1115322, 0x1115331, 0x1115412, 0x1115421, 0x1115511,
+	0x1121145, 0x1121154, 0x1121235, 0x1121244, 0x1121253, 0x1121325, 0x1121334, 0x1121343,
+	0x1121352, 0x1121415, 0x1121424, 0x1121433, 0x1121442, 0x1121451, 0x1121514, 0x1121523,
+	0x1121532, 0x1121541, 0x1122135, 0x1122144, 0x1122153, 0x1122225, 0x1122234, 0x1122243,
+	0x1122252, 0x1122315, 0x1122324, 0x1122333, 0x1122342, 0x1122351, 0x1122414, 0x1122423,
+	0x1122432, 0x1122441, 0x1122513, 0x1122522, 0x1122531, 0x1123125, 0x1123134, 0x1123143,
+	0x1123152, 0x1123215, 0x1123224, 0x1123233, 0x1123242, 0x1123251, 0x1123314, 0x1123323,
+	0x1123332, 0x1123341, 0x1123413, 0x1123422, 0x1123431, 0x1123512, 0x1123521, 0x1124115,
+	0x1124124, 0x1124133, 0x1124142, 0x1124151, 0x1124214, 0x1124223, 0x1124232, 0x1124241,
+	0x1124313, 0x1124322, 0x1124331, 0x1124412, 0x1124421, 0x1124511, 0x1125114, 0x1125123,
+	0x1125132, 0x1125141, 0x1125213, 0x1125222, 0x1125231, 0x1125312, 0x1125321, 0x1125411,
+	0x1131135, 0x1131144, 0x1131153, 0x1131225, 0x1131234, 0x1131243, 0x1131252, 0x1131315,
+	0x1131324, 0x1131333, 0x1131342, 0x1131351, 0x1131414, 0x1131423, 0x1131432, 0x1131441,
+	0x1131513, 0x1131522, 0x1131531, 0x1132125, 0x1132134, 0x1132143, 0x1132152, 0x1132215,
+	0x1132224, 0x1132233, 0x1132242, 0x1132251, 0x1132314, 0x1132323, 0x1132332, 0x1132341,
+	0x1132413, 0x1132422, 0x1132431, 0x1132512, 0x1132521, 0x1133115, 0x1133124, 0x1133133,
+	0x1133142, 0x1133151, 0x1133214, 0x1133223, 0x1133232, 0x1133241, 0x1133313, 0x1133322,
+	0x1133331, 0x1133412, 0x1133421, 0x1133511, 0x1134114, 0x1134123, 0x1134132, 0x1134141,
+	0x1134213, 0x1134222, 0x1134231, 0x1134312, 0x1134321, 0x1134411, 0x1135113, 0x1135122,
+	0x1135131, 0x1135212, 0x1135221, 0x1135311, 0x1141125, 0x1141134, 0x1141143, 0x1141152,
+	0x1141215, 0x1141224, 0x1141233, 0x1141242, 0x1141251, 0x1141314, 0x1141323, 0x1141332,
+	0x1141341, 0x1141413, 0x1141422, 0x1141431, 0x1141512, 0x1141521, 0x1142115, 0x1142124,
+	0x1142133, 0x1142142, 0x1142151, 0x1142214, 0x1142223, 0x1142232, 0x1142241, 0x1142313,
+	0x1142322, 0x1142331, 0x1142412, 0x1142421, 0x1142511, 0x1143114, 0x1143123, 0x1143132,
+	0x1143141, 0x1143213, 0x1143222, 0x1143231, 0x1143312, 0x1143321, 0x1143411, 0x1144113,
+	0x1144122, 0x1144131, 0x1144212, 0x1144221, 0x1144311, 0x1145112, 0x1145121, 0x1145211,
+	0x1151115, 0x1151124, 0x1151133, 0x1151142, 0x1151151, 0x1151214, 0x1151223, 0x1151232,
+	0x1151241, 0x1151313, 0x1151322, 0x1151331, 0x1151412, 0x1151421, 0x1151511, 0x1152114,
+	0x1152123, 0x1152132, 0x1152141, 0x1152213, 0x1152222, 0x1152231, 0x1152312, 0x1152321,
+	0x1152411, 0x1153113, 0x1153122, 0x1153131, 0x1153212, 0x1153221, 0x1153311, 0x1154112,
+	0x1154121, 0x1154211, 0x1155111, 0x1211145, 0x1211154, 0x1211235, 0x1211244, 0x1211253,
+	0x1211325, 0x1211334, 0x1211343, 0x1211352, 0x1211415, 0x1211424, 0x1211433, 0x1211442,
+	0x1211451, 0x1211514, 0x1211523, 0x1211532, 0x1211541, 0x1212135, 0x1212144, 0x1212153,
+	0x1212225, 0x1212234, 0x1212243, 0x1212252, 0x1212315, 0x1212324, 0x1212333, 0x1212342,
+	0x1212351, 0x1212414, 0x1212423, 0x1212432, 0x1212441, 0x1212513, 0x1212522, 0x1212531,
+	0x1213125, 0x1213134, 0x1213143, 0x1213152, 0x1213215, 0x1213224, 0x1213233, 0x1213242,
+	0x1213251, 0x1213314, 0x1213323, 0x1213332, 0x1213341, 0x1213413, 0x1213422, 0x1213431,
+	0x1213512, 0x1213521, 0x1214115, 0x1214124, 0x1214133, 0x1214142, 0x1214151, 0x1214214,
+	0x1214223, 0x1214232, 0x1214241, 0x1214313, 0x1214322, 0x1214331, 0x1214412, 0x1214421,
+	0x1214511, 0x1215114, 0x1215123, 0x1215132, 0x1215141, 0x1215213, 0x1215222, 0x1215231,
+	0x1215312, 0x1215321, 0x1215411, 0x1221135, 0x1221144, 0x1221153, 0x1221225, 0x1221234,
+	0x1221243, 0x1221252, 0x1221315, 0x1221324, 0x1221333, 0x1221342, 0x1221351, 0x1221414,
+	0x1221423, 0x1221432, 0x1221441, 0x1221513, 0x1221522, 0x1221531, 0x1222125, 0x1222134,
+	0x1222143, 0x1222152, 0x1222215, 0x1222224, 0x1222233, 0x1222242, 0x1222251, 0x1222314,
+	0x1222323, 0x1222332, 0x1222341, 0x1222413, 0x1222422, 0x1222431, 0x1222512, 0x1222521,
+	0x1223115, 0x1223124, 0x1223133, 0x1223142, 0x1223151, 0x1223214, 0x1223223, 0x1223232,
+	0x1223241, 0x1223313, 0x1223322, 0x1223331, 0x1223412, 0x1223421, 0x1223511, 0x1224114,
+	0x1224123, 0x1224132, 0x1224141, 0x1224213, 0x1224222, 0x1224231, 0x1224312, 0x1224321,
+	0x1224411, 0x1225113, 0x1225122, 0x1225131, 0x1225212, 0x1225221, 0x1225311, 0x1231125,
+	0x1231134, 0x1231143, 0x1231152, 0x1231215, 0x1231224, 0x1231233, 0x1231242, 0x1231251,
+	0x1231314, 0x1231323, 0x1231332, 0x1231341, 0x1231413, 0x1231422, 0x1231431, 0x1231512,
+	0x1231521, 0x1232115, 0x1232124, 0x1232133, 0x1232142, 0x1232151, 0x1232214, 0x1232223,
+	0x1232232, 0x1232241, 0x1232313, 0x1232322, 0x1232331, 0x1232412, 0x1232421, 0x1232511,
+	0x1233114, 0x1233123, 0x1233132, 0x1233141, 0x1233213, 0x1233222, 0x1233231, 0x1233312,
+	0x1233321, 0x1233411, 0x1234113, 0x1234122, 0x1234131, 0x1234212, 0x1234221, 0x1234311,
+	0x1235112, 0x1235121, 0x1235211, 0x1241115, 0x1241124, 0x1241133, 0x1241142, 0x1241151,
+	0x1241214, 0x1241223, 0x1241232, 0x1241241, 0x1241313, 0x1241322, 0x1241331, 0x1241412,
+	0x1241421, 0x1241511, 0x1242114, 0x1242123, 0x1242132, 0x1242141, 0x1242213, 0x1242222,
+	0x1242231, 0x1242312, 0x1242321, 0x1242411, 0x1243113, 0x1243122, 0x1243131, 0x1243212,
+	0x1243221, 0x1243311, 0x1244112, 0x1244121, 0x1244211, 0x1245111, 0x1251114, 0x1251123,
+	0x1251132, 0x1251141, 0x1251213, 0x1251222, 0x1251231, 0x1251312, 0x1251321, 0x1251411,
+	0x1252113, 0x1252122, 0x1252131, 0x1252212, 0x1252221, 0x1252311, 0x1253112, 0x1253121,
+	0x1253211, 0x1254111, 0x1311135, 0x1311144, 0x1311153, 0x1311225, 0x1311234, 0x1311243,
+	0x1311252, 0x1311315, 0x1311324, 0x1311333, 0x1311342, 0x1311351, 0x1311414, 0x1311423,
+	0x1311432, 0x1311441, 0x1311513, 0x1311522, 0x1311531, 0x1312125, 0x1312134, 0x1312143,
+	0x1312152, 0x1312215, 0x1312224, 0x1312233, 0x1312242, 0x1312251, 0x1312314, 0x1312323,
+	0x1312332, 0x1312341, 0x1312413, 0x1312422, 0x1312431, 0x1312512, 0x1312521, 0x1313115,
+	0x1313124, 0x1313133, 0x1313142, 0x1313151, 0x1313214, 0x1313223, 0x1313232, 0x1313241,
+	0x1313313, 0x1313322, 0x1313331, 0x1313412, 0x1313421, 0x1313511, 0x1314114, 0x1314123,
+	0x1314132, 0x1314141, 0x1314213, 0x1314222, 0x1314231, 0x1314312, 0x1314321, 0x1314411,
+	0x1315113, 0x1315122, 0x1315131, 0x1315212, 0x1315221, 0x1315311, 0x1321125, 0x1321134,
+	0x1321143, 0x1321152, 0x1321215, 0x1321224, 0x1321233, 0x1321242, 0x1321251, 0x1321314,
+	0x1321323, 0x1321332, 0x1321341, 0x1321413, 0x1321422, 0x1321431, 0x1321512, 0x1321521,
+	0x1322115, 0x1322124, 0x1322133, 0x1322142, 0x1322151, 0x1322214, 0x1322223, 0x1322232,
+	0x1322241, 0x1322313, 0x1322322, 0x1322331, 0x1322412, 0x1322421, 0x1322511, 0x1323114,
+	0x1323123, 0x1323132, 0x1323141, 0x1323213, 0x1323222, 0x1323231, 0x1323312, 0x1323321,
+	0x1323411, 0x1324113, 0x1324122, 0x1324131, 0x1324212, 0x1324221, 0x1324311, 0x1325112,
+	0x1325121, 0x1325211, 0x1331115, 0x1331124, 0x1331133, 0x1331142, 0x1331151, 0x1331214,
+	0x1331223, 0x1331232, 0x1331241, 0x1331313, 0x1331322, 0x1331331, 0x1331412, 0x1331421,
+	0x1331511, 0x1332114, 0x1332123, 0x1332132, 0x1332141, 0x1332213, 0x1332222, 0x1332231,
+	0x1332312, 0x1332321, 0x1332411, 0x1333113, 0x1333122, 0x1333131, 0x1333212, 0x1333221,
+	0x1333311, 0x1334112, 0x1334121, 0x1334211, 0x1335111, 0x1341114, 0x1341123, 0x1341132,
+	0x1341141, 0x1341213, 0x1341222, 0x1341231, 0x1341312, 0x1341321, 0x1341411, 0x1342113,
+	0x1342122, 0x1342131, 0x1342212, 0x1342221, 0x1342311, 0x1343112, 0x1343121, 0x1343211,
+	0x1344111, 0x1351113, 0x1351122, 0x1351131, 0x1351212, 0x1351221, 0x1351311, 0x1352112,
+	0x1352121, 0x1352211, 0x1353111, 0x1411125, 0x1411134, 0x1411143, 0x1411152, 0x1411215,
+	0x1411224, 0x1411233, 0x1411242, 0x1411251, 0x1411314, 0x1411323, 0x1411332, 0x1411341,
+	0x1411413, 0x1411422, 0x1411431, 0x1411512, 0x1411521, 0x1412115, 0x1412124, 0x1412133,
+	0x1412142, 0x1412151, 0x1412214, 0x1412223, 0x1412232, 0x1412241, 0x1412313, 0x1412322,
+	0x1412331, 0x1412412, 0x1412421, 0x1412511, 0x1413114, 0x1413123, 0x1413132, 0x1413141,
+	0x1413213, 0x1413222, 0x1413231, 0x1413312, 0x1413321, 0x1413411, 0x1414113, 0x1414122,
+	0x1414131, 0x1414212, 0x1414221, 0x1414311, 0x1415112, 0x1415121, 0x1415211, 0x1421115,
+	0x1421124, 0x1421133, 0x1421142, 0x1421151, 0x1421214, 0x1421223, 0x1421232, 0x1421241,
+	0x1421313, 0x1421322, 0x1421331, 0x1421412, 0x1421421, 0x1421511, 0x1422114, 0x1422123,
+	0x1422132, 0x1422141, 0x1422213, 0x1422222, 0x1422231, 0x1422312, 0x1422321, 0x1422411,
+	0x1423113, 0x1423122, 0x1423131, 0x1423212, 0x1423221, 0x1423311, 0x1424112, 0x1424121,
+	0x1424211, 0x1425111, 0x1431114, 0x1431123, 0x1431132, 0x1431141, 0x1431213, 0x1431222,
+	0x1431231, 0x1431312, 0x1431321, 0x1431411, 0x1432113, 0x1432122, 0x1432131, 0x1432212,
+	0x1432221, 0x1432311, 0x1433112, 0x1433121, 0x1433211, 0x1434111, 0x1441113, 0x1441122,
+	0x1441131, 0x1441212, 0x1441221, 0x1441311, 0x1442112, 0x1442121, 0x1442211, 0x1443111,
+	0x1451112, 0x1451121, 0x1451211, 0x1452111, 0x1511115, 0x1511124, 0x1511133, 0x1511142,
+	0x1511151, 0x1511214, 0x1511223, 0x1511232, 0x1511241, 0x1511313, 0x1511322, 0x1511331,
+	0x1511412, 0x1511421, 0x1511511, 0x1512114, 0x1512123, 0x1512132, 0x1512141, 0x1512213,
+	0x1512222, 0x1512231, 0x1512312, 0x1512321, 0x1512411, 0x1513113, 0x1513122, 0x1513131,
+	0x1513212, 0x1513221, 0x1513311, 0x1514112, 0x1514121, 0x1514211, 0x1515111, 0x1521114,
+	0x1521123, 0x1521132, 0x1521141, 0x1521213, 0x1521222, 0x1521231, 0x1521312, 0x1521321,
+	0x1521411, 0x1522113, 0x1522122, 0x1522131, 0x1522212, 0x1522221, 0x1522311, 0x1523112,
+	0x1523121, 0x1523211, 0x1524111, 0x1531113, 0x1531122, 0x1531131, 0x1531212, 0x1531221,
+	0x1531311, 0x1532112, 0x1532121, 0x1532211, 0x1533111, 0x1541112, 0x1541121, 0x1541211,
+	0x1542111, 0x1551111, 0x2111145, 0x2111154, 0x2111235, 0x2111244, 0x2111253, 0x2111325,
+	0x2111334, 0x2111343, 0x2111352, 0x2111415, 0x2111424, 0x2111433, 0x2111442, 0x2111451,
+	0x2111514, 0x2111523, 0x2111532, 0x2111541, 0x2112135, 0x2112144, 0x2112153, 0x2112225,
+	0x2112234, 0x2112243, 0x2112252, 0x2112315, 0x2112324, 0x2112333, 0x2112342, 0x2112351,
+	0x2112414, 0x2112423, 0x2112432, 0x2112441, 0x2112513, 0x2112522, 0x2112531, 0x2113125,
+	0x2113134, 0x2113143, 0x2113152, 0x2113215, 0x2113224, 0x2113233, 0x2113242, 0x2113251,
+	0x2113314, 0x2113323, 0x2113332, 0x2113341, 0x2113413, 0x2113422, 0x2113431, 0x2113512,
+	0x2113521, 0x2114115, 0x2114124, 0x2114133, 0x2114142, 0x2114151, 0x2114214, 0x2114223,
+	0x2114232, 0x2114241, 0x2114313, 0x2114322, 0x2114331, 0x2114412, 0x2114421, 0x2114511,
+	0x2115114, 0x2115123, 0x2115132, 0x2115141, 0x2115213, 0x2115222, 0x2115231, 0x2115312,
+	0x2115321, 0x2115411, 0x2121135, 0x2121144, 0x2121153, 0x2121225, 0x2121234, 0x2121243,
+	0x2121252, 0x2121315, 0x2121324, 0x2121333, 0x2121342, 0x2121351, 0x2121414, 0x2121423,
+	0x2121432, 0x2121441, 0x2121513, 0x2121522, 0x2121531, 0x2122125, 0x2122134, 0x2122143,
+	0x2122152, 0x2122215, 0x2122224, 0x2122233, 0x2122242, 0x2122251, 0x2122314, 0x2122323,
+	0x2122332, 0x2122341, 0x2122413, 0x2122422, 0x2122431, 0x2122512, 0x2122521, 0x2123115,
+	0x2123124, 0x2123133, 0x2123142, 0x2123151, 0x2123214, 0x2123223, 0x2123232, 0x2123241,
+	0x2123313, 0x2123322, 0x2123331, 0x2123412, 0x2123421, 0x2123511, 0x2124114, 0x2124123,
+	0x2124132, 0x2124141, 0x2124213, 0x2124222, 0x2124231, 0x2124312, 0x2124321, 0x2124411,
+	0x2125113, 0x2125122, 0x2125131, 0x2125212, 0x2125221, 0x2125311, 0x2131125, 0x2131134,
+	0x2131143, 0x2131152, 0x2131215, 0x2131224, 0x2131233, 0x2131242, 0x2131251, 0x2131314,
+	0x2131323, 0x2131332, 0x2131341, 0x2131413, 0x2131422, 0x2131431, 0x2131512, 0x2131521,
+	0x2132115, 0x2132124, 0x2132133, 0x2132142, 0x2132151, 0x2132214, 0x2132223, 0x2132232,
+	0x2132241, 0x2132313, 0x2132322, 0x2132331, 0x2132412, 0x2132421, 0x2132511, 0x2133114,
+	0x2133123, 0x2133132, 0x2133141, 0x2133213, 0x2133222, 0x2133231, 0x2133312, 0x2133321,
+	0x2133411, 0x2134113, 0x2134122, 0x2134131, 0x2134212, 0x2134221, 0x2134311, 0x2135112,
+	0x2135121, 0x2135211, 0x2141115, 0x2141124, 0x2141133, 0x2141142, 0x2141151, 0x2141214,
+	0x2141223, 0x2141232, 0x2141241, 0x2141313, 0x2141322, 0x2141331, 0x2141412, 0x2141421,
+	0x2141511, 0x2142114, 0x2142123, 0x2142132, 0x2142141, 0x2142213, 0x2142222, 0x2142231,
+	0x2142312, 0x2142321, 0x2142411, 0x2143113, 0x2143122, 0x2143131, 0x2143212, 0x2143221,
+	0x2143311, 0x2144112, 0x2144121, 0x2144211, 0x2145111, 0x2151114, 0x2151123, 0x2151132,
+	0x2151141, 0x2151213, 0x2151222, 0x2151231, 0x2151312, 0x2151321, 0x2151411, 0x2152113,
+	0x2152122, 0x2152131, 0x2152212, 0x2152221, 0x2152311, 0x2153112, 0x2153121, 0x2153211,
+	0x2154111, 0x2211135, 0x2211144, 0x2211153, 0x2211225, 0x2211234, 0x2211243, 0x2211252,
+	0x2211315, 0x2211324, 0x2211333, 0x2211342, 0x2211351, 0x2211414, 0x2211423, 0x2211432,
+	0x2211441, 0x2211513, 0x2211522, 0x2211531, 0x2212125, 0x2212134, 0x2212143, 0x2212152,
+	0x2212215, 0x2212224, 0x2212233, 0x2212242, 0x2212251, 0x2212314, 0x2212323, 0x2212332,
+	0x2212341, 0x2212413, 0x2212422, 0x2212431, 0x2212512, 0x2212521, 0x2213115, 0x2213124,
+	0x2213133, 0x2213142, 0x2213151, 0x2213214, 0x2213223, 0x2213232, 0x2213241, 0x2213313,
+	0x2213322, 0x2213331, 0x2213412, 0x2213421, 0x2213511, 0x2214114, 0x2214123, 0x2214132,
+	0x2214141, 0x2214213, 0x2214222, 0x2214231, 0x2214312, 0x2214321, 0x2214411, 0x2215113,
+	0x2215122, 0x2215131, 0x2215212, 0x2215221, 0x2215311, 0x2221125, 0x2221134, 0x2221143,
+	0x2221152, 0x2221215, 0x2221224, 0x2221233, 0x2221242, 0x2221251, 0x2221314, 0x2221323,
+	0x2221332, 0x2221341, 0x2221413, 0x2221422, 0x2221431, 0x2221512, 0x2221521, 0x2222115,
+	0x2222124, 0x2222133, 0x2222142, 0x2222151, 0x2222214, 0x2222223, 0x2222232, 0x2222241,
+	0x2222313, 0x2222322, 0x2222331, 0x2222412, 0x2222421, 0x2222511, 0x2223114, 0x2223123,
+	0x2223132, 0x2223141, 0x2223213, 0x2223222, 0x2223231, 0x2223312, 0x2223321, 0x2223411,
+	0x2224113, 0x2224122, 0x2224131, 0x2224212, 0x2224221, 0x2224311, 0x2225112, 0x2225121,
+	0x2225211, 0x2231115, 0x2231124, 0x2231133, 0x2231142, 0x2231151, 0x2231214, 0x2231223,
+	0x2231232, 0x2231241, 0x2231313, 0x2231322, 0x2231331, 0x2231412, 0x2231421, 0x2231511,
+	0x2232114, 0x2232123, 0x2232132, 0x2232141, 0x2232213, 0x2232222, 0x2232231, 0x2232312,
+	0x2232321, 0x2232411, 0x2233113, 0x2233122, 0x2233131, 0x2233212, 0x2233221, 0x2233311,
+	0x2234112, 0x2234121, 0x2234211, 0x2235111, 0x2241114, 0x2241123, 0x2241132, 0x2241141,
+	0x2241213, 0x2241222, 0x2241231, 0x2241312, 0x2241321, 0x2241411, 0x2242113, 0x2242122,
+	0x2242131, 0x2242212, 0x2242221, 0x2242311, 0x2243112, 0x2243121, 0x2243211, 0x2244111,
+	0x2251113, 0x2251122, 0x2251131, 0x2251212, 0x2251221, 0x2251311, 0x2252112, 0x2252121,
+	0x2252211, 0x2253111, 0x2311125, 0x2311134, 0x2311143, 0x2311152, 0x2311215, 0x2311224,
+	0x2311233, 0x2311242, 0x2311251, 0x2311314, 0x2311323, 0x2311332, 0x2311341, 0x2311413,
+	0x2311422, 0x2311431, 0x2311512, 0x2311521, 0x2312115, 0x2312124, 0x2312133, 0x2312142,
+	0x2312151, 0x2312214, 0x2312223, 0x2312232, 0x2312241, 0x2312313, 0x2312322, 0x2312331,
+	0x2312412, 0x2312421, 0x2312511, 0x2313114, 0x2313123, 0x2313132, 0x2313141, 0x2313213,
+	0x2313222, 0x2313231, 0x2313312, 0x2313321, 0x2313411, 0x2314113, 0x2314122, 0x2314131,
+	0x2314212, 0x2314221, 0x2314311, 0x2315112, 0x2315121, 0x2315211, 0x2321115, 0x2321124,
+	0x2321133, 0x2321142, 0x2321151, 0x2321214, 0x2321223, 0x2321232, 0x2321241, 0x2321313,
+	0x2321322, 0x2321331, 0x2321412, 0x2321421, 0x2321511, 0x2322114, 0x2322123, 0x2322132,
+	0x2322141, 0x2322213, 0x2322222, 0x2322231, 0x2322312, 0x2322321, 0x2322411, 0x2323113,
+	0x2323122, 0x2323131, 0x2323212, 0x2323221, 0x2323311, 0x2324112, 0x2324121, 0x2324211,
+	0x2325111, 0x2331114, 0x2331123, 0x2331132, 0x2331141, 0x2331213, 0x2331222, 0x2331231,
+	0x2331312, 0x2331321, 0x2331411, 0x2332113, 0x2332122, 0x2332131, 0x2332212, 0x2332221,
+	0x2332311, 0x2333112, 0x2333121, 0x2333211, 0x2334111, 0x2341113, 0x2341122, 0x2341131,
+	0x2341212, 0x2341221, 0x2341311, 0x2342112, 0x2342121, 0x2342211, 0x2343111, 0x2351112,
+	0x2351121, 0x2351211, 0x2352111, 0x2411115, 0x2411124, 0x2411133, 0x2411142, 0x2411151,
+	0x2411214, 0x2411223, 0x2411232, 0x2411241, 0x2411313, 0x2411322, 0x2411331, 0x2411412,
+	0x2411421, 0x2411511, 0x2412114, 0x2412123, 0x2412132, 0x2412141, 0x2412213, 0x2412222,
+	0x2412231, 0x2412312, 0x2412321, 0x2412411, 0x2413113, 0x2413122, 0x2413131, 0x2413212,
+	0x2413221, 0x2413311, 0x2414112, 0x2414121, 0x2414211, 0x2415111, 0x2421114, 0x2421123,
+	0x2421132, 0x2421141, 0x2421213, 0x2421222, 0x2421231, 0x2421312, 0x2421321, 0x2421411,
+	0x2422113, 0x2422122, 0x2422131, 0x2422212, 0x2422221, 0x2422311, 0x2423112, 0x2423121,
+	0x2423211, 0x2424111, 0x2431113, 0x2431122, 0x2431131, 0x2431212, 0x2431221, 0x2431311,
+	0x2432112, 0x2432121, 0x2432211, 0x2433111, 0x2441112, 0x2441121, 0x2441211, 0x2442111,
+	0x2451111, 0x2511114, 0x2511123, 0x2511132, 0x2511141, 0x2511213, 0x2511222, 0x2511231,
+	0x2511312, 0x2511321, 0x2511411, 0x2512113, 0x2512122, 0x2512131, 0x2512212, 0x2512221,
+	0x2512311, 0x2513112, 0x2513121, 0x2513211, 0x2514111, 0x2521113, 0x2521122, 0x2521131,
+	0x2521212, 0x2521221, 0x2521311, 0x2522112, 0x2522121, 0x2522211, 0x2523111, 0x2531112,
+	0x2531121, 0x2531211, 0x2532111, 0x2541111, 0x3111135, 0x3111144, 0x3111153, 0x3111225,
+	0x3111234, 0x3111243, 0x3111252, 0x3111315, 0x3111324, 0x3111333, 0x3111342, 0x3111351,
+	0x3111414, 0x3111423, 0x3111432, 0x3111441, 0x3111513, 0x3111522, 0x3111531, 0x3112125,
+	0x3112134, 0x3112143, 0x3112152, 0x3112215, 0x3112224, 0x3112233, 0x3112242, 0x3112251,
+	0x3112314, 0x3112323, 0x3112332, 0x3112341, 0x3112413, 0x3112422, 0x3112431, 0x3112512,
+	0x3112521, 0x3113115, 0x3113124, 0x3113133, 0x3113142, 0x3113151, 0x3113214, 0x3113223,
+	0x3113232, 0x3113241, 0x3113313, 0x3113322, 0x3113331, 0x3113412, 0x3113421, 0x3113511,
+	0x3114114, 0x3114123, 0x3114132, 0x3114141, 0x3114213, 0x3114222, 0x3114231, 0x3114312,
+	0x3114321, 0x3114411, 0x3115113, 0x3115122, 0x3115131, 0x3115212, 0x3115221, 0x3115311,
+	0x3121125, 0x3121134, 0x3121143, 0x3121152, 0x3121215, 0x3121224, 0x3121233, 0x3121242,
+	0x3121251, 0x3121314, 0x3121323, 0x3121332, 0x3121341, 0x3121413, 0x3121422, 0x3121431,
+	0x3121512, 0x3121521, 0x3122115, 0x3122124, 0x3122133, 0x3122142, 0x3122151, 0x3122214,
+	0x3122223, 0x3122232, 0x3122241, 0x3122313, 0x3122322, 0x3122331, 0x3122412, 0x3122421,
+	0x3122511, 0x3123114, 0x3123123, 0x3123132, 0x3123141, 0x3123213, 0x3123222, 0x3123231,
+	0x3123312, 0x3123321, 0x3123411, 0x3124113, 0x3124122, 0x3124131, 0x3124212, 0x3124221,
+	0x3124311, 0x3125112, 0x3125121, 0x3125211, 0x3131115, 0x3131124, 0x3131133, 0x3131142,
+	0x3131151, 0x3131214, 0x3131223, 0x3131232, 0x3131241, 0x3131313, 0x3131322, 0x3131331,
+	0x3131412, 0x3131421, 0x3131511, 0x3132114, 0x3132123, 0x3132132, 0x3132141, 0x3132213,
+	0x3132222, 0x3132231, 0x3132312, 0x3132321, 0x3132411, 0x3133113, 0x3133122, 0x3133131,
+	0x3133212, 0x3133221, 0x3133311, 0x3134112, 0x3134121, 0x3134211, 0x3135111, 0x3141114,
+	0x3141123, 0x3141132, 0x3141141, 0x3141213, 0x3141222, 0x3141231, 0x3141312, 0x3141321,
+	0x3141411, 0x3142113, 0x3142122, 0x3142131, 0x3142212, 0x3142221, 0x3142311, 0x3143112,
+	0x3143121, 0x3143211, 0x3144111, 0x3151113, 0x3151122, 0x3151131, 0x3151212, 0x3151221,
+	0x3151311, 0x3152112, 0x3152121, 0x3152211, 0x3153111, 0x3211125, 0x3211134, 0x3211143,
+	0x3211152, 0x3211215, 0x3211224, 0x3211233, 0x3211242, 0x3211251, 0x3211314, 0x3211323,
+	0x3211332, 0x3211341, 0x3211413, 0x3211422, 0x3211431, 0x3211512, 0x3211521, 0x3212115,
+	0x3212124, 0x3212133, 0x3212142, 0x3212151, 0x3212214, 0x3212223, 0x3212232, 0x3212241,
+	0x3212313, 0x3212322, 0x3212331, 0x3212412, 0x3212421, 0x3212511, 0x3213114, 0x3213123,
+	0x3213132, 0x3213141, 0x3213213, 0x3213222, 0x3213231, 0x3213312, 0x3213321, 0x3213411,
+	0x3214113, 0x3214122, 0x3214131, 0x3214212, 0x3214221, 0x3214311, 0x3215112, 0x3215121,
+	0x3215211, 0x3221115, 0x3221124, 0x3221133, 0x3221142, 0x3221151, 0x3221214, 0x3221223,
+	0x3221232, 0x3221241, 0x3221313, 0x3221322, 0x3221331, 0x3221412, 0x3221421, 0x3221511,
+	0x3222114, 0x3222123, 0x3222132, 0x3222141, 0x3222213, 0x3222222, 0x3222231, 0x3222312,
+	0x3222321, 0x3222411, 0x3223113, 0x3223122, 0x3223131, 0x3223212, 0x3223221, 0x3223311,
+	0x3224112, 0x3224121, 0x3224211, 0x3225111, 0x3231114, 0x3231123, 0x3231132, 0x3231141,
+	0x3231213, 0x3231222, 0x3231231, 0x3231312, 0x3231321, 0x3231411, 0x3232113, 0x3232122,
+	0x3232131, 0x3232212, 0x3232221, 0x3232311, 0x3233112, 0x3233121, 0x3233211, 0x3234111,
+	0x3241113, 0x3241122, 0x3241131, 0x3241212, 0x3241221, 0x3241311, 0x3242112, 0x3242121,
+	0x3242211, 0x3243111, 0x3251112, 0x3251121, 0x3251211, 0x3252111, 0x3311115, 0x3311124,
+	0x3311133, 0x3311142, 0x3311151, 0x3311214, 0x3311223, 0x3311232, 0x3311241, 0x3311313,
+	0x3311322, 0x3311331, 0x3311412, 0x3311421, 0x3311511, 0x3312114, 0x3312123, 0x3312132,
+	0x3312141, 0x3312213, 0x3312222, 0x3312231, 0x3312312, 0x3312321, 0x3312411, 0x3313113,
+	0x3313122, 0x3313131, 0x3313212, 0x3313221, 0x3313311, 0x3314112, 0x3314121, 0x3314211,
+	0x3315111, 0x3321114, 0x3321123, 0x3321132, 0x3321141, 0x3321213, 0x3321222, 0x3321231,
+	0x3321312, 0x3321321, 0x3321411, 0x3322113, 0x3322122, 0x3322131, 0x3322212, 0x3322221,
+	0x3322311, 0x3323112, 0x3323121, 0x3323211, 0x3324111, 0x3331113, 0x3331122, 0x3331131,
+	0x3331212, 0x3331221, 0x3331311, 0x3332112, 0x3332121, 0x3332211, 0x3333111, 0x3341112,
+	0x3341121, 0x3341211, 0x3342111, 0x3351111, 0x3411114, 0x3411123, 0x3411132, 0x3411141,
+	0x3411213, 0x3411222, 0x3411231, 0x3411312, 0x3411321, 0x3411411, 0x3412113, 0x3412122,
+	0x3412131, 0x3412212, 0x3412221, 0x3412311, 0x3413112, 0x3413121, 0x3413211, 0x3414111,
+	0x3421113, 0x3421122, 0x3421131, 0x3421212, 0x3421221, 0x3421311, 0x3422112, 0x3422121,
+	0x3422211, 0x3423111, 0x3431112, 0x3431121, 0x3431211, 0x3432111, 0x3441111, 0x3511113,
+	0x3511122, 0x3511131, 0x3511212, 0x3511221, 0x3511311, 0x3512112, 0x3512121, 0x3512211,
+	0x3513111, 0x3521112, 0x3521121, 0x3521211, 0x3522111, 0x3531111, 0x4111125, 0x4111134,
+	0x4111143, 0x4111152, 0x4111215, 0x4111224, 0x4111233, 0x4111242, 0x4111251, 0x4111314,
+	0x4111323, 0x4111332, 0x4111341, 0x4111413, 0x4111422, 0x4111431, 0x4111512, 0x4111521,
+	0x4112115, 0x4112124, 0x4112133, 0x4112142, 0x4112151, 0x4112214, 0x4112223, 0x4112232,
+	0x4112241, 0x4112313, 0x4112322, 0x4112331, 0x4112412, 0x4112421, 0x4112511, 0x4113114,
+	0x4113123, 0x4113132, 0x4113141, 0x4113213, 0x4113222, 0x4113231, 0x4113312, 0x4113321,
+	0x4113411, 0x4114113, 0x4114122, 0x4114131, 0x4114212, 0x4114221, 0x4114311, 0x4115112,
+	0x4115121, 0x4115211, 0x4121115, 0x4121124, 0x4121133, 0x4121142, 0x4121151, 0x4121214,
+	0x4121223, 0x4121232, 0x4121241, 0x4121313, 0x4121322, 0x4121331, 0x4121412, 0x4121421,
+	0x4121511, 0x4122114, 0x4122123, 0x4122132, 0x4122141, 0x4122213, 0x4122222, 0x4122231,
+	0x4122312, 0x4122321, 0x4122411, 0x4123113, 0x4123122, 0x4123131, 0x4123212, 0x4123221,
+	0x4123311, 0x4124112, 0x4124121, 0x4124211, 0x4125111, 0x4131114, 0x4131123, 0x4131132,
+	0x4131141, 0x4131213, 0x4131222, 0x4131231, 0x4131312, 0x4131321, 0x4131411, 0x4132113,
+	0x4132122, 0x4132131, 0x4132212, 0x4132221, 0x4132311, 0x4133112, 0x4133121, 0x4133211,
+	0x4134111, 0x4141113, 0x4141122, 0x4141131, 0x4141212, 0x4141221, 0x4141311, 0x4142112,
+	0x4142121, 0x4142211, 0x4143111, 0x4151112, 0x4151121, 0x4151211, 0x4152111, 0x4211115,
+	0x4211124, 0x4211133, 0x4211142, 0x4211151, 0x4211214, 0x4211223, 0x4211232, 0x4211241,
+	0x4211313, 0x4211322, 0x4211331, 0x4211412, 0x4211421, 0x4211511, 0x4212114, 0x4212123,
+	0x4212132, 0x4212141, 0x4212213, 0x4212222, 0x4212231, 0x4212312, 0x4212321, 0x4212411,
+	0x4213113, 0x4213122, 0x4213131, 0x4213212, 0x4213221, 0x4213311, 0x4214112, 0x4214121,
+	0x4214211, 0x4215111, 0x4221114, 0x4221123, 0x4221132, 0x4221141, 0x4221213, 0x4221222,
+	0x4221231, 0x4221312, 0x4221321, 0x4221411, 0x4222113, 0x4222122, 0x4222131, 0x4222212,
+	0x4222221, 0x4222311, 0x4223112, 0x4223121, 0x4223211, 0x4224111, 0x4231113, 0x4231122,
+	0x4231131, 0x4231212, 0x4231221, 0x4231311, 0x4232112, 0x4232121, 0x4232211, 0x4233111,
+	0x4241112, 0x4241121, 0x4241211, 0x4242111, 0x4251111, 0x4311114, 0x4311123, 0x4311132,
+	0x4311141, 0x4311213, 0x4311222, 0x4311231, 0x4311312, 0x4311321, 0x4311411, 0x4312113,
+	0x4312122, 0x4312131, 0x4312212, 0x4312221, 0x4312311, 0x4313112, 0x4313121, 0x4313211,
+	0x4314111, 0x4321113, 0x4321122, 0x4321131, 0x4321212, 0x4321221, 0x4321311, 0x4322112,
+	0x4322121, 0x4322211, 0x4323111, 0x4331112, 0x4331121, 0x4331211, 0x4332111, 0x4341111,
+	0x4411113, 0x4411122, 0x4411131, 0x4411212, 0x4411221, 0x4411311, 0x4412112, 0x4412121,
+	0x4412211, 0x4413111, 0x4421112, 0x4421121, 0x4421211, 0x4422111, 0x4431111, 0x4511112,
+	0x4511121, 0x4511211, 0x4512111, 0x4521111, 0x5111115, 0x5111124, 0x5111133, 0x5111142,
+	0x5111151, 0x5111214, 0x5111223, 0x5111232, 0x5111241, 0x5111313, 0x5111322, 0x5111331,
+	0x5111412, 0x5111421, 0x5111511, 0x5112114, 0x5112123, 0x5112132, 0x5112141, 0x5112213,
+	0x5112222, 0x5112231, 0x5112312, 0x5112321, 0x5112411, 0x5113113, 0x5113122, 0x5113131,
+	0x5113212, 0x5113221, 0x5113311, 0x5114112, 0x5114121, 0x5114211, 0x5115111, 0x5121114,
+	0x5121123, 0x5121132, 0x5121141, 0x5121213, 0x5121222, 0x5121231, 0x5121312, 0x5121321,
+	0x5121411, 0x5122113, 0x5122122, 0x5122131, 0x5122212, 0x5122221, 0x5122311, 0x5123112,
+	0x5123121, 0x5123211, 0x5124111, 0x5131113, 0x5131122, 0x5131131, 0x5131212, 0x5131221,
+	0x5131311, 0x5132112, 0x5132121, 0x5132211, 0x5133111, 0x5141112, 0x5141121, 0x5141211,
+	0x5142111, 0x5151111, 0x5211114, 0x5211123, 0x5211132, 0x5211141, 0x5211213, 0x5211222,
+	0x5211231, 0x5211312, 0x5211321, 0x5211411, 0x5212113, 0x5212122, 0x5212131, 0x5212212,
+	0x5212221, 0x5212311, 0x5213112, 0x5213121, 0x5213211, 0x5214111, 0x5221113, 0x5221122,
+	0x5221131, 0x5221212, 0x5221221, 0x5221311, 0x5222112, 0x5222121, 0x5222211, 0x5223111,
+	0x5231112, 0x5231121, 0x5231211, 0x5232111, 0x5241111, 0x5311113, 0x5311122, 0x5311131,
+	0x5311212, 0x5311221, 0x5311311, 0x5312112, 0x5312121, 0x5312211, 0x5313111, 0x5321112,
+	0x5321121, 0x5321211, 0x5322111, 0x5331111, 0x5411112, 0x5411121, 0x5411211, 0x5412111,
+	0x5421111, 0x5511111, 0x1111124, 0x1111133, 0x1111142, 0x1111214, 0x1111223, 0x1111232,
+	0x1111241, 0x1111313, 0x1111322, 0x1111331, 0x1111412, 0x1111421, 0x1112114, 0x1112123,
+	0x1112132, 0x1112141, 0x1112213, 0x1112222, 0x1112231, 0x1112312, 0x1112321, 0x1112411,
+	0x1113113, 0x1113122, 0x1113131, 0x1113212, 0x1113221, 0x1113311, 0x1114112, 0x1114121,
+	0x1114211, 0x1121114, 0x1121123, 0x1121132, 0x1121141, 0x1121213, 0x1121222, 0x1121231,
+	0x1121312, 0x1121321, 0x1121411, 0x1122113, 0x1122122, 0x1122131, 0x1122212, 0x1122221,
+	0x1122311, 0x1123112, 0x1123121, 0x1123211, 0x1124111, 0x1131113, 0x1131122, 0x1131131,
+	0x1131212, 0x1131221, 0x1131311, 0x1132112, 0x1132121, 0x1132211, 0x1133111, 0x1141112,
+	0x1141121, 0x1141211, 0x1142111, 0x1211114, 0x1211123, 0x1211132, 0x1211141, 0x1211213,
+	0x1211222, 0x1211231, 0x1211312, 0x1211321, 0x1211411, 0x1212113, 0x1212122, 0x1212131,
+	0x1212212, 0x1212221, 0x1212311, 0x1213112, 0x1213121, 0x1213211, 0x1214111, 0x1221113,
+	0x1221122, 0x1221131, 0x1221212, 0x1221221, 0x1221311, 0x1222112, 0x1222121, 0x1222211,
+	0x1223111, 0x1231112, 0x1231121, 0x1231211, 0x1232111, 0x1241111, 0x1311113, 0x1311122,
+	0x1311131, 0x1311212, 0x1311221, 0x1311311, 0x1312112, 0x1312121, 0x1312211, 0x1313111,
+	0x1321112, 0x1321121, 0x1321211, 0x1322111, 0x1331111, 0x1411112, 0x1411121, 0x1411211,
+	0x1412111, 0x1421111, 0x2111114, 0x2111123, 0x2111132, 0x2111141, 0x2111213, 0x2111222,
+	0x2111231, 0x2111312, 0x2111321, 0x2111411, 0x2112113, 0x2112122, 0x2112131, 0x2112212,
+	0x2112221, 0x2112311, 0x2113112, 0x2113121, 0x2113211, 0x2114111, 0x2121113, 0x2121122,
+	0x2121131, 0x2121212, 0x2121221, 0x2121311, 0x2122112, 0x2122121, 0x2122211, 0x2123111,
+	0x2131112, 0x2131121, 0x2131211, 0x2132111, 0x2141111, 0x2211113, 0x2211122, 0x2211131,
+	0x2211212, 0x2211221, 0x2211311, 0x2212112, 0x2212121, 0x2212211, 0x2213111, 0x2221112,
+	0x2221121, 0x2221211, 0x2222111, 0x2231111, 0x2311112, 0x2311121, 0x2311211, 0x2312111,
+	0x2321111, 0x2411111, 0x3111113, 0x3111122, 0x3111131, 0x3111212, 0x3111221, 0x3111311,
+	0x3112112, 0x3112121, 0x3112211, 0x3113111, 0x3121112, 0x3121121, 0x3121211, 0x3122111,
+	0x3131111, 0x3211112, 0x3211121, 0x3211211, 0x3212111, 0x3221111, 0x3311111, 0x4111112,
+	0x4111121, 0x4111211, 0x4112111, 0x4121111, 0x4211111, 0x1111124, 0x1111133, 0x1111142,
+	0x1111214, 0x1111223, 0x1111232, 0x1111241, 0x1111313, 0x1111322, 0x1111331, 0x1111412,
+	0x1111421, 0x1112114, 0x1112123, 0x1112132, 0x1112141, 0x1112213, 0x1112222, 0x1112231,
+	0x1112312, 0x1112321, 0x1112411, 0x1113113, 0x1113122, 0x1113131, 0x1113212, 0x1113221,
+	0x1113311, 0x1114112, 0x1114121, 0x1114211, 0x1121114, 0x1121123, 0x1121132, 0x1121141,
+	0x1121213, 0x1121222, 0x1121231, 0x1121312, 0x1121321, 0x1121411, 0x1122113, 0x1122122,
+	0x1122131, 0x1122212, 0x1122221, 0x1122311, 0x1123112, 0x1123121, 0x1123211, 0x1124111,
+	0x1131113, 0x1131122, 0x1131131, 0x1131212, 0x1131221, 0x1131311, 0x1132112, 0x1132121,
+	0x1132211, 0x1133111, 0x1141112, 0x1141121, 0x1141211, 0x1142111, 0x1211114, 0x1211123,
+	0x1211132, 0x1211141, 0x1211213, 0x1211222, 0x1211231, 0x1211312, 0x1211321, 0x1211411,
+	0x1212113, 0x1212122, 0x1212131, 0x1212212, 0x1212221, 0x1212311, 0x1213112, 0x1213121,
+	0x1213211, 0x1214111, 0x1221113, 0x1221122, 0x1221131, 0x1221212, 0x1221221, 0x1221311,
+	0x1222112, 0x1222121, 0x1222211, 0x1223111, 0x1231112, 0x1231121, 0x1231211, 0x1232111,
+	0x1241111, 0x1311113, 0x1311122, 0x1311131, 0x1311212, 0x1311221, 0x1311311, 0x1312112,
+	0x1312121, 0x1312211, 0x1313111, 0x1321112, 0x1321121, 0x1321211, 0x1322111, 0x1331111,
+	0x1411112, 0x1411121, 0x1411211, 0x1412111, 0x1421111, 0x2111114, 0x2111123, 0x2111132,
+	0x2111141, 0x2111213, 0x2111222, 0x2111231, 0x2111312, 0x2111321, 0x2111411, 0x2112113,
+	0x2112122, 0x2112131, 0x2112212, 0x2112221, 0x2112311, 0x2113112, 0x2113121, 0x2113211,
+	0x2114111, 0x2121113, 0x2121122, 0x2121131, 0x2121212, 0x2121221, 0x2121311, 0x2122112,
+	0x2122121, 0x2122211, 0x2123111, 0x2131112, 0x2131121, 0x2131211, 0x2132111, 0x2141111,
+	0x2211113, 0x2211122, 0x2211131, 0x2211212, 0x2211221, 0x2211311, 0x2212112, 0x2212121,
+	0x2212211, 0x2213111, 0x2221112, 0x2221121, 0x2221211, 0x2222111, 0x2231111, 0x2311112,
+	0x2311121, 0x2311211, 0x2312111, 0x2321111, 0x2411111, 0x3111113, 0x3111122, 0x3111131,
+	0x3111212, 0x3111221, 0x3111311, 0x3112112, 0x3112121, 0x3112211, 0x3113111, 0x3121112,
+	0x3121121, 0x3121211, 0x3122111, 0x3131111, 0x3211112, 0x3211121, 0x3211211, 0x3212111,
+	0x3221111, 0x3311111, 0x4111112, 0x4111121, 0x4111211, 0x4112111, 0x4121111, 0x4211111,
+	0x1111155, 0x1111245, 0x1111254, 0x1111335, 0x1111344, 0x1111353, 0x1111425, 0x1111434,
+	0x1111443, 0x1111452, 0x1111515, 0x1111524, 0x1111533, 0x1111542, 0x1111551, 0x1112145,
+	0x1112154, 0x1112235, 0x1112244, 0x1112253, 0x1112325, 0x1112334, 0x1112343, 0x1112352,
+	0x1112415, 0x1112424, 0x1112433, 0x1112442, 0x1112451, 0x1112514, 0x1112523, 0x1112532,
+	0x1112541, 0x1113135, 0x1113144, 0x1113153, 0x1113225, 0x1113234, 0x1113243, 0x1113252,
+	0x1113315, 0x1113324, 0x1113333, 0x1113342, 0x1113351, 0x1113414, 0x1113423, 0x1113432,
+	0x1113441, 0x1113513, 0x1113522, 0x1113531, 0x1114125, 0x1114134, 0x1114143, 0x1114152,
+	0x1114215, 0x1114224, 0x1114233, 0x1114242, 0x1114251, 0x1114314, 0x1114323, 0x1114332,
+	0x1114341, 0x1114413, 0x1114422, 0x1114431, 0x1114512, 0x1114521, 0x1115115, 0x1115124,
+	0x1115133, 0x1115142, 0x1115151, 0x1115214, 0x1115223, 0x1115232, 0x1115241, 0x1115313,
+	0x1115322, 0x1115331, 0x1115412, 0x1115421, 0x1115511, 0x1121145, 0x1121154, 0x1121235,
+	0x1121244, 0x1121253, 0x1121325, 0x1121334, 0x1121343, 0x1121352, 0x1121415, 0x1121424,
+	0x1121433, 0x1121442, 0x1121451, 0x1121514, 0x1121523, 0x1121532, 0x1121541, 0x1122135,
+	0x1122144, 0x1122153, 0x1122225, 0x1122234, 0x1122243, 0x1122252, 0x1122315, 0x1122324,
+	0x1122333, 0x1122342, 0x1122351, 0x1122414, 0x1122423, 0x1122432, 0x1122441, 0x1122513,
+	0x1122522, 0x1122531, 0x1123125, 0x1123134, 0x1123143, 0x1123152, 0x1123215, 0x1123224,
+	0x1123233, 0x1123242, 0x1123251, 0x1123314, 0x1123323, 0x1123332, 0x1123341, 0x1123413,
+	0x1123422, 0x1123431, 0x1123512, 0x1123521, 0x1124115, 0x1124124, 0x1124133, 0x1124142,
+	0x1124151, 0x1124214, 0x1124223, 0x1124232, 0x1124241, 0x1124313, 0x1124322, 0x1124331,
+	0x1124412, 0x1124421, 0x1124511, 0x1125114, 0x1125123, 0x1125132, 0x1125141, 0x1125213,
+	0x1125222, 0x1125231, 0x1125312, 0x1125321, 0x1125411, 0x1131135, 0x1131144, 0x1131153,
+	0x1131225, 0x1131234, 0x1131243, 0x1131252, 0x1131315, 0x1131324, 0x1131333, 0x1131342,
+	0x1131351, 0x1131414, 0x1131423, 0x1131432, 0x1131441, 0x1131513, 0x1131522, 0x1131531,
+	0x1132125, 0x1132134, 0x1132143, 0x1132152, 0x1132215, 0x1132224, 0x1132233, 0x1132242,
+	0x1132251, 0x1132314, 0x1132323, 0x1132332, 0x1132341, 0x1132413, 0x1132422, 0x1132431,
+	0x1132512, 0x1132521, 0x1133115, 0x1133124, 0x1133133, 0x1133142, 0x1133151, 0x1133214,
+	0x1133223, 0x1133232, 0x1133241, 0x1133313, 0x1133322, 0x1133331, 0x1133412, 0x1133421,
+	0x1133511, 0x1134114, 0x1134123, 0x1134132, 0x1134141, 0x1134213, 0x1134222, 0x1134231,
+	0x1134312, 0x1134321, 0x1134411, 0x1135113, 0x1135122, 0x1135131, 0x1135212, 0x1135221,
+	0x1135311, 0x1141125, 0x1141134, 0x1141143, 0x1141152, 0x1141215, 0x1141224, 0x1141233,
+	0x1141242, 0x1141251, 0x1141314, 0x1141323, 0x1141332, 0x1141341, 0x1141413, 0x1141422,
+	0x1141431, 0x1141512, 0x1141521, 0x1142115, 0x1142124, 0x1142133, 0x1142142, 0x1142151,
+	0x1142214, 0x1142223, 0x1142232, 0x1142241, 0x1142313, 0x1142322, 0x1142331, 0x1142412,
+	0x1142421, 0x1142511, 0x1143114, 0x1143123, 0x1143132, 0x1143141, 0x1143213, 0x1143222,
+	0x1143231, 0x1143312, 0x1143321, 0x1143411, 0x1144113, 0x1144122, 0x1144131, 0x1144212,
+	0x1144221, 0x1144311, 0x1145112, 0x1145121, 0x1145211, 0x1151115, 0x1151124, 0x1151133,
+	0x1151142, 0x1151151, 0x1151214, 0x1151223, 0x1151232, 0x1151241, 0x1151313, 0x1151322,
+	0x1151331, 0x1151412, 0x1151421, 0x1151511, 0x1152114, 0x1152123, 0x1152132, 0x1152141,
+	0x1152213, 0x1152222, 0x1152231, 0x1152312, 0x1152321, 0x1152411, 0x1153113, 0x1153122,
+	0x1153131, 0x1153212, 0x1153221, 0x1153311, 0x1154112, 0x1154121, 0x1154211, 0x1155111,
+	0x1211145, 0x1211154, 0x1211235, 0x1211244, 0x1211253, 0x1211325, 0x1211334, 0x1211343,
+	0x1211352, 0x1211415, 0x1211424, 0x1211433, 0x1211442, 0x1211451, 0x1211514, 0x1211523,
+	0x1211532, 0x1211541, 0x1212135, 0x1212144, 0x1212153, 0x1212225, 0x1212234, 0x1212243,
+	0x1212252, 0x1212315, 0x1212324, 0x1212333, 0x1212342, 0x1212351, 0x1212414, 0x1212423,
+	0x1212432, 0x1212441, 0x1212513, 0x1212522, 0x1212531, 0x1213125, 0x1213134, 0x1213143,
+	0x1213152, 0x1213215, 0x1213224, 0x1213233, 0x1213242, 0x1213251, 0x1213314, 0x1213323,
+	0x1213332, 0x1213341, 0x1213413, 0x1213422, 0x1213431, 0x1213512, 0x1213521, 0x1214115,
+	0x1214124, 0x1214133, 0x1214142, 0x1214151, 0x1214214, 0x1214223, 0x1214232, 0x1214241,
+	0x1214313, 0x1214322, 0x1214331, 0x1214412, 0x1214421, 0x1214511, 0x1215114, 0x1215123,
+	0x1215132, 0x1215141, 0x1215213, 0x1215222, 0x1215231, 0x1215312, 0x1215321, 0x1215411,
+	0x1221135, 0x1221144, 0x1221153, 0x1221225, 0x1221234, 0x1221243, 0x1221252, 0x1221315,
+	0x1221324, 0x1221333, 0x1221342, 0x1221351, 0x1221414, 0x1221423, 0x1221432, 0x1221441,
+	0x1221513, 0x1221522, 0x1221531, 0x1222125, 0x1222134, 0x1222143, 0x1222152, 0x1222215,
+	0x1222224, 0x1222233, 0x1222242, 0x1222251, 0x1222314, 0x1222323, 0x1222332, 0x1222341,
+	0x1222413, 0x1222422, 0x1222431, 0x1222512, 0x1222521, 0x1223115, 0x1223124, 0x1223133,
+	0x1223142, 0x1223151, 0x1223214, 0x1223223, 0x1223232, 0x1223241, 0x1223313, 0x1223322,
+	0x1223331, 0x1223412, 0x1223421, 0x1223511, 0x1224114, 0x1224123, 0x1224132, 0x1224141,
+	0x1224213, 0x1224222, 0x1224231, 0x1224312, 0x1224321, 0x1224411, 0x1225113, 0x1225122,
+	0x1225131, 0x1225212, 0x1225221, 0x1225311, 0x1231125, 0x1231134, 0x1231143, 0x1231152,
+	0x1231215, 0x1231224, 0x1231233, 0x1231242, 0x1231251, 0x1231314, 0x1231323, 0x1231332,
+	0x1231341, 0x1231413, 0x1231422, 0x1231431, 0x1231512, 0x1231521, 0x1232115, 0x1232124,
+	0x1232133, 0x1232142, 0x1232151, 0x1232214, 0x1232223, 0x1232232, 0x1232241, 0x1232313,
+	0x1232322, 0x1232331, 0x1232412, 0x1232421, 0x1232511, 0x1233114, 0x1233123, 0x1233132,
+	0x1233141, 0x1233213, 0x1233222, 0x1233231, 0x1233312, 0x1233321, 0x1233411, 0x1234113,
+	0x1234122, 0x1234131, 0x1234212, 0x1234221, 0x1234311, 0x1235112, 0x1235121, 0x1235211,
+	0x1241115, 0x1241124, 0x1241133, 0x1241142, 0x1241151, 0x1241214, 0x1241223, 0x1241232,
+	0x1241241, 0x1241313, 0x1241322, 0x1241331, 0x1241412, 0x1241421, 0x1241511, 0x1242114,
+	0x1242123, 0x1242132, 0x1242141, 0x1242213, 0x1242222, 0x1242231, 0x1242312, 0x1242321,
+	0x1242411, 0x1243113, 0x1243122, 0x1243131, 0x1243212, 0x1243221, 0x1243311, 0x1244112,
+	0x1244121, 0x1244211, 0x1245111, 0x1251114, 0x1251123, 0x1251132, 0x1251141, 0x1251213,
+	0x1251222, 0x1251231, 0x1251312, 0x1251321, 0x1251411, 0x1252113, 0x1252122, 0x1252131,
+	0x1252212, 0x1252221, 0x1252311, 0x1253112, 0x1253121, 0x1253211, 0x1254111, 0x1311135,
+	0x1311144, 0x1311153, 0x1311225, 0x1311234, 0x1311243, 0x1311252, 0x1311315, 0x1311324,
+	0x1311333, 0x1311342, 0x1311351, 0x1311414, 0x1311423, 0x1311432, 0x1311441, 0x1311513,
+	0x1311522, 0x1311531, 0x1312125, 0x1312134, 0x1312143, 0x1312152, 0x1312215, 0x1312224,
+	0x1312233, 0x1312242, 0x1312251, 0x1312314, 0x1312323, 0x1312332, 0x1312341, 0x1312413,
+	0x1312422, 0x1312431, 0x1312512, 0x1312521, 0x1313115, 0x1313124, 0x1313133, 0x1313142,
+	0x1313151, 0x1313214, 0x1313223, 0x1313232, 0x1313241, 0x1313313, 0x1313322, 0x1313331,
+	0x1313412, 0x1313421, 0x1313511, 0x1314114, 0x1314123, 0x1314132, 0x1314141, 0x1314213,
+	0x1314222, 0x1314231, 0x1314312, 0x1314321, 0x1314411, 0x1315113, 0x1315122, 0x1315131,
+	0x1315212, 0x1315221, 0x1315311, 0x1321125, 0x1321134, 0x1321143, 0x1321152, 0x1321215,
+	0x1321224, 0x1321233, 0x1321242, 0x1321251, 0x1321314, 0x1321323, 0x1321332, 0x1321341,
+	0x1321413, 0x1321422, 0x1321431, 0x1321512, 0x1321521, 0x1322115, 0x1322124, 0x1322133,
+	0x1322142, 0x1322151, 0x1322214, 0x1322223, 0x1322232, 0x1322241, 0x1322313, 0x1322322,
+	0x1322331, 0x1322412, 0x1322421, 0x1322511, 0x1323114, 0x1323123, 0x1323132, 0x1323141,
+	0x1323213, 0x1323222, 0x1323231, 0x1323312, 0x1323321, 0x1323411, 0x1324113, 0x1324122,
+	0x1324131, 0x1324212, 0x1324221, 0x1324311, 0x1325112, 0x1325121, 0x1325211, 0x1331115,
+	0x1331124, 0x1331133, 0x1331142, 0x1331151, 0x1331214, 0x1331223, 0x1331232, 0x1331241,
+	0x1331313, 0x1331322, 0x1331331, 0x1331412, 0x1331421, 0x1331511, 0x1332114, 0x1332123,
+	0x1332132, 0x1332141, 0x1332213, 0x1332222, 0x1332231, 0x1332312, 0x1332321, 0x1332411,
+	0x1333113, 0x1333122, 0x1333131, 0x1333212, 0x1333221, 0x1333311, 0x1334112, 0x1334121,
+	0x1334211, 0x1335111, 0x1341114, 0x1341123, 0x1341132, 0x1341141, 0x1341213, 0x1341222,
+	0x1341231, 0x1341312, 0x1341321, 0x1341411, 0x1342113, 0x1342122, 0x1342131, 0x1342212,
+	0x1342221, 0x1342311, 0x1343112, 0x1343121, 0x1343211, 0x1344111, 0x1351113, 0x1351122,
+	0x1351131, 0x1351212, 0x1351221, 0x1351311, 0x1352112, 0x1352121, 0x1352211, 0x1353111,
+	0x1411125, 0x1411134, 0x1411143, 0x1411152, 0x1411215, 0x1411224, 0x1411233, 0x1411242,
+	0x1411251, 0x1411314, 0x1411323, 0x1411332, 0x1411341, 0x1411413, 0x1411422, 0x1411431,
+	0x1411512, 0x1411521, 0x1412115, 0x1412124, 0x1412133, 0x1412142, 0x1412151, 0x1412214,
+	0x1412223, 0x1412232, 0x1412241, 0x1412313, 0x1412322, 0x1412331, 0x1412412, 0x1412421,
+	0x1412511, 0x1413114, 0x1413123, 0x1413132, 0x1413141, 0x1413213, 0x1413222, 0x1413231,
+	0x1413312, 0x1413321, 0x1413411, 0x1414113, 0x1414122, 0x1414131, 0x1414212, 0x1414221,
+	0x1414311, 0x1415112, 0x1415121, 0x1415211, 0x1421115, 0x1421124, 0x1421133, 0x1421142,
+	0x1421151, 0x1421214, 0x1421223, 0x1421232, 0x1421241, 0x1421313, 0x1421322, 0x1421331,
+	0x1421412, 0x1421421, 0x1421511, 0x1422114, 0x1422123, 0x1422132, 0x1422141, 0x1422213,
+	0x1422222, 0x1422231, 0x1422312, 0x1422321, 0x1422411, 0x1423113, 0x1423122, 0x1423131,
+	0x1423212, 0x1423221, 0x1423311, 0x1424112, 0x1424121, 0x1424211, 0x1425111, 0x1431114,
+	0x1431123, 0x1431132, 0x1431141, 0x1431213, 0x1431222, 0x1431231, 0x1431312, 0x1431321,
+	0x1431411, 0x1432113, 0x1432122, 0x1432131, 0x1432212, 0x1432221, 0x1432311, 0x1433112,
+	0x1433121, 0x1433211, 0x1434111, 0x1441113, 0x1441122, 0x1441131, 0x1441212, 0x1441221,
+	0x1441311, 0x1442112, 0x1442121, 0x1442211, 0x1443111, 0x1451112, 0x1451121, 0x1451211,
+	0x1452111, 0x1511115, 0x1511124, 0x1511133, 0x1511142, 0x1511151, 0x1511214, 0x1511223,
+	0x1511232, 0x1511241, 0x1511313, 0x1511322, 0x1511331, 0x1511412, 0x1511421, 0x1511511,
+	0x1512114, 0x1512123, 0x1512132, 0x1512141, 0x1512213, 0x1512222, 0x1512231, 0x1512312,
+	0x1512321, 0x1512411, 0x1513113, 0x1513122, 0x1513131, 0x1513212, 0x1513221, 0x1513311,
+	0x1514112, 0x1514121, 0x1514211, 0x1515111, 0x1521114, 0x1521123, 0x1521132, 0x1521141,
+	0x1521213, 0x1521222, 0x1521231, 0x1521312, 0x1521321, 0x1521411, 0x1522113, 0x1522122,
+	0x1522131, 0x1522212, 0x1522221, 0x1522311, 0x1523112, 0x1523121, 0x1523211, 0x1524111,
+	0x1531113, 0x1531122, 0x1531131, 0x1531212, 0x1531221, 0x1531311, 0x1532112, 0x1532121,
+	0x1532211, 0x1533111, 0x1541112, 0x1541121, 0x1541211, 0x1542111, 0x1551111, 0x2111145,
+	0x2111154, 0x2111235, 0x2111244, 0x2111253, 0x2111325, 0x2111334, 0x2111343, 0x2111352,
+	0x2111415, 0x2111424, 0x2111433, 0x2111442, 0x2111451, 0x2111514, 0x2111523, 0x2111532,
+	0x2111541, 0x2112135, 0x2112144, 0x2112153, 0x2112225, 0x2112234, 0x2112243, 0x2112252,
+	0x2112315, 0x2112324, 0x2112333, 0x2112342, 0x2112351, 0x2112414, 0x2112423, 0x2112432,
+	0x2112441, 0x2112513, 0x2112522, 0x2112531, 0x2113125, 0x2113134, 0x2113143, 0x2113152,
+	0x2113215, 0x2113224, 0x2113233, 0x2113242, 0x2113251, 0x2113314, 0x2113323, 0x2113332,
+	0x2113341, 0x2113413, 0x2113422, 0x2113431, 0x2113512, 0x2113521, 0x2114115, 0x2114124,
+	0x2114133, 0x2114142, 0x2114151, 0x2114214, 0x2114223, 0x2114232, 0x2114241, 0x2114313,
+	0x2114322, 0x2114331, 0x2114412, 0x2114421, 0x2114511, 0x2115114, 0x2115123, 0x2115132,
+	0x2115141, 0x2115213, 0x2115222, 0x2115231, 0x2115312, 0x2115321, 0x2115411, 0x2121135,
+	0x2121144, 0x2121153, 0x2121225, 0x2121234, 0x2121243, 0x2121252, 0x2121315, 0x2121324,
+	0x2121333, 0x2121342, 0x2121351, 0x2121414, 0x2121423, 0x2121432, 0x2121441, 0x2121513,
+	0x2121522, 0x2121531, 0x2122125, 0x2122134, 0x2122143, 0x2122152, 0x2122215, 0x2122224,
+	0x2122233, 0x2122242, 0x2122251, 0x2122314, 0x2122323, 0x2122332, 0x2122341, 0x2122413,
+	0x2122422, 0x2122431, 0x2122512, 0x2122521, 0x2123115, 0x2123124, 0x2123133, 0x2123142,
+	0x2123151, 0x2123214, 0x2123223, 0x2123232, 0x2123241, 0x2123313, 0x2123322, 0x2123331,
+	0x2123412, 0x2123421, 0x2123511, 0x2124114, 0x2124123, 0x2124132, 0x2124141, 0x2124213,
+	0x2124222, 0x2124231, 0x2124312, 0x2124321, 0x2124411, 0x2125113, 0x2125122, 0x2125131,
+	0x2125212, 0x2125221, 0x2125311, 0x2131125, 0x2131134, 0x2131143, 0x2131152, 0x2131215,
+	0x2131224, 0x2131233, 0x2131242, 0x2131251, 0x2131314, 0x2131323, 0x2131332, 0x2131341,
+	0x2131413, 0x2131422, 0x2131431, 0x2131512, 0x2131521, 0x2132115, 0x2132124, 0x2132133,
+	0x2132142, 0x2132151, 0x2132214, 0x2132223, 0x2132232, 0x2132241, 0x2132313, 0x2132322,
+	0x2132331, 0x2132412, 0x2132421, 0x2132511, 0x2133114, 0x2133123, 0x2133132, 0x2133141,
+	0x2133213, 0x2133222, 0x2133231, 0x2133312, 0x2133321, 0x2133411, 0x2134113, 0x2134122,
+	0x2134131, 0x2134212, 0x2134221, 0x2134311, 0x2135112, 0x2135121, 0x2135211, 0x2141115,
+	0x2141124, 0x2141133, 0x2141142, 0x2141151, 0x2141214, 0x2141223, 0x2141232, 0x2141241,
+	0x2141313, 0x2141322, 0x2141331, 0x2141412, 0x2141421, 0x2141511, 0x2142114, 0x2142123,
+	0x2142132, 0x2142141, 0x2142213, 0x2142222, 0x2142231, 0x2142312, 0x2142321, 0x2142411,
+	0x2143113, 0x2143122, 0x2143131, 0x2143212, 0x2143221, 0x2143311, 0x2144112, 0x2144121,
+	0x2144211, 0x2145111, 0x2151114, 0x2151123, 0x2151132, 0x2151141, 0x2151213, 0x2151222,
+	0x2151231, 0x2151312, 0x2151321, 0x2151411, 0x2152113, 0x2152122, 0x2152131, 0x2152212,
+	0x2152221, 0x2152311, 0x2153112, 0x2153121, 0x2153211, 0x2154111, 0x2211135, 0x2211144,
+	0x2211153, 0x2211225, 0x2211234, 0x2211243, 0x2211252, 0x2211315, 0x2211324, 0x2211333,
+	0x2211342, 0x2211351, 0x2211414, 0x2211423, 0x2211432, 0x2211441, 0x2211513, 0x2211522,
+	0x2211531, 0x2212125, 0x2212134, 0x2212143, 0x2212152, 0x2212215, 0x2212224, 0x2212233,
+	0x2212242, 0x2212251, 0x2212314, 0x2212323, 0x2212332, 0x2212341, 0x2212413, 0x2212422,
+	0x2212431, 0x2212512, 0x2212521, 0x2213115, 0x2213124, 0x2213133, 0x2213142, 0x2213151,
+	0x2213214, 0x2213223, 0x2213232, 0x2213241, 0x2213313, 0x2213322, 0x2213331, 0x2213412,
+	0x2213421, 0x2213511, 0x2214114, 0x2214123, 0x2214132, 0x2214141, 0x2214213, 0x2214222,
+	0x2214231, 0x2214312, 0x2214321, 0x2214411, 0x2215113, 0x2215122, 0x2215131, 0x2215212,
+	0x2215221, 0x2215311, 0x2221125, 0x2221134, 0x2221143, 0x2221152, 0x2221215, 0x2221224,
+	0x2221233, 0x2221242, 0x2221251, 0x2221314, 0x2221323, 0x2221332, 0x2221341, 0x2221413,
+	0x2221422, 0x2221431, 0x2221512, 0x2221521, 0x2222115, 0x2222124, 0x2222133, 0x2222142,
+	0x2222151, 0x2222214, 0x2222241, 0x2222313, 0x2222331, 0x2222412, 0x2222421, 0x2222511,
+	0x2223114, 0x2223123, 0x2223132, 0x2223141, 0x2223213, 0x2223231, 0x2223312, 0x2223321,
+	0x2223411, 0x2224113, 0x2224122, 0x2224131, 0x2224212, 0x2224221, 0x2224311, 0x2225112,
+	0x2225121, 0x2225211, 0x2231115, 0x2231124, 0x2231133, 0x2231142, 0x2231151, 0x2231214,
+	0x2231223, 0x2231232, 0x2231241, 0x2231313, 0x2231322, 0x2231331, 0x2231412, 0x2231421,
+	0x2231511, 0x2232114, 0x2232123, 0x2232132, 0x2232141, 0x2232213, 0x2232231, 0x2232312,
+	0x2232321, 0x2232411, 0x2233113, 0x2233122, 0x2233131, 0x2233212, 0x2233221, 0x2233311,
+	0x2234112, 0x2234121, 0x2234211, 0x2235111, 0x2241114, 0x2241123, 0x2241132, 0x2241141,
+	0x2241213, 0x2241222, 0x2241231, 0x2241312, 0x2241321, 0x2241411, 0x2242113, 0x2242122,
+	0x2242131, 0x2242212, 0x2242221, 0x2242311, 0x2243112, 0x2243121, 0x2243211, 0x2244111,
+	0x2251113, 0x2251122, 0x2251131, 0x2251212, 0x2251221, 0x2251311, 0x2252112, 0x2252121,
+	0x2252211, 0x2253111, 0x2311125, 0x2311134, 0x2311143, 0x2311152, 0x2311215, 0x2311224,
+	0x2311233, 0x2311242, 0x2311251, 0x2311314, 0x2311323, 0x2311332, 0x2311341, 0x2311413,
+	0x2311422, 0x2311431, 0x2311512, 0x2311521, 0x2312115, 0x2312124, 0x2312133, 0x2312142,
+	0x2312151, 0x2312214, 0x2312223, 0x2312232, 0x2312241, 0x2312313, 0x2312322, 0x2312331,
+	0x2312412, 0x2312421, 0x2312511, 0x2313114, 0x2313123, 0x2313132, 0x2313141, 0x2313213,
+	0x2313222, 0x2313231, 0x2313312, 0x2313321, 0x2313411, 0x2314113, 0x2314122, 0x2314131,
+	0x2314212, 0x2314221, 0x2314311, 0x2315112, 0x2315121, 0x2315211, 0x2321115, 0x2321124,
+	0x2321133, 0x2321142, 0x2321151, 0x2321214, 0x2321223, 0x2321232, 0x2321241, 0x2321313,
+	0x2321322, 0x2321331, 0x2321412, 0x2321421, 0x2321511, 0x2322114, 0x2322123, 0x2322132,
+	0x2322141, 0x2322213, 0x2322231, 0x2322312, 0x2322321, 0x2322411, 0x2323113, 0x2323122,
+	0x2323131, 0x2323212, 0x2323221, 0x2323311, 0x2324112, 0x2324121, 0x2324211, 0x2325111,
+	0x2331114, 0x2331123, 0x2331132, 0x2331141, 0x2331213, 0x2331222, 0x2331231, 0x2331312,
+	0x2331321, 0x2331411, 0x2332113, 0x2332122, 0x2332131, 0x2332212, 0x2332221, 0x2332311,
+	0x2333112, 0x2333121, 0x2333211, 0x2334111, 0x2341113, 0x2341122, 0x2341131, 0x2341212,
+	0x2341221, 0x2341311, 0x2342112, 0x2342121, 0x2342211, 0x2343111, 0x2351112, 0x2351121,
+	0x2351211, 0x2352111, 0x2411115, 0x2411124, 0x2411133, 0x2411142, 0x2411151, 0x2411214,
+	0x2411223, 0x2411232, 0x2411241, 0x2411313, 0x2411322, 0x2411331, 0x2411412, 0x2411421,
+	0x2411511, 0x2412114, 0x2412123, 0x2412132, 0x2412141, 0x2412213, 0x2412222, 0x2412231,
+	0x2412312, 0x2412321, 0x2412411, 0x2413113, 0x2413122, 0x2413131, 0x2413212, 0x2413221,
+	0x2413311, 0x2414112, 0x2414121, 0x2414211, 0x2415111, 0x2421114, 0x2421123, 0x2421132,
+	0x2421141, 0x2421213, 0x2421222, 0x2421231, 0x2421312, 0x2421321, 0x2421411, 0x2422113,
+	0x2422122, 0x2422131, 0x2422212, 0x2422221, 0x2422311, 0x2423112, 0x2423121, 0x2423211,
+	0x2424111, 0x2431113, 0x2431122, 0x2431131, 0x2431212, 0x2431221, 0x2431311, 0x2432112,
+	0x2432121, 0x2432211, 0x2433111, 0x2441112, 0x2441121, 0x2441211, 0x2442111, 0x2451111,
+	0x2511114, 0x2511123, 0x2511132, 0x2511141, 0x2511213, 0x2511222, 0x2511231, 0x2511312,
+	0x2511321, 0x2511411, 0x2512113, 0x2512122, 0x2512131, 0x2512212, 0x2512221, 0x2512311,
+	0x2513112, 0x2513121, 0x2513211, 0x2514111, 0x2521113, 0x2521122, 0x2521131, 0x2521212,
+	0x2521221, 0x2521311, 0x2522112, 0x2522121, 0x2522211, 0x2523111, 0x2531112, 0x2531121,
+	0x2531211, 0x2532111, 0x2541111, 0x3111135, 0x3111144, 0x3111153, 0x3111225, 0x3111234,
+	0x3111243, 0x3111252, 0x3111315, 0x3111324, 0x3111333, 0x3111342, 0x3111351, 0x3111414,
+	0x3111423, 0x3111432, 0x3111441, 0x3111513, 0x3111522, 0x3111531, 0x3112125, 0x3112134,
+	0x3112143, 0x3112152, 0x3112215, 0x3112224, 0x3112233, 0x3112242, 0x3112251, 0x3112314,
+	0x3112323, 0x3112332, 0x3112341, 0x3112413, 0x3112422, 0x3112431, 0x3112512, 0x3112521,
+	0x3113115, 0x3113124, 0x3113133, 0x3113142, 0x3113151, 0x3113214, 0x3113223, 0x3113232,
+	0x3113241, 0x3113313, 0x3113322, 0x3113331, 0x3113412, 0x3113421, 0x3113511, 0x3114114,
+	0x3114123, 0x3114132, 0x3114141, 0x3114213, 0x3114222, 0x3114231, 0x3114312, 0x3114321,
+	0x3114411, 0x3115113, 0x3115122, 0x3115131, 0x3115212, 0x3115221, 0x3115311, 0x3121125,
+	0x3121134, 0x3121143, 0x3121152, 0x3121215, 0x3121224, 0x3121233, 0x3121242, 0x3121251,
+	0x3121314, 0x3121323, 0x3121332, 0x3121341, 0x3121413, 0x3121422, 0x3121431, 0x3121512,
+	0x3121521, 0x3122115, 0x3122124, 0x3122133, 0x3122142, 0x3122151, 0x3122214, 0x3122223,
+	0x3122232, 0x3122241, 0x3122313, 0x3122322, 0x3122331, 0x3122412, 0x3122421, 0x3122511,
+	0x3123114, 0x3123123, 0x3123132, 0x3123141, 0x3123213, 0x3123222, 0x3123231, 0x3123312,
+	0x3123321, 0x3123411, 0x3124113, 0x3124122, 0x3124131, 0x3124212, 0x3124221, 0x3124311,
+	0x3125112, 0x3125121, 0x3125211, 0x3131115, 0x3131124, 0x3131133, 0x3131142, 0x3131151,
+	0x3131214, 0x3131223, 0x3131232, 0x3131241, 0x3131313, 0x3131322, 0x3131331, 0x3131412,
+	0x3131421, 0x3131511, 0x3132114, 0x3132123, 0x3132132, 0x3132141, 0x3132213, 0x3132222,
+	0x3132231, 0x3132312, 0x3132321, 0x3132411, 0x3133113, 0x3133122, 0x3133131, 0x3133212,
+	0x3133221, 0x3133311, 0x3134112, 0x3134121, 0x3134211, 0x3135111, 0x3141114, 0x3141123,
+	0x3141132, 0x3141141, 0x3141213, 0x3141222, 0x3141231, 0x3141312, 0x3141321, 0x3141411,
+	0x3142113, 0x3142122, 0x3142131, 0x3142212, 0x3142221, 0x3142311, 0x3143112, 0x3143121,
+	0x3143211, 0x3144111, 0x3151113, 0x3151122, 0x3151131, 0x3151212, 0x3151221, 0x3151311,
+	0x3152112, 0x3152121, 0x3152211, 0x3153111, 0x3211125, 0x3211134, 0x3211143, 0x3211152,
+	0x3211215, 0x3211224, 0x3211233, 0x3211242, 0x3211251, 0x3211314, 0x3211323, 0x3211332,
+	0x3211341, 0x3211413, 0x3211422, 0x3211431, 0x3211512, 0x3211521, 0x3212115, 0x3212124,
+	0x3212133, 0x3212142, 0x3212151, 0x3212214, 0x3212223, 0x3212232, 0x3212241, 0x3212313,
+	0x3212322, 0x3212331, 0x3212412, 0x3212421, 0x3212511, 0x3213114, 0x3213123, 0x3213132,
+	0x3213141, 0x3213213, 0x3213222, 0x3213231, 0x3213312, 0x3213321, 0x3213411, 0x3214113,
+	0x3214122, 0x3214131, 0x3214212, 0x3214221, 0x3214311, 0x3215112, 0x3215121, 0x3215211,
+	0x3221115, 0x3221124, 0x3221133, 0x3221142, 0x3221151, 0x3221214, 0x3221223, 0x3221232,
+	0x3221241, 0x3221313, 0x3221322, 0x3221331, 0x3221412, 0x3221421, 0x3221511, 0x3222114,
+	0x3222123, 0x3222132, 0x3222141, 0x3222213, 0x3222231, 0x3222312, 0x3222321, 0x3222411,
+	0x3223113, 0x3223122, 0x3223131, 0x3223212, 0x3223221, 0x3223311, 0x3224112, 0x3224121,
+	0x3224211, 0x3225111, 0x3231114, 0x3231123, 0x3231132, 0x3231141, 0x3231213, 0x3231222,
+	0x3231231, 0x3231312, 0x3231321, 0x3231411, 0x3232113, 0x3232122, 0x3232131, 0x3232212,
+	0x3232221, 0x3232311, 0x3233112, 0x3233121, 0x3233211, 0x3234111, 0x3241113, 0x3241122,
+	0x3241131, 0x3241212, 0x3241221, 0x3241311, 0x3242112, 0x3242121, 0x3242211, 0x3243111,
+	0x3251112, 0x3251121, 0x3251211, 0x3252111, 0x3311115, 0x3311124, 0x3311133, 0x3311142,
+	0x3311151, 0x3311214, 0x3311223, 0x3311232, 0x3311241, 0x3311313, 0x3311322, 0x3311331,
+	0x3311412, 0x3311421, 0x3311511, 0x3312114, 0x3312123, 0x3312132, 0x3312141, 0x3312213,
+	0x3312222, 0x3312231, 0x3312312, 0x3312321, 0x3312411, 0x3313113, 0x3313122, 0x3313131,
+	0x3313212, 0x3313221, 0x3313311, 0x3314112, 0x3314121, 0x3314211, 0x3315111, 0x3321114,
+	0x3321123, 0x3321132, 0x3321141, 0x3321213, 0x3321222, 0x3321231, 0x3321312, 0x3321321,
+	0x3321411, 0x3322113, 0x3322122, 0x3322131, 0x3322212, 0x3322221, 0x3322311, 0x3323112,
+	0x3323121, 0x3323211, 0x3324111, 0x3331113, 0x3331122, 0x3331131, 0x3331212, 0x3331221,
+	0x3331311, 0x3332112, 0x3332121, 0x3332211, 0x3333111, 0x3341112, 0x3341121, 0x3341211,
+	0x3342111, 0x3351111, 0x3411114, 0x3411123, 0x3411132, 0x3411141, 0x3411213, 0x3411222,
+	0x3411231, 0x3411312, 0x3411321, 0x3411411, 0x3412113, 0x3412122, 0x3412131, 0x3412212,
+	0x3412221, 0x3412311, 0x3413112, 0x3413121, 0x3413211, 0x3414111, 0x3421113, 0x3421122,
+	0x3421131, 0x3421212, 0x3421221, 0x3421311, 0x3422112, 0x3422121, 0x3422211, 0x3423111,
+	0x3431112, 0x3431121, 0x3431211, 0x3432111, 0x3441111, 0x3511113, 0x3511122, 0x3511131,
+	0x3511212, 0x3511221, 0x3511311, 0x3512112, 0x3512121, 0x3512211, 0x3513111, 0x3521112,
+	0x3521121, 0x3521211, 0x3522111, 0x3531111, 0x4111125, 0x4111134, 0x4111143, 0x4111152,
+	0x4111215, 0x4111224, 0x4111233, 0x4111242, 0x4111251, 0x4111314, 0x4111323, 0x4111332,
+	0x4111341, 0x4111413, 0x4111422, 0x4111431, 0x4111512, 0x4111521, 0x4112115, 0x4112124,
+	0x4112133, 0x4112142, 0x4112151, 0x4112214, 0x4112223, 0x4112232, 0x4112241, 0x4112313,
+	0x4112322, 0x4112331, 0x4112412, 0x4112421, 0x4112511, 0x4113114, 0x4113123, 0x4113132,
+	0x4113141, 0x4113213, 0x4113222, 0x4113231, 0x4113312, 0x4113321, 0x4113411, 0x4114113,
+	0x4114122, 0x4114131, 0x4114212, 0x4114221, 0x4114311, 0x4115112, 0x4115121, 0x4115211,
+	0x4121115, 0x4121124, 0x4121133, 0x4121142, 0x4121151, 0x4121214, 0x4121223, 0x4121232,
+	0x4121241, 0x4121313, 0x4121322, 0x4121331, 0x4121412, 0x4121421, 0x4121511, 0x4122114,
+	0x4122123, 0x4122132, 0x4122141, 0x4122213, 0x4122222, 0x4122231, 0x4122312, 0x4122321,
+	0x4122411, 0x4123113, 0x4123122, 0x4123131, 0x4123212, 0x4123221, 0x4123311, 0x4124112,
+	0x4124121, 0x4124211, 0x4125111, 0x4131114, 0x4131123, 0x4131132, 0x4131141, 0x4131213,
+	0x4131222, 0x4131231, 0x4131312, 0x4131321, 0x4131411, 0x4132113, 0x4132122, 0x4132131,
+	0x4132212, 0x4132221, 0x4132311, 0x4133112, 0x4133121, 0x4133211, 0x4134111, 0x4141113,
+	0x4141122, 0x4141131, 0x4141212, 0x4141221, 0x4141311, 0x4142112, 0x4142121, 0x4142211,
+	0x4143111, 0x4151112, 0x4151121, 0x4151211, 0x4152111, 0x4211115, 0x4211124, 0x4211133,
+	0x4211142, 0x4211151, 0x4211214, 0x4211223, 0x4211232, 0x4211241, 0x4211313, 0x4211322,
+	0x4211331, 0x4211412, 0x4211421, 0x4211511, 0x4212114, 0x4212123, 0x4212132, 0x4212141,
+	0x4212213, 0x4212222, 0x4212231, 0x4212312, 0x4212321, 0x4212411, 0x4213113, 0x4213122,
+	0x4213131, 0x4213212, 0x4213221, 0x4213311, 0x4214112, 0x4214121, 0x4214211, 0x4215111,
+	0x4221114, 0x4221123, 0x4221132, 0x4221141, 0x4221213, 0x4221222, 0x4221231, 0x4221312,
+	0x4221321, 0x4221411, 0x4222113, 0x4222122, 0x4222131, 0x4222212, 0x4222221, 0x4222311,
+	0x4223112, 0x4223121, 0x4223211, 0x4224111, 0x4231113, 0x4231122, 0x4231131, 0x4231212,
+	0x4231221, 0x4231311, 0x4232112, 0x4232121, 0x4232211, 0x4233111, 0x4241112, 0x4241121,
+	0x4241211, 0x4242111, 0x4251111, 0x4311114, 0x4311123, 0x4311132, 0x4311141, 0x4311213,
+	0x4311222, 0x4311231, 0x4311312, 0x4311321, 0x4311411, 0x4312113, 0x4312122, 0x4312131,
+	0x4312212, 0x4312221, 0x4312311, 0x4313112, 0x4313121, 0x4313211, 0x4314111, 0x4321113,
+	0x4321122, 0x4321131, 0x4321212, 0x4321221, 0x4321311, 0x4322112, 0x4322121, 0x4322211,
+	0x4323111, 0x4331112, 0x4331121, 0x4331211, 0x4332111, 0x4341111, 0x4411113, 0x4411122,
+	0x4411131, 0x4411212, 0x4411221, 0x4411311, 0x4412112, 0x4412121, 0x4412211, 0x4413111,
+	0x4421112, 0x4421121, 0x4421211, 0x4422111, 0x4431111, 0x4511112, 0x4511121, 0x4511211,
+	0x4512111, 0x4521111, 0x5111115, 0x5111124, 0x5111133, 0x5111142, 0x5111151, 0x5111214,
+	0x5111223, 0x5111232, 0x5111241, 0x5111313, 0x5111322, 0x5111331, 0x5111412, 0x5111421,
+	0x5111511, 0x5112114, 0x5112123, 0x5112132, 0x5112141, 0x5112213, 0x5112222, 0x5112231,
+	0x5112312, 0x5112321, 0x5112411, 0x5113113, 0x5113122, 0x5113131, 0x5113212, 0x5113221,
+	0x5113311, 0x5114112, 0x5114121, 0x5114211, 0x5115111, 0x5121114, 0x5121123, 0x5121132,
+	0x5121141, 0x5121213, 0x5121222, 0x5121231, 0x5121312, 0x5121321, 0x5121411, 0x5122113,
+	0x5122122, 0x5122131, 0x5122212, 0x5122221, 0x5122311, 0x5123112, 0x5123121, 0x5123211,
+	0x5124111, 0x5131113, 0x5131122, 0x5131131, 0x5131212, 0x5131221, 0x5131311, 0x5132112,
+	0x5132121, 0x5132211, 0x5133111, 0x5141112, 0x5141121, 0x5141211, 0x5142111, 0x5151111,
+	0x5211114, 0x5211123, 0x5211132, 0x5211141, 0x5211213, 0x5211222, 0x5211231, 0x5211312,
+	0x5211321, 0x5211411, 0x5212113, 0x5212122, 0x5212131, 0x5212212, 0x5212221, 0x5212311,
+	0x5213112, 0x5213121, 0x5213211, 0x5214111, 0x5221113, 0x5221122, 0x5221131, 0x5221212,
+	0x5221221, 0x5221311, 0x5222112, 0x5222121, 0x5222211, 0x5223111, 0x5231112, 0x5231121,
+	0x5231211, 0x5232111, 0x5241111, 0x5311113, 0x5311122, 0x5311131, 0x5311212, 0x5311221,
+	0x5311311, 0x5312112, 0x5312121, 0x5312211, 0x5313111, 0x5321112, 0x5321121, 0x5321211,
+	0x5322111, 0x5331111, 0x5411112, 0x5411121, 0x5411211, 0x5412111, 0x5421111, 0x5511111,
+	0x1111168, 0x1111177, 0x1111186, 0x1111258, 0x1111267, 0x1111276, 0x1111285, 0x1111348,
+	0x1111357, 0x1111366, 0x1111375, 0x1111384, 0x1111438, 0x1111447, 0x1111456, 0x1111465,
+	0x1111474, 0x1111483, 0x1111528, 0x1111537, 0x1111546, 0x1111555, 0x1111564, 0x1111573,
+	0x1111582, 0x1111618, 0x1111627, 0x1111636, 0x1111645, 0x1111654, 0x1111663, 0x1111672,
+	0x1111681, 0x1111717, 0x1111726, 0x1111735, 0x1111744, 0x1111753, 0x1111762, 0x1111771,
+	0x1111816, 0x1111825, 0x1111834, 0x1111843, 0x1111852, 0x1111861, 0x1112158, 0x1112167,
+	0x1112176, 0x1112185, 0x1112248, 0x1112257, 0x1112266, 0x1112275, 0x1112284, 0x1112338,
+	0x1112347, 0x1112356, 0x1112365, 0x1112374, 0x1112383, 0x1112428, 0x1112437, 0x1112446,
+	0x1112455, 0x1112464, 0x1112473, 0x1112482, 0x1112518, 0x1112527, 0x1112536, 0x1112545,
+	0x1112554, 0x1112563, 0x1112572, 0x1112581, 0x1112617, 0x1112626, 0x1112635, 0x1112644,
+	0x1112653, 0x1112662, 0x1112671, 0x1112716, 0x1112725, 0x1112734, 0x1112743, 0x1112752,
+	0x1112761, 0x1112815, 0x1112824, 0x1112833, 0x1112842, 0x1112851, 0x1113148, 0x1113157,
+	0x1113166, 0x1113175, 0x1113184, 0x1113238, 0x1113247, 0x1113256, 0x1113265, 0x1113274,
+	0x1113283, 0x1113328, 0x1113337, 0x1113346, 0x1113355, 0x1113364, 0x1113373, 0x1113382,
+	0x1113418, 0x1113427, 0x1113436, 0x1113445, 0x1113454, 0x1113463, 0x1113472, 0x1113481,
+	0x1113517, 0x1113526, 0x1113535, 0x1113544, 0x1113553, 0x1113562, 0x1113571, 0x1113616,
+	0x1113625, 0x1113634, 0x1113643, 0x1113652, 0x1113661, 0x1113715, 0x1113724, 0x1113733,
+	0x1113742, 0x1113751, 0x1113814, 0x1113823, 0x1113832, 0x1113841, 0x1114138, 0x1114147,
+	0x1114156, 0x1114165, 0x1114174, 0x1114183, 0x1114228, 0x1114237, 0x1114246, 0x1114255,
+	0x1114264, 0x1114273, 0x1114282, 0x1114318, 0x1114327, 0x1114336, 0x1114345, 0x1114354,
+	0x1114363, 0x1114372, 0x1114381, 0x1114417, 0x1114426, 0x1114435, 0x1114444, 0x1114453,
+	0x1114462, 0x1114471, 0x1114516, 0x1114525, 0x1114534, 0x1114543, 0x1114552, 0x1114561,
+	0x1114615, 0x1114624, 0x1114633, 0x1114642, 0x1114651, 0x1114714, 0x1114723, 0x1114732,
+	0x1114741, 0x1114813, 0x1114822, 0x1114831, 0x1115128, 0x1115137, 0x1115146, 0x1115155,
+	0x1115164, 0x1115173, 0x1115182, 0x1115218, 0x1115227, 0x1115236, 0x1115245, 0x1115254,
+	0x1115263, 0x1115272, 0x1115281, 0x1115317, 0x1115326, 0x1115335, 0x1115344, 0x1115353,
+	0x1115362, 0x1115371, 0x1115416, 0x1115425, 0x1115434, 0x1115443, 0x1115452, 0x1115461,
+	0x1115515, 0x1115524, 0x1115533, 0x1115542, 0x1115551, 0x1115614, 0x1115623, 0x1115632,
+	0x1115641, 0x1115713, 0x1115722, 0x1115731, 0x1115812, 0x1115821, 0x1116118, 0x1116127,
+	0x1116136, 0x1116145, 0x1116154, 0x1116163, 0x1116172, 0x1116181, 0x1116217, 0x1116226,
+	0x1116235, 0x1116244, 0x1116253, 0x1116262, 0x1116271, 0x1116316, 0x1116325, 0x1116334,
+	0x1116343, 0x1116352, 0x1116361, 0x1116415, 0x1116424, 0x1116433, 0x1116442, 0x1116451,
+	0x1116514, 0x1116523, 0x1116532, 0x1116541, 0x1116613, 0x1116622, 0x1116631, 0x1116712,
+	0x1116721, 0x1116811, 0x1117117, 0x1117126, 0x1117135, 0x1117144, 0x1117153, 0x1117162,
+	0x1117171, 0x1117216, 0x1117225, 0x1117234, 0x1117243, 0x1117252, 0x1117261, 0x1117315,
+	0x1117324, 0x1117333, 0x1117342, 0x1117351, 0x1117414, 0x1117423, 0x1117432, 0x1117441,
+	0x1117513, 0x1117522, 0x1117531, 0x1117612, 0x1117621, 0x1117711, 0x1118116, 0x1118125,
+	0x1118134, 0x1118143, 0x1118152, 0x1118161, 0x1118215, 0x1118224, 0x1118233, 0x1118242,
+	0x1118251, 0x1118314, 0x1118323, 0x1118332, 0x1118341, 0x1118413, 0x1118422, 0x1118431,
+	0x1118512, 0x1118521, 0x1118611, 0x1121158, 0x1121167, 0x1121176, 0x1121185, 0x1121248,
+	0x1121257, 0x1121266, 0x1121275, 0x1121284, 0x1121338, 0x1121347, 0x1121356, 0x1121365,
+	0x1121374, 0x1121383, 0x1121428, 0x1121437, 0x1121446, 0x1121455, 0x1121464, 0x1121473,
+	0x1121482, 0x1121518, 0x1121527, 0x1121536, 0x1121545, 0x1121554, 0x1121563, 0x1121572,
+	0x1121581, 0x1121617, 0x1121626, 0x1121635, 0x1121644, 0x1121653, 0x1121662, 0x1121671,
+	0x1121716, 0x1121725, 0x1121734, 0x1121743, 0x1121752, 0x1121761, 0x1121815, 0x1121824,
+	0x1121833, 0x1121842, 0x1121851, 0x1122148, 0x1122157, 0x1122166, 0x1122175, 0x1122184,
+	0x1122238, 0x1122247, 0x1122256, 0x1122265, 0x1122274, 0x1122283, 0x1122328, 0x1122337,
+	0x1122346, 0x1122355, 0x1122364, 0x1122373, 0x1122382, 0x1122418, 0x1122427, 0x1122436,
+	0x1122445, 0x1122454, 0x1122463, 0x1122472, 0x1122481, 0x1122517, 0x1122526, 0x1122535,
+	0x1122544, 0x1122553, 0x1122562, 0x1122571, 0x1122616, 0x1122625, 0x1122634, 0x1122643,
+	0x1122652, 0x1122661, 0x1122715, 0x1122724, 0x1122733, 0x1122742, 0x1122751, 0x1122814,
+	0x1122823, 0x1122832, 0x1122841, 0x1123138, 0x1123147, 0x1123156, 0x1123165, 0x1123174,
+	0x1123183, 0x1123228, 0x1123237, 0x1123246, 0x1123255, 0x1123264, 0x1123273, 0x1123282,
+	0x1123318, 0x1123327, 0x1123336, 0x1123345, 0x1123354, 0x1123363, 0x1123372, 0x1123381,
+	0x1123417, 0x1123426, 0x1123435, 0x1123444, 0x1123453, 0x1123462, 0x1123471, 0x1123516,
+	0x1123525, 0x1123534, 0x1123543, 0x1123552, 0x1123561, 0x1123615, 0x1123624, 0x1123633,
+	0x1123642, 0x1123651, 0x1123714, 0x1123723, 0x1123732, 0x1123741, 0x1123813, 0x1123822,
+	0x1123831, 0x1124128, 0x1124137, 0x1124146, 0x1124155, 0x1124164, 0x1124173, 0x1124182,
+	0x1124218, 0x1124227, 0x1124236, 0x1124245, 0x1124254, 0x1124263, 0x1124272, 0x1124281,
+	0x1124317, 0x1124326, 0x1124335, 0x1124344, 0x1124353, 0x1124362, 0x1124371, 0x1124416,
+	0x1124425, 0x1124434, 0x1124443, 0x1124452, 0x1124461, 0x1124515, 0x1124524, 0x1124533,
+	0x1124542, 0x1124551, 0x1124614, 0x1124623, 0x1124632, 0x1124641, 0x1124713, 0x1124722,
+	0x1124731, 0x1124812, 0x1124821, 0x1125118, 0x1125127, 0x1125136, 0x1125145, 0x1125154,
+	0x1125163, 0x1125172, 0x1125181, 0x1125217, 0x1125226, 0x1125235, 0x1125244, 0x1125253,
+	0x1125262, 0x1125271, 0x1125316, 0x1125325, 0x1125334, 0x1125343, 0x1125352, 0x1125361,
+	0x1125415, 0x1125424, 0x1125433, 0x1125442, 0x1125451, 0x1125514, 0x1125523, 0x1125532,
+	0x1125541, 0x1125613, 0x1125622, 0x1125631, 0x1125712, 0x1125721, 0x1125811, 0x1126117,
+	0x1126126, 0x1126135, 0x1126144, 0x1126153, 0x1126162, 0x1126171, 0x1126216, 0x1126225,
+	0x1126234, 0x1126243, 0x1126252, 0x1126261, 0x1126315, 0x1126324, 0x1126333, 0x1126342,
+	0x1126351, 0x1126414, 0x1126423, 0x1126432, 0x1126441, 0x1126513, 0x1126522, 0x1126531,
+	0x1126612, 0x1126621, 0x1126711, 0x1127116, 0x1127125, 0x1127134, 0x1127143, 0x1127152,
+	0x1127161, 0x1127215, 0x1127224, 0x1127233, 0x1127242, 0x1127251, 0x1127314, 0x1127323,
+	0x1127332, 0x1127341, 0x1127413, 0x1127422, 0x1127431, 0x1127512, 0x1127521, 0x1127611,
+	0x1128115, 0x1128124, 0x1128133, 0x1128142, 0x1128151, 0x1128214, 0x1128223, 0x1128232,
+	0x1128241, 0x1128313, 0x1128322, 0x1128331, 0x1128412, 0x1128421, 0x1128511, 0x1131148,
+	0x1131157, 0x1131166, 0x1131175, 0x1131184, 0x1131238, 0x1131247, 0x1131256, 0x1131265,
+	0x1131274, 0x1131283, 0x1131328, 0x1131337, 0x1131346, 0x1131355, 0x1131364, 0x1131373,
+	0x1131382, 0x1131418, 0x1131427, 0x1131436, 0x1131445, 0x1131454, 0x1131463, 0x1131472,
+	0x1131481, 0x1131517, 0x1131526, 0x1131535, 0x1131544, 0x1131553, 0x1131562, 0x1131571,
+	0x1131616, 0x1131625, 0x1131634, 0x1131643, 0x1131652, 0x1131661, 0x1131715, 0x1131724,
+	0x1131733, 0x1131742, 0x1131751, 0x1131814, 0x1131823, 0x1131832, 0x1131841, 0x1132138,
+	0x1132147, 0x1132156, 0x1132165, 0x1132174, 0x1132183, 0x1132228, 0x1132237, 0x1132246,
+	0x1132255, 0x1132264, 0x1132273, 0x1132282, 0x1132318, 0x1132327, 0x1132336, 0x1132345,
+	0x1132354, 0x1132363, 0x1132372, 0x1132381, 0x1132417, 0x1132426, 0x1132435, 0x1132444,
+	0x1132453, 0x1132462, 0x1132471, 0x1132516, 0x1132525, 0x1132534, 0x1132543, 0x1132552,
+	0x1132561, 0x1132615, 0x1132624, 0x1132633, 0x1132642, 0x1132651, 0x1132714, 0x1132723,
+	0x1132732, 0x1132741, 0x1132813, 0x1132822, 0x1132831, 0x1133128, 0x1133137, 0x1133146,
+	0x1133155, 0x1133164, 0x1133173, 0x1133182, 0x1133218, 0x1133227, 0x1133236, 0x1133245,
+	0x1133254, 0x1133263, 0x1133272, 0x1133281, 0x1133317, 0x1133326, 0x1133335, 0x1133344,
+	0x1133353, 0x1133362, 0x1133371, 0x1133416, 0x1133425, 0x1133434, 0x1133443, 0x1133452,
+	0x1133461, 0x1133515, 0x1133524, 0x1133533, 0x1133542, 0x1133551, 0x1133614, 0x1133623,
+	0x1133632, 0x1133641, 0x1133713, 0x1133722, 0x1133731, 0x1133812, 0x1133821, 0x1134118,
+	0x1134127, 0x1134136, 0x1134145, 0x1134154, 0x1134163, 0x1134172, 0x1134181, 0x1134217,
+	0x1134226, 0x1134235, 0x1134244, 0x1134253, 0x1134262, 0x1134271, 0x1134316, 0x1134325,
+	0x1134334, 0x1134343, 0x1134352, 0x1134361, 0x1134415, 0x1134424, 0x1134433, 0x1134442,
+	0x1134451, 0x1134514, 0x1134523, 0x1134532, 0x1134541, 0x1134613, 0x1134622, 0x1134631,
+	0x1134712, 0x1134721, 0x1134811, 0x1135117, 0x1135126, 0x1135135, 0x1135144, 0x1135153,
+	0x1135162, 0x1135171, 0x1135216, 0x1135225, 0x1135234, 0x1135243, 0x1135252, 0x1135261,
+	0x1135315, 0x1135324, 0x1135333, 0x1135342, 0x1135351, 0x1135414, 0x1135423, 0x1135432,
+	0x1135441, 0x1135513, 0x1135522, 0x1135531, 0x1135612, 0x1135621, 0x1135711, 0x1136116,
+	0x1136125, 0x1136134, 0x1136143, 0x1136152, 0x1136161, 0x1136215, 0x1136224, 0x1136233,
+	0x1136242, 0x1136251, 0x1136314, 0x1136323, 0x1136332, 0x1136341, 0x1136413, 0x1136422,
+	0x1136431, 0x1136512, 0x1136521, 0x1136611, 0x1137115, 0x1137124, 0x1137133, 0x1137142,
+	0x1137151, 0x1137214, 0x1137223, 0x1137232, 0x1137241, 0x1137313, 0x1137322, 0x1137331,
+	0x1137412, 0x1137421, 0x1137511, 0x1138114, 0x1138123, 0x1138132, 0x1138141, 0x1138213,
+	0x1138222, 0x1138231, 0x1138312, 0x1138321, 0x1138411, 0x1141138, 0x1141147, 0x1141156,
+	0x1141165, 0x1141174, 0x1141183, 0x1141228, 0x1141237, 0x1141246, 0x1141255, 0x1141264,
+	0x1141273, 0x1141282, 0x1141318, 0x1141327, 0x1141336, 0x1141345, 0x1141354, 0x1141363,
+	0x1141372, 0x1141381, 0x1141417, 0x1141426, 0x1141435, 0x1141444, 0x1141453, 0x1141462,
+	0x1141471, 0x1141516, 0x1141525, 0x1141534, 0x1141543, 0x1141552, 0x1141561, 0x1141615,
+	0x1141624, 0x1141633, 0x1141642, 0x1141651, 0x1141714, 0x1141723, 0x1141732, 0x1141741,
+	0x1141813, 0x1141822, 0x1141831, 0x1142128, 0x1142137, 0x1142146, 0x1142155, 0x1142164,
+	0x1142173, 0x1142182, 0x1142218, 0x1142227, 0x1142236, 0x1142245, 0x1142254, 0x1142263,
+	0x1142272, 0x1142281, 0x1142317, 0x1142326, 0x1142335, 0x1142344, 0x1142353, 0x1142362,
+	0x1142371, 0x1142416, 0x1142425, 0x1142434, 0x1142443, 0x1142452, 0x1142461, 0x1142515,
+	0x1142524, 0x1142533, 0x1142542, 0x1142551, 0x1142614, 0x1142623, 0x1142632, 0x1142641,
+	0x1142713, 0x1142722, 0x1142731, 0x1142812, 0x1142821, 0x1143118, 0x1143127, 0x1143136,
+	0x1143145, 0x1143154, 0x1143163, 0x1143172, 0x1143181, 0x1143217, 0x1143226, 0x1143235,
+	0x1143244, 0x1143253, 0x1143262, 0x1143271, 0x1143316, 0x1143325, 0x1143334, 0x1143343,
+	0x1143352, 0x1143361, 0x1143415, 0x1143424, 0x1143433, 0x1143442, 0x1143451, 0x1143514,
+	0x1143523, 0x1143532, 0x1143541, 0x1143613, 0x1143622, 0x1143631, 0x1143712, 0x1143721,
+	0x1143811, 0x1144117, 0x1144126, 0x1144135, 0x1144144, 0x1144153, 0x1144162, 0x1144171,
+	0x1144216, 0x1144225, 0x1144234, 0x1144243, 0x1144252, 0x1144261, 0x1144315, 0x1144324,
+	0x1144333, 0x1144342, 0x1144351, 0x1144414, 0x1144423, 0x1144432, 0x1144441, 0x1144513,
+	0x1144522, 0x1144531, 0x1144612, 0x1144621, 0x1144711, 0x1145116, 0x1145125, 0x1145134,
+	0x1145143, 0x1145152, 0x1145161, 0x1145215, 0x1145224, 0x1145233, 0x1145242, 0x1145251,
+	0x1145314, 0x1145323, 0x1145332, 0x1145341, 0x1145413, 0x1145422, 0x1145431, 0x1145512,
+	0x1145521, 0x1145611, 0x1146115, 0x1146124, 0x1146133, 0x1146142, 0x1146151, 0x1146214,
+	0x1146223, 0x1146232, 0x1146241, 0x1146313, 0x1146322, 0x1146331, 0x1146412, 0x1146421,
+	0x1146511, 0x1147114, 0x1147123, 0x1147132, 0x1147141, 0x1147213, 0x1147222, 0x1147231,
+	0x1147312, 0x1147321, 0x1147411, 0x1148113, 0x1148122, 0x1148131, 0x1148212, 0x1148221,
+	0x1148311, 0x1151128, 0x1151137, 0x1151146, 0x1151155, 0x1151164, 0x1151173, 0x1151182,
+	0x1151218, 0x1151227, 0x1151236, 0x1151245, 0x1151254, 0x1151263, 0x1151272, 0x1151281,
+	0x1151317, 0x1151326, 0x1151335, 0x1151344, 0x1151353, 0x1151362, 0x1151371, 0x1151416,
+	0x1151425, 0x1151434, 0x1151443, 0x1151452, 0x1151461, 0x1151515, 0x1151524, 0x1151533,
+	0x1151542, 0x1151551, 0x1151614, 0x1151623, 0x1151632, 0x1151641, 0x1151713, 0x1151722,
+	0x1151731, 0x1151812, 0x1151821, 0x1152118, 0x1152127, 0x1152136, 0x1152145, 0x1152154,
+	0x1152163, 0x1152172, 0x1152181, 0x1152217, 0x1152226, 0x1152235, 0x1152244, 0x1152253,
+	0x1152262, 0x1152271, 0x1152316, 0x1152325, 0x1152334, 0x1152343, 0x1152352, 0x1152361,
+	0x1152415, 0x1152424, 0x1152433, 0x1152442, 0x1152451, 0x1152514, 0x1152523, 0x1152532,
+	0x1152541, 0x1152613, 0x1152622, 0x1152631, 0x1152712, 0x1152721, 0x1152811, 0x1153117,
+	0x1153126, 0x1153135, 0x1153144, 0x1153153, 0x1153162, 0x1153171, 0x1153216, 0x1153225,
+	0x1153234, 0x1153243, 0x1153252, 0x1153261, 0x1153315, 0x1153324, 0x1153333, 0x1153342,
+	0x1153351, 0x1153414, 0x1153423, 0x1153432, 0x1153441, 0x1153513, 0x1153522, 0x1153531,
+	0x1153612, 0x1153621, 0x1153711, 0x1154116, 0x1154125, 0x1154134, 0x1154143, 0x1154152,
+	0x1154161, 0x1154215, 0x1154224, 0x1154233, 0x1154242, 0x1154251, 0x1154314, 0x1154323,
+	0x1154332, 0x1154341, 0x1154413, 0x1154422, 0x1154431, 0x1154512, 0x1154521, 0x1154611,
+	0x1155115, 0x1155124, 0x1155133, 0x1155142, 0x1155151, 0x1155214, 0x1155223, 0x1155232,
+	0x1155241, 0x1155313, 0x1155322, 0x1155331, 0x1155412, 0x1155421, 0x1155511, 0x1156114,
+	0x1156123, 0x1156132, 0x1156141, 0x1156213, 0x1156222, 0x1156231, 0x1156312, 0x1156321,
+	0x1156411, 0x1157113, 0x1157122, 0x1157131, 0x1157212, 0x1157221, 0x1157311, 0x1158112,
+	0x1158121, 0x1158211, 0x1161118, 0x1161127, 0x1161136, 0x1161145, 0x1161154, 0x1161163,
+	0x1161172, 0x1161181, 0x1161217, 0x1161226, 0x1161235, 0x1161244, 0x1161253, 0x1161262,
+	0x1161271, 0x1161316, 0x1161325, 0x1161334, 0x1161343, 0x1161352, 0x1161361, 0x1161415,
+	0x1161424, 0x1161433, 0x1161442, 0x1161451, 0x1161514, 0x1161523, 0x1161532, 0x1161541,
+	0x1161613, 0x1161622, 0x1161631, 0x1161712, 0x1161721, 0x1161811, 0x1162117, 0x1162126,
+	0x1162135, 0x1162144, 0x1162153, 0x1162162, 0x1162171, 0x1162216, 0x1162225, 0x1162234,
+	0x1162243, 0x1162252, 0x1162261, 0x1162315, 0x1162324, 0x1162333, 0x1162342, 0x1162351,
+	0x1162414, 0x1162423, 0x1162432, 0x1162441, 0x1162513, 0x1162522, 0x1162531, 0x1162612,
+	0x1162621, 0x1162711, 0x1163116, 0x1163125, 0x1163134, 0x1163143, 0x1163152, 0x1163161,
+	0x1163215, 0x1163224, 0x1163233, 0x1163242, 0x1163251, 0x1163314, 0x1163323, 0x1163332,
+	0x1163341, 0x1163413, 0x1163422, 0x1163431, 0x1163512, 0x1163521, 0x1163611, 0x1164115,
+	0x1164124, 0x1164133, 0x1164142, 0x1164151, 0x1164214, 0x1164223, 0x1164232, 0x1164241,
+	0x1164313, 0x1164322, 0x1164331, 0x1164412, 0x1164421, 0x1164511, 0x1165114, 0x1165123,
+	0x1165132, 0x1165141, 0x1165213, 0x1165222, 0x1165231, 0x1165312, 0x1165321, 0x1165411,
+	0x1166113, 0x1166122, 0x1166131, 0x1166212, 0x1166221, 0x1166311, 0x1167112, 0x1167121,
+	0x1167211, 0x1168111, 0x1171117, 0x1171126, 0x1171135, 0x1171144, 0x1171153, 0x1171162,
+	0x1171171, 0x1171216, 0x1171225, 0x1171234, 0x1171243, 0x1171252, 0x1171261, 0x1171315,
+	0x1171324, 0x1171333, 0x1171342, 0x1171351, 0x1171414, 0x1171423, 0x1171432, 0x1171441,
+	0x1171513, 0x1171522, 0x1171531, 0x1171612, 0x1171621, 0x1171711, 0x1172116, 0x1172125,
+	0x1172134, 0x1172143, 0x1172152, 0x1172161, 0x1172215, 0x1172224, 0x1172233, 0x1172242,
+	0x1172251, 0x1172314, 0x1172323, 0x1172332, 0x1172341, 0x1172413, 0x1172422, 0x1172431,
+	0x1172512, 0x1172521, 0x1172611, 0x1173115, 0x1173124, 0x1173133, 0x1173142, 0x1173151,
+	0x1173214, 0x1173223, 0x1173232, 0x1173241, 0x1173313, 0x1173322, 0x1173331, 0x1173412,
+	0x1173421, 0x1173511, 0x1174114, 0x1174123, 0x1174132, 0x1174141, 0x1174213, 0x1174222,
+	0x1174231, 0x1174312, 0x1174321, 0x1174411, 0x1175113, 0x1175122, 0x1175131, 0x1175212,
+	0x1175221, 0x1175311, 0x1176112, 0x1176121, 0x1176211, 0x1177111, 0x1181116, 0x1181125,
+	0x1181134, 0x1181143, 0x1181152, 0x1181161, 0x1181215, 0x1181224, 0x1181233, 0x1181242,
+	0x1181251, 0x1181314, 0x1181323, 0x1181332, 0x1181341, 0x1181413, 0x1181422, 0x1181431,
+	0x1181512, 0x1181521, 0x1181611, 0x1182115, 0x1182124, 0x1182133, 0x1182142, 0x1182151,
+	0x1182214, 0x1182223, 0x1182232, 0x1182241, 0x1182313, 0x1182322, 0x1182331, 0x1182412,
+	0x1182421, 0x1182511, 0x1183114, 0x1183123, 0x1183132, 0x1183141, 0x1183213, 0x1183222,
+	0x1183231, 0x1183312, 0x1183321, 0x1183411, 0x1184113, 0x1184122, 0x1184131, 0x1184212,
+	0x1184221, 0x1184311, 0x1185112, 0x1185121, 0x1185211, 0x1186111, 0x1211158, 0x1211167,
+	0x1211176, 0x1211185, 0x1211248, 0x1211257, 0x1211266, 0x1211275, 0x1211284, 0x1211338,
+	0x1211347, 0x1211356, 0x1211365, 0x1211374, 0x1211383, 0x1211428, 0x1211437, 0x1211446,
+	0x1211455, 0x1211464, 0x1211473, 0x1211482, 0x1211518, 0x1211527, 0x1211536, 0x1211545,
+	0x1211554, 0x1211563, 0x1211572, 0x1211581, 0x1211617, 0x1211626, 0x1211635, 0x1211644,
+	0x1211653, 0x1211662, 0x1211671, 0x1211716, 0x1211725, 0x1211734, 0x1211743, 0x1211752,
+	0x1211761, 0x1211815, 0x1211824, 0x1211833, 0x1211842, 0x1211851, 0x1212148, 0x1212157,
+	0x1212166, 0x1212175, 0x1212184, 0x1212238, 0x1212247, 0x1212256, 0x1212265, 0x1212274,
+	0x1212283, 0x1212328, 0x1212337, 0x1212346, 0x1212355, 0x1212364, 0x1212373, 0x1212382,
+	0x1212418, 0x1212427, 0x1212436, 0x1212445, 0x1212454, 0x1212463, 0x1212472, 0x1212481,
+	0x1212517, 0x1212526, 0x1212535, 0x1212544, 0x1212553, 0x1212562, 0x1212571, 0x1212616,
+	0x1212625, 0x1212634, 0x1212643, 0x1212652, 0x1212661, 0x1212715, 0x1212724, 0x1212733,
+	0x1212742, 0x1212751, 0x1212814, 0x1212823, 0x1212832, 0x1212841, 0x1213138, 0x1213147,
+	0x1213156, 0x1213165, 0x1213174, 0x1213183, 0x1213228, 0x1213237, 0x1213246, 0x1213255,
+	0x1213264, 0x1213273, 0x1213282, 0x1213318, 0x1213327, 0x1213336, 0x1213345, 0x1213354,
+	0x1213363, 0x1213372, 0x1213381, 0x1213417, 0x1213426, 0x1213435, 0x1213444, 0x1213453,
+	0x1213462, 0x1213471, 0x1213516, 0x1213525, 0x1213534, 0x1213543, 0x1213552, 0x1213561,
+	0x1213615, 0x1213624, 0x1213633, 0x1213642, 0x1213651, 0x1213714, 0x1213723, 0x1213732,
+	0x1213741, 0x1213813, 0x1213822, 0x1213831, 0x1214128, 0x1214137, 0x1214146, 0x1214155,
+	0x1214164, 0x1214173, 0x1214182, 0x1214218, 0x1214227, 0x1214236, 0x1214245, 0x1214254,
+	0x1214263, 0x1214272, 0x1214281, 0x1214317, 0x1214326, 0x1214335, 0x1214344, 0x1214353,
+	0x1214362, 0x1214371, 0x1214416, 0x1214425, 0x1214434, 0x1214443, 0x1214452, 0x1214461,
+	0x1214515, 0x1214524, 0x1214533, 0x1214542, 0x1214551, 0x1214614, 0x1214623, 0x1214632,
+	0x1214641, 0x1214713, 0x1214722, 0x1214731, 0x1214812, 0x1214821, 0x1215118, 0x1215127,
+	0x1215136, 0x1215145, 0x1215154, 0x1215163, 0x1215172, 0x1215181, 0x1215217, 0x1215226,
+	0x1215235, 0x1215244, 0x1215253, 0x1215262, 0x1215271, 0x1215316, 0x1215325, 0x1215334,
+	0x1215343, 0x1215352, 0x1215361, 0x1215415, 0x1215424, 0x1215433, 0x1215442, 0x1215451,
+	0x1215514, 0x1215523, 0x1215532, 0x1215541, 0x1215613, 0x1215622, 0x1215631, 0x1215712,
+	0x1215721, 0x1215811, 0x1216117, 0x1216126, 0x1216135, 0x1216144, 0x1216153, 0x1216162,
+	0x1216171, 0x1216216, 0x1216225, 0x1216234, 0x1216243, 0x1216252, 0x1216261, 0x1216315,
+	0x1216324, 0x1216333, 0x1216342, 0x1216351, 0x1216414, 0x1216423, 0x1216432, 0x1216441,
+	0x1216513, 0x1216522, 0x1216531, 0x1216612, 0x1216621, 0x1216711, 0x1217116, 0x1217125,
+	0x1217134, 0x1217143, 0x1217152, 0x1217161, 0x1217215, 0x1217224, 0x1217233, 0x1217242,
+	0x1217251, 0x1217314, 0x1217323, 0x1217332, 0x1217341, 0x1217413, 0x1217422, 0x1217431,
+	0x1217512, 0x1217521, 0x1217611, 0x1218115, 0x1218124, 0x1218133, 0x1218142, 0x1218151,
+	0x1218214, 0x1218223, 0x1218232, 0x1218241, 0x1218313, 0x1218322, 0x1218331, 0x1218412,
+	0x1218421, 0x1218511, 0x1221148, 0x1221157, 0x1221166, 0x1221175, 0x1221184, 0x1221238,
+	0x1221247, 0x1221256, 0x1221265, 0x1221274, 0x1221283, 0x1221328, 0x1221337, 0x1221346,
+	0x1221355, 0x1221364, 0x1221373, 0x1221382, 0x1221418, 0x1221427, 0x1221436, 0x1221445,
+	0x1221454, 0x1221463, 0x1221472, 0x1221481, 0x1221517, 0x1221526, 0x1221535, 0x1221544,
+	0x1221553, 0x1221562, 0x1221571, 0x1221616, 0x1221625, 0x1221634, 0x1221643, 0x1221652,
+	0x1221661, 0x1221715, 0x1221724, 0x1221733, 0x1221742, 0x1221751, 0x1221814, 0x1221823,
+	0x1221832, 0x1221841, 0x1222138, 0x1222147, 0x1222156, 0x1222165, 0x1222174, 0x1222183,
+	0x1222228, 0x1222237, 0x1222246, 0x1222255, 0x1222264, 0x1222273, 0x1222282, 0x1222318,
+	0x1222327, 0x1222336, 0x1222345, 0x1222354, 0x1222363, 0x1222372, 0x1222381, 0x1222417,
+	0x1222426, 0x1222435, 0x1222444, 0x1222453, 0x1222462, 0x1222471, 0x1222516, 0x1222525,
+	0x1222534, 0x1222543, 0x1222552, 0x1222561, 0x1222615, 0x1222624, 0x1222633, 0x1222642,
+	0x1222651, 0x1222714, 0x1222723, 0x1222732, 0x1222741, 0x1222813, 0x1222822, 0x1222831,
+	0x1223128, 0x1223137, 0x1223146, 0x1223155, 0x1223164, 0x1223173, 0x1223182, 0x1223218,
+	0x1223227, 0x1223236, 0x1223245, 0x1223254, 0x1223263, 0x1223272, 0x1223281, 0x1223317,
+	0x1223326, 0x1223335, 0x1223344, 0x1223353, 0x1223362, 0x1223371, 0x1223416, 0x1223425,
+	0x1223434, 0x1223443, 0x1223452, 0x1223461, 0x1223515, 0x1223524, 0x1223533, 0x1223542,
+	0x1223551, 0x1223614, 0x1223623, 0x1223632, 0x1223641, 0x1223713, 0x1223722, 0x1223731,
+	0x1223812, 0x1223821, 0x1224118, 0x1224127, 0x1224136, 0x1224145, 0x1224154, 0x1224163,
+	0x1224172, 0x1224181, 0x1224217, 0x1224226, 0x1224235, 0x1224244, 0x1224253, 0x1224262,
+	0x1224271, 0x1224316, 0x1224325, 0x1224334, 0x1224343, 0x1224352, 0x1224361, 0x1224415,
+	0x1224424, 0x1224433, 0x1224442, 0x1224451, 0x1224514, 0x1224523, 0x1224532, 0x1224541,
+	0x1224613, 0x1224622, 0x1224631, 0x1224712, 0x1224721, 0x1224811, 0x1225117, 0x1225126,
+	0x1225135, 0x1225144, 0x1225153, 0x1225162, 0x1225171, 0x1225216, 0x1225225, 0x1225234,
+	0x1225243, 0x1225252, 0x1225261, 0x1225315, 0x1225324, 0x1225333, 0x1225342, 0x1225351,
+	0x1225414, 0x1225423, 0x1225432, 0x1225441, 0x1225513, 0x1225522, 0x1225531, 0x1225612,
+	0x1225621, 0x1225711, 0x1226116, 0x1226125, 0x1226134, 0x1226143, 0x1226152, 0x1226161,
+	0x1226215, 0x1226224, 0x1226233, 0x1226242, 0x1226251, 0x1226314, 0x1226323, 0x1226332,
+	0x1226341, 0x1226413, 0x1226422, 0x1226431, 0x1226512, 0x1226521, 0x1226611, 0x1227115,
+	0x1227124, 0x1227133, 0x1227142, 0x1227151, 0x1227214, 0x1227223, 0x1227232, 0x1227241,
+	0x1227313, 0x1227322, 0x1227331, 0x1227412, 0x1227421, 0x1227511, 0x1228114, 0x1228123,
+	0x1228132, 0x1228141, 0x1228213, 0x1228222, 0x1228231, 0x1228312, 0x1228321, 0x1228411,
+	0x1231138, 0x1231147, 0x1231156, 0x1231165, 0x1231174, 0x1231183, 0x1231228, 0x1231237,
+	0x1231246, 0x1231255, 0x1231264, 0x1231273, 0x1231282, 0x1231318, 0x1231327, 0x1231336,
+	0x1231345, 0x1231354, 0x1231363, 0x1231372, 0x1231381, 0x1231417, 0x1231426, 0x1231435,
+	0x1231444, 0x1231453, 0x1231462, 0x1231471, 0x1231516, 0x1231525, 0x1231534, 0x1231543,
+	0x1231552, 0x1231561, 0x1231615, 0x1231624, 0x1231633, 0x1231642, 0x1231651, 0x1231714,
+	0x1231723, 0x1231732, 0x1231741, 0x1231813, 0x1231822, 0x1231831, 0x1232128, 0x1232137,
+	0x1232146, 0x1232155, 0x1232164, 0x1232173, 0x1232182, 0x1232218, 0x1232227, 0x1232236,
+	0x1232245, 0x1232254, 0x1232263, 0x1232272, 0x1232281, 0x1232317, 0x1232326, 0x1232335,
+	0x1232344, 0x1232353, 0x1232362, 0x1232371, 0x1232416, 0x1232425, 0x1232434, 0x1232443,
+	0x1232452, 0x1232461, 0x1232515, 0x1232524, 0x1232533, 0x1232542, 0x1232551, 0x1232614,
+	0x1232623, 0x1232632, 0x1232641, 0x1232713, 0x1232722, 0x1232731, 0x1232812, 0x1232821,
+	0x1233118, 0x1233127, 0x1233136, 0x1233145, 0x1233154, 0x1233163, 0x1233172, 0x1233181,
+	0x1233217, 0x1233226, 0x1233235, 0x1233244, 0x1233253, 0x1233262, 0x1233271, 0x1233316,
+	0x1233325, 0x1233334, 0x1233343, 0x1233352, 0x1233361, 0x1233415, 0x1233424, 0x1233433,
+	0x1233442, 0x1233451, 0x1233514, 0x1233523, 0x1233532, 0x1233541, 0x1233613, 0x1233622,
+	0x1233631, 0x1233712, 0x1233721, 0x1233811, 0x1234117, 0x1234126, 0x1234135, 0x1234144,
+	0x1234153, 0x1234162, 0x1234171, 0x1234216, 0x1234225, 0x1234234, 0x1234243, 0x1234252,
+	0x1234261, 0x1234315, 0x1234324, 0x1234333, 0x1234342, 0x1234351, 0x1234414, 0x1234423,
+	0x1234432, 0x1234441, 0x1234513, 0x1234522, 0x1234531, 0x1234612, 0x1234621, 0x1234711,
+	0x1235116, 0x1235125, 0x1235134, 0x1235143, 0x1235152, 0x1235161, 0x1235215, 0x1235224,
+	0x1235233, 0x1235242, 0x1235251, 0x1235314, 0x1235323, 0x1235332, 0x1235341, 0x1235413,
+	0x1235422, 0x1235431, 0x1235512, 0x1235521, 0x1235611, 0x1236115, 0x1236124, 0x1236133,
+	0x1236142, 0x1236151, 0x1236214, 0x1236223, 0x1236232, 0x1236241, 0x1236313, 0x1236322,
+	0x1236331, 0x1236412, 0x1236421, 0x1236511, 0x1237114, 0x1237123, 0x1237132, 0x1237141,
+	0x1237213, 0x1237222, 0x1237231, 0x1237312, 0x1237321, 0x1237411, 0x1238113, 0x1238122,
+	0x1238131, 0x1238212, 0x1238221, 0x1238311, 0x1241128, 0x1241137, 0x1241146, 0x1241155,
+	0x1241164, 0x1241173, 0x1241182, 0x1241218, 0x1241227, 0x1241236, 0x1241245, 0x1241254,
+	0x1241263, 0x1241272, 0x1241281, 0x1241317, 0x1241326, 0x1241335, 0x1241344, 0x1241353,
+	0x1241362, 0x1241371, 0x1241416, 0x1241425, 0x1241434, 0x1241443, 0x1241452, 0x1241461,
+	0x1241515, 0x1241524, 0x1241533, 0x1241542, 0x1241551, 0x1241614, 0x1241623, 0x1241632,
+	0x1241641, 0x1241713, 0x1241722, 0x1241731, 0x1241812, 0x1241821, 0x1242118, 0x1242127,
+	0x1242136, 0x1242145, 0x1242154, 0x1242163, 0x1242172, 0x1242181, 0x1242217, 0x1242226,
+	0x1242235, 0x1242244, 0x1242253, 0x1242262, 0x1242271, 0x1242316, 0x1242325, 0x1242334,
+	0x1242343, 0x1242352, 0x1242361, 0x1242415, 0x1242424, 0x1242433, 0x1242442, 0x1242451,
+	0x1242514, 0x1242523, 0x1242532, 0x1242541, 0x1242613, 0x1242622, 0x1242631, 0x1242712,
+	0x1242721, 0x1242811, 0x1243117, 0x1243126, 0x1243135, 0x1243144, 0x1243153, 0x1243162,
+	0x1243171, 0x1243216, 0x1243225, 0x1243234, 0x1243243, 0x1243252, 0x1243261, 0x1243315,
+	0x1243324, 0x1243333, 0x1243342, 0x1243351, 0x1243414, 0x1243423, 0x1243432, 0x1243441,
+	0x1243513, 0x1243522, 0x1243531, 0x1243612, 0x1243621, 0x1243711, 0x1244116, 0x1244125,
+	0x1244134, 0x1244143, 0x1244152, 0x1244161, 0x1244215, 0x1244224, 0x1244233, 0x1244242,
+	0x1244251, 0x1244314, 0x1244323, 0x1244332, 0x1244341, 0x1244413, 0x1244422, 0x1244431,
+	0x1244512, 0x1244521, 0x1244611, 0x1245115, 0x1245124, 0x1245133, 0x1245142, 0x1245151,
+	0x1245214, 0x1245223, 0x1245232, 0x1245241, 0x1245313, 0x1245322, 0x1245331, 0x1245412,
+	0x1245421, 0x1245511, 0x1246114, 0x1246123, 0x1246132, 0x1246141, 0x1246213, 0x1246222,
+	0x1246231, 0x1246312, 0x1246321, 0x1246411, 0x1247113, 0x1247122, 0x1247131, 0x1247212,
+	0x1247221, 0x1247311, 0x1248112, 0x1248121, 0x1248211, 0x1251118, 0x1251127, 0x1251136,
+	0x1251145, 0x1251154, 0x1251163, 0x1251172, 0x1251181, 0x1251217, 0x1251226, 0x1251235,
+	0x1251244, 0x1251253, 0x1251262, 0x1251271, 0x1251316, 0x1251325, 0x1251334, 0x1251343,
+	0x1251352, 0x1251361, 0x1251415, 0x1251424, 0x1251433, 0x1251442, 0x1251451, 0x1251514,
+	0x1251523, 0x1251532, 0x1251541, 0x1251613, 0x1251622, 0x1251631, 0x1251712, 0x1251721,
+	0x1251811, 0x1252117, 0x1252126, 0x1252135, 0x1252144, 0x1252153, 0x1252162, 0x1252171,
+	0x1252216, 0x1252225, 0x1252234, 0x1252243, 0x1252252, 0x1252261, 0x1252315, 0x1252324,
+	0x1252333, 0x1252342, 0x1252351, 0x1252414, 0x1252423, 0x1252432, 0x1252441, 0x1252513,
+	0x1252522, 0x1252531, 0x1252612, 0x1252621, 0x1252711, 0x1253116, 0x1253125, 0x1253134,
+	0x1253143, 0x1253152, 0x1253161, 0x1253215, 0x1253224, 0x1253233, 0x1253242, 0x1253251,
+	0x1253314, 0x1253323, 0x1253332, 0x1253341, 0x1253413, 0x1253422, 0x1253431, 0x1253512,
+	0x1253521, 0x1253611, 0x1254115, 0x1254124, 0x1254133, 0x1254142, 0x1254151, 0x1254214,
+	0x1254223, 0x1254232, 0x1254241, 0x1254313, 0x1254322, 0x1254331, 0x1254412, 0x1254421,
+	0x1254511, 0x1255114, 0x1255123, 0x1255132, 0x1255141, 0x1255213, 0x1255222, 0x1255231,
+	0x1255312, 0x1255321, 0x1255411, 0x1256113, 0x1256122, 0x1256131, 0x1256212, 0x1256221,
+	0x1256311, 0x1257112, 0x1257121, 0x1257211, 0x1258111, 0x1261117, 0x1261126, 0x1261135,
+	0x1261144, 0x1261153, 0x1261162, 0x1261171, 0x1261216, 0x1261225, 0x1261234, 0x1261243,
+	0x1261252, 0x1261261, 0x1261315, 0x1261324, 0x1261333, 0x1261342, 0x1261351, 0x1261414,
+	0x1261423, 0x1261432, 0x1261441, 0x1261513, 0x1261522, 0x1261531, 0x1261612, 0x1261621,
+	0x1261711, 0x1262116, 0x1262125, 0x1262134, 0x1262143, 0x1262152, 0x1262161, 0x1262215,
+	0x1262224, 0x1262233, 0x1262242, 0x1262251, 0x1262314, 0x1262323, 0x1262332, 0x1262341,
+	0x1262413, 0x1262422, 0x1262431, 0x1262512, 0x1262521, 0x1262611, 0x1263115, 0x1263124,
+	0x1263133, 0x1263142, 0x1263151, 0x1263214, 0x1263223, 0x1263232, 0x1263241, 0x1263313,
+	0x1263322, 0x1263331, 0x1263412, 0x1263421, 0x1263511, 0x1264114, 0x1264123, 0x1264132,
+	0x1264141, 0x1264213, 0x1264222, 0x1264231, 0x1264312, 0x1264321, 0x1264411, 0x1265113,
+	0x1265122, 0x1265131, 0x1265212, 0x1265221, 0x1265311, 0x1266112, 0x1266121, 0x1266211,
+	0x1267111, 0x1271116, 0x1271125, 0x1271134, 0x1271143, 0x1271152, 0x1271161, 0x1271215,
+	0x1271224, 0x1271233, 0x1271242, 0x1271251, 0x1271314, 0x1271323, 0x1271332, 0x1271341,
+	0x1271413, 0x1271422, 0x1271431, 0x1271512, 0x1271521, 0x1271611, 0x1272115, 0x1272124,
+	0x1272133, 0x1272142, 0x1272151, 0x1272214, 0x1272223, 0x1272232, 0x1272241, 0x1272313,
+	0x1272322, 0x1272331, 0x1272412, 0x1272421, 0x1272511, 0x1273114, 0x1273123, 0x1273132,
+	0x1273141, 0x1273213, 0x1273222, 0x1273231, 0x1273312, 0x1273321, 0x1273411, 0x1274113,
+	0x1274122, 0x1274131, 0x1274212, 0x1274221, 0x1274311, 0x1275112, 0x1275121, 0x1275211,
+	0x1276111, 0x1281115, 0x1281124, 0x1281133, 0x1281142, 0x1281151, 0x1281214, 0x1281223,
+	0x1281232, 0x1281241, 0x1281313, 0x1281322, 0x1281331, 0x1281412, 0x1281421, 0x1281511,
+	0x1282114, 0x1282123, 0x1282132, 0x1282141, 0x1282213, 0x1282222, 0x1282231, 0x1282312,
+	0x1282321, 0x1282411, 0x1283113, 0x1283122, 0x1283131, 0x1283212, 0x1283221, 0x1283311,
+	0x1284112, 0x1284121, 0x1284211, 0x1285111, 0x1311148, 0x1311157, 0x1311166, 0x1311175,
+	0x1311184, 0x1311238, 0x1311247, 0x1311256, 0x1311265, 0x1311274, 0x1311283, 0x1311328,
+	0x1311337, 0x1311346, 0x1311355, 0x1311364, 0x1311373, 0x1311382, 0x1311418, 0x1311427,
+	0x1311436, 0x1311445, 0x1311454, 0x1311463, 0x1311472, 0x1311481, 0x1311517, 0x1311526,
+	0x1311535, 0x1311544, 0x1311553, 0x1311562, 0x1311571, 0x1311616, 0x1311625, 0x1311634,
+	0x1311643, 0x1311652, 0x1311661, 0x1311715, 0x1311724, 0x1311733, 0x1311742, 0x1311751,
+	0x1311814, 0x1311823, 0x1311832, 0x1311841, 0x1312138, 0x1312147, 0x1312156, 0x1312165,
+	0x1312174, 0x1312183, 0x1312228, 0x1312237, 0x1312246, 0x1312255, 0x1312264, 0x1312273,
+	0x1312282, 0x1312318, 0x1312327, 0x1312336, 0x1312345, 0x1312354, 0x1312363, 0x1312372,
+	0x1312381, 0x1312417, 0x1312426, 0x1312435, 0x1312444, 0x1312453, 0x1312462, 0x1312471,
+	0x1312516, 0x1312525, 0x1312534, 0x1312543, 0x1312552, 0x1312561, 0x1312615, 0x1312624,
+	0x1312633, 0x1312642, 0x1312651, 0x1312714, 0x1312723, 0x1312732, 0x1312741, 0x1312813,
+	0x1312822, 0x1312831, 0x1313128, 0x1313137, 0x1313146, 0x1313155, 0x1313164, 0x1313173,
+	0x1313182, 0x1313218, 0x1313227, 0x1313236, 0x1313245, 0x1313254, 0x1313263, 0x1313272,
+	0x1313281, 0x1313317, 0x1313326, 0x1313335, 0x1313344, 0x1313353, 0x1313362, 0x1313371,
+	0x1313416, 0x1313425, 0x1313434, 0x1313443, 0x1313452, 0x1313461, 0x1313515, 0x1313524,
+	0x1313533, 0x1313542, 0x1313551, 0x1313614, 0x1313623, 0x1313632, 0x1313641, 0x1313713,
+	0x1313722, 0x1313731, 0x1313812, 0x1313821, 0x1314118, 0x1314127, 0x1314136, 0x1314145,
+	0x1314154, 0x1314163, 0x1314172, 0x1314181, 0x1314217, 0x1314226, 0x1314235, 0x1314244,
+	0x1314253, 0x1314262, 0x1314271, 0x1314316, 0x1314325, 0x1314334, 0x1314343, 0x1314352,
+	0x1314361, 0x1314415, 0x1314424, 0x1314433, 0x1314442, 0x1314451, 0x1314514, 0x1314523,
+	0x1314532, 0x1314541, 0x1314613, 0x1314622, 0x1314631, 0x1314712, 0x1314721, 0x1314811,
+	0x1315117, 0x1315126, 0x1315135, 0x1315144, 0x1315153, 0x1315162, 0x1315171, 0x1315216,
+	0x1315225, 0x1315234, 0x1315243, 0x1315252, 0x1315261, 0x1315315, 0x1315324, 0x1315333,
+	0x1315342, 0x1315351, 0x1315414, 0x1315423, 0x1315432, 0x1315441, 0x1315513, 0x1315522,
+	0x1315531, 0x1315612, 0x1315621, 0x1315711, 0x1316116, 0x1316125, 0x1316134, 0x1316143,
+	0x1316152, 0x1316161, 0x1316215, 0x1316224, 0x1316233, 0x1316242, 0x1316251, 0x1316314,
+	0x1316323, 0x1316332, 0x1316341, 0x1316413, 0x1316422, 0x1316431, 0x1316512, 0x1316521,
+	0x1316611, 0x1317115, 0x1317124, 0x1317133, 0x1317142, 0x1317151, 0x1317214, 0x1317223,
+	0x1317232, 0x1317241, 0x1317313, 0x1317322, 0x1317331, 0x1317412, 0x1317421, 0x1317511,
+	0x1318114, 0x1318123, 0x1318132, 0x1318141, 0x1318213, 0x1318222, 0x1318231, 0x1318312,
+	0x1318321, 0x1318411, 0x1321138, 0x1321147, 0x1321156, 0x1321165, 0x1321174, 0x1321183,
+	0x1321228, 0x1321237, 0x1321246, 0x1321255, 0x1321264, 0x1321273, 0x1321282, 0x1321318,
+	0x1321327, 0x1321336, 0x1321345, 0x1321354, 0x1321363, 0x1321372, 0x1321381, 0x1321417,
+	0x1321426, 0x1321435, 0x1321444, 0x1321453, 0x1321462, 0x1321471, 0x1321516, 0x1321525,
+	0x1321534, 0x1321543, 0x1321552, 0x1321561, 0x1321615, 0x1321624, 0x1321633, 0x1321642,
+	0x1321651, 0x1321714, 0x1321723, 0x1321732, 0x1321741, 0x1321813, 0x1321822, 0x1321831,
+	0x1322128, 0x1322137, 0x1322146, 0x1322155, 0x1322164, 0x1322173, 0x1322182, 0x1322218,
+	0x1322227, 0x1322236, 0x1322245, 0x1322254, 0x1322263, 0x1322272, 0x1322281, 0x1322317,
+	0x1322326, 0x1322335, 0x1322344, 0x1322353, 0x1322362, 0x1322371, 0x1322416, 0x1322425,
+	0x1322434, 0x1322443, 0x1322452, 0x1322461, 0x1322515, 0x1322524, 0x1322533, 0x1322542,
+	0x1322551, 0x1322614, 0x1322623, 0x1322632, 0x1322641, 0x1322713, 0x1322722, 0x1322731,
+	0x1322812, 0x1322821, 0x1323118, 0x1323127, 0x1323136, 0x1323145, 0x1323154, 0x1323163,
+	0x1323172, 0x1323181, 0x1323217, 0x1323226, 0x1323235, 0x1323244, 0x1323253, 0x1323262,
+	0x1323271, 0x1323316, 0x1323325, 0x1323334, 0x1323343, 0x1323352, 0x1323361, 0x1323415,
+	0x1323424, 0x1323433, 0x1323442, 0x1323451, 0x1323514, 0x1323523, 0x1323532, 0x1323541,
+	0x1323613, 0x1323622, 0x1323631, 0x1323712, 0x1323721, 0x1323811, 0x1324117, 0x1324126,
+	0x1324135, 0x1324144, 0x1324153, 0x1324162, 0x1324171, 0x1324216, 0x1324225, 0x1324234,
+	0x1324243, 0x1324252, 0x1324261, 0x1324315, 0x1324324, 0x1324333, 0x1324342, 0x1324351,
+	0x1324414, 0x1324423, 0x1324432, 0x1324441, 0x1324513, 0x1324522, 0x1324531, 0x1324612,
+	0x1324621, 0x1324711, 0x1325116, 0x1325125, 0x1325134, 0x1325143, 0x1325152, 0x1325161,
+	0x1325215, 0x1325224, 0x1325233, 0x1325242, 0x1325251, 0x1325314, 0x1325323, 0x1325332,
+	0x1325341, 0x1325413, 0x1325422, 0x1325431, 0x1325512, 0x1325521, 0x1325611, 0x1326115,
+	0x1326124, 0x1326133, 0x1326142, 0x1326151, 0x1326214, 0x1326223, 0x1326232, 0x1326241,
+	0x1326313, 0x1326322, 0x1326331, 0x1326412, 0x1326421, 0x1326511, 0x1327114, 0x1327123,
+	0x1327132, 0x1327141, 0x1327213, 0x1327222, 0x1327231, 0x1327312, 0x1327321, 0x1327411,
+	0x1328113, 0x1328122, 0x1328131, 0x1328212, 0x1328221, 0x1328311, 0x1331128, 0x1331137,
+	0x1331146, 0x1331155, 0x1331164, 0x1331173, 0x1331182, 0x1331218, 0x1331227, 0x1331236,
+	0x1331245, 0x1331254, 0x1331263, 0x1331272, 0x1331281, 0x1331317, 0x1331326, 0x1331335,
+	0x1331344, 0x1331353, 0x1331362, 0x1331371, 0x1331416, 0x1331425, 0x1331434, 0x1331443,
+	0x1331452, 0x1331461, 0x1331515, 0x1331524, 0x1331533, 0x1331542, 0x1331551, 0x1331614,
+	0x1331623, 0x1331632, 0x1331641, 0x1331713, 0x1331722, 0x1331731, 0x1331812, 0x1331821,
+	0x1332118, 0x1332127, 0x1332136, 0x1332145, 0x1332154, 0x1332163, 0x1332172, 0x1332181,
+	0x1332217, 0x1332226, 0x1332235, 0x1332244, 0x1332253, 0x1332262, 0x1332271, 0x1332316,
+	0x1332325, 0x1332334, 0x1332343, 0x1332352, 0x1332361, 0x1332415, 0x1332424, 0x1332433,
+	0x1332442, 0x1332451, 0x1332514, 0x1332523, 0x1332532, 0x1332541, 0x1332613, 0x1332622,
+	0x1332631, 0x1332712, 0x1332721, 0x1332811, 0x1333117, 0x1333126, 0x1333135, 0x1333144,
+	0x1333153, 0x1333162, 0x1333171, 0x1333216, 0x1333225, 0x1333234, 0x1333243, 0x1333252,
+	0x1333261, 0x1333315, 0x1333324, 0x1333333, 0x1333342, 0x1333351, 0x1333414, 0x1333423,
+	0x1333432, 0x1333441, 0x1333513, 0x1333522, 0x1333531, 0x1333612, 0x1333621, 0x1333711,
+	0x1334116, 0x1334125, 0x1334134, 0x1334143, 0x1334152, 0x1334161, 0x1334215, 0x1334224,
+	0x1334233, 0x1334242, 0x1334251, 0x1334314, 0x1334323, 0x1334332, 0x1334341, 0x1334413,
+	0x1334422, 0x1334431, 0x1334512, 0x1334521, 0x1334611, 0x1335115, 0x1335124, 0x1335133,
+	0x1335142, 0x1335151, 0x1335214, 0x1335223, 0x1335232, 0x1335241, 0x1335313, 0x1335322,
+	0x1335331, 0x1335412, 0x1335421, 0x1335511, 0x1336114, 0x1336123, 0x1336132, 0x1336141,
+	0x1336213, 0x1336222, 0x1336231, 0x1336312, 0x1336321, 0x1336411, 0x1337113, 0x1337122,
+	0x1337131, 0x1337212, 0x1337221, 0x1337311, 0x1338112, 0x1338121, 0x1338211, 0x1341118,
+	0x1341127, 0x1341136, 0x1341145, 0x1341154, 0x1341163, 0x1341172, 0x1341181, 0x1341217,
+	0x1341226, 0x1341235, 0x1341244, 0x1341253, 0x1341262, 0x1341271, 0x1341316, 0x1341325,
+	0x1341334, 0x1341343, 0x1341352, 0x1341361, 0x1341415, 0x1341424, 0x1341433, 0x1341442,
+	0x1341451, 0x1341514, 0x1341523, 0x1341532, 0x1341541, 0x1341613, 0x1341622, 0x1341631,
+	0x1341712, 0x1341721, 0x1341811, 0x1342117, 0x1342126, 0x1342135, 0x1342144, 0x1342153,
+	0x1342162, 0x1342171, 0x1342216, 0x1342225, 0x1342234, 0x1342243, 0x1342252, 0x1342261,
+	0x1342315, 0x1342324, 0x1342333, 0x1342342, 0x1342351, 0x1342414, 0x1342423, 0x1342432,
+	0x1342441, 0x1342513, 0x1342522, 0x1342531, 0x1342612, 0x1342621, 0x1342711, 0x1343116,
+	0x1343125, 0x1343134, 0x1343143, 0x1343152, 0x1343161, 0x1343215, 0x1343224, 0x1343233,
+	0x1343242, 0x1343251, 0x1343314, 0x1343323, 0x1343332, 0x1343341, 0x1343413, 0x1343422,
+	0x1343431, 0x1343512, 0x1343521, 0x1343611, 0x1344115, 0x1344124, 0x1344133, 0x1344142,
+	0x1344151, 0x1344214, 0x1344223, 0x1344232, 0x1344241, 0x1344313, 0x1344322, 0x1344331,
+	0x1344412, 0x1344421, 0x1344511, 0x1345114, 0x1345123, 0x1345132, 0x1345141, 0x1345213,
+	0x1345222, 0x1345231, 0x1345312, 0x1345321, 0x1345411, 0x1346113, 0x1346122, 0x1346131,
+	0x1346212, 0x1346221, 0x1346311, 0x1347112, 0x1347121, 0x1347211, 0x1348111, 0x1351117,
+	0x1351126, 0x1351135, 0x1351144, 0x1351153, 0x1351162, 0x1351171, 0x1351216, 0x1351225,
+	0x1351234, 0x1351243, 0x1351252, 0x1351261, 0x1351315, 0x1351324, 0x1351333, 0x1351342,
+	0x1351351, 0x1351414, 0x1351423, 0x1351432, 0x1351441, 0x1351513, 0x1351522, 0x1351531,
+	0x1351612, 0x1351621, 0x1351711, 0x1352116, 0x1352125, 0x1352134, 0x1352143, 0x1352152,
+	0x1352161, 0x1352215, 0x1352224, 0x1352233, 0x1352242, 0x1352251, 0x1352314, 0x1352323,
+	0x1352332, 0x1352341, 0x1352413, 0x1352422, 0x1352431, 0x1352512, 0x1352521, 0x1352611,
+	0x1353115, 0x1353124, 0x1353133, 0x1353142, 0x1353151, 0x1353214, 0x1353223, 0x1353232,
+	0x1353241, 0x1353313, 0x1353322, 0x1353331, 0x1353412, 0x1353421, 0x1353511, 0x1354114,
+	0x1354123, 0x1354132, 0x1354141, 0x1354213, 0x1354222, 0x1354231, 0x1354312, 0x1354321,
+	0x1354411, 0x1355113, 0x1355122, 0x1355131, 0x1355212, 0x1355221, 0x1355311, 0x1356112,
+	0x1356121, 0x1356211, 0x1357111, 0x1361116, 0x1361125, 0x1361134, 0x1361143, 0x1361152,
+	0x1361161, 0x1361215, 0x1361224, 0x1361233, 0x1361242, 0x1361251, 0x1361314, 0x1361323,
+	0x1361332, 0x1361341, 0x1361413, 0x1361422, 0x1361431, 0x1361512, 0x1361521, 0x1361611,
+	0x1362115, 0x1362124, 0x1362133, 0x1362142, 0x1362151, 0x1362214, 0x1362223, 0x1362232,
+	0x1362241, 0x1362313, 0x1362322, 0x1362331, 0x1362412, 0x1362421, 0x1362511, 0x1363114,
+	0x1363123, 0x1363132, 0x1363141, 0x1363213, 0x1363222, 0x1363231, 0x1363312, 0x1363321,
+	0x1363411, 0x1364113, 0x1364122, 0x1364131, 0x1364212, 0x1364221, 0x1364311, 0x1365112,
+	0x1365121, 0x1365211, 0x1366111, 0x1371115, 0x1371124, 0x1371133, 0x1371142, 0x1371151,
+	0x1371214, 0x1371223, 0x1371232, 0x1371241, 0x1371313, 0x1371322, 0x1371331, 0x1371412,
+	0x1371421, 0x1371511, 0x1372114, 0x1372123, 0x1372132, 0x1372141, 0x1372213, 0x1372222,
+	0x1372231, 0x1372312, 0x1372321, 0x1372411, 0x1373113, 0x1373122, 0x1373131, 0x1373212,
+	0x1373221, 0x1373311, 0x1374112, 0x1374121, 0x1374211, 0x1375111, 0x1381114, 0x1381123,
+	0x1381132, 0x1381141, 0x1381213, 0x1381222, 0x1381231, 0x1381312, 0x1381321, 0x1381411,
+	0x1382113, 0x1382122, 0x1382131, 0x1382212, 0x1382221, 0x1382311, 0x1383112, 0x1383121,
+	0x1383211, 0x1384111, 0x1411138, 0x1411147, 0x1411156, 0x1411165, 0x1411174, 0x1411183,
+	0x1411228, 0x1411237, 0x1411246, 0x1411255, 0x1411264, 0x1411273, 0x1411282, 0x1411318,
+	0x1411327, 0x1411336, 0x1411345, 0x1411354, 0x1411363, 0x1411372, 0x1411381, 0x1411417,
+	0x1411426, 0x1411435, 0x1411444, 0x1411453, 0x1411462, 0x1411471, 0x1411516, 0x1411525,
+	0x1411534, 0x1411543, 0x1411552, 0x1411561, 0x1411615, 0x1411624, 0x1411633, 0x1411642,
+	0x1411651, 0x1411714, 0x1411723, 0x1411732, 0x1411741, 0x1411813, 0x1411822, 0x1411831,
+	0x1412128, 0x1412137, 0x1412146, 0x1412155, 0x1412164, 0x1412173, 0x1412182, 0x1412218,
+	0x1412227, 0x1412236, 0x1412245, 0x1412254, 0x1412263, 0x1412272, 0x1412281, 0x1412317,
+	0x1412326, 0x1412335, 0x1412344, 0x1412353, 0x1412362, 0x1412371, 0x1412416, 0x1412425,
+	0x1412434, 0x1412443, 0x1412452, 0x1412461, 0x1412515, 0x1412524, 0x1412533, 0x1412542,
+	0x1412551, 0x1412614, 0x1412623, 0x1412632, 0x1412641, 0x1412713, 0x1412722, 0x1412731,
+	0x1412812, 0x1412821, 0x1413118, 0x1413127, 0x1413136, 0x1413145, 0x1413154, 0x1413163,
+	0x1413172, 0x1413181, 0x1413217, 0x1413226, 0x1413235, 0x1413244, 0x1413253, 0x1413262,
+	0x1413271, 0x1413316, 0x1413325, 0x1413334, 0x1413343, 0x1413352, 0x1413361, 0x1413415,
+	0x1413424, 0x1413433, 0x1413442, 0x1413451, 0x1413514, 0x1413523, 0x1413532, 0x1413541,
+	0x1413613, 0x1413622, 0x1413631, 0x1413712, 0x1413721, 0x1413811, 0x1414117, 0x1414126,
+	0x1414135, 0x1414144, 0x1414153, 0x1414162, 0x1414171, 0x1414216, 0x1414225, 0x1414234,
+	0x1414243, 0x1414252, 0x1414261, 0x1414315, 0x1414324, 0x1414333, 0x1414342, 0x1414351,
+	0x1414414, 0x1414423, 0x1414432, 0x1414441, 0x1414513, 0x1414522, 0x1414531, 0x1414612,
+	0x1414621, 0x1414711, 0x1415116, 0x1415125, 0x1415134, 0x1415143, 0x1415152, 0x1415161,
+	0x1415215, 0x1415224, 0x1415233, 0x1415242, 0x1415251, 0x1415314, 0x1415323, 0x1415332,
+	0x1415341, 0x1415413, 0x1415422, 0x1415431, 0x1415512, 0x1415521, 0x1415611, 0x1416115,
+	0x1416124, 0x1416133, 0x1416142, 0x1416151, 0x1416214, 0x1416223, 0x1416232, 0x1416241,
+	0x1416313, 0x1416322, 0x1416331, 0x1416412, 0x1416421, 0x1416511, 0x1417114, 0x1417123,
+	0x1417132, 0x1417141, 0x1417213, 0x1417222, 0x1417231, 0x1417312, 0x1417321, 0x1417411,
+	0x1418113, 0x1418122, 0x1418131, 0x1418212, 0x1418221, 0x1418311, 0x1421128, 0x1421137,
+	0x1421146, 0x1421155, 0x1421164, 0x1421173, 0x1421182, 0x1421218, 0x1421227, 0x1421236,
+	0x1421245, 0x1421254, 0x1421263, 0x1421272, 0x1421281, 0x1421317, 0x1421326, 0x1421335,
+	0x1421344, 0x1421353, 0x1421362, 0x1421371, 0x1421416, 0x1421425, 0x1421434, 0x1421443,
+	0x1421452, 0x1421461, 0x1421515, 0x1421524, 0x1421533, 0x1421542, 0x1421551, 0x1421614,
+	0x1421623, 0x1421632, 0x1421641, 0x1421713, 0x1421722, 0x1421731, 0x1421812, 0x1421821,
+	0x1422118, 0x1422127, 0x1422136, 0x1422145, 0x1422154, 0x1422163, 0x1422172, 0x1422181,
+	0x1422217, 0x1422226, 0x1422235, 0x1422244, 0x1422253, 0x1422262, 0x1422271, 0x1422316,
+	0x1422325, 0x1422334, 0x1422343, 0x1422352, 0x1422361, 0x1422415, 0x1422424, 0x1422433,
+	0x1422442, 0x1422451, 0x1422514, 0x1422523, 0x1422532, 0x1422541, 0x1422613, 0x1422622,
+	0x1422631, 0x1422712, 0x1422721, 0x1422811, 0x1423117, 0x1423126, 0x1423135, 0x1423144,
+	0x1423153, 0x1423162, 0x1423171, 0x1423216, 0x1423225, 0x1423234, 0x1423243, 0x1423252,
+	0x1423261, 0x1423315, 0x1423324, 0x1423333, 0x1423342, 0x1423351, 0x1423414, 0x1423423,
+	0x1423432, 0x1423441, 0x1423513, 0x1423522, 0x1423531, 0x1423612, 0x1423621, 0x1423711,
+	0x1424116, 0x1424125, 0x1424134, 0x1424143, 0x1424152, 0x1424161, 0x1424215, 0x1424224,
+	0x1424233, 0x1424242, 0x1424251, 0x1424314, 0x1424323, 0x1424332, 0x1424341, 0x1424413,
+	0x1424422, 0x1424431, 0x1424512, 0x1424521, 0x1424611, 0x1425115, 0x1425124, 0x1425133,
+	0x1425142, 0x1425151, 0x1425214, 0x1425223, 0x1425232, 0x1425241, 0x1425313, 0x1425322,
+	0x1425331, 0x1425412, 0x1425421, 0x1425511, 0x1426114, 0x1426123, 0x1426132, 0x1426141,
+	0x1426213, 0x1426222, 0x1426231, 0x1426312, 0x1426321, 0x1426411, 0x1427113, 0x1427122,
+	0x1427131, 0x1427212, 0x1427221, 0x1427311, 0x1428112, 0x1428121, 0x1428211, 0x1431118,
+	0x1431127, 0x1431136, 0x1431145, 0x1431154, 0x1431163, 0x1431172, 0x1431181, 0x1431217,
+	0x1431226, 0x1431235, 0x1431244, 0x1431253, 0x1431262, 0x1431271, 0x1431316, 0x1431325,
+	0x1431334, 0x1431343, 0x1431352, 0x1431361, 0x1431415, 0x1431424, 0x1431433, 0x1431442,
+	0x1431451, 0x1431514, 0x1431523, 0x1431532, 0x1431541, 0x1431613, 0x1431622, 0x1431631,
+	0x1431712, 0x1431721, 0x1431811, 0x1432117, 0x1432126, 0x1432135, 0x1432144, 0x1432153,
+	0x1432162, 0x1432171, 0x1432216, 0x1432225, 0x1432234, 0x1432243, 0x1432252, 0x1432261,
+	0x1432315, 0x1432324, 0x1432333, 0x1432342, 0x1432351, 0x1432414, 0x1432423, 0x1432432,
+	0x1432441, 0x1432513, 0x1432522, 0x1432531, 0x1432612, 0x1432621, 0x1432711, 0x1433116,
+	0x1433125, 0x1433134, 0x1433143, 0x1433152, 0x1433161, 0x1433215, 0x1433224, 0x1433233,
+	0x1433242, 0x1433251, 0x1433314, 0x1433323, 0x1433332, 0x1433341, 0x1433413, 0x1433422,
+	0x1433431, 0x1433512, 0x1433521, 0x1433611, 0x1434115, 0x1434124, 0x1434133, 0x1434142,
+	0x1434151, 0x1434214, 0x1434223, 0x1434232, 0x1434241, 0x1434313, 0x1434322, 0x1434331,
+	0x1434412, 0x1434421, 0x1434511, 0x1435114, 0x1435123, 0x1435132, 0x1435141, 0x1435213,
+	0x1435222, 0x1435231, 0x1435312, 0x1435321, 0x1435411, 0x1436113, 0x1436122, 0x1436131,
+	0x1436212, 0x1436221, 0x1436311, 0x1437112, 0x1437121, 0x1437211, 0x1438111, 0x1441117,
+	0x1441126, 0x1441135, 0x1441144, 0x1441153, 0x1441162, 0x1441171, 0x1441216, 0x1441225,
+	0x1441234, 0x1441243, 0x1441252, 0x1441261, 0x1441315, 0x1441324, 0x1441333, 0x1441342,
+	0x1441351, 0x1441414, 0x1441423, 0x1441432, 0x1441441, 0x1441513, 0x1441522, 0x1441531,
+	0x1441612, 0x1441621, 0x1441711, 0x1442116, 0x1442125, 0x1442134, 0x1442143, 0x1442152,
+	0x1442161, 0x1442215, 0x1442224, 0x1442233, 0x1442242, 0x1442251, 0x1442314, 0x1442323,
+	0x1442332, 0x1442341, 0x1442413, 0x1442422, 0x1442431, 0x1442512, 0x1442521, 0x1442611,
+	0x1443115, 0x1443124, 0x1443133, 0x1443142, 0x1443151, 0x1443214, 0x1443223, 0x1443232,
+	0x1443241, 0x1443313, 0x1443322, 0x1443331, 0x1443412, 0x1443421, 0x1443511, 0x1444114,
+	0x1444123, 0x1444132, 0x1444141, 0x1444213, 0x1444222, 0x1444231, 0x1444312, 0x1444321,
+	0x1444411, 0x1445113, 0x1445122, 0x1445131, 0x1445212, 0x1445221, 0x1445311, 0x1446112,
+	0x1446121, 0x1446211, 0x1447111, 0x1451116, 0x1451125, 0x1451134, 0x1451143, 0x1451152,
+	0x1451161, 0x1451215, 0x1451224, 0x1451233, 0x1451242, 0x1451251, 0x1451314, 0x1451323,
+	0x1451332, 0x1451341, 0x1451413, 0x1451422, 0x1451431, 0x1451512, 0x1451521, 0x1451611,
+	0x1452115, 0x1452124, 0x1452133, 0x1452142, 0x1452151, 0x1452214, 0x1452223, 0x1452232,
+	0x1452241, 0x1452313, 0x1452322, 0x1452331, 0x1452412, 0x1452421, 0x1452511, 0x1453114,
+	0x1453123, 0x1453132, 0x1453141, 0x1453213, 0x1453222, 0x1453231, 0x1453312, 0x1453321,
+	0x1453411, 0x1454113, 0x1454122, 0x1454131, 0x1454212, 0x1454221, 0x1454311, 0x1455112,
+	0x1455121, 0x1455211, 0x1456111, 0x1461115, 0x1461124, 0x1461133, 0x1461142, 0x1461151,
+	0x1461214, 0x1461223, 0x1461232, 0x1461241, 0x1461313, 0x1461322, 0x1461331, 0x1461412,
+	0x1461421, 0x1461511, 0x1462114, 0x1462123, 0x1462132, 0x1462141, 0x1462213, 0x1462222,
+	0x1462231, 0x1462312, 0x1462321, 0x1462411, 0x1463113, 0x1463122, 0x1463131, 0x1463212,
+	0x1463221, 0x1463311, 0x1464112, 0x1464121, 0x1464211, 0x1465111, 0x1471114, 0x1471123,
+	0x1471132, 0x1471141, 0x1471213, 0x1471222, 0x1471231, 0x1471312, 0x1471321, 0x1471411,
+	0x1472113, 0x1472122, 0x1472131, 0x1472212, 0x1472221, 0x1472311, 0x1473112, 0x1473121,
+	0x1473211, 0x1474111, 0x1481113, 0x1481122, 0x1481131, 0x1481212, 0x1481221, 0x1481311,
+	0x1482112, 0x1482121, 0x1482211, 0x1483111, 0x1511128, 0x1511137, 0x1511146, 0x1511155,
+	0x1511164, 0x1511173, 0x1511182, 0x1511218, 0x1511227, 0x1511236, 0x1511245, 0x1511254,
+	0x1511263, 0x1511272, 0x1511281, 0x1511317, 0x1511326, 0x1511335, 0x1511344, 0x1511353,
+	0x1511362, 0x1511371, 0x1511416, 0x1511425, 0x1511434, 0x1511443, 0x1511452, 0x1511461,
+	0x1511515, 0x1511524, 0x1511533, 0x1511542, 0x1511551, 0x1511614, 0x1511623, 0x1511632,
+	0x1511641, 0x1511713, 0x1511722, 0x1511731, 0x1511812, 0x1511821, 0x1512118, 0x1512127,
+	0x1512136, 0x1512145, 0x1512154, 0x1512163, 0x1512172, 0x1512181, 0x1512217, 0x1512226,
+	0x1512235, 0x1512244, 0x1512253, 0x1512262, 0x1512271, 0x1512316, 0x1512325, 0x1512334,
+	0x1512343, 0x1512352, 0x1512361, 0x1512415, 0x1512424, 0x1512433, 0x1512442, 0x1512451,
+	0x1512514, 0x1512523, 0x1512532, 0x1512541, 0x1512613, 0x1512622, 0x1512631, 0x1512712,
+	0x1512721, 0x1512811, 0x1513117, 0x1513126, 0x1513135, 0x1513144, 0x1513153, 0x1513162,
+	0x1513171, 0x1513216, 0x1513225, 0x1513234, 0x1513243, 0x1513252, 0x1513261, 0x1513315,
+	0x1513324, 0x1513333, 0x1513342, 0x1513351, 0x1513414, 0x1513423, 0x1513432, 0x1513441,
+	0x1513513, 0x1513522, 0x1513531, 0x1513612, 0x1513621, 0x1513711, 0x1514116, 0x1514125,
+	0x1514134, 0x1514143, 0x1514152, 0x1514161, 0x1514215, 0x1514224, 0x1514233, 0x1514242,
+	0x1514251, 0x1514314, 0x1514323, 0x1514332, 0x1514341, 0x1514413, 0x1514422, 0x1514431,
+	0x1514512, 0x1514521, 0x1514611, 0x1515115, 0x1515124, 0x1515133, 0x1515142, 0x1515151,
+	0x1515214, 0x1515223, 0x1515232, 0x1515241, 0x1515313, 0x1515322, 0x1515331, 0x1515412,
+	0x1515421, 0x1515511, 0x1516114, 0x1516123, 0x1516132, 0x1516141, 0x1516213, 0x1516222,
+	0x1516231, 0x1516312, 0x1516321, 0x1516411, 0x1517113, 0x1517122, 0x1517131, 0x1517212,
+	0x1517221, 0x1517311, 0x1518112, 0x1518121, 0x1518211, 0x1521118, 0x1521127, 0x1521136,
+	0x1521145, 0x1521154, 0x1521163, 0x1521172, 0x1521181, 0x1521217, 0x1521226, 0x1521235,
+	0x1521244, 0x1521253, 0x1521262, 0x1521271, 0x1521316, 0x1521325, 0x1521334, 0x1521343,
+	0x1521352, 0x1521361, 0x1521415, 0x1521424, 0x1521433, 0x1521442, 0x1521451, 0x1521514,
+	0x1521523, 0x1521532, 0x1521541, 0x1521613, 0x1521622, 0x1521631, 0x1521712, 0x1521721,
+	0x1521811, 0x1522117, 0x1522126, 0x1522135, 0x1522144, 0x1522153, 0x1522162, 0x1522171,
+	0x1522216, 0x1522225, 0x1522234, 0x1522243, 0x1522252, 0x1522261, 0x1522315, 0x1522324,
+	0x1522333, 0x1522342, 0x1522351, 0x1522414, 0x1522423, 0x1522432, 0x1522441, 0x1522513,
+	0x1522522, 0x1522531, 0x1522612, 0x1522621, 0x1522711, 0x1523116, 0x1523125, 0x1523134,
+	0x1523143, 0x1523152, 0x1523161, 0x1523215, 0x1523224, 0x1523233, 0x1523242, 0x1523251,
+	0x1523314, 0x1523323, 0x1523332, 0x1523341, 0x1523413, 0x1523422, 0x1523431, 0x1523512,
+	0x1523521, 0x1523611, 0x1524115, 0x1524124, 0x1524133, 0x1524142, 0x1524151, 0x1524214,
+	0x1524223, 0x1524232, 0x1524241, 0x1524313, 0x1524322, 0x1524331, 0x1524412, 0x1524421,
+	0x1524511, 0x1525114, 0x1525123, 0x1525132, 0x1525141, 0x1525213, 0x1525222, 0x1525231,
+	0x1525312, 0x1525321, 0x1525411, 0x1526113, 0x1526122, 0x1526131, 0x1526212, 0x1526221,
+	0x1526311, 0x1527112, 0x1527121, 0x1527211, 0x1528111, 0x1531117, 0x1531126, 0x1531135,
+	0x1531144, 0x1531153, 0x1531162, 0x1531171, 0x1531216, 0x1531225, 0x1531234, 0x1531243,
+	0x1531252, 0x1531261, 0x1531315, 0x1531324, 0x1531333, 0x1531342, 0x1531351, 0x1531414,
+	0x1531423, 0x1531432, 0x1531441, 0x1531513, 0x1531522, 0x1531531, 0x1531612, 0x1531621,
+	0x1531711, 0x1532116, 0x1532125, 0x1532134, 0x1532143, 0x1532152, 0x1532161, 0x1532215,
+	0x1532224, 0x1532233, 0x1532242, 0x1532251, 0x1532314, 0x1532323, 0x1532332, 0x1532341,
+	0x1532413, 0x1532422, 0x1532431, 0x1532512, 0x1532521, 0x1532611, 0x1533115, 0x1533124,
+	0x1533133, 0x1533142, 0x1533151, 0x1533214, 0x1533223, 0x1533232, 0x1533241, 0x1533313,
+	0x1533322, 0x1533331, 0x1533412, 0x1533421, 0x1533511, 0x1534114, 0x1534123, 0x1534132,
+	0x1534141, 0x1534213, 0x1534222, 0x1534231, 0x1534312, 0x1534321, 0x1534411, 0x1535113,
+	0x1535122, 0x1535131, 0x1535212, 0x1535221, 0x1535311, 0x1536112, 0x1536121, 0x1536211,
+	0x1537111, 0x1541116, 0x1541125, 0x1541134, 0x1541143, 0x1541152, 0x1541161, 0x1541215,
+	0x1541224, 0x1541233, 0x1541242, 0x1541251, 0x1541314, 0x1541323, 0x1541332, 0x1541341,
+	0x1541413, 0x1541422, 0x1541431, 0x1541512, 0x1541521, 0x1541611, 0x1542115, 0x1542124,
+	0x1542133, 0x1542142, 0x1542151, 0x1542214, 0x1542223, 0x1542232, 0x1542241, 0x1542313,
+	0x1542322, 0x1542331, 0x1542412, 0x1542421, 0x1542511, 0x1543114, 0x1543123, 0x1543132,
+	0x1543141, 0x1543213, 0x1543222, 0x1543231, 0x1543312, 0x1543321, 0x1543411, 0x1544113,
+	0x1544122, 0x1544131, 0x1544212, 0x1544221, 0x1544311, 0x1545112, 0x1545121, 0x1545211,
+	0x1546111, 0x1551115, 0x1551124, 0x1551133, 0x1551142, 0x1551151, 0x1551214, 0x1551223,
+	0x1551232, 0x1551241, 0x1551313, 0x1551322, 0x1551331, 0x1551412, 0x1551421, 0x1551511,
+	0x1552114, 0x1552123, 0x1552132, 0x1552141, 0x1552213, 0x1552222, 0x1552231, 0x1552312,
+	0x1552321, 0x1552411, 0x1553113, 0x1553122, 0x1553131, 0x1553212, 0x1553221, 0x1553311,
+	0x1554112, 0x1554121, 0x1554211, 0x1555111, 0x1561114, 0x1561123, 0x1561132, 0x1561141,
+	0x1561213, 0x1561222, 0x1561231, 0x1561312, 0x1561321, 0x1561411, 0x1562113, 0x1562122,
+	0x1562131, 0x1562212, 0x1562221, 0x1562311, 0x1563112, 0x1563121, 0x1563211, 0x1564111,
+	0x1571113, 0x1571122, 0x1571131, 0x1571212, 0x1571221, 0x1571311, 0x1572112, 0x1572121,
+	0x1572211, 0x1573111, 0x1581112, 0x1581121, 0x1581211, 0x1582111, 0x1611118, 0x1611127,
+	0x1611136, 0x1611145, 0x1611154, 0x1611163, 0x1611172, 0x1611181, 0x1611217, 0x1611226,
+	0x1611235, 0x1611244, 0x1611253, 0x1611262, 0x1611271, 0x1611316, 0x1611325, 0x1611334,
+	0x1611343, 0x1611352, 0x1611361, 0x1611415, 0x1611424, 0x1611433, 0x1611442, 0x1611451,
+	0x1611514, 0x1611523, 0x1611532, 0x1611541, 0x1611613, 0x1611622, 0x1611631, 0x1611712,
+	0x1611721, 0x1611811, 0x1612117, 0x1612126, 0x1612135, 0x1612144, 0x1612153, 0x1612162,
+	0x1612171, 0x1612216, 0x1612225, 0x1612234, 0x1612243, 0x1612252, 0x1612261, 0x1612315,
+	0x1612324, 0x1612333, 0x1612342, 0x1612351, 0x1612414, 0x1612423, 0x1612432, 0x1612441,
+	0x1612513, 0x1612522, 0x1612531, 0x1612612, 0x1612621, 0x1612711, 0x1613116, 0x1613125,
+	0x1613134, 0x1613143, 0x1613152, 0x1613161, 0x1613215, 0x1613224, 0x1613233, 0x1613242,
+	0x1613251, 0x1613314, 0x1613323, 0x1613332, 0x1613341, 0x1613413, 0x1613422, 0x1613431,
+	0x1613512, 0x1613521, 0x1613611, 0x1614115, 0x1614124, 0x1614133, 0x1614142, 0x1614151,
+	0x1614214, 0x1614223, 0x1614232, 0x1614241, 0x1614313, 0x1614322, 0x1614331, 0x1614412,
+	0x1614421, 0x1614511, 0x1615114, 0x1615123, 0x1615132, 0x1615141, 0x1615213, 0x1615222,
+	0x1615231, 0x1615312, 0x1615321, 0x1615411, 0x1616113, 0x1616122, 0x1616131, 0x1616212,
+	0x1616221, 0x1616311, 0x1617112, 0x1617121, 0x1617211, 0x1618111, 0x1621117, 0x1621126,
+	0x1621135, 0x1621144, 0x1621153, 0x1621162, 0x1621171, 0x1621216, 0x1621225, 0x1621234,
+	0x1621243, 0x1621252, 0x1621261, 0x1621315, 0x1621324, 0x1621333, 0x1621342, 0x1621351,
+	0x1621414, 0x1621423, 0x1621432, 0x1621441, 0x1621513, 0x1621522, 0x1621531, 0x1621612,
+	0x1621621, 0x1621711, 0x1622116, 0x1622125, 0x1622134, 0x1622143, 0x1622152, 0x1622161,
+	0x1622215, 0x1622224, 0x1622233, 0x1622242, 0x1622251, 0x1622314, 0x1622323, 0x1622332,
+	0x1622341, 0x1622413, 0x1622422, 0x1622431, 0x1622512, 0x1622521, 0x1622611, 0x1623115,
+	0x1623124, 0x1623133, 0x1623142, 0x1623151, 0x1623214, 0x1623223, 0x1623232, 0x1623241,
+	0x1623313, 0x1623322, 0x1623331, 0x1623412, 0x1623421, 0x1623511, 0x1624114, 0x1624123,
+	0x1624132, 0x1624141, 0x1624213, 0x1624222, 0x1624231, 0x1624312, 0x1624321, 0x1624411,
+	0x1625113, 0x1625122, 0x1625131, 0x1625212, 0x1625221, 0x1625311, 0x1626112, 0x1626121,
+	0x1626211, 0x1627111, 0x1631116, 0x1631125, 0x1631134, 0x1631143, 0x1631152, 0x1631161,
+	0x1631215, 0x1631224, 0x1631233, 0x1631242, 0x1631251, 0x1631314, 0x1631323, 0x1631332,
+	0x1631341, 0x1631413, 0x1631422, 0x1631431, 0x1631512, 0x1631521, 0x1631611, 0x1632115,
+	0x1632124, 0x1632133, 0x1632142, 0x1632151, 0x1632214, 0x1632223, 0x1632232, 0x1632241,
+	0x1632313, 0x1632322, 0x1632331, 0x1632412, 0x1632421, 0x1632511, 0x1633114, 0x1633123,
+	0x1633132, 0x1633141, 0x1633213, 0x1633222, 0x1633231, 0x1633312, 0x1633321, 0x1633411,
+	0x1634113, 0x1634122, 0x1634131, 0x1634212, 0x1634221, 0x1634311, 0x1635112, 0x1635121,
+	0x1635211, 0x1636111, 0x1641115, 0x1641124, 0x1641133, 0x1641142, 0x1641151, 0x1641214,
+	0x1641223, 0x1641232, 0x1641241, 0x1641313, 0x1641322, 0x1641331, 0x1641412, 0x1641421,
+	0x1641511, 0x1642114, 0x1642123, 0x1642132, 0x1642141, 0x1642213, 0x1642222, 0x1642231,
+	0x1642312, 0x1642321, 0x1642411, 0x1643113, 0x1643122, 0x1643131, 0x1643212, 0x1643221,
+	0x1643311, 0x1644112, 0x1644121, 0x1644211, 0x1645111, 0x1651114, 0x1651123, 0x1651132,
+	0x1651141, 0x1651213, 0x1651222, 0x1651231, 0x1651312, 0x1651321, 0x1651411, 0x1652113,
+	0x1652122, 0x1652131, 0x1652212, 0x1652221, 0x1652311, 0x1653112, 0x1653121, 0x1653211,
+	0x1654111, 0x1661113, 0x1661122, 0x1661131, 0x1661212, 0x1661221, 0x1661311, 0x1662112,
+	0x1662121, 0x1662211, 0x1663111, 0x1671112, 0x1671121, 0x1671211, 0x1672111, 0x1681111,
+	0x1711117, 0x1711126, 0x1711135, 0x1711144, 0x1711153, 0x1711162, 0x1711171, 0x1711216,
+	0x1711225, 0x1711234, 0x1711243, 0x1711252, 0x1711261, 0x1711315, 0x1711324, 0x1711333,
+	0x1711342, 0x1711351, 0x1711414, 0x1711423, 0x1711432, 0x1711441, 0x1711513, 0x1711522,
+	0x1711531, 0x1711612, 0x1711621, 0x1711711, 0x1712116, 0x1712125, 0x1712134, 0x1712143,
+	0x1712152, 0x1712161, 0x1712215, 0x1712224, 0x1712233, 0x1712242, 0x1712251, 0x1712314,
+	0x1712323, 0x1712332, 0x1712341, 0x1712413, 0x1712422, 0x1712431, 0x1712512, 0x1712521,
+	0x1712611, 0x1713115, 0x1713124, 0x1713133, 0x1713142, 0x1713151, 0x1713214, 0x1713223,
+	0x1713232, 0x1713241, 0x1713313, 0x1713322, 0x1713331, 0x1713412, 0x1713421, 0x1713511,
+	0x1714114, 0x1714123, 0x1714132, 0x1714141, 0x1714213, 0x1714222, 0x1714231, 0x1714312,
+	0x1714321, 0x1714411, 0x1715113, 0x1715122, 0x1715131, 0x1715212, 0x1715221, 0x1715311,
+	0x1716112, 0x1716121, 0x1716211, 0x1717111, 0x1721116, 0x1721125, 0x1721134, 0x1721143,
+	0x1721152, 0x1721161, 0x1721215, 0x1721224, 0x1721233, 0x1721242, 0x1721251, 0x1721314,
+	0x1721323, 0x1721332, 0x1721341, 0x1721413, 0x1721422, 0x1721431, 0x1721512, 0x1721521,
+	0x1721611, 0x1722115, 0x1722124, 0x1722133, 0x1722142, 0x1722151, 0x1722214, 0x1722223,
+	0x1722232, 0x1722241, 0x1722313, 0x1722322, 0x1722331, 0x1722412, 0x1722421, 0x1722511,
+	0x1723114, 0x1723123, 0x1723132, 0x1723141, 0x1723213, 0x1723222, 0x1723231, 0x1723312,
+	0x1723321, 0x1723411, 0x1724113, 0x1724122, 0x1724131, 0x1724212, 0x1724221, 0x1724311,
+	0x1725112, 0x1725121, 0x1725211, 0x1726111, 0x1731115, 0x1731124, 0x1731133, 0x1731142,
+	0x1731151, 0x1731214, 0x1731223, 0x1731232, 0x1731241, 0x1731313, 0x1731322, 0x1731331,
+	0x1731412, 0x1731421, 0x1731511, 0x1732114, 0x1732123, 0x1732132, 0x1732141, 0x1732213,
+	0x1732222, 0x1732231, 0x1732312, 0x1732321, 0x1732411, 0x1733113, 0x1733122, 0x1733131,
+	0x1733212, 0x1733221, 0x1733311, 0x1734112, 0x1734121, 0x1734211, 0x1735111, 0x1741114,
+	0x1741123, 0x1741132, 0x1741141, 0x1741213, 0x1741222, 0x1741231, 0x1741312, 0x1741321,
+	0x1741411, 0x1742113, 0x1742122, 0x1742131, 0x1742212, 0x1742221, 0x1742311, 0x1743112,
+	0x1743121, 0x1743211, 0x1744111, 0x1751113, 0x1751122, 0x1751131, 0x1751212, 0x1751221,
+	0x1751311, 0x1752112, 0x1752121, 0x1752211, 0x1753111, 0x1761112, 0x1761121, 0x1761211,
+	0x1762111, 0x1771111, 0x1811116, 0x1811125, 0x1811134, 0x1811143, 0x1811152, 0x1811161,
+	0x1811215, 0x1811224, 0x1811233, 0x1811242, 0x1811251, 0x1811314, 0x1811323, 0x1811332,
+	0x1811341, 0x1811413, 0x1811422, 0x1811431, 0x1811512, 0x1811521, 0x1811611, 0x1812115,
+	0x1812124, 0x1812133, 0x1812142, 0x1812151, 0x1812214, 0x1812223, 0x1812232, 0x1812241,
+	0x1812313, 0x1812322, 0x1812331, 0x1812412, 0x1812421, 0x1812511, 0x1813114, 0x1813123,
+	0x1813132, 0x1813141, 0x1813213, 0x1813222, 0x1813231, 0x1813312, 0x1813321, 0x1813411,
+	0x1814113, 0x1814122, 0x1814131, 0x1814212, 0x1814221, 0x1814311, 0x1815112, 0x1815121,
+	0x1815211, 0x1816111, 0x1821115, 0x1821124, 0x1821133, 0x1821142, 0x1821151, 0x1821214,
+	0x1821223, 0x1821232, 0x1821241, 0x1821313, 0x1821322, 0x1821331, 0x1821412, 0x1821421,
+	0x1821511, 0x1822114, 0x1822123, 0x1822132, 0x1822141, 0x1822213, 0x1822222, 0x1822231,
+	0x1822312, 0x1822321, 0x1822411, 0x1823113, 0x1823122, 0x1823131, 0x1823212, 0x1823221,
+	0x1823311, 0x1824112, 0x1824121, 0x1824211, 0x1825111, 0x1831114, 0x1831123, 0x1831132,
+	0x1831141, 0x1831213, 0x1831222, 0x1831231, 0x1831312, 0x1831321, 0x1831411, 0x1832113,
+	0x1832122, 0x1832131, 0x1832212, 0x1832221, 0x1832311, 0x1833112, 0x1833121, 0x1833211,
+	0x1834111, 0x1841113, 0x1841122, 0x1841131, 0x1841212, 0x1841221, 0x1841311, 0x1842112,
+	0x1842121, 0x1842211, 0x1843111, 0x1851112, 0x1851121, 0x1851211, 0x1852111, 0x1861111,
+	0x2111158, 0x2111167, 0x2111176, 0x2111185, 0x2111248, 0x2111257, 0x2111266, 0x2111275,
+	0x2111284, 0x2111338, 0x2111347, 0x2111356, 0x2111365, 0x2111374, 0x2111383, 0x2111428,
+	0x2111437, 0x2111446, 0x2111455, 0x2111464, 0x2111473, 0x2111482, 0x2111518, 0x2111527,
+	0x2111536, 0x2111545, 0x2111554, 0x2111563, 0x2111572, 0x2111581, 0x2111617, 0x2111626,
+	0x2111635, 0x2111644, 0x2111653, 0x2111662, 0x2111671, 0x2111716, 0x2111725, 0x2111734,
+	0x2111743, 0x2111752, 0x2111761, 0x2111815, 0x2111824, 0x2111833, 0x2111842, 0x2111851,
+	0x2112148, 0x2112157, 0x2112166, 0x2112175, 0x2112184, 0x2112238, 0x2112247, 0x2112256,
+	0x2112265, 0x2112274, 0x2112283, 0x2112328, 0x2112337, 0x2112346, 0x2112355, 0x2112364,
+	0x2112373, 0x2112382, 0x2112418, 0x2112427, 0x2112436, 0x2112445, 0x2112454, 0x2112463,
+	0x2112472, 0x2112481, 0x2112517, 0x2112526, 0x2112535, 0x2112544, 0x2112553, 0x2112562,
+	0x2112571, 0x2112616, 0x2112625, 0x2112634, 0x2112643, 0x2112652, 0x2112661, 0x2112715,
+	0x2112724, 0x2112733, 0x2112742, 0x2112751, 0x2112814, 0x2112823, 0x2112832, 0x2112841,
+	0x2113138, 0x2113147, 0x2113156, 0x2113165, 0x2113174, 0x2113183, 0x2113228, 0x2113237,
+	0x2113246, 0x2113255, 0x2113264, 0x2113273, 0x2113282, 0x2113318, 0x2113327, 0x2113336,
+	0x2113345, 0x2113354, 0x2113363, 0x2113372, 0x2113381, 0x2113417, 0x2113426, 0x2113435,
+	0x2113444, 0x2113453, 0x2113462, 0x2113471, 0x2113516, 0x2113525, 0x2113534, 0x2113543,
+	0x2113552, 0x2113561, 0x2113615, 0x2113624, 0x2113633, 0x2113642, 0x2113651, 0x2113714,
+	0x2113723, 0x2113732, 0x2113741, 0x2113813, 0x2113822, 0x2113831, 0x2114128, 0x2114137,
+	0x2114146, 0x2114155, 0x2114164, 0x2114173, 0x2114182, 0x2114218, 0x2114227, 0x2114236,
+	0x2114245, 0x2114254, 0x2114263, 0x2114272, 0x2114281, 0x2114317, 0x2114326, 0x2114335,
+	0x2114344, 0x2114353, 0x2114362, 0x2114371, 0x2114416, 0x2114425, 0x2114434, 0x2114443,
+	0x2114452, 0x2114461, 0x2114515, 0x2114524, 0x2114533, 0x2114542, 0x2114551, 0x2114614,
+	0x2114623, 0x2114632, 0x2114641, 0x2114713, 0x2114722, 0x2114731, 0x2114812, 0x2114821,
+	0x2115118, 0x2115127, 0x2115136, 0x2115145, 0x2115154, 0x2115163, 0x2115172, 0x2115181,
+	0x2115217, 0x2115226, 0x2115235, 0x2115244, 0x2115253, 0x2115262, 0x2115271, 0x2115316,
+	0x2115325, 0x2115334, 0x2115343, 0x2115352, 0x2115361, 0x2115415, 0x2115424, 0x2115433,
+	0x2115442, 0x2115451, 0x2115514, 0x2115523, 0x2115532, 0x2115541, 0x2115613, 0x2115622,
+	0x2115631, 0x2115712, 0x2115721, 0x2115811, 0x2116117, 0x2116126, 0x2116135, 0x2116144,
+	0x2116153, 0x2116162, 0x2116171, 0x2116216, 0x2116225, 0x2116234, 0x2116243, 0x2116252,
+	0x2116261, 0x2116315, 0x2116324, 0x2116333, 0x2116342, 0x2116351, 0x2116414, 0x2116423,
+	0x2116432, 0x2116441, 0x2116513, 0x2116522, 0x2116531, 0x2116612, 0x2116621, 0x2116711,
+	0x2117116, 0x2117125, 0x2117134, 0x2117143, 0x2117152, 0x2117161, 0x2117215, 0x2117224,
+	0x2117233, 0x2117242, 0x2117251, 0x2117314, 0x2117323, 0x2117332, 0x2117341, 0x2117413,
+	0x2117422, 0x2117431, 0x2117512, 0x2117521, 0x2117611, 0x2118115, 0x2118124, 0x2118133,
+	0x2118142, 0x2118151, 0x2118214, 0x2118223, 0x2118232, 0x2118241, 0x2118313, 0x2118322,
+	0x2118331, 0x2118412, 0x2118421, 0x2118511, 0x2121148, 0x2121157, 0x2121166, 0x2121175,
+	0x2121184, 0x2121238, 0x2121247, 0x2121256, 0x2121265, 0x2121274, 0x2121283, 0x2121328,
+	0x2121337, 0x2121346, 0x2121355, 0x2121364, 0x2121373, 0x2121382, 0x2121418, 0x2121427,
+	0x2121436, 0x2121445, 0x2121454, 0x2121463, 0x2121472, 0x2121481, 0x2121517, 0x2121526,
+	0x2121535, 0x2121544, 0x2121553, 0x2121562, 0x2121571, 0x2121616, 0x2121625, 0x2121634,
+	0x2121643, 0x2121652, 0x2121661, 0x2121715, 0x2121724, 0x2121733, 0x2121742, 0x2121751,
+	0x2121814, 0x2121823, 0x2121832, 0x2121841, 0x2122138, 0x2122147, 0x2122156, 0x2122165,
+	0x2122174, 0x2122183, 0x2122228, 0x2122237, 0x2122246, 0x2122255, 0x2122264, 0x2122273,
+	0x2122282, 0x2122318, 0x2122327, 0x2122336, 0x2122345, 0x2122354, 0x2122363, 0x2122372,
+	0x2122381, 0x2122417, 0x2122426, 0x2122435, 0x2122444, 0x2122453, 0x2122462, 0x2122471,
+	0x2122516, 0x2122525, 0x2122534, 0x2122543, 0x2122552, 0x2122561, 0x2122615, 0x2122624,
+	0x2122633, 0x2122642, 0x2122651, 0x2122714, 0x2122723, 0x2122732, 0x2122741, 0x2122813,
+	0x2122822, 0x2122831, 0x2123128, 0x2123137, 0x2123146, 0x2123155, 0x2123164, 0x2123173,
+	0x2123182, 0x2123218, 0x2123227, 0x2123236, 0x2123245, 0x2123254, 0x2123263, 0x2123272,
+	0x2123281, 0x2123317, 0x2123326, 0x2123335, 0x2123344, 0x2123353, 0x2123362, 0x2123371,
+	0x2123416, 0x2123425, 0x2123434, 0x2123443, 0x2123452, 0x2123461, 0x2123515, 0x2123524,
+	0x2123533, 0x2123542, 0x2123551, 0x2123614, 0x2123623, 0x2123632, 0x2123641, 0x2123713,
+	0x2123722, 0x2123731, 0x2123812, 0x2123821, 0x2124118, 0x2124127, 0x2124136, 0x2124145,
+	0x2124154, 0x2124163, 0x2124172, 0x2124181, 0x2124217, 0x2124226, 0x2124235, 0x2124244,
+	0x2124253, 0x2124262, 0x2124271, 0x2124316, 0x2124325, 0x2124334, 0x2124343, 0x2124352,
+	0x2124361, 0x2124415, 0x2124424, 0x2124433, 0x2124442, 0x2124451, 0x2124514, 0x2124523,
+	0x2124532, 0x2124541, 0x2124613, 0x2124622, 0x2124631, 0x2124712, 0x2124721, 0x2124811,
+	0x2125117, 0x2125126, 0x2125135, 0x2125144, 0x2125153, 0x2125162, 0x2125171, 0x2125216,
+	0x2125225, 0x2125234, 0x2125243, 0x2125252, 0x2125261, 0x2125315, 0x2125324, 0x2125333,
+	0x2125342, 0x2125351, 0x2125414, 0x2125423, 0x2125432, 0x2125441, 0x2125513, 0x2125522,
+	0x2125531, 0x2125612, 0x2125621, 0x2125711, 0x2126116, 0x2126125, 0x2126134, 0x2126143,
+	0x2126152, 0x2126161, 0x2126215, 0x2126224, 0x2126233, 0x2126242, 0x2126251, 0x2126314,
+	0x2126323, 0x2126332, 0x2126341, 0x2126413, 0x2126422, 0x2126431, 0x2126512, 0x2126521,
+	0x2126611, 0x2127115, 0x2127124, 0x2127133, 0x2127142, 0x2127151, 0x2127214, 0x2127223,
+	0x2127232, 0x2127241, 0x2127313, 0x2127322, 0x2127331, 0x2127412, 0x2127421, 0x2127511,
+	0x2128114, 0x2128123, 0x2128132, 0x2128141, 0x2128213, 0x2128222, 0x2128231, 0x2128312,
+	0x2128321, 0x2128411, 0x2131138, 0x2131147, 0x2131156, 0x2131165, 0x2131174, 0x2131183,
+	0x2131228, 0x2131237, 0x2131246, 0x2131255, 0x2131264, 0x2131273, 0x2131282, 0x2131318,
+	0x2131327, 0x2131336, 0x2131345, 0x2131354, 0x2131363, 0x2131372, 0x2131381, 0x2131417,
+	0x2131426, 0x2131435, 0x2131444, 0x2131453, 0x2131462, 0x2131471, 0x2131516, 0x2131525,
+	0x2131534, 0x2131543, 0x2131552, 0x2131561, 0x2131615, 0x2131624, 0x2131633, 0x2131642,
+	0x2131651, 0x2131714, 0x2131723, 0x2131732, 0x2131741, 0x2131813, 0x2131822, 0x2131831,
+	0x2132128, 0x2132137, 0x2132146, 0x2132155, 0x2132164, 0x2132173, 0x2132182, 0x2132218,
+	0x2132227, 0x2132236, 0x2132245, 0x2132254, 0x2132263, 0x2132272, 0x2132281, 0x2132317,
+	0x2132326, 0x2132335, 0x2132344, 0x2132353, 0x2132362, 0x2132371, 0x2132416, 0x2132425,
+	0x2132434, 0x2132443, 0x2132452, 0x2132461, 0x2132515, 0x2132524, 0x2132533, 0x2132542,
+	0x2132551, 0x2132614, 0x2132623, 0x2132632, 0x2132641, 0x2132713, 0x2132722, 0x2132731,
+	0x2132812, 0x2132821, 0x2133118, 0x2133127, 0x2133136, 0x2133145, 0x2133154, 0x2133163,
+	0x2133172, 0x2133181, 0x2133217, 0x2133226, 0x2133235, 0x2133244, 0x2133253, 0x2133262,
+	0x2133271, 0x2133316, 0x2133325, 0x2133334, 0x2133343, 0x2133352, 0x2133361, 0x2133415,
+	0x2133424, 0x2133433, 0x2133442, 0x2133451, 0x2133514, 0x2133523, 0x2133532, 0x2133541,
+	0x2133613, 0x2133622, 0x2133631, 0x2133712, 0x2133721, 0x2133811, 0x2134117, 0x2134126,
+	0x2134135, 0x2134144, 0x2134153, 0x2134162, 0x2134171, 0x2134216, 0x2134225, 0x2134234,
+	0x2134243, 0x2134252, 0x2134261, 0x2134315, 0x2134324, 0x2134333, 0x2134342, 0x2134351,
+	0x2134414, 0x2134423, 0x2134432, 0x2134441, 0x2134513, 0x2134522, 0x2134531, 0x2134612,
+	0x2134621, 0x2134711, 0x2135116, 0x2135125, 0x2135134, 0x2135143, 0x2135152, 0x2135161,
+	0x2135215, 0x2135224, 0x2135233, 0x2135242, 0x2135251, 0x2135314, 0x2135323, 0x2135332,
+	0x2135341, 0x2135413, 0x2135422, 0x2135431, 0x2135512, 0x2135521, 0x2135611, 0x2136115,
+	0x2136124, 0x2136133, 0x2136142, 0x2136151, 0x2136214, 0x2136223, 0x2136232, 0x2136241,
+	0x2136313, 0x2136322, 0x2136331, 0x2136412, 0x2136421, 0x2136511, 0x2137114, 0x2137123,
+	0x2137132, 0x2137141, 0x2137213, 0x2137222, 0x2137231, 0x2137312, 0x2137321, 0x2137411,
+	0x2138113, 0x2138122, 0x2138131, 0x2138212, 0x2138221, 0x2138311, 0x2141128, 0x2141137,
+	0x2141146, 0x2141155, 0x2141164, 0x2141173, 0x2141182, 0x2141218, 0x2141227, 0x2141236,
+	0x2141245, 0x2141254, 0x2141263, 0x2141272, 0x2141281, 0x2141317, 0x2141326, 0x2141335,
+	0x2141344, 0x2141353, 0x2141362, 0x2141371, 0x2141416, 0x2141425, 0x2141434, 0x2141443,
+	0x2141452, 0x2141461, 0x2141515, 0x2141524, 0x2141533, 0x2141542, 0x2141551, 0x2141614,
+	0x2141623, 0x2141632, 0x2141641, 0x2141713, 0x2141722, 0x2141731, 0x2141812, 0x2141821,
+	0x2142118, 0x2142127, 0x2142136, 0x2142145, 0x2142154, 0x2142163, 0x2142172, 0x2142181,
+	0x2142217, 0x2142226, 0x2142235, 0x2142244, 0x2142253, 0x2142262, 0x2142271, 0x2142316,
+	0x2142325, 0x2142334, 0x2142343, 0x2142352, 0x2142361, 0x2142415, 0x2142424, 0x2142433,
+	0x2142442, 0x2142451, 0x2142514, 0x2142523, 0x2142532, 0x2142541, 0x2142613, 0x2142622,
+	0x2142631, 0x2142712, 0x2142721, 0x2142811, 0x2143117, 0x2143126, 0x2143135, 0x2143144,
+	0x2143153, 0x2143162, 0x2143171, 0x2143216, 0x2143225, 0x2143234, 0x2143243, 0x2143252,
+	0x2143261, 0x2143315, 0x2143324, 0x2143333, 0x2143342, 0x2143351, 0x2143414, 0x2143423,
+	0x2143432, 0x2143441, 0x2143513, 0x2143522, 0x2143531, 0x2143612, 0x2143621, 0x2143711,
+	0x2144116, 0x2144125, 0x2144134, 0x2144143, 0x2144152, 0x2144161, 0x2144215, 0x2144224,
+	0x2144233, 0x2144242, 0x2144251, 0x2144314, 0x2144323, 0x2144332, 0x2144341, 0x2144413,
+	0x2144422, 0x2144431, 0x2144512, 0x2144521, 0x2144611, 0x2145115, 0x2145124, 0x2145133,
+	0x2145142, 0x2145151, 0x2145214, 0x2145223, 0x2145232, 0x2145241, 0x2145313, 0x2145322,
+	0x2145331, 0x2145412, 0x2145421, 0x2145511, 0x2146114, 0x2146123, 0x2146132, 0x2146141,
+	0x2146213, 0x2146222, 0x2146231, 0x2146312, 0x2146321, 0x2146411, 0x2147113, 0x2147122,
+	0x2147131, 0x2147212, 0x2147221, 0x2147311, 0x2148112, 0x2148121, 0x2148211, 0x2151118,
+	0x2151127, 0x2151136, 0x2151145, 0x2151154, 0x2151163, 0x2151172, 0x2151181, 0x2151217,
+	0x2151226, 0x2151235, 0x2151244, 0x2151253, 0x2151262, 0x2151271, 0x2151316, 0x2151325,
+	0x2151334, 0x2151343, 0x2151352, 0x2151361, 0x2151415, 0x2151424, 0x2151433, 0x2151442,
+	0x2151451, 0x2151514, 0x2151523, 0x2151532, 0x2151541, 0x2151613, 0x2151622, 0x2151631,
+	0x2151712, 0x2151721, 0x2151811, 0x2152117, 0x2152126, 0x2152135, 0x2152144, 0x2152153,
+	0x2152162, 0x2152171, 0x2152216, 0x2152225, 0x2152234, 0x2152243, 0x2152252, 0x2152261,
+	0x2152315, 0x2152324, 0x2152333, 0x2152342, 0x2152351, 0x2152414, 0x2152423, 0x2152432,
+	0x2152441, 0x2152513, 0x2152522, 0x2152531, 0x2152612, 0x2152621, 0x2152711, 0x2153116,
+	0x2153125, 0x2153134, 0x2153143, 0x2153152, 0x2153161, 0x2153215, 0x2153224, 0x2153233,
+	0x2153242, 0x2153251, 0x2153314, 0x2153323, 0x2153332, 0x2153341, 0x2153413, 0x2153422,
+	0x2153431, 0x2153512, 0x2153521, 0x2153611, 0x2154115, 0x2154124, 0x2154133, 0x2154142,
+	0x2154151, 0x2154214, 0x2154223, 0x2154232, 0x2154241, 0x2154313, 0x2154322, 0x2154331,
+	0x2154412, 0x2154421, 0x2154511, 0x2155114, 0x2155123, 0x2155132, 0x2155141, 0x2155213,
+	0x2155222, 0x2155231, 0x2155312, 0x2155321, 0x2155411, 0x2156113, 0x2156122, 0x2156131,
+	0x2156212, 0x2156221, 0x2156311, 0x2157112, 0x2157121, 0x2157211, 0x2158111, 0x2161117,
+	0x2161126, 0x2161135, 0x2161144, 0x2161153, 0x2161162, 0x2161171, 0x2161216, 0x2161225,
+	0x2161234, 0x2161243, 0x2161252, 0x2161261, 0x2161315, 0x2161324, 0x2161333, 0x2161342,
+	0x2161351, 0x2161414, 0x2161423, 0x2161432, 0x2161441, 0x2161513, 0x2161522, 0x2161531,
+	0x2161612, 0x2161621, 0x2161711, 0x2162116, 0x2162125, 0x2162134, 0x2162143, 0x2162152,
+	0x2162161, 0x2162215, 0x2162224, 0x2162233, 0x2162242, 0x2162251, 0x2162314, 0x2162323,
+	0x2162332, 0x2162341, 0x2162413, 0x2162422, 0x2162431, 0x2162512, 0x2162521, 0x2162611,
+	0x2163115, 0x2163124, 0x2163133, 0x2163142, 0x2163151, 0x2163214, 0x2163223, 0x2163232,
+	0x2163241, 0x2163313, 0x2163322, 0x2163331, 0x2163412, 0x2163421, 0x2163511, 0x2164114,
+	0x2164123, 0x2164132, 0x2164141, 0x2164213, 0x2164222, 0x2164231, 0x2164312, 0x2164321,
+	0x2164411, 0x2165113, 0x2165122, 0x2165131, 0x2165212, 0x2165221, 0x2165311, 0x2166112,
+	0x2166121, 0x2166211, 0x2167111, 0x2171116, 0x2171125, 0x2171134, 0x2171143, 0x2171152,
+	0x2171161, 0x2171215, 0x2171224, 0x2171233, 0x2171242, 0x2171251, 0x2171314, 0x2171323,
+	0x2171332, 0x2171341, 0x2171413, 0x2171422, 0x2171431, 0x2171512, 0x2171521, 0x2171611,
+	0x2172115, 0x2172124, 0x2172133, 0x2172142, 0x2172151, 0x2172214, 0x2172223, 0x2172232,
+	0x2172241, 0x2172313, 0x2172322, 0x2172331, 0x2172412, 0x2172421, 0x2172511, 0x2173114,
+	0x2173123, 0x2173132, 0x2173141, 0x2173213, 0x2173222, 0x2173231, 0x2173312, 0x2173321,
+	0x2173411, 0x2174113, 0x2174122, 0x2174131, 0x2174212, 0x2174221, 0x2174311, 0x2175112,
+	0x2175121, 0x2175211, 0x2176111, 0x2181115, 0x2181124, 0x2181133, 0x2181142, 0x2181151,
+	0x2181214, 0x2181223, 0x2181232, 0x2181241, 0x2181313, 0x2181322, 0x2181331, 0x2181412,
+	0x2181421, 0x2181511, 0x2182114, 0x2182123, 0x2182132, 0x2182141, 0x2182213, 0x2182222,
+	0x2182231, 0x2182312, 0x2182321, 0x2182411, 0x2183113, 0x2183122, 0x2183131, 0x2183212,
+	0x2183221, 0x2183311, 0x2184112, 0x2184121, 0x2184211, 0x2185111, 0x2211148, 0x2211157,
+	0x2211166, 0x2211175, 0x2211184, 0x2211238, 0x2211247, 0x2211256, 0x2211265, 0x2211274,
+	0x2211283, 0x2211328, 0x2211337, 0x2211346, 0x2211355, 0x2211364, 0x2211373, 0x2211382,
+	0x2211418, 0x2211427, 0x2211436, 0x2211445, 0x2211454, 0x2211463, 0x2211472, 0x2211481,
+	0x2211517, 0x2211526, 0x2211535, 0x2211544, 0x2211553, 0x2211562, 0x2211571, 0x2211616,
+	0x2211625, 0x2211634, 0x2211643, 0x2211652, 0x2211661, 0x2211715, 0x2211724, 0x2211733,
+	0x2211742, 0x2211751, 0x2211814, 0x2211823, 0x2211832, 0x2211841, 0x2212138, 0x2212147,
+	0x2212156, 0x2212165, 0x2212174, 0x2212183, 0x2212228, 0x2212237, 0x2212246, 0x2212255,
+	0x2212264, 0x2212273, 0x2212282, 0x2212318, 0x2212327, 0x2212336, 0x2212345, 0x2212354,
+	0x2212363, 0x2212372, 0x2212381, 0x2212417, 0x2212426, 0x2212435, 0x2212444, 0x2212453,
+	0x2212462, 0x2212471, 0x2212516, 0x2212525, 0x2212534, 0x2212543, 0x2212552, 0x2212561,
+	0x2212615, 0x2212624, 0x2212633, 0x2212642, 0x2212651, 0x2212714, 0x2212723, 0x2212732,
+	0x2212741, 0x2212813, 0x2212822, 0x2212831, 0x2213128, 0x2213137, 0x2213146, 0x2213155,
+	0x2213164, 0x2213173, 0x2213182, 0x2213218, 0x2213227, 0x2213236, 0x2213245, 0x2213254,
+	0x2213263, 0x2213272, 0x2213281, 0x2213317, 0x2213326, 0x2213335, 0x2213344, 0x2213353,
+	0x2213362, 0x2213371, 0x2213416, 0x2213425, 0x2213434, 0x2213443, 0x2213452, 0x2213461,
+	0x2213515, 0x2213524, 0x2213533, 0x2213542, 0x2213551, 0x2213614, 0x2213623, 0x2213632,
+	0x2213641, 0x2213713, 0x2213722, 0x2213731, 0x2213812, 0x2213821, 0x2214118, 0x2214127,
+	0x2214136, 0x2214145, 0x2214154, 0x2214163, 0x2214172, 0x2214181, 0x2214217, 0x2214226,
+	0x2214235, 0x2214244, 0x2214253, 0x2214262, 0x2214271, 0x2214316, 0x2214325, 0x2214334,
+	0x2214343, 0x2214352, 0x2214361, 0x2214415, 0x2214424, 0x2214433, 0x2214442, 0x2214451,
+	0x2214514, 0x2214523, 0x2214532, 0x2214541, 0x2214613, 0x2214622, 0x2214631, 0x2214712,
+	0x2214721, 0x2214811, 0x2215117, 0x2215126, 0x2215135, 0x2215144, 0x2215153, 0x2215162,
+	0x2215171, 0x2215216, 0x2215225, 0x2215234, 0x2215243, 0x2215252, 0x2215261, 0x2215315,
+	0x2215324, 0x2215333, 0x2215342, 0x2215351, 0x2215414, 0x2215423, 0x2215432, 0x2215441,
+	0x2215513, 0x2215522, 0x2215531, 0x2215612, 0x2215621, 0x2215711, 0x2216116, 0x2216125,
+	0x2216134, 0x2216143, 0x2216152, 0x2216161, 0x2216215, 0x2216224, 0x2216233, 0x2216242,
+	0x2216251, 0x2216314, 0x2216323, 0x2216332, 0x2216341, 0x2216413, 0x2216422, 0x2216431,
+	0x2216512, 0x2216521, 0x2216611, 0x2217115, 0x2217124, 0x2217133, 0x2217142, 0x2217151,
+	0x2217214, 0x2217223, 0x2217232, 0x2217241, 0x2217313, 0x2217322, 0x2217331, 0x2217412,
+	0x2217421, 0x2217511, 0x2218114, 0x2218123, 0x2218132, 0x2218141, 0x2218213, 0x2218222,
+	0x2218231, 0x2218312, 0x2218321, 0x2218411, 0x2221138, 0x2221147, 0x2221156, 0x2221165,
+	0x2221174, 0x2221183, 0x2221228, 0x2221237, 0x2221246, 0x2221255, 0x2221264, 0x2221273,
+	0x2221282, 0x2221318, 0x2221327, 0x2221336, 0x2221345, 0x2221354, 0x2221363, 0x2221372,
+	0x2221381, 0x2221417, 0x2221426, 0x2221435, 0x2221444, 0x2221453, 0x2221462, 0x2221471,
+	0x2221516, 0x2221525, 0x2221534, 0x2221543, 0x2221552, 0x2221561, 0x2221615, 0x2221624,
+	0x2221633, 0x2221642, 0x2221651, 0x2221714, 0x2221723, 0x2221732, 0x2221741, 0x2221813,
+	0x2221822, 0x2221831, 0x2222128, 0x2222137, 0x2222146, 0x2222155, 0x2222164, 0x2222173,
+	0x2222182, 0x2222218, 0x2222227, 0x2222236, 0x2222245, 0x2222254, 0x2222263, 0x2222272,
+	0x2222281, 0x2222317, 0x2222326, 0x2222335, 0x2222344, 0x2222353, 0x2222362, 0x2222371,
+	0x2222416, 0x2222425, 0x2222434, 0x2222443, 0x2222452, 0x2222461, 0x2222515, 0x2222524,
+	0x2222533, 0x2222542, 0x2222551, 0x2222614, 0x2222623, 0x2222632, 0x2222641, 0x2222713,
+	0x2222722, 0x2222731, 0x2222812, 0x2222821, 0x2223118, 0x2223127, 0x2223136, 0x2223145,
+	0x2223154, 0x2223163, 0x2223172, 0x2223181, 0x2223217, 0x2223226, 0x2223235, 0x2223244,
+	0x2223253, 0x2223262, 0x2223271, 0x2223316, 0x2223325, 0x2223334, 0x2223343, 0x2223352,
+	0x2223361, 0x2223415, 0x2223424, 0x2223433, 0x2223442, 0x2223451, 0x2223514, 0x2223523,
+	0x2223532, 0x2223541, 0x2223613, 0x2223622, 0x2223631, 0x2223712, 0x2223721, 0x2223811,
+	0x2224117, 0x2224126, 0x2224135, 0x2224144, 0x2224153, 0x2224162, 0x2224171, 0x2224216,
+	0x2224225, 0x2224234, 0x2224243, 0x2224252, 0x2224261, 0x2224315, 0x2224324, 0x2224333,
+	0x2224342, 0x2224351, 0x2224414, 0x2224423, 0x2224432, 0x2224441, 0x2224513, 0x2224522,
+	0x2224531, 0x2224612, 0x2224621, 0x2224711, 0x2225116, 0x2225125, 0x2225134, 0x2225143,
+	0x2225152, 0x2225161, 0x2225215, 0x2225224, 0x2225233, 0x2225242, 0x2225251, 0x2225314,
+	0x2225323, 0x2225332, 0x2225341, 0x2225413, 0x2225422, 0x2225431, 0x2225512, 0x2225521,
+	0x2225611, 0x2226115, 0x2226124, 0x2226133, 0x2226142, 0x2226151, 0x2226214, 0x2226223,
+	0x2226232, 0x2226241, 0x2226313, 0x2226322, 0x2226331, 0x2226412, 0x2226421, 0x2226511,
+	0x2227114, 0x2227123, 0x2227132, 0x2227141, 0x2227213, 0x2227222, 0x2227231, 0x2227312,
+	0x2227321, 0x2227411, 0x2228113, 0x2228122, 0x2228131, 0x2228212, 0x2228221, 0x2228311,
+	0x2231128, 0x2231137, 0x2231146, 0x2231155, 0x2231164, 0x2231173, 0x2231182, 0x2231218,
+	0x2231227, 0x2231236, 0x2231245, 0x2231254, 0x2231263, 0x2231272, 0x2231281, 0x2231317,
+	0x2231326, 0x2231335, 0x2231344, 0x2231353, 0x2231362, 0x2231371, 0x2231416, 0x2231425,
+	0x2231434, 0x2231443, 0x2231452, 0x2231461, 0x2231515, 0x2231524, 0x2231533, 0x2231542,
+	0x2231551, 0x2231614, 0x2231623, 0x2231632, 0x2231641, 0x2231713, 0x2231722, 0x2231731,
+	0x2231812, 0x2231821, 0x2232118, 0x2232127, 0x2232136, 0x2232145, 0x2232154, 0x2232163,
+	0x2232172, 0x2232181, 0x2232217, 0x2232226, 0x2232235, 0x2232244, 0x2232253, 0x2232262,
+	0x2232271, 0x2232316, 0x2232325, 0x2232334, 0x2232343, 0x2232352, 0x2232361, 0x2232415,
+	0x2232424, 0x2232433, 0x2232442, 0x2232451, 0x2232514, 0x2232523, 0x2232532, 0x2232541,
+	0x2232613, 0x2232622, 0x2232631, 0x2232712, 0x2232721, 0x2232811, 0x2233117, 0x2233126,
+	0x2233135, 0x2233144, 0x2233153, 0x2233162, 0x2233171, 0x2233216, 0x2233225, 0x2233234,
+	0x2233243, 0x2233252, 0x2233261, 0x2233315, 0x2233324, 0x2233333, 0x2233342, 0x2233351,
+	0x2233414, 0x2233423, 0x2233432, 0x2233441, 0x2233513, 0x2233522, 0x2233531, 0x2233612,
+	0x2233621, 0x2233711, 0x2234116, 0x2234125, 0x2234134, 0x2234143, 0x2234152, 0x2234161,
+	0x2234215, 0x2234224, 0x2234233, 0x2234242, 0x2234251, 0x2234314, 0x2234323, 0x2234332,
+	0x2234341, 0x2234413, 0x2234422, 0x2234431, 0x2234512, 0x2234521, 0x2234611, 0x2235115,
+	0x2235124, 0x2235133, 0x2235142, 0x2235151, 0x2235214, 0x2235223, 0x2235232, 0x2235241,
+	0x2235313, 0x2235322, 0x2235331, 0x2235412, 0x2235421, 0x2235511, 0x2236114, 0x2236123,
+	0x2236132, 0x2236141, 0x2236213, 0x2236222, 0x2236231, 0x2236312, 0x2236321, 0x2236411,
+	0x2237113, 0x2237122, 0x2237131, 0x2237212, 0x2237221, 0x2237311, 0x2238112, 0x2238121,
+	0x2238211, 0x2241118, 0x2241127, 0x2241136, 0x2241145, 0x2241154, 0x2241163, 0x2241172,
+	0x2241181, 0x2241217, 0x2241226, 0x2241235, 0x2241244, 0x2241253, 0x2241262, 0x2241271,
+	0x2241316, 0x2241325, 0x2241334, 0x2241343, 0x2241352, 0x2241361, 0x2241415, 0x2241424,
+	0x2241433, 0x2241442, 0x2241451, 0x2241514, 0x2241523, 0x2241532, 0x2241541, 0x2241613,
+	0x2241622, 0x2241631, 0x2241712, 0x2241721, 0x2241811, 0x2242117, 0x2242126, 0x2242135,
+	0x2242144, 0x2242153, 0x2242162, 0x2242171, 0x2242216, 0x2242225, 0x2242234, 0x2242243,
+	0x2242252, 0x2242261, 0x2242315, 0x2242324, 0x2242333, 0x2242342, 0x2242351, 0x2242414,
+	0x2242423, 0x2242432, 0x2242441, 0x2242513, 0x2242522, 0x2242531, 0x2242612, 0x2242621,
+	0x2242711, 0x2243116, 0x2243125, 0x2243134, 0x2243143, 0x2243152, 0x2243161, 0x2243215,
+	0x2243224, 0x2243233, 0x2243242, 0x2243251, 0x2243314, 0x2243323, 0x2243332, 0x2243341,
+	0x2243413, 0x2243422, 0x2243431, 0x2243512, 0x2243521, 0x2243611, 0x2244115, 0x2244124,
+	0x2244133, 0x2244142, 0x2244151, 0x2244214, 0x2244223, 0x2244232, 0x2244241, 0x2244313,
+	0x2244322, 0x2244331, 0x2244412, 0x2244421, 0x2244511, 0x2245114, 0x2245123, 0x2245132,
+	0x2245141, 0x2245213, 0x2245222, 0x2245231, 0x2245312, 0x2245321, 0x2245411, 0x2246113,
+	0x2246122, 0x2246131, 0x2246212, 0x2246221, 0x2246311, 0x2247112, 0x2247121, 0x2247211,
+	0x2248111, 0x2251117, 0x2251126, 0x2251135, 0x2251144, 0x2251153, 0x2251162, 0x2251171,
+	0x2251216, 0x2251225, 0x2251234, 0x2251243, 0x2251252, 0x2251261, 0x2251315, 0x2251324,
+	0x2251333, 0x2251342, 0x2251351, 0x2251414, 0x2251423, 0x2251432, 0x2251441, 0x2251513,
+	0x2251522, 0x2251531, 0x2251612, 0x2251621, 0x2251711, 0x2252116, 0x2252125, 0x2252134,
+	0x2252143, 0x2252152, 0x2252161, 0x2252215, 0x2252224, 0x2252233, 0x2252242, 0x2252251,
+	0x2252314, 0x2252323, 0x2252332, 0x2252341, 0x2252413, 0x2252422, 0x2252431, 0x2252512,
+	0x2252521, 0x2252611, 0x2253115, 0x2253124, 0x2253133, 0x2253142, 0x2253151, 0x2253214,
+	0x2253223, 0x2253232, 0x2253241, 0x2253313, 0x2253322, 0x2253331, 0x2253412, 0x2253421,
+	0x2253511, 0x2254114, 0x2254123, 0x2254132, 0x2254141, 0x2254213, 0x2254222, 0x2254231,
+	0x2254312, 0x2254321, 0x2254411, 0x2255113, 0x2255122, 0x2255131, 0x2255212, 0x2255221,
+	0x2255311, 0x2256112, 0x2256121, 0x2256211, 0x2257111, 0x2261116, 0x2261125, 0x2261134,
+	0x2261143, 0x2261152, 0x2261161, 0x2261215, 0x2261224, 0x2261233, 0x2261242, 0x2261251,
+	0x2261314, 0x2261323, 0x2261332, 0x2261341, 0x2261413, 0x2261422, 0x2261431, 0x2261512,
+	0x2261521, 0x2261611, 0x2262115, 0x2262124, 0x2262133, 0x2262142, 0x2262151, 0x2262214,
+	0x2262223, 0x2262232, 0x2262241, 0x2262313, 0x2262322, 0x2262331, 0x2262412, 0x2262421,
+	0x2262511, 0x2263114, 0x2263123, 0x2263132, 0x2263141, 0x2263213, 0x2263222, 0x2263231,
+	0x2263312, 0x2263321, 0x2263411, 0x2264113, 0x2264122, 0x2264131, 0x2264212, 0x2264221,
+	0x2264311, 0x2265112, 0x2265121, 0x2265211, 0x2266111, 0x2271115, 0x2271124, 0x2271133,
+	0x2271142, 0x2271151, 0x2271214, 0x2271223, 0x2271232, 0x2271241, 0x2271313, 0x2271322,
+	0x2271331, 0x2271412, 0x2271421, 0x2271511, 0x2272114, 0x2272123, 0x2272132, 0x2272141,
+	0x2272213, 0x2272222, 0x2272231, 0x2272312, 0x2272321, 0x2272411, 0x2273113, 0x2273122,
+	0x2273131, 0x2273212, 0x2273221, 0x2273311, 0x2274112, 0x2274121, 0x2274211, 0x2275111,
+	0x2281114, 0x2281123, 0x2281132, 0x2281141, 0x2281213, 0x2281222, 0x2281231, 0x2281312,
+	0x2281321, 0x2281411, 0x2282113, 0x2282122, 0x2282131, 0x2282212, 0x2282221, 0x2282311,
+	0x2283112, 0x2283121, 0x2283211, 0x2284111, 0x2311138, 0x2311147, 0x2311156, 0x2311165,
+	0x2311174, 0x2311183, 0x2311228, 0x2311237, 0x2311246, 0x2311255, 0x2311264, 0x2311273,
+	0x2311282, 0x2311318, 0x2311327, 0x2311336, 0x2311345, 0x2311354, 0x2311363, 0x2311372,
+	0x2311381, 0x2311417, 0x2311426, 0x2311435, 0x2311444, 0x2311453, 0x2311462, 0x2311471,
+	0x2311516, 0x2311525, 0x2311534, 0x2311543, 0x2311552, 0x2311561, 0x2311615, 0x2311624,
+	0x2311633, 0x2311642, 0x2311651, 0x2311714, 0x2311723, 0x2311732, 0x2311741, 0x2311813,
+	0x2311822, 0x2311831, 0x2312128, 0x2312137, 0x2312146, 0x2312155, 0x2312164, 0x2312173,
+	0x2312182, 0x2312218, 0x2312227, 0x2312236, 0x2312245, 0x2312254, 0x2312263, 0x2312272,
+	0x2312281, 0x2312317, 0x2312326, 0x2312335, 0x2312344, 0x2312353, 0x2312362, 0x2312371,
+	0x2312416, 0x2312425, 0x2312434, 0x2312443, 0x2312452, 0x2312461, 0x2312515, 0x2312524,
+	0x2312533, 0x2312542, 0x2312551, 0x2312614, 0x2312623, 0x2312632, 0x2312641, 0x2312713,
+	0x2312722, 0x2312731, 0x2312812, 0x2312821, 0x2313118, 0x2313127, 0x2313136, 0x2313145,
+	0x2313154, 0x2313163, 0x2313172, 0x2313181, 0x2313217, 0x2313226, 0x2313235, 0x2313244,
+	0x2313253, 0x2313262, 0x2313271, 0x2313316, 0x2313325, 0x2313334, 0x2313343, 0x2313352,
+	0x2313361, 0x2313415, 0x2313424, 0x2313433, 0x2313442, 0x2313451, 0x2313514, 0x2313523,
+	0x2313532, 0x2313541, 0x2313613, 0x2313622, 0x2313631, 0x2313712, 0x2313721, 0x2313811,
+	0x2314117, 0x2314126, 0x2314135, 0x2314144, 0x2314153, 0x2314162, 0x2314171, 0x2314216,
+	0x2314225, 0x2314234, 0x2314243, 0x2314252, 0x2314261, 0x2314315, 0x2314324, 0x2314333,
+	0x2314342, 0x2314351, 0x2314414, 0x2314423, 0x2314432, 0x2314441, 0x2314513, 0x2314522,
+	0x2314531, 0x2314612, 0x2314621, 0x2314711, 0x2315116, 0x2315125, 0x2315134, 0x2315143,
+	0x2315152, 0x2315161, 0x2315215, 0x2315224, 0x2315233, 0x2315242, 0x2315251, 0x2315314,
+	0x2315323, 0x2315332, 0x2315341, 0x2315413, 0x2315422, 0x2315431, 0x2315512, 0x2315521,
+	0x2315611, 0x2316115, 0x2316124, 0x2316133, 0x2316142, 0x2316151, 0x2316214, 0x2316223,
+	0x2316232, 0x2316241, 0x2316313, 0x2316322, 0x2316331, 0x2316412, 0x2316421, 0x2316511,
+	0x2317114, 0x2317123, 0x2317132, 0x2317141, 0x2317213, 0x2317222, 0x2317231, 0x2317312,
+	0x2317321, 0x2317411, 0x2318113, 0x2318122, 0x2318131, 0x2318212, 0x2318221, 0x2318311,
+	0x2321128, 0x2321137, 0x2321146, 0x2321155, 0x2321164, 0x2321173, 0x2321182, 0x2321218,
+	0x2321227, 0x2321236, 0x2321245, 0x2321254, 0x2321263, 0x2321272, 0x2321281, 0x2321317,
+	0x2321326, 0x2321335, 0x2321344, 0x2321353, 0x2321362, 0x2321371, 0x2321416, 0x2321425,
+	0x2321434, 0x2321443, 0x2321452, 0x2321461, 0x2321515, 0x2321524, 0x2321533, 0x2321542,
+	0x2321551, 0x2321614, 0x2321623, 0x2321632, 0x2321641, 0x2321713, 0x2321722, 0x2321731,
+	0x2321812, 0x2321821, 0x2322118, 0x2322127, 0x2322136, 0x2322145, 0x2322154, 0x2322163,
+	0x2322172, 0x2322181, 0x2322217, 0x2322226, 0x2322235, 0x2322244, 0x2322253, 0x2322262,
+	0x2322271, 0x2322316, 0x2322325, 0x2322334, 0x2322343, 0x2322352, 0x2322361, 0x2322415,
+	0x2322424, 0x2322433, 0x2322442, 0x2322451, 0x2322514, 0x2322523, 0x2322532, 0x2322541,
+	0x2322613, 0x2322622, 0x2322631, 0x2322712, 0x2322721, 0x2322811, 0x2323117, 0x2323126,
+	0x2323135, 0x2323144, 0x2323153, 0x2323162, 0x2323171, 0x2323216, 0x2323225, 0x2323234,
+	0x2323243, 0x2323252, 0x2323261, 0x2323315, 0x2323324, 0x2323333, 0x2323342, 0x2323351,
+	0x2323414, 0x2323423, 0x2323432, 0x2323441, 0x2323513, 0x2323522, 0x2323531, 0x2323612,
+	0x2323621, 0x2323711, 0x2324116, 0x2324125, 0x2324134, 0x2324143, 0x2324152, 0x2324161,
+	0x2324215, 0x2324224, 0x2324233, 0x2324242, 0x2324251, 0x2324314, 0x2324323, 0x2324332,
+	0x2324341, 0x2324413, 0x2324422, 0x2324431, 0x2324512, 0x2324521, 0x2324611, 0x2325115,
+	0x2325124, 0x2325133, 0x2325142, 0x2325151, 0x2325214, 0x2325223, 0x2325232, 0x2325241,
+	0x2325313, 0x2325322, 0x2325331, 0x2325412, 0x2325421, 0x2325511, 0x2326114, 0x2326123,
+	0x2326132, 0x2326141, 0x2326213, 0x2326222, 0x2326231, 0x2326312, 0x2326321, 0x2326411,
+	0x2327113, 0x2327122, 0x2327131, 0x2327212, 0x2327221, 0x2327311, 0x2328112, 0x2328121,
+	0x2328211, 0x2331118, 0x2331127, 0x2331136, 0x2331145, 0x2331154, 0x2331163, 0x2331172,
+	0x2331181, 0x2331217, 0x2331226, 0x2331235, 0x2331244, 0x2331253, 0x2331262, 0x2331271,
+	0x2331316, 0x2331325, 0x2331334, 0x2331343, 0x2331352, 0x2331361, 0x2331415, 0x2331424,
+	0x2331433, 0x2331442, 0x2331451, 0x2331514, 0x2331523, 0x2331532, 0x2331541, 0x2331613,
+	0x2331622, 0x2331631, 0x2331712, 0x2331721, 0x2331811, 0x2332117, 0x2332126, 0x2332135,
+	0x2332144, 0x2332153, 0x2332162, 0x2332171, 0x2332216, 0x2332225, 0x2332234, 0x2332243,
+	0x2332252, 0x2332261, 0x2332315, 0x2332324, 0x2332333, 0x2332342, 0x2332351, 0x2332414,
+	0x2332423, 0x2332432, 0x2332441, 0x2332513, 0x2332522, 0x2332531, 0x2332612, 0x2332621,
+	0x2332711, 0x2333116, 0x2333125, 0x2333134, 0x2333143, 0x2333152, 0x2333161, 0x2333215,
+	0x2333224, 0x2333233, 0x2333242, 0x2333251, 0x2333314, 0x2333323, 0x2333332, 0x2333341,
+	0x2333413, 0x2333422, 0x2333431, 0x2333512, 0x2333521, 0x2333611, 0x2334115, 0x2334124,
+	0x2334133, 0x2334142, 0x2334151, 0x2334214, 0x2334223, 0x2334232, 0x2334241, 0x2334313,
+	0x2334322, 0x2334331, 0x2334412, 0x2334421, 0x2334511, 0x2335114, 0x2335123, 0x2335132,
+	0x2335141, 0x2335213, 0x2335222, 0x2335231, 0x2335312, 0x2335321, 0x2335411, 0x2336113,
+	0x2336122, 0x2336131, 0x2336212, 0x2336221, 0x2336311, 0x2337112, 0x2337121, 0x2337211,
+	0x2338111, 0x2341117, 0x2341126, 0x2341135, 0x2341144, 0x2341153, 0x2341162, 0x2341171,
+	0x2341216, 0x2341225, 0x2341234, 0x2341243, 0x2341252, 0x2341261, 0x2341315, 0x2341324,
+	0x2341333, 0x2341342, 0x2341351, 0x2341414, 0x2341423, 0x2341432, 0x2341441, 0x2341513,
+	0x2341522, 0x2341531, 0x2341612, 0x2341621, 0x2341711, 0x2342116, 0x2342125, 0x2342134,
+	0x2342143, 0x2342152, 0x2342161, 0x2342215, 0x2342224, 0x2342233, 0x2342242, 0x2342251,
+	0x2342314, 0x2342323, 0x2342332, 0x2342341, 0x2342413, 0x2342422, 0x2342431, 0x2342512,
+	0x2342521, 0x2342611, 0x2343115, 0x2343124, 0x2343133, 0x2343142, 0x2343151, 0x2343214,
+	0x2343223, 0x2343232, 0x2343241, 0x2343313, 0x2343322, 0x2343331, 0x2343412, 0x2343421,
+	0x2343511, 0x2344114, 0x2344123, 0x2344132, 0x2344141, 0x2344213, 0x2344222, 0x2344231,
+	0x2344312, 0x2344321, 0x2344411, 0x2345113, 0x2345122, 0x2345131, 0x2345212, 0x2345221,
+	0x2345311, 0x2346112, 0x2346121, 0x2346211, 0x2347111, 0x2351116, 0x2351125, 0x2351134,
+	0x2351143, 0x2351152, 0x2351161, 0x2351215, 0x2351224, 0x2351233, 0x2351242, 0x2351251,
+	0x2351314, 0x2351323, 0x2351332, 0x2351341, 0x2351413, 0x2351422, 0x2351431, 0x2351512,
+	0x2351521, 0x2351611, 0x2352115, 0x2352124, 0x2352133, 0x2352142, 0x2352151, 0x2352214,
+	0x2352223, 0x2352232, 0x2352241, 0x2352313, 0x2352322, 0x2352331, 0x2352412, 0x2352421,
+	0x2352511, 0x2353114, 0x2353123, 0x2353132, 0x2353141, 0x2353213, 0x2353222, 0x2353231,
+	0x2353312, 0x2353321, 0x2353411, 0x2354113, 0x2354122, 0x2354131, 0x2354212, 0x2354221,
+	0x2354311, 0x2355112, 0x2355121, 0x2355211, 0x2356111, 0x2361115, 0x2361124, 0x2361133,
+	0x2361142, 0x2361151, 0x2361214, 0x2361223, 0x2361232, 0x2361241, 0x2361313, 0x2361322,
+	0x2361331, 0x2361412, 0x2361421, 0x2361511, 0x2362114, 0x2362123, 0x2362132, 0x2362141,
+	0x2362213, 0x2362222, 0x2362231, 0x2362312, 0x2362321, 0x2362411, 0x2363113, 0x2363122,
+	0x2363131, 0x2363212, 0x2363221, 0x2363311, 0x2364112, 0x2364121, 0x2364211, 0x2365111,
+	0x2371114, 0x2371123, 0x2371132, 0x2371141, 0x2371213, 0x2371222, 0x2371231, 0x2371312,
+	0x2371321, 0x2371411, 0x2372113, 0x2372122, 0x2372131, 0x2372212, 0x2372221, 0x2372311,
+	0x2373112, 0x2373121, 0x2373211, 0x2374111, 0x2381113, 0x2381122, 0x2381131, 0x2381212,
+	0x2381221, 0x2381311, 0x2382112, 0x2382121, 0x2382211, 0x2383111, 0x2411128, 0x2411137,
+	0x2411146, 0x2411155, 0x2411164, 0x2411173, 0x2411182, 0x2411218, 0x2411227, 0x2411236,
+	0x2411245, 0x2411254, 0x2411263, 0x2411272, 0x2411281, 0x2411317, 0x2411326, 0x2411335,
+	0x2411344, 0x2411353, 0x2411362, 0x2411371, 0x2411416, 0x2411425, 0x2411434, 0x2411443,
+	0x2411452, 0x2411461, 0x2411515, 0x2411524, 0x2411533, 0x2411542, 0x2411551, 0x2411614,
+	0x2411623, 0x2411632, 0x2411641, 0x2411713, 0x2411722, 0x2411731, 0x2411812, 0x2411821,
+	0x2412118, 0x2412127, 0x2412136, 0x2412145, 0x2412154, 0x2412163, 0x2412172, 0x2412181,
+	0x2412217, 0x2412226, 0x2412235, 0x2412244, 0x2412253, 0x2412262, 0x2412271, 0x2412316,
+	0x2412325, 0x2412334, 0x2412343, 0x2412352, 0x2412361, 0x2412415, 0x2412424, 0x2412433,
+	0x2412442, 0x2412451, 0x2412514, 0x2412523, 0x2412532, 0x2412541, 0x2412613, 0x2412622,
+	0x2412631, 0x2412712, 0x2412721, 0x2412811, 0x2413117, 0x2413126, 0x2413135, 0x2413144,
+	0x2413153, 0x2413162, 0x2413171, 0x2413216, 0x2413225, 0x2413234, 0x2413243, 0x2413252,
+	0x2413261, 0x2413315, 0x2413324, 0x2413333, 0x2413342, 0x2413351, 0x2413414, 0x2413423,
+	0x2413432, 0x2413441, 0x2413513, 0x2413522, 0x2413531, 0x2413612, 0x2413621, 0x2413711,
+	0x2414116, 0x2414125, 0x2414134, 0x2414143, 0x2414152, 0x2414161, 0x2414215, 0x2414224,
+	0x2414233, 0x2414242, 0x2414251, 0x2414314, 0x2414323, 0x2414332, 0x2414341, 0x2414413,
+	0x2414422, 0x2414431, 0x2414512, 0x2414521, 0x2414611, 0x2415115, 0x2415124, 0x2415133,
+	0x2415142, 0x2415151, 0x2415214, 0x2415223, 0x2415232, 0x2415241, 0x2415313, 0x2415322,
+	0x2415331, 0x2415412, 0x2415421, 0x2415511, 0x2416114, 0x2416123, 0x2416132, 0x2416141,
+	0x2416213, 0x2416222, 0x2416231, 0x2416312, 0x2416321, 0x2416411, 0x2417113, 0x2417122,
+	0x2417131, 0x2417212, 0x2417221, 0x2417311, 0x2418112, 0x2418121, 0x2418211, 0x2421118,
+	0x2421127, 0x2421136, 0x2421145, 0x2421154, 0x2421163, 0x2421172, 0x2421181, 0x2421217,
+	0x2421226, 0x2421235, 0x2421244, 0x2421253, 0x2421262, 0x2421271, 0x2421316, 0x2421325,
+	0x2421334, 0x2421343, 0x2421352, 0x2421361, 0x2421415, 0x2421424, 0x2421433, 0x2421442,
+	0x2421451, 0x2421514, 0x2421523, 0x2421532, 0x2421541, 0x2421613, 0x2421622, 0x2421631,
+	0x2421712, 0x2421721, 0x2421811, 0x2422117, 0x2422126, 0x2422135, 0x2422144, 0x2422153,
+	0x2422162, 0x2422171, 0x2422216, 0x2422225, 0x2422234, 0x2422243, 0x2422252, 0x2422261,
+	0x2422315, 0x2422324, 0x2422333, 0x2422342, 0x2422351, 0x2422414, 0x2422423, 0x2422432,
+	0x2422441, 0x2422513, 0x2422522, 0x2422531, 0x2422612, 0x2422621, 0x2422711, 0x2423116,
+	0x2423125, 0x2423134, 0x2423143, 0x2423152, 0x2423161, 0x2423215, 0x2423224, 0x2423233,
+	0x2423242, 0x2423251, 0x2423314, 0x2423323, 0x2423332, 0x2423341, 0x2423413, 0x2423422,
+	0x2423431, 0x2423512, 0x2423521, 0x2423611, 0x2424115, 0x2424124, 0x2424133, 0x2424142,
+	0x2424151, 0x2424214, 0x2424223, 0x2424232, 0x2424241, 0x2424313, 0x2424322, 0x2424331,
+	0x2424412, 0x2424421, 0x2424511, 0x2425114, 0x2425123, 0x2425132, 0x2425141, 0x2425213,
+	0x2425222, 0x2425231, 0x2425312, 0x2425321, 0x2425411, 0x2426113, 0x2426122, 0x2426131,
+	0x2426212, 0x2426221, 0x2426311, 0x2427112, 0x2427121, 0x2427211, 0x2428111, 0x2431117,
+	0x2431126, 0x2431135, 0x2431144, 0x2431153, 0x2431162, 0x2431171, 0x2431216, 0x2431225,
+	0x2431234, 0x2431243, 0x2431252, 0x2431261, 0x2431315, 0x2431324, 0x2431333, 0x2431342,
+	0x2431351, 0x2431414, 0x2431423, 0x2431432, 0x2431441, 0x2431513, 0x2431522, 0x2431531,
+	0x2431612, 0x2431621, 0x2431711, 0x2432116, 0x2432125, 0x2432134, 0x2432143, 0x2432152,
+	0x2432161, 0x2432215, 0x2432224, 0x2432233, 0x2432242, 0x2432251, 0x2432314, 0x2432323,
+	0x2432332, 0x2432341, 0x2432413, 0x2432422, 0x2432431, 0x2432512, 0x2432521, 0x2432611,
+	0x2433115, 0x2433124, 0x2433133, 0x2433142, 0x2433151, 0x2433214, 0x2433223, 0x2433232,
+	0x2433241, 0x2433313, 0x2433322, 0x2433331, 0x2433412, 0x2433421, 0x2433511, 0x2434114,
+	0x2434123, 0x2434132, 0x2434141, 0x2434213, 0x2434222, 0x2434231, 0x2434312, 0x2434321,
+	0x2434411, 0x2435113, 0x2435122, 0x2435131, 0x2435212, 0x2435221, 0x2435311, 0x2436112,
+	0x2436121, 0x2436211, 0x2437111, 0x2441116, 0x2441125, 0x2441134, 0x2441143, 0x2441152,
+	0x2441161, 0x2441215, 0x2441224, 0x2441233, 0x2441242, 0x2441251, 0x2441314, 0x2441323,
+	0x2441332, 0x2441341, 0x2441413, 0x2441422, 0x2441431, 0x2441512, 0x2441521, 0x2441611,
+	0x2442115, 0x2442124, 0x2442133, 0x2442142, 0x2442151, 0x2442214, 0x2442223, 0x2442232,
+	0x2442241, 0x2442313, 0x2442322, 0x2442331, 0x2442412, 0x2442421, 0x2442511, 0x2443114,
+	0x2443123, 0x2443132, 0x2443141, 0x2443213, 0x2443222, 0x2443231, 0x2443312, 0x2443321,
+	0x2443411, 0x2444113, 0x2444122, 0x2444131, 0x2444212, 0x2444221, 0x2444311, 0x2445112,
+	0x2445121, 0x2445211, 0x2446111, 0x2451115, 0x2451124, 0x2451133, 0x2451142, 0x2451151,
+	0x2451214, 0x2451223, 0x2451232, 0x2451241, 0x2451313, 0x2451322, 0x2451331, 0x2451412,
+	0x2451421, 0x2451511, 0x2452114, 0x2452123, 0x2452132, 0x2452141, 0x2452213, 0x2452222,
+	0x2452231, 0x2452312, 0x2452321, 0x2452411, 0x2453113, 0x2453122, 0x2453131, 0x2453212,
+	0x2453221, 0x2453311, 0x2454112, 0x2454121, 0x2454211, 0x2455111, 0x2461114, 0x2461123,
+	0x2461132, 0x2461141, 0x2461213, 0x2461222, 0x2461231, 0x2461312, 0x2461321, 0x2461411,
+	0x2462113, 0x2462122, 0x2462131, 0x2462212, 0x2462221, 0x2462311, 0x2463112, 0x2463121,
+	0x2463211, 0x2464111, 0x2471113, 0x2471122, 0x2471131, 0x2471212, 0x2471221, 0x2471311,
+	0x2472112, 0x2472121, 0x2472211, 0x2473111, 0x2481112, 0x2481121, 0x2481211, 0x2482111,
+	0x2511118, 0x2511127, 0x2511136, 0x2511145, 0x2511154, 0x2511163, 0x2511172, 0x2511181,
+	0x2511217, 0x2511226, 0x2511235, 0x2511244, 0x2511253, 0x2511262, 0x2511271, 0x2511316,
+	0x2511325, 0x2511334, 0x2511343, 0x2511352, 0x2511361, 0x2511415, 0x2511424, 0x2511433,
+	0x2511442, 0x2511451, 0x2511514, 0x2511523, 0x2511532, 0x2511541, 0x2511613, 0x2511622,
+	0x2511631, 0x2511712, 0x2511721, 0x2511811, 0x2512117, 0x2512126, 0x2512135, 0x2512144,
+	0x2512153, 0x2512162, 0x2512171, 0x2512216, 0x2512225, 0x2512234, 0x2512243, 0x2512252,
+	0x2512261, 0x2512315, 0x2512324, 0x2512333, 0x2512342, 0x2512351, 0x2512414, 0x2512423,
+	0x2512432, 0x2512441, 0x2512513, 0x2512522, 0x2512531, 0x2512612, 0x2512621, 0x2512711,
+	0x2513116, 0x2513125, 0x2513134, 0x2513143, 0x2513152, 0x2513161, 0x2513215, 0x2513224,
+	0x2513233, 0x2513242, 0x2513251, 0x2513314, 0x2513323, 0x2513332, 0x2513341, 0x2513413,
+	0x2513422, 0x2513431, 0x2513512, 0x2513521, 0x2513611, 0x2514115, 0x2514124, 0x2514133,
+	0x2514142, 0x2514151, 0x2514214, 0x2514223, 0x2514232, 0x2514241, 0x2514313, 0x2514322,
+	0x2514331, 0x2514412, 0x2514421, 0x2514511, 0x2515114, 0x2515123, 0x2515132, 0x2515141,
+	0x2515213, 0x2515222, 0x2515231, 0x2515312, 0x2515321, 0x2515411, 0x2516113, 0x2516122,
+	0x2516131, 0x2516212, 0x2516221, 0x2516311, 0x2517112, 0x2517121, 0x2517211, 0x2518111,
+	0x2521117, 0x2521126, 0x2521135, 0x2521144, 0x2521153, 0x2521162, 0x2521171, 0x2521216,
+	0x2521225, 0x2521234, 0x2521243, 0x2521252, 0x2521261, 0x2521315, 0x2521324, 0x2521333,
+	0x2521342, 0x2521351, 0x2521414, 0x2521423, 0x2521432, 0x2521441, 0x2521513, 0x2521522,
+	0x2521531, 0x2521612, 0x2521621, 0x2521711, 0x2522116, 0x2522125, 0x2522134, 0x2522143,
+	0x2522152, 0x2522161, 0x2522215, 0x2522224, 0x2522233, 0x2522242, 0x2522251, 0x2522314,
+	0x2522323, 0x2522332, 0x2522341, 0x2522413, 0x2522422, 0x2522431, 0x2522512, 0x2522521,
+	0x2522611, 0x2523115, 0x2523124, 0x2523133, 0x2523142, 0x2523151, 0x2523214, 0x2523223,
+	0x2523232, 0x2523241, 0x2523313, 0x2523322, 0x2523331, 0x2523412, 0x2523421, 0x2523511,
+	0x2524114, 0x2524123, 0x2524132, 0x2524141, 0x2524213, 0x2524222, 0x2524231, 0x2524312,
+	0x2524321, 0x2524411, 0x2525113, 0x2525122, 0x2525131, 0x2525212, 0x2525221, 0x2525311,
+	0x2526112, 0x2526121, 0x2526211, 0x2527111, 0x2531116, 0x2531125, 0x2531134, 0x2531143,
+	0x2531152, 0x2531161, 0x2531215, 0x2531224, 0x2531233, 0x2531242, 0x2531251, 0x2531314,
+	0x2531323, 0x2531332, 0x2531341, 0x2531413, 0x2531422, 0x2531431, 0x2531512, 0x2531521,
+	0x2531611, 0x2532115, 0x2532124, 0x2532133, 0x2532142, 0x2532151, 0x2532214, 0x2532223,
+	0x2532232, 0x2532241, 0x2532313, 0x2532322, 0x2532331, 0x2532412, 0x2532421, 0x2532511,
+	0x2533114, 0x2533123, 0x2533132, 0x2533141, 0x2533213, 0x2533222, 0x2533231, 0x2533312,
+	0x2533321, 0x2533411, 0x2534113, 0x2534122, 0x2534131, 0x2534212, 0x2534221, 0x2534311,
+	0x2535112, 0x2535121, 0x2535211, 0x2536111, 0x2541115, 0x2541124, 0x2541133, 0x2541142,
+	0x2541151, 0x2541214, 0x2541223, 0x2541232, 0x2541241, 0x2541313, 0x2541322, 0x2541331,
+	0x2541412, 0x2541421, 0x2541511, 0x2542114, 0x2542123, 0x2542132, 0x2542141, 0x2542213,
+	0x2542222, 0x2542231, 0x2542312, 0x2542321, 0x2542411, 0x2543113, 0x2543122, 0x2543131,
+	0x2543212, 0x2543221, 0x2543311, 0x2544112, 0x2544121, 0x2544211, 0x2545111, 0x2551114,
+	0x2551123, 0x2551132, 0x2551141, 0x2551213, 0x2551222, 0x2551231, 0x2551312, 0x2551321,
+	0x2551411, 0x2552113, 0x2552122, 0x2552131, 0x2552212, 0x2552221, 0x2552311, 0x2553112,
+	0x2553121, 0x2553211, 0x2554111, 0x2561113, 0x2561122, 0x2561131, 0x2561212, 0x2561221,
+	0x2561311, 0x2562112, 0x2562121, 0x2562211, 0x2563111, 0x2571112, 0x2571121, 0x2571211,
+	0x2572111, 0x2581111, 0x2611117, 0x2611126, 0x2611135, 0x2611144, 0x2611153, 0x2611162,
+	0x2611171, 0x2611216, 0x2611225, 0x2611234, 0x2611243, 0x2611252, 0x2611261, 0x2611315,
+	0x2611324, 0x2611333, 0x2611342, 0x2611351, 0x2611414, 0x2611423, 0x2611432, 0x2611441,
+	0x2611513, 0x2611522, 0x2611531, 0x2611612, 0x2611621, 0x2611711, 0x2612116, 0x2612125,
+	0x2612134, 0x2612143, 0x2612152, 0x2612161, 0x2612215, 0x2612224, 0x2612233, 0x2612242,
+	0x2612251, 0x2612314, 0x2612323, 0x2612332, 0x2612341, 0x2612413, 0x2612422, 0x2612431,
+	0x2612512, 0x2612521, 0x2612611, 0x2613115, 0x2613124, 0x2613133, 0x2613142, 0x2613151,
+	0x2613214, 0x2613223, 0x2613232, 0x2613241, 0x2613313, 0x2613322, 0x2613331, 0x2613412,
+	0x2613421, 0x2613511, 0x2614114, 0x2614123, 0x2614132, 0x2614141, 0x2614213, 0x2614222,
+	0x2614231, 0x2614312, 0x2614321, 0x2614411, 0x2615113, 0x2615122, 0x2615131, 0x2615212,
+	0x2615221, 0x2615311, 0x2616112, 0x2616121, 0x2616211, 0x2617111, 0x2621116, 0x2621125,
+	0x2621134, 0x2621143, 0x2621152, 0x2621161, 0x2621215, 0x2621224, 0x2621233, 0x2621242,
+	0x2621251, 0x2621314, 0x2621323, 0x2621332, 0x2621341, 0x2621413, 0x2621422, 0x2621431,
+	0x2621512, 0x2621521, 0x2621611, 0x2622115, 0x2622124, 0x2622133, 0x2622142, 0x2622151,
+	0x2622214, 0x2622223, 0x2622232, 0x2622241, 0x2622313, 0x2622322, 0x2622331, 0x2622412,
+	0x2622421, 0x2622511, 0x2623114, 0x2623123, 0x2623132, 0x2623141, 0x2623213, 0x2623222,
+	0x2623231, 0x2623312, 0x2623321, 0x2623411, 0x2624113, 0x2624122, 0x2624131, 0x2624212,
+	0x2624221, 0x2624311, 0x2625112, 0x2625121, 0x2625211, 0x2626111, 0x2631115, 0x2631124,
+	0x2631133, 0x2631142, 0x2631151, 0x2631214, 0x2631223, 0x2631232, 0x2631241, 0x2631313,
+	0x2631322, 0x2631331, 0x2631412, 0x2631421, 0x2631511, 0x2632114, 0x2632123, 0x2632132,
+	0x2632141, 0x2632213, 0x2632222, 0x2632231, 0x2632312, 0x2632321, 0x2632411, 0x2633113,
+	0x2633122, 0x2633131, 0x2633212, 0x2633221, 0x2633311, 0x2634112, 0x2634121, 0x2634211,
+	0x2635111, 0x2641114, 0x2641123, 0x2641132, 0x2641141, 0x2641213, 0x2641222, 0x2641231,
+	0x2641312, 0x2641321, 0x2641411, 0x2642113, 0x2642122, 0x2642131, 0x2642212, 0x2642221,
+	0x2642311, 0x2643112, 0x2643121, 0x2643211, 0x2644111, 0x2651113, 0x2651122, 0x2651131,
+	0x2651212, 0x2651221, 0x2651311, 0x2652112, 0x2652121, 0x2652211, 0x2653111, 0x2661112,
+	0x2661121, 0x2661211, 0x2662111, 0x2671111, 0x2711116, 0x2711125, 0x2711134, 0x2711143,
+	0x2711152, 0x2711161, 0x2711215, 0x2711224, 0x2711233, 0x2711242, 0x2711251, 0x2711314,
+	0x2711323, 0x2711332, 0x2711341, 0x2711413, 0x2711422, 0x2711431, 0x2711512, 0x2711521,
+	0x2711611, 0x2712115, 0x2712124, 0x2712133, 0x2712142, 0x2712151, 0x2712214, 0x2712223,
+	0x2712232, 0x2712241, 0x2712313, 0x2712322, 0x2712331, 0x2712412, 0x2712421, 0x2712511,
+	0x2713114, 0x2713123, 0x2713132, 0x2713141, 0x2713213, 0x2713222, 0x2713231, 0x2713312,
+	0x2713321, 0x2713411, 0x2714113, 0x2714122, 0x2714131, 0x2714212, 0x2714221, 0x2714311,
+	0x2715112, 0x2715121, 0x2715211, 0x2716111, 0x2721115, 0x2721124, 0x2721133, 0x2721142,
+	0x2721151, 0x2721214, 0x2721223, 0x2721232, 0x2721241, 0x2721313, 0x2721322, 0x2721331,
+	0x2721412, 0x2721421, 0x2721511, 0x2722114, 0x2722123, 0x2722132, 0x2722141, 0x2722213,
+	0x2722222, 0x2722231, 0x2722312, 0x2722321, 0x2722411, 0x2723113, 0x2723122, 0x2723131,
+	0x2723212, 0x2723221, 0x2723311, 0x2724112, 0x2724121, 0x2724211, 0x2725111, 0x2731114,
+	0x2731123, 0x2731132, 0x2731141, 0x2731213, 0x2731222, 0x2731231, 0x2731312, 0x2731321,
+	0x2731411, 0x2732113, 0x2732122, 0x2732131, 0x2732212, 0x2732221, 0x2732311, 0x2733112,
+	0x2733121, 0x2733211, 0x2734111, 0x2741113, 0x2741122, 0x2741131, 0x2741212, 0x2741221,
+	0x2741311, 0x2742112, 0x2742121, 0x2742211, 0x2743111, 0x2751112, 0x2751121, 0x2751211,
+	0x2752111, 0x2761111, 0x2811115, 0x2811124, 0x2811133, 0x2811142, 0x2811151, 0x2811214,
+	0x2811223, 0x2811232, 0x2811241, 0x2811313, 0x2811322, 0x2811331, 0x2811412, 0x2811421,
+	0x2811511, 0x2812114, 0x2812123, 0x2812132, 0x2812141, 0x2812213, 0x2812222, 0x2812231,
+	0x2812312, 0x2812321, 0x2812411, 0x2813113, 0x2813122, 0x2813131, 0x2813212, 0x2813221,
+	0x2813311, 0x2814112, 0x2814121, 0x2814211, 0x2815111, 0x2821114, 0x2821123, 0x2821132,
+	0x2821141, 0x2821213, 0x2821222, 0x2821231, 0x2821312, 0x2821321, 0x2821411, 0x2822113,
+	0x2822122, 0x2822131, 0x2822212, 0x2822221, 0x2822311, 0x2823112, 0x2823121, 0x2823211,
+	0x2824111, 0x2831113, 0x2831122, 0x2831131, 0x2831212, 0x2831221, 0x2831311, 0x2832112,
+	0x2832121, 0x2832211, 0x2833111, 0x2841112, 0x2841121, 0x2841211, 0x2842111, 0x2851111,
+	0x3111148, 0x3111157, 0x3111166, 0x3111175, 0x3111184, 0x3111238, 0x3111247, 0x3111256,
+	0x3111265, 0x3111274, 0x3111283, 0x3111328, 0x3111337, 0x3111346, 0x3111355, 0x3111364,
+	0x3111373, 0x3111382, 0x3111418, 0x3111427, 0x3111436, 0x3111445, 0x3111454, 0x3111463,
+	0x3111472, 0x3111481, 0x3111517, 0x3111526, 0x3111535, 0x3111544, 0x3111553, 0x3111562,
+	0x3111571, 0x3111616, 0x3111625, 0x3111634, 0x3111643, 0x3111652, 0x3111661, 0x3111715,
+	0x3111724, 0x3111733, 0x3111742, 0x3111751, 0x3111814, 0x3111823, 0x3111832, 0x3111841,
+	0x3112138, 0x3112147, 0x3112156, 0x3112165, 0x3112174, 0x3112183, 0x3112228, 0x3112237,
+	0x3112246, 0x3112255, 0x3112264, 0x3112273, 0x3112282, 0x3112318, 0x3112327, 0x3112336,
+	0x3112345, 0x3112354, 0x3112363, 0x3112372, 0x3112381, 0x3112417, 0x3112426, 0x3112435,
+	0x3112444, 0x3112453, 0x3112462, 0x3112471, 0x3112516, 0x3112525, 0x3112534, 0x3112543,
+	0x3112552, 0x3112561, 0x3112615, 0x3112624, 0x3112633, 0x3112642, 0x3112651, 0x3112714,
+	0x3112723, 0x3112732, 0x3112741, 0x3112813, 0x3112822, 0x3112831, 0x3113128, 0x3113137,
+	0x3113146, 0x3113155, 0x3113164, 0x3113173, 0x3113182, 0x3113218, 0x3113227, 0x3113236,
+	0x3113245, 0x3113254, 0x3113263, 0x3113272, 0x3113281, 0x3113317, 0x3113326, 0x3113335,
+	0x3113344, 0x3113353, 0x3113362, 0x3113371, 0x3113416, 0x3113425, 0x3113434, 0x3113443,
+	0x3113452, 0x3113461, 0x3113515, 0x3113524, 0x3113533, 0x3113542, 0x3113551, 0x3113614,
+	0x3113623, 0x3113632, 0x3113641, 0x3113713, 0x3113722, 0x3113731, 0x3113812, 0x3113821,
+	0x3114118, 0x3114127, 0x3114136, 0x3114145, 0x3114154, 0x3114163, 0x3114172, 0x3114181,
+	0x3114217, 0x3114226, 0x3114235, 0x3114244, 0x3114253, 0x3114262, 0x3114271, 0x3114316,
+	0x3114325, 0x3114334, 0x3114343, 0x3114352, 0x3114361, 0x3114415, 0x3114424, 0x3114433,
+	0x3114442, 0x3114451, 0x3114514, 0x3114523, 0x3114532, 0x3114541, 0x3114613, 0x3114622,
+	0x3114631, 0x3114712, 0x3114721, 0x3114811, 0x3115117, 0x3115126, 0x3115135, 0x3115144,
+	0x3115153, 0x3115162, 0x3115171, 0x3115216, 0x3115225, 0x3115234, 0x3115243, 0x3115252,
+	0x3115261, 0x3115315, 0x3115324, 0x3115333, 0x3115342, 0x3115351, 0x3115414, 0x3115423,
+	0x3115432, 0x3115441, 0x3115513, 0x3115522, 0x3115531, 0x3115612, 0x3115621, 0x3115711,
+	0x3116116, 0x3116125, 0x3116134, 0x3116143, 0x3116152, 0x3116161, 0x3116215, 0x3116224,
+	0x3116233, 0x3116242, 0x3116251, 0x3116314, 0x3116323, 0x3116332, 0x3116341, 0x3116413,
+	0x3116422, 0x3116431, 0x3116512, 0x3116521, 0x3116611, 0x3117115, 0x3117124, 0x3117133,
+	0x3117142, 0x3117151, 0x3117214, 0x3117223, 0x3117232, 0x3117241, 0x3117313, 0x3117322,
+	0x3117331, 0x3117412, 0x3117421, 0x3117511, 0x3118114, 0x3118123, 0x3118132, 0x3118141,
+	0x3118213, 0x3118222, 0x3118231, 0x3118312, 0x3118321, 0x3118411, 0x3121138, 0x3121147,
+	0x3121156, 0x3121165, 0x3121174, 0x3121183, 0x3121228, 0x3121237, 0x3121246, 0x3121255,
+	0x3121264, 0x3121273, 0x3121282, 0x3121318, 0x3121327, 0x3121336, 0x3121345, 0x3121354,
+	0x3121363, 0x3121372, 0x3121381, 0x3121417, 0x3121426, 0x3121435, 0x3121444, 0x3121453,
+	0x3121462, 0x3121471, 0x3121516, 0x3121525, 0x3121534, 0x3121543, 0x3121552, 0x3121561,
+	0x3121615, 0x3121624, 0x3121633, 0x3121642, 0x3121651, 0x3121714, 0x3121723, 0x3121732,
+	0x3121741, 0x3121813, 0x3121822, 0x3121831, 0x3122128, 0x3122137, 0x3122146, 0x3122155,
+	0x3122164, 0x3122173, 0x3122182, 0x3122218, 0x3122227, 0x3122236, 0x3122245, 0x3122254,
+	0x3122263, 0x3122272, 0x3122281, 0x3122317, 0x3122326, 0x3122335, 0x3122344, 0x3122353,
+	0x3122362, 0x3122371, 0x3122416, 0x3122425, 0x3122434, 0x3122443, 0x3122452, 0x3122461,
+	0x3122515, 0x3122524, 0x3122533, 0x3122542, 0x3122551, 0x3122614, 0x3122623, 0x3122632,
+	0x3122641, 0x3122713, 0x3122722, 0x3122731, 0x3122812, 0x3122821, 0x3123118, 0x3123127,
+	0x3123136, 0x3123145, 0x3123154, 0x3123163, 0x3123172, 0x3123181, 0x3123217, 0x3123226,
+	0x3123235, 0x3123244, 0x3123253, 0x3123262, 0x3123271, 0x3123316, 0x3123325, 0x3123334,
+	0x3123343, 0x3123352, 0x3123361, 0x3123415, 0x3123424, 0x3123433, 0x3123442, 0x3123451,
+	0x3123514, 0x3123523, 0x3123532, 0x3123541, 0x3123613, 0x3123622, 0x3123631, 0x3123712,
+	0x3123721, 0x3123811, 0x3124117, 0x3124126, 0x3124135, 0x3124144, 0x3124153, 0x3124162,
+	0x3124171, 0x3124216, 0x3124225, 0x3124234, 0x3124243, 0x3124252, 0x3124261, 0x3124315,
+	0x3124324, 0x3124333, 0x3124342, 0x3124351, 0x3124414, 0x3124423, 0x3124432, 0x3124441,
+	0x3124513, 0x3124522, 0x3124531, 0x3124612, 0x3124621, 0x3124711, 0x3125116, 0x3125125,
+	0x3125134, 0x3125143, 0x3125152, 0x3125161, 0x3125215, 0x3125224, 0x3125233, 0x3125242,
+	0x3125251, 0x3125314, 0x3125323, 0x3125332, 0x3125341, 0x3125413, 0x3125422, 0x3125431,
+	0x3125512, 0x3125521, 0x3125611, 0x3126115, 0x3126124, 0x3126133, 0x3126142, 0x3126151,
+	0x3126214, 0x3126223, 0x3126232, 0x3126241, 0x3126313, 0x3126322, 0x3126331, 0x3126412,
+	0x3126421, 0x3126511, 0x3127114, 0x3127123, 0x3127132, 0x3127141, 0x3127213, 0x3127222,
+	0x3127231, 0x3127312, 0x3127321, 0x3127411, 0x3128113, 0x3128122, 0x3128131, 0x3128212,
+	0x3128221, 0x3128311, 0x3131128, 0x3131137, 0x3131146, 0x3131155, 0x3131164, 0x3131173,
+	0x3131182, 0x3131218, 0x3131227, 0x3131236, 0x3131245, 0x3131254, 0x3131263, 0x3131272,
+	0x3131281, 0x3131317, 0x3131326, 0x3131335, 0x3131344, 0x3131353, 0x3131362, 0x3131371,
+	0x3131416, 0x3131425, 0x3131434, 0x3131443, 0x3131452, 0x3131461, 0x3131515, 0x3131524,
+	0x3131533, 0x3131542, 0x3131551, 0x3131614, 0x3131623, 0x3131632, 0x3131641, 0x3131713,
+	0x3131722, 0x3131731, 0x3131812, 0x3131821, 0x3132118, 0x3132127, 0x3132136, 0x3132145,
+	0x3132154, 0x3132163, 0x3132172, 0x3132181, 0x3132217, 0x3132226, 0x3132235, 0x3132244,
+	0x3132253, 0x3132262, 0x3132271, 0x3132316, 0x3132325, 0x3132334, 0x3132343, 0x3132352,
+	0x3132361, 0x3132415, 0x3132424, 0x3132433, 0x3132442, 0x3132451, 0x3132514, 0x3132523,
+	0x3132532, 0x3132541, 0x3132613, 0x3132622, 0x3132631, 0x3132712, 0x3132721, 0x3132811,
+	0x3133117, 0x3133126, 0x3133135, 0x3133144, 0x3133153, 0x3133162, 0x3133171, 0x3133216,
+	0x3133225, 0x3133234, 0x3133243, 0x3133252, 0x3133261, 0x3133315, 0x3133324, 0x3133333,
+	0x3133342, 0x3133351, 0x3133414, 0x3133423, 0x3133432, 0x3133441, 0x3133513, 0x3133522,
+	0x3133531, 0x3133612, 0x3133621, 0x3133711, 0x3134116, 0x3134125, 0x3134134, 0x3134143,
+	0x3134152, 0x3134161, 0x3134215, 0x3134224, 0x3134233, 0x3134242, 0x3134251, 0x3134314,
+	0x3134323, 0x3134332, 0x3134341, 0x3134413, 0x3134422, 0x3134431, 0x3134512, 0x3134521,
+	0x3134611, 0x3135115, 0x3135124, 0x3135133, 0x3135142, 0x3135151, 0x3135214, 0x3135223,
+	0x3135232, 0x3135241, 0x3135313, 0x3135322, 0x3135331, 0x3135412, 0x3135421, 0x3135511,
+	0x3136114, 0x3136123, 0x3136132, 0x3136141, 0x3136213, 0x3136222, 0x3136231, 0x3136312,
+	0x3136321, 0x3136411, 0x3137113, 0x3137122, 0x3137131, 0x3137212, 0x3137221, 0x3137311,
+	0x3138112, 0x3138121, 0x3138211, 0x3141118, 0x3141127, 0x3141136, 0x3141145, 0x3141154,
+	0x3141163, 0x3141172, 0x3141181, 0x3141217, 0x3141226, 0x3141235, 0x3141244, 0x3141253,
+	0x3141262, 0x3141271, 0x3141316, 0x3141325, 0x3141334, 0x3141343, 0x3141352, 0x3141361,
+	0x3141415, 0x3141424, 0x3141433, 0x3141442, 0x3141451, 0x3141514, 0x3141523, 0x3141532,
+	0x3141541, 0x3141613, 0x3141622, 0x3141631, 0x3141712, 0x3141721, 0x3141811, 0x3142117,
+	0x3142126, 0x3142135, 0x3142144, 0x3142153, 0x3142162, 0x3142171, 0x3142216, 0x3142225,
+	0x3142234, 0x3142243, 0x3142252, 0x3142261, 0x3142315, 0x3142324, 0x3142333, 0x3142342,
+	0x3142351, 0x3142414, 0x3142423, 0x3142432, 0x3142441, 0x3142513, 0x3142522, 0x3142531,
+	0x3142612, 0x3142621, 0x3142711, 0x3143116, 0x3143125, 0x3143134, 0x3143143, 0x3143152,
+	0x3143161, 0x3143215, 0x3143224, 0x3143233, 0x3143242, 0x3143251, 0x3143314, 0x3143323,
+	0x3143332, 0x3143341, 0x3143413, 0x3143422, 0x3143431, 0x3143512, 0x3143521, 0x3143611,
+	0x3144115, 0x3144124, 0x3144133, 0x3144142, 0x3144151, 0x3144214, 0x3144223, 0x3144232,
+	0x3144241, 0x3144313, 0x3144322, 0x3144331, 0x3144412, 0x3144421, 0x3144511, 0x3145114,
+	0x3145123, 0x3145132, 0x3145141, 0x3145213, 0x3145222, 0x3145231, 0x3145312, 0x3145321,
+	0x3145411, 0x3146113, 0x3146122, 0x3146131, 0x3146212, 0x3146221, 0x3146311, 0x3147112,
+	0x3147121, 0x3147211, 0x3148111, 0x3151117, 0x3151126, 0x3151135, 0x3151144, 0x3151153,
+	0x3151162, 0x3151171, 0x3151216, 0x3151225, 0x3151234, 0x3151243, 0x3151252, 0x3151261,
+	0x3151315, 0x3151324, 0x3151333, 0x3151342, 0x3151351, 0x3151414, 0x3151423, 0x3151432,
+	0x3151441, 0x3151513, 0x3151522, 0x3151531, 0x3151612, 0x3151621, 0x3151711, 0x3152116,
+	0x3152125, 0x3152134, 0x3152143, 0x3152152, 0x3152161, 0x3152215, 0x3152224, 0x3152233,
+	0x3152242, 0x3152251, 0x3152314, 0x3152323, 0x3152332, 0x3152341, 0x3152413, 0x3152422,
+	0x3152431, 0x3152512, 0x3152521, 0x3152611, 0x3153115, 0x3153124, 0x3153133, 0x3153142,
+	0x3153151, 0x3153214, 0x3153223, 0x3153232, 0x3153241, 0x3153313, 0x3153322, 0x3153331,
+	0x3153412, 0x3153421, 0x3153511, 0x3154114, 0x3154123, 0x3154132, 0x3154141, 0x3154213,
+	0x3154222, 0x3154231, 0x3154312, 0x3154321, 0x3154411, 0x3155113, 0x3155122, 0x3155131,
+	0x3155212, 0x3155221, 0x3155311, 0x3156112, 0x3156121, 0x3156211, 0x3157111, 0x3161116,
+	0x3161125, 0x3161134, 0x3161143, 0x3161152, 0x3161161, 0x3161215, 0x3161224, 0x3161233,
+	0x3161242, 0x3161251, 0x3161314, 0x3161323, 0x3161332, 0x3161341, 0x3161413, 0x3161422,
+	0x3161431, 0x3161512, 0x3161521, 0x3161611, 0x3162115, 0x3162124, 0x3162133, 0x3162142,
+	0x3162151, 0x3162214, 0x3162223, 0x3162232, 0x3162241, 0x3162313, 0x3162322, 0x3162331,
+	0x3162412, 0x3162421, 0x3162511, 0x3163114, 0x3163123, 0x3163132, 0x3163141, 0x3163213,
+	0x3163222, 0x3163231, 0x3163312, 0x3163321, 0x3163411, 0x3164113, 0x3164122, 0x3164131,
+	0x3164212, 0x3164221, 0x3164311, 0x3165112, 0x3165121, 0x3165211, 0x3166111, 0x3171115,
+	0x3171124, 0x3171133, 0x3171142, 0x3171151, 0x3171214, 0x3171223, 0x3171232, 0x3171241,
+	0x3171313, 0x3171322, 0x3171331, 0x3171412, 0x3171421, 0x3171511, 0x3172114, 0x3172123,
+	0x3172132, 0x3172141, 0x3172213, 0x3172222, 0x3172231, 0x3172312, 0x3172321, 0x3172411,
+	0x3173113, 0x3173122, 0x3173131, 0x3173212, 0x3173221, 0x3173311, 0x3174112, 0x3174121,
+	0x3174211, 0x3175111, 0x3181114, 0x3181123, 0x3181132, 0x3181141, 0x3181213, 0x3181222,
+	0x3181231, 0x3181312, 0x3181321, 0x3181411, 0x3182113, 0x3182122, 0x3182131, 0x3182212,
+	0x3182221, 0x3182311, 0x3183112, 0x3183121, 0x3183211, 0x3184111, 0x3211138, 0x3211147,
+	0x3211156, 0x3211165, 0x3211174, 0x3211183, 0x3211228, 0x3211237, 0x3211246, 0x3211255,
+	0x3211264, 0x3211273, 0x3211282, 0x3211318, 0x3211327, 0x3211336, 0x3211345, 0x3211354,
+	0x3211363, 0x3211372, 0x3211381, 0x3211417, 0x3211426, 0x3211435, 0x3211444, 0x3211453,
+	0x3211462, 0x3211471, 0x3211516, 0x3211525, 0x3211534, 0x3211543, 0x3211552, 0x3211561,
+	0x3211615, 0x3211624, 0x3211633, 0x3211642, 0x3211651, 0x3211714, 0x3211723, 0x3211732,
+	0x3211741, 0x3211813, 0x3211822, 0x3211831, 0x3212128, 0x3212137, 0x3212146, 0x3212155,
+	0x3212164, 0x3212173, 0x3212182, 0x3212218, 0x3212227, 0x3212236, 0x3212245, 0x3212254,
+	0x3212263, 0x3212272, 0x3212281, 0x3212317, 0x3212326, 0x3212335, 0x3212344, 0x3212353,
+	0x3212362, 0x3212371, 0x3212416, 0x3212425, 0x3212434, 0x3212443, 0x3212452, 0x3212461,
+	0x3212515, 0x3212524, 0x3212533, 0x3212542, 0x3212551, 0x3212614, 0x3212623, 0x3212632,
+	0x3212641, 0x3212713, 0x3212722, 0x3212731, 0x3212812, 0x3212821, 0x3213118, 0x3213127,
+	0x3213136, 0x3213145, 0x3213154, 0x3213163, 0x3213172, 0x3213181, 0x3213217, 0x3213226,
+	0x3213235, 0x3213244, 0x3213253, 0x3213262, 0x3213271, 0x3213316, 0x3213325, 0x3213334,
+	0x3213343, 0x3213352, 0x3213361, 0x3213415, 0x3213424, 0x3213433, 0x3213442, 0x3213451,
+	0x3213514, 0x3213523, 0x3213532, 0x3213541, 0x3213613, 0x3213622, 0x3213631, 0x3213712,
+	0x3213721, 0x3213811, 0x3214117, 0x3214126, 0x3214135, 0x3214144, 0x3214153, 0x3214162,
+	0x3214171, 0x3214216, 0x3214225, 0x3214234, 0x3214243, 0x3214252, 0x3214261, 0x3214315,
+	0x3214324, 0x3214333, 0x3214342, 0x3214351, 0x3214414, 0x3214423, 0x3214432, 0x3214441,
+	0x3214513, 0x3214522, 0x3214531, 0x3214612, 0x3214621, 0x3214711, 0x3215116, 0x3215125,
+	0x3215134, 0x3215143, 0x3215152, 0x3215161, 0x3215215, 0x3215224, 0x3215233, 0x3215242,
+	0x3215251, 0x3215314, 0x3215323, 0x3215332, 0x3215341, 0x3215413, 0x3215422, 0x3215431,
+	0x3215512, 0x3215521, 0x3215611, 0x3216115, 0x3216124, 0x3216133, 0x3216142, 0x3216151,
+	0x3216214, 0x3216223, 0x3216232, 0x3216241, 0x3216313, 0x3216322, 0x3216331, 0x3216412,
+	0x3216421, 0x3216511, 0x3217114, 0x3217123, 0x3217132, 0x3217141, 0x3217213, 0x3217222,
+	0x3217231, 0x3217312, 0x3217321, 0x3217411, 0x3218113, 0x3218122, 0x3218131, 0x3218212,
+	0x3218221, 0x3218311, 0x3221128, 0x3221137, 0x3221146, 0x3221155, 0x3221164, 0x3221173,
+	0x3221182, 0x3221218, 0x3221227, 0x3221236, 0x3221245, 0x3221254, 0x3221263, 0x3221272,
+	0x3221281, 0x3221317, 0x3221326, 0x3221335, 0x3221344, 0x3221353, 0x3221362, 0x3221371,
+	0x3221416, 0x3221425, 0x3221434, 0x3221443, 0x3221452, 0x3221461, 0x3221515, 0x3221524,
+	0x3221533, 0x3221542, 0x3221551, 0x3221614, 0x3221623, 0x3221632, 0x3221641, 0x3221713,
+	0x3221722, 0x3221731, 0x3221812, 0x3221821, 0x3222118, 0x3222127, 0x3222136, 0x3222145,
+	0x3222154, 0x3222163, 0x3222172, 0x3222181, 0x3222217, 0x3222226, 0x3222235, 0x3222244,
+	0x3222253, 0x3222262, 0x3222271, 0x3222316, 0x3222325, 0x3222334, 0x3222343, 0x3222352,
+	0x3222361, 0x3222415, 0x3222424, 0x3222433, 0x3222442, 0x3222451, 0x3222514, 0x3222523,
+	0x3222532, 0x3222541, 0x3222613, 0x3222622, 0x3222631, 0x3222712, 0x3222721, 0x3222811,
+	0x3223117, 0x3223126, 0x3223135, 0x3223144, 0x3223153, 0x3223162, 0x3223171, 0x3223216,
+	0x3223225, 0x3223234, 0x3223243, 0x3223252, 0x3223261, 0x3223315, 0x3223324, 0x3223333,
+	0x3223342, 0x3223351, 0x3223414, 0x3223423, 0x3223432, 0x3223441, 0x3223513, 0x3223522,
+	0x3223531, 0x3223612, 0x3223621, 0x3223711, 0x3224116, 0x3224125, 0x3224134, 0x3224143,
+	0x3224152, 0x3224161, 0x3224215, 0x3224224, 0x3224233, 0x3224242, 0x3224251, 0x3224314,
+	0x3224323, 0x3224332, 0x3224341, 0x3224413, 0x3224422, 0x3224431, 0x3224512, 0x3224521,
+	0x3224611, 0x3225115, 0x3225124, 0x3225133, 0x3225142, 0x3225151, 0x3225214, 0x3225223,
+	0x3225232, 0x3225241, 0x3225313, 0x3225322, 0x3225331, 0x3225412, 0x3225421, 0x3225511,
+	0x3226114, 0x3226123, 0x3226132, 0x3226141, 0x3226213, 0x3226222, 0x3226231, 0x3226312,
+	0x3226321, 0x3226411, 0x3227113, 0x3227122, 0x3227131, 0x3227212, 0x3227221, 0x3227311,
+	0x3228112, 0x3228121, 0x3228211, 0x3231118, 0x3231127, 0x3231136, 0x3231145, 0x3231154,
+	0x3231163, 0x3231172, 0x3231181, 0x3231217, 0x3231226, 0x3231235, 0x3231244, 0x3231253,
+	0x3231262, 0x3231271, 0x3231316, 0x3231325, 0x3231334, 0x3231343, 0x3231352, 0x3231361,
+	0x3231415, 0x3231424, 0x3231433, 0x3231442, 0x3231451, 0x3231514, 0x3231523, 0x3231532,
+	0x3231541, 0x3231613, 0x3231622, 0x3231631, 0x3231712, 0x3231721, 0x3231811, 0x3232117,
+	0x3232126, 0x3232135, 0x3232144, 0x3232153, 0x3232162, 0x3232171, 0x3232216, 0x3232225,
+	0x3232234, 0x3232243, 0x3232252, 0x3232261, 0x3232315, 0x3232324, 0x3232333, 0x3232342,
+	0x3232351, 0x3232414, 0x3232423, 0x3232432, 0x3232441, 0x3232513, 0x3232522, 0x3232531,
+	0x3232612, 0x3232621, 0x3232711, 0x3233116, 0x3233125, 0x3233134, 0x3233143, 0x3233152,
+	0x3233161, 0x3233215, 0x3233224, 0x3233233, 0x3233242, 0x3233251, 0x3233314, 0x3233323,
+	0x3233332, 0x3233341, 0x3233413, 0x3233422, 0x3233431, 0x3233512, 0x3233521, 0x3233611,
+	0x3234115, 0x3234124, 0x3234133, 0x3234142, 0x3234151, 0x3234214, 0x3234223, 0x3234232,
+	0x3234241, 0x3234313, 0x3234322, 0x3234331, 0x3234412, 0x3234421, 0x3234511, 0x3235114,
+	0x3235123, 0x3235132, 0x3235141, 0x3235213, 0x3235222, 0x3235231, 0x3235312, 0x3235321,
+	0x3235411, 0x3236113, 0x3236122, 0x3236131, 0x3236212, 0x3236221, 0x3236311, 0x3237112,
+	0x3237121, 0x3237211, 0x3238111, 0x3241117, 0x3241126, 0x3241135, 0x3241144, 0x3241153,
+	0x3241162, 0x3241171, 0x3241216, 0x3241225, 0x3241234, 0x3241243, 0x3241252, 0x3241261,
+	0x3241315, 0x3241324, 0x3241333, 0x3241342, 0x3241351, 0x3241414, 0x3241423, 0x3241432,
+	0x3241441, 0x3241513, 0x3241522, 0x3241531, 0x3241612, 0x3241621, 0x3241711, 0x3242116,
+	0x3242125, 0x3242134, 0x3242143, 0x3242152, 0x3242161, 0x3242215, 0x3242224, 0x3242233,
+	0x3242242, 0x3242251, 0x3242314, 0x3242323, 0x3242332, 0x3242341, 0x3242413, 0x3242422,
+	0x3242431, 0x3242512, 0x3242521, 0x3242611, 0x3243115, 0x3243124, 0x3243133, 0x3243142,
+	0x3243151, 0x3243214, 0x3243223, 0x3243232, 0x3243241, 0x3243313, 0x3243322, 0x3243331,
+	0x3243412, 0x3243421, 0x3243511, 0x3244114, 0x3244123, 0x3244132, 0x3244141, 0x3244213,
+	0x3244222, 0x3244231, 0x3244312, 0x3244321, 0x3244411, 0x3245113, 0x3245122, 0x3245131,
+	0x3245212, 0x3245221, 0x3245311, 0x3246112, 0x3246121, 0x3246211, 0x3247111, 0x3251116,
+	0x3251125, 0x3251134, 0x3251143, 0x3251152, 0x3251161, 0x3251215, 0x3251224, 0x3251233,
+	0x3251242, 0x3251251, 0x3251314, 0x3251323, 0x3251332, 0x3251341, 0x3251413, 0x3251422,
+	0x3251431, 0x3251512, 0x3251521, 0x3251611, 0x3252115, 0x3252124, 0x3252133, 0x3252142,
+	0x3252151, 0x3252214, 0x3252223, 0x3252232, 0x3252241, 0x3252313, 0x3252322, 0x3252331,
+	0x3252412, 0x3252421, 0x3252511, 0x3253114, 0x3253123, 0x3253132, 0x3253141, 0x3253213,
+	0x3253222, 0x3253231, 0x3253312, 0x3253321, 0x3253411, 0x3254113, 0x3254122, 0x3254131,
+	0x3254212, 0x3254221, 0x3254311, 0x3255112, 0x3255121, 0x3255211, 0x3256111, 0x3261115,
+	0x3261124, 0x3261133, 0x3261142, 0x3261151, 0x3261214, 0x3261223, 0x3261232, 0x3261241,
+	0x3261313, 0x3261322, 0x3261331, 0x3261412, 0x3261421, 0x3261511, 0x3262114, 0x3262123,
+	0x3262132, 0x3262141, 0x3262213, 0x3262222, 0x3262231, 0x3262312, 0x3262321, 0x3262411,
+	0x3263113, 0x3263122, 0x3263131, 0x3263212, 0x3263221, 0x3263311, 0x3264112, 0x3264121,
+	0x3264211, 0x3265111, 0x3271114, 0x3271123, 0x3271132, 0x3271141, 0x3271213, 0x3271222,
+	0x3271231, 0x3271312, 0x3271321, 0x3271411, 0x3272113, 0x3272122, 0x3272131, 0x3272212,
+	0x3272221, 0x3272311, 0x3273112, 0x3273121, 0x3273211, 0x3274111, 0x3281113, 0x3281122,
+	0x3281131, 0x3281212, 0x3281221, 0x3281311, 0x3282112, 0x3282121, 0x3282211, 0x3283111,
+	0x3311128, 0x3311137, 0x3311146, 0x3311155, 0x3311164, 0x3311173, 0x3311182, 0x3311218,
+	0x3311227, 0x3311236, 0x3311245, 0x3311254, 0x3311263, 0x3311272, 0x3311281, 0x3311317,
+	0x3311326, 0x3311335, 0x3311344, 0x3311353, 0x3311362, 0x3311371, 0x3311416, 0x3311425,
+	0x3311434, 0x3311443, 0x3311452, 0x3311461, 0x3311515, 0x3311524, 0x3311533, 0x3311542,
+	0x3311551, 0x3311614, 0x3311623, 0x3311632, 0x3311641, 0x3311713, 0x3311722, 0x3311731,
+	0x3311812, 0x3311821, 0x3312118, 0x3312127, 0x3312136, 0x3312145, 0x3312154, 0x3312163,
+	0x3312172, 0x3312181, 0x3312217, 0x3312226, 0x3312235, 0x3312244, 0x3312253, 0x3312262,
+	0x3312271, 0x3312316, 0x3312325, 0x3312334, 0x3312343, 0x3312352, 0x3312361, 0x3312415,
+	0x3312424, 0x3312433, 0x3312442, 0x3312451, 0x3312514, 0x3312523, 0x3312532, 0x3312541,
+	0x3312613, 0x3312622, 0x3312631, 0x3312712, 0x3312721, 0x3312811, 0x3313117, 0x3313126,
+	0x3313135, 0x3313144, 0x3313153, 0x3313162, 0x3313171, 0x3313216, 0x3313225, 0x3313234,
+	0x3313243, 0x3313252, 0x3313261, 0x3313315, 0x3313324, 0x3313333, 0x3313342, 0x3313351,
+	0x3313414, 0x3313423, 0x3313432, 0x3313441, 0x3313513, 0x3313522, 0x3313531, 0x3313612,
+	0x3313621, 0x3313711, 0x3314116, 0x3314125, 0x3314134, 0x3314143, 0x3314152, 0x3314161,
+	0x3314215, 0x3314224, 0x3314233, 0x3314242, 0x3314251, 0x3314314, 0x3314323, 0x3314332,
+	0x3314341, 0x3314413, 0x3314422, 0x3314431, 0x3314512, 0x3314521, 0x3314611, 0x3315115,
+	0x3315124, 0x3315133, 0x3315142, 0x3315151, 0x3315214, 0x3315223, 0x3315232, 0x3315241,
+	0x3315313, 0x3315322, 0x3315331, 0x3315412, 0x3315421, 0x3315511, 0x3316114, 0x3316123,
+	0x3316132, 0x3316141, 0x3316213, 0x3316222, 0x3316231, 0x3316312, 0x3316321, 0x3316411,
+	0x3317113, 0x3317122, 0x3317131, 0x3317212, 0x3317221, 0x3317311, 0x3318112, 0x3318121,
+	0x3318211, 0x3321118, 0x3321127, 0x3321136, 0x3321145, 0x3321154, 0x3321163, 0x3321172,
+	0x3321181, 0x3321217, 0x3321226, 0x3321235, 0x3321244, 0x3321253, 0x3321262, 0x3321271,
+	0x3321316, 0x3321325, 0x3321334, 0x3321343, 0x3321352, 0x3321361, 0x3321415, 0x3321424,
+	0x3321433, 0x3321442, 0x3321451, 0x3321514, 0x3321523, 0x3321532, 0x3321541, 0x3321613,
+	0x3321622, 0x3321631, 0x3321712, 0x3321721, 0x3321811, 0x3322117, 0x3322126, 0x3322135,
+	0x3322144, 0x3322153, 0x3322162, 0x3322171, 0x3322216, 0x3322225, 0x3322234, 0x3322243,
+	0x3322252, 0x3322261, 0x3322315, 0x3322324, 0x3322333, 0x3322342, 0x3322351, 0x3322414,
+	0x3322423, 0x3322432, 0x3322441, 0x3322513, 0x3322522, 0x3322531, 0x3322612, 0x3322621,
+	0x3322711, 0x3323116, 0x3323125, 0x3323134, 0x3323143, 0x3323152, 0x3323161, 0x3323215,
+	0x3323224, 0x3323233, 0x3323242, 0x3323251, 0x3323314, 0x3323323, 0x3323332, 0x3323341,
+	0x3323413, 0x3323422, 0x3323431, 0x3323512, 0x3323521, 0x3323611, 0x3324115, 0x3324124,
+	0x3324133, 0x3324142, 0x3324151, 0x3324214, 0x3324223, 0x3324232, 0x3324241, 0x3324313,
+	0x3324322, 0x3324331, 0x3324412, 0x3324421, 0x3324511, 0x3325114, 0x3325123, 0x3325132,
+	0x3325141, 0x3325213, 0x3325222, 0x3325231, 0x3325312, 0x3325321, 0x3325411, 0x3326113,
+	0x3326122, 0x3326131, 0x3326212, 0x3326221, 0x3326311, 0x3327112, 0x3327121, 0x3327211,
+	0x3328111, 0x3331117, 0x3331126, 0x3331135, 0x3331144, 0x3331153, 0x3331162, 0x3331171,
+	0x3331216, 0x3331225, 0x3331234, 0x3331243, 0x3331252, 0x3331261, 0x3331315, 0x3331324,
+	0x3331333, 0x3331342, 0x3331351, 0x3331414, 0x3331423, 0x3331432, 0x3331441, 0x3331513,
+	0x3331522, 0x3331531, 0x3331612, 0x3331621, 0x3331711, 0x3332116, 0x3332125, 0x3332134,
+	0x3332143, 0x3332152, 0x3332161, 0x3332215, 0x3332224, 0x3332233, 0x3332242, 0x3332251,
+	0x3332314, 0x3332323, 0x3332332, 0x3332341, 0x3332413, 0x3332422, 0x3332431, 0x3332512,
+	0x3332521, 0x3332611, 0x3333115, 0x3333124, 0x3333133, 0x3333142, 0x3333151, 0x3333214,
+	0x3333223, 0x3333232, 0x3333241, 0x3333313, 0x3333322, 0x3333331, 0x3333412, 0x3333421,
+	0x3333511, 0x3334114, 0x3334123, 0x3334132, 0x3334141, 0x3334213, 0x3334222, 0x3334231,
+	0x3334312, 0x3334321, 0x3334411, 0x3335113, 0x3335122, 0x3335131, 0x3335212, 0x3335221,
+	0x3335311, 0x3336112, 0x3336121, 0x3336211, 0x3337111, 0x3341116, 0x3341125, 0x3341134,
+	0x3341143, 0x3341152, 0x3341161, 0x3341215, 0x3341224, 0x3341233, 0x3341242, 0x3341251,
+	0x3341314, 0x3341323, 0x3341332, 0x3341341, 0x3341413, 0x3341422, 0x3341431, 0x3341512,
+	0x3341521, 0x3341611, 0x3342115, 0x3342124, 0x3342133, 0x3342142, 0x3342151, 0x3342214,
+	0x3342223, 0x3342232, 0x3342241, 0x3342313, 0x3342322, 0x3342331, 0x3342412, 0x3342421,
+	0x3342511, 0x3343114, 0x3343123, 0x3343132, 0x3343141, 0x3343213, 0x3343222, 0x3343231,
+	0x3343312, 0x3343321, 0x3343411, 0x3344113, 0x3344122, 0x3344131, 0x3344212, 0x3344221,
+	0x3344311, 0x3345112, 0x3345121, 0x3345211, 0x3346111, 0x3351115, 0x3351124, 0x3351133,
+	0x3351142, 0x3351151, 0x3351214, 0x3351223, 0x3351232, 0x3351241, 0x3351313, 0x3351322,
+	0x3351331, 0x3351412, 0x3351421, 0x3351511, 0x3352114, 0x3352123, 0x3352132, 0x3352141,
+	0x3352213, 0x3352222, 0x3352231, 0x3352312, 0x3352321, 0x3352411, 0x3353113, 0x3353122,
+	0x3353131, 0x3353212, 0x3353221, 0x3353311, 0x3354112, 0x3354121, 0x3354211, 0x3355111,
+	0x3361114, 0x3361123, 0x3361132, 0x3361141, 0x3361213, 0x3361222, 0x3361231, 0x3361312,
+	0x3361321, 0x3361411, 0x3362113, 0x3362122, 0x3362131, 0x3362212, 0x3362221, 0x3362311,
+	0x3363112, 0x3363121, 0x3363211, 0x3364111, 0x3371113, 0x3371122, 0x3371131, 0x3371212,
+	0x3371221, 0x3371311, 0x3372112, 0x3372121, 0x3372211, 0x3373111, 0x3381112, 0x3381121,
+	0x3381211, 0x3382111, 0x3411118, 0x3411127, 0x3411136, 0x3411145, 0x3411154, 0x3411163,
+	0x3411172, 0x3411181, 0x3411217, 0x3411226, 0x3411235, 0x3411244, 0x3411253, 0x3411262,
+	0x3411271, 0x3411316, 0x3411325, 0x3411334, 0x3411343, 0x3411352, 0x3411361, 0x3411415,
+	0x3411424, 0x3411433, 0x3411442, 0x3411451, 0x3411514, 0x3411523, 0x3411532, 0x3411541,
+	0x3411613, 0x3411622, 0x3411631, 0x3411712, 0x3411721, 0x3411811, 0x3412117, 0x3412126,
+	0x3412135, 0x3412144, 0x3412153, 0x3412162, 0x3412171, 0x3412216, 0x3412225, 0x3412234,
+	0x3412243, 0x3412252, 0x3412261, 0x3412315, 0x3412324, 0x3412333, 0x3412342, 0x3412351,
+	0x3412414, 0x3412423, 0x3412432, 0x3412441, 0x3412513, 0x3412522, 0x3412531, 0x3412612,
+	0x3412621, 0x3412711, 0x3413116, 0x3413125, 0x3413134, 0x3413143, 0x3413152, 0x3413161,
+	0x3413215, 0x3413224, 0x3413233, 0x3413242, 0x3413251, 0x3413314, 0x3413323, 0x3413332,
+	0x3413341, 0x3413413, 0x3413422, 0x3413431, 0x3413512, 0x3413521, 0x3413611, 0x3414115,
+	0x3414124, 0x3414133, 0x3414142, 0x3414151, 0x3414214, 0x3414223, 0x3414232, 0x3414241,
+	0x3414313, 0x3414322, 0x3414331, 0x3414412, 0x3414421, 0x3414511, 0x3415114, 0x3415123,
+	0x3415132, 0x3415141, 0x3415213, 0x3415222, 0x3415231, 0x3415312, 0x3415321, 0x3415411,
+	0x3416113, 0x3416122, 0x3416131, 0x3416212, 0x3416221, 0x3416311, 0x3417112, 0x3417121,
+	0x3417211, 0x3418111, 0x3421117, 0x3421126, 0x3421135, 0x3421144, 0x3421153, 0x3421162,
+	0x3421171, 0x3421216, 0x3421225, 0x3421234, 0x3421243, 0x3421252, 0x3421261, 0x3421315,
+	0x3421324, 0x3421333, 0x3421342, 0x3421351, 0x3421414, 0x3421423, 0x3421432, 0x3421441,
+	0x3421513, 0x3421522, 0x3421531, 0x3421612, 0x3421621, 0x3421711, 0x3422116, 0x3422125,
+	0x3422134, 0x3422143, 0x3422152, 0x3422161, 0x3422215, 0x3422224, 0x3422233, 0x3422242,
+	0x3422251, 0x3422314, 0x3422323, 0x3422332, 0x3422341, 0x3422413, 0x3422422, 0x3422431,
+	0x3422512, 0x3422521, 0x3422611, 0x3423115, 0x3423124, 0x3423133, 0x3423142, 0x3423151,
+	0x3423214, 0x3423223, 0x3423232, 0x3423241, 0x3423313, 0x3423322, 0x3423331, 0x3423412,
+	0x3423421, 0x3423511, 0x3424114, 0x3424123, 0x3424132, 0x3424141, 0x3424213, 0x3424222,
+	0x3424231, 0x3424312, 0x3424321, 0x3424411, 0x3425113, 0x3425122, 0x3425131, 0x3425212,
+	0x3425221, 0x3425311, 0x3426112, 0x3426121, 0x3426211, 0x3427111, 0x3431116, 0x3431125,
+	0x3431134, 0x3431143, 0x3431152, 0x3431161, 0x3431215, 0x3431224, 0x3431233, 0x3431242,
+	0x3431251, 0x3431314, 0x3431323, 0x3431332, 0x3431341, 0x3431413, 0x3431422, 0x3431431,
+	0x3431512, 0x3431521, 0x3431611, 0x3432115, 0x3432124, 0x3432133, 0x3432142, 0x3432151,
+	0x3432214, 0x3432223, 0x3432232, 0x3432241, 0x3432313, 0x3432322, 0x3432331, 0x3432412,
+	0x3432421, 0x3432511, 0x3433114, 0x3433123, 0x3433132, 0x3433141, 0x3433213, 0x3433222,
+	0x3433231, 0x3433312, 0x3433321, 0x3433411, 0x3434113, 0x3434122, 0x3434131, 0x3434212,
+	0x3434221, 0x3434311, 0x3435112, 0x3435121, 0x3435211, 0x3436111, 0x3441115, 0x3441124,
+	0x3441133, 0x3441142, 0x3441151, 0x3441214, 0x3441223, 0x3441232, 0x3441241, 0x3441313,
+	0x3441322, 0x3441331, 0x3441412, 0x3441421, 0x3441511, 0x3442114, 0x3442123, 0x3442132,
+	0x3442141, 0x3442213, 0x3442222, 0x3442231, 0x3442312, 0x3442321, 0x3442411, 0x3443113,
+	0x3443122, 0x3443131, 0x3443212, 0x3443221, 0x3443311, 0x3444112, 0x3444121, 0x3444211,
+	0x3445111, 0x3451114, 0x3451123, 0x3451132, 0x3451141, 0x3451213, 0x3451222, 0x3451231,
+	0x3451312, 0x3451321, 0x3451411, 0x3452113, 0x3452122, 0x3452131, 0x3452212, 0x3452221,
+	0x3452311, 0x3453112, 0x3453121, 0x3453211, 0x3454111, 0x3461113, 0x3461122, 0x3461131,
+	0x3461212, 0x3461221, 0x3461311, 0x3462112, 0x3462121, 0x3462211, 0x3463111, 0x3471112,
+	0x3471121, 0x3471211, 0x3472111, 0x3481111, 0x3511117, 0x3511126, 0x3511135, 0x3511144,
+	0x3511153, 0x3511162, 0x3511171, 0x3511216, 0x3511225, 0x3511234, 0x3511243, 0x3511252,
+	0x3511261, 0x3511315, 0x3511324, 0x3511333, 0x3511342, 0x3511351, 0x3511414, 0x3511423,
+	0x3511432, 0x3511441, 0x3511513, 0x3511522, 0x3511531, 0x3511612, 0x3511621, 0x3511711,
+	0x3512116, 0x3512125, 0x3512134, 0x3512143, 0x3512152, 0x3512161, 0x3512215, 0x3512224,
+	0x3512233, 0x3512242, 0x3512251, 0x3512314, 0x3512323, 0x3512332, 0x3512341, 0x3512413,
+	0x3512422, 0x3512431, 0x3512512, 0x3512521, 0x3512611, 0x3513115, 0x3513124, 0x3513133,
+	0x3513142, 0x3513151, 0x3513214, 0x3513223, 0x3513232, 0x3513241, 0x3513313, 0x3513322,
+	0x3513331, 0x3513412, 0x3513421, 0x3513511, 0x3514114, 0x3514123, 0x3514132, 0x3514141,
+	0x3514213, 0x3514222, 0x3514231, 0x3514312, 0x3514321, 0x3514411, 0x3515113, 0x3515122,
+	0x3515131, 0x3515212, 0x3515221, 0x3515311, 0x3516112, 0x3516121, 0x3516211, 0x3517111,
+	0x3521116, 0x3521125, 0x3521134, 0x3521143, 0x3521152, 0x3521161, 0x3521215, 0x3521224,
+	0x3521233, 0x3521242, 0x3521251, 0x3521314, 0x3521323, 0x3521332, 0x3521341, 0x3521413,
+	0x3521422, 0x3521431, 0x3521512, 0x3521521, 0x3521611, 0x3522115, 0x3522124, 0x3522133,
+	0x3522142, 0x3522151, 0x3522214, 0x3522223, 0x3522232, 0x3522241, 0x3522313, 0x3522322,
+	0x3522331, 0x3522412, 0x3522421, 0x3522511, 0x3523114, 0x3523123, 0x3523132, 0x3523141,
+	0x3523213, 0x3523222, 0x3523231, 0x3523312, 0x3523321, 0x3523411, 0x3524113, 0x3524122,
+	0x3524131, 0x3524212, 0x3524221, 0x3524311, 0x3525112, 0x3525121, 0x3525211, 0x3526111,
+	0x3531115, 0x3531124, 0x3531133, 0x3531142, 0x3531151, 0x3531214, 0x3531223, 0x3531232,
+	0x3531241, 0x3531313, 0x3531322, 0x3531331, 0x3531412, 0x3531421, 0x3531511, 0x3532114,
+	0x3532123, 0x3532132, 0x3532141, 0x3532213, 0x3532222, 0x3532231, 0x3532312, 0x3532321,
+	0x3532411, 0x3533113, 0x3533122, 0x3533131, 0x3533212, 0x3533221, 0x3533311, 0x3534112,
+	0x3534121, 0x3534211, 0x3535111, 0x3541114, 0x3541123, 0x3541132, 0x3541141, 0x3541213,
+	0x3541222, 0x3541231, 0x3541312, 0x3541321, 0x3541411, 0x3542113, 0x3542122, 0x3542131,
+	0x3542212, 0x3542221, 0x3542311, 0x3543112, 0x3543121, 0x3543211, 0x3544111, 0x3551113,
+	0x3551122, 0x3551131, 0x3551212, 0x3551221, 0x3551311, 0x3552112, 0x3552121, 0x3552211,
+	0x3553111, 0x3561112, 0x3561121, 0x3561211, 0x3562111, 0x3571111, 0x3611116, 0x3611125,
+	0x3611134, 0x3611143, 0x3611152, 0x3611161, 0x3611215, 0x3611224, 0x3611233, 0x3611242,
+	0x3611251, 0x3611314, 0x3611323, 0x3611332, 0x3611341, 0x3611413, 0x3611422, 0x3611431,
+	0x3611512, 0x3611521, 0x3611611, 0x3612115, 0x3612124, 0x3612133, 0x3612142, 0x3612151,
+	0x3612214, 0x3612223, 0x3612232, 0x3612241, 0x3612313, 0x3612322, 0x3612331, 0x3612412,
+	0x3612421, 0x3612511, 0x3613114, 0x3613123, 0x3613132, 0x3613141, 0x3613213, 0x3613222,
+	0x3613231, 0x3613312, 0x3613321, 0x3613411, 0x3614113, 0x3614122, 0x3614131, 0x3614212,
+	0x3614221, 0x3614311, 0x3615112, 0x3615121, 0x3615211, 0x3616111, 0x3621115, 0x3621124,
+	0x3621133, 0x3621142, 0x3621151, 0x3621214, 0x3621223, 0x3621232, 0x3621241, 0x3621313,
+	0x3621322, 0x3621331, 0x3621412, 0x3621421, 0x3621511, 0x3622114, 0x3622123, 0x3622132,
+	0x3622141, 0x3622213, 0x3622222, 0x3622231, 0x3622312, 0x3622321, 0x3622411, 0x3623113,
+	0x3623122, 0x3623131, 0x3623212, 0x3623221, 0x3623311, 0x3624112, 0x3624121, 0x3624211,
+	0x3625111, 0x3631114, 0x3631123, 0x3631132, 0x3631141, 0x3631213, 0x3631222, 0x3631231,
+	0x3631312, 0x3631321, 0x3631411, 0x3632113, 0x3632122, 0x3632131, 0x3632212, 0x3632221,
+	0x3632311, 0x3633112, 0x3633121, 0x3633211, 0x3634111, 0x3641113, 0x3641122, 0x3641131,
+	0x3641212, 0x3641221, 0x3641311, 0x3642112, 0x3642121, 0x3642211, 0x3643111, 0x3651112,
+	0x3651121, 0x3651211, 0x3652111, 0x3661111, 0x3711115, 0x3711124, 0x3711133, 0x3711142,
+	0x3711151, 0x3711214, 0x3711223, 0x3711232, 0x3711241, 0x3711313, 0x3711322, 0x3711331,
+	0x3711412, 0x3711421, 0x3711511, 0x3712114, 0x3712123, 0x3712132, 0x3712141, 0x3712213,
+	0x3712222, 0x3712231, 0x3712312, 0x3712321, 0x3712411, 0x3713113, 0x3713122, 0x3713131,
+	0x3713212, 0x3713221, 0x3713311, 0x3714112, 0x3714121, 0x3714211, 0x3715111, 0x3721114,
+	0x3721123, 0x3721132, 0x3721141, 0x3721213, 0x3721222, 0x3721231, 0x3721312, 0x3721321,
+	0x3721411, 0x3722113, 0x3722122, 0x3722131, 0x3722212, 0x3722221, 0x3722311, 0x3723112,
+	0x3723121, 0x3723211, 0x3724111, 0x3731113, 0x3731122, 0x3731131, 0x3731212, 0x3731221,
+	0x3731311, 0x3732112, 0x3732121, 0x3732211, 0x3733111, 0x3741112, 0x3741121, 0x3741211,
+	0x3742111, 0x3751111, 0x3811114, 0x3811123, 0x3811132, 0x3811141, 0x3811213, 0x3811222,
+	0x3811231, 0x3811312, 0x3811321, 0x3811411, 0x3812113, 0x3812122, 0x3812131, 0x3812212,
+	0x3812221, 0x3812311, 0x3813112, 0x3813121, 0x3813211, 0x3814111, 0x3821113, 0x3821122,
+	0x3821131, 0x3821212, 0x3821221, 0x3821311, 0x3822112, 0x3822121, 0x3822211, 0x3823111,
+	0x3831112, 0x3831121, 0x3831211, 0x3832111, 0x3841111, 0x4111138, 0x4111147, 0x4111156,
+	0x4111165, 0x4111174, 0x4111183, 0x4111228, 0x4111237, 0x4111246, 0x4111255, 0x4111264,
+	0x4111273, 0x4111282, 0x4111318, 0x4111327, 0x4111336, 0x4111345, 0x4111354, 0x4111363,
+	0x4111372, 0x4111381, 0x4111417, 0x4111426, 0x4111435, 0x4111444, 0x4111453, 0x4111462,
+	0x4111471, 0x4111516, 0x4111525, 0x4111534, 0x4111543, 0x4111552, 0x4111561, 0x4111615,
+	0x4111624, 0x4111633, 0x4111642, 0x4111651, 0x4111714, 0x4111723, 0x4111732, 0x4111741,
+	0x4111813, 0x4111822, 0x4111831, 0x4112128, 0x4112137, 0x4112146, 0x4112155, 0x4112164,
+	0x4112173, 0x4112182, 0x4112218, 0x4112227, 0x4112236, 0x4112245, 0x4112254, 0x4112263,
+	0x4112272, 0x4112281, 0x4112317, 0x4112326, 0x4112335, 0x4112344, 0x4112353, 0x4112362,
+	0x4112371, 0x4112416, 0x4112425, 0x4112434, 0x4112443, 0x4112452, 0x4112461, 0x4112515,
+	0x4112524, 0x4112533, 0x4112542, 0x4112551, 0x4112614, 0x4112623, 0x4112632, 0x4112641,
+	0x4112713, 0x4112722, 0x4112731, 0x4112812, 0x4112821, 0x4113118, 0x4113127, 0x4113136,
+	0x4113145, 0x4113154, 0x4113163, 0x4113172, 0x4113181, 0x4113217, 0x4113226, 0x4113235,
+	0x4113244, 0x4113253, 0x4113262, 0x4113271, 0x4113316, 0x4113325, 0x4113334, 0x4113343,
+	0x4113352, 0x4113361, 0x4113415, 0x4113424, 0x4113433, 0x4113442, 0x4113451, 0x4113514,
+	0x4113523, 0x4113532, 0x4113541, 0x4113613, 0x4113622, 0x4113631, 0x4113712, 0x4113721,
+	0x4113811, 0x4114117, 0x4114126, 0x4114135, 0x4114144, 0x4114153, 0x4114162, 0x4114171,
+	0x4114216, 0x4114225, 0x4114234, 0x4114243, 0x4114252, 0x4114261, 0x4114315, 0x4114324,
+	0x4114333, 0x4114342, 0x4114351, 0x4114414, 0x4114423, 0x4114432, 0x4114441, 0x4114513,
+	0x4114522, 0x4114531, 0x4114612, 0x4114621, 0x4114711, 0x4115116, 0x4115125, 0x4115134,
+	0x4115143, 0x4115152, 0x4115161, 0x4115215, 0x4115224, 0x4115233, 0x4115242, 0x4115251,
+	0x4115314, 0x4115323, 0x4115332, 0x4115341, 0x4115413, 0x4115422, 0x4115431, 0x4115512,
+	0x4115521, 0x4115611, 0x4116115, 0x4116124, 0x4116133, 0x4116142, 0x4116151, 0x4116214,
+	0x4116223, 0x4116232, 0x4116241, 0x4116313, 0x4116322, 0x4116331, 0x4116412, 0x4116421,
+	0x4116511, 0x4117114, 0x4117123, 0x4117132, 0x4117141, 0x4117213, 0x4117222, 0x4117231,
+	0x4117312, 0x4117321, 0x4117411, 0x4118113, 0x4118122, 0x4118131, 0x4118212, 0x4118221,
+	0x4118311, 0x4121128, 0x4121137, 0x4121146, 0x4121155, 0x4121164, 0x4121173, 0x4121182,
+	0x4121218, 0x4121227, 0x4121236, 0x4121245, 0x4121254, 0x4121263, 0x4121272, 0x4121281,
+	0x4121317, 0x4121326, 0x4121335, 0x4121344, 0x4121353, 0x4121362, 0x4121371, 0x4121416,
+	0x4121425, 0x4121434, 0x4121443, 0x4121452, 0x4121461, 0x4121515, 0x4121524, 0x4121533,
+	0x4121542, 0x4121551, 0x4121614, 0x4121623, 0x4121632, 0x4121641, 0x4121713, 0x4121722,
+	0x4121731, 0x4121812, 0x4121821, 0x4122118, 0x4122127, 0x4122136, 0x4122145, 0x4122154,
+	0x4122163, 0x4122172, 0x4122181, 0x4122217, 0x4122226, 0x4122235, 0x4122244, 0x4122253,
+	0x4122262, 0x4122271, 0x4122316, 0x4122325, 0x4122334, 0x4122343, 0x4122352, 0x4122361,
+	0x4122415, 0x4122424, 0x4122433, 0x4122442, 0x4122451, 0x4122514, 0x4122523, 0x4122532,
+	0x4122541, 0x4122613, 0x4122622, 0x4122631, 0x4122712, 0x4122721, 0x4122811, 0x4123117,
+	0x4123126, 0x4123135, 0x4123144, 0x4123153, 0x4123162, 0x4123171, 0x4123216, 0x4123225,
+	0x4123234, 0x4123243, 0x4123252, 0x4123261, 0x4123315, 0x4123324, 0x4123333, 0x4123342,
+	0x4123351, 0x4123414, 0x4123423, 0x4123432, 0x4123441, 0x4123513, 0x4123522, 0x4123531,
+	0x4123612, 0x4123621, 0x4123711, 0x4124116, 0x4124125, 0x4124134, 0x4124143, 0x4124152,
+	0x4124161, 0x4124215, 0x4124224, 0x4124233, 0x4124242, 0x4124251, 0x4124314, 0x4124323,
+	0x4124332, 0x4124341, 0x4124413, 0x4124422, 0x4124431, 0x4124512, 0x4124521, 0x4124611,
+	0x4125115, 0x4125124, 0x4125133, 0x4125142, 0x4125151, 0x4125214, 0x4125223, 0x4125232,
+	0x4125241, 0x4125313, 0x4125322, 0x4125331, 0x4125412, 0x4125421, 0x4125511, 0x4126114,
+	0x4126123, 0x4126132, 0x4126141, 0x4126213, 0x4126222, 0x4126231, 0x4126312, 0x4126321,
+	0x4126411, 0x4127113, 0x4127122, 0x4127131, 0x4127212, 0x4127221, 0x4127311, 0x4128112,
+	0x4128121, 0x4128211, 0x4131118, 0x4131127, 0x4131136, 0x4131145, 0x4131154, 0x4131163,
+	0x4131172, 0x4131181, 0x4131217, 0x4131226, 0x4131235, 0x4131244, 0x4131253, 0x4131262,
+	0x4131271, 0x4131316, 0x4131325, 0x4131334, 0x4131343, 0x4131352, 0x4131361, 0x4131415,
+	0x4131424, 0x4131433, 0x4131442, 0x4131451, 0x4131514, 0x4131523, 0x4131532, 0x4131541,
+	0x4131613, 0x4131622, 0x4131631, 0x4131712, 0x4131721, 0x4131811, 0x4132117, 0x4132126,
+	0x4132135, 0x4132144, 0x4132153, 0x4132162, 0x4132171, 0x4132216, 0x4132225, 0x4132234,
+	0x4132243, 0x4132252, 0x4132261, 0x4132315, 0x4132324, 0x4132333, 0x4132342, 0x4132351,
+	0x4132414, 0x4132423, 0x4132432, 0x4132441, 0x4132513, 0x4132522, 0x4132531, 0x4132612,
+	0x4132621, 0x4132711, 0x4133116, 0x4133125, 0x4133134, 0x4133143, 0x4133152, 0x4133161,
+	0x4133215, 0x4133224, 0x4133233, 0x4133242, 0x4133251, 0x4133314, 0x4133323, 0x4133332,
+	0x4133341, 0x4133413, 0x4133422, 0x4133431, 0x4133512, 0x4133521, 0x4133611, 0x4134115,
+	0x4134124, 0x4134133, 0x4134142, 0x4134151, 0x4134214, 0x4134223, 0x4134232, 0x4134241,
+	0x4134313, 0x4134322, 0x4134331, 0x4134412, 0x4134421, 0x4134511, 0x4135114, 0x4135123,
+	0x4135132, 0x4135141, 0x4135213, 0x4135222, 0x4135231, 0x4135312, 0x4135321, 0x4135411,
+	0x4136113, 0x4136122, 0x4136131, 0x4136212, 0x4136221, 0x4136311, 0x4137112, 0x4137121,
+	0x4137211, 0x4138111, 0x4141117, 0x4141126, 0x4141135, 0x4141144, 0x4141153, 0x4141162,
+	0x4141171, 0x4141216, 0x4141225, 0x4141234, 0x4141243, 0x4141252, 0x4141261, 0x4141315,
+	0x4141324, 0x4141333, 0x4141342, 0x4141351, 0x4141414, 0x4141423, 0x4141432, 0x4141441,
+	0x4141513, 0x4141522, 0x4141531, 0x4141612, 0x4141621, 0x4141711, 0x4142116, 0x4142125,
+	0x4142134, 0x4142143, 0x4142152, 0x4142161, 0x4142215, 0x4142224, 0x4142233, 0x4142242,
+	0x4142251, 0x4142314, 0x4142323, 0x4142332, 0x4142341, 0x4142413, 0x4142422, 0x4142431,
+	0x4142512, 0x4142521, 0x4142611, 0x4143115, 0x4143124, 0x4143133, 0x4143142, 0x4143151,
+	0x4143214, 0x4143223, 0x4143232, 0x4143241, 0x4143313, 0x4143322, 0x4143331, 0x4143412,
+	0x4143421, 0x4143511, 0x4144114, 0x4144123, 0x4144132, 0x4144141, 0x4144213, 0x4144222,
+	0x4144231, 0x4144312, 0x4144321, 0x4144411, 0x4145113, 0x4145122, 0x4145131, 0x4145212,
+	0x4145221, 0x4145311, 0x4146112, 0x4146121, 0x4146211, 0x4147111, 0x4151116, 0x4151125,
+	0x4151134, 0x4151143, 0x4151152, 0x4151161, 0x4151215, 0x4151224, 0x4151233, 0x4151242,
+	0x4151251, 0x4151314, 0x4151323, 0x4151332, 0x4151341, 0x4151413, 0x4151422, 0x4151431,
+	0x4151512, 0x4151521, 0x4151611, 0x4152115, 0x4152124, 0x4152133, 0x4152142, 0x4152151,
+	0x4152214, 0x4152223, 0x4152232, 0x4152241, 0x4152313, 0x4152322, 0x4152331, 0x4152412,
+	0x4152421, 0x4152511, 0x4153114, 0x4153123, 0x4153132, 0x4153141, 0x4153213, 0x4153222,
+	0x4153231, 0x4153312, 0x4153321, 0x4153411, 0x4154113, 0x4154122, 0x4154131, 0x4154212,
+	0x4154221, 0x4154311, 0x4155112, 0x4155121, 0x4155211, 0x4156111, 0x4161115, 0x4161124,
+	0x4161133, 0x4161142, 0x4161151, 0x4161214, 0x4161223, 0x4161232, 0x4161241, 0x4161313,
+	0x4161322, 0x4161331, 0x4161412, 0x4161421, 0x4161511, 0x4162114, 0x4162123, 0x4162132,
+	0x4162141, 0x4162213, 0x4162222, 0x4162231, 0x4162312, 0x4162321, 0x4162411, 0x4163113,
+	0x4163122, 0x4163131, 0x4163212, 0x4163221, 0x4163311, 0x4164112, 0x4164121, 0x4164211,
+	0x4165111, 0x4171114, 0x4171123, 0x4171132, 0x4171141, 0x4171213, 0x4171222, 0x4171231,
+	0x4171312, 0x4171321, 0x4171411, 0x4172113, 0x4172122, 0x4172131, 0x4172212, 0x4172221,
+	0x4172311, 0x4173112, 0x4173121, 0x4173211, 0x4174111, 0x4181113, 0x4181122, 0x4181131,
+	0x4181212, 0x4181221, 0x4181311, 0x4182112, 0x4182121, 0x4182211, 0x4183111, 0x4211128,
+	0x4211137, 0x4211146, 0x4211155, 0x4211164, 0x4211173, 0x4211182, 0x4211218, 0x4211227,
+	0x4211236, 0x4211245, 0x4211254, 0x4211263, 0x4211272, 0x4211281, 0x4211317, 0x4211326,
+	0x4211335, 0x4211344, 0x4211353, 0x4211362, 0x4211371, 0x4211416, 0x4211425, 0x4211434,
+	0x4211443, 0x4211452, 0x4211461, 0x4211515, 0x4211524, 0x4211533, 0x4211542, 0x4211551,
+	0x4211614, 0x4211623, 0x4211632, 0x4211641, 0x4211713, 0x4211722, 0x4211731, 0x4211812,
+	0x4211821, 0x4212118, 0x4212127, 0x4212136, 0x4212145, 0x4212154, 0x4212163, 0x4212172,
+	0x4212181, 0x4212217, 0x4212226, 0x4212235, 0x4212244, 0x4212253, 0x4212262, 0x4212271,
+	0x4212316, 0x4212325, 0x4212334, 0x4212343, 0x4212352, 0x4212361, 0x4212415, 0x4212424,
+	0x4212433, 0x4212442, 0x4212451, 0x4212514, 0x4212523, 0x4212532, 0x4212541, 0x4212613,
+	0x4212622, 0x4212631, 0x4212712, 0x4212721, 0x4212811, 0x4213117, 0x4213126, 0x4213135,
+	0x4213144, 0x4213153, 0x4213162, 0x4213171, 0x4213216, 0x4213225, 0x4213234, 0x4213243,
+	0x4213252, 0x4213261, 0x4213315, 0x4213324, 0x4213333, 0x4213342, 0x4213351, 0x4213414,
+	0x4213423, 0x4213432, 0x4213441, 0x4213513, 0x4213522, 0x4213531, 0x4213612, 0x4213621,
+	0x4213711, 0x4214116, 0x4214125, 0x4214134, 0x4214143, 0x4214152, 0x4214161, 0x4214215,
+	0x4214224, 0x4214233, 0x4214242, 0x4214251, 0x4214314, 0x4214323, 0x4214332, 0x4214341,
+	0x4214413, 0x4214422, 0x4214431, 0x4214512, 0x4214521, 0x4214611, 0x4215115, 0x4215124,
+	0x4215133, 0x4215142, 0x4215151, 0x4215214, 0x4215223, 0x4215232, 0x4215241, 0x4215313,
+	0x4215322, 0x4215331, 0x4215412, 0x4215421, 0x4215511, 0x4216114, 0x4216123, 0x4216132,
+	0x4216141, 0x4216213, 0x4216222, 0x4216231, 0x4216312, 0x4216321, 0x4216411, 0x4217113,
+	0x4217122, 0x4217131, 0x4217212, 0x4217221, 0x4217311, 0x4218112, 0x4218121, 0x4218211,
+	0x4221118, 0x4221127, 0x4221136, 0x4221145, 0x4221154, 0x4221163, 0x4221172, 0x4221181,
+	0x4221217, 0x4221226, 0x4221235, 0x4221244, 0x4221253, 0x4221262, 0x4221271, 0x4221316,
+	0x4221325, 0x4221334, 0x4221343, 0x4221352, 0x4221361, 0x4221415, 0x4221424, 0x4221433,
+	0x4221442, 0x4221451, 0x4221514, 0x4221523, 0x4221532, 0x4221541, 0x4221613, 0x4221622,
+	0x4221631, 0x4221712, 0x4221721, 0x4221811, 0x4222117, 0x4222126, 0x4222135, 0x4222144,
+	0x4222153, 0x4222162, 0x4222171, 0x4222216, 0x4222225, 0x4222234, 0x4222243, 0x4222252,
+	0x4222261, 0x4222315, 0x4222324, 0x4222333, 0x4222342, 0x4222351, 0x4222414, 0x4222423,
+	0x4222432, 0x4222441, 0x4222513, 0x4222522, 0x4222531, 0x4222612, 0x4222621, 0x4222711,
+	0x4223116, 0x4223125, 0x4223134, 0x4223143, 0x4223152, 0x4223161, 0x4223215, 0x4223224,
+	0x4223233, 0x4223242, 0x4223251, 0x4223314, 0x4223323, 0x4223332, 0x4223341, 0x4223413,
+	0x4223422, 0x4223431, 0x4223512, 0x4223521, 0x4223611, 0x4224115, 0x4224124, 0x4224133,
+	0x4224142, 0x4224151, 0x4224214, 0x4224223, 0x4224232, 0x4224241, 0x4224313, 0x4224322,
+	0x4224331, 0x4224412, 0x4224421, 0x4224511, 0x4225114, 0x4225123, 0x4225132, 0x4225141,
+	0x4225213, 0x4225222, 0x4225231, 0x4225312, 0x4225321, 0x4225411, 0x4226113, 0x4226122,
+	0x4226131, 0x4226212, 0x4226221, 0x4226311, 0x4227112, 0x4227121, 0x4227211, 0x4228111,
+	0x4231117, 0x4231126, 0x4231135, 0x4231144, 0x4231153, 0x4231162, 0x4231171, 0x4231216,
+	0x4231225, 0x4231234, 0x4231243, 0x4231252, 0x4231261, 0x4231315, 0x4231324, 0x4231333,
+	0x4231342, 0x4231351, 0x4231414, 0x4231423, 0x4231432, 0x4231441, 0x4231513, 0x4231522,
+	0x4231531, 0x4231612, 0x4231621, 0x4231711, 0x4232116, 0x4232125, 0x4232134, 0x4232143,
+	0x4232152, 0x4232161, 0x4232215, 0x4232224, 0x4232233, 0x4232242, 0x4232251, 0x4232314,
+	0x4232323, 0x4232332, 0x4232341, 0x4232413, 0x4232422, 0x4232431, 0x4232512, 0x4232521,
+	0x4232611, 0x4233115, 0x4233124, 0x4233133, 0x4233142, 0x4233151, 0x4233214, 0x4233223,
+	0x4233232, 0x4233241, 0x4233313, 0x4233322, 0x4233331, 0x4233412, 0x4233421, 0x4233511,
+	0x4234114, 0x4234123, 0x4234132, 0x4234141, 0x4234213, 0x4234222, 0x4234231, 0x4234312,
+	0x4234321, 0x4234411, 0x4235113, 0x4235122, 0x4235131, 0x4235212, 0x4235221, 0x4235311,
+	0x4236112, 0x4236121, 0x4236211, 0x4237111, 0x4241116, 0x4241125, 0x4241134, 0x4241143,
+	0x4241152, 0x4241161, 0x4241215, 0x4241224, 0x4241233, 0x4241242, 0x4241251, 0x4241314,
+	0x4241323, 0x4241332, 0x4241341, 0x4241413, 0x4241422, 0x4241431, 0x4241512, 0x4241521,
+	0x4241611, 0x4242115, 0x4242124, 0x4242133, 0x4242142, 0x4242151, 0x4242214, 0x4242223,
+	0x4242232, 0x4242241, 0x4242313, 0x4242322, 0x4242331, 0x4242412, 0x4242421, 0x4242511,
+	0x4243114, 0x4243123, 0x4243132, 0x4243141, 0x4243213, 0x4243222, 0x4243231, 0x4243312,
+	0x4243321, 0x4243411, 0x4244113, 0x4244122, 0x4244131, 0x4244212, 0x4244221, 0x4244311,
+	0x4245112, 0x4245121, 0x4245211, 0x4246111, 0x4251115, 0x4251124, 0x4251133, 0x4251142,
+	0x4251151, 0x4251214, 0x4251223, 0x4251232, 0x4251241, 0x4251313, 0x4251322, 0x4251331,
+	0x4251412, 0x4251421, 0x4251511, 0x4252114, 0x4252123, 0x4252132, 0x4252141, 0x4252213,
+	0x4252222, 0x4252231, 0x4252312, 0x4252321, 0x4252411, 0x4253113, 0x4253122, 0x4253131,
+	0x4253212, 0x4253221, 0x4253311, 0x4254112, 0x4254121, 0x4254211, 0x4255111, 0x4261114,
+	0x4261123, 0x4261132, 0x4261141, 0x4261213, 0x4261222, 0x4261231, 0x4261312, 0x4261321,
+	0x4261411, 0x4262113, 0x4262122, 0x4262131, 0x4262212, 0x4262221, 0x4262311, 0x4263112,
+	0x4263121, 0x4263211, 0x4264111, 0x4271113, 0x4271122, 0x4271131, 0x4271212, 0x4271221,
+	0x4271311, 0x4272112, 0x4272121, 0x4272211, 0x4273111, 0x4281112, 0x4281121, 0x4281211,
+	0x4282111, 0x4311118, 0x4311127, 0x4311136, 0x4311145, 0x4311154, 0x4311163, 0x4311172,
+	0x4311181, 0x4311217, 0x4311226, 0x4311235, 0x4311244, 0x4311253, 0x4311262, 0x4311271,
+	0x4311316, 0x4311325, 0x4311334, 0x4311343, 0x4311352, 0x4311361, 0x4311415, 0x4311424,
+	0x4311433, 0x4311442, 0x4311451, 0x4311514, 0x4311523, 0x4311532, 0x4311541, 0x4311613,
+	0x4311622, 0x4311631, 0x4311712, 0x4311721, 0x4311811, 0x4312117, 0x4312126, 0x4312135,
+	0x4312144, 0x4312153, 0x4312162, 0x4312171, 0x4312216, 0x4312225, 0x4312234, 0x4312243,
+	0x4312252, 0x4312261, 0x4312315, 0x4312324, 0x4312333, 0x4312342, 0x4312351, 0x4312414,
+	0x4312423, 0x4312432, 0x4312441, 0x4312513, 0x4312522, 0x4312531, 0x4312612, 0x4312621,
+	0x4312711, 0x4313116, 0x4313125, 0x4313134, 0x4313143, 0x4313152, 0x4313161, 0x4313215,
+	0x4313224, 0x4313233, 0x4313242, 0x4313251, 0x4313314, 0x4313323, 0x4313332, 0x4313341,
+	0x4313413, 0x4313422, 0x4313431, 0x4313512, 0x4313521, 0x4313611, 0x4314115, 0x4314124,
+	0x4314133, 0x4314142, 0x4314151, 0x4314214, 0x4314223, 0x4314232, 0x4314241, 0x4314313,
+	0x4314322, 0x4314331, 0x4314412, 0x4314421, 0x4314511, 0x4315114, 0x4315123, 0x4315132,
+	0x4315141, 0x4315213, 0x4315222, 0x4315231, 0x4315312, 0x4315321, 0x4315411, 0x4316113,
+	0x4316122, 0x4316131, 0x4316212, 0x4316221, 0x4316311, 0x4317112, 0x4317121, 0x4317211,
+	0x4318111, 0x4321117, 0x4321126, 0x4321135, 0x4321144, 0x4321153, 0x4321162, 0x4321171,
+	0x4321216, 0x4321225, 0x4321234, 0x4321243, 0x4321252, 0x4321261, 0x4321315, 0x4321324,
+	0x4321333, 0x4321342, 0x4321351, 0x4321414, 0x4321423, 0x4321432, 0x4321441, 0x4321513,
+	0x4321522, 0x4321531, 0x4321612, 0x4321621, 0x4321711, 0x4322116, 0x4322125, 0x4322134,
+	0x4322143, 0x4322152, 0x4322161, 0x4322215, 0x4322224, 0x4322233, 0x4322242, 0x4322251,
+	0x4322314, 0x4322323, 0x4322332, 0x4322341, 0x4322413, 0x4322422, 0x4322431, 0x4322512,
+	0x4322521, 0x4322611, 0x4323115, 0x4323124, 0x4323133, 0x4323142, 0x4323151, 0x4323214,
+	0x4323223, 0x4323232, 0x4323241, 0x4323313, 0x4323322, 0x4323331, 0x4323412, 0x4323421,
+	0x4323511, 0x4324114, 0x4324123, 0x4324132, 0x4324141, 0x4324213, 0x4324222, 0x4324231,
+	0x4324312, 0x4324321, 0x4324411, 0x4325113, 0x4325122, 0x4325131, 0x4325212, 0x4325221,
+	0x4325311, 0x4326112, 0x4326121, 0x4326211, 0x4327111, 0x4331116, 0x4331125, 0x4331134,
+	0x4331143, 0x4331152, 0x4331161, 0x4331215, 0x4331224, 0x4331233, 0x4331242, 0x4331251,
+	0x4331314, 0x4331323, 0x4331332, 0x4331341, 0x4331413, 0x4331422, 0x4331431, 0x4331512,
+	0x4331521, 0x4331611, 0x4332115, 0x4332124, 0x4332133, 0x4332142, 0x4332151, 0x4332214,
+	0x4332223, 0x4332232, 0x4332241, 0x4332313, 0x4332322, 0x4332331, 0x4332412, 0x4332421,
+	0x4332511, 0x4333114, 0x4333123, 0x4333132, 0x4333141, 0x4333213, 0x4333222, 0x4333231,
+	0x4333312, 0x4333321, 0x4333411, 0x4334113, 0x4334122, 0x4334131, 0x4334212, 0x4334221,
+	0x4334311, 0x4335112, 0x4335121, 0x4335211, 0x4336111, 0x4341115, 0x4341124, 0x4341133,
+	0x4341142, 0x4341151, 0x4341214, 0x4341223, 0x4341232, 0x4341241, 0x4341313, 0x4341322,
+	0x4341331, 0x4341412, 0x4341421, 0x4341511, 0x4342114, 0x4342123, 0x4342132, 0x4342141,
+	0x4342213, 0x4342222, 0x4342231, 0x4342312, 0x4342321, 0x4342411, 0x4343113, 0x4343122,
+	0x4343131, 0x4343212, 0x4343221, 0x4343311, 0x4344112, 0x4344121, 0x4344211, 0x4345111,
+	0x4351114, 0x4351123, 0x4351132, 0x4351141, 0x4351213, 0x4351222, 0x4351231, 0x4351312,
+	0x4351321, 0x4351411, 0x4352113, 0x4352122, 0x4352131, 0x4352212, 0x4352221, 0x4352311,
+	0x4353112, 0x4353121, 0x4353211, 0x4354111, 0x4361113, 0x4361122, 0x4361131, 0x4361212,
+	0x4361221, 0x4361311, 0x4362112, 0x4362121, 0x4362211, 0x4363111, 0x4371112, 0x4371121,
+	0x4371211, 0x4372111, 0x4381111, 0x4411117, 0x4411126, 0x4411135, 0x4411144, 0x4411153,
+	0x4411162, 0x4411171, 0x4411216, 0x4411225, 0x4411234, 0x4411243, 0x4411252, 0x4411261,
+	0x4411315, 0x4411324, 0x4411333, 0x4411342, 0x4411351, 0x4411414, 0x4411423, 0x4411432,
+	0x4411441, 0x4411513, 0x4411522, 0x4411531, 0x4411612, 0x4411621, 0x4411711, 0x4412116,
+	0x4412125, 0x4412134, 0x4412143, 0x4412152, 0x4412161, 0x4412215, 0x4412224, 0x4412233,
+	0x4412242, 0x4412251, 0x4412314, 0x4412323, 0x4412332, 0x4412341, 0x4412413, 0x4412422,
+	0x4412431, 0x4412512, 0x4412521, 0x4412611, 0x4413115, 0x4413124, 0x4413133, 0x4413142,
+	0x4413151, 0x4413214, 0x4413223, 0x4413232, 0x4413241, 0x4413313, 0x4413322, 0x4413331,
+	0x4413412, 0x4413421, 0x4413511, 0x4414114, 0x4414123, 0x4414132, 0x4414141, 0x4414213,
+	0x4414222, 0x4414231, 0x4414312, 0x4414321, 0x4414411, 0x4415113, 0x4415122, 0x4415131,
+	0x4415212, 0x4415221, 0x4415311, 0x4416112, 0x4416121, 0x4416211, 0x4417111, 0x4421116,
+	0x4421125, 0x4421134, 0x4421143, 0x4421152, 0x4421161, 0x4421215, 0x4421224, 0x4421233,
+	0x4421242, 0x4421251, 0x4421314, 0x4421323, 0x4421332, 0x4421341, 0x4421413, 0x4421422,
+	0x4421431, 0x4421512, 0x4421521, 0x4421611, 0x4422115, 0x4422124, 0x4422133, 0x4422142,
+	0x4422151, 0x4422214, 0x4422223, 0x4422232, 0x4422241, 0x4422313, 0x4422322, 0x4422331,
+	0x4422412, 0x4422421, 0x4422511, 0x4423114, 0x4423123, 0x4423132, 0x4423141, 0x4423213,
+	0x4423222, 0x4423231, 0x4423312, 0x4423321, 0x4423411, 0x4424113, 0x4424122, 0x4424131,
+	0x4424212, 0x4424221, 0x4424311, 0x4425112, 0x4425121, 0x4425211, 0x4426111, 0x4431115,
+	0x4431124, 0x4431133, 0x4431142, 0x4431151, 0x4431214, 0x4431223, 0x4431232, 0x4431241,
+	0x4431313, 0x4431322, 0x4431331, 0x4431412, 0x4431421, 0x4431511, 0x4432114, 0x4432123,
+	0x4432132, 0x4432141, 0x4432213, 0x4432222, 0x4432231, 0x4432312, 0x4432321, 0x4432411,
+	0x4433113, 0x4433122, 0x4433131, 0x4433212, 0x4433221, 0x4433311, 0x4434112, 0x4434121,
+	0x4434211, 0x4435111, 0x4441114, 0x4441123, 0x4441132, 0x4441141, 0x4441213, 0x4441222,
+	0x4441231, 0x4441312, 0x4441321, 0x4441411, 0x4442113, 0x4442122, 0x4442131, 0x4442212,
+	0x4442221, 0x4442311, 0x4443112, 0x4443121, 0x4443211, 0x4444111, 0x4451113, 0x4451122,
+	0x4451131, 0x4451212, 0x4451221, 0x4451311, 0x4452112, 0x4452121, 0x4452211, 0x4453111,
+	0x4461112, 0x4461121, 0x4461211, 0x4462111, 0x4471111, 0x4511116, 0x4511125, 0x4511134,
+	0x4511143, 0x4511152, 0x4511161, 0x4511215, 0x4511224, 0x4511233, 0x4511242, 0x4511251,
+	0x4511314, 0x4511323, 0x4511332, 0x4511341, 0x4511413, 0x4511422, 0x4511431, 0x4511512,
+	0x4511521, 0x4511611, 0x4512115, 0x4512124, 0x4512133, 0x4512142, 0x4512151, 0x4512214,
+	0x4512223, 0x4512232, 0x4512241, 0x4512313, 0x4512322, 0x4512331, 0x4512412, 0x4512421,
+	0x4512511, 0x4513114, 0x4513123, 0x4513132, 0x4513141, 0x4513213, 0x4513222, 0x4513231,
+	0x4513312, 0x4513321, 0x4513411, 0x4514113, 0x4514122, 0x4514131, 0x4514212, 0x4514221,
+	0x4514311, 0x4515112, 0x4515121, 0x4515211, 0x4516111, 0x4521115, 0x4521124, 0x4521133,
+	0x4521142, 0x4521151, 0x4521214, 0x4521223, 0x4521232, 0x4521241, 0x4521313, 0x4521322,
+	0x4521331, 0x4521412, 0x4521421, 0x4521511, 0x4522114, 0x4522123, 0x4522132, 0x4522141,
+	0x4522213, 0x4522222, 0x4522231, 0x4522312, 0x4522321, 0x4522411, 0x4523113, 0x4523122,
+	0x4523131, 0x4523212, 0x4523221, 0x4523311, 0x4524112, 0x4524121, 0x4524211, 0x4525111,
+	0x4531114, 0x4531123, 0x4531132, 0x4531141, 0x4531213, 0x4531222, 0x4531231, 0x4531312,
+	0x4531321, 0x4531411, 0x4532113, 0x4532122, 0x4532131, 0x4532212, 0x4532221, 0x4532311,
+	0x4533112, 0x4533121, 0x4533211, 0x4534111, 0x4541113, 0x4541122, 0x4541131, 0x4541212,
+	0x4541221, 0x4541311, 0x4542112, 0x4542121, 0x4542211, 0x4543111, 0x4551112, 0x4551121,
+	0x4551211, 0x4552111, 0x4561111, 0x4611115, 0x4611124, 0x4611133, 0x4611142, 0x4611151,
+	0x4611214, 0x4611223, 0x4611232, 0x4611241, 0x4611313, 0x4611322, 0x4611331, 0x4611412,
+	0x4611421, 0x4611511, 0x4612114, 0x4612123, 0x4612132, 0x4612141, 0x4612213, 0x4612222,
+	0x4612231, 0x4612312, 0x4612321, 0x4612411, 0x4613113, 0x4613122, 0x4613131, 0x4613212,
+	0x4613221, 0x4613311, 0x4614112, 0x4614121, 0x4614211, 0x4615111, 0x4621114, 0x4621123,
+	0x4621132, 0x4621141, 0x4621213, 0x4621222, 0x4621231, 0x4621312, 0x4621321, 0x4621411,
+	0x4622113, 0x4622122, 0x4622131, 0x4622212, 0x4622221, 0x4622311, 0x4623112, 0x4623121,
+	0x4623211, 0x4624111, 0x4631113, 0x4631122, 0x4631131, 0x4631212, 0x4631221, 0x4631311,
+	0x4632112, 0x4632121, 0x4632211, 0x4633111, 0x4641112, 0x4641121, 0x4641211, 0x4642111,
+	0x4651111, 0x4711114, 0x4711123, 0x4711132, 0x4711141, 0x4711213, 0x4711222, 0x4711231,
+	0x4711312, 0x4711321, 0x4711411, 0x4712113, 0x4712122, 0x4712131, 0x4712212, 0x4712221,
+	0x4712311, 0x4713112, 0x4713121, 0x4713211, 0x4714111, 0x4721113, 0x4721122, 0x4721131,
+	0x4721212, 0x4721221, 0x4721311, 0x4722112, 0x4722121, 0x4722211, 0x4723111, 0x4731112,
+	0x4731121, 0x4731211, 0x4732111, 0x4741111, 0x4811113, 0x4811122, 0x4811131, 0x4811212,
+	0x4811221, 0x4811311, 0x4812112, 0x4812121, 0x4812211, 0x4813111, 0x4821112, 0x4821121,
+	0x4821211, 0x4822111, 0x4831111, 0x5111128, 0x5111137, 0x5111146, 0x5111155, 0x5111164,
+	0x5111173, 0x5111182, 0x5111218, 0x5111227, 0x5111236, 0x5111245, 0x5111254, 0x5111263,
+	0x5111272, 0x5111281, 0x5111317, 0x5111326, 0x5111335, 0x5111344, 0x5111353, 0x5111362,
+	0x5111371, 0x5111416, 0x5111425, 0x5111434, 0x5111443, 0x5111452, 0x5111461, 0x5111515,
+	0x5111524, 0x5111533, 0x5111542, 0x5111551, 0x5111614, 0x5111623, 0x5111632, 0x5111641,
+	0x5111713, 0x5111722, 0x5111731, 0x5111812, 0x5111821, 0x5112118, 0x5112127, 0x5112136,
+	0x5112145, 0x5112154, 0x5112163, 0x5112172, 0x5112181, 0x5112217, 0x5112226, 0x5112235,
+	0x5112244, 0x5112253, 0x5112262, 0x5112271, 0x5112316, 0x5112325, 0x5112334, 0x5112343,
+	0x5112352, 0x5112361, 0x5112415, 0x5112424, 0x5112433, 0x5112442, 0x5112451, 0x5112514,
+	0x5112523, 0x5112532, 0x5112541, 0x5112613, 0x5112622, 0x5112631, 0x5112712, 0x5112721,
+	0x5112811, 0x5113117, 0x5113126, 0x5113135, 0x5113144, 0x5113153, 0x5113162, 0x5113171,
+	0x5113216, 0x5113225, 0x5113234, 0x5113243, 0x5113252, 0x5113261, 0x5113315, 0x5113324,
+	0x5113333, 0x5113342, 0x5113351, 0x5113414, 0x5113423, 0x5113432, 0x5113441, 0x5113513,
+	0x5113522, 0x5113531, 0x5113612, 0x5113621, 0x5113711, 0x5114116, 0x5114125, 0x5114134,
+	0x5114143, 0x5114152, 0x5114161, 0x5114215, 0x5114224, 0x5114233, 0x5114242, 0x5114251,
+	0x5114314, 0x5114323, 0x5114332, 0x5114341, 0x5114413, 0x5114422, 0x5114431, 0x5114512,
+	0x5114521, 0x5114611, 0x5115115, 0x5115124, 0x5115133, 0x5115142, 0x5115151, 0x5115214,
+	0x5115223, 0x5115232, 0x5115241, 0x5115313, 0x5115322, 0x5115331, 0x5115412, 0x5115421,
+	0x5115511, 0x5116114, 0x5116123, 0x5116132, 0x5116141, 0x5116213, 0x5116222, 0x5116231,
+	0x5116312, 0x5116321, 0x5116411, 0x5117113, 0x5117122, 0x5117131, 0x5117212, 0x5117221,
+	0x5117311, 0x5118112, 0x5118121, 0x5118211, 0x5121118, 0x5121127, 0x5121136, 0x5121145,
+	0x5121154, 0x5121163, 0x5121172, 0x5121181, 0x5121217, 0x5121226, 0x5121235, 0x5121244,
+	0x5121253, 0x5121262, 0x5121271, 0x5121316, 0x5121325, 0x5121334, 0x5121343, 0x5121352,
+	0x5121361, 0x5121415, 0x5121424, 0x5121433, 0x5121442, 0x5121451, 0x5121514, 0x5121523,
+	0x5121532, 0x5121541, 0x5121613, 0x5121622, 0x5121631, 0x5121712, 0x5121721, 0x5121811,
+	0x5122117, 0x5122126, 0x5122135, 0x5122144, 0x5122153, 0x5122162, 0x5122171, 0x5122216,
+	0x5122225, 0x5122234, 0x5122243, 0x5122252, 0x5122261, 0x5122315, 0x5122324, 0x5122333,
+	0x5122342, 0x5122351, 0x5122414, 0x5122423, 0x5122432, 0x5122441, 0x5122513, 0x5122522,
+	0x5122531, 0x5122612, 0x5122621, 0x5122711, 0x5123116, 0x5123125, 0x5123134, 0x5123143,
+	0x5123152, 0x5123161, 0x5123215, 0x5123224, 0x5123233, 0x5123242, 0x5123251, 0x5123314,
+	0x5123323, 0x5123332, 0x5123341, 0x5123413, 0x5123422, 0x5123431, 0x5123512, 0x5123521,
+	0x5123611, 0x5124115, 0x5124124, 0x5124133, 0x5124142, 0x5124151, 0x5124214, 0x5124223,
+	0x5124232, 0x5124241, 0x5124313, 0x5124322, 0x5124331, 0x5124412, 0x5124421, 0x5124511,
+	0x5125114, 0x5125123, 0x5125132, 0x5125141, 0x5125213, 0x5125222, 0x5125231, 0x5125312,
+	0x5125321, 0x5125411, 0x5126113, 0x5126122, 0x5126131, 0x5126212, 0x5126221, 0x5126311,
+	0x5127112, 0x5127121, 0x5127211, 0x5128111, 0x5131117, 0x5131126, 0x5131135, 0x5131144,
+	0x5131153, 0x5131162, 0x5131171, 0x5131216, 0x5131225, 0x5131234, 0x5131243, 0x5131252,
+	0x5131261, 0x5131315, 0x5131324, 0x5131333, 0x5131342, 0x5131351, 0x5131414, 0x5131423,
+	0x5131432, 0x5131441, 0x5131513, 0x5131522, 0x5131531, 0x5131612, 0x5131621, 0x5131711,
+	0x5132116, 0x5132125, 0x5132134, 0x5132143, 0x5132152, 0x5132161, 0x5132215, 0x5132224,
+	0x5132233, 0x5132242, 0x5132251, 0x5132314, 0x5132323, 0x5132332, 0x5132341, 0x5132413,
+	0x5132422, 0x5132431, 0x5132512, 0x5132521, 0x5132611, 0x5133115, 0x5133124, 0x5133133,
+	0x5133142, 0x5133151, 0x5133214, 0x5133223, 0x5133232, 0x5133241, 0x5133313, 0x5133322,
+	0x5133331, 0x5133412, 0x5133421, 0x5133511, 0x5134114, 0x5134123, 0x5134132, 0x5134141,
+	0x5134213, 0x5134222, 0x5134231, 0x5134312, 0x5134321, 0x5134411, 0x5135113, 0x5135122,
+	0x5135131, 0x5135212, 0x5135221, 0x5135311, 0x5136112, 0x5136121, 0x5136211, 0x5137111,
+	0x5141116, 0x5141125, 0x5141134, 0x5141143, 0x5141152, 0x5141161, 0x5141215, 0x5141224,
+	0x5141233, 0x5141242, 0x5141251, 0x5141314, 0x5141323, 0x5141332, 0x5141341, 0x5141413,
+	0x5141422, 0x5141431, 0x5141512, 0x5141521, 0x5141611, 0x5142115, 0x5142124, 0x5142133,
+	0x5142142, 0x5142151, 0x5142214, 0x5142223, 0x5142232, 0x5142241, 0x5142313, 0x5142322,
+	0x5142331, 0x5142412, 0x5142421, 0x5142511, 0x5143114, 0x5143123, 0x5143132, 0x5143141,
+	0x5143213, 0x5143222, 0x5143231, 0x5143312, 0x5143321, 0x5143411, 0x5144113, 0x5144122,
+	0x5144131, 0x5144212, 0x5144221, 0x5144311, 0x5145112, 0x5145121, 0x5145211, 0x5146111,
+	0x5151115, 0x5151124, 0x5151133, 0x5151142, 0x5151151, 0x5151214, 0x5151223, 0x5151232,
+	0x5151241, 0x5151313, 0x5151322, 0x5151331, 0x5151412, 0x5151421, 0x5151511, 0x5152114,
+	0x5152123, 0x5152132, 0x5152141, 0x5152213, 0x5152222, 0x5152231, 0x5152312, 0x5152321,
+	0x5152411, 0x5153113, 0x5153122, 0x5153131, 0x5153212, 0x5153221, 0x5153311, 0x5154112,
+	0x5154121, 0x5154211, 0x5155111, 0x5161114, 0x5161123, 0x5161132, 0x5161141, 0x5161213,
+	0x5161222, 0x5161231, 0x5161312, 0x5161321, 0x5161411, 0x5162113, 0x5162122, 0x5162131,
+	0x5162212, 0x5162221, 0x5162311, 0x5163112, 0x5163121, 0x5163211, 0x5164111, 0x5171113,
+	0x5171122, 0x5171131, 0x5171212, 0x5171221, 0x5171311, 0x5172112, 0x5172121, 0x5172211,
+	0x5173111, 0x5181112, 0x5181121, 0x5181211, 0x5182111, 0x5211118, 0x5211127, 0x5211136,
+	0x5211145, 0x5211154, 0x5211163, 0x5211172, 0x5211181, 0x5211217, 0x5211226, 0x5211235,
+	0x5211244, 0x5211253, 0x5211262, 0x5211271, 0x5211316, 0x5211325, 0x5211334, 0x5211343,
+	0x5211352, 0x5211361, 0x5211415, 0x5211424, 0x5211433, 0x5211442, 0x5211451, 0x5211514,
+	0x5211523, 0x5211532, 0x5211541, 0x5211613, 0x5211622, 0x5211631, 0x5211712, 0x5211721,
+	0x5211811, 0x5212117, 0x5212126, 0x5212135, 0x5212144, 0x5212153, 0x5212162, 0x5212171,
+	0x5212216, 0x5212225, 0x5212234, 0x5212243, 0x5212252, 0x5212261, 0x5212315, 0x5212324,
+	0x5212333, 0x5212342, 0x5212351, 0x5212414, 0x5212423, 0x5212432, 0x5212441, 0x5212513,
+	0x5212522, 0x5212531, 0x5212612, 0x5212621, 0x5212711, 0x5213116, 0x5213125, 0x5213134,
+	0x5213143, 0x5213152, 0x5213161, 0x5213215, 0x5213224, 0x5213233, 0x5213242, 0x5213251,
+	0x5213314, 0x5213323, 0x5213332, 0x5213341, 0x5213413, 0x5213422, 0x5213431, 0x5213512,
+	0x5213521, 0x5213611, 0x5214115, 0x5214124, 0x5214133, 0x5214142, 0x5214151, 0x5214214,
+	0x5214223, 0x5214232, 0x5214241, 0x5214313, 0x5214322, 0x5214331, 0x5214412, 0x5214421,
+	0x5214511, 0x5215114, 0x5215123, 0x5215132, 0x5215141, 0x5215213, 0x5215222, 0x5215231,
+	0x5215312, 0x5215321, 0x5215411, 0x5216113, 0x5216122, 0x5216131, 0x5216212, 0x5216221,
+	0x5216311, 0x5217112, 0x5217121, 0x5217211, 0x5218111, 0x5221117, 0x5221126, 0x5221135,
+	0x5221144, 0x5221153, 0x5221162, 0x5221171, 0x5221216, 0x5221225, 0x5221234, 0x5221243,
+	0x5221252, 0x5221261, 0x5221315, 0x5221324, 0x5221333, 0x5221342, 0x5221351, 0x5221414,
+	0x5221423, 0x5221432, 0x5221441, 0x5221513, 0x5221522, 0x5221531, 0x5221612, 0x5221621,
+	0x5221711, 0x5222116, 0x5222125, 0x5222134, 0x5222143, 0x5222152, 0x5222161, 0x5222215,
+	0x5222224, 0x5222233, 0x5222242, 0x5222251, 0x5222314, 0x5222323, 0x5222332, 0x5222341,
+	0x5222413, 0x5222422, 0x5222431, 0x5222512, 0x5222521, 0x5222611, 0x5223115, 0x5223124,
+	0x5223133, 0x5223142, 0x5223151, 0x5223214, 0x5223223, 0x5223232, 0x5223241, 0x5223313,
+	0x5223322, 0x5223331, 0x5223412, 0x5223421, 0x5223511, 0x5224114, 0x5224123, 0x5224132,
+	0x5224141, 0x5224213, 0x5224222, 0x5224231, 0x5224312, 0x5224321, 0x5224411, 0x5225113,
+	0x5225122, 0x5225131, 0x5225212, 0x5225221, 0x5225311, 0x5226112, 0x5226121, 0x5226211,
+	0x5227111, 0x5231116, 0x5231125, 0x5231134, 0x5231143, 0x5231152, 0x5231161, 0x5231215,
+	0x5231224, 0x5231233, 0x5231242, 0x5231251, 0x5231314, 0x5231323, 0x5231332, 0x5231341,
+	0x5231413, 0x5231422, 0x5231431, 0x5231512, 0x5231521, 0x5231611, 0x5232115, 0x5232124,
+	0x5232133, 0x5232142, 0x5232151, 0x5232214, 0x5232223, 0x5232232, 0x5232241, 0x5232313,
+	0x5232322, 0x5232331, 0x5232412, 0x5232421, 0x5232511, 0x5233114, 0x5233123, 0x5233132,
+	0x5233141, 0x5233213, 0x5233222, 0x5233231, 0x5233312, 0x5233321, 0x5233411, 0x5234113,
+	0x5234122, 0x5234131, 0x5234212, 0x5234221, 0x5234311, 0x5235112, 0x5235121, 0x5235211,
+	0x5236111, 0x5241115, 0x5241124, 0x5241133, 0x5241142, 0x5241151, 0x5241214, 0x5241223,
+	0x5241232, 0x5241241, 0x5241313, 0x5241322, 0x5241331, 0x5241412, 0x5241421, 0x5241511,
+	0x5242114, 0x5242123, 0x5242132, 0x5242141, 0x5242213, 0x5242222, 0x5242231, 0x5242312,
+	0x5242321, 0x5242411, 0x5243113, 0x5243122, 0x5243131, 0x5243212, 0x5243221, 0x5243311,
+	0x5244112, 0x5244121, 0x5244211, 0x5245111, 0x5251114, 0x5251123, 0x5251132, 0x5251141,
+	0x5251213, 0x5251222, 0x5251231, 0x5251312, 0x5251321, 0x5251411, 0x5252113, 0x5252122,
+	0x5252131, 0x5252212, 0x5252221, 0x5252311, 0x5253112, 0x5253121, 0x5253211, 0x5254111,
+	0x5261113, 0x5261122, 0x5261131, 0x5261212, 0x5261221, 0x5261311, 0x5262112, 0x5262121,
+	0x5262211, 0x5263111, 0x5271112, 0x5271121, 0x5271211, 0x5272111, 0x5281111, 0x5311117,
+	0x5311126, 0x5311135, 0x5311144, 0x5311153, 0x5311162, 0x5311171, 0x5311216, 0x5311225,
+	0x5311234, 0x5311243, 0x5311252, 0x5311261, 0x5311315, 0x5311324, 0x5311333, 0x5311342,
+	0x5311351, 0x5311414, 0x5311423, 0x5311432, 0x5311441, 0x5311513, 0x5311522, 0x5311531,
+	0x5311612, 0x5311621, 0x5311711, 0x5312116, 0x5312125, 0x5312134, 0x5312143, 0x5312152,
+	0x5312161, 0x5312215, 0x5312224, 0x5312233, 0x5312242, 0x5312251, 0x5312314, 0x5312323,
+	0x5312332, 0x5312341, 0x5312413, 0x5312422, 0x5312431, 0x5312512, 0x5312521, 0x5312611,
+	0x5313115, 0x5313124, 0x5313133, 0x5313142, 0x5313151, 0x5313214, 0x5313223, 0x5313232,
+	0x5313241, 0x5313313, 0x5313322, 0x5313331, 0x5313412, 0x5313421, 0x5313511, 0x5314114,
+	0x5314123, 0x5314132, 0x5314141, 0x5314213, 0x5314222, 0x5314231, 0x5314312, 0x5314321,
+	0x5314411, 0x5315113, 0x5315122, 0x5315131, 0x5315212, 0x5315221, 0x5315311, 0x5316112,
+	0x5316121, 0x5316211, 0x5317111, 0x5321116, 0x5321125, 0x5321134, 0x5321143, 0x5321152,
+	0x5321161, 0x5321215, 0x5321224, 0x5321233, 0x5321242, 0x5321251, 0x5321314, 0x5321323,
+	0x5321332, 0x5321341, 0x5321413, 0x5321422, 0x5321431, 0x5321512, 0x5321521, 0x5321611,
+	0x5322115, 0x5322124, 0x5322133, 0x5322142, 0x5322151, 0x5322214, 0x5322223, 0x5322232,
+	0x5322241, 0x5322313, 0x5322322, 0x5322331, 0x5322412, 0x5322421, 0x5322511, 0x5323114,
+	0x5323123, 0x5323132, 0x5323141, 0x5323213, 0x5323222, 0x5323231, 0x5323312, 0x5323321,
+	0x5323411, 0x5324113, 0x5324122, 0x5324131, 0x5324212, 0x5324221, 0x5324311, 0x5325112,
+	0x5325121, 0x5325211, 0x5326111, 0x5331115, 0x5331124, 0x5331133, 0x5331142, 0x5331151,
+	0x5331214, 0x5331223, 0x5331232, 0x5331241, 0x5331313, 0x5331322, 0x5331331, 0x5331412,
+	0x5331421, 0x5331511, 0x5332114, 0x5332123, 0x5332132, 0x5332141, 0x5332213, 0x5332222,
+	0x5332231, 0x5332312, 0x5332321, 0x5332411, 0x5333113, 0x5333122, 0x5333131, 0x5333212,
+	0x5333221, 0x5333311, 0x5334112, 0x5334121, 0x5334211, 0x5335111, 0x5341114, 0x5341123,
+	0x5341132, 0x5341141, 0x5341213, 0x5341222, 0x5341231, 0x5341312, 0x5341321, 0x5341411,
+	0x5342113, 0x5342122, 0x5342131, 0x5342212, 0x5342221, 0x5342311, 0x5343112, 0x5343121,
+	0x5343211, 0x5344111, 0x5351113, 0x5351122, 0x5351131, 0x5351212, 0x5351221, 0x5351311,
+	0x5352112, 0x5352121, 0x5352211, 0x5353111, 0x5361112, 0x5361121, 0x5361211, 0x5362111,
+	0x5371111, 0x5411116, 0x5411125, 0x5411134, 0x5411143, 0x5411152, 0x5411161, 0x5411215,
+	0x5411224, 0x5411233, 0x5411242, 0x5411251, 0x5411314, 0x5411323, 0x5411332, 0x5411341,
+	0x5411413, 0x5411422, 0x5411431, 0x5411512, 0x5411521, 0x5411611, 0x5412115, 0x5412124,
+	0x5412133, 0x5412142, 0x5412151, 0x5412214, 0x5412223, 0x5412232, 0x5412241, 0x5412313,
+	0x5412322, 0x5412331, 0x5412412, 0x5412421, 0x5412511, 0x5413114, 0x5413123, 0x5413132,
+	0x5413141, 0x5413213, 0x5413222, 0x5413231, 0x5413312, 0x5413321, 0x5413411, 0x5414113,
+	0x5414122, 0x5414131, 0x5414212, 0x5414221, 0x5414311, 0x5415112, 0x5415121, 0x5415211,
+	0x5416111, 0x5421115, 0x5421124, 0x5421133, 0x5421142, 0x5421151, 0x5421214, 0x5421223,
+	0x5421232, 0x5421241, 0x5421313, 0x5421322, 0x5421331, 0x5421412, 0x5421421, 0x5421511,
+	0x5422114, 0x5422123, 0x5422132, 0x5422141, 0x5422213, 0x5422222, 0x5422231, 0x5422312,
+	0x5422321, 0x5422411, 0x5423113, 0x5423122, 0x5423131, 0x5423212, 0x5423221, 0x5423311,
+	0x5424112, 0x5424121, 0x5424211, 0x5425111, 0x5431114, 0x5431123, 0x5431132, 0x5431141,
+	0x5431213, 0x5431222, 0x5431231, 0x5431312, 0x5431321, 0x5431411, 0x5432113, 0x5432122,
+	0x5432131, 0x5432212, 0x5432221, 0x5432311, 0x5433112, 0x5433121, 0x5433211, 0x5434111,
+	0x5441113, 0x5441122, 0x5441131, 0x5441212, 0x5441221, 0x5441311, 0x5442112, 0x5442121,
+	0x5442211, 0x5443111, 0x5451112, 0x5451121, 0x5451211, 0x5452111, 0x5461111, 0x5511115,
+	0x5511124, 0x5511133, 0x5511142, 0x5511151, 0x5511214, 0x5511223, 0x5511232, 0x5511241,
+	0x5511313, 0x5511322, 0x5511331, 0x5511412, 0x5511421, 0x5511511, 0x5512114, 0x5512123,
+	0x5512132, 0x5512141, 0x5512213, 0x5512222, 0x5512231, 0x5512312, 0x5512321, 0x5512411,
+	0x5513113, 0x5513122, 0x5513131, 0x5513212, 0x5513221, 0x5513311, 0x5514112, 0x5514121,
+	0x5514211, 0x5515111, 0x5521114, 0x5521123, 0x5521132, 0x5521141, 0x5521213, 0x5521222,
+	0x5521231, 0x5521312, 0x5521321, 0x5521411, 0x5522113, 0x5522122, 0x5522131, 0x5522212,
+	0x5522221, 0x5522311, 0x5523112, 0x5523121, 0x5523211, 0x5524111, 0x5531113, 0x5531122,
+	0x5531131, 0x5531212, 0x5531221, 0x5531311, 0x5532112, 0x5532121, 0x5532211, 0x5533111,
+	0x5541112, 0x5541121, 0x5541211, 0x5542111, 0x5551111, 0x5611114, 0x5611123, 0x5611132,
+	0x5611141, 0x5611213, 0x5611222, 0x5611231, 0x5611312, 0x5611321, 0x5611411, 0x5612113,
+	0x5612122, 0x5612131, 0x5612212, 0x5612221, 0x5612311, 0x5613112, 0x5613121, 0x5613211,
+	0x5614111, 0x5621113, 0x5621122, 0x5621131, 0x5621212, 0x5621221, 0x5621311, 0x5622112,
+	0x5622121, 0x5622211, 0x5623111, 0x5631112, 0x5631121, 0x5631211, 0x5632111, 0x5641111,
+	0x5711113, 0x5711122, 0x5711131, 0x5711212, 0x5711221, 0x5711311, 0x5712112, 0x5712121,
+	0x5712211, 0x5713111, 0x5721112, 0x5721121, 0x5721211, 0x5722111, 0x5731111, 0x5811112,
+	0x5811121, 0x5811211, 0x5812111, 0x5821111, 0x6111118, 0x6111127, 0x6111136, 0x6111145,
+	0x6111154, 0x6111163, 0x6111172, 0x6111181, 0x6111217, 0x6111226, 0x6111235, 0x6111244,
+	0x6111253, 0x6111262, 0x6111271, 0x6111316, 0x6111325, 0x6111334, 0x6111343, 0x6111352,
+	0x6111361, 0x6111415, 0x6111424, 0x6111433, 0x6111442, 0x6111451, 0x6111514, 0x6111523,
+	0x6111532, 0x6111541, 0x6111613, 0x6111622, 0x6111631, 0x6111712, 0x6111721, 0x6111811,
+	0x6112117, 0x6112126, 0x6112135, 0x6112144, 0x6112153, 0x6112162, 0x6112171, 0x6112216,
+	0x6112225, 0x6112234, 0x6112243, 0x6112252, 0x6112261, 0x6112315, 0x6112324, 0x6112333,
+	0x6112342, 0x6112351, 0x6112414, 0x6112423, 0x6112432, 0x6112441, 0x6112513, 0x6112522,
+	0x6112531, 0x6112612, 0x6112621, 0x6112711, 0x6113116, 0x6113125, 0x6113134, 0x6113143,
+	0x6113152, 0x6113161, 0x6113215, 0x6113224, 0x6113233, 0x6113242, 0x6113251, 0x6113314,
+	0x6113323, 0x6113332, 0x6113341, 0x6113413, 0x6113422, 0x6113431, 0x6113512, 0x6113521,
+	0x6113611, 0x6114115, 0x6114124, 0x6114133, 0x6114142, 0x6114151, 0x6114214, 0x6114223,
+	0x6114232, 0x6114241, 0x6114313, 0x6114322, 0x6114331, 0x6114412, 0x6114421, 0x6114511,
+	0x6115114, 0x6115123, 0x6115132, 0x6115141, 0x6115213, 0x6115222, 0x6115231, 0x6115312,
+	0x6115321, 0x6115411, 0x6116113, 0x6116122, 0x6116131, 0x6116212, 0x6116221, 0x6116311,
+	0x6117112, 0x6117121, 0x6117211, 0x6118111, 0x6121117, 0x6121126, 0x6121135, 0x6121144,
+	0x6121153, 0x6121162, 0x6121171, 0x6121216, 0x6121225, 0x6121234, 0x6121243, 0x6121252,
+	0x6121261, 0x6121315, 0x6121324, 0x6121333, 0x6121342, 0x6121351, 0x6121414, 0x6121423,
+	0x6121432, 0x6121441, 0x6121513, 0x6121522, 0x6121531, 0x6121612, 0x6121621, 0x6121711,
+	0x6122116, 0x6122125, 0x6122134, 0x6122143, 0x6122152, 0x6122161, 0x6122215, 0x6122224,
+	0x6122233, 0x6122242, 0x6122251, 0x6122314, 0x6122323, 0x6122332, 0x6122341, 0x6122413,
+	0x6122422, 0x6122431, 0x6122512, 0x6122521, 0x6122611, 0x6123115, 0x6123124, 0x6123133,
+	0x6123142, 0x6123151, 0x6123214, 0x6123223, 0x6123232, 0x6123241, 0x6123313, 0x6123322,
+	0x6123331, 0x6123412, 0x6123421, 0x6123511, 0x6124114, 0x6124123, 0x6124132, 0x6124141,
+	0x6124213, 0x6124222, 0x6124231, 0x6124312, 0x6124321, 0x6124411, 0x6125113, 0x6125122,
+	0x6125131, 0x6125212, 0x6125221, 0x6125311, 0x6126112, 0x6126121, 0x6126211, 0x6127111,
+	0x6131116, 0x6131125, 0x6131134, 0x6131143, 0x6131152, 0x6131161, 0x6131215, 0x6131224,
+	0x6131233, 0x6131242, 0x6131251, 0x6131314, 0x6131323, 0x6131332, 0x6131341, 0x6131413,
+	0x6131422, 0x6131431, 0x6131512, 0x6131521, 0x6131611, 0x6132115, 0x6132124, 0x6132133,
+	0x6132142, 0x6132151, 0x6132214, 0x6132223, 0x6132232, 0x6132241, 0x6132313, 0x6132322,
+	0x6132331, 0x6132412, 0x6132421, 0x6132511, 0x6133114, 0x6133123, 0x6133132, 0x6133141,
+	0x6133213, 0x6133222, 0x6133231, 0x6133312, 0x6133321, 0x6133411, 0x6134113, 0x6134122,
+	0x6134131, 0x6134212, 0x6134221, 0x6134311, 0x6135112, 0x6135121, 0x6135211, 0x6136111,
+	0x6141115, 0x6141124, 0x6141133, 0x6141142, 0x6141151, 0x6141214, 0x6141223, 0x6141232,
+	0x6141241, 0x6141313, 0x6141322, 0x6141331, 0x6141412, 0x6141421, 0x6141511, 0x6142114,
+	0x6142123, 0x6142132, 0x6142141, 0x6142213, 0x6142222, 0x6142231, 0x6142312, 0x6142321,
+	0x6142411, 0x6143113, 0x6143122, 0x6143131, 0x6143212, 0x6143221, 0x6143311, 0x6144112,
+	0x6144121, 0x6144211, 0x6145111, 0x6151114, 0x6151123, 0x6151132, 0x6151141, 0x6151213,
+	0x6151222, 0x6151231, 0x6151312, 0x6151321, 0x6151411, 0x6152113, 0x6152122, 0x6152131,
+	0x6152212, 0x6152221, 0x6152311, 0x6153112, 0x6153121, 0x6153211, 0x6154111, 0x6161113,
+	0x6161122, 0x6161131, 0x6161212, 0x6161221, 0x6161311, 0x6162112, 0x6162121, 0x6162211,
+	0x6163111, 0x6171112, 0x6171121, 0x6171211, 0x6172111, 0x6181111, 0x6211117, 0x6211126,
+	0x6211135, 0x6211144, 0x6211153, 0x6211162, 0x6211171, 0x6211216, 0x6211225, 0x6211234,
+	0x6211243, 0x6211252, 0x6211261, 0x6211315, 0x6211324, 0x6211333, 0x6211342, 0x6211351,
+	0x6211414, 0x6211423, 0x6211432, 0x6211441, 0x6211513, 0x6211522, 0x6211531, 0x6211612,
+	0x6211621, 0x6211711, 0x6212116, 0x6212125, 0x6212134, 0x6212143, 0x6212152, 0x6212161,
+	0x6212215, 0x6212224, 0x6212233, 0x6212242, 0x6212251, 0x6212314, 0x6212323, 0x6212332,
+	0x6212341, 0x6212413, 0x6212422, 0x6212431, 0x6212512, 0x6212521, 0x6212611, 0x6213115,
+	0x6213124, 0x6213133, 0x6213142, 0x6213151, 0x6213214, 0x6213223, 0x6213232, 0x6213241,
+	0x6213313, 0x6213322, 0x6213331, 0x6213412, 0x6213421, 0x6213511, 0x6214114, 0x6214123,
+	0x6214132, 0x6214141, 0x6214213, 0x6214222, 0x6214231, 0x6214312, 0x6214321, 0x6214411,
+	0x6215113, 0x6215122, 0x6215131, 0x6215212, 0x6215221, 0x6215311, 0x6216112, 0x6216121,
+	0x6216211, 0x6217111, 0x6221116, 0x6221125, 0x6221134, 0x6221143, 0x6221152, 0x6221161,
+	0x6221215, 0x6221224, 0x6221233, 0x6221242, 0x6221251, 0x6221314, 0x6221323, 0x6221332,
+	0x6221341, 0x6221413, 0x6221422, 0x6221431, 0x6221512, 0x6221521, 0x6221611, 0x6222115,
+	0x6222124, 0x6222133, 0x6222142, 0x6222151, 0x6222214, 0x6222223, 0x6222232, 0x6222241,
+	0x6222313, 0x6222322, 0x6222331, 0x6222412, 0x6222421, 0x6222511, 0x6223114, 0x6223123,
+	0x6223132, 0x6223141, 0x6223213, 0x6223222, 0x6223231, 0x6223312, 0x6223321, 0x6223411,
+	0x6224113, 0x6224122, 0x6224131, 0x6224212, 0x6224221, 0x6224311, 0x6225112, 0x6225121,
+	0x6225211, 0x6226111, 0x6231115, 0x6231124, 0x6231133, 0x6231142, 0x6231151, 0x6231214,
+	0x6231223, 0x6231232, 0x6231241, 0x6231313, 0x6231322, 0x6231331, 0x6231412, 0x6231421,
+	0x6231511, 0x6232114, 0x6232123, 0x6232132, 0x6232141, 0x6232213, 0x6232222, 0x6232231,
+	0x6232312, 0x6232321, 0x6232411, 0x6233113, 0x6233122, 0x6233131, 0x6233212, 0x6233221,
+	0x6233311, 0x6234112, 0x6234121, 0x6234211, 0x6235111, 0x6241114, 0x6241123, 0x6241132,
+	0x6241141, 0x6241213, 0x6241222, 0x6241231, 0x6241312, 0x6241321, 0x6241411, 0x6242113,
+	0x6242122, 0x6242131, 0x6242212, 0x6242221, 0x6242311, 0x6243112, 0x6243121, 0x6243211,
+	0x6244111, 0x6251113, 0x6251122, 0x6251131, 0x6251212, 0x6251221, 0x6251311, 0x6252112,
+	0x6252121, 0x6252211, 0x6253111, 0x6261112, 0x6261121, 0x6261211, 0x6262111, 0x6271111,
+	0x6311116, 0x6311125, 0x6311134, 0x6311143, 0x6311152, 0x6311161, 0x6311215, 0x6311224,
+	0x6311233, 0x6311242, 0x6311251, 0x6311314, 0x6311323, 0x6311332, 0x6311341, 0x6311413,
+	0x6311422, 0x6311431, 0x6311512, 0x6311521, 0x6311611, 0x6312115, 0x6312124, 0x6312133,
+	0x6312142, 0x6312151, 0x6312214, 0x6312223, 0x6312232, 0x6312241, 0x6312313, 0x6312322,
+	0x6312331, 0x6312412, 0x6312421, 0x6312511, 0x6313114, 0x6313123, 0x6313132, 0x6313141,
+	0x6313213, 0x6313222, 0x6313231, 0x6313312, 0x6313321, 0x6313411, 0x6314113, 0x6314122,
+	0x6314131, 0x6314212, 0x6314221, 0x6314311, 0x6315112, 0x6315121, 0x6315211, 0x6316111,
+	0x6321115, 0x6321124, 0x6321133, 0x6321142, 0x6321151, 0x6321214, 0x6321223, 0x6321232,
+	0x6321241, 0x6321313, 0x6321322, 0x6321331, 0x6321412, 0x6321421, 0x6321511, 0x6322114,
+	0x6322123, 0x6322132, 0x6322141, 0x6322213, 0x6322222, 0x6322231, 0x6322312, 0x6322321,
+	0x6322411, 0x6323113, 0x6323122, 0x6323131, 0x6323212, 0x6323221, 0x6323311, 0x6324112,
+	0x6324121, 0x6324211, 0x6325111, 0x6331114, 0x6331123, 0x6331132, 0x6331141, 0x6331213,
+	0x6331222, 0x6331231, 0x6331312, 0x6331321, 0x6331411, 0x6332113, 0x6332122, 0x6332131,
+	0x6332212, 0x6332221, 0x6332311, 0x6333112, 0x6333121, 0x6333211, 0x6334111, 0x6341113,
+	0x6341122, 0x6341131, 0x6341212, 0x6341221, 0x6341311, 0x6342112, 0x6342121, 0x6342211,
+	0x6343111, 0x6351112, 0x6351121, 0x6351211, 0x6352111, 0x6361111, 0x6411115, 0x6411124,
+	0x6411133, 0x6411142, 0x6411151, 0x6411214, 0x6411223, 0x6411232, 0x6411241, 0x6411313,
+	0x6411322, 0x6411331, 0x6411412, 0x6411421, 0x6411511, 0x6412114, 0x6412123, 0x6412132,
+	0x6412141, 0x6412213, 0x6412222, 0x6412231, 0x6412312, 0x6412321, 0x6412411, 0x6413113,
+	0x6413122, 0x6413131, 0x6413212, 0x6413221, 0x6413311, 0x6414112, 0x6414121, 0x6414211,
+	0x6415111, 0x6421114, 0x6421123, 0x6421132, 0x6421141, 0x6421213, 0x6421222, 0x6421231,
+	0x6421312, 0x6421321, 0x6421411, 0x6422113, 0x6422122, 0x6422131, 0x6422212, 0x6422221,
+	0x6422311, 0x6423112, 0x6423121, 0x6423211, 0x6424111, 0x6431113, 0x6431122, 0x6431131,
+	0x6431212, 0x6431221, 0x6431311, 0x6432112, 0x6432121, 0x6432211, 0x6433111, 0x6441112,
+	0x6441121, 0x6441211, 0x6442111, 0x6451111, 0x6511114, 0x6511123, 0x6511132, 0x6511141,
+	0x6511213, 0x6511222, 0x6511231, 0x6511312, 0x6511321, 0x6511411, 0x6512113, 0x6512122,
+	0x6512131, 0x6512212, 0x6512221, 0x6512311, 0x6513112, 0x6513121, 0x6513211, 0x6514111,
+	0x6521113, 0x6521122, 0x6521131, 0x6521212, 0x6521221, 0x6521311, 0x6522112, 0x6522121,
+	0x6522211, 0x6523111, 0x6531112, 0x6531121, 0x6531211, 0x6532111, 0x6541111, 0x6611113,
+	0x6611122, 0x6611131, 0x6611212, 0x6611221, 0x6611311, 0x6612112, 0x6612121, 0x6612211,
+	0x6613111, 0x6621112, 0x6621121, 0x6621211, 0x6622111, 0x6631111, 0x6711112, 0x6711121,
+	0x6711211, 0x6712111, 0x6721111, 0x6811111, 0x7111117, 0x7111126, 0x7111135, 0x7111144,
+	0x7111153, 0x7111162, 0x7111171, 0x7111216, 0x7111225, 0x7111234, 0x7111243, 0x7111252,
+	0x7111261, 0x7111315, 0x7111324, 0x7111333, 0x7111342, 0x7111351, 0x7111414, 0x7111423,
+	0x7111432, 0x7111441, 0x7111513, 0x7111522, 0x7111531, 0x7111612, 0x7111621, 0x7111711,
+	0x7112116, 0x7112125, 0x7112134, 0x7112143, 0x7112152, 0x7112161, 0x7112215, 0x7112224,
+	0x7112233, 0x7112242, 0x7112251, 0x7112314, 0x7112323, 0x7112332, 0x7112341, 0x7112413,
+	0x7112422, 0x7112431, 0x7112512, 0x7112521, 0x7112611, 0x7113115, 0x7113124, 0x7113133,
+	0x7113142, 0x7113151, 0x7113214, 0x7113223, 0x7113232, 0x7113241, 0x7113313, 0x7113322,
+	0x7113331, 0x7113412, 0x7113421, 0x7113511, 0x7114114, 0x7114123, 0x7114132, 0x7114141,
+	0x7114213, 0x7114222, 0x7114231, 0x7114312, 0x7114321, 0x7114411, 0x7115113, 0x7115122,
+	0x7115131, 0x7115212, 0x7115221, 0x7115311, 0x7116112, 0x7116121, 0x7116211, 0x7117111,
+	0x7121116, 0x7121125, 0x7121134, 0x7121143, 0x7121152, 0x7121161, 0x7121215, 0x7121224,
+	0x7121233, 0x7121242, 0x7121251, 0x7121314, 0x7121323, 0x7121332, 0x7121341, 0x7121413,
+	0x7121422, 0x7121431, 0x7121512, 0x7121521, 0x7121611, 0x7122115, 0x7122124, 0x7122133,
+	0x7122142, 0x7122151, 0x7122214, 0x7122223, 0x7122232, 0x7122241, 0x7122313, 0x7122322,
+	0x7122331, 0x7122412, 0x7122421, 0x7122511, 0x7123114, 0x7123123, 0x7123132, 0x7123141,
+	0x7123213, 0x7123222, 0x7123231, 0x7123312, 0x7123321, 0x7123411, 0x7124113, 0x7124122,
+	0x7124131, 0x7124212, 0x7124221, 0x7124311, 0x7125112, 0x7125121, 0x7125211, 0x7126111,
+	0x7131115, 0x7131124, 0x7131133, 0x7131142, 0x7131151, 0x7131214, 0x7131223, 0x7131232,
+	0x7131241, 0x7131313, 0x7131322, 0x7131331, 0x7131412, 0x7131421, 0x7131511, 0x7132114,
+	0x7132123, 0x7132132, 0x7132141, 0x7132213, 0x7132222, 0x7132231, 0x7132312, 0x7132321,
+	0x7132411, 0x7133113, 0x7133122, 0x7133131, 0x7133212, 0x7133221, 0x7133311, 0x7134112,
+	0x7134121, 0x7134211, 0x7135111, 0x7141114, 0x7141123, 0x7141132, 0x7141141, 0x7141213,
+	0x7141222, 0x7141231, 0x7141312, 0x7141321, 0x7141411, 0x7142113, 0x7142122, 0x7142131,
+	0x7142212, 0x7142221, 0x7142311, 0x7143112, 0x7143121, 0x7143211, 0x7144111, 0x7151113,
+	0x7151122, 0x7151131, 0x7151212, 0x7151221, 0x7151311, 0x7152112, 0x7152121, 0x7152211,
+	0x7153111, 0x7161112, 0x7161121, 0x7161211, 0x7162111, 0x7171111, 0x7211116, 0x7211125,
+	0x7211134, 0x7211143, 0x7211152, 0x7211161, 0x7211215, 0x7211224, 0x7211233, 0x7211242,
+	0x7211251, 0x7211314, 0x7211323, 0x7211332, 0x7211341, 0x7211413, 0x7211422, 0x7211431,
+	0x7211512, 0x7211521, 0x7211611, 0x7212115, 0x7212124, 0x7212133, 0x7212142, 0x7212151,
+	0x7212214, 0x7212223, 0x7212232, 0x7212241, 0x7212313, 0x7212322, 0x7212331, 0x7212412,
+	0x7212421, 0x7212511, 0x7213114, 0x7213123, 0x7213132, 0x7213141, 0x7213213, 0x7213222,
+	0x7213231, 0x7213312, 0x7213321, 0x7213411, 0x7214113, 0x7214122, 0x7214131, 0x7214212,
+	0x7214221, 0x7214311, 0x7215112, 0x7215121, 0x7215211, 0x7216111, 0x7221115, 0x7221124,
+	0x7221133, 0x7221142, 0x7221151, 0x7221214, 0x7221223, 0x7221232, 0x7221241, 0x7221313,
+	0x7221322, 0x7221331, 0x7221412, 0x7221421, 0x7221511, 0x7222114, 0x7222123, 0x7222132,
+	0x7222141, 0x7222213, 0x7222222, 0x7222231, 0x7222312, 0x7222321, 0x7222411, 0x7223113,
+	0x7223122, 0x7223131, 0x7223212, 0x7223221, 0x7223311, 0x7224112, 0x7224121, 0x7224211,
+	0x7225111, 0x7231114, 0x7231123, 0x7231132, 0x7231141, 0x7231213, 0x7231222, 0x7231231,
+	0x7231312, 0x7231321, 0x7231411, 0x7232113, 0x7232122, 0x7232131, 0x7232212, 0x7232221,
+	0x7232311, 0x7233112, 0x7233121, 0x7233211, 0x7234111, 0x7241113, 0x7241122, 0x7241131,
+	0x7241212, 0x7241221, 0x7241311, 0x7242112, 0x7242121, 0x7242211, 0x7243111, 0x7251112,
+	0x7251121, 0x7251211, 0x7252111, 0x7261111, 0x7311115, 0x7311124, 0x7311133, 0x7311142,
+	0x7311151, 0x7311214, 0x7311223, 0x7311232, 0x7311241, 0x7311313, 0x7311322, 0x7311331,
+	0x7311412, 0x7311421, 0x7311511, 0x7312114, 0x7312123, 0x7312132, 0x7312141, 0x7312213,
+	0x7312222, 0x7312231, 0x7312312, 0x7312321, 0x7312411, 0x7313113, 0x7313122, 0x7313131,
+	0x7313212, 0x7313221, 0x7313311, 0x7314112, 0x7314121, 0x7314211, 0x7315111, 0x7321114,
+	0x7321123, 0x7321132, 0x7321141, 0x7321213, 0x7321222, 0x7321231, 0x7321312, 0x7321321,
+	0x7321411, 0x7322113, 0x7322122, 0x7322131, 0x7322212, 0x7322221, 0x7322311, 0x7323112,
+	0x7323121, 0x7323211, 0x7324111, 0x7331113, 0x7331122, 0x7331131, 0x7331212, 0x7331221,
+	0x7331311, 0x7332112, 0x7332121, 0x7332211, 0x7333111, 0x7341112, 0x7341121, 0x7341211,
+	0x7342111, 0x7351111, 0x7411114, 0x7411123, 0x7411132, 0x7411141, 0x7411213, 0x7411222,
+	0x7411231, 0x7411312, 0x7411321, 0x7411411, 0x7412113, 0x7412122, 0x7412131, 0x7412212,
+	0x7412221, 0x7412311, 0x7413112, 0x7413121, 0x7413211, 0x7414111, 0x7421113, 0x7421122,
+	0x7421131, 0x7421212, 0x7421221, 0x7421311, 0x7422112, 0x7422121, 0x7422211, 0x7423111,
+	0x7431112, 0x7431121, 0x7431211, 0x7432111, 0x7441111, 0x7511113, 0x7511122, 0x7511131,
+	0x7511212, 0x7511221, 0x7511311, 0x7512112, 0x7512121, 0x7512211, 0x7513111, 0x7521112,
+	0x7521121, 0x7521211, 0x7522111, 0x7531111, 0x7611112, 0x7611121, 0x7611211, 0x7612111,
+	0x7621111, 0x7711111, 0x8111116, 0x8111125, 0x8111134, 0x8111143, 0x8111152, 0x8111161,
+	0x8111215, 0x8111224, 0x8111233, 0x8111242, 0x8111251, 0x8111314, 0x8111323, 0x8111332,
+	0x8111341, 0x8111413, 0x8111422, 0x8111431, 0x8111512, 0x8111521, 0x8111611, 0x8112115,
+	0x8112124, 0x8112133, 0x8112142, 0x8112151, 0x8112214, 0x8112223, 0x8112232, 0x8112241,
+	0x8112313, 0x8112322, 0x8112331, 0x8112412, 0x8112421, 0x8112511, 0x8113114, 0x8113123,
+	0x8113132, 0x8113141, 0x8113213, 0x8113222, 0x8113231, 0x8113312, 0x8113321, 0x8113411,
+	0x8114113, 0x8114122, 0x8114131, 0x8114212, 0x8114221, 0x8114311, 0x8115112, 0x8115121,
+	0x8115211, 0x8116111, 0x8121115, 0x8121124, 0x8121133, 0x8121142, 0x8121151, 0x8121214,
+	0x8121223, 0x8121232, 0x8121241, 0x8121313, 0x8121322, 0x8121331, 0x8121412, 0x8121421,
+	0x8121511, 0x8122114, 0x8122123, 0x8122132, 0x8122141, 0x8122213, 0x8122222, 0x8122231,
+	0x8122312, 0x8122321, 0x8122411, 0x8123113, 0x8123122, 0x8123131, 0x8123212, 0x8123221,
+	0x8123311, 0x8124112, 0x8124121, 0x8124211, 0x8125111, 0x8131114, 0x8131123, 0x8131132,
+	0x8131141, 0x8131213, 0x8131222, 0x8131231, 0x8131312, 0x8131321, 0x8131411, 0x8132113,
+	0x8132122, 0x8132131, 0x8132212, 0x8132221, 0x8132311, 0x8133112, 0x8133121, 0x8133211,
+	0x8134111, 0x8141113, 0x8141122, 0x8141131, 0x8141212, 0x8141221, 0x8141311, 0x8142112,
+	0x8142121, 0x8142211, 0x8143111, 0x8151112, 0x8151121, 0x8151211, 0x8152111, 0x8161111,
+	0x8211115, 0x8211124, 0x8211133, 0x8211142, 0x8211151, 0x8211214, 0x8211223, 0x8211232,
+	0x8211241, 0x8211313, 0x8211322, 0x8211331, 0x8211412, 0x8211421, 0x8211511, 0x8212114,
+	0x8212123, 0x8212132, 0x8212141, 0x8212213, 0x8212222, 0x8212231, 0x8212312, 0x8212321,
+	0x8212411, 0x8213113, 0x8213122, 0x8213131, 0x8213212, 0x8213221, 0x8213311, 0x8214112,
+	0x8214121, 0x8214211, 0x8215111, 0x8221114, 0x8221123, 0x8221132, 0x8221141, 0x8221213,
+	0x8221222, 0x8221231, 0x8221312, 0x8221321, 0x8221411, 0x8222113, 0x8222122, 0x8222131,
+	0x8222212, 0x8222221, 0x8222311, 0x8223112, 0x8223121, 0x8223211, 0x8224111, 0x8231113,
+	0x8231122, 0x8231131, 0x8231212, 0x8231221, 0x8231311, 0x8232112, 0x8232121, 0x8232211,
+	0x8233111, 0x8241112, 0x8241121, 0x8241211, 0x8242111, 0x8251111, 0x8311114, 0x8311123,
+	0x8311132, 0x8311141, 0x8311213, 0x8311222, 0x8311231, 0x8311312, 0x8311321, 0x8311411,
+	0x8312113, 0x8312122, 0x8312131, 0x8312212, 0x8312221, 0x8312311, 0x8313112, 0x8313121,
+	0x8313211, 0x8314111, 0x8321113, 0x8321122, 0x8321131, 0x8321212, 0x8321221, 0x8321311,
+	0x8322112, 0x8322121, 0x8322211, 0x8323111, 0x8331112, 0x8331121, 0x8331211, 0x8332111,
+	0x8341111, 0x8411113, 0x8411122, 0x8411131, 0x8411212, 0x8411221, 0x8411311, 0x8412112,
+	0x8412121, 0x8412211, 0x8413111, 0x8421112, 0x8421121, 0x8421211, 0x8422111, 0x8431111,
+	0x8511112, 0x8511121, 0x8511211, 0x8512111, 0x8521111, 0x8611111, 0x1111111, 0x1111111,
+	0x1111168, 0x1111177, 0x1111186, 0x1111258, 0x1111267, 0x1111276, 0x1111285, 0x1111348,
+	0x1111357, 0x1111366, 0x1111375, 0x1111384, 0x1111438, 0x1111447, 0x1111456, 0x1111465,
+	0x1111474, 0x1111483, 0x1111528, 0x1111537, 0x1111546, 0x1111555, 0x1111564, 0x1111573,
+	0x1111582, 0x1111618, 0x1111627, 0x1111636, 0x1111645, 0x1111654, 0x1111663, 0x1111672,
+	0x1111681, 0x1111717, 0x1111726, 0x1111735, 0x1111744, 0x1111753, 0x1111762, 0x1111771,
+	0x1111816, 0x1111825, 0x1111834, 0x1111843, 0x1111852, 0x1111861, 0x1112158, 0x1112167,
+	0x1112176, 0x1112185, 0x1112248, 0x1112257, 0x1112266, 0x1112275, 0x1112284, 0x1112338,
+	0x1112347, 0x1112356, 0x1112365, 0x1112374, 0x1112383, 0x1112428, 0x1112437, 0x1112446,
+	0x1112455, 0x1112464, 0x1112473, 0x1112482, 0x1112518, 0x1112527, 0x1112536, 0x1112545,
+	0x1112554, 0x1112563, 0x1112572, 0x1112581, 0x1112617, 0x1112626, 0x1112635, 0x1112644,
+	0x1112653, 0x1112662, 0x1112671, 0x1112716, 0x1112725, 0x1112734, 0x1112743, 0x1112752,
+	0x1112761, 0x1112815, 0x1112824, 0x1112833, 0x1112842, 0x1112851, 0x1113148, 0x1113157,
+	0x1113166, 0x1113175, 0x1113184, 0x1113238, 0x1113247, 0x1113256, 0x1113265, 0x1113274,
+	0x1113283, 0x1113328, 0x1113337, 0x1113346, 0x1113355, 0x1113364, 0x1113373, 0x1113382,
+	0x1113418, 0x1113427, 0x1113436, 0x1113445, 0x1113454, 0x1113463, 0x1113472, 0x1113481,
+	0x1113517, 0x1113526, 0x1113535, 0x1113544, 0x1113553, 0x1113562, 0x1113571, 0x1113616,
+	0x1113625, 0x1113634, 0x1113643, 0x1113652, 0x1113661, 0x1113715, 0x1113724, 0x1113733,
+	0x1113742, 0x1113751, 0x1113814, 0x1113823, 0x1113832, 0x1113841, 0x1114138, 0x1114147,
+	0x1114156, 0x1114165, 0x1114174, 0x1114183, 0x1114228, 0x1114237, 0x1114246, 0x1114255,
+	0x1114264, 0x1114273, 0x1114282, 0x1114318, 0x1114327, 0x1114336, 0x1114345, 0x1114354,
+	0x1114363, 0x1114372, 0x1114381, 0x1114417, 0x1114426, 0x1114435, 0x1114444, 0x1114453,
+	0x1114462, 0x1114471, 0x1114516, 0x1114525, 0x1114534, 0x1114543, 0x1114552, 0x1114561,
+	0x1114615, 0x1114624, 0x1114633, 0x1114642, 0x1114651, 0x1114714, 0x1114723, 0x1114732,
+	0x1114741, 0x1114813, 0x1114822, 0x1114831, 0x1115128, 0x1115137, 0x1115146, 0x1115155,
+	0x1115164, 0x1115173, 0x1115182, 0x1115218, 0x1115227, 0x1115236, 0x1115245, 0x1115254,
+	0x1115263, 0x1115272, 0x1115281, 0x1115317, 0x1115326, 0x1115335, 0x1115344, 0x1115353,
+	0x1115362, 0x1115371, 0x1115416, 0x1115425, 0x1115434, 0x1115443, 0x1115452, 0x1115461,
+	0x1115515, 0x1115524, 0x1115533, 0x1115542, 0x1115551, 0x1115614, 0x1115623, 0x1115632,
+	0x1115641, 0x1115713, 0x1115722, 0x1115731, 0x1115812, 0x1115821, 0x1116118, 0x1116127,
+	0x1116136, 0x1116145, 0x1116154, 0x1116163, 0x1116172, 0x1116181, 0x1116217, 0x1116226,
+	0x1116235, 0x1116244, 0x1116253, 0x1116262, 0x1116271, 0x1116316, 0x1116325, 0x1116334,
+	0x1116343, 0x1116352, 0x1116361, 0x1116415, 0x1116424, 0x1116433, 0x1116442, 0x1116451,
+	0x1116514, 0x1116523, 0x1116532, 0x1116541, 0x1116613, 0x1116622, 0x1116631, 0x1116712,
+	0x1116721, 0x1116811, 0x1117117, 0x1117126, 0x1117135, 0x1117144, 0x1117153, 0x1117162,
+	0x1117171, 0x1117216, 0x1117225, 0x1117234, 0x1117243, 0x1117252, 0x1117261, 0x1117315,
+	0x1117324, 0x1117333, 0x1117342, 0x1117351, 0x1117414, 0x1117423, 0x1117432, 0x1117441,
+	0x1117513, 0x1117522, 0x1117531, 0x1117612, 0x1117621, 0x1117711, 0x1118116, 0x1118125,
+	0x1118134, 0x1118143, 0x1118152, 0x1118161, 0x1118215, 0x1118224, 0x1118233, 0x1118242,
+	0x1118251, 0x1118314, 0x1118323, 0x1118332, 0x1118341, 0x1118413, 0x1118422, 0x1118431,
+	0x1118512, 0x1118521, 0x1118611, 0x1121158, 0x1121167, 0x1121176, 0x1121185, 0x1121248,
+	0x1121257, 0x1121266, 0x1121275, 0x1121284, 0x1121338, 0x1121347, 0x1121356, 0x1121365,
+	0x1121374, 0x1121383, 0x1121428, 0x1121437, 0x1121446, 0x1121455, 0x1121464, 0x1121473,
+	0x1121482, 0x1121518, 0x1121527, 0x1121536, 0x1121545, 0x1121554, 0x1121563, 0x1121572,
+	0x1121581, 0x1121617, 0x1121626, 0x1121635, 0x1121644, 0x1121653, 0x1121662, 0x1121671,
+	0x1121716, 0x1121725, 0x1121734, 0x1121743, 0x1121752, 0x1121761, 0x1121815, 0x1121824,
+	0x1121833, 0x1121842, 0x1121851, 0x1122148, 0x1122157, 0x1122166, 0x1122175, 0x1122184,
+	0x1122238, 0x1122247, 0x1122256, 0x1122265, 0x1122274, 0x1122283, 0x1122328, 0x1122337,
+	0x1122346, 0x1122355, 0x1122364, 0x1122373, 0x1122382, 0x1122418, 0x1122427, 0x1122436,
+	0x1122445, 0x1122454, 0x1122463, 0x1122472, 0x1122481, 0x1122517, 0x1122526, 0x1122535,
+	0x1122544, 0x1122553, 0x1122562, 0x1122571, 0x1122616, 0x1122625, 0x1122634, 0x1122643,
+	0x1122652, 0x1122661, 0x1122715, 0x1122724, 0x1122733, 0x1122742, 0x1122751, 0x1122814,
+	0x1122823, 0x1122832, 0x1122841, 0x1123138, 0x1123147, 0x1123156, 0x1123165, 0x1123174,
+	0x1123183, 0x1123228, 0x1123237, 0x1123246, 0x1123255, 0x1123264, 0x1123273, 0x1123282,
+	0x1123318, 0x1123327, 0x1123336, 0x1123345, 0x1123354, 0x1123363, 0x1123372, 0x1123381,
+	0x1123417, 0x1123426, 0x1123435, 0x1123444, 0x1123453, 0x1123462, 0x1123471, 0x1123516,
+	0x1123525, 0x1123534, 0x1123543, 0x1123552, 0x1123561, 0x1123615, 0x1123624, 0x1123633,
+	0x1123642, 0x1123651, 0x1123714, 0x1123723, 0x1123732, 0x1123741, 0x1123813, 0x1123822,
+	0x1123831, 0x1124128, 0x1124137, 0x1124146, 0x1124155, 0x1124164, 0x1124173, 0x1124182,
+	0x1124218, 0x1124227, 0x1124236, 0x1124245, 0x1124254, 0x1124263, 0x1124272, 0x1124281,
+	0x1124317, 0x1124326, 0x1124335, 0x1124344, 0x1124353, 0x1124362, 0x1124371, 0x1124416,
+	0x1124425, 0x1124434, 0x1124443, 0x1124452, 0x1124461, 0x1124515, 0x1124524, 0x1124533,
+	0x1124542, 0x1124551, 0x1124614, 0x1124623, 0x1124632, 0x1124641, 0x1124713, 0x1124722,
+	0x1124731, 0x1124812, 0x1124821, 0x1125118, 0x1125127, 0x1125136, 0x1125145, 0x1125154,
+	0x1125163, 0x1125172, 0x1125181, 0x1125217, 0x1125226, 0x1125235, 0x1125244, 0x1125253,
+	0x1125262, 0x1125271, 0x1125316, 0x1125325, 0x1125334, 0x1125343, 0x1125352, 0x1125361,
+	0x1125415, 0x1125424, 0x1125433, 0x1125442, 0x1125451, 0x1125514, 0x1125523, 0x1125532,
+	0x1125541, 0x1125613, 0x1125622, 0x1125631, 0x1125712, 0x1125721, 0x1125811, 0x1126117,
+	0x1126126, 0x1126135, 0x1126144, 0x1126153, 0x1126162, 0x1126171, 0x1126216, 0x1126225,
+	0x1126234, 0x1126243, 0x1126252, 0x1126261, 0x1126315, 0x1126324, 0x1126333, 0x1126342,
+	0x1126351, 0x1126414, 0x1126423, 0x1126432, 0x1126441, 0x1126513, 0x1126522, 0x1126531,
+	0x1126612, 0x1126621, 0x1126711, 0x1127116, 0x1127125, 0x1127134, 0x1127143, 0x1127152,
+	0x1127161, 0x1127215, 0x1127224, 0x1127233, 0x1127242, 0x1127251, 0x1127314, 0x1127323,
+	0x1127332, 0x1127341, 0x1127413, 0x1127422, 0x1127431, 0x1127512, 0x1127521, 0x1127611,
+	0x1128115, 0x1128124, 0x1128133, 0x1128142, 0x1128151, 0x1128214, 0x1128223, 0x1128232,
+	0x1128241, 0x1128313, 0x1128322, 0x1128331, 0x1128412, 0x1128421, 0x1128511, 0x1131148,
+	0x1131157, 0x1131166, 0x1131175, 0x1131184, 0x1131238, 0x1131247, 0x1131256, 0x1131265,
+	0x1131274, 0x1131283, 0x1131328, 0x1131337, 0x1131346, 0x1131355, 0x1131364, 0x1131373,
+	0x1131382, 0x1131418, 0x1131427, 0x1131436, 0x1131445, 0x1131454, 0x1131463, 0x1131472,
+	0x1131481, 0x1131517, 0x1131526, 0x1131535, 0x1131544, 0x1131553, 0x1131562, 0x1131571,
+	0x1131616, 0x1131625, 0x1131634, 0x1131643, 0x1131652, 0x1131661, 0x1131715, 0x1131724,
+	0x1131733, 0x1131742, 0x1131751, 0x1131814, 0x1131823, 0x1131832, 0x1131841, 0x1132138,
+	0x1132147, 0x1132156, 0x1132165, 0x1132174, 0x1132183, 0x1132228, 0x1132237, 0x1132246,
+	0x1132255, 0x1132264, 0x1132273, 0x1132282, 0x1132318, 0x1132327, 0x1132336, 0x1132345,
+	0x1132354, 0x1132363, 0x1132372, 0x1132381, 0x1132417, 0x1132426, 0x1132435, 0x1132444,
+	0x1132453, 0x1132462, 0x1132471, 0x1132516, 0x1132525, 0x1132534, 0x1132543, 0x1132552,
+	0x1132561, 0x1132615, 0x1132624, 0x1132633, 0x1132642, 0x1132651, 0x1132714, 0x1132723,
+	0x1132732, 0x1132741, 0x1132813, 0x1132822, 0x1132831, 0x1133128, 0x1133137, 0x1133146,
+	0x1133155, 0x1133164, 0x1133173, 0x1133182, 0x1133218, 0x1133227, 0x1133236, 0x1133245,
+	0x1133254, 0x1133263, 0x1133272, 0x1133281, 0x1133317, 0x1133326, 0x1133335, 0x1133344,
+	0x1133353, 0x1133362, 0x1133371, 0x1133416, 0x1133425, 0x1133434, 0x1133443, 0x1133452,
+	0x1133461, 0x1133515, 0x1133524, 0x1133533, 0x1133542, 0x1133551, 0x1133614, 0x1133623,
+	0x1133632, 0x1133641, 0x1133713, 0x1133722, 0x1133731, 0x1133812, 0x1133821, 0x1134118,
+	0x1134127, 0x1134136, 0x1134145, 0x1134154, 0x1134163, 0x1134172, 0x1134181, 0x1134217,
+	0x1134226, 0x1134235, 0x1134244, 0x1134253, 0x1134262, 0x1134271, 0x1134316, 0x1134325,
+	0x1134334, 0x1134343, 0x1134352, 0x1134361, 0x1134415, 0x1134424, 0x1134433, 0x1134442,
+	0x1134451, 0x1134514, 0x1134523, 0x1134532, 0x1134541, 0x1134613, 0x1134622, 0x1134631,
+	0x1134712, 0x1134721, 0x1134811, 0x1135117, 0x1135126, 0x1135135, 0x1135144, 0x1135153,
+	0x1135162, 0x1135171, 0x1135216, 0x1135225, 0x1135234, 0x1135243, 0x1135252, 0x1135261,
+	0x1135315, 0x1135324, 0x1135333, 0x1135342, 0x1135351, 0x1135414, 0x1135423, 0x1135432,
+	0x1135441, 0x1135513, 0x1135522, 0x1135531, 0x1135612, 0x1135621, 0x1135711, 0x1136116,
+	0x1136125, 0x1136134, 0x1136143, 0x1136152, 0x1136161, 0x1136215, 0x1136224, 0x1136233,
+	0x1136242, 0x1136251, 0x1136314, 0x1136323, 0x1136332, 0x1136341, 0x1136413, 0x1136422,
+	0x1136431, 0x1136512, 0x1136521, 0x1136611, 0x1137115, 0x1137124, 0x1137133, 0x1137142,
+	0x1137151, 0x1137214, 0x1137223, 0x1137232, 0x1137241, 0x1137313, 0x1137322, 0x1137331,
+	0x1137412, 0x1137421, 0x1137511, 0x1138114, 0x1138123, 0x1138132, 0x1138141, 0x1138213,
+	0x1138222, 0x1138231, 0x1138312, 0x1138321, 0x1138411, 0x1141138, 0x1141147, 0x1141156,
+	0x1141165, 0x1141174, 0x1141183, 0x1141228, 0x1141237, 0x1141246, 0x1141255, 0x1141264,
+	0x1141273, 0x1141282, 0x1141318, 0x1141327, 0x1141336, 0x1141345, 0x1141354, 0x1141363,
+	0x1141372, 0x1141381, 0x1141417, 0x1141426, 0x1141435, 0x1141444, 0x1141453, 0x1141462,
+	0x1141471, 0x1141516, 0x1141525, 0x1141534, 0x1141543, 0x1141552, 0x1141561, 0x1141615,
+	0x1141624, 0x1141633, 0x1141642, 0x1141651, 0x1141714, 0x1141723, 0x1141732, 0x1141741,
+	0x1141813, 0x1141822, 0x1141831, 0x1142128, 0x1142137, 0x1142146, 0x1142155, 0x1142164,
+	0x1142173, 0x1142182, 0x1142218, 0x1142227, 0x1142236, 0x1142245, 0x1142254, 0x1142263,
+	0x1142272, 0x1142281, 0x1142317, 0x1142326, 0x1142335, 0x1142344, 0x1142353, 0x1142362,
+	0x1142371, 0x1142416, 0x1142425, 0x1142434, 0x1142443, 0x1142452, 0x1142461, 0x1142515,
+	0x1142524, 0x1142533, 0x1142542, 0x1142551, 0x1142614, 0x1142623, 0x1142632, 0x1142641,
+	0x1142713, 0x1142722, 0x1142731, 0x1142812, 0x1142821, 0x1143118, 0x1143127, 0x1143136,
+	0x1143145, 0x1143154, 0x1143163, 0x1143172, 0x1143181, 0x1143217, 0x1143226, 0x1143235,
+	0x1143244, 0x1143253, 0x1143262, 0x1143271, 0x1143316, 0x1143325, 0x1143334, 0x1143343,
+	0x1143352, 0x1143361, 0x1143415, 0x1143424, 0x1143433, 0x1143442, 0x1143451, 0x1143514,
+	0x1143523, 0x1143532, 0x1143541, 0x1143613, 0x1143622, 0x1143631, 0x1143712, 0x1143721,
+	0x1143811, 0x1144117, 0x1144126, 0x1144135, 0x1144144, 0x1144153, 0x1144162, 0x1144171,
+	0x1144216, 0x1144225, 0x1144234, 0x1144243, 0x1144252, 0x1144261, 0x1144315, 0x1144324,
+	0x1144333, 0x1144342, 0x1144351, 0x1144414, 0x1144423, 0x1144432, 0x1144441, 0x1144513,
+	0x1144522, 0x1144531, 0x1144612, 0x1144621, 0x1144711, 0x1145116, 0x1145125, 0x1145134,
+	0x1145143, 0x1145152, 0x1145161, 0x1145215, 0x1145224, 0x1145233, 0x1145242, 0x1145251,
+	0x1145314, 0x1145323, 0x1145332, 0x1145341, 0x1145413, 0x1145422, 0x1145431, 0x1145512,
+	0x1145521, 0x1145611, 0x1146115, 0x1146124, 0x1146133, 0x1146142, 0x1146151, 0x1146214,
+	0x1146223, 0x1146232, 0x1146241, 0x1146313, 0x1146322, 0x1146331, 0x1146412, 0x1146421,
+	0x1146511, 0x1147114, 0x1147123, 0x1147132, 0x1147141, 0x1147213, 0x1147222, 0x1147231,
+	0x1147312, 0x1147321, 0x1147411, 0x1148113, 0x1148122, 0x1148131, 0x1148212, 0x1148221,
+	0x1148311, 0x1151128, 0x1151137, 0x1151146, 0x1151155, 0x1151164, 0x1151173, 0x1151182,
+	0x1151218, 0x1151227, 0x1151236, 0x1151245, 0x1151254, 0x1151263, 0x1151272, 0x1151281,
+	0x1151317, 0x1151326, 0x1151335, 0x1151344, 0x1151353, 0x1151362, 0x1151371, 0x1151416,
+	0x1151425, 0x1151434, 0x1151443, 0x1151452, 0x1151461, 0x1151515, 0x1151524, 0x1151533,
+	0x1151542, 0x1151551, 0x1151614, 0x1151623, 0x1151632, 0x1151641, 0x1151713, 0x1151722,
+	0x1151731, 0x1151812, 0x1151821, 0x1152118, 0x1152127, 0x1152136, 0x1152145, 0x1152154,
+	0x1152163, 0x1152172, 0x1152181, 0x1152217, 0x1152226, 0x1152235, 0x1152244, 0x1152253,
+	0x1152262, 0x1152271, 0x1152316, 0x1152325, 0x1152334, 0x1152343, 0x1152352, 0x1152361,
+	0x1152415, 0x1152424, 0x1152433, 0x1152442, 0x1152451, 0x1152514, 0x1152523, 0x1152532,
+	0x1152541, 0x1152613, 0x1152622, 0x1152631, 0x1152712, 0x1152721, 0x1152811, 0x1153117,
+	0x1153126, 0x1153135, 0x1153144, 0x1153153, 0x1153162, 0x1153171, 0x1153216, 0x1153225,
+	0x1153234, 0x1153243, 0x1153252, 0x1153261, 0x1153315, 0x1153324, 0x1153333, 0x1153342,
+	0x1153351, 0x1153414, 0x1153423, 0x1153432, 0x1153441, 0x1153513, 0x1153522, 0x1153531,
+	0x1153612, 0x1153621, 0x1153711, 0x1154116, 0x1154125, 0x1154134, 0x1154143, 0x1154152,
+	0x1154161, 0x1154215, 0x1154224, 0x1154233, 0x1154242, 0x1154251, 0x1154314, 0x1154323,
+	0x1154332, 0x1154341, 0x1154413, 0x1154422, 0x1154431, 0x1154512, 0x1154521, 0x1154611,
+	0x1155115, 0x1155124, 0x1155133, 0x1155142, 0x1155151, 0x1155214, 0x1155223, 0x1155232,
+	0x1155241, 0x1155313, 0x1155322, 0x1155331, 0x1155412, 0x1155421, 0x1155511, 0x1156114,
+	0x1156123, 0x1156132, 0x1156141, 0x1156213, 0x1156222, 0x1156231, 0x1156312, 0x1156321,
+	0x1156411, 0x1157113, 0x1157122, 0x1157131, 0x1157212, 0x1157221, 0x1157311, 0x1158112,
+	0x1158121, 0x1158211, 0x1161118, 0x1161127, 0x1161136, 0x1161145, 0x1161154, 0x1161163,
+	0x1161172, 0x1161181, 0x1161217, 0x1161226, 0x1161235, 0x1161244, 0x1161253, 0x1161262,
+	0x1161271, 0x1161316, 0x1161325, 0x1161334, 0x1161343, 0x1161352, 0x1161361, 0x1161415,
+	0x1161424, 0x1161433, 0x1161442, 0x1161451, 0x1161514, 0x1161523, 0x1161532, 0x1161541,
+	0x1161613, 0x1161622, 0x1161631, 0x1161712, 0x1161721, 0x1161811, 0x1162117, 0x1162126,
+	0x1162135, 0x1162144, 0x1162153, 0x1162162, 0x1162171, 0x1162216, 0x1162225, 0x1162234,
+	0x1162243, 0x1162252, 0x1162261, 0x1162315, 0x1162324, 0x1162333, 0x1162342, 0x1162351,
+	0x1162414, 0x1162423, 0x1162432, 0x1162441, 0x1162513, 0x1162522, 0x1162531, 0x1162612,
+	0x1162621, 0x1162711, 0x1163116, 0x1163125, 0x1163134, 0x1163143, 0x1163152, 0x1163161,
+	0x1163215, 0x1163224, 0x1163233, 0x1163242, 0x1163251, 0x1163314, 0x1163323, 0x1163332,
+	0x1163341, 0x1163413, 0x1163422, 0x1163431, 0x1163512, 0x1163521, 0x1163611, 0x1164115,
+	0x1164124, 0x1164133, 0x1164142, 0x1164151, 0x1164214, 0x1164223, 0x1164232, 0x1164241,
+	0x1164313, 0x1164322, 0x1164331, 0x1164412, 0x1164421, 0x1164511, 0x1165114, 0x1165123,
+	0x1165132, 0x1165141, 0x1165213, 0x1165222, 0x1165231, 0x1165312, 0x1165321, 0x1165411,
+	0x1166113, 0x1166122, 0x1166131, 0x1166212, 0x1166221, 0x1166311, 0x1167112, 0x1167121,
+	0x1167211, 0x1168111, 0x1171117, 0x1171126, 0x1171135, 0x1171144, 0x1171153, 0x1171162,
+	0x1171171, 0x1171216, 0x1171225, 0x1171234, 0x1171243, 0x1171252, 0x1171261, 0x1171315,
+	0x1171324, 0x1171333, 0x1171342, 0x1171351, 0x1171414, 0x1171423, 0x1171432, 0x1171441,
+	0x1171513, 0x1171522, 0x1171531, 0x1171612, 0x1171621, 0x1171711, 0x1172116, 0x1172125,
+	0x1172134, 0x1172143, 0x1172152, 0x1172161, 0x1172215, 0x1172224, 0x1172233, 0x1172242,
+	0x1172251, 0x1172314, 0x1172323, 0x1172332, 0x1172341, 0x1172413, 0x1172422, 0x1172431,
+	0x1172512, 0x1172521, 0x1172611, 0x1173115, 0x1173124, 0x1173133, 0x1173142, 0x1173151,
+	0x1173214, 0x1173223, 0x1173232, 0x1173241, 0x1173313, 0x1173322, 0x1173331, 0x1173412,
+	0x1173421, 0x1173511, 0x1174114, 0x1174123, 0x1174132, 0x1174141, 0x1174213, 0x1174222,
+	0x1174231, 0x1174312, 0x1174321, 0x1174411, 0x1175113, 0x1175122, 0x1175131, 0x1175212,
+	0x1175221, 0x1175311, 0x1176112, 0x1176121, 0x1176211, 0x1177111, 0x1181116, 0x1181125,
+	0x1181134, 0x1181143, 0x1181152, 0x1181161, 0x1181215, 0x1181224, 0x1181233, 0x1181242,
+	0x1181251, 0x1181314, 0x1181323, 0x1181332, 0x1181341, 0x1181413, 0x1181422, 0x1181431,
+	0x1181512, 0x1181521, 0x1181611, 0x1182115, 0x1182124, 0x1182133, 0x1182142, 0x1182151,
+	0x1182214, 0x1182223, 0x1182232, 0x1182241, 0x1182313, 0x1182322, 0x1182331, 0x1182412,
+	0x1182421, 0x1182511, 0x1183114, 0x1183123, 0x1183132, 0x1183141, 0x1183213, 0x1183222,
+	0x1183231, 0x1183312, 0x1183321, 0x1183411, 0x1184113, 0x1184122, 0x1184131, 0x1184212,
+	0x1184221, 0x1184311, 0x1185112, 0x1185121, 0x1185211, 0x1186111, 0x1211158, 0x1211167,
+	0x1211176, 0x1211185, 0x1211248, 0x1211257, 0x1211266, 0x1211275, 0x1211284, 0x1211338,
+	0x1211347, 0x1211356, 0x1211365, 0x1211374, 0x1211383, 0x1211428, 0x1211437, 0x1211446,
+	0x1211455, 0x1211464, 0x1211473, 0x1211482, 0x1211518, 0x1211527, 0x1211536, 0x1211545,
+	0x1211554, 0x1211563, 0x1211572, 0x1211581, 0x1211617, 0x1211626, 0x1211635, 0x1211644,
+	0x1211653, 0x1211662, 0x1211671, 0x1211716, 0x1211725, 0x1211734, 0x1211743, 0x1211752,
+	0x1211761, 0x1211815, 0x1211824, 0x1211833, 0x1211842, 0x1211851, 0x1212148, 0x1212157,
+	0x1212166, 0x1212175, 0x1212184, 0x1212238, 0x1212247, 0x1212256, 0x1212265, 0x1212274,
+	0x1212283, 0x1212328, 0x1212337, 0x1212346, 0x1212355, 0x1212364, 0x1212373, 0x1212382,
+	0x1212418, 0x1212427, 0x1212436, 0x1212445, 0x1212454, 0x1212463, 0x1212472, 0x1212481,
+	0x1212517, 0x1212526, 0x1212535, 0x1212544, 0x1212553, 0x1212562, 0x1212571, 0x1212616,
+	0x1212625, 0x1212634, 0x1212643, 0x1212652, 0x1212661, 0x1212715, 0x1212724, 0x1212733,
+	0x1212742, 0x1212751, 0x1212814, 0x1212823, 0x1212832, 0x1212841, 0x1213138, 0x1213147,
+	0x1213156, 0x1213165, 0x1213174, 0x1213183, 0x1213228, 0x1213237, 0x1213246, 0x1213255,
+	0x1213264, 0x1213273, 0x1213282, 0x1213318, 0x1213327, 0x1213336, 0x1213345, 0x1213354,
+	0x1213363, 0x1213372, 0x1213381, 0x1213417, 0x1213426, 0x1213435, 0x1213444, 0x1213453,
+	0x1213462, 0x1213471, 0x1213516, 0x1213525, 0x1213534, 0x1213543, 0x1213552, 0x1213561,
+	0x1213615, 0x1213624, 0x1213633, 0x1213642, 0x1213651, 0x1213714, 0x1213723, 0x1213732,
+	0x1213741, 0x1213813, 0x1213822, 0x1213831, 0x1214128, 0x1214137, 0x1214146, 0x1214155,
+	0x1214164, 0x1214173, 0x1214182, 0x1214218, 0x1214227, 0x1214236, 0x1214245, 0x1214254,
+	0x1214263, 0x1214272, 0x1214281, 0x1214317, 0x1214326, 0x1214335, 0x1214344, 0x1214353,
+	0x1214362, 0x1214371, 0x1214416, 0x1214425, 0x1214434, 0x1214443, 0x1214452, 0x1214461,
+	0x1214515, 0x1214524, 0x1214533, 0x1214542, 0x1214551, 0x1214614, 0x1214623, 0x1214632,
+	0x1214641, 0x1214713, 0x1214722, 0x1214731, 0x1214812, 0x1214821, 0x1215118, 0x1215127,
+	0x1215136, 0x1215145, 0x1215154, 0x1215163, 0x1215172, 0x1215181, 0x1215217, 0x1215226,
+	0x1215235, 0x1215244, 0x1215253, 0x1215262, 0x1215271, 0x1215316, 0x1215325, 0x1215334,
+	0x1215343, 0x1215352, 0x1215361, 0x1215415, 0x1215424, 0x1215433, 0x1215442, 0x1215451,
+	0x1215514, 0x1215523, 0x1215532, 0x1215541, 0x1215613, 0x1215622, 0x1215631, 0x1215712,
+	0x1215721, 0x1215811, 0x1216117, 0x1216126, 0x1216135, 0x1216144, 0x1216153, 0x1216162,
+	0x1216171, 0x1216216, 0x1216225, 0x1216234, 0x1216243, 0x1216252, 0x1216261, 0x1216315,
+	0x1216324, 0x1216333, 0x1216342, 0x1216351, 0x1216414, 0x1216423, 0x1216432, 0x1216441,
+	0x1216513, 0x1216522, 0x1216531, 0x1216612, 0x1216621, 0x1216711, 0x1217116, 0x1217125,
+	0x1217134, 0x1217143, 0x1217152, 0x1217161, 0x1217215, 0x1217224, 0x1217233, 0x1217242,
+	0x1217251, 0x1217314, 0x1217323, 0x1217332, 0x1217341, 0x1217413, 0x1217422, 0x1217431,
+	0x1217512, 0x1217521, 0x1217611, 0x1218115, 0x1218124, 0x1218133, 0x1218142, 0x1218151,
+	0x1218214, 0x1218223, 0x1218232, 0x1218241, 0x1218313, 0x1218322, 0x1218331, 0x1218412,
+	0x1218421, 0x1218511, 0x1221148, 0x1221157, 0x1221166, 0x1221175, 0x1221184, 0x1221238,
+	0x1221247, 0x1221256, 0x1221265, 0x1221274, 0x1221283, 0x1221328, 0x1221337, 0x1221346,
+	0x1221355, 0x1221364, 0x1221373, 0x1221382, 0x1221418, 0x1221427, 0x1221436, 0x1221445,
+	0x1221454, 0x1221463, 0x1221472, 0x1221481, 0x1221517, 0x1221526, 0x1221535, 0x1221544,
+	0x1221553, 0x1221562, 0x1221571, 0x1221616, 0x1221625, 0x1221634, 0x1221643, 0x1221652,
+	0x1221661, 0x1221715, 0x1221724, 0x1221733, 0x1221742, 0x1221751, 0x1221814, 0x1221823,
+	0x1221832, 0x1221841, 0x1222138, 0x1222147, 0x1222156, 0x1222165, 0x1222174, 0x1222183,
+	0x1222228, 0x1222237, 0x1222246, 0x1222255, 0x1222264, 0x1222273, 0x1222282, 0x1222318,
+	0x1222327, 0x1222336, 0x1222345, 0x1222354, 0x1222363, 0x1222372, 0x1222381, 0x1222417,
+	0x1222426, 0x1222435, 0x1222444, 0x1222453, 0x1222462, 0x1222471, 0x1222516, 0x1222525,
+	0x1222534, 0x1222543, 0x1222552, 0x1222561, 0x1222615, 0x1222624, 0x1222633, 0x1222642,
+	0x1222651, 0x1222714, 0x1222723, 0x1222732, 0x1222741, 0x1222813, 0x1222822, 0x1222831,
+	0x1223128, 0x1223137, 0x1223146, 0x1223155, 0x1223164, 0x1223173, 0x1223182, 0x1223218,
+	0x1223227, 0x1223236, 0x1223245, 0x1223254, 0x1223263, 0x1223272, 0x1223281, 0x1223317,
+	0x1223326, 0x1223335, 0x1223344, 0x1223353, 0x1223362, 0x1223371, 0x1223416, 0x1223425,
+	0x1223434, 0x1223443, 0x1223452, 0x1223461, 0x1223515, 0x1223524, 0x1223533, 0x1223542,
+	0x1223551, 0x1223614, 0x1223623, 0x1223632, 0x1223641, 0x1223713, 0x1223722, 0x1223731,
+	0x1223812, 0x1223821, 0x1224118, 0x1224127, 0x1224136, 0x1224145, 0x1224154, 0x1224163,
+	0x1224172, 0x1224181, 0x1224217, 0x1224226, 0x1224235, 0x1224244, 0x1224253, 0x1224262,
+	0x1224271, 0x1224316, 0x1224325, 0x1224334, 0x1224343, 0x1224352, 0x1224361, 0x1224415,
+	0x1224424, 0x1224433, 0x1224442, 0x1224451, 0x1224514, 0x1224523, 0x1224532, 0x1224541,
+	0x1224613, 0x1224622, 0x1224631, 0x1224712, 0x1224721, 0x1224811, 0x1225117, 0x1225126,
+	0x1225135, 0x1225144, 0x1225153, 0x1225162, 0x1225171, 0x1225216, 0x1225225, 0x1225234,
+	0x1225243, 0x1225252, 0x1225261, 0x1225315, 0x1225324, 0x1225333, 0x1225342, 0x1225351,
+	0x1225414, 0x1225423, 0x1225432, 0x1225441, 0x1225513, 0x1225522, 0x1225531, 0x1225612,
+	0x1225621, 0x1225711, 0x1226116, 0x1226125, 0x1226134, 0x1226143, 0x1226152, 0x1226161,
+	0x1226215, 0x1226224, 0x1226233, 0x1226242, 0x1226251, 0x1226314, 0x1226323, 0x1226332,
+	0x1226341, 0x1226413, 0x1226422, 0x1226431, 0x1226512, 0x1226521, 0x1226611, 0x1227115,
+	0x1227124, 0x1227133, 0x1227142, 0x1227151, 0x1227214, 0x1227223, 0x1227232, 0x1227241,
+	0x1227313, 0x1227322, 0x1227331, 0x1227412, 0x1227421, 0x1227511, 0x1228114, 0x1228123,
+	0x1228132, 0x1228141, 0x1228213, 0x1228222, 0x1228231, 0x1228312, 0x1228321, 0x1228411,
+	0x1231138, 0x1231147, 0x1231156, 0x1231165, 0x1231174, 0x1231183, 0x1231228, 0x1231237,
+	0x1231246, 0x1231255, 0x1231264, 0x1231273, 0x1231282, 0x1231318, 0x1231327, 0x1231336,
+	0x1231345, 0x1231354, 0x1231363, 0x1231372, 0x1231381, 0x1231417, 0x1231426, 0x1231435,
+	0x1231444, 0x1231453, 0x1231462, 0x1231471, 0x1231516, 0x1231525, 0x1231534, 0x1231543,
+	0x1231552, 0x1231561, 0x1231615, 0x1231624, 0x1231633, 0x1231642, 0x1231651, 0x1231714,
+	0x1231723, 0x1231732, 0x1231741, 0x1231813, 0x1231822, 0x1231831, 0x1232128, 0x1232137,
+	0x1232146, 0x1232155, 0x1232164, 0x1232173, 0x1232182, 0x1232218, 0x1232227, 0x1232236,
+	0x1232245, 0x1232254, 0x1232263, 0x1232272, 0x1232281, 0x1232317, 0x1232326, 0x1232335,
+	0x1232344, 0x1232353, 0x1232362, 0x1232371, 0x1232416, 0x1232425, 0x1232434, 0x1232443,
+	0x1232452, 0x1232461, 0x1232515, 0x1232524, 0x1232533, 0x1232542, 0x1232551, 0x1232614,
+	0x1232623, 0x1232632, 0x1232641, 0x1232713, 0x1232722, 0x1232731, 0x1232812, 0x1232821,
+	0x1233118, 0x1233127, 0x1233136, 0x1233145, 0x1233154, 0x1233163, 0x1233172, 0x1233181,
+	0x1233217, 0x1233226, 0x1233235, 0x1233244, 0x1233253, 0x1233262, 0x1233271, 0x1233316,
+	0x1233325, 0x1233334, 0x1233343, 0x1233352, 0x1233361, 0x1233415, 0x1233424, 0x1233433,
+	0x1233442, 0x1233451, 0x1233514, 0x1233523, 0x1233532, 0x1233541, 0x1233613, 0x1233622,
+	0x1233631, 0x1233712, 0x1233721, 0x1233811, 0x1234117, 0x1234126, 0x1234135, 0x1234144,
+	0x1234153, 0x1234162, 0x1234171, 0x1234216, 0x1234225, 0x1234234, 0x1234243, 0x1234252,
+	0x1234261, 0x1234315, 0x1234324, 0x1234333, 0x1234342, 0x1234351, 0x1234414, 0x1234423,
+	0x1234432, 0x1234441, 0x1234513, 0x1234522, 0x1234531, 0x1234612, 0x1234621, 0x1234711,
+	0x1235116, 0x1235125, 0x1235134, 0x1235143, 0x1235152, 0x1235161, 0x1235215, 0x1235224,
+	0x1235233, 0x1235242, 0x1235251, 0x1235314, 0x1235323, 0x1235332, 0x1235341, 0x1235413,
+	0x1235422, 0x1235431, 0x1235512, 0x1235521, 0x1235611, 0x1236115, 0x1236124, 0x1236133,
+	0x1236142, 0x1236151, 0x1236214, 0x1236223, 0x1236232, 0x1236241, 0x1236313, 0x1236322,
+	0x1236331, 0x1236412, 0x1236421, 0x1236511, 0x1237114, 0x1237123, 0x1237132, 0x1237141,
+	0x1237213, 0x1237222, 0x1237231, 0x1237312, 0x1237321, 0x1237411, 0x1238113, 0x1238122,
+	0x1238131, 0x1238212, 0x1238221, 0x1238311, 0x1241128, 0x1241137, 0x1241146, 0x1241155,
+	0x1241164, 0x1241173, 0x1241182, 0x1241218, 0x1241227, 0x1241236, 0x1241245, 0x1241254,
+	0x1241263, 0x1241272, 0x1241281, 0x1241317, 0x1241326, 0x1241335, 0x1241344, 0x1241353,
+	0x1241362, 0x1241371, 0x1241416, 0x1241425, 0x1241434, 0x1241443, 0x1241452, 0x1241461,
+	0x1241515, 0x1241524, 0x1241533, 0x1241542, 0x1241551, 0x1241614, 0x1241623, 0x1241632,
+	0x1241641, 0x1241713, 0x1241722, 0x1241731, 0x1241812, 0x1241821, 0x1242118, 0x1242127,
+	0x1242136, 0x1242145, 0x1242154, 0x1242163, 0x1242172, 0x1242181, 0x1242217, 0x1242226,
+	0x1242235, 0x1242244, 0x1242253, 0x1242262, 0x1242271, 0x1242316, 0x1242325, 0x1242334,
+	0x1242343, 0x1242352, 0x1242361, 0x1242415, 0x1242424, 0x1242433, 0x1242442, 0x1242451,
+	0x1242514, 0x1242523, 0x1242532, 0x1242541, 0x1242613, 0x1242622, 0x1242631, 0x1242712,
+	0x1242721, 0x1242811, 0x1243117, 0x1243126, 0x1243135, 0x1243144, 0x1243153, 0x1243162,
+	0x1243171, 0x1243216, 0x1243225, 0x1243234, 0x1243243, 0x1243252, 0x1243261, 0x1243315,
+	0x1243324, 0x1243333, 0x1243342, 0x1243351, 0x1243414, 0x1243423, 0x1243432, 0x1243441,
+	0x1243513, 0x1243522, 0x1243531, 0x1243612, 0x1243621, 0x1243711, 0x1244116, 0x1244125,
+	0x1244134, 0x1244143, 0x1244152, 0x1244161, 0x1244215, 0x1244224, 0x1244233, 0x1244242,
+	0x1244251, 0x1244314, 0x1244323, 0x1244332, 0x1244341, 0x1244413, 0x1244422, 0x1244431,
+	0x1244512, 0x1244521, 0x1244611, 0x1245115, 0x1245124, 0x1245133, 0x1245142, 0x1245151,
+	0x1245214, 0x1245223, 0x1245232, 0x1245241, 0x1245313, 0x1245322, 0x1245331, 0x1245412,
+	0x1245421, 0x1245511, 0x1246114, 0x1246123, 0x1246132, 0x1246141, 0x1246213, 0x1246222,
+	0x1246231, 0x1246312, 0x1246321, 0x1246411, 0x1247113, 0x1247122, 0x1247131, 0x1247212,
+	0x1247221, 0x1247311, 0x1248112, 0x1248121, 0x1248211, 0x1251118, 0x1251127, 0x1251136,
+	0x1251145, 0x1251154, 0x1251163, 0x1251172, 0x1251181, 0x1251217, 0x1251226, 0x1251235,
+	0x1251244, 0x1251253, 0x1251262, 0x1251271, 0x1251316, 0x1251325, 0x1251334, 0x1251343,
+	0x1251352, 0x1251361, 0x1251415, 0x1251424, 0x1251433, 0x1251442, 0x1251451, 0x1251514,
+	0x1251523, 0x1251532, 0x1251541, 0x1251613, 0x1251622, 0x1251631, 0x1251712, 0x1251721,
+	0x1251811, 0x1252117, 0x1252126, 0x1252135, 0x1252144, 0x1252153, 0x1252162, 0x1252171,
+	0x1252216, 0x1252225, 0x1252234, 0x1252243, 0x1252252, 0x1252261, 0x1252315, 0x1252324,
+	0x1252333, 0x1252342, 0x1252351, 0x1252414, 0x1252423, 0x1252432, 0x1252441, 0x1252513,
+	0x1252522, 0x1252531, 0x1252612, 0x1252621, 0x1252711, 0x1253116, 0x1253125, 0x1253134,
+	0x1253143, 0x1253152, 0x1253161, 0x1253215, 0x1253224, 0x1253233, 0x1253242, 0x1253251,
+	0x1253314, 0x1253323, 0x1253332, 0x1253341, 0x1253413, 0x1253422, 0x1253431, 0x1253512,
+	0x1253521, 0x1253611, 0x1254115, 0x1254124, 0x1254133, 0x1254142, 0x1254151, 0x1254214,
+	0x1254223, 0x1254232, 0x1254241, 0x1254313, 0x1254322, 0x1254331, 0x1254412, 0x1254421,
+	0x1254511, 0x1255114, 0x1255123, 0x1255132, 0x1255141, 0x1255213, 0x1255222, 0x1255231,
+	0x1255312, 0x1255321, 0x1255411, 0x1256113, 0x1256122, 0x1256131, 0x1256212, 0x1256221,
+	0x1256311, 0x1257112, 0x1257121, 0x1257211, 0x1258111, 0x1261117, 0x1261126, 0x1261135,
+	0x1261144, 0x1261153, 0x1261162, 0x1261171, 0x1261216, 0x1261225, 0x1261234, 0x1261243,
+	0x1261252, 0x1261261, 0x1261315, 0x1261324, 0x1261333, 0x1261342, 0x1261351, 0x1261414,
+	0x1261423, 0x1261432, 0x1261441, 0x1261513, 0x1261522, 0x1261531, 0x1261612, 0x1261621,
+	0x1261711, 0x1262116, 0x1262125, 0x1262134, 0x1262143, 0x1262152, 0x1262161, 0x1262215,
+	0x1262224, 0x1262233, 0x1262242, 0x1262251, 0x1262314, 0x1262323, 0x1262332, 0x1262341,
+	0x1262413, 0x1262422, 0x1262431, 0x1262512, 0x1262521, 0x1262611, 0x1263115, 0x1263124,
+	0x1263133, 0x1263142, 0x1263151, 0x1263214, 0x1263223, 0x1263232, 0x1263241, 0x1263313,
+	0x1263322, 0x1263331, 0x1263412, 0x1263421, 0x1263511, 0x1264114, 0x1264123, 0x1264132,
+	0x1264141, 0x1264213, 0x1264222, 0x1264231, 0x1264312, 0x1264321, 0x1264411, 0x1265113,
+	0x1265122, 0x1265131, 0x1265212, 0x1265221, 0x1265311, 0x1266112, 0x1266121, 0x1266211,
+	0x1267111, 0x1271116, 0x1271125, 0x1271134, 0x1271143, 0x1271152, 0x1271161, 0x1271215,
+	0x1271224, 0x1271233, 0x1271242, 0x1271251, 0x1271314, 0x1271323, 0x1271332, 0x1271341,
+	0x1271413, 0x1271422, 0x1271431, 0x1271512, 0x1271521, 0x1271611, 0x1272115, 0x1272124,
+	0x1272133, 0x1272142, 0x1272151, 0x1272214, 0x1272223, 0x1272232, 0x1272241, 0x1272313,
+	0x1272322, 0x1272331, 0x1272412, 0x1272421, 0x1272511, 0x1273114, 0x1273123, 0x1273132,
+	0x1273141, 0x1273213, 0x1273222, 0x1273231, 0x1273312, 0x1273321, 0x1273411, 0x1274113,
+	0x1274122, 0x1274131, 0x1274212, 0x1274221, 0x1274311, 0x1275112, 0x1275121, 0x1275211,
+	0x1276111, 0x1281115, 0x1281124, 0x1281133, 0x1281142, 0x1281151, 0x1281214, 0x1281223,
+	0x1281232, 0x1281241, 0x1281313, 0x1281322, 0x1281331, 0x1281412, 0x1281421, 0x1281511,
+	0x1282114, 0x1282123, 0x1282132, 0x1282141, 0x1282213, 0x1282222, 0x1282231, 0x1282312,
+	0x1282321, 0x1282411, 0x1283113, 0x1283122, 0x1283131, 0x1283212, 0x1283221, 0x1283311,
+	0x1284112, 0x1284121, 0x1284211, 0x1285111, 0x1311148, 0x1311157, 0x1311166, 0x1311175,
+	0x1311184, 0x1311238, 0x1311247, 0x1311256, 0x1311265, 0x1311274, 0x1311283, 0x1311328,
+	0x1311337, 0x1311346, 0x1311355, 0x1311364, 0x1311373, 0x1311382, 0x1311418, 0x1311427,
+	0x1311436, 0x1311445, 0x1311454, 0x1311463, 0x1311472, 0x1311481, 0x1311517, 0x1311526,
+	0x1311535, 0x1311544, 0x1311553, 0x1311562, 0x1311571, 0x1311616, 0x1311625, 0x1311634,
+	0x1311643, 0x1311652, 0x1311661, 0x1311715, 0x1311724, 0x1311733, 0x1311742, 0x1311751,
+	0x1311814, 0x1311823, 0x1311832, 0x1311841, 0x1312138, 0x1312147, 0x1312156, 0x1312165,
+	0x1312174, 0x1312183, 0x1312228, 0x1312237, 0x1312246, 0x1312255, 0x1312264, 0x1312273,
+	0x1312282, 0x1312318, 0x1312327, 0x1312336, 0x1312345, 0x1312354, 0x1312363, 0x1312372,
+	0x1312381, 0x1312417, 0x1312426, 0x1312435, 0x1312444, 0x1312453, 0x1312462, 0x1312471,
+	0x1312516, 0x1312525, 0x1312534, 0x1312543, 0x1312552, 0x1312561, 0x1312615, 0x1312624,
+	0x1312633, 0x1312642, 0x1312651, 0x1312714, 0x1312723, 0x1312732, 0x1312741, 0x1312813,
+	0x1312822, 0x1312831, 0x1313128, 0x1313137, 0x1313146, 0x1313155, 0x1313164, 0x1313173,
+	0x1313182, 0x1313218, 0x1313227, 0x1313236, 0x1313245, 0x1313254, 0x1313263, 0x1313272,
+	0x1313281, 0x1313317, 0x1313326, 0x1313335, 0x1313344, 0x1313353, 0x1313362, 0x1313371,
+	0x1313416, 0x1313425, 0x1313434, 0x1313443, 0x1313452, 0x1313461, 0x1313515, 0x1313524,
+	0x1313533, 0x1313542, 0x1313551, 0x1313614, 0x1313623, 0x1313632, 0x1313641, 0x1313713,
+	0x1313722, 0x1313731, 0x1313812, 0x1313821, 0x1314118, 0x1314127, 0x1314136, 0x1314145,
+	0x1314154, 0x1314163, 0x1314172, 0x1314181, 0x1314217, 0x1314226, 0x1314235, 0x1314244,
+	0x1314253, 0x1314262, 0x1314271, 0x1314316, 0x1314325, 0x1314334, 0x1314343, 0x1314352,
+	0x1314361, 0x1314415, 0x1314424, 0x1314433, 0x1314442, 0x1314451, 0x1314514, 0x1314523,
+	0x1314532, 0x1314541, 0x1314613, 0x1314622, 0x1314631, 0x1314712, 0x1314721, 0x1314811,
+	0x1315117, 0x1315126, 0x1315135, 0x1315144, 0x1315153, 0x1315162, 0x1315171, 0x1315216,
+	0x1315225, 0x1315234, 0x1315243, 0x1315252, 0x1315261, 0x1315315, 0x1315324, 0x1315333,
+	0x1315342, 0x1315351, 0x1315414, 0x1315423, 0x1315432, 0x1315441, 0x1315513, 0x1315522,
+	0x1315531, 0x1315612, 0x1315621, 0x1315711, 0x1316116, 0x1316125, 0x1316134, 0x1316143,
+	0x1316152, 0x1316161, 0x1316215, 0x1316224, 0x1316233, 0x1316242, 0x1316251, 0x1316314,
+	0x1316323, 0x1316332, 0x1316341, 0x1316413, 0x1316422, 0x1316431, 0x1316512, 0x1316521,
+	0x1316611, 0x1317115, 0x1317124, 0x1317133, 0x1317142, 0x1317151, 0x1317214, 0x1317223,
+	0x1317232, 0x1317241, 0x1317313, 0x1317322, 0x1317331, 0x1317412, 0x1317421, 0x1317511,
+	0x1318114, 0x1318123, 0x1318132, 0x1318141, 0x1318213, 0x1318222, 0x1318231, 0x1318312,
+	0x1318321, 0x1318411, 0x1321138, 0x1321147, 0x1321156, 0x1321165, 0x1321174, 0x1321183,
+	0x1321228, 0x1321237, 0x1321246, 0x1321255, 0x1321264, 0x1321273, 0x1321282, 0x1321318,
+	0x1321327, 0x1321336, 0x1321345, 0x1321354, 0x1321363, 0x1321372, 0x1321381, 0x1321417,
+	0x1321426, 0x1321435, 0x1321444, 0x1321453, 0x1321462, 0x1321471, 0x1321516, 0x1321525,
+	0x1321534, 0x1321543, 0x1321552, 0x1321561, 0x1321615, 0x1321624, 0x1321633, 0x1321642,
+	0x1321651, 0x1321714, 0x1321723, 0x1321732, 0x1321741, 0x1321813, 0x1321822, 0x1321831,
+	0x1322128, 0x1322137, 0x1322146, 0x1322155, 0x1322164, 0x1322173, 0x1322182, 0x1322218,
+	0x1322227, 0x1322236, 0x1322245, 0x1322254, 0x1322263, 0x1322272, 0x1322281, 0x1322317,
+	0x1322326, 0x1322335, 0x1322344, 0x1322353, 0x1322362, 0x1322371, 0x1322416, 0x1322425,
+	0x1322434, 0x1322443, 0x1322452, 0x1322461, 0x1322515, 0x1322524, 0x1322533, 0x1322542,
+	0x1322551, 0x1322614, 0x1322623, 0x1322632, 0x1322641, 0x1322713, 0x1322722, 0x1322731,
+	0x1322812, 0x1322821, 0x1323118, 0x1323127, 0x1323136, 0x1323145, 0x1323154, 0x1323163,
+	0x1323172, 0x1323181, 0x1323217, 0x1323226, 0x1323235, 0x1323244, 0x1323253, 0x1323262,
+	0x1323271, 0x1323316, 0x1323325, 0x1323334, 0x1323343, 0x1323352, 0x1323361, 0x1323415,
+	0x1323424, 0x1323433, 0x1323442, 0x1323451, 0x1323514, 0x1323523, 0x1323532, 0x1323541,
+	0x1323613, 0x1323622, 0x1323631, 0x1323712, 0x1323721, 0x1323811, 0x1324117, 0x1324126,
+	0x1324135, 0x1324144, 0x1324153, 0x1324162, 0x1324171, 0x1324216, 0x1324225, 0x1324234,
+	0x1324243, 0x1324252, 0x1324261, 0x1324315, 0x1324324, 0x1324333, 0x1324342, 0x1324351,
+	0x1324414, 0x1324423, 0x1324432, 0x1324441, 0x1324513, 0x1324522, 0x1324531, 0x1324612,
+	0x1324621, 0x1324711, 0x1325116, 0x1325125, 0x1325134, 0x1325143, 0x1325152, 0x1325161,
+	0x1325215, 0x1325224, 0x1325233, 0x1325242, 0x1325251, 0x1325314, 0x1325323, 0x1325332,
+	0x1325341, 0x1325413, 0x1325422, 0x1325431, 0x1325512, 0x1325521, 0x1325611, 0x1326115,
+	0x1326124, 0x1326133, 0x1326142, 0x1326151, 0x1326214, 0x1326223, 0x1326232, 0x1326241,
+	0x1326313, 0x1326322, 0x1326331, 0x1326412, 0x1326421, 0x1326511, 0x1327114, 0x1327123,
+	0x1327132, 0x1327141, 0x1327213, 0x1327222, 0x1327231, 0x1327312, 0x1327321, 0x1327411,
+	0x1328113, 0x1328122, 0x1328131, 0x1328212, 0x1328221, 0x1328311, 0x1331128, 0x1331137,
+	0x1331146, 0x1331155, 0x1331164, 0x1331173, 0x1331182, 0x1331218, 0x1331227, 0x1331236,
+	0x1331245, 0x1331254, 0x1331263, 0x1331272, 0x1331281, 0x1331317, 0x1331326, 0x1331335,
+	0x1331344, 0x1331353, 0x1331362, 0x1331371, 0x1331416, 0x1331425, 0x1331434, 0x1331443,
+	0x1331452, 0x1331461, 0x1331515, 0x1331524, 0x1331533, 0x1331542, 0x1331551, 0x1331614,
+	0x1331623, 0x1331632, 0x1331641, 0x1331713, 0x1331722, 0x1331731, 0x1331812, 0x1331821,
+	0x1332118, 0x1332127, 0x1332136, 0x1332145, 0x1332154, 0x1332163, 0x1332172, 0x1332181,
+	0x1332217, 0x1332226, 0x1332235, 0x1332244, 0x1332253, 0x1332262, 0x1332271, 0x1332316,
+	0x1332325, 0x1332334, 0x1332343, 0x1332352, 0x1332361, 0x1332415, 0x1332424, 0x1332433,
+	0x1332442, 0x1332451, 0x1332514, 0x1332523, 0x1332532, 0x1332541, 0x1332613, 0x1332622,
+	0x1332631, 0x1332712, 0x1332721, 0x1332811, 0x1333117, 0x1333126, 0x1333135, 0x1333144,
+	0x1333153, 0x1333162, 0x1333171, 0x1333216, 0x1333225, 0x1333234, 0x1333243, 0x1333252,
+	0x1333261, 0x1333315, 0x1333324, 0x1333333, 0x1333342, 0x1333351, 0x1333414, 0x1333423,
+	0x1333432, 0x1333441, 0x1333513, 0x1333522, 0x1333531, 0x1333612, 0x1333621, 0x1333711,
+	0x1334116, 0x1334125, 0x1334134, 0x1334143, 0x1334152, 0x1334161, 0x1334215, 0x1334224,
+	0x1334233, 0x1334242, 0x1334251, 0x1334314, 0x1334323, 0x1334332, 0x1334341, 0x1334413,
+	0x1334422, 0x1334431, 0x1334512, 0x1334521, 0x1334611, 0x1335115, 0x1335124, 0x1335133,
+	0x1335142, 0x1335151, 0x1335214, 0x1335223, 0x1335232, 0x1335241, 0x1335313, 0x1335322,
+	0x1335331, 0x1335412, 0x1335421, 0x1335511, 0x1336114, 0x1336123, 0x1336132, 0x1336141,
+	0x1336213, 0x1336222, 0x1336231, 0x1336312, 0x1336321, 0x1336411, 0x1337113, 0x1337122,
+	0x1337131, 0x1337212, 0x1337221, 0x1337311, 0x1338112, 0x1338121, 0x1338211, 0x1341118,
+	0x1341127, 0x1341136, 0x1341145, 0x1341154, 0x1341163, 0x1341172, 0x1341181, 0x1341217,
+	0x1341226, 0x1341235, 0x1341244, 0x1341253, 0x1341262, 0x1341271, 0x1341316, 0x1341325,
+	0x1341334, 0x1341343, 0x1341352, 0x1341361, 0x1341415, 0x1341424, 0x1341433, 0x1341442,
+	0x1341451, 0x1341514, 0x1341523, 0x1341532, 0x1341541, 0x1341613, 0x1341622, 0x1341631,
+	0x1341712, 0x1341721, 0x1341811, 0x1342117, 0x1342126, 0x1342135, 0x1342144, 0x1342153,
+	0x1342162, 0x1342171, 0x1342216, 0x1342225, 0x1342234, 0x1342243, 0x1342252, 0x1342261,
+	0x1342315, 0x1342324, 0x1342333, 0x1342342, 0x1342351, 0x1342414, 0x1342423, 0x1342432,
+	0x1342441, 0x1342513, 0x1342522, 0x1342531, 0x1342612, 0x1342621, 0x1342711, 0x1343116,
+	0x1343125, 0x1343134, 0x1343143, 0x1343152, 0x1343161, 0x1343215, 0x1343224, 0x1343233,
+	0x1343242, 0x1343251, 0x1343314, 0x1343323, 0x1343332, 0x1343341, 0x1343413, 0x1343422,
+	0x1343431, 0x1343512, 0x1343521, 0x1343611, 0x1344115, 0x1344124, 0x1344133, 0x1344142,
+	0x1344151, 0x1344214, 0x1344223, 0x1344232, 0x1344241, 0x1344313, 0x1344322, 0x1344331,
+	0x1344412, 0x1344421, 0x1344511, 0x1345114, 0x1345123, 0x1345132, 0x1345141, 0x1345213,
+	0x1345222, 0x1345231, 0x1345312, 0x1345321, 0x1345411, 0x1346113, 0x1346122, 0x1346131,
+	0x1346212, 0x1346221, 0x1346311, 0x1347112, 0x1347121, 0x1347211, 0x1348111, 0x1351117,
+	0x1351126, 0x1351135, 0x1351144, 0x1351153, 0x1351162, 0x1351171, 0x1351216, 0x1351225,
+	0x1351234, 0x1351243, 0x1351252, 0x1351261, 0x1351315, 0x1351324, 0x1351333, 0x1351342,
+	0x1351351, 0x1351414, 0x1351423, 0x1351432, 0x1351441, 0x1351513, 0x1351522, 0x1351531,
+	0x1351612, 0x1351621, 0x1351711, 0x1352116, 0x1352125, 0x1352134, 0x1352143, 0x1352152,
+	0x1352161, 0x1352215, 0x1352224, 0x1352233, 0x1352242, 0x1352251, 0x1352314, 0x1352323,
+	0x1352332, 0x1352341, 0x1352413, 0x1352422, 0x1352431, 0x1352512, 0x1352521, 0x1352611,
+	0x1353115, 0x1353124, 0x1353133, 0x1353142, 0x1353151, 0x1353214, 0x1353223, 0x1353232,
+	0x1353241, 0x1353313, 0x1353322, 0x1353331, 0x1353412, 0x1353421, 0x1353511, 0x1354114,
+	0x1354123, 0x1354132, 0x1354141, 0x1354213, 0x1354222, 0x1354231, 0x1354312, 0x1354321,
+	0x1354411, 0x1355113, 0x1355122, 0x1355131, 0x1355212, 0x1355221, 0x1355311, 0x1356112,
+	0x1356121, 0x1356211, 0x1357111, 0x1361116, 0x1361125, 0x1361134, 0x1361143, 0x1361152,
+	0x1361161, 0x1361215, 0x1361224, 0x1361233, 0x1361242, 0x1361251, 0x1361314, 0x1361323,
+	0x1361332, 0x1361341, 0x1361413, 0x1361422, 0x1361431, 0x1361512, 0x1361521, 0x1361611,
+	0x1362115, 0x1362124, 0x1362133, 0x1362142, 0x1362151, 0x1362214, 0x1362223, 0x1362232,
+	0x1362241, 0x1362313, 0x1362322, 0x1362331, 0x1362412, 0x1362421, 0x1362511, 0x1363114,
+	0x1363123, 0x1363132, 0x1363141, 0x1363213, 0x1363222, 0x1363231, 0x1363312, 0x1363321,
+	0x1363411, 0x1364113, 0x1364122, 0x1364131, 0x1364212, 0x1364221, 0x1364311, 0x1365112,
+	0x1365121, 0x1365211, 0x1366111, 0x1371115, 0x1371124, 0x1371133, 0x1371142, 0x1371151,
+	0x1371214, 0x1371223, 0x1371232, 0x1371241, 0x1371313, 0x1371322, 0x1371331, 0x1371412,
+	0x1371421, 0x1371511, 0x1372114, 0x1372123, 0x1372132, 0x1372141, 0x1372213, 0x1372222,
+	0x1372231, 0x1372312, 0x1372321, 0x1372411, 0x1373113, 0x1373122, 0x1373131, 0x1373212,
+	0x1373221, 0x1373311, 0x1374112, 0x1374121, 0x1374211, 0x1375111, 0x1381114, 0x1381123,
+	0x1381132, 0x1381141, 0x1381213, 0x1381222, 0x1381231, 0x1381312, 0x1381321, 0x1381411,
+	0x1382113, 0x1382122, 0x1382131, 0x1382212, 0x1382221, 0x1382311, 0x1383112, 0x1383121,
+	0x1383211, 0x1384111, 0x1411138, 0x1411147, 0x1411156, 0x1411165, 0x1411174, 0x1411183,
+	0x1411228, 0x1411237, 0x1411246, 0x1411255, 0x1411264, 0x1411273, 0x1411282, 0x1411318,
+	0x1411327, 0x1411336, 0x1411345, 0x1411354, 0x1411363, 0x1411372, 0x1411381, 0x1411417,
+	0x1411426, 0x1411435, 0x1411444, 0x1411453, 0x1411462, 0x1411471, 0x1411516, 0x1411525,
+	0x1411534, 0x1411543, 0x1411552, 0x1411561, 0x1411615, 0x1411624, 0x1411633, 0x1411642,
+	0x1411651, 0x1411714, 0x1411723, 0x1411732, 0x1411741, 0x1411813, 0x1411822, 0x1411831,
+	0x1412128, 0x1412137, 0x1412146, 0x1412155, 0x1412164, 0x1412173, 0x1412182, 0x1412218,
+	0x1412227, 0x1412236, 0x1412245, 0x1412254, 0x1412263, 0x1412272, 0x1412281, 0x1412317,
+	0x1412326, 0x1412335, 0x1412344, 0x1412353, 0x1412362, 0x1412371, 0x1412416, 0x1412425,
+	0x1412434, 0x1412443, 0x1412452, 0x1412461, 0x1412515, 0x1412524, 0x1412533, 0x1412542,
+	0x1412551, 0x1412614, 0x1412623, 0x1412632, 0x1412641, 0x1412713, 0x1412722, 0x1412731,
+	0x1412812, 0x1412821, 0x1413118, 0x1413127, 0x1413136, 0x1413145, 0x1413154, 0x1413163,
+	0x1413172, 0x1413181, 0x1413217, 0x1413226, 0x1413235, 0x1413244, 0x1413253, 0x1413262,
+	0x1413271, 0x1413316, 0x1413325, 0x1413334, 0x1413343, 0x1413352, 0x1413361, 0x1413415,
+	0x1413424, 0x1413433, 0x1413442, 0x1413451, 0x1413514, 0x1413523, 0x1413532, 0x1413541,
+	0x1413613, 0x1413622, 0x1413631, 0x1413712, 0x1413721, 0x1413811, 0x1414117, 0x1414126,
+	0x1414135, 0x1414144, 0x1414153, 0x1414162, 0x1414171, 0x1414216, 0x1414225, 0x1414234,
+	0x1414243, 0x1414252, 0x1414261, 0x1414315, 0x1414324, 0x1414333, 0x1414342, 0x1414351,
+	0x1414414, 0x1414423, 0x1414432, 0x1414441, 0x1414513, 0x1414522, 0x1414531, 0x1414612,
+	0x1414621, 0x1414711, 0x1415116, 0x1415125, 0x1415134, 0x1415143, 0x1415152, 0x1415161,
+	0x1415215, 0x1415224, 0x1415233, 0x1415242, 0x1415251, 0x1415314, 0x1415323, 0x1415332,
+	0x1415341, 0x1415413, 0x1415422, 0x1415431, 0x1415512, 0x1415521, 0x1415611, 0x1416115,
+	0x1416124, 0x1416133, 0x1416142, 0x1416151, 0x1416214, 0x1416223, 0x1416232, 0x1416241,
+	0x1416313, 0x1416322, 0x1416331, 0x1416412, 0x1416421, 0x1416511, 0x1417114, 0x1417123,
+	0x1417132, 0x1417141, 0x1417213, 0x1417222, 0x1417231, 0x1417312, 0x1417321, 0x1417411,
+	0x1418113, 0x1418122, 0x1418131, 0x1418212, 0x1418221, 0x1418311, 0x1421128, 0x1421137,
+	0x1421146, 0x1421155, 0x1421164, 0x1421173, 0x1421182, 0x1421218, 0x1421227, 0x1421236,
+	0x1421245, 0x1421254, 0x1421263, 0x1421272, 0x1421281, 0x1421317, 0x1421326, 0x1421335,
+	0x1421344, 0x1421353, 0x1421362, 0x1421371, 0x1421416, 0x1421425, 0x1421434, 0x1421443,
+	0x1421452, 0x1421461, 0x1421515, 0x1421524, 0x1421533, 0x1421542, 0x1421551, 0x1421614,
+	0x1421623, 0x1421632, 0x1421641, 0x1421713, 0x1421722, 0x1421731, 0x1421812, 0x1421821,
+	0x1422118, 0x1422127, 0x1422136, 0x1422145, 0x1422154, 0x1422163, 0x1422172, 0x1422181,
+	0x1422217, 0x1422226, 0x1422235, 0x1422244, 0x1422253, 0x1422262, 0x1422271, 0x1422316,
+	0x1422325, 0x1422334, 0x1422343, 0x1422352, 0x1422361, 0x1422415, 0x1422424, 0x1422433,
+	0x1422442, 0x1422451, 0x1422514, 0x1422523, 0x1422532, 0x1422541, 0x1422613, 0x1422622,
+	0x1422631, 0x1422712, 0x1422721, 0x1422811, 0x1423117, 0x1423126, 0x1423135, 0x1423144,
+	0x1423153, 0x1423162, 0x1423171, 0x1423216, 0x1423225, 0x1423234, 0x1423243, 0x1423252,
+	0x1423261, 0x1423315, 0x1423324, 0x1423333, 0x1423342, 0x1423351, 0x1423414, 0x1423423,
+	0x1423432, 0x1423441, 0x1423513, 0x1423522, 0x1423531, 0x1423612, 0x1423621, 0x1423711,
+	0x1424116, 0x1424125, 0x1424134, 0x1424143, 0x1424152, 0x1424161, 0x1424215, 0x1424224,
+	0x1424233, 0x1424242, 0x1424251, 0x1424314, 0x1424323, 0x1424332, 0x1424341, 0x1424413,
+	0x1424422, 0x1424431, 0x1424512, 0x1424521, 0x1424611, 0x1425115, 0x1425124, 0x1425133,
+	0x1425142, 0x1425151, 0x1425214, 0x1425223, 0x1425232, 0x1425241, 0x1425313, 0x1425322,
+	0x1425331, 0x1425412, 0x1425421, 0x1425511, 0x1426114, 0x1426123, 0x1426132, 0x1426141,
+	0x1426213, 0x1426222, 0x1426231, 0x1426312, 0x1426321, 0x1426411, 0x1427113, 0x1427122,
+	0x1427131, 0x1427212, 0x1427221, 0x1427311, 0x1428112, 0x1428121, 0x1428211, 0x1431118,
+	0x1431127, 0x1431136, 0x1431145, 0x1431154, 0x1431163, 0x1431172, 0x1431181, 0x1431217,
+	0x1431226, 0x1431235, 0x1431244, 0x1431253, 0x1431262, 0x1431271, 0x1431316, 0x1431325,
+	0x1431334, 0x1431343, 0x1431352, 0x1431361, 0x1431415, 0x1431424, 0x1431433, 0x1431442,
+	0x1431451, 0x1431514, 0x1431523, 0x1431532, 0x1431541, 0x1431613, 0x1431622, 0x1431631,
+	0x1431712, 0x1431721, 0x1431811, 0x1432117, 0x1432126, 0x1432135, 0x1432144, 0x1432153,
+	0x1432162, 0x1432171, 0x1432216, 0x1432225, 0x1432234, 0x1432243, 0x1432252, 0x1432261,
+	0x1432315, 0x1432324, 0x1432333, 0x1432342, 0x1432351, 0x1432414, 0x1432423, 0x1432432,
+	0x1432441, 0x1432513, 0x1432522, 0x1432531, 0x1432612, 0x1432621, 0x1432711, 0x1433116,
+	0x1433125, 0x1433134, 0x1433143, 0x1433152, 0x1433161, 0x1433215, 0x1433224, 0x1433233,
+	0x1433242, 0x1433251, 0x1433314, 0x1433323, 0x1433332, 0x1433341, 0x1433413, 0x1433422,
+	0x1433431, 0x1433512, 0x1433521, 0x1433611, 0x1434115, 0x1434124, 0x1434133, 0x1434142,
+	0x1434151, 0x1434214, 0x1434223, 0x1434232, 0x1434241, 0x1434313, 0x1434322, 0x1434331,
+	0x1434412, 0x1434421, 0x1434511, 0x1435114, 0x1435123, 0x1435132, 0x1435141, 0x1435213,
+	0x1435222, 0x1435231, 0x1435312, 0x1435321, 0x1435411, 0x1436113, 0x1436122, 0x1436131,
+	0x1436212, 0x1436221, 0x1436311, 0x1437112, 0x1437121, 0x1437211, 0x1438111, 0x1441117,
+	0x1441126, 0x1441135, 0x1441144, 0x1441153, 0x1441162, 0x1441171, 0x1441216, 0x1441225,
+	0x1441234, 0x1441243, 0x1441252, 0x1441261, 0x1441315, 0x1441324, 0x1441333, 0x1441342,
+	0x1441351, 0x1441414, 0x1441423, 0x1441432, 0x1441441, 0x1441513, 0x1441522, 0x1441531,
+	0x1441612, 0x1441621, 0x1441711, 0x1442116, 0x1442125, 0x1442134, 0x1442143, 0x1442152,
+	0x1442161, 0x1442215, 0x1442224, 0x1442233, 0x1442242, 0x1442251, 0x1442314, 0x1442323,
+	0x1442332, 0x1442341, 0x1442413, 0x1442422, 0x1442431, 0x1442512, 0x1442521, 0x1442611,
+	0x1443115, 0x1443124, 0x1443133, 0x1443142, 0x1443151, 0x1443214, 0x1443223, 0x1443232,
+	0x1443241, 0x1443313, 0x1443322, 0x1443331, 0x1443412, 0x1443421, 0x1443511, 0x1444114,
+	0x1444123, 0x1444132, 0x1444141, 0x1444213, 0x1444222, 0x1444231, 0x1444312, 0x1444321,
+	0x1444411, 0x1445113, 0x1445122, 0x1445131, 0x1445212, 0x1445221, 0x1445311, 0x1446112,
+	0x1446121, 0x1446211, 0x1447111, 0x1451116, 0x1451125, 0x1451134, 0x1451143, 0x1451152,
+	0x1451161, 0x1451215, 0x1451224, 0x1451233, 0x1451242, 0x1451251, 0x1451314, 0x1451323,
+	0x1451332, 0x1451341, 0x1451413, 0x1451422, 0x1451431, 0x1451512, 0x1451521, 0x1451611,
+	0x1452115, 0x1452124, 0x1452133, 0x1452142, 0x1452151, 0x1452214, 0x1452223, 0x1452232,
+	0x1452241, 0x1452313, 0x1452322, 0x1452331, 0x1452412, 0x1452421, 0x1452511, 0x1453114,
+	0x1453123, 0x1453132, 0x1453141, 0x1453213, 0x1453222, 0x1453231, 0x1453312, 0x1453321,
+	0x1453411, 0x1454113, 0x1454122, 0x1454131, 0x1454212, 0x1454221, 0x1454311, 0x1455112,
+	0x1455121, 0x1455211, 0x1456111, 0x1461115, 0x1461124, 0x1461133, 0x1461142, 0x1461151,
+	0x1461214, 0x1461223, 0x1461232, 0x1461241, 0x1461313, 0x1461322, 0x1461331, 0x1461412,
+	0x1461421, 0x1461511, 0x1462114, 0x1462123, 0x1462132, 0x1462141, 0x1462213, 0x1462222,
+	0x1462231, 0x1462312, 0x1462321, 0x1462411, 0x1463113, 0x1463122, 0x1463131, 0x1463212,
+	0x1463221, 0x1463311, 0x1464112, 0x1464121, 0x1464211, 0x1465111, 0x1471114, 0x1471123,
+	0x1471132, 0x1471141, 0x1471213, 0x1471222, 0x1471231, 0x1471312, 0x1471321, 0x1471411,
+	0x1472113, 0x1472122, 0x1472131, 0x1472212, 0x1472221, 0x1472311, 0x1473112, 0x1473121,
+	0x1473211, 0x1474111, 0x1481113, 0x1481122, 0x1481131, 0x1481212, 0x1481221, 0x1481311,
+	0x1482112, 0x1482121, 0x1482211, 0x1483111, 0x1511128, 0x1511137, 0x1511146, 0x1511155,
+	0x1511164, 0x1511173, 0x1511182, 0x1511218, 0x1511227, 0x1511236, 0x1511245, 0x1511254,
+	0x1511263, 0x1511272, 0x1511281, 0x1511317, 0x1511326, 0x1511335, 0x1511344, 0x1511353,
+	0x1511362, 0x1511371, 0x1511416, 0x1511425, 0x1511434, 0x1511443, 0x1511452, 0x1511461,
+	0x1511515, 0x1511524, 0x1511533, 0x1511542, 0x1511551, 0x1511614, 0x1511623, 0x1511632,
+	0x1511641, 0x1511713, 0x1511722, 0x1511731, 0x1511812, 0x1511821, 0x1512118, 0x1512127,
+	0x1512136, 0x1512145, 0x1512154, 0x1512163, 0x1512172, 0x1512181, 0x1512217, 0x1512226,
+	0x1512235, 0x1512244, 0x1512253, 0x1512262, 0x1512271, 0x1512316, 0x1512325, 0x1512334,
+	0x1512343, 0x1512352, 0x1512361, 0x1512415, 0x1512424, 0x1512433, 0x1512442, 0x1512451,
+	0x1512514, 0x1512523, 0x1512532, 0x1512541, 0x1512613, 0x1512622, 0x1512631, 0x1512712,
+	0x1512721, 0x1512811, 0x1513117, 0x1513126, 0x1513135, 0x1513144, 0x1513153, 0x1513162,
+	0x1513171, 0x1513216, 0x1513225, 0x1513234, 0x1513243, 0x1513252, 0x1513261, 0x1513315,
+	0x1513324, 0x1513333, 0x1513342, 0x1513351, 0x1513414, 0x1513423, 0x1513432, 0x1513441,
+	0x1513513, 0x1513522, 0x1513531, 0x1513612, 0x1513621, 0x1513711, 0x1514116, 0x1514125,
+	0x1514134, 0x1514143, 0x1514152, 0x1514161, 0x1514215, 0x1514224, 0x1514233, 0x1514242,
+	0x1514251, 0x1514314, 0x1514323, 0x1514332, 0x1514341, 0x1514413, 0x1514422, 0x1514431,
+	0x1514512, 0x1514521, 0x1514611, 0x1515115, 0x1515124, 0x1515133, 0x1515142, 0x1515151,
+	0x1515214, 0x1515223, 0x1515232, 0x1515241, 0x1515313, 0x1515322, 0x1515331, 0x1515412,
+	0x1515421, 0x1515511, 0x1516114, 0x1516123, 0x1516132, 0x1516141, 0x1516213, 0x1516222,
+	0x1516231, 0x1516312, 0x1516321, 0x1516411, 0x1517113, 0x1517122, 0x1517131, 0x1517212,
+	0x1517221, 0x1517311, 0x1518112, 0x1518121, 0x1518211, 0x1521118, 0x1521127, 0x1521136,
+	0x1521145, 0x1521154, 0x1521163, 0x1521172, 0x1521181, 0x1521217, 0x1521226, 0x1521235,
+	0x1521244, 0x1521253, 0x1521262, 0x1521271, 0x1521316, 0x1521325, 0x1521334, 0x1521343,
+	0x1521352, 0x1521361, 0x1521415, 0x1521424, 0x1521433, 0x1521442, 0x1521451, 0x1521514,
+	0x1521523, 0x1521532, 0x1521541, 0x1521613, 0x1521622, 0x1521631, 0x1521712, 0x1521721,
+	0x1521811, 0x1522117, 0x1522126, 0x1522135, 0x1522144, 0x1522153, 0x1522162, 0x1522171,
+	0x1522216, 0x1522225, 0x1522234, 0x1522243, 0x1522252, 0x1522261, 0x1522315, 0x1522324,
+	0x1522333, 0x1522342, 0x1522351, 0x1522414, 0x1522423, 0x1522432, 0x1522441, 0x1522513,
+	0x1522522, 0x1522531, 0x1522612, 0x1522621, 0x1522711, 0x1523116, 0x1523125, 0x1523134,
+	0x1523143, 0x1523152, 0x1523161, 0x1523215, 0x1523224, 0x1523233, 0x1523242, 0x1523251,
+	0x1523314, 0x1523323, 0x1523332, 0x1523341, 0x1523413, 0x1523422, 0x1523431, 0x1523512,
+	0x1523521, 0x1523611, 0x1524115, 0x1524124, 0x1524133, 0x1524142, 0x1524151, 0x1524214,
+	0x1524223, 0x1524232, 0x1524241, 0x1524313, 0x1524322, 0x1524331, 0x1524412, 0x1524421,
+	0x1524511, 0x1525114, 0x1525123, 0x1525132, 0x1525141, 0x1525213, 0x1525222, 0x1525231,
+	0x1525312, 0x1525321, 0x1525411, 0x1526113, 0x1526122, 0x1526131, 0x1526212, 0x1526221,
+	0x1526311, 0x1527112, 0x1527121, 0x1527211, 0x1528111, 0x1531117, 0x1531126, 0x1531135,
+	0x1531144, 0x1531153, 0x1531162, 0x1531171, 0x1531216, 0x1531225, 0x1531234, 0x1531243,
+	0x1531252, 0x1531261, 0x1531315, 0x1531324, 0x1531333, 0x1531342, 0x1531351, 0x1531414,
+	0x1531423, 0x1531432, 0x1531441, 0x1531513, 0x1531522, 0x1531531, 0x1531612, 0x1531621,
+	0x1531711, 0x1532116, 0x1532125, 0x1532134, 0x1532143, 0x1532152, 0x1532161, 0x1532215,
+	0x1532224, 0x1532233, 0x1532242, 0x1532251, 0x1532314, 0x1532323, 0x1532332, 0x1532341,
+	0x1532413, 0x1532422, 0x1532431, 0x1532512, 0x1532521, 0x1532611, 0x1533115, 0x1533124,
+	0x1533133, 0x1533142, 0x1533151, 0x1533214, 0x1533223, 0x1533232, 0x1533241, 0x1533313,
+	0x1533322, 0x1533331, 0x1533412, 0x1533421, 0x1533511, 0x1534114, 0x1534123, 0x1534132,
+	0x1534141, 0x1534213, 0x1534222, 0x1534231, 0x1534312, 0x1534321, 0x1534411, 0x1535113,
+	0x1535122, 0x1535131, 0x1535212, 0x1535221, 0x1535311, 0x1536112, 0x1536121, 0x1536211,
+	0x1537111, 0x1541116, 0x1541125, 0x1541134, 0x1541143, 0x1541152, 0x1541161, 0x1541215,
+	0x1541224, 0x1541233, 0x1541242, 0x1541251, 0x1541314, 0x1541323, 0x1541332, 0x1541341,
+	0x1541413, 0x1541422, 0x1541431, 0x1541512, 0x1541521, 0x1541611, 0x1542115, 0x1542124,
+	0x1542133, 0x1542142, 0x1542151, 0x1542214, 0x1542223, 0x1542232, 0x1542241, 0x1542313,
+	0x1542322, 0x1542331, 0x1542412, 0x1542421, 0x1542511, 0x1543114, 0x1543123, 0x1543132,
+	0x1543141, 0x1543213, 0x1543222, 0x1543231, 0x1543312, 0x1543321, 0x1543411, 0x1544113,
+	0x1544122, 0x1544131, 0x1544212, 0x1544221, 0x1544311, 0x1545112, 0x1545121, 0x1545211,
+	0x1546111, 0x1551115, 0x1551124, 0x1551133, 0x1551142, 0x1551151, 0x1551214, 0x1551223,
+	0x1551232, 0x1551241, 0x1551313, 0x1551322, 0x1551331, 0x1551412, 0x1551421, 0x1551511,
+	0x1552114, 0x1552123, 0x1552132, 0x1552141, 0x1552213, 0x1552222, 0x1552231, 0x1552312,
+	0x1552321, 0x1552411, 0x1553113, 0x1553122, 0x1553131, 0x1553212, 0x1553221, 0x1553311,
+	0x1554112, 0x1554121, 0x1554211, 0x1555111, 0x1561114, 0x1561123, 0x1561132, 0x1561141,
+	0x1561213, 0x1561222, 0x1561231, 0x1561312, 0x1561321, 0x1561411, 0x1562113, 0x1562122,
+	0x1562131, 0x1562212, 0x1562221, 0x1562311, 0x1563112, 0x1563121, 0x1563211, 0x1564111,
+	0x1571113, 0x1571122, 0x1571131, 0x1571212, 0x1571221, 0x1571311, 0x1572112, 0x1572121,
+	0x1572211, 0x1573111, 0x1581112, 0x1581121, 0x1581211, 0x1582111, 0x1611118, 0x1611127,
+	0x1611136, 0x1611145, 0x1611154, 0x1611163, 0x1611172, 0x1611181, 0x1611217, 0x1611226,
+	0x1611235, 0x1611244, 0x1611253, 0x1611262, 0x1611271, 0x1611316, 0x1611325, 0x1611334,
+	0x1611343, 0x1611352, 0x1611361, 0x1611415, 0x1611424, 0x1611433, 0x1611442, 0x1611451,
+	0x1611514, 0x1611523, 0x1611532, 0x1611541, 0x1611613, 0x1611622, 0x1611631, 0x1611712,
+	0x1611721, 0x1611811, 0x1612117, 0x1612126, 0x1612135, 0x1612144, 0x1612153, 0x1612162,
+	0x1612171, 0x1612216, 0x1612225, 0x1612234, 0x1612243, 0x1612252, 0x1612261, 0x1612315,
+	0x1612324, 0x1612333, 0x1612342, 0x1612351, 0x1612414, 0x1612423, 0x1612432, 0x1612441,
+	0x1612513, 0x1612522, 0x1612531, 0x1612612, 0x1612621, 0x1612711, 0x1613116, 0x1613125,
+	0x1613134, 0x1613143, 0x1613152, 0x1613161, 0x1613215, 0x1613224, 0x1613233, 0x1613242,
+	0x1613251, 0x1613314, 0x1613323, 0x1613332, 0x1613341, 0x1613413, 0x1613422, 0x1613431,
+	0x1613512, 0x1613521, 0x1613611, 0x1614115, 0x1614124, 0x1614133, 0x1614142, 0x1614151,
+	0x1614214, 0x1614223, 0x1614232, 0x1614241, 0x1614313, 0x1614322, 0x1614331, 0x1614412,
+	0x1614421, 0x1614511, 0x1615114, 0x1615123, 0x1615132, 0x1615141, 0x1615213, 0x1615222,
+	0x1615231, 0x1615312, 0x1615321, 0x1615411, 0x1616113, 0x1616122, 0x1616131, 0x1616212,
+	0x1616221, 0x1616311, 0x1617112, 0x1617121, 0x1617211, 0x1618111, 0x1621117, 0x1621126,
+	0x1621135, 0x1621144, 0x1621153, 0x1621162, 0x1621171, 0x1621216, 0x1621225, 0x1621234,
+	0x1621243, 0x1621252, 0x1621261, 0x1621315, 0x1621324, 0x1621333, 0x1621342, 0x1621351,
+	0x1621414, 0x1621423, 0x1621432, 0x1621441, 0x1621513, 0x1621522, 0x1621531, 0x1621612,
+	0x1621621, 0x1621711, 0x1622116, 0x1622125, 0x1622134, 0x1622143, 0x1622152, 0x1622161,
+	0x1622215, 0x1622224, 0x1622233, 0x1622242, 0x1622251, 0x1622314, 0x1622323, 0x1622332,
+	0x1622341, 0x1622413, 0x1622422, 0x1622431, 0x1622512, 0x1622521, 0x1622611, 0x1623115,
+	0x1623124, 0x1623133, 0x1623142, 0x1623151, 0x1623214, 0x1623223, 0x1623232, 0x1623241,
+	0x1623313, 0x1623322, 0x1623331, 0x1623412, 0x1623421, 0x1623511, 0x1624114, 0x1624123,
+	0x1624132, 0x1624141, 0x1624213, 0x1624222, 0x1624231, 0x1624312, 0x1624321, 0x1624411,
+	0x1625113, 0x1625122, 0x1625131, 0x1625212, 0x1625221, 0x1625311, 0x1626112, 0x1626121,
+	0x1626211, 0x1627111, 0x1631116, 0x1631125, 0x1631134, 0x1631143, 0x1631152, 0x1631161,
+	0x1631215, 0x1631224, 0x1631233, 0x1631242, 0x1631251, 0x1631314, 0x1631323, 0x1631332,
+	0x1631341, 0x1631413, 0x1631422, 0x1631431, 0x1631512, 0x1631521, 0x1631611, 0x1632115,
+	0x1632124, 0x1632133, 0x1632142, 0x1632151, 0x1632214, 0x1632223, 0x1632232, 0x1632241,
+	0x1632313, 0x1632322, 0x1632331, 0x1632412, 0x1632421, 0x1632511, 0x1633114, 0x1633123,
+	0x1633132, 0x1633141, 0x1633213, 0x1633222, 0x1633231, 0x1633312, 0x1633321, 0x1633411,
+	0x1634113, 0x1634122, 0x1634131, 0x1634212, 0x1634221, 0x1634311, 0x1635112, 0x1635121,
+	0x1635211, 0x1636111, 0x1641115, 0x1641124, 0x1641133, 0x1641142, 0x1641151, 0x1641214,
+	0x1641223, 0x1641232, 0x1641241, 0x1641313, 0x1641322, 0x1641331, 0x1641412, 0x1641421,
+	0x1641511, 0x1642114, 0x1642123, 0x1642132, 0x1642141, 0x1642213, 0x1642222, 0x1642231,
+	0x1642312, 0x1642321, 0x1642411, 0x1643113, 0x1643122, 0x1643131, 0x1643212, 0x1643221,
+	0x1643311, 0x1644112, 0x1644121, 0x1644211, 0x1645111, 0x1651114, 0x1651123, 0x1651132,
+	0x1651141, 0x1651213, 0x1651222, 0x1651231, 0x1651312, 0x1651321, 0x1651411, 0x1652113,
+	0x1652122, 0x1652131, 0x1652212, 0x1652221, 0x1652311, 0x1653112, 0x1653121, 0x1653211,
+	0x1654111, 0x1661113, 0x1661122, 0x1661131, 0x1661212, 0x1661221, 0x1661311, 0x1662112,
+	0x1662121, 0x1662211, 0x1663111, 0x1671112, 0x1671121, 0x1671211, 0x1672111, 0x1681111,
+	0x1711117, 0x1711126, 0x1711135, 0x1711144, 0x1711153, 0x1711162, 0x1711171, 0x1711216,
+	0x1711225, 0x1711234, 0x1711243, 0x1711252, 0x1711261, 0x1711315, 0x1711324, 0x1711333,
+	0x1711342, 0x1711351, 0x1711414, 0x1711423, 0x1711432, 0x1711441, 0x1711513, 0x1711522,
+	0x1711531, 0x1711612, 0x1711621, 0x1711711, 0x1712116, 0x1712125, 0x1712134, 0x1712143,
+	0x1712152, 0x1712161, 0x1712215, 0x1712224, 0x1712233, 0x1712242, 0x1712251, 0x1712314,
+	0x1712323, 0x1712332, 0x1712341, 0x1712413, 0x1712422, 0x1712431, 0x1712512, 0x1712521,
+	0x1712611, 0x1713115, 0x1713124, 0x1713133, 0x1713142, 0x1713151, 0x1713214, 0x1713223,
+	0x1713232, 0x1713241, 0x1713313, 0x1713322, 0x1713331, 0x1713412, 0x1713421, 0x1713511,
+	0x1714114, 0x1714123, 0x1714132, 0x1714141, 0x1714213, 0x1714222, 0x1714231, 0x1714312,
+	0x1714321, 0x1714411, 0x1715113, 0x1715122, 0x1715131, 0x1715212, 0x1715221, 0x1715311,
+	0x1716112, 0x1716121, 0x1716211, 0x1717111, 0x1721116, 0x1721125, 0x1721134, 0x1721143,
+	0x1721152, 0x1721161, 0x1721215, 0x1721224, 0x1721233, 0x1721242, 0x1721251, 0x1721314,
+	0x1721323, 0x1721332, 0x1721341, 0x1721413, 0x1721422, 0x1721431, 0x1721512, 0x1721521,
+	0x1721611, 0x1722115, 0x1722124, 0x1722133, 0x1722142, 0x1722151, 0x1722214, 0x1722223,
+	0x1722232, 0x1722241, 0x1722313, 0x1722322, 0x1722331, 0x1722412, 0x1722421, 0x1722511,
+	0x1723114, 0x1723123, 0x1723132, 0x1723141, 0x1723213, 0x1723222, 0x1723231, 0x1723312,
+	0x1723321, 0x1723411, 0x1724113, 0x1724122, 0x1724131, 0x1724212, 0x1724221, 0x1724311,
+	0x1725112, 0x1725121, 0x1725211, 0x1726111, 0x1731115, 0x1731124, 0x1731133, 0x1731142,
+	0x1731151, 0x1731214, 0x1731223, 0x1731232, 0x1731241, 0x1731313, 0x1731322, 0x1731331,
+	0x1731412, 0x1731421, 0x1731511, 0x1732114, 0x1732123, 0x1732132, 0x1732141, 0x1732213,
+	0x1732222, 0x1732231, 0x1732312, 0x1732321, 0x1732411, 0x1733113, 0x1733122, 0x1733131,
+	0x1733212, 0x1733221, 0x1733311, 0x1734112, 0x1734121, 0x1734211, 0x1735111, 0x1741114,
+	0x1741123, 0x1741132, 0x1741141, 0x1741213, 0x1741222, 0x1741231, 0x1741312, 0x1741321,
+	0x1741411, 0x1742113, 0x1742122, 0x1742131, 0x1742212, 0x1742221, 0x1742311, 0x1743112,
+	0x1743121, 0x1743211, 0x1744111, 0x1751113, 0x1751122, 0x1751131, 0x1751212, 0x1751221,
+	0x1751311, 0x1752112, 0x1752121, 0x1752211, 0x1753111, 0x1761112, 0x1761121, 0x1761211,
+	0x1762111, 0x1771111, 0x1811116, 0x1811125, 0x1811134, 0x1811143, 0x1811152, 0x1811161,
+	0x1811215, 0x1811224, 0x1811233, 0x1811242, 0x1811251, 0x1811314, 0x1811323, 0x1811332,
+	0x1811341, 0x1811413, 0x1811422, 0x1811431, 0x1811512, 0x1811521, 0x1811611, 0x1812115,
+	0x1812124, 0x1812133, 0x1812142, 0x1812151, 0x1812214, 0x1812223, 0x1812232, 0x1812241,
+	0x1812313, 0x1812322, 0x1812331, 0x1812412, 0x1812421, 0x1812511, 0x1813114, 0x1813123,
+	0x1813132, 0x1813141, 0x1813213, 0x1813222, 0x1813231, 0x1813312, 0x1813321, 0x1813411,
+	0x1814113, 0x1814122, 0x1814131, 0x1814212, 0x1814221, 0x1814311, 0x1815112, 0x1815121,
+	0x1815211, 0x1816111, 0x1821115, 0x1821124, 0x1821133, 0x1821142, 0x1821151, 0x1821214,
+	0x1821223, 0x1821232, 0x1821241, 0x1821313, 0x1821322, 0x1821331, 0x1821412, 0x1821421,
+	0x1821511, 0x1822114, 0x1822123, 0x1822132, 0x1822141, 0x1822213, 0x1822222, 0x1822231,
+	0x1822312, 0x1822321, 0x1822411, 0x1823113, 0x1823122, 0x1823131, 0x1823212, 0x1823221,
+	0x1823311, 0x1824112, 0x1824121, 0x1824211, 0x1825111, 0x1831114, 0x1831123, 0x1831132,
+	0x1831141, 0x1831213, 0x1831222, 0x1831231, 0x1831312, 0x1831321, 0x1831411, 0x1832113,
+	0x1832122, 0x1832131, 0x1832212, 0x1832221, 0x1832311, 0x1833112, 0x1833121, 0x1833211,
+	0x1834111, 0x1841113, 0x1841122, 0x1841131, 0x1841212, 0x1841221, 0x1841311, 0x1842112,
+	0x1842121, 0x1842211, 0x1843111, 0x1851112, 0x1851121, 0x1851211, 0x1852111, 0x1861111,
+	0x2111158, 0x2111167, 0x2111176, 0x2111185, 0x2111248, 0x2111257, 0x2111266, 0x2111275,
+	0x2111284, 0x2111338, 0x2111347, 0x2111356, 0x2111365, 0x2111374, 0x2111383, 0x2111428,
+	0x2111437, 0x2111446, 0x2111455, 0x2111464, 0x2111473, 0x2111482, 0x2111518, 0x2111527,
+	0x2111536, 0x2111545, 0x2111554, 0x2111563, 0x2111572, 0x2111581, 0x2111617, 0x2111626,
+	0x2111635, 0x2111644, 0x2111653, 0x2111662, 0x2111671, 0x2111716, 0x2111725, 0x2111734,
+	0x2111743, 0x2111752, 0x2111761, 0x2111815, 0x2111824, 0x2111833, 0x2111842, 0x2111851,
+	0x2112148, 0x2112157, 0x2112166, 0x2112175, 0x2112184, 0x2112238, 0x2112247, 0x2112256,
+	0x2112265, 0x2112274, 0x2112283, 0x2112328, 0x2112337, 0x2112346, 0x2112355, 0x2112364,
+	0x2112373, 0x2112382, 0x2112418, 0x2112427, 0x2112436, 0x2112445, 0x2112454, 0x2112463,
+	0x2112472, 0x2112481, 0x2112517, 0x2112526, 0x2112535, 0x2112544, 0x2112553, 0x2112562,
+	0x2112571, 0x2112616, 0x2112625, 0x2112634, 0x2112643, 0x2112652, 0x2112661, 0x2112715,
+	0x2112724, 0x2112733, 0x2112742, 0x2112751, 0x2112814, 0x2112823, 0x2112832, 0x2112841,
+	0x2113138, 0x2113147, 0x2113156, 0x2113165, 0x2113174, 0x2113183, 0x2113228, 0x2113237,
+	0x2113246, 0x2113255, 0x2113264, 0x2113273, 0x2113282, 0x2113318, 0x2113327, 0x2113336,
+	0x2113345, 0x2113354, 0x2113363, 0x2113372, 0x2113381, 0x2113417, 0x2113426, 0x2113435,
+	0x2113444, 0x2113453, 0x2113462, 0x2113471, 0x2113516, 0x2113525, 0x2113534, 0x2113543,
+	0x2113552, 0x2113561, 0x2113615, 0x2113624, 0x2113633, 0x2113642, 0x2113651, 0x2113714,
+	0x2113723, 0x2113732, 0x2113741, 0x2113813, 0x2113822, 0x2113831, 0x2114128, 0x2114137,
+	0x2114146, 0x2114155, 0x2114164, 0x2114173, 0x2114182, 0x2114218, 0x2114227, 0x2114236,
+	0x2114245, 0x2114254, 0x2114263, 0x2114272, 0x2114281, 0x2114317, 0x2114326, 0x2114335,
+	0x2114344, 0x2114353, 0x2114362, 0x2114371, 0x2114416, 0x2114425, 0x2114434, 0x2114443,
+	0x2114452, 0x2114461, 0x2114515, 0x2114524, 0x2114533, 0x2114542, 0x2114551, 0x2114614,
+	0x2114623, 0x2114632, 0x2114641, 0x2114713, 0x2114722, 0x2114731, 0x2114812, 0x2114821,
+	0x2115118, 0x2115127, 0x2115136, 0x2115145, 0x2115154, 0x2115163, 0x2115172, 0x2115181,
+	0x2115217, 0x2115226, 0x2115235, 0x2115244, 0x2115253, 0x2115262, 0x2115271, 0x2115316,
+	0x2115325, 0x2115334, 0x2115343, 0x2115352, 0x2115361, 0x2115415, 0x2115424, 0x2115433,
+	0x2115442, 0x2115451, 0x2115514, 0x2115523, 0x2115532, 0x2115541, 0x2115613, 0x2115622,
+	0x2115631, 0x2115712, 0x2115721, 0x2115811, 0x2116117, 0x2116126, 0x2116135, 0x2116144,
+	0x2116153, 0x2116162, 0x2116171, 0x2116216, 0x2116225, 0x2116234, 0x2116243, 0x2116252,
+	0x2116261, 0x2116315, 0x2116324, 0x2116333, 0x2116342, 0x2116351, 0x2116414, 0x2116423,
+	0x2116432, 0x2116441, 0x2116513, 0x2116522, 0x2116531, 0x2116612, 0x2116621, 0x2116711,
+	0x2117116, 0x2117125, 0x2117134, 0x2117143, 0x2117152, 0x2117161, 0x2117215, 0x2117224,
+	0x2117233, 0x2117242, 0x2117251, 0x2117314, 0x2117323, 0x2117332, 0x2117341, 0x2117413,
+	0x2117422, 0x2117431, 0x2117512, 0x2117521, 0x2117611, 0x2118115, 0x2118124, 0x2118133,
+	0x2118142, 0x2118151, 0x2118214, 0x2118223, 0x2118232, 0x2118241, 0x2118313, 0x2118322,
+	0x2118331, 0x2118412, 0x2118421, 0x2118511, 0x2121148, 0x2121157, 0x2121166, 0x2121175,
+	0x2121184, 0x2121238, 0x2121247, 0x2121256, 0x2121265, 0x2121274, 0x2121283, 0x2121328,
+	0x2121337, 0x2121346, 0x2121355, 0x2121364, 0x2121373, 0x2121382, 0x2121418, 0x2121427,
+	0x2121436, 0x2121445, 0x2121454, 0x2121463, 0x2121472, 0x2121481, 0x2121517, 0x2121526,
+	0x2121535, 0x2121544, 0x2121553, 0x2121562, 0x2121571, 0x2121616, 0x2121625, 0x2121634,
+	0x2121643, 0x2121652, 0x2121661, 0x2121715, 0x2121724, 0x2121733, 0x2121742, 0x2121751,
+	0x2121814, 0x2121823, 0x2121832, 0x2121841, 0x2122138, 0x2122147, 0x2122156, 0x2122165,
+	0x2122174, 0x2122183, 0x2122228, 0x2122237, 0x2122246, 0x2122255, 0x2122264, 0x2122273,
+	0x2122282, 0x2122318, 0x2122327, 0x2122336, 0x2122345, 0x2122354, 0x2122363, 0x2122372,
+	0x2122381, 0x2122417, 0x2122426, 0x2122435, 0x2122444, 0x2122453, 0x2122462, 0x2122471,
+	0x2122516, 0x2122525, 0x2122534, 0x2122543, 0x2122552, 0x2122561, 0x2122615, 0x2122624,
+	0x2122633, 0x2122642, 0x2122651, 0x2122714, 0x2122723, 0x2122732, 0x2122741, 0x2122813,
+	0x2122822, 0x2122831, 0x2123128, 0x2123137, 0x2123146, 0x2123155, 0x2123164, 0x2123173,
+	0x2123182, 0x2123218, 0x2123227, 0x2123236, 0x2123245, 0x2123254, 0x2123263, 0x2123272,
+	0x2123281, 0x2123317, 0x2123326, 0x2123335, 0x2123344, 0x2123353, 0x2123362, 0x2123371,
+	0x2123416, 0x2123425, 0x2123434, 0x2123443, 0x2123452, 0x2123461, 0x2123515, 0x2123524,
+	0x2123533, 0x2123542, 0x2123551, 0x2123614, 0x2123623, 0x2123632, 0x2123641, 0x2123713,
+	0x2123722, 0x2123731, 0x2123812, 0x2123821, 0x2124118, 0x2124127, 0x2124136, 0x2124145,
+	0x2124154, 0x2124163, 0x2124172, 0x2124181, 0x2124217, 0x2124226, 0x2124235, 0x2124244,
+	0x2124253, 0x2124262, 0x2124271, 0x2124316, 0x2124325, 0x2124334, 0x2124343, 0x2124352,
+	0x2124361, 0x2124415, 0x2124424, 0x2124433, 0x2124442, 0x2124451, 0x2124514, 0x2124523,
+	0x2124532, 0x2124541, 0x2124613, 0x2124622, 0x2124631, 0x2124712, 0x2124721, 0x2124811,
+	0x2125117, 0x2125126, 0x2125135, 0x2125144, 0x2125153, 0x2125162, 0x2125171, 0x2125216,
+	0x2125225, 0x2125234, 0x2125243, 0x2125252, 0x2125261, 0x2125315, 0x2125324, 0x2125333,
+	0x2125342, 0x2125351, 0x2125414, 0x2125423, 0x2125432, 0x2125441, 0x2125513, 0x2125522,
+	0x2125531, 0x2125612, 0x2125621, 0x2125711, 0x2126116, 0x2126125, 0x2126134, 0x2126143,
+	0x2126152, 0x2126161, 0x2126215, 0x2126224, 0x2126233, 0x2126242, 0x2126251, 0x2126314,
+	0x2126323, 0x2126332, 0x2126341, 0x2126413, 0x2126422, 0x2126431, 0x2126512, 0x2126521,
+	0x2126611, 0x2127115, 0x2127124, 0x2127133, 0x2127142, 0x2127151, 0x2127214, 0x2127223,
+	0x2127232, 0x2127241, 0x2127313, 0x2127322, 0x2127331, 0x2127412, 0x2127421, 0x2127511,
+	0x2128114, 0x2128123, 0x2128132, 0x2128141, 0x2128213, 0x2128222, 0x2128231, 0x2128312,
+	0x2128321, 0x2128411, 0x2131138, 0x2131147, 0x2131156, 0x2131165, 0x2131174, 0x2131183,
+	0x2131228, 0x2131237, 0x2131246, 0x2131255, 0x2131264, 0x2131273, 0x2131282, 0x2131318,
+	0x2131327, 0x2131336, 0x2131345, 0x2131354, 0x2131363, 0x2131372, 0x2131381, 0x2131417,
+	0x2131426, 0x2131435, 0x2131444, 0x2131453, 0x2131462, 0x2131471, 0x2131516, 0x2131525,
+	0x2131534, 0x2131543, 0x2131552, 0x2131561, 0x2131615, 0x2131624, 0x2131633, 0x2131642,
+	0x2131651, 0x2131714, 0x2131723, 0x2131732, 0x2131741, 0x2131813, 0x2131822, 0x2131831,
+	0x2132128, 0x2132137, 0x2132146, 0x2132155, 0x2132164, 0x2132173, 0x2132182, 0x2132218,
+	0x2132227, 0x2132236, 0x2132245, 0x2132254, 0x2132263, 0x2132272, 0x2132281, 0x2132317,
+	0x2132326, 0x2132335, 0x2132344, 0x2132353, 0x2132362, 0x2132371, 0x2132416, 0x2132425,
+	0x2132434, 0x2132443, 0x2132452, 0x2132461, 0x2132515, 0x2132524, 0x2132533, 0x2132542,
+	0x2132551, 0x2132614, 0x2132623, 0x2132632, 0x2132641, 0x2132713, 0x2132722, 0x2132731,
+	0x2132812, 0x2132821, 0x2133118, 0x2133127, 0x2133136, 0x2133145, 0x2133154, 0x2133163,
+	0x2133172, 0x2133181, 0x2133217, 0x2133226, 0x2133235, 0x2133244, 0x2133253, 0x2133262,
+	0x2133271, 0x2133316, 0x2133325, 0x2133334, 0x2133343, 0x2133352, 0x2133361, 0x2133415,
+	0x2133424, 0x2133433, 0x2133442, 0x2133451, 0x2133514, 0x2133523, 0x2133532, 0x2133541,
+	0x2133613, 0x2133622, 0x2133631, 0x2133712, 0x2133721, 0x2133811, 0x2134117, 0x2134126,
+	0x2134135, 0x2134144, 0x2134153, 0x2134162, 0x2134171, 0x2134216, 0x2134225, 0x2134234,
+	0x2134243, 0x2134252, 0x2134261, 0x2134315, 0x2134324, 0x2134333, 0x2134342, 0x2134351,
+	0x2134414, 0x2134423, 0x2134432, 0x2134441, 0x2134513, 0x2134522, 0x2134531, 0x2134612,
+	0x2134621, 0x2134711, 0x2135116, 0x2135125, 0x2135134, 0x2135143, 0x2135152, 0x2135161,
+	0x2135215, 0x2135224, 0x2135233, 0x2135242, 0x2135251, 0x2135314, 0x2135323, 0x2135332,
+	0x2135341, 0x2135413, 0x2135422, 0x2135431, 0x2135512, 0x2135521, 0x2135611, 0x2136115,
+	0x2136124, 0x2136133, 0x2136142, 0x2136151, 0x2136214, 0x2136223, 0x2136232, 0x2136241,
+	0x2136313, 0x2136322, 0x2136331, 0x2136412, 0x2136421, 0x2136511, 0x2137114, 0x2137123,
+	0x2137132, 0x2137141, 0x2137213, 0x2137222, 0x2137231, 0x2137312, 0x2137321, 0x2137411,
+	0x2138113, 0x2138122, 0x2138131, 0x2138212, 0x2138221, 0x2138311, 0x2141128, 0x2141137,
+	0x2141146, 0x2141155, 0x2141164, 0x2141173, 0x2141182, 0x2141218, 0x2141227, 0x2141236,
+	0x2141245, 0x2141254, 0x2141263, 0x2141272, 0x2141281, 0x2141317, 0x2141326, 0x2141335,
+	0x2141344, 0x2141353, 0x2141362, 0x2141371, 0x2141416, 0x2141425, 0x2141434, 0x2141443,
+	0x2141452, 0x2141461, 0x2141515, 0x2141524, 0x2141533, 0x2141542, 0x2141551, 0x2141614,
+	0x2141623, 0x2141632, 0x2141641, 0x2141713, 0x2141722, 0x2141731, 0x2141812, 0x2141821,
+	0x2142118, 0x2142127, 0x2142136, 0x2142145, 0x2142154, 0x2142163, 0x2142172, 0x2142181,
+	0x2142217, 0x2142226, 0x2142235, 0x2142244, 0x2142253, 0x2142262, 0x2142271, 0x2142316,
+	0x2142325, 0x2142334, 0x2142343, 0x2142352, 0x2142361, 0x2142415, 0x2142424, 0x2142433,
+	0x2142442, 0x2142451, 0x2142514, 0x2142523, 0x2142532, 0x2142541, 0x2142613, 0x2142622,
+	0x2142631, 0x2142712, 0x2142721, 0x2142811, 0x2143117, 0x2143126, 0x2143135, 0x2143144,
+	0x2143153, 0x2143162, 0x2143171, 0x2143216, 0x2143225, 0x2143234, 0x2143243, 0x2143252,
+	0x2143261, 0x2143315, 0x2143324, 0x2143333, 0x2143342, 0x2143351, 0x2143414, 0x2143423,
+	0x2143432, 0x2143441, 0x2143513, 0x2143522, 0x2143531, 0x2143612, 0x2143621, 0x2143711,
+	0x2144116, 0x2144125, 0x2144134, 0x2144143, 0x2144152, 0x2144161, 0x2144215, 0x2144224,
+	0x2144233, 0x2144242, 0x2144251, 0x2144314, 0x2144323, 0x2144332, 0x2144341, 0x2144413,
+	0x2144422, 0x2144431, 0x2144512, 0x2144521, 0x2144611, 0x2145115, 0x2145124, 0x2145133,
+	0x2145142, 0x2145151, 0x2145214, 0x2145223, 0x2145232, 0x2145241, 0x2145313, 0x2145322,
+	0x2145331, 0x2145412, 0x2145421, 0x2145511, 0x2146114, 0x2146123, 0x2146132, 0x2146141,
+	0x2146213, 0x2146222, 0x2146231, 0x2146312, 0x2146321, 0x2146411, 0x2147113, 0x2147122,
+	0x2147131, 0x2147212, 0x2147221, 0x2147311, 0x2148112, 0x2148121, 0x2148211, 0x2151118,
+	0x2151127, 0x2151136, 0x2151145, 0x2151154, 0x2151163, 0x2151172, 0x2151181, 0x2151217,
+	0x2151226, 0x2151235, 0x2151244, 0x2151253, 0x2151262, 0x2151271, 0x2151316, 0x2151325,
+	0x2151334, 0x2151343, 0x2151352, 0x2151361, 0x2151415, 0x2151424, 0x2151433, 0x2151442,
+	0x2151451, 0x2151514, 0x2151523, 0x2151532, 0x2151541, 0x2151613, 0x2151622, 0x2151631,
+	0x2151712, 0x2151721, 0x2151811, 0x2152117, 0x2152126, 0x2152135, 0x2152144, 0x2152153,
+	0x2152162, 0x2152171, 0x2152216, 0x2152225, 0x2152234, 0x2152243, 0x2152252, 0x2152261,
+	0x2152315, 0x2152324, 0x2152333, 0x2152342, 0x2152351, 0x2152414, 0x2152423, 0x2152432,
+	0x2152441, 0x2152513, 0x2152522, 0x2152531, 0x2152612, 0x2152621, 0x2152711, 0x2153116,
+	0x2153125, 0x2153134, 0x2153143, 0x2153152, 0x2153161, 0x2153215, 0x2153224, 0x2153233,
+	0x2153242, 0x2153251, 0x2153314, 0x2153323, 0x2153332, 0x2153341, 0x2153413, 0x2153422,
+	0x2153431, 0x2153512, 0x2153521, 0x2153611, 0x2154115, 0x2154124, 0x2154133, 0x2154142,
+	0x2154151, 0x2154214, 0x2154223, 0x2154232, 0x2154241, 0x2154313, 0x2154322, 0x2154331,
+	0x2154412, 0x2154421, 0x2154511, 0x2155114, 0x2155123, 0x2155132, 0x2155141, 0x2155213,
+	0x2155222, 0x2155231, 0x2155312, 0x2155321, 0x2155411, 0x2156113, 0x2156122, 0x2156131,
+	0x2156212, 0x2156221, 0x2156311, 0x2157112, 0x2157121, 0x2157211, 0x2158111, 0x2161117,
+	0x2161126, 0x2161135, 0x2161144, 0x2161153, 0x2161162, 0x2161171, 0x2161216, 0x2161225,
+	0x2161234, 0x2161243, 0x2161252, 0x2161261, 0x2161315, 0x2161324, 0x2161333, 0x2161342,
+	0x2161351, 0x2161414, 0x2161423, 0x2161432, 0x2161441, 0x2161513, 0x2161522, 0x2161531,
+	0x2161612, 0x2161621, 0x2161711, 0x2162116, 0x2162125, 0x2162134, 0x2162143, 0x2162152,
+	0x2162161, 0x2162215, 0x2162224, 0x2162233, 0x2162242, 0x2162251, 0x2162314, 0x2162323,
+	0x2162332, 0x2162341, 0x2162413, 0x2162422, 0x2162431, 0x2162512, 0x2162521, 0x2162611,
+	0x2163115, 0x2163124, 0x2163133, 0x2163142, 0x2163151, 0x2163214, 0x2163223, 0x2163232,
+	0x2163241, 0x2163313, 0x2163322, 0x2163331, 0x2163412, 0x2163421, 0x2163511, 0x2164114,
+	0x2164123, 0x2164132, 0x2164141, 0x2164213, 0x2164222, 0x2164231, 0x2164312, 0x2164321,
+	0x2164411, 0x2165113, 0x2165122, 0x2165131, 0x2165212, 0x2165221, 0x2165311, 0x2166112,
+	0x2166121, 0x2166211, 0x2167111, 0x2171116, 0x2171125, 0x2171134, 0x2171143, 0x2171152,
+	0x2171161, 0x2171215, 0x2171224, 0x2171233, 0x2171242, 0x2171251, 0x2171314, 0x2171323,
+	0x2171332, 0x2171341, 0x2171413, 0x2171422, 0x2171431, 0x2171512, 0x2171521, 0x2171611,
+	0x2172115, 0x2172124, 0x2172133, 0x2172142, 0x2172151, 0x2172214, 0x2172223, 0x2172232,
+	0x2172241, 0x2172313, 0x2172322, 0x2172331, 0x2172412, 0x2172421, 0x2172511, 0x2173114,
+	0x2173123, 0x2173132, 0x2173141, 0x2173213, 0x2173222, 0x2173231, 0x2173312, 0x2173321,
+	0x2173411, 0x2174113, 0x2174122, 0x2174131, 0x2174212, 0x2174221, 0x2174311, 0x2175112,
+	0x2175121, 0x2175211, 0x2176111, 0x2181115, 0x2181124, 0x2181133, 0x2181142, 0x2181151,
+	0x2181214, 0x2181223, 0x2181232, 0x2181241, 0x2181313, 0x2181322, 0x2181331, 0x2181412,
+	0x2181421, 0x2181511, 0x2182114, 0x2182123, 0x2182132, 0x2182141, 0x2182213, 0x2182222,
+	0x2182231, 0x2182312, 0x2182321, 0x2182411, 0x2183113, 0x2183122, 0x2183131, 0x2183212,
+	0x2183221, 0x2183311, 0x2184112, 0x2184121, 0x2184211, 0x2185111, 0x2211148, 0x2211157,
+	0x2211166, 0x2211175, 0x2211184, 0x2211238, 0x2211247, 0x2211256, 0x2211265, 0x2211274,
+	0x2211283, 0x2211328, 0x2211337, 0x2211346, 0x2211355, 0x2211364, 0x2211373, 0x2211382,
+	0x2211418, 0x2211427, 0x2211436, 0x2211445, 0x2211454, 0x2211463, 0x2211472, 0x2211481,
+	0x2211517, 0x2211526, 0x2211535, 0x2211544, 0x2211553, 0x2211562, 0x2211571, 0x2211616,
+	0x2211625, 0x2211634, 0x2211643, 0x2211652, 0x2211661, 0x2211715, 0x2211724, 0x2211733,
+	0x2211742, 0x2211751, 0x2211814, 0x2211823, 0x2211832, 0x2211841, 0x2212138, 0x2212147,
+	0x2212156, 0x2212165, 0x2212174, 0x2212183, 0x2212228, 0x2212237, 0x2212246, 0x2212255,
+	0x2212264, 0x2212273, 0x2212282, 0x2212318, 0x2212327, 0x2212336, 0x2212345, 0x2212354,
+	0x2212363, 0x2212372, 0x2212381, 0x2212417, 0x2212426, 0x2212435, 0x2212444, 0x2212453,
+	0x2212462, 0x2212471, 0x2212516, 0x2212525, 0x2212534, 0x2212543, 0x2212552, 0x2212561,
+	0x2212615, 0x2212624, 0x2212633, 0x2212642, 0x2212651, 0x2212714, 0x2212723, 0x2212732,
+	0x2212741, 0x2212813, 0x2212822, 0x2212831, 0x2213128, 0x2213137, 0x2213146, 0x2213155,
+	0x2213164, 0x2213173, 0x2213182, 0x2213218, 0x2213227, 0x2213236, 0x2213245, 0x2213254,
+	0x2213263, 0x2213272, 0x2213281, 0x2213317, 0x2213326, 0x2213335, 0x2213344, 0x2213353,
+	0x2213362, 0x2213371, 0x2213416, 0x2213425, 0x2213434, 0x2213443, 0x2213452, 0x2213461,
+	0x2213515, 0x2213524, 0x2213533, 0x2213542, 0x2213551, 0x2213614, 0x2213623, 0x2213632,
+	0x2213641, 0x2213713, 0x2213722, 0x2213731, 0x2213812, 0x2213821, 0x2214118, 0x2214127,
+	0x2214136, 0x2214145, 0x2214154, 0x2214163, 0x2214172, 0x2214181, 0x2214217, 0x2214226,
+	0x2214235, 0x2214244, 0x2214253, 0x2214262, 0x2214271, 0x2214316, 0x2214325, 0x2214334,
+	0x2214343, 0x2214352, 0x2214361, 0x2214415, 0x2214424, 0x2214433, 0x2214442, 0x2214451,
+	0x2214514, 0x2214523, 0x2214532, 0x2214541, 0x2214613, 0x2214622, 0x2214631, 0x2214712,
+	0x2214721, 0x2214811, 0x2215117, 0x2215126, 0x2215135, 0x2215144, 0x2215153, 0x2215162,
+	0x2215171, 0x2215216, 0x2215225, 0x2215234, 0x2215243, 0x2215252, 0x2215261, 0x2215315,
+	0x2215324, 0x2215333, 0x2215342, 0x2215351, 0x2215414, 0x2215423, 0x2215432, 0x2215441,
+	0x2215513, 0x2215522, 0x2215531, 0x2215612, 0x2215621, 0x2215711, 0x2216116, 0x2216125,
+	0x2216134, 0x2216143, 0x2216152, 0x2216161, 0x2216215, 0x2216224, 0x2216233, 0x2216242,
+	0x2216251, 0x2216314, 0x2216323, 0x2216332, 0x2216341, 0x2216413, 0x2216422, 0x2216431,
+	0x2216512, 0x2216521, 0x2216611, 0x2217115, 0x2217124, 0x2217133, 0x2217142, 0x2217151,
+	0x2217214, 0x2217223, 0x2217232, 0x2217241, 0x2217313, 0x2217322, 0x2217331, 0x2217412,
+	0x2217421, 0x2217511, 0x2218114, 0x2218123, 0x2218132, 0x2218141, 0x2218213, 0x2218222,
+	0x2218231, 0x2218312, 0x2218321, 0x2218411, 0x2221138, 0x2221147, 0x2221156, 0x2221165,
+	0x2221174, 0x2221183, 0x2221228, 0x2221237, 0x2221246, 0x2221255, 0x2221264, 0x2221273,
+	0x2221282, 0x2221318, 0x2221327, 0x2221336, 0x2221345, 0x2221354, 0x2221363, 0x2221372,
+	0x2221381, 0x2221417, 0x2221426, 0x2221435, 0x2221444, 0x2221453, 0x2221462, 0x2221471,
+	0x2221516, 0x2221525, 0x2221534, 0x2221543, 0x2221552, 0x2221561, 0x2221615, 0x2221624,
+	0x2221633, 0x2221642, 0x2221651, 0x2221714, 0x2221723, 0x2221732, 0x2221741, 0x2221813,
+	0x2221822, 0x2221831, 0x2222128, 0x2222137, 0x2222146, 0x2222155, 0x2222164, 0x2222173,
+	0x2222182, 0x2222218, 0x2222281, 0x2222317, 0x2222371, 0x2222416, 0x2222461, 0x2222515,
+	0x2222551, 0x2222614, 0x2222641, 0x2222713, 0x2222731, 0x2222812, 0x2222821, 0x2223118,
+	0x2223127, 0x2223136, 0x2223145, 0x2223154, 0x2223163, 0x2223172, 0x2223181, 0x2223217,
+	0x2223271, 0x2223316, 0x2223361, 0x2223415, 0x2223451, 0x2223514, 0x2223541, 0x2223613,
+	0x2223631, 0x2223712, 0x2223721, 0x2223811, 0x2224117, 0x2224126, 0x2224135, 0x2224144,
+	0x2224153, 0x2224162, 0x2224171, 0x2224216, 0x2224261, 0x2224315, 0x2224351, 0x2224414,
+	0x2224441, 0x2224513, 0x2224531, 0x2224612, 0x2224621, 0x2224711, 0x2225116, 0x2225125,
+	0x2225134, 0x2225143, 0x2225152, 0x2225161, 0x2225215, 0x2225251, 0x2225314, 0x2225341,
+	0x2225413, 0x2225431, 0x2225512, 0x2225521, 0x2225611, 0x2226115, 0x2226124, 0x2226133,
+	0x2226142, 0x2226151, 0x2226214, 0x2226241, 0x2226313, 0x2226331, 0x2226412, 0x2226421,
+	0x2226511, 0x2227114, 0x2227123, 0x2227132, 0x2227141, 0x2227213, 0x2227231, 0x2227312,
+	0x2227321, 0x2227411, 0x2228113, 0x2228122, 0x2228131, 0x2228212, 0x2228221, 0x2228311,
+	0x2231128, 0x2231137, 0x2231146, 0x2231155, 0x2231164, 0x2231173, 0x2231182, 0x2231218,
+	0x2231227, 0x2231236, 0x2231245, 0x2231254, 0x2231263, 0x2231272, 0x2231281, 0x2231317,
+	0x2231326, 0x2231335, 0x2231344, 0x2231353, 0x2231362, 0x2231371, 0x2231416, 0x2231425,
+	0x2231434, 0x2231443, 0x2231452, 0x2231461, 0x2231515, 0x2231524, 0x2231533, 0x2231542,
+	0x2231551, 0x2231614, 0x2231623, 0x2231632, 0x2231641, 0x2231713, 0x2231722, 0x2231731,
+	0x2231812, 0x2231821, 0x2232118, 0x2232127, 0x2232136, 0x2232145, 0x2232154, 0x2232163,
+	0x2232172, 0x2232181, 0x2232217, 0x2232271, 0x2232316, 0x2232361, 0x2232415, 0x2232451,
+	0x2232514, 0x2232541, 0x2232613, 0x2232631, 0x2232712, 0x2232721, 0x2232811, 0x2233117,
+	0x2233126, 0x2233135, 0x2233144, 0x2233153, 0x2233162, 0x2233171, 0x2233216, 0x2233261,
+	0x2233315, 0x2233351, 0x2233414, 0x2233441, 0x2233513, 0x2233531, 0x2233612, 0x2233621,
+	0x2233711, 0x2234116, 0x2234125, 0x2234134, 0x2234143, 0x2234152, 0x2234161, 0x2234215,
+	0x2234251, 0x2234314, 0x2234341, 0x2234413, 0x2234431, 0x2234512, 0x2234521, 0x2234611,
+	0x2235115, 0x2235124, 0x2235133, 0x2235142, 0x2235151, 0x2235214, 0x2235241, 0x2235313,
+	0x2235331, 0x2235412, 0x2235421, 0x2235511, 0x2236114, 0x2236123, 0x2236132, 0x2236141,
+	0x2236213, 0x2236231, 0x2236312, 0x2236321, 0x2236411, 0x2237113, 0x2237122, 0x2237131,
+	0x2237212, 0x2237221, 0x2237311, 0x2238112, 0x2238121, 0x2238211, 0x2241118, 0x2241127,
+	0x2241136, 0x2241145, 0x2241154, 0x2241163, 0x2241172, 0x2241181, 0x2241217, 0x2241226,
+	0x2241235, 0x2241244, 0x2241253, 0x2241262, 0x2241271, 0x2241316, 0x2241325, 0x2241334,
+	0x2241343, 0x2241352, 0x2241361, 0x2241415, 0x2241424, 0x2241433, 0x2241442, 0x2241451,
+	0x2241514, 0x2241523, 0x2241532, 0x2241541, 0x2241613, 0x2241622, 0x2241631, 0x2241712,
+	0x2241721, 0x2241811, 0x2242117, 0x2242126, 0x2242135, 0x2242144, 0x2242153, 0x2242162,
+	0x2242171, 0x2242216, 0x2242261, 0x2242315, 0x2242351, 0x2242414, 0x2242441, 0x2242513,
+	0x2242531, 0x2242612, 0x2242621, 0x2242711, 0x2243116, 0x2243125, 0x2243134, 0x2243143,
+	0x2243152, 0x2243161, 0x2243215, 0x2243251, 0x2243314, 0x2243341, 0x2243413, 0x2243431,
+	0x2243512, 0x2243521, 0x2243611, 0x2244115, 0x2244124, 0x2244133, 0x2244142, 0x2244151,
+	0x2244214, 0x2244241, 0x2244313, 0x2244331, 0x2244412, 0x2244421, 0x2244511, 0x2245114,
+	0x2245123, 0x2245132, 0x2245141, 0x2245213, 0x2245231, 0x2245312, 0x2245321, 0x2245411,
+	0x2246113, 0x2246122, 0x2246131, 0x2246212, 0x2246221, 0x2246311, 0x2247112, 0x2247121,
+	0x2247211, 0x2248111, 0x2251117, 0x2251126, 0x2251135, 0x2251144, 0x2251153, 0x2251162,
+	0x2251171, 0x2251216, 0x2251225, 0x2251234, 0x2251243, 0x2251252, 0x2251261, 0x2251315,
+	0x2251324, 0x2251333, 0x2251342, 0x2251351, 0x2251414, 0x2251423, 0x2251432, 0x2251441,
+	0x2251513, 0x2251522, 0x2251531, 0x2251612, 0x2251621, 0x2251711, 0x2252116, 0x2252125,
+	0x2252134, 0x2252143, 0x2252152, 0x2252161, 0x2252215, 0x2252251, 0x2252314, 0x2252341,
+	0x2252413, 0x2252431, 0x2252512, 0x2252521, 0x2252611, 0x2253115, 0x2253124, 0x2253133,
+	0x2253142, 0x2253151, 0x2253214, 0x2253241, 0x2253313, 0x2253331, 0x2253412, 0x2253421,
+	0x2253511, 0x2254114, 0x2254123, 0x2254132, 0x2254141, 0x2254213, 0x2254231, 0x2254312,
+	0x2254321, 0x2254411, 0x2255113, 0x2255122, 0x2255131, 0x2255212, 0x2255221, 0x2255311,
+	0x2256112, 0x2256121, 0x2256211, 0x2257111, 0x2261116, 0x2261125, 0x2261134, 0x2261143,
+	0x2261152, 0x2261161, 0x2261215, 0x2261224, 0x2261233, 0x2261242, 0x2261251, 0x2261314,
+	0x2261323, 0x2261332, 0x2261341, 0x2261413, 0x2261422, 0x2261431, 0x2261512, 0x2261521,
+	0x2261611, 0x2262115, 0x2262124, 0x2262133, 0x2262142, 0x2262151, 0x2262214, 0x2262241,
+	0x2262313, 0x2262331, 0x2262412, 0x2262421, 0x2262511, 0x2263114, 0x2263123, 0x2263132,
+	0x2263141, 0x2263213, 0x2263231, 0x2263312, 0x2263321, 0x2263411, 0x2264113, 0x2264122,
+	0x2264131, 0x2264212, 0x2264221, 0x2264311, 0x2265112, 0x2265121, 0x2265211, 0x2266111,
+	0x2271115, 0x2271124, 0x2271133, 0x2271142, 0x2271151, 0x2271214, 0x2271223, 0x2271232,
+	0x2271241, 0x2271313, 0x2271322, 0x2271331, 0x2271412, 0x2271421, 0x2271511, 0x2272114,
+	0x2272123, 0x2272132, 0x2272141, 0x2272213, 0x2272231, 0x2272312, 0x2272321, 0x2272411,
+	0x2273113, 0x2273122, 0x2273131, 0x2273212, 0x2273221, 0x2273311, 0x2274112, 0x2274121,
+	0x2274211, 0x2275111, 0x2281114, 0x2281123, 0x2281132, 0x2281141, 0x2281213, 0x2281222,
+	0x2281231, 0x2281312, 0x2281321, 0x2281411, 0x2282113, 0x2282122, 0x2282131, 0x2282212,
+	0x2282221, 0x2282311, 0x2283112, 0x2283121, 0x2283211, 0x2284111, 0x2311138, 0x2311147,
+	0x2311156, 0x2311165, 0x2311174, 0x2311183, 0x2311228, 0x2311237, 0x2311246, 0x2311255,
+	0x2311264, 0x2311273, 0x2311282, 0x2311318, 0x2311327, 0x2311336, 0x2311345, 0x2311354,
+	0x2311363, 0x2311372, 0x2311381, 0x2311417, 0x2311426, 0x2311435, 0x2311444, 0x2311453,
+	0x2311462, 0x2311471, 0x2311516, 0x2311525, 0x2311534, 0x2311543, 0x2311552, 0x2311561,
+	0x2311615, 0x2311624, 0x2311633, 0x2311642, 0x2311651, 0x2311714, 0x2311723, 0x2311732,
+	0x2311741, 0x2311813, 0x2311822, 0x2311831, 0x2312128, 0x2312137, 0x2312146, 0x2312155,
+	0x2312164, 0x2312173, 0x2312182, 0x2312218, 0x2312227, 0x2312236, 0x2312245, 0x2312254,
+	0x2312263, 0x2312272, 0x2312281, 0x2312317, 0x2312326, 0x2312335, 0x2312344, 0x2312353,
+	0x2312362, 0x2312371, 0x2312416, 0x2312425, 0x2312434, 0x2312443, 0x2312452, 0x2312461,
+	0x2312515, 0x2312524, 0x2312533, 0x2312542, 0x2312551, 0x2312614, 0x2312623, 0x2312632,
+	0x2312641, 0x2312713, 0x2312722, 0x2312731, 0x2312812, 0x2312821, 0x2313118, 0x2313127,
+	0x2313136, 0x2313145, 0x2313154, 0x2313163, 0x2313172, 0x2313181, 0x2313217, 0x2313226,
+	0x2313235, 0x2313244, 0x2313253, 0x2313262, 0x2313271, 0x2313316, 0x2313325, 0x2313334,
+	0x2313343, 0x2313352, 0x2313361, 0x2313415, 0x2313424, 0x2313433, 0x2313442, 0x2313451,
+	0x2313514, 0x2313523, 0x2313532, 0x2313541, 0x2313613, 0x2313622, 0x2313631, 0x2313712,
+	0x2313721, 0x2313811, 0x2314117, 0x2314126, 0x2314135, 0x2314144, 0x2314153, 0x2314162,
+	0x2314171, 0x2314216, 0x2314225, 0x2314234, 0x2314243, 0x2314252, 0x2314261, 0x2314315,
+	0x2314324, 0x2314333, 0x2314342, 0x2314351, 0x2314414, 0x2314423, 0x2314432, 0x2314441,
+	0x2314513, 0x2314522, 0x2314531, 0x2314612, 0x2314621, 0x2314711, 0x2315116, 0x2315125,
+	0x2315134, 0x2315143, 0x2315152, 0x2315161, 0x2315215, 0x2315224, 0x2315233, 0x2315242,
+	0x2315251, 0x2315314, 0x2315323, 0x2315332, 0x2315341, 0x2315413, 0x2315422, 0x2315431,
+	0x2315512, 0x2315521, 0x2315611, 0x2316115, 0x2316124, 0x2316133, 0x2316142, 0x2316151,
+	0x2316214, 0x2316223, 0x2316232, 0x2316241, 0x2316313, 0x2316322, 0x2316331, 0x2316412,
+	0x2316421, 0x2316511, 0x2317114, 0x2317123, 0x2317132, 0x2317141, 0x2317213, 0x2317222,
+	0x2317231, 0x2317312, 0x2317321, 0x2317411, 0x2318113, 0x2318122, 0x2318131, 0x2318212,
+	0x2318221, 0x2318311, 0x2321128, 0x2321137, 0x2321146, 0x2321155, 0x2321164, 0x2321173,
+	0x2321182, 0x2321218, 0x2321227, 0x2321236, 0x2321245, 0x2321254, 0x2321263, 0x2321272,
+	0x2321281, 0x2321317, 0x2321326, 0x2321335, 0x2321344, 0x2321353, 0x2321362, 0x2321371,
+	0x2321416, 0x2321425, 0x2321434, 0x2321443, 0x2321452, 0x2321461, 0x2321515, 0x2321524,
+	0x2321533, 0x2321542, 0x2321551, 0x2321614, 0x2321623, 0x2321632, 0x2321641, 0x2321713,
+	0x2321722, 0x2321731, 0x2321812, 0x2321821, 0x2322118, 0x2322127, 0x2322136, 0x2322145,
+	0x2322154, 0x2322163, 0x2322172, 0x2322181, 0x2322217, 0x2322271, 0x2322316, 0x2322361,
+	0x2322415, 0x2322451, 0x2322514, 0x2322541, 0x2322613, 0x2322631, 0x2322712, 0x2322721,
+	0x2322811, 0x2323117, 0x2323126, 0x2323135, 0x2323144, 0x2323153, 0x2323162, 0x2323171,
+	0x2323216, 0x2323261, 0x2323315, 0x2323351, 0x2323414, 0x2323441, 0x2323513, 0x2323531,
+	0x2323612, 0x2323621, 0x2323711, 0x2324116, 0x2324125, 0x2324134, 0x2324143, 0x2324152,
+	0x2324161, 0x2324215, 0x2324251, 0x2324314, 0x2324341, 0x2324413, 0x2324431, 0x2324512,
+	0x2324521, 0x2324611, 0x2325115, 0x2325124, 0x2325133, 0x2325142, 0x2325151, 0x2325214,
+	0x2325241, 0x2325313, 0x2325331, 0x2325412, 0x2325421, 0x2325511, 0x2326114, 0x2326123,
+	0x2326132, 0x2326141, 0x2326213, 0x2326231, 0x2326312, 0x2326321, 0x2326411, 0x2327113,
+	0x2327122, 0x2327131, 0x2327212, 0x2327221, 0x2327311, 0x2328112, 0x2328121, 0x2328211,
+	0x2331118, 0x2331127, 0x2331136, 0x2331145, 0x2331154, 0x2331163, 0x2331172, 0x2331181,
+	0x2331217, 0x2331226, 0x2331235, 0x2331244, 0x2331253, 0x2331262, 0x2331271, 0x2331316,
+	0x2331325, 0x2331334, 0x2331343, 0x2331352, 0x2331361, 0x2331415, 0x2331424, 0x2331433,
+	0x2331442, 0x2331451, 0x2331514, 0x2331523, 0x2331532, 0x2331541, 0x2331613, 0x2331622,
+	0x2331631, 0x2331712, 0x2331721, 0x2331811, 0x2332117, 0x2332126, 0x2332135, 0x2332144,
+	0x2332153, 0x2332162, 0x2332171, 0x2332216, 0x2332261, 0x2332315, 0x2332351, 0x2332414,
+	0x2332441, 0x2332513, 0x2332531, 0x2332612, 0x2332621, 0x2332711, 0x2333116, 0x2333125,
+	0x2333134, 0x2333143, 0x2333152, 0x2333161, 0x2333215, 0x2333251, 0x2333314, 0x2333341,
+	0x2333413, 0x2333431, 0x2333512, 0x2333521, 0x2333611, 0x2334115, 0x2334124, 0x2334133,
+	0x2334142, 0x2334151, 0x2334214, 0x2334241, 0x2334313, 0x2334331, 0x2334412, 0x2334421,
+	0x2334511, 0x2335114, 0x2335123, 0x2335132, 0x2335141, 0x2335213, 0x2335231, 0x2335312,
+	0x2335321, 0x2335411, 0x2336113, 0x2336122, 0x2336131, 0x2336212, 0x2336221, 0x2336311,
+	0x2337112, 0x2337121, 0x2337211, 0x2338111, 0x2341117, 0x2341126, 0x2341135, 0x2341144,
+	0x2341153, 0x2341162, 0x2341171, 0x2341216, 0x2341225, 0x2341234, 0x2341243, 0x2341252,
+	0x2341261, 0x2341315, 0x2341324, 0x2341333, 0x2341342, 0x2341351, 0x2341414, 0x2341423,
+	0x2341432, 0x2341441, 0x2341513, 0x2341522, 0x2341531, 0x2341612, 0x2341621, 0x2341711,
+	0x2342116, 0x2342125, 0x2342134, 0x2342143, 0x2342152, 0x2342161, 0x2342215, 0x2342251,
+	0x2342314, 0x2342341, 0x2342413, 0x2342431, 0x2342512, 0x2342521, 0x2342611, 0x2343115,
+	0x2343124, 0x2343133, 0x2343142, 0x2343151, 0x2343214, 0x2343241, 0x2343313, 0x2343331,
+	0x2343412, 0x2343421, 0x2343511, 0x2344114, 0x2344123, 0x2344132, 0x2344141, 0x2344213,
+	0x2344231, 0x2344312, 0x2344321, 0x2344411, 0x2345113, 0x2345122, 0x2345131, 0x2345212,
+	0x2345221, 0x2345311, 0x2346112, 0x2346121, 0x2346211, 0x2347111, 0x2351116, 0x2351125,
+	0x2351134, 0x2351143, 0x2351152, 0x2351161, 0x2351215, 0x2351224, 0x2351233, 0x2351242,
+	0x2351251, 0x2351314, 0x2351323, 0x2351332, 0x2351341, 0x2351413, 0x2351422, 0x2351431,
+	0x2351512, 0x2351521, 0x2351611, 0x2352115, 0x2352124, 0x2352133, 0x2352142, 0x2352151,
+	0x2352214, 0x2352241, 0x2352313, 0x2352331, 0x2352412, 0x2352421, 0x2352511, 0x2353114,
+	0x2353123, 0x2353132, 0x2353141, 0x2353213, 0x2353231, 0x2353312, 0x2353321, 0x2353411,
+	0x2354113, 0x2354122, 0x2354131, 0x2354212, 0x2354221, 0x2354311, 0x2355112, 0x2355121,
+	0x2355211, 0x2356111, 0x2361115, 0x2361124, 0x2361133, 0x2361142, 0x2361151, 0x2361214,
+	0x2361223, 0x2361232, 0x2361241, 0x2361313, 0x2361322, 0x2361331, 0x2361412, 0x2361421,
+	0x2361511, 0x2362114, 0x2362123, 0x2362132, 0x2362141, 0x2362213, 0x2362231, 0x2362312,
+	0x2362321, 0x2362411, 0x2363113, 0x2363122, 0x2363131, 0x2363212, 0x2363221, 0x2363311,
+	0x2364112, 0x2364121, 0x2364211, 0x2365111, 0x2371114, 0x2371123, 0x2371132, 0x2371141,
+	0x2371213, 0x2371222, 0x2371231, 0x2371312, 0x2371321, 0x2371411, 0x2372113, 0x2372122,
+	0x2372131, 0x2372212, 0x2372221, 0x2372311, 0x2373112, 0x2373121, 0x2373211, 0x2374111,
+	0x2381113, 0x2381122, 0x2381131, 0x2381212, 0x2381221, 0x2381311, 0x2382112, 0x2382121,
+	0x2382211, 0x2383111, 0x2411128, 0x2411137, 0x2411146, 0x2411155, 0x2411164, 0x2411173,
+	0x2411182, 0x2411218, 0x2411227, 0x2411236, 0x2411245, 0x2411254, 0x2411263, 0x2411272,
+	0x2411281, 0x2411317, 0x2411326, 0x2411335, 0x2411344, 0x2411353, 0x2411362, 0x2411371,
+	0x2411416, 0x2411425, 0x2411434, 0x2411443, 0x2411452, 0x2411461, 0x2411515, 0x2411524,
+	0x2411533, 0x2411542, 0x2411551, 0x2411614, 0x2411623, 0x2411632, 0x2411641, 0x2411713,
+	0x2411722, 0x2411731, 0x2411812, 0x2411821, 0x2412118, 0x2412127, 0x2412136, 0x2412145,
+	0x2412154, 0x2412163, 0x2412172, 0x2412181, 0x2412217, 0x2412226, 0x2412235, 0x2412244,
+	0x2412253, 0x2412262, 0x2412271, 0x2412316, 0x2412325, 0x2412334, 0x2412343, 0x2412352,
+	0x2412361, 0x2412415, 0x2412424, 0x2412433, 0x2412442, 0x2412451, 0x2412514, 0x2412523,
+	0x2412532, 0x2412541, 0x2412613, 0x2412622, 0x2412631, 0x2412712, 0x2412721, 0x2412811,
+	0x2413117, 0x2413126, 0x2413135, 0x2413144, 0x2413153, 0x2413162, 0x2413171, 0x2413216,
+	0x2413225, 0x2413234, 0x2413243, 0x2413252, 0x2413261, 0x2413315, 0x2413324, 0x2413333,
+	0x2413342, 0x2413351, 0x2413414, 0x2413423, 0x2413432, 0x2413441, 0x2413513, 0x2413522,
+	0x2413531, 0x2413612, 0x2413621, 0x2413711, 0x2414116, 0x2414125, 0x2414134, 0x2414143,
+	0x2414152, 0x2414161, 0x2414215, 0x2414224, 0x2414233, 0x2414242, 0x2414251, 0x2414314,
+	0x2414323, 0x2414332, 0x2414341, 0x2414413, 0x2414422, 0x2414431, 0x2414512, 0x2414521,
+	0x2414611, 0x2415115, 0x2415124, 0x2415133, 0x2415142, 0x2415151, 0x2415214, 0x2415223,
+	0x2415232, 0x2415241, 0x2415313, 0x2415322, 0x2415331, 0x2415412, 0x2415421, 0x2415511,
+	0x2416114, 0x2416123, 0x2416132, 0x2416141, 0x2416213, 0x2416222, 0x2416231, 0x2416312,
+	0x2416321, 0x2416411, 0x2417113, 0x2417122, 0x2417131, 0x2417212, 0x2417221, 0x2417311,
+	0x2418112, 0x2418121, 0x2418211, 0x2421118, 0x2421127, 0x2421136, 0x2421145, 0x2421154,
+	0x2421163, 0x2421172, 0x2421181, 0x2421217, 0x2421226, 0x2421235, 0x2421244, 0x2421253,
+	0x2421262, 0x2421271, 0x2421316, 0x2421325, 0x2421334, 0x2421343, 0x2421352, 0x2421361,
+	0x2421415, 0x2421424, 0x2421433, 0x2421442, 0x2421451, 0x2421514, 0x2421523, 0x2421532,
+	0x2421541, 0x2421613, 0x2421622, 0x2421631, 0x2421712, 0x2421721, 0x2421811, 0x2422117,
+	0x2422126, 0x2422135, 0x2422144, 0x2422153, 0x2422162, 0x2422171, 0x2422216, 0x2422261,
+	0x2422315, 0x2422351, 0x2422414, 0x2422441, 0x2422513, 0x2422531, 0x2422612, 0x2422621,
+	0x2422711, 0x2423116, 0x2423125, 0x2423134, 0x2423143, 0x2423152, 0x2423161, 0x2423215,
+	0x2423251, 0x2423314, 0x2423341, 0x2423413, 0x2423431, 0x2423512, 0x2423521, 0x2423611,
+	0x2424115, 0x2424124, 0x2424133, 0x2424142, 0x2424151, 0x2424214, 0x2424241, 0x2424313,
+	0x2424331, 0x2424412, 0x2424421, 0x2424511, 0x2425114, 0x2425123, 0x2425132, 0x2425141,
+	0x2425213, 0x2425231, 0x2425312, 0x2425321, 0x2425411, 0x2426113, 0x2426122, 0x2426131,
+	0x2426212, 0x2426221, 0x2426311, 0x2427112, 0x2427121, 0x2427211, 0x2428111, 0x2431117,
+	0x2431126, 0x2431135, 0x2431144, 0x2431153, 0x2431162, 0x2431171, 0x2431216, 0x2431225,
+	0x2431234, 0x2431243, 0x2431252, 0x2431261, 0x2431315, 0x2431324, 0x2431333, 0x2431342,
+	0x2431351, 0x2431414, 0x2431423, 0x2431432, 0x2431441, 0x2431513, 0x2431522, 0x2431531,
+	0x2431612, 0x2431621, 0x2431711, 0x2432116, 0x2432125, 0x2432134, 0x2432143, 0x2432152,
+	0x2432161, 0x2432215, 0x2432251, 0x2432314, 0x2432341, 0x2432413, 0x2432431, 0x2432512,
+	0x2432521, 0x2432611, 0x2433115, 0x2433124, 0x2433133, 0x2433142, 0x2433151, 0x2433214,
+	0x2433241, 0x2433313, 0x2433331, 0x2433412, 0x2433421, 0x2433511, 0x2434114, 0x2434123,
+	0x2434132, 0x2434141, 0x2434213, 0x2434231, 0x2434312, 0x2434321, 0x2434411, 0x2435113,
+	0x2435122, 0x2435131, 0x2435212, 0x2435221, 0x2435311, 0x2436112, 0x2436121, 0x2436211,
+	0x2437111, 0x2441116, 0x2441125, 0x2441134, 0x2441143, 0x2441152, 0x2441161, 0x2441215,
+	0x2441224, 0x2441233, 0x2441242, 0x2441251, 0x2441314, 0x2441323, 0x2441332, 0x2441341,
+	0x2441413, 0x2441422, 0x2441431, 0x2441512, 0x2441521, 0x2441611, 0x2442115, 0x2442124,
+	0x2442133, 0x2442142, 0x2442151, 0x2442214, 0x2442241, 0x2442313, 0x2442331, 0x2442412,
+	0x2442421, 0x2442511, 0x2443114, 0x2443123, 0x2443132, 0x2443141, 0x2443213, 0x2443231,
+	0x2443312, 0x2443321, 0x2443411, 0x2444113, 0x2444122, 0x2444131, 0x2444212, 0x2444221,
+	0x2444311, 0x2445112, 0x2445121, 0x2445211, 0x2446111, 0x2451115, 0x2451124, 0x2451133,
+	0x2451142, 0x2451151, 0x2451214, 0x2451223, 0x2451232, 0x2451241, 0x2451313, 0x2451322,
+	0x2451331, 0x2451412, 0x2451421, 0x2451511, 0x2452114, 0x2452123, 0x2452132, 0x2452141,
+	0x2452213, 0x2452231, 0x2452312, 0x2452321, 0x2452411, 0x2453113, 0x2453122, 0x2453131,
+	0x2453212, 0x2453221, 0x2453311, 0x2454112, 0x2454121, 0x2454211, 0x2455111, 0x2461114,
+	0x2461123, 0x2461132, 0x2461141, 0x2461213, 0x2461222, 0x2461231, 0x2461312, 0x2461321,
+	0x2461411, 0x2462113, 0x2462122, 0x2462131, 0x2462212, 0x2462221, 0x2462311, 0x2463112,
+	0x2463121, 0x2463211, 0x2464111, 0x2471113, 0x2471122, 0x2471131, 0x2471212, 0x2471221,
+	0x2471311, 0x2472112, 0x2472121, 0x2472211, 0x2473111, 0x2481112, 0x2481121, 0x2481211,
+	0x2482111, 0x2511118, 0x2511127, 0x2511136, 0x2511145, 0x2511154, 0x2511163, 0x2511172,
+	0x2511181, 0x2511217, 0x2511226, 0x2511235, 0x2511244, 0x2511253, 0x2511262, 0x2511271,
+	0x2511316, 0x2511325, 0x2511334, 0x2511343, 0x2511352, 0x2511361, 0x2511415, 0x2511424,
+	0x2511433, 0x2511442, 0x2511451, 0x2511514, 0x2511523, 0x2511532, 0x2511541, 0x2511613,
+	0x2511622, 0x2511631, 0x2511712, 0x2511721, 0x2511811, 0x2512117, 0x2512126, 0x2512135,
+	0x2512144, 0x2512153, 0x2512162, 0x2512171, 0x2512216, 0x2512225, 0x2512234, 0x2512243,
+	0x2512252, 0x2512261, 0x2512315, 0x2512324, 0x2512333, 0x2512342, 0x2512351, 0x2512414,
+	0x2512423, 0x2512432, 0x2512441, 0x2512513, 0x2512522, 0x2512531, 0x2512612, 0x2512621,
+	0x2512711, 0x2513116, 0x2513125, 0x2513134, 0x2513143, 0x2513152, 0x2513161, 0x2513215,
+	0x2513224, 0x2513233, 0x2513242, 0x2513251, 0x2513314, 0x2513323, 0x2513332, 0x2513341,
+	0x2513413, 0x2513422, 0x2513431, 0x2513512, 0x2513521, 0x2513611, 0x2514115, 0x2514124,
+	0x2514133, 0x2514142, 0x2514151, 0x2514214, 0x2514223, 0x2514232, 0x2514241, 0x2514313,
+	0x2514322, 0x2514331, 0x2514412, 0x2514421, 0x2514511, 0x2515114, 0x2515123, 0x2515132,
+	0x2515141, 0x2515213, 0x2515222, 0x2515231, 0x2515312, 0x2515321, 0x2515411, 0x2516113,
+	0x2516122, 0x2516131, 0x2516212, 0x2516221, 0x2516311, 0x2517112, 0x2517121, 0x2517211,
+	0x2518111, 0x2521117, 0x2521126, 0x2521135, 0x2521144, 0x2521153, 0x2521162, 0x2521171,
+	0x2521216, 0x2521225, 0x2521234, 0x2521243, 0x2521252, 0x2521261, 0x2521315, 0x2521324,
+	0x2521333, 0x2521342, 0x2521351, 0x2521414, 0x2521423, 0x2521432, 0x2521441, 0x2521513,
+	0x2521522, 0x2521531, 0x2521612, 0x2521621, 0x2521711, 0x2522116, 0x2522125, 0x2522134,
+	0x2522143, 0x2522152, 0x2522161, 0x2522215, 0x2522251, 0x2522314, 0x2522341, 0x2522413,
+	0x2522431, 0x2522512, 0x2522521, 0x2522611, 0x2523115, 0x2523124, 0x2523133, 0x2523142,
+	0x2523151, 0x2523214, 0x2523241, 0x2523313, 0x2523331, 0x2523412, 0x2523421, 0x2523511,
+	0x2524114, 0x2524123, 0x2524132, 0x2524141, 0x2524213, 0x2524231, 0x2524312, 0x2524321,
+	0x2524411, 0x2525113, 0x2525122, 0x2525131, 0x2525212, 0x2525221, 0x2525311, 0x2526112,
+	0x2526121, 0x2526211, 0x2527111, 0x2531116, 0x2531125, 0x2531134, 0x2531143, 0x2531152,
+	0x2531161, 0x2531215, 0x2531224, 0x2531233, 0x2531242, 0x2531251, 0x2531314, 0x2531323,
+	0x2531332, 0x2531341, 0x2531413, 0x2531422, 0x2531431, 0x2531512, 0x2531521, 0x2531611,
+	0x2532115, 0x2532124, 0x2532133, 0x2532142, 0x2532151, 0x2532214, 0x2532241, 0x2532313,
+	0x2532331, 0x2532412, 0x2532421, 0x2532511, 0x2533114, 0x2533123, 0x2533132, 0x2533141,
+	0x2533213, 0x2533231, 0x2533312, 0x2533321, 0x2533411, 0x2534113, 0x2534122, 0x2534131,
+	0x2534212, 0x2534221, 0x2534311, 0x2535112, 0x2535121, 0x2535211, 0x2536111, 0x2541115,
+	0x2541124, 0x2541133, 0x2541142, 0x2541151, 0x2541214, 0x2541223, 0x2541232, 0x2541241,
+	0x2541313, 0x2541322, 0x2541331, 0x2541412, 0x2541421, 0x2541511, 0x2542114, 0x2542123,
+	0x2542132, 0x2542141, 0x2542213, 0x2542231, 0x2542312, 0x2542321, 0x2542411, 0x2543113,
+	0x2543122, 0x2543131, 0x2543212, 0x2543221, 0x2543311, 0x2544112, 0x2544121, 0x2544211,
+	0x2545111, 0x2551114, 0x2551123, 0x2551132, 0x2551141, 0x2551213, 0x2551222, 0x2551231,
+	0x2551312, 0x2551321, 0x2551411, 0x2552113, 0x2552122, 0x2552131, 0x2552212, 0x2552221,
+	0x2552311, 0x2553112, 0x2553121, 0x2553211, 0x2554111, 0x2561113, 0x2561122, 0x2561131,
+	0x2561212, 0x2561221, 0x2561311, 0x2562112, 0x2562121, 0x2562211, 0x2563111, 0x2571112,
+	0x2571121, 0x2571211, 0x2572111, 0x2581111, 0x2611117, 0x2611126, 0x2611135, 0x2611144,
+	0x2611153, 0x2611162, 0x2611171, 0x2611216, 0x2611225, 0x2611234, 0x2611243, 0x2611252,
+	0x2611261, 0x2611315, 0x2611324, 0x2611333, 0x2611342, 0x2611351, 0x2611414, 0x2611423,
+	0x2611432, 0x2611441, 0x2611513, 0x2611522, 0x2611531, 0x2611612, 0x2611621, 0x2611711,
+	0x2612116, 0x2612125, 0x2612134, 0x2612143, 0x2612152, 0x2612161, 0x2612215, 0x2612224,
+	0x2612233, 0x2612242, 0x2612251, 0x2612314, 0x2612323, 0x2612332, 0x2612341, 0x2612413,
+	0x2612422, 0x2612431, 0x2612512, 0x2612521, 0x2612611, 0x2613115, 0x2613124, 0x2613133,
+	0x2613142, 0x2613151, 0x2613214, 0x2613223, 0x2613232, 0x2613241, 0x2613313, 0x2613322,
+	0x2613331, 0x2613412, 0x2613421, 0x2613511, 0x2614114, 0x2614123, 0x2614132, 0x2614141,
+	0x2614213, 0x2614222, 0x2614231, 0x2614312, 0x2614321, 0x2614411, 0x2615113, 0x2615122,
+	0x2615131, 0x2615212, 0x2615221, 0x2615311, 0x2616112, 0x2616121, 0x2616211, 0x2617111,
+	0x2621116, 0x2621125, 0x2621134, 0x2621143, 0x2621152, 0x2621161, 0x2621215, 0x2621224,
+	0x2621233, 0x2621242, 0x2621251, 0x2621314, 0x2621323, 0x2621332, 0x2621341, 0x2621413,
+	0x2621422, 0x2621431, 0x2621512, 0x2621521, 0x2621611, 0x2622115, 0x2622124, 0x2622133,
+	0x2622142, 0x2622151, 0x2622214, 0x2622241, 0x2622313, 0x2622331, 0x2622412, 0x2622421,
+	0x2622511, 0x2623114, 0x2623123, 0x2623132, 0x2623141, 0x2623213, 0x2623231, 0x2623312,
+	0x2623321, 0x2623411, 0x2624113, 0x2624122, 0x2624131, 0x2624212, 0x2624221, 0x2624311,
+	0x2625112, 0x2625121, 0x2625211, 0x2626111, 0x2631115, 0x2631124, 0x2631133, 0x2631142,
+	0x2631151, 0x2631214, 0x2631223, 0x2631232, 0x2631241, 0x2631313, 0x2631322, 0x2631331,
+	0x2631412, 0x2631421, 0x2631511, 0x2632114, 0x2632123, 0x2632132, 0x2632141, 0x2632213,
+	0x2632231, 0x2632312, 0x2632321, 0x2632411, 0x2633113, 0x2633122, 0x2633131, 0x2633212,
+	0x2633221, 0x2633311, 0x2634112, 0x2634121, 0x2634211, 0x2635111, 0x2641114, 0x2641123,
+	0x2641132, 0x2641141, 0x2641213, 0x2641222, 0x2641231, 0x2641312, 0x2641321, 0x2641411,
+	0x2642113, 0x2642122, 0x2642131, 0x2642212, 0x2642221, 0x2642311, 0x2643112, 0x2643121,
+	0x2643211, 0x2644111, 0x2651113, 0x2651122, 0x2651131, 0x2651212, 0x2651221, 0x2651311,
+	0x2652112, 0x2652121, 0x2652211, 0x2653111, 0x2661112, 0x2661121, 0x2661211, 0x2662111,
+	0x2671111, 0x2711116, 0x2711125, 0x2711134, 0x2711143, 0x2711152, 0x2711161, 0x2711215,
+	0x2711224, 0x2711233, 0x2711242, 0x2711251, 0x2711314, 0x2711323, 0x2711332, 0x2711341,
+	0x2711413, 0x2711422, 0x2711431, 0x2711512, 0x2711521, 0x2711611, 0x2712115, 0x2712124,
+	0x2712133, 0x2712142, 0x2712151, 0x2712214, 0x2712223, 0x2712232, 0x2712241, 0x2712313,
+	0x2712322, 0x2712331, 0x2712412, 0x2712421, 0x2712511, 0x2713114, 0x2713123, 0x2713132,
+	0x2713141, 0x2713213, 0x2713222, 0x2713231, 0x2713312, 0x2713321, 0x2713411, 0x2714113,
+	0x2714122, 0x2714131, 0x2714212, 0x2714221, 0x2714311, 0x2715112, 0x2715121, 0x2715211,
+	0x2716111, 0x2721115, 0x2721124, 0x2721133, 0x2721142, 0x2721151, 0x2721214, 0x2721223,
+	0x2721232, 0x2721241, 0x2721313, 0x2721322, 0x2721331, 0x2721412, 0x2721421, 0x2721511,
+	0x2722114, 0x2722123, 0x2722132, 0x2722141, 0x2722213, 0x2722231, 0x2722312, 0x2722321,
+	0x2722411, 0x2723113, 0x2723122, 0x2723131, 0x2723212, 0x2723221, 0x2723311, 0x2724112,
+	0x2724121, 0x2724211, 0x2725111, 0x2731114, 0x2731123, 0x2731132, 0x2731141, 0x2731213,
+	0x2731222, 0x2731231, 0x2731312, 0x2731321, 0x2731411, 0x2732113, 0x2732122, 0x2732131,
+	0x2732212, 0x2732221, 0x2732311, 0x2733112, 0x2733121, 0x2733211, 0x2734111, 0x2741113,
+	0x2741122, 0x2741131, 0x2741212, 0x2741221, 0x2741311, 0x2742112, 0x2742121, 0x2742211,
+	0x2743111, 0x2751112, 0x2751121, 0x2751211, 0x2752111, 0x2761111, 0x2811115, 0x2811124,
+	0x2811133, 0x2811142, 0x2811151, 0x2811214, 0x2811223, 0x2811232, 0x2811241, 0x2811313,
+	0x2811322, 0x2811331, 0x2811412, 0x2811421, 0x2811511, 0x2812114, 0x2812123, 0x2812132,
+	0x2812141, 0x2812213, 0x2812222, 0x2812231, 0x2812312, 0x2812321, 0x2812411, 0x2813113,
+	0x2813122, 0x2813131, 0x2813212, 0x2813221, 0x2813311, 0x2814112, 0x2814121, 0x2814211,
+	0x2815111, 0x2821114, 0x2821123, 0x2821132, 0x2821141, 0x2821213, 0x2821222, 0x2821231,
+	0x2821312, 0x2821321, 0x2821411, 0x2822113, 0x2822122, 0x2822131, 0x2822212, 0x2822221,
+	0x2822311, 0x2823112, 0x2823121, 0x2823211, 0x2824111, 0x2831113, 0x2831122, 0x2831131,
+	0x2831212, 0x2831221, 0x2831311, 0x2832112, 0x2832121, 0x2832211, 0x2833111, 0x2841112,
+	0x2841121, 0x2841211, 0x2842111, 0x2851111, 0x3111148, 0x3111157, 0x3111166, 0x3111175,
+	0x3111184, 0x3111238, 0x3111247, 0x3111256, 0x3111265, 0x3111274, 0x3111283, 0x3111328,
+	0x3111337, 0x3111346, 0x3111355, 0x3111364, 0x3111373, 0x3111382, 0x3111418, 0x3111427,
+	0x3111436, 0x3111445, 0x3111454, 0x3111463, 0x3111472, 0x3111481, 0x3111517, 0x3111526,
+	0x3111535, 0x3111544, 0x3111553, 0x3111562, 0x3111571, 0x3111616, 0x3111625, 0x3111634,
+	0x3111643, 0x3111652, 0x3111661, 0x3111715, 0x3111724, 0x3111733, 0x3111742, 0x3111751,
+	0x3111814, 0x3111823, 0x3111832, 0x3111841, 0x3112138, 0x3112147, 0x3112156, 0x3112165,
+	0x3112174, 0x3112183, 0x3112228, 0x3112237, 0x3112246, 0x3112255, 0x3112264, 0x3112273,
+	0x3112282, 0x3112318, 0x3112327, 0x3112336, 0x3112345, 0x3112354, 0x3112363, 0x3112372,
+	0x3112381, 0x3112417, 0x3112426, 0x3112435, 0x3112444, 0x3112453, 0x3112462, 0x3112471,
+	0x3112516, 0x3112525, 0x3112534, 0x3112543, 0x3112552, 0x3112561, 0x3112615, 0x3112624,
+	0x3112633, 0x3112642, 0x3112651, 0x3112714, 0x3112723, 0x3112732, 0x3112741, 0x3112813,
+	0x3112822, 0x3112831, 0x3113128, 0x3113137, 0x3113146, 0x3113155, 0x3113164, 0x3113173,
+	0x3113182, 0x3113218, 0x3113227, 0x3113236, 0x3113245, 0x3113254, 0x3113263, 0x3113272,
+	0x3113281, 0x3113317, 0x3113326, 0x3113335, 0x3113344, 0x3113353, 0x3113362, 0x3113371,
+	0x3113416, 0x3113425, 0x3113434, 0x3113443, 0x3113452, 0x3113461, 0x3113515, 0x3113524,
+	0x3113533, 0x3113542, 0x3113551, 0x3113614, 0x3113623, 0x3113632, 0x3113641, 0x3113713,
+	0x3113722, 0x3113731, 0x3113812, 0x3113821, 0x3114118, 0x3114127, 0x3114136, 0x3114145,
+	0x3114154, 0x3114163, 0x3114172, 0x3114181, 0x3114217, 0x3114226, 0x3114235, 0x3114244,
+	0x3114253, 0x3114262, 0x3114271, 0x3114316, 0x3114325, 0x3114334, 0x3114343, 0x3114352,
+	0x3114361, 0x3114415, 0x3114424, 0x3114433, 0x3114442, 0x3114451, 0x3114514, 0x3114523,
+	0x3114532, 0x3114541, 0x3114613, 0x3114622, 0x3114631, 0x3114712, 0x3114721, 0x3114811,
+	0x3115117, 0x3115126, 0x3115135, 0x3115144, 0x3115153, 0x3115162, 0x3115171, 0x3115216,
+	0x3115225, 0x3115234, 0x3115243, 0x3115252, 0x3115261, 0x3115315, 0x3115324, 0x3115333,
+	0x3115342, 0x3115351, 0x3115414, 0x3115423, 0x3115432, 0x3115441, 0x3115513, 0x3115522,
+	0x3115531, 0x3115612, 0x3115621, 0x3115711, 0x3116116, 0x3116125, 0x3116134, 0x3116143,
+	0x3116152, 0x3116161, 0x3116215, 0x3116224, 0x3116233, 0x3116242, 0x3116251, 0x3116314,
+	0x3116323, 0x3116332, 0x3116341, 0x3116413, 0x3116422, 0x3116431, 0x3116512, 0x3116521,
+	0x3116611, 0x3117115, 0x3117124, 0x3117133, 0x3117142, 0x3117151, 0x3117214, 0x3117223,
+	0x3117232, 0x3117241, 0x3117313, 0x3117322, 0x3117331, 0x3117412, 0x3117421, 0x3117511,
+	0x3118114, 0x3118123, 0x3118132, 0x3118141, 0x3118213, 0x3118222, 0x3118231, 0x3118312,
+	0x3118321, 0x3118411, 0x3121138, 0x3121147, 0x3121156, 0x3121165, 0x3121174, 0x3121183,
+	0x3121228, 0x3121237, 0x3121246, 0x3121255, 0x3121264, 0x3121273, 0x3121282, 0x3121318,
+	0x3121327, 0x3121336, 0x3121345, 0x3121354, 0x3121363, 0x3121372, 0x3121381, 0x3121417,
+	0x3121426, 0x3121435, 0x3121444, 0x3121453, 0x3121462, 0x3121471, 0x3121516, 0x3121525,
+	0x3121534, 0x3121543, 0x3121552, 0x3121561, 0x3121615, 0x3121624, 0x3121633, 0x3121642,
+	0x3121651, 0x3121714, 0x3121723, 0x3121732, 0x3121741, 0x3121813, 0x3121822, 0x3121831,
+	0x3122128, 0x3122137, 0x3122146, 0x3122155, 0x3122164, 0x3122173, 0x3122182, 0x3122218,
+	0x3122227, 0x3122236, 0x3122245, 0x3122254, 0x3122263, 0x3122272, 0x3122281, 0x3122317,
+	0x3122326, 0x3122335, 0x3122344, 0x3122353, 0x3122362, 0x3122371, 0x3122416, 0x3122425,
+	0x3122434, 0x3122443, 0x3122452, 0x3122461, 0x3122515, 0x3122524, 0x3122533, 0x3122542,
+	0x3122551, 0x3122614, 0x3122623, 0x3122632, 0x3122641, 0x3122713, 0x3122722, 0x3122731,
+	0x3122812, 0x3122821, 0x3123118, 0x3123127, 0x3123136, 0x3123145, 0x3123154, 0x3123163,
+	0x3123172, 0x3123181, 0x3123217, 0x3123226, 0x3123235, 0x3123244, 0x3123253, 0x3123262,
+	0x3123271, 0x3123316, 0x3123325, 0x3123334, 0x3123343, 0x3123352, 0x3123361, 0x3123415,
+	0x3123424, 0x3123433, 0x3123442, 0x3123451, 0x3123514, 0x3123523, 0x3123532, 0x3123541,
+	0x3123613, 0x3123622, 0x3123631, 0x3123712, 0x3123721, 0x3123811, 0x3124117, 0x3124126,
+	0x3124135, 0x3124144, 0x3124153, 0x3124162, 0x3124171, 0x3124216, 0x3124225, 0x3124234,
+	0x3124243, 0x3124252, 0x3124261, 0x3124315, 0x3124324, 0x3124333, 0x3124342, 0x3124351,
+	0x3124414, 0x3124423, 0x3124432, 0x3124441, 0x3124513, 0x3124522, 0x3124531, 0x3124612,
+	0x3124621, 0x3124711, 0x3125116, 0x3125125, 0x3125134, 0x3125143, 0x3125152, 0x3125161,
+	0x3125215, 0x3125224, 0x3125233, 0x3125242, 0x3125251, 0x3125314, 0x3125323, 0x3125332,
+	0x3125341, 0x3125413, 0x3125422, 0x3125431, 0x3125512, 0x3125521, 0x3125611, 0x3126115,
+	0x3126124, 0x3126133, 0x3126142, 0x3126151, 0x3126214, 0x3126223, 0x3126232, 0x3126241,
+	0x3126313, 0x3126322, 0x3126331, 0x3126412, 0x3126421, 0x3126511, 0x3127114, 0x3127123,
+	0x3127132, 0x3127141, 0x3127213, 0x3127222, 0x3127231, 0x3127312, 0x3127321, 0x3127411,
+	0x3128113, 0x3128122, 0x3128131, 0x3128212, 0x3128221, 0x3128311, 0x3131128, 0x3131137,
+	0x3131146, 0x3131155, 0x3131164, 0x3131173, 0x3131182, 0x3131218, 0x3131227, 0x3131236,
+	0x3131245, 0x3131254, 0x3131263, 0x3131272, 0x3131281, 0x3131317, 0x3131326, 0x3131335,
+	0x3131344, 0x3131353, 0x3131362, 0x3131371, 0x3131416, 0x3131425, 0x3131434, 0x3131443,
+	0x3131452, 0x3131461, 0x3131515, 0x3131524, 0x3131533, 0x3131542, 0x3131551, 0x3131614,
+	0x3131623, 0x3131632, 0x3131641, 0x3131713, 0x3131722, 0x3131731, 0x3131812, 0x3131821,
+	0x3132118, 0x3132127, 0x3132136, 0x3132145, 0x3132154, 0x3132163, 0x3132172, 0x3132181,
+	0x3132217, 0x3132226, 0x3132235, 0x3132244, 0x3132253, 0x3132262, 0x3132271, 0x3132316,
+	0x3132325, 0x3132334, 0x3132343, 0x3132352, 0x3132361, 0x3132415, 0x3132424, 0x3132433,
+	0x3132442, 0x3132451, 0x3132514, 0x3132523, 0x3132532, 0x3132541, 0x3132613, 0x3132622,
+	0x3132631, 0x3132712, 0x3132721, 0x3132811, 0x3133117, 0x3133126, 0x3133135, 0x3133144,
+	0x3133153, 0x3133162, 0x3133171, 0x3133216, 0x3133225, 0x3133234, 0x3133243, 0x3133252,
+	0x3133261, 0x3133315, 0x3133324, 0x3133333, 0x3133342, 0x3133351, 0x3133414, 0x3133423,
+	0x3133432, 0x3133441, 0x3133513, 0x3133522, 0x3133531, 0x3133612, 0x3133621, 0x3133711,
+	0x3134116, 0x3134125, 0x3134134, 0x3134143, 0x3134152, 0x3134161, 0x3134215, 0x3134224,
+	0x3134233, 0x3134242, 0x3134251, 0x3134314, 0x3134323, 0x3134332, 0x3134341, 0x3134413,
+	0x3134422, 0x3134431, 0x3134512, 0x3134521, 0x3134611, 0x3135115, 0x3135124, 0x3135133,
+	0x3135142, 0x3135151, 0x3135214, 0x3135223, 0x3135232, 0x3135241, 0x3135313, 0x3135322,
+	0x3135331, 0x3135412, 0x3135421, 0x3135511, 0x3136114, 0x3136123, 0x3136132, 0x3136141,
+	0x3136213, 0x3136222, 0x3136231, 0x3136312, 0x3136321, 0x3136411, 0x3137113, 0x3137122,
+	0x3137131, 0x3137212, 0x3137221, 0x3137311, 0x3138112, 0x3138121, 0x3138211, 0x3141118,
+	0x3141127, 0x3141136, 0x3141145, 0x3141154, 0x3141163, 0x3141172, 0x3141181, 0x3141217,
+	0x3141226, 0x3141235, 0x3141244, 0x3141253, 0x3141262, 0x3141271, 0x3141316, 0x3141325,
+	0x3141334, 0x3141343, 0x3141352, 0x3141361, 0x3141415, 0x3141424, 0x3141433, 0x3141442,
+	0x3141451, 0x3141514, 0x3141523, 0x3141532, 0x3141541, 0x3141613, 0x3141622, 0x3141631,
+	0x3141712, 0x3141721, 0x3141811, 0x3142117, 0x3142126, 0x3142135, 0x3142144, 0x3142153,
+	0x3142162, 0x3142171, 0x3142216, 0x3142225, 0x3142234, 0x3142243, 0x3142252, 0x3142261,
+	0x3142315, 0x3142324, 0x3142333, 0x3142342, 0x3142351, 0x3142414, 0x3142423, 0x3142432,
+	0x3142441, 0x3142513, 0x3142522, 0x3142531, 0x3142612, 0x3142621, 0x3142711, 0x3143116,
+	0x3143125, 0x3143134, 0x3143143, 0x3143152, 0x3143161, 0x3143215, 0x3143224, 0x3143233,
+	0x3143242, 0x3143251, 0x3143314, 0x3143323, 0x3143332, 0x3143341, 0x3143413, 0x3143422,
+	0x3143431, 0x3143512, 0x3143521, 0x3143611, 0x3144115, 0x3144124, 0x3144133, 0x3144142,
+	0x3144151, 0x3144214, 0x3144223, 0x3144232, 0x3144241, 0x3144313, 0x3144322, 0x3144331,
+	0x3144412, 0x3144421, 0x3144511, 0x3145114, 0x3145123, 0x3145132, 0x3145141, 0x3145213,
+	0x3145222, 0x3145231, 0x3145312, 0x3145321, 0x3145411, 0x3146113, 0x3146122, 0x3146131,
+	0x3146212, 0x3146221, 0x3146311, 0x3147112, 0x3147121, 0x3147211, 0x3148111, 0x3151117,
+	0x3151126, 0x3151135, 0x3151144, 0x3151153, 0x3151162, 0x3151171, 0x3151216, 0x3151225,
+	0x3151234, 0x3151243, 0x3151252, 0x3151261, 0x3151315, 0x3151324, 0x3151333, 0x3151342,
+	0x3151351, 0x3151414, 0x3151423, 0x3151432, 0x3151441, 0x3151513, 0x3151522, 0x3151531,
+	0x3151612, 0x3151621, 0x3151711, 0x3152116, 0x3152125, 0x3152134, 0x3152143, 0x3152152,
+	0x3152161, 0x3152215, 0x3152224, 0x3152233, 0x3152242, 0x3152251, 0x3152314, 0x3152323,
+	0x3152332, 0x3152341, 0x3152413, 0x3152422, 0x3152431, 0x3152512, 0x3152521, 0x3152611,
+	0x3153115, 0x3153124, 0x3153133, 0x3153142, 0x3153151, 0x3153214, 0x3153223, 0x3153232,
+	0x3153241, 0x3153313, 0x3153322, 0x3153331, 0x3153412, 0x3153421, 0x3153511, 0x3154114,
+	0x3154123, 0x3154132, 0x3154141, 0x3154213, 0x3154222, 0x3154231, 0x3154312, 0x3154321,
+	0x3154411, 0x3155113, 0x3155122, 0x3155131, 0x3155212, 0x3155221, 0x3155311, 0x3156112,
+	0x3156121, 0x3156211, 0x3157111, 0x3161116, 0x3161125, 0x3161134, 0x3161143, 0x3161152,
+	0x3161161, 0x3161215, 0x3161224, 0x3161233, 0x3161242, 0x3161251, 0x3161314, 0x3161323,
+	0x3161332, 0x3161341, 0x3161413, 0x3161422, 0x3161431, 0x3161512, 0x3161521, 0x3161611,
+	0x3162115, 0x3162124, 0x3162133, 0x3162142, 0x3162151, 0x3162214, 0x3162223, 0x3162232,
+	0x3162241, 0x3162313, 0x3162322, 0x3162331, 0x3162412, 0x3162421, 0x3162511, 0x3163114,
+	0x3163123, 0x3163132, 0x3163141, 0x3163213, 0x3163222, 0x3163231, 0x3163312, 0x3163321,
+	0x3163411, 0x3164113, 0x3164122, 0x3164131, 0x3164212, 0x3164221, 0x3164311, 0x3165112,
+	0x3165121, 0x3165211, 0x3166111, 0x3171115, 0x3171124, 0x3171133, 0x3171142, 0x3171151,
+	0x3171214, 0x3171223, 0x3171232, 0x3171241, 0x3171313, 0x3171322, 0x3171331, 0x3171412,
+	0x3171421, 0x3171511, 0x3172114, 0x3172123, 0x3172132, 0x3172141, 0x3172213, 0x3172222,
+	0x3172231, 0x3172312, 0x3172321, 0x3172411, 0x3173113, 0x3173122, 0x3173131, 0x3173212,
+	0x3173221, 0x3173311, 0x3174112, 0x3174121, 0x3174211, 0x3175111, 0x3181114, 0x3181123,
+	0x3181132, 0x3181141, 0x3181213, 0x3181222, 0x3181231, 0x3181312, 0x3181321, 0x3181411,
+	0x3182113, 0x3182122, 0x3182131, 0x3182212, 0x3182221, 0x3182311, 0x3183112, 0x3183121,
+	0x3183211, 0x3184111, 0x3211138, 0x3211147, 0x3211156, 0x3211165, 0x3211174, 0x3211183,
+	0x3211228, 0x3211237, 0x3211246, 0x3211255, 0x3211264, 0x3211273, 0x3211282, 0x3211318,
+	0x3211327, 0x3211336, 0x3211345, 0x3211354, 0x3211363, 0x3211372, 0x3211381, 0x3211417,
+	0x3211426, 0x3211435, 0x3211444, 0x3211453, 0x3211462, 0x3211471, 0x3211516, 0x3211525,
+	0x3211534, 0x3211543, 0x3211552, 0x3211561, 0x3211615, 0x3211624, 0x3211633, 0x3211642,
+	0x3211651, 0x3211714, 0x3211723, 0x3211732, 0x3211741, 0x3211813, 0x3211822, 0x3211831,
+	0x3212128, 0x3212137, 0x3212146, 0x3212155, 0x3212164, 0x3212173, 0x3212182, 0x3212218,
+	0x3212227, 0x3212236, 0x3212245, 0x3212254, 0x3212263, 0x3212272, 0x3212281, 0x3212317,
+	0x3212326, 0x3212335, 0x3212344, 0x3212353, 0x3212362, 0x3212371, 0x3212416, 0x3212425,
+	0x3212434, 0x3212443, 0x3212452, 0x3212461, 0x3212515, 0x3212524, 0x3212533, 0x3212542,
+	0x3212551, 0x3212614, 0x3212623, 0x3212632, 0x3212641, 0x3212713, 0x3212722, 0x3212731,
+	0x3212812, 0x3212821, 0x3213118, 0x3213127, 0x3213136, 0x3213145, 0x3213154, 0x3213163,
+	0x3213172, 0x3213181, 0x3213217, 0x3213226, 0x3213235, 0x3213244, 0x3213253, 0x3213262,
+	0x3213271, 0x3213316, 0x3213325, 0x3213334, 0x3213343, 0x3213352, 0x3213361, 0x3213415,
+	0x3213424, 0x3213433, 0x3213442, 0x3213451, 0x3213514, 0x3213523, 0x3213532, 0x3213541,
+	0x3213613, 0x3213622, 0x3213631, 0x3213712, 0x3213721, 0x3213811, 0x3214117, 0x3214126,
+	0x3214135, 0x3214144, 0x3214153, 0x3214162, 0x3214171, 0x3214216, 0x3214225, 0x3214234,
+	0x3214243, 0x3214252, 0x3214261, 0x3214315, 0x3214324, 0x3214333, 0x3214342, 0x3214351,
+	0x3214414, 0x3214423, 0x3214432, 0x3214441, 0x3214513, 0x3214522, 0x3214531, 0x3214612,
+	0x3214621, 0x3214711, 0x3215116, 0x3215125, 0x3215134, 0x3215143, 0x3215152, 0x3215161,
+	0x3215215, 0x3215224, 0x3215233, 0x3215242, 0x3215251, 0x3215314, 0x3215323, 0x3215332,
+	0x3215341, 0x3215413, 0x3215422, 0x3215431, 0x3215512, 0x3215521, 0x3215611, 0x3216115,
+	0x3216124, 0x3216133, 0x3216142, 0x3216151, 0x3216214, 0x3216223, 0x3216232, 0x3216241,
+	0x3216313, 0x3216322, 0x3216331, 0x3216412, 0x3216421, 0x3216511, 0x3217114, 0x3217123,
+	0x3217132, 0x3217141, 0x3217213, 0x3217222, 0x3217231, 0x3217312, 0x3217321, 0x3217411,
+	0x3218113, 0x3218122, 0x3218131, 0x3218212, 0x3218221, 0x3218311, 0x3221128, 0x3221137,
+	0x3221146, 0x3221155, 0x3221164, 0x3221173, 0x3221182, 0x3221218, 0x3221227, 0x3221236,
+	0x3221245, 0x3221254, 0x3221263, 0x3221272, 0x3221281, 0x3221317, 0x3221326, 0x3221335,
+	0x3221344, 0x3221353, 0x3221362, 0x3221371, 0x3221416, 0x3221425, 0x3221434, 0x3221443,
+	0x3221452, 0x3221461, 0x3221515, 0x3221524, 0x3221533, 0x3221542, 0x3221551, 0x3221614,
+	0x3221623, 0x3221632, 0x3221641, 0x3221713, 0x3221722, 0x3221731, 0x3221812, 0x3221821,
+	0x3222118, 0x3222127, 0x3222136, 0x3222145, 0x3222154, 0x3222163, 0x3222172, 0x3222181,
+	0x3222217, 0x3222271, 0x3222316, 0x3222361, 0x3222415, 0x3222451, 0x3222514, 0x3222541,
+	0x3222613, 0x3222631, 0x3222712, 0x3222721, 0x3222811, 0x3223117, 0x3223126, 0x3223135,
+	0x3223144, 0x3223153, 0x3223162, 0x3223171, 0x3223216, 0x3223261, 0x3223315, 0x3223351,
+	0x3223414, 0x3223441, 0x3223513, 0x3223531, 0x3223612, 0x3223621, 0x3223711, 0x3224116,
+	0x3224125, 0x3224134, 0x3224143, 0x3224152, 0x3224161, 0x3224215, 0x3224251, 0x3224314,
+	0x3224341, 0x3224413, 0x3224431, 0x3224512, 0x3224521, 0x3224611, 0x3225115, 0x3225124,
+	0x3225133, 0x3225142, 0x3225151, 0x3225214, 0x3225241, 0x3225313, 0x3225331, 0x3225412,
+	0x3225421, 0x3225511, 0x3226114, 0x3226123, 0x3226132, 0x3226141, 0x3226213, 0x3226231,
+	0x3226312, 0x3226321, 0x3226411, 0x3227113, 0x3227122, 0x3227131, 0x3227212, 0x3227221,
+	0x3227311, 0x3228112, 0x3228121, 0x3228211, 0x3231118, 0x3231127, 0x3231136, 0x3231145,
+	0x3231154, 0x3231163, 0x3231172, 0x3231181, 0x3231217, 0x3231226, 0x3231235, 0x3231244,
+	0x3231253, 0x3231262, 0x3231271, 0x3231316, 0x3231325, 0x3231334, 0x3231343, 0x3231352,
+	0x3231361, 0x3231415, 0x3231424, 0x3231433, 0x3231442, 0x3231451, 0x3231514, 0x3231523,
+	0x3231532, 0x3231541, 0x3231613, 0x3231622, 0x3231631, 0x3231712, 0x3231721, 0x3231811,
+	0x3232117, 0x3232126, 0x3232135, 0x3232144, 0x3232153, 0x3232162, 0x3232171, 0x3232216,
+	0x3232261, 0x3232315, 0x3232351, 0x3232414, 0x3232441, 0x3232513, 0x3232531, 0x3232612,
+	0x3232621, 0x3232711, 0x3233116, 0x3233125, 0x3233134, 0x3233143, 0x3233152, 0x3233161,
+	0x3233215, 0x3233251, 0x3233314, 0x3233341, 0x3233413, 0x3233431, 0x3233512, 0x3233521,
+	0x3233611, 0x3234115, 0x3234124, 0x3234133, 0x3234142, 0x3234151, 0x3234214, 0x3234241,
+	0x3234313, 0x3234331, 0x3234412, 0x3234421, 0x3234511, 0x3235114, 0x3235123, 0x3235132,
+	0x3235141, 0x3235213, 0x3235231, 0x3235312, 0x3235321, 0x3235411, 0x3236113, 0x3236122,
+	0x3236131, 0x3236212, 0x3236221, 0x3236311, 0x3237112, 0x3237121, 0x3237211, 0x3238111,
+	0x3241117, 0x3241126, 0x3241135, 0x3241144, 0x3241153, 0x3241162, 0x3241171, 0x3241216,
+	0x3241225, 0x3241234, 0x3241243, 0x3241252, 0x3241261, 0x3241315, 0x3241324, 0x3241333,
+	0x3241342, 0x3241351, 0x3241414, 0x3241423, 0x3241432, 0x3241441, 0x3241513, 0x3241522,
+	0x3241531, 0x3241612, 0x3241621, 0x3241711, 0x3242116, 0x3242125, 0x3242134, 0x3242143,
+	0x3242152, 0x3242161, 0x3242215, 0x3242251, 0x3242314, 0x3242341, 0x3242413, 0x3242431,
+	0x3242512, 0x3242521, 0x3242611, 0x3243115, 0x3243124, 0x3243133, 0x3243142, 0x3243151,
+	0x3243214, 0x3243241, 0x3243313, 0x3243331, 0x3243412, 0x3243421, 0x3243511, 0x3244114,
+	0x3244123, 0x3244132, 0x3244141, 0x3244213, 0x3244231, 0x3244312, 0x3244321, 0x3244411,
+	0x3245113, 0x3245122, 0x3245131, 0x3245212, 0x3245221, 0x3245311, 0x3246112, 0x3246121,
+	0x3246211, 0x3247111, 0x3251116, 0x3251125, 0x3251134, 0x3251143, 0x3251152, 0x3251161,
+	0x3251215, 0x3251224, 0x3251233, 0x3251242, 0x3251251, 0x3251314, 0x3251323, 0x3251332,
+	0x3251341, 0x3251413, 0x3251422, 0x3251431, 0x3251512, 0x3251521, 0x3251611, 0x3252115,
+	0x3252124, 0x3252133, 0x3252142, 0x3252151, 0x3252214, 0x3252241, 0x3252313, 0x3252331,
+	0x3252412, 0x3252421, 0x3252511, 0x3253114, 0x3253123, 0x3253132, 0x3253141, 0x3253213,
+	0x3253231, 0x3253312, 0x3253321, 0x3253411, 0x3254113, 0x3254122, 0x3254131, 0x3254212,
+	0x3254221, 0x3254311, 0x3255112, 0x3255121, 0x3255211, 0x3256111, 0x3261115, 0x3261124,
+	0x3261133, 0x3261142, 0x3261151, 0x3261214, 0x3261223, 0x3261232, 0x3261241, 0x3261313,
+	0x3261322, 0x3261331, 0x3261412, 0x3261421, 0x3261511, 0x3262114, 0x3262123, 0x3262132,
+	0x3262141, 0x3262213, 0x3262231, 0x3262312, 0x3262321, 0x3262411, 0x3263113, 0x3263122,
+	0x3263131, 0x3263212, 0x3263221, 0x3263311, 0x3264112, 0x3264121, 0x3264211, 0x3265111,
+	0x3271114, 0x3271123, 0x3271132, 0x3271141, 0x3271213, 0x3271222, 0x3271231, 0x3271312,
+	0x3271321, 0x3271411, 0x3272113, 0x3272122, 0x3272131, 0x3272212, 0x3272221, 0x3272311,
+	0x3273112, 0x3273121, 0x3273211, 0x3274111, 0x3281113, 0x3281122, 0x3281131, 0x3281212,
+	0x3281221, 0x3281311, 0x3282112, 0x3282121, 0x3282211, 0x3283111, 0x3311128, 0x3311137,
+	0x3311146, 0x3311155, 0x3311164, 0x3311173, 0x3311182, 0x3311218, 0x3311227, 0x3311236,
+	0x3311245, 0x3311254, 0x3311263, 0x3311272, 0x3311281, 0x3311317, 0x3311326, 0x3311335,
+	0x3311344, 0x3311353, 0x3311362, 0x3311371, 0x3311416, 0x3311425, 0x3311434, 0x3311443,
+	0x3311452, 0x3311461, 0x3311515, 0x3311524, 0x3311533, 0x3311542, 0x3311551, 0x3311614,
+	0x3311623, 0x3311632, 0x3311641, 0x3311713, 0x3311722, 0x3311731, 0x3311812, 0x3311821,
+	0x3312118, 0x3312127, 0x3312136, 0x3312145, 0x3312154, 0x3312163, 0x3312172, 0x3312181,
+	0x3312217, 0x3312226, 0x3312235, 0x3312244, 0x3312253, 0x3312262, 0x3312271, 0x3312316,
+	0x3312325, 0x3312334, 0x3312343, 0x3312352, 0x3312361, 0x3312415, 0x3312424, 0x3312433,
+	0x3312442, 0x3312451, 0x3312514, 0x3312523, 0x3312532, 0x3312541, 0x3312613, 0x3312622,
+	0x3312631, 0x3312712, 0x3312721, 0x3312811, 0x3313117, 0x3313126, 0x3313135, 0x3313144,
+	0x3313153, 0x3313162, 0x3313171, 0x3313216, 0x3313225, 0x3313234, 0x3313243, 0x3313252,
+	0x3313261, 0x3313315, 0x3313324, 0x3313333, 0x3313342, 0x3313351, 0x3313414, 0x3313423,
+	0x3313432, 0x3313441, 0x3313513, 0x3313522, 0x3313531, 0x3313612, 0x3313621, 0x3313711,
+	0x3314116, 0x3314125, 0x3314134, 0x3314143, 0x3314152, 0x3314161, 0x3314215, 0x3314224,
+	0x3314233, 0x3314242, 0x3314251, 0x3314314, 0x3314323, 0x3314332, 0x3314341, 0x3314413,
+	0x3314422, 0x3314431, 0x3314512, 0x3314521, 0x3314611, 0x3315115, 0x3315124, 0x3315133,
+	0x3315142, 0x3315151, 0x3315214, 0x3315223, 0x3315232, 0x3315241, 0x3315313, 0x3315322,
+	0x3315331, 0x3315412, 0x3315421, 0x3315511, 0x3316114, 0x3316123, 0x3316132, 0x3316141,
+	0x3316213, 0x3316222, 0x3316231, 0x3316312, 0x3316321, 0x3316411, 0x3317113, 0x3317122,
+	0x3317131, 0x3317212, 0x3317221, 0x3317311, 0x3318112, 0x3318121, 0x3318211, 0x3321118,
+	0x3321127, 0x3321136, 0x3321145, 0x3321154, 0x3321163, 0x3321172, 0x3321181, 0x3321217,
+	0x3321226, 0x3321235, 0x3321244, 0x3321253, 0x3321262, 0x3321271, 0x3321316, 0x3321325,
+	0x3321334, 0x3321343, 0x3321352, 0x3321361, 0x3321415, 0x3321424, 0x3321433, 0x3321442,
+	0x3321451, 0x3321514, 0x3321523, 0x3321532, 0x3321541, 0x3321613, 0x3321622, 0x3321631,
+	0x3321712, 0x3321721, 0x3321811, 0x3322117, 0x3322126, 0x3322135, 0x3322144, 0x3322153,
+	0x3322162, 0x3322171, 0x3322216, 0x3322261, 0x3322315, 0x3322351, 0x3322414, 0x3322441,
+	0x3322513, 0x3322531, 0x3322612, 0x3322621, 0x3322711, 0x3323116, 0x3323125, 0x3323134,
+	0x3323143, 0x3323152, 0x3323161, 0x3323215, 0x3323251, 0x3323314, 0x3323341, 0x3323413,
+	0x3323431, 0x3323512, 0x3323521, 0x3323611, 0x3324115, 0x3324124, 0x3324133, 0x3324142,
+	0x3324151, 0x3324214, 0x3324241, 0x3324313, 0x3324331, 0x3324412, 0x3324421, 0x3324511,
+	0x3325114, 0x3325123, 0x3325132, 0x3325141, 0x3325213, 0x3325231, 0x3325312, 0x3325321,
+	0x3325411, 0x3326113, 0x3326122, 0x3326131, 0x3326212, 0x3326221, 0x3326311, 0x3327112,
+	0x3327121, 0x3327211, 0x3328111, 0x3331117, 0x3331126, 0x3331135, 0x3331144, 0x3331153,
+	0x3331162, 0x3331171, 0x3331216, 0x3331225, 0x3331234, 0x3331243, 0x3331252, 0x3331261,
+	0x3331315, 0x3331324, 0x3331333, 0x3331342, 0x3331351, 0x3331414, 0x3331423, 0x3331432,
+	0x3331441, 0x3331513, 0x3331522, 0x3331531, 0x3331612, 0x3331621, 0x3331711, 0x3332116,
+	0x3332125, 0x3332134, 0x3332143, 0x3332152, 0x3332161, 0x3332215, 0x3332251, 0x3332314,
+	0x3332341, 0x3332413, 0x3332431, 0x3332512, 0x3332521, 0x3332611, 0x3333115, 0x3333124,
+	0x3333133, 0x3333142, 0x3333151, 0x3333214, 0x3333241, 0x3333313, 0x3333331, 0x3333412,
+	0x3333421, 0x3333511, 0x3334114, 0x3334123, 0x3334132, 0x3334141, 0x3334213, 0x3334231,
+	0x3334312, 0x3334321, 0x3334411, 0x3335113, 0x3335122, 0x3335131, 0x3335212, 0x3335221,
+	0x3335311, 0x3336112, 0x3336121, 0x3336211, 0x3337111, 0x3341116, 0x3341125, 0x3341134,
+	0x3341143, 0x3341152, 0x3341161, 0x3341215, 0x3341224, 0x3341233, 0x3341242, 0x3341251,
+	0x3341314, 0x3341323, 0x3341332, 0x3341341, 0x3341413, 0x3341422, 0x3341431, 0x3341512,
+	0x3341521, 0x3341611, 0x3342115, 0x3342124, 0x3342133, 0x3342142, 0x3342151, 0x3342214,
+	0x3342241, 0x3342313, 0x3342331, 0x3342412, 0x3342421, 0x3342511, 0x3343114, 0x3343123,
+	0x3343132, 0x3343141, 0x3343213, 0x3343231, 0x3343312, 0x3343321, 0x3343411, 0x3344113,
+	0x3344122, 0x3344131, 0x3344212, 0x3344221, 0x3344311, 0x3345112, 0x3345121, 0x3345211,
+	0x3346111, 0x3351115, 0x3351124, 0x3351133, 0x3351142, 0x3351151, 0x3351214, 0x3351223,
+	0x3351232, 0x3351241, 0x3351313, 0x3351322, 0x3351331, 0x3351412, 0x3351421, 0x3351511,
+	0x3352114, 0x3352123, 0x3352132, 0x3352141, 0x3352213, 0x3352231, 0x3352312, 0x3352321,
+	0x3352411, 0x3353113, 0x3353122, 0x3353131, 0x3353212, 0x3353221, 0x3353311, 0x3354112,
+	0x3354121, 0x3354211, 0x3355111, 0x3361114, 0x3361123, 0x3361132, 0x3361141, 0x3361213,
+	0x3361222, 0x3361231, 0x3361312, 0x3361321, 0x3361411, 0x3362113, 0x3362122, 0x3362131,
+	0x3362212, 0x3362221, 0x3362311, 0x3363112, 0x3363121, 0x3363211, 0x3364111, 0x3371113,
+	0x3371122, 0x3371131, 0x3371212, 0x3371221, 0x3371311, 0x3372112, 0x3372121, 0x3372211,
+	0x3373111, 0x3381112, 0x3381121, 0x3381211, 0x3382111, 0x3411118, 0x3411127, 0x3411136,
+	0x3411145, 0x3411154, 0x3411163, 0x3411172, 0x3411181, 0x3411217, 0x3411226, 0x3411235,
+	0x3411244, 0x3411253, 0x3411262, 0x3411271, 0x3411316, 0x3411325, 0x3411334, 0x3411343,
+	0x3411352, 0x3411361, 0x3411415, 0x3411424, 0x3411433, 0x3411442, 0x3411451, 0x3411514,
+	0x3411523, 0x3411532, 0x3411541, 0x3411613, 0x3411622, 0x3411631, 0x3411712, 0x3411721,
+	0x3411811, 0x3412117, 0x3412126, 0x3412135, 0x3412144, 0x3412153, 0x3412162, 0x3412171,
+	0x3412216, 0x3412225, 0x3412234, 0x3412243, 0x3412252, 0x3412261, 0x3412315, 0x3412324,
+	0x3412333, 0x3412342, 0x3412351, 0x3412414, 0x3412423, 0x3412432, 0x3412441, 0x3412513,
+	0x3412522, 0x3412531, 0x3412612, 0x3412621, 0x3412711, 0x3413116, 0x3413125, 0x3413134,
+	0x3413143, 0x3413152, 0x3413161, 0x3413215, 0x3413224, 0x3413233, 0x3413242, 0x3413251,
+	0x3413314, 0x3413323, 0x3413332, 0x3413341, 0x3413413, 0x3413422, 0x3413431, 0x3413512,
+	0x3413521, 0x3413611, 0x3414115, 0x3414124, 0x3414133, 0x3414142, 0x3414151, 0x3414214,
+	0x3414223, 0x3414232, 0x3414241, 0x3414313, 0x3414322, 0x3414331, 0x3414412, 0x3414421,
+	0x3414511, 0x3415114, 0x3415123, 0x3415132, 0x3415141, 0x3415213, 0x3415222, 0x3415231,
+	0x3415312, 0x3415321, 0x3415411, 0x3416113, 0x3416122, 0x3416131, 0x3416212, 0x3416221,
+	0x3416311, 0x3417112, 0x3417121, 0x3417211, 0x3418111, 0x3421117, 0x3421126, 0x3421135,
+	0x3421144, 0x3421153, 0x3421162, 0x3421171, 0x3421216, 0x3421225, 0x3421234, 0x3421243,
+	0x3421252, 0x3421261, 0x3421315, 0x3421324, 0x3421333, 0x3421342, 0x3421351, 0x3421414,
+	0x3421423, 0x3421432, 0x3421441, 0x3421513, 0x3421522, 0x3421531, 0x3421612, 0x3421621,
+	0x3421711, 0x3422116, 0x3422125, 0x3422134, 0x3422143, 0x3422152, 0x3422161, 0x3422215,
+	0x3422251, 0x3422314, 0x3422341, 0x3422413, 0x3422431, 0x3422512, 0x3422521, 0x3422611,
+	0x3423115, 0x3423124, 0x3423133, 0x3423142, 0x3423151, 0x3423214, 0x3423241, 0x3423313,
+	0x3423331, 0x3423412, 0x3423421, 0x3423511, 0x3424114, 0x3424123, 0x3424132, 0x3424141,
+	0x3424213, 0x3424231, 0x3424312, 0x3424321, 0x3424411, 0x3425113, 0x3425122, 0x3425131,
+	0x3425212, 0x3425221, 0x3425311, 0x3426112, 0x3426121, 0x3426211, 0x3427111, 0x3431116,
+	0x3431125, 0x3431134, 0x3431143, 0x3431152, 0x3431161, 0x3431215, 0x3431224, 0x3431233,
+	0x3431242, 0x3431251, 0x3431314, 0x3431323, 0x3431332, 0x3431341, 0x3431413, 0x3431422,
+	0x3431431, 0x3431512, 0x3431521, 0x3431611, 0x3432115, 0x3432124, 0x3432133, 0x3432142,
+	0x3432151, 0x3432214, 0x3432241, 0x3432313, 0x3432331, 0x3432412, 0x3432421, 0x3432511,
+	0x3433114, 0x3433123, 0x3433132, 0x3433141, 0x3433213, 0x3433231, 0x3433312, 0x3433321,
+	0x3433411, 0x3434113, 0x3434122, 0x3434131, 0x3434212, 0x3434221, 0x3434311, 0x3435112,
+	0x3435121, 0x3435211, 0x3436111, 0x3441115, 0x3441124, 0x3441133, 0x3441142, 0x3441151,
+	0x3441214, 0x3441223, 0x3441232, 0x3441241, 0x3441313, 0x3441322, 0x3441331, 0x3441412,
+	0x3441421, 0x3441511, 0x3442114, 0x3442123, 0x3442132, 0x3442141, 0x3442213, 0x3442231,
+	0x3442312, 0x3442321, 0x3442411, 0x3443113, 0x3443122, 0x3443131, 0x3443212, 0x3443221,
+	0x3443311, 0x3444112, 0x3444121, 0x3444211, 0x3445111, 0x3451114, 0x3451123, 0x3451132,
+	0x3451141, 0x3451213, 0x3451222, 0x3451231, 0x3451312, 0x3451321, 0x3451411, 0x3452113,
+	0x3452122, 0x3452131, 0x3452212, 0x3452221, 0x3452311, 0x3453112, 0x3453121, 0x3453211,
+	0x3454111, 0x3461113, 0x3461122, 0x3461131, 0x3461212, 0x3461221, 0x3461311, 0x3462112,
+	0x3462121, 0x3462211, 0x3463111, 0x3471112, 0x3471121, 0x3471211, 0x3472111, 0x3481111,
+	0x3511117, 0x3511126, 0x3511135, 0x3511144, 0x3511153, 0x3511162, 0x3511171, 0x3511216,
+	0x3511225, 0x3511234, 0x3511243, 0x3511252, 0x3511261, 0x3511315, 0x3511324, 0x3511333,
+	0x3511342, 0x3511351, 0x3511414, 0x3511423, 0x3511432, 0x3511441, 0x3511513, 0x3511522,
+	0x3511531, 0x3511612, 0x3511621, 0x3511711, 0x3512116, 0x3512125, 0x3512134, 0x3512143,
+	0x3512152, 0x3512161, 0x3512215, 0x3512224, 0x3512233, 0x3512242, 0x3512251, 0x3512314,
+	0x3512323, 0x3512332, 0x3512341, 0x3512413, 0x3512422, 0x3512431, 0x3512512, 0x3512521,
+	0x3512611, 0x3513115, 0x3513124, 0x3513133, 0x3513142, 0x3513151, 0x3513214, 0x3513223,
+	0x3513232, 0x3513241, 0x3513313, 0x3513322, 0x3513331, 0x3513412, 0x3513421, 0x3513511,
+	0x3514114, 0x3514123, 0x3514132, 0x3514141, 0x3514213, 0x3514222, 0x3514231, 0x3514312,
+	0x3514321, 0x3514411, 0x3515113, 0x3515122, 0x3515131, 0x3515212, 0x3515221, 0x3515311,
+	0x3516112, 0x3516121, 0x3516211, 0x3517111, 0x3521116, 0x3521125, 0x3521134, 0x3521143,
+	0x3521152, 0x3521161, 0x3521215, 0x3521224, 0x3521233, 0x3521242, 0x3521251, 0x3521314,
+	0x3521323, 0x3521332, 0x3521341, 0x3521413, 0x3521422, 0x3521431, 0x3521512, 0x3521521,
+	0x3521611, 0x3522115, 0x3522124, 0x3522133, 0x3522142, 0x3522151, 0x3522214, 0x3522241,
+	0x3522313, 0x3522331, 0x3522412, 0x3522421, 0x3522511, 0x3523114, 0x3523123, 0x3523132,
+	0x3523141, 0x3523213, 0x3523231, 0x3523312, 0x3523321, 0x3523411, 0x3524113, 0x3524122,
+	0x3524131, 0x3524212, 0x3524221, 0x3524311, 0x3525112, 0x3525121, 0x3525211, 0x3526111,
+	0x3531115, 0x3531124, 0x3531133, 0x3531142, 0x3531151, 0x3531214, 0x3531223, 0x3531232,
+	0x3531241, 0x3531313, 0x3531322, 0x3531331, 0x3531412, 0x3531421, 0x3531511, 0x3532114,
+	0x3532123, 0x3532132, 0x3532141, 0x3532213, 0x3532231, 0x3532312, 0x3532321, 0x3532411,
+	0x3533113, 0x3533122, 0x3533131, 0x3533212, 0x3533221, 0x3533311, 0x3534112, 0x3534121,
+	0x3534211, 0x3535111, 0x3541114, 0x3541123, 0x3541132, 0x3541141, 0x3541213, 0x3541222,
+	0x3541231, 0x3541312, 0x3541321, 0x3541411, 0x3542113, 0x3542122, 0x3542131, 0x3542212,
+	0x3542221, 0x3542311, 0x3543112, 0x3543121, 0x3543211, 0x3544111, 0x3551113, 0x3551122,
+	0x3551131, 0x3551212, 0x3551221, 0x3551311, 0x3552112, 0x3552121, 0x3552211, 0x3553111,
+	0x3561112, 0x3561121, 0x3561211, 0x3562111, 0x3571111, 0x3611116, 0x3611125, 0x3611134,
+	0x3611143, 0x3611152, 0x3611161, 0x3611215, 0x3611224, 0x3611233, 0x3611242, 0x3611251,
+	0x3611314, 0x3611323, 0x3611332, 0x3611341, 0x3611413, 0x3611422, 0x3611431, 0x3611512,
+	0x3611521, 0x3611611, 0x3612115, 0x3612124, 0x3612133, 0x3612142, 0x3612151, 0x3612214,
+	0x3612223, 0x3612232, 0x3612241, 0x3612313, 0x3612322, 0x3612331, 0x3612412, 0x3612421,
+	0x3612511, 0x3613114, 0x3613123, 0x3613132, 0x3613141, 0x3613213, 0x3613222, 0x3613231,
+	0x3613312, 0x3613321, 0x3613411, 0x3614113, 0x3614122, 0x3614131, 0x3614212, 0x3614221,
+	0x3614311, 0x3615112, 0x3615121, 0x3615211, 0x3616111, 0x3621115, 0x3621124, 0x3621133,
+	0x3621142, 0x3621151, 0x3621214, 0x3621223, 0x3621232, 0x3621241, 0x3621313, 0x3621322,
+	0x3621331, 0x3621412, 0x3621421, 0x3621511, 0x3622114, 0x3622123, 0x3622132, 0x3622141,
+	0x3622213, 0x3622231, 0x3622312, 0x3622321, 0x3622411, 0x3623113, 0x3623122, 0x3623131,
+	0x3623212, 0x3623221, 0x3623311, 0x3624112, 0x3624121, 0x3624211, 0x3625111, 0x3631114,
+	0x3631123, 0x3631132, 0x3631141, 0x3631213, 0x3631222, 0x3631231, 0x3631312, 0x3631321,
+	0x3631411, 0x3632113, 0x3632122, 0x3632131, 0x3632212, 0x3632221, 0x3632311, 0x3633112,
+	0x3633121, 0x3633211, 0x3634111, 0x3641113, 0x3641122, 0x3641131, 0x3641212, 0x3641221,
+	0x3641311, 0x3642112, 0x3642121, 0x3642211, 0x3643111, 0x3651112, 0x3651121, 0x3651211,
+	0x3652111, 0x3661111, 0x3711115, 0x3711124, 0x3711133, 0x3711142, 0x3711151, 0x3711214,
+	0x3711223, 0x3711232, 0x3711241, 0x3711313, 0x3711322, 0x3711331, 0x3711412, 0x3711421,
+	0x3711511, 0x3712114, 0x3712123, 0x3712132, 0x3712141, 0x3712213, 0x3712222, 0x3712231,
+	0x3712312, 0x3712321, 0x3712411, 0x3713113, 0x3713122, 0x3713131, 0x3713212, 0x3713221,
+	0x3713311, 0x3714112, 0x3714121, 0x3714211, 0x3715111, 0x3721114, 0x3721123, 0x3721132,
+	0x3721141, 0x3721213, 0x3721222, 0x3721231, 0x3721312, 0x3721321, 0x3721411, 0x3722113,
+	0x3722122, 0x3722131, 0x3722212, 0x3722221, 0x3722311, 0x3723112, 0x3723121, 0x3723211,
+	0x3724111, 0x3731113, 0x3731122, 0x3731131, 0x3731212, 0x3731221, 0x3731311, 0x3732112,
+	0x3732121, 0x3732211, 0x3733111, 0x3741112, 0x3741121, 0x3741211, 0x3742111, 0x3751111,
+	0x3811114, 0x3811123, 0x3811132, 0x3811141, 0x3811213, 0x3811222, 0x3811231, 0x3811312,
+	0x3811321, 0x3811411, 0x3812113, 0x3812122, 0x3812131, 0x3812212, 0x3812221, 0x3812311,
+	0x3813112, 0x3813121, 0x3813211, 0x3814111, 0x3821113, 0x3821122, 0x3821131, 0x3821212,
+	0x3821221, 0x3821311, 0x3822112, 0x3822121, 0x3822211, 0x3823111, 0x3831112, 0x3831121,
+	0x3831211, 0x3832111, 0x3841111, 0x4111138, 0x4111147, 0x4111156, 0x4111165, 0x4111174,
+	0x4111183, 0x4111228, 0x4111237, 0x4111246, 0x4111255, 0x4111264, 0x4111273, 0x4111282,
+	0x4111318, 0x4111327, 0x4111336, 0x4111345, 0x4111354, 0x4111363, 0x4111372, 0x4111381,
+	0x4111417, 0x4111426, 0x4111435, 0x4111444, 0x4111453, 0x4111462, 0x4111471, 0x4111516,
+	0x4111525, 0x4111534, 0x4111543, 0x4111552, 0x4111561, 0x4111615, 0x4111624, 0x4111633,
+	0x4111642, 0x4111651, 0x4111714, 0x4111723, 0x4111732, 0x4111741, 0x4111813, 0x4111822,
+	0x4111831, 0x4112128, 0x4112137, 0x4112146, 0x4112155, 0x4112164, 0x4112173, 0x4112182,
+	0x4112218, 0x4112227, 0x4112236, 0x4112245, 0x4112254, 0x4112263, 0x4112272, 0x4112281,
+	0x4112317, 0x4112326, 0x4112335, 0x4112344, 0x4112353, 0x4112362, 0x4112371, 0x4112416,
+	0x4112425, 0x4112434, 0x4112443, 0x4112452, 0x4112461, 0x4112515, 0x4112524, 0x4112533,
+	0x4112542, 0x4112551, 0x4112614, 0x4112623, 0x4112632, 0x4112641, 0x4112713, 0x4112722,
+	0x4112731, 0x4112812, 0x4112821, 0x4113118, 0x4113127, 0x4113136, 0x4113145, 0x4113154,
+	0x4113163, 0x4113172, 0x4113181, 0x4113217, 0x4113226, 0x4113235, 0x4113244, 0x4113253,
+	0x4113262, 0x4113271, 0x4113316, 0x4113325, 0x4113334, 0x4113343, 0x4113352, 0x4113361,
+	0x4113415, 0x4113424, 0x4113433, 0x4113442, 0x4113451, 0x4113514, 0x4113523, 0x4113532,
+	0x4113541, 0x4113613, 0x4113622, 0x4113631, 0x4113712, 0x4113721, 0x4113811, 0x4114117,
+	0x4114126, 0x4114135, 0x4114144, 0x4114153, 0x4114162, 0x4114171, 0x4114216, 0x4114225,
+	0x4114234, 0x4114243, 0x4114252, 0x4114261, 0x4114315, 0x4114324, 0x4114333, 0x4114342,
+	0x4114351, 0x4114414, 0x4114423, 0x4114432, 0x4114441, 0x4114513, 0x4114522, 0x4114531,
+	0x4114612, 0x4114621, 0x4114711, 0x4115116, 0x4115125, 0x4115134, 0x4115143, 0x4115152,
+	0x4115161, 0x4115215, 0x4115224, 0x4115233, 0x4115242, 0x4115251, 0x4115314, 0x4115323,
+	0x4115332, 0x4115341, 0x4115413, 0x4115422, 0x4115431, 0x4115512, 0x4115521, 0x4115611,
+	0x4116115, 0x4116124, 0x4116133, 0x4116142, 0x4116151, 0x4116214, 0x4116223, 0x4116232,
+	0x4116241, 0x4116313, 0x4116322, 0x4116331, 0x4116412, 0x4116421, 0x4116511, 0x4117114,
+	0x4117123, 0x4117132, 0x4117141, 0x4117213, 0x4117222, 0x4117231, 0x4117312, 0x4117321,
+	0x4117411, 0x4118113, 0x4118122, 0x4118131, 0x4118212, 0x4118221, 0x4118311, 0x4121128,
+	0x4121137, 0x4121146, 0x4121155, 0x4121164, 0x4121173, 0x4121182, 0x4121218, 0x4121227,
+	0x4121236, 0x4121245, 0x4121254, 0x4121263, 0x4121272, 0x4121281, 0x4121317, 0x4121326,
+	0x4121335, 0x4121344, 0x4121353, 0x4121362, 0x4121371, 0x4121416, 0x4121425, 0x4121434,
+	0x4121443, 0x4121452, 0x4121461, 0x4121515, 0x4121524, 0x4121533, 0x4121542, 0x4121551,
+	0x4121614, 0x4121623, 0x4121632, 0x4121641, 0x4121713, 0x4121722, 0x4121731, 0x4121812,
+	0x4121821, 0x4122118, 0x4122127, 0x4122136, 0x4122145, 0x4122154, 0x4122163, 0x4122172,
+	0x4122181, 0x4122217, 0x4122226, 0x4122235, 0x4122244, 0x4122253, 0x4122262, 0x4122271,
+	0x4122316, 0x4122325, 0x4122334, 0x4122343, 0x4122352, 0x4122361, 0x4122415, 0x4122424,
+	0x4122433, 0x4122442, 0x4122451, 0x4122514, 0x4122523, 0x4122532, 0x4122541, 0x4122613,
+	0x4122622, 0x4122631, 0x4122712, 0x4122721, 0x4122811, 0x4123117, 0x4123126, 0x4123135,
+	0x4123144, 0x4123153, 0x4123162, 0x4123171, 0x4123216, 0x4123225, 0x4123234, 0x4123243,
+	0x4123252, 0x4123261, 0x4123315, 0x4123324, 0x4123333, 0x4123342, 0x4123351, 0x4123414,
+	0x4123423, 0x4123432, 0x4123441, 0x4123513, 0x4123522, 0x4123531, 0x4123612, 0x4123621,
+	0x4123711, 0x4124116, 0x4124125, 0x4124134, 0x4124143, 0x4124152, 0x4124161, 0x4124215,
+	0x4124224, 0x4124233, 0x4124242, 0x4124251, 0x4124314, 0x4124323, 0x4124332, 0x4124341,
+	0x4124413, 0x4124422, 0x4124431, 0x4124512, 0x4124521, 0x4124611, 0x4125115, 0x4125124,
+	0x4125133, 0x4125142, 0x4125151, 0x4125214, 0x4125223, 0x4125232, 0x4125241, 0x4125313,
+	0x4125322, 0x4125331, 0x4125412, 0x4125421, 0x4125511, 0x4126114, 0x4126123, 0x4126132,
+	0x4126141, 0x4126213, 0x4126222, 0x4126231, 0x4126312, 0x4126321, 0x4126411, 0x4127113,
+	0x4127122, 0x4127131, 0x4127212, 0x4127221, 0x4127311, 0x4128112, 0x4128121, 0x4128211,
+	0x4131118, 0x4131127, 0x4131136, 0x4131145, 0x4131154, 0x4131163, 0x4131172, 0x4131181,
+	0x4131217, 0x4131226, 0x4131235, 0x4131244, 0x4131253, 0x4131262, 0x4131271, 0x4131316,
+	0x4131325, 0x4131334, 0x4131343, 0x4131352, 0x4131361, 0x4131415, 0x4131424, 0x4131433,
+	0x4131442, 0x4131451, 0x4131514, 0x4131523, 0x4131532, 0x4131541, 0x4131613, 0x4131622,
+	0x4131631, 0x4131712, 0x4131721, 0x4131811, 0x4132117, 0x4132126, 0x4132135, 0x4132144,
+	0x4132153, 0x4132162, 0x4132171, 0x4132216, 0x4132225, 0x4132234, 0x4132243, 0x4132252,
+	0x4132261, 0x4132315, 0x4132324, 0x4132333, 0x4132342, 0x4132351, 0x4132414, 0x4132423,
+	0x4132432, 0x4132441, 0x4132513, 0x4132522, 0x4132531, 0x4132612, 0x4132621, 0x4132711,
+	0x4133116, 0x4133125, 0x4133134, 0x4133143, 0x4133152, 0x4133161, 0x4133215, 0x4133224,
+	0x4133233, 0x4133242, 0x4133251, 0x4133314, 0x4133323, 0x4133332, 0x4133341, 0x4133413,
+	0x4133422, 0x4133431, 0x4133512, 0x4133521, 0x4133611, 0x4134115, 0x4134124, 0x4134133,
+	0x4134142, 0x4134151, 0x4134214, 0x4134223, 0x4134232, 0x4134241, 0x4134313, 0x4134322,
+	0x4134331, 0x4134412, 0x4134421, 0x4134511, 0x4135114, 0x4135123, 0x4135132, 0x4135141,
+	0x4135213, 0x4135222, 0x4135231, 0x4135312, 0x4135321, 0x4135411, 0x4136113, 0x4136122,
+	0x4136131, 0x4136212, 0x4136221, 0x4136311, 0x4137112, 0x4137121, 0x4137211, 0x4138111,
+	0x4141117, 0x4141126, 0x4141135, 0x4141144, 0x4141153, 0x4141162, 0x4141171, 0x4141216,
+	0x4141225, 0x4141234, 0x4141243, 0x4141252, 0x4141261, 0x4141315, 0x4141324, 0x4141333,
+	0x4141342, 0x4141351, 0x4141414, 0x4141423, 0x4141432, 0x4141441, 0x4141513, 0x4141522,
+	0x4141531, 0x4141612, 0x4141621, 0x4141711, 0x4142116, 0x4142125, 0x4142134, 0x4142143,
+	0x4142152, 0x4142161, 0x4142215, 0x4142224, 0x4142233, 0x4142242, 0x4142251, 0x4142314,
+	0x4142323, 0x4142332, 0x4142341, 0x4142413, 0x4142422, 0x4142431, 0x4142512, 0x4142521,
+	0x4142611, 0x4143115, 0x4143124, 0x4143133, 0x4143142, 0x4143151, 0x4143214, 0x4143223,
+	0x4143232, 0x4143241, 0x4143313, 0x4143322, 0x4143331, 0x4143412, 0x4143421, 0x4143511,
+	0x4144114, 0x4144123, 0x4144132, 0x4144141, 0x4144213, 0x4144222, 0x4144231, 0x4144312,
+	0x4144321, 0x4144411, 0x4145113, 0x4145122, 0x4145131, 0x4145212, 0x4145221, 0x4145311,
+	0x4146112, 0x4146121, 0x4146211, 0x4147111, 0x4151116, 0x4151125, 0x4151134, 0x4151143,
+	0x4151152, 0x4151161, 0x4151215, 0x4151224, 0x4151233, 0x4151242, 0x4151251, 0x4151314,
+	0x4151323, 0x4151332, 0x4151341, 0x4151413, 0x4151422, 0x4151431, 0x4151512, 0x4151521,
+	0x4151611, 0x4152115, 0x4152124, 0x4152133, 0x4152142, 0x4152151, 0x4152214, 0x4152223,
+	0x4152232, 0x4152241, 0x4152313, 0x4152322, 0x4152331, 0x4152412, 0x4152421, 0x4152511,
+	0x4153114, 0x4153123, 0x4153132, 0x4153141, 0x4153213, 0x4153222, 0x4153231, 0x4153312,
+	0x4153321, 0x4153411, 0x4154113, 0x4154122, 0x4154131, 0x4154212, 0x4154221, 0x4154311,
+	0x4155112, 0x4155121, 0x4155211, 0x4156111, 0x4161115, 0x4161124, 0x4161133, 0x4161142,
+	0x4161151, 0x4161214, 0x4161223, 0x4161232, 0x4161241, 0x4161313, 0x4161322, 0x4161331,
+	0x4161412, 0x4161421, 0x4161511, 0x4162114, 0x4162123, 0x4162132, 0x4162141, 0x4162213,
+	0x4162222, 0x4162231, 0x4162312, 0x4162321, 0x4162411, 0x4163113, 0x4163122, 0x4163131,
+	0x4163212, 0x4163221, 0x4163311, 0x4164112, 0x4164121, 0x4164211, 0x4165111, 0x4171114,
+	0x4171123, 0x4171132, 0x4171141, 0x4171213, 0x4171222, 0x4171231, 0x4171312, 0x4171321,
+	0x4171411, 0x4172113, 0x4172122, 0x4172131, 0x4172212, 0x4172221, 0x4172311, 0x4173112,
+	0x4173121, 0x4173211, 0x4174111, 0x4181113, 0x4181122, 0x4181131, 0x4181212, 0x4181221,
+	0x4181311, 0x4182112, 0x4182121, 0x4182211, 0x4183111, 0x4211128, 0x4211137, 0x4211146,
+	0x4211155, 0x4211164, 0x4211173, 0x4211182, 0x4211218, 0x4211227, 0x4211236, 0x4211245,
+	0x4211254, 0x4211263, 0x4211272, 0x4211281, 0x4211317, 0x4211326, 0x4211335, 0x4211344,
+	0x4211353, 0x4211362, 0x4211371, 0x4211416, 0x4211425, 0x4211434, 0x4211443, 0x4211452,
+	0x4211461, 0x4211515, 0x4211524, 0x4211533, 0x4211542, 0x4211551, 0x4211614, 0x4211623,
+	0x4211632, 0x4211641, 0x4211713, 0x4211722, 0x4211731, 0x4211812, 0x4211821, 0x4212118,
+	0x4212127, 0x4212136, 0x4212145, 0x4212154, 0x4212163, 0x4212172, 0x4212181, 0x4212217,
+	0x4212226, 0x4212235, 0x4212244, 0x4212253, 0x4212262, 0x4212271, 0x4212316, 0x4212325,
+	0x4212334, 0x4212343, 0x4212352, 0x4212361, 0x4212415, 0x4212424, 0x4212433, 0x4212442,
+	0x4212451, 0x4212514, 0x4212523, 0x4212532, 0x4212541, 0x4212613, 0x4212622, 0x4212631,
+	0x4212712, 0x4212721, 0x4212811, 0x4213117, 0x4213126, 0x4213135, 0x4213144, 0x4213153,
+	0x4213162, 0x4213171, 0x4213216, 0x4213225, 0x4213234, 0x4213243, 0x4213252, 0x4213261,
+	0x4213315, 0x4213324, 0x4213333, 0x4213342, 0x4213351, 0x4213414, 0x4213423, 0x4213432,
+	0x4213441, 0x4213513, 0x4213522, 0x4213531, 0x4213612, 0x4213621, 0x4213711, 0x4214116,
+	0x4214125, 0x4214134, 0x4214143, 0x4214152, 0x4214161, 0x4214215, 0x4214224, 0x4214233,
+	0x4214242, 0x4214251, 0x4214314, 0x4214323, 0x4214332, 0x4214341, 0x4214413, 0x4214422,
+	0x4214431, 0x4214512, 0x4214521, 0x4214611, 0x4215115, 0x4215124, 0x4215133, 0x4215142,
+	0x4215151, 0x4215214, 0x4215223, 0x4215232, 0x4215241, 0x4215313, 0x4215322, 0x4215331,
+	0x4215412, 0x4215421, 0x4215511, 0x4216114, 0x4216123, 0x4216132, 0x4216141, 0x4216213,
+	0x4216222, 0x4216231, 0x4216312, 0x4216321, 0x4216411, 0x4217113, 0x4217122, 0x4217131,
+	0x4217212, 0x4217221, 0x4217311, 0x4218112, 0x4218121, 0x4218211, 0x4221118, 0x4221127,
+	0x4221136, 0x4221145, 0x4221154, 0x4221163, 0x4221172, 0x4221181, 0x4221217, 0x4221226,
+	0x4221235, 0x4221244, 0x4221253, 0x4221262, 0x4221271, 0x4221316, 0x4221325, 0x4221334,
+	0x4221343, 0x4221352, 0x4221361, 0x4221415, 0x4221424, 0x4221433, 0x4221442, 0x4221451,
+	0x4221514, 0x4221523, 0x4221532, 0x4221541, 0x4221613, 0x4221622, 0x4221631, 0x4221712,
+	0x4221721, 0x4221811, 0x4222117, 0x4222126, 0x4222135, 0x4222144, 0x4222153, 0x4222162,
+	0x4222171, 0x4222216, 0x4222261, 0x4222315, 0x4222351, 0x4222414, 0x4222441, 0x4222513,
+	0x4222531, 0x4222612, 0x4222621, 0x4222711, 0x4223116, 0x4223125, 0x4223134, 0x4223143,
+	0x4223152, 0x4223161, 0x4223215, 0x4223251, 0x4223314, 0x4223341, 0x4223413, 0x4223431,
+	0x4223512, 0x4223521, 0x4223611, 0x4224115, 0x4224124, 0x4224133, 0x4224142, 0x4224151,
+	0x4224214, 0x4224241, 0x4224313, 0x4224331, 0x4224412, 0x4224421, 0x4224511, 0x4225114,
+	0x4225123, 0x4225132, 0x4225141, 0x4225213, 0x4225231, 0x4225312, 0x4225321, 0x4225411,
+	0x4226113, 0x4226122, 0x4226131, 0x4226212, 0x4226221, 0x4226311, 0x4227112, 0x4227121,
+	0x4227211, 0x4228111, 0x4231117, 0x4231126, 0x4231135, 0x4231144, 0x4231153, 0x4231162,
+	0x4231171, 0x4231216, 0x4231225, 0x4231234, 0x4231243, 0x4231252, 0x4231261, 0x4231315,
+	0x4231324, 0x4231333, 0x4231342, 0x4231351, 0x4231414, 0x4231423, 0x4231432, 0x4231441,
+	0x4231513, 0x4231522, 0x4231531, 0x4231612, 0x4231621, 0x4231711, 0x4232116, 0x4232125,
+	0x4232134, 0x4232143, 0x4232152, 0x4232161, 0x4232215, 0x4232251, 0x4232314, 0x4232341,
+	0x4232413, 0x4232431, 0x4232512, 0x4232521, 0x4232611, 0x4233115, 0x4233124, 0x4233133,
+	0x4233142, 0x4233151, 0x4233214, 0x4233241, 0x4233313, 0x4233331, 0x4233412, 0x4233421,
+	0x4233511, 0x4234114, 0x4234123, 0x4234132, 0x4234141, 0x4234213, 0x4234231, 0x4234312,
+	0x4234321, 0x4234411, 0x4235113, 0x4235122, 0x4235131, 0x4235212, 0x4235221, 0x4235311,
+	0x4236112, 0x4236121, 0x4236211, 0x4237111, 0x4241116, 0x4241125, 0x4241134, 0x4241143,
+	0x4241152, 0x4241161, 0x4241215, 0x4241224, 0x4241233, 0x4241242, 0x4241251, 0x4241314,
+	0x4241323, 0x4241332, 0x4241341, 0x4241413, 0x4241422, 0x4241431, 0x4241512, 0x4241521,
+	0x4241611, 0x4242115, 0x4242124, 0x4242133, 0x4242142, 0x4242151, 0x4242214, 0x4242241,
+	0x4242313, 0x4242331, 0x4242412, 0x4242421, 0x4242511, 0x4243114, 0x4243123, 0x4243132,
+	0x4243141, 0x4243213, 0x4243231, 0x4243312, 0x4243321, 0x4243411, 0x4244113, 0x4244122,
+	0x4244131, 0x4244212, 0x4244221, 0x4244311, 0x4245112, 0x4245121, 0x4245211, 0x4246111,
+	0x4251115, 0x4251124, 0x4251133, 0x4251142, 0x4251151, 0x4251214, 0x4251223, 0x4251232,
+	0x4251241, 0x4251313, 0x4251322, 0x4251331, 0x4251412, 0x4251421, 0x4251511, 0x4252114,
+	0x4252123, 0x4252132, 0x4252141, 0x4252213, 0x4252231, 0x4252312, 0x4252321, 0x4252411,
+	0x4253113, 0x4253122, 0x4253131, 0x4253212, 0x4253221, 0x4253311, 0x4254112, 0x4254121,
+	0x4254211, 0x4255111, 0x4261114, 0x4261123, 0x4261132, 0x4261141, 0x4261213, 0x4261222,
+	0x4261231, 0x4261312, 0x4261321, 0x4261411, 0x4262113, 0x4262122, 0x4262131, 0x4262212,
+	0x4262221, 0x4262311, 0x4263112, 0x4263121, 0x4263211, 0x4264111, 0x4271113, 0x4271122,
+	0x4271131, 0x4271212, 0x4271221, 0x4271311, 0x4272112, 0x4272121, 0x4272211, 0x4273111,
+	0x4281112, 0x4281121, 0x4281211, 0x4282111, 0x4311118, 0x4311127, 0x4311136, 0x4311145,
+	0x4311154, 0x4311163, 0x4311172, 0x4311181, 0x4311217, 0x4311226, 0x4311235, 0x4311244,
+	0x4311253, 0x4311262, 0x4311271, 0x4311316, 0x4311325, 0x4311334, 0x4311343, 0x4311352,
+	0x4311361, 0x4311415, 0x4311424, 0x4311433, 0x4311442, 0x4311451, 0x4311514, 0x4311523,
+	0x4311532, 0x4311541, 0x4311613, 0x4311622, 0x4311631, 0x4311712, 0x4311721, 0x4311811,
+	0x4312117, 0x4312126, 0x4312135, 0x4312144, 0x4312153, 0x4312162, 0x4312171, 0x4312216,
+	0x4312225, 0x4312234, 0x4312243, 0x4312252, 0x4312261, 0x4312315, 0x4312324, 0x4312333,
+	0x4312342, 0x4312351, 0x4312414, 0x4312423, 0x4312432, 0x4312441, 0x4312513, 0x4312522,
+	0x4312531, 0x4312612, 0x4312621, 0x4312711, 0x4313116, 0x4313125, 0x4313134, 0x4313143,
+	0x4313152, 0x4313161, 0x4313215, 0x4313224, 0x4313233, 0x4313242, 0x4313251, 0x4313314,
+	0x4313323, 0x4313332, 0x4313341, 0x4313413, 0x4313422, 0x4313431, 0x4313512, 0x4313521,
+	0x4313611, 0x4314115, 0x4314124, 0x4314133, 0x4314142, 0x4314151, 0x4314214, 0x4314223,
+	0x4314232, 0x4314241, 0x4314313, 0x4314322, 0x4314331, 0x4314412, 0x4314421, 0x4314511,
+	0x4315114, 0x4315123, 0x4315132, 0x4315141, 0x4315213, 0x4315222, 0x4315231, 0x4315312,
+	0x4315321, 0x4315411, 0x4316113, 0x4316122, 0x4316131, 0x4316212, 0x4316221, 0x4316311,
+	0x4317112, 0x4317121, 0x4317211, 0x4318111, 0x4321117, 0x4321126, 0x4321135, 0x4321144,
+	0x4321153, 0x4321162, 0x4321171, 0x4321216, 0x4321225, 0x4321234, 0x4321243, 0x4321252,
+	0x4321261, 0x4321315, 0x4321324, 0x4321333, 0x4321342, 0x4321351, 0x4321414, 0x4321423,
+	0x4321432, 0x4321441, 0x4321513, 0x4321522, 0x4321531, 0x4321612, 0x4321621, 0x4321711,
+	0x4322116, 0x4322125, 0x4322134, 0x4322143, 0x4322152, 0x4322161, 0x4322215, 0x4322251,
+	0x4322314, 0x4322341, 0x4322413, 0x4322431, 0x4322512, 0x4322521, 0x4322611, 0x4323115,
+	0x4323124, 0x4323133, 0x4323142, 0x4323151, 0x4323214, 0x4323241, 0x4323313, 0x4323331,
+	0x4323412, 0x4323421, 0x4323511, 0x4324114, 0x4324123, 0x4324132, 0x4324141, 0x4324213,
+	0x4324231, 0x4324312, 0x4324321, 0x4324411, 0x4325113, 0x4325122, 0x4325131, 0x4325212,
+	0x4325221, 0x4325311, 0x4326112, 0x4326121, 0x4326211, 0x4327111, 0x4331116, 0x4331125,
+	0x4331134, 0x4331143, 0x4331152, 0x4331161, 0x4331215, 0x4331224, 0x4331233, 0x4331242,
+	0x4331251, 0x4331314, 0x4331323, 0x4331332, 0x4331341, 0x4331413, 0x4331422, 0x4331431,
+	0x4331512, 0x4331521, 0x4331611, 0x4332115, 0x4332124, 0x4332133, 0x4332142, 0x4332151,
+	0x4332214, 0x4332241, 0x4332313, 0x4332331, 0x4332412, 0x4332421, 0x4332511, 0x4333114,
+	0x4333123, 0x4333132, 0x4333141, 0x4333213, 0x4333231, 0x4333312, 0x4333321, 0x4333411,
+	0x4334113, 0x4334122, 0x4334131, 0x4334212, 0x4334221, 0x4334311, 0x4335112, 0x4335121,
+	0x4335211, 0x4336111, 0x4341115, 0x4341124, 0x4341133, 0x4341142, 0x4341151, 0x4341214,
+	0x4341223, 0x4341232, 0x4341241, 0x4341313, 0x4341322, 0x4341331, 0x4341412, 0x4341421,
+	0x4341511, 0x4342114, 0x4342123, 0x4342132, 0x4342141, 0x4342213, 0x4342231, 0x4342312,
+	0x4342321, 0x4342411, 0x4343113, 0x4343122, 0x4343131, 0x4343212, 0x4343221, 0x4343311,
+	0x4344112, 0x4344121, 0x4344211, 0x4345111, 0x4351114, 0x4351123, 0x4351132, 0x4351141,
+	0x4351213, 0x4351222, 0x4351231, 0x4351312, 0x4351321, 0x4351411, 0x4352113, 0x4352122,
+	0x4352131, 0x4352212, 0x4352221, 0x4352311, 0x4353112, 0x4353121, 0x4353211, 0x4354111,
+	0x4361113, 0x4361122, 0x4361131, 0x4361212, 0x4361221, 0x4361311, 0x4362112, 0x4362121,
+	0x4362211, 0x4363111, 0x4371112, 0x4371121, 0x4371211, 0x4372111, 0x4381111, 0x4411117,
+	0x4411126, 0x4411135, 0x4411144, 0x4411153, 0x4411162, 0x4411171, 0x4411216, 0x4411225,
+	0x4411234, 0x4411243, 0x4411252, 0x4411261, 0x4411315, 0x4411324, 0x4411333, 0x4411342,
+	0x4411351, 0x4411414, 0x4411423, 0x4411432, 0x4411441, 0x4411513, 0x4411522, 0x4411531,
+	0x4411612, 0x4411621, 0x4411711, 0x4412116, 0x4412125, 0x4412134, 0x4412143, 0x4412152,
+	0x4412161, 0x4412215, 0x4412224, 0x4412233, 0x4412242, 0x4412251, 0x4412314, 0x4412323,
+	0x4412332, 0x4412341, 0x4412413, 0x4412422, 0x4412431, 0x4412512, 0x4412521, 0x4412611,
+	0x4413115, 0x4413124, 0x4413133, 0x4413142, 0x4413151, 0x4413214, 0x4413223, 0x4413232,
+	0x4413241, 0x4413313, 0x4413322, 0x4413331, 0x4413412, 0x4413421, 0x4413511, 0x4414114,
+	0x4414123, 0x4414132, 0x4414141, 0x4414213, 0x4414222, 0x4414231, 0x4414312, 0x4414321,
+	0x4414411, 0x4415113, 0x4415122, 0x4415131, 0x4415212, 0x4415221, 0x4415311, 0x4416112,
+	0x4416121, 0x4416211, 0x4417111, 0x4421116, 0x4421125, 0x4421134, 0x4421143, 0x4421152,
+	0x4421161, 0x4421215, 0x4421224, 0x4421233, 0x4421242, 0x4421251, 0x4421314, 0x4421323,
+	0x4421332, 0x4421341, 0x4421413, 0x4421422, 0x4421431, 0x4421512, 0x4421521, 0x4421611,
+	0x4422115, 0x4422124, 0x4422133, 0x4422142, 0x4422151, 0x4422214, 0x4422241, 0x4422313,
+	0x4422331, 0x4422412, 0x4422421, 0x4422511, 0x4423114, 0x4423123, 0x4423132, 0x4423141,
+	0x4423213, 0x4423231, 0x4423312, 0x4423321, 0x4423411, 0x4424113, 0x4424122, 0x4424131,
+	0x4424212, 0x4424221, 0x4424311, 0x4425112, 0x4425121, 0x4425211, 0x4426111, 0x4431115,
+	0x4431124, 0x4431133, 0x4431142, 0x4431151, 0x4431214, 0x4431223, 0x4431232, 0x4431241,
+	0x4431313, 0x4431322, 0x4431331, 0x4431412, 0x4431421, 0x4431511, 0x4432114, 0x4432123,
+	0x4432132, 0x4432141, 0x4432213, 0x4432231, 0x4432312, 0x4432321, 0x4432411, 0x4433113,
+	0x4433122, 0x4433131, 0x4433212, 0x4433221, 0x4433311, 0x4434112, 0x4434121, 0x4434211,
+	0x4435111, 0x4441114, 0x4441123, 0x4441132, 0x4441141, 0x4441213, 0x4441222, 0x4441231,
+	0x4441312, 0x4441321, 0x4441411, 0x4442113, 0x4442122, 0x4442131, 0x4442212, 0x4442221,
+	0x4442311, 0x4443112, 0x4443121, 0x4443211, 0x4444111, 0x4451113, 0x4451122, 0x4451131,
+	0x4451212, 0x4451221, 0x4451311, 0x4452112, 0x4452121, 0x4452211, 0x4453111, 0x4461112,
+	0x4461121, 0x4461211, 0x4462111, 0x4471111, 0x4511116, 0x4511125, 0x4511134, 0x4511143,
+	0x4511152, 0x4511161, 0x4511215, 0x4511224, 0x4511233, 0x4511242, 0x4511251, 0x4511314,
+	0x4511323, 0x4511332, 0x4511341, 0x4511413, 0x4511422, 0x4511431, 0x4511512, 0x4511521,
+	0x4511611, 0x4512115, 0x4512124, 0x4512133, 0x4512142, 0x4512151, 0x4512214, 0x4512223,
+	0x4512232, 0x4512241, 0x4512313, 0x4512322, 0x4512331, 0x4512412, 0x4512421, 0x4512511,
+	0x4513114, 0x4513123, 0x4513132, 0x4513141, 0x4513213, 0x4513222, 0x4513231, 0x4513312,
+	0x4513321, 0x4513411, 0x4514113, 0x4514122, 0x4514131, 0x4514212, 0x4514221, 0x4514311,
+	0x4515112, 0x4515121, 0x4515211, 0x4516111, 0x4521115, 0x4521124, 0x4521133, 0x4521142,
+	0x4521151, 0x4521214, 0x4521223, 0x4521232, 0x4521241, 0x4521313, 0x4521322, 0x4521331,
+	0x4521412, 0x4521421, 0x4521511, 0x4522114, 0x4522123, 0x4522132, 0x4522141, 0x4522213,
+	0x4522231, 0x4522312, 0x4522321, 0x4522411, 0x4523113, 0x4523122, 0x4523131, 0x4523212,
+	0x4523221, 0x4523311, 0x4524112, 0x4524121, 0x4524211, 0x4525111, 0x4531114, 0x4531123,
+	0x4531132, 0x4531141, 0x4531213, 0x4531222, 0x4531231, 0x4531312, 0x4531321, 0x4531411,
+	0x4532113, 0x4532122, 0x4532131, 0x4532212, 0x4532221, 0x4532311, 0x4533112, 0x4533121,
+	0x4533211, 0x4534111, 0x4541113, 0x4541122, 0x4541131, 0x4541212, 0x4541221, 0x4541311,
+	0x4542112, 0x4542121, 0x4542211, 0x4543111, 0x4551112, 0x4551121, 0x4551211, 0x4552111,
+	0x4561111, 0x4611115, 0x4611124, 0x4611133, 0x4611142, 0x4611151, 0x4611214, 0x4611223,
+	0x4611232, 0x4611241, 0x4611313, 0x4611322, 0x4611331, 0x4611412, 0x4611421, 0x4611511,
+	0x4612114, 0x4612123, 0x4612132, 0x4612141, 0x4612213, 0x4612222, 0x4612231, 0x4612312,
+	0x4612321, 0x4612411, 0x4613113, 0x4613122, 0x4613131, 0x4613212, 0x4613221, 0x4613311,
+	0x4614112, 0x4614121, 0x4614211, 0x4615111, 0x4621114, 0x4621123, 0x4621132, 0x4621141,
+	0x4621213, 0x4621222, 0x4621231, 0x4621312, 0x4621321, 0x4621411, 0x4622113, 0x4622122,
+	0x4622131, 0x4622212, 0x4622221, 0x4622311, 0x4623112, 0x4623121, 0x4623211, 0x4624111,
+	0x4631113, 0x4631122, 0x4631131, 0x4631212, 0x4631221, 0x4631311, 0x4632112, 0x4632121,
+	0x4632211, 0x4633111, 0x4641112, 0x4641121, 0x4641211, 0x4642111, 0x4651111, 0x4711114,
+	0x4711123, 0x4711132, 0x4711141, 0x4711213, 0x4711222, 0x4711231, 0x4711312, 0x4711321,
+	0x4711411, 0x4712113, 0x4712122, 0x4712131, 0x4712212, 0x4712221, 0x4712311, 0x4713112,
+	0x4713121, 0x4713211, 0x4714111, 0x4721113, 0x4721122, 0x4721131, 0x4721212, 0x4721221,
+	0x4721311, 0x4722112, 0x4722121, 0x4722211, 0x4723111, 0x4731112, 0x4731121, 0x4731211,
+	0x4732111, 0x4741111, 0x4811113, 0x4811122, 0x4811131, 0x4811212, 0x4811221, 0x4811311,
+	0x4812112, 0x4812121, 0x4812211, 0x4813111, 0x4821112, 0x4821121, 0x4821211, 0x4822111,
+	0x4831111, 0x5111128, 0x5111137, 0x5111146, 0x5111155, 0x5111164, 0x5111173, 0x5111182,
+	0x5111218, 0x5111227, 0x5111236, 0x5111245, 0x5111254, 0x5111263, 0x5111272, 0x5111281,
+	0x5111317, 0x5111326, 0x5111335, 0x5111344, 0x5111353, 0x5111362, 0x5111371, 0x5111416,
+	0x5111425, 0x5111434, 0x5111443, 0x5111452, 0x5111461, 0x5111515, 0x5111524, 0x5111533,
+	0x5111542, 0x5111551, 0x5111614, 0x5111623, 0x5111632, 0x5111641, 0x5111713, 0x5111722,
+	0x5111731, 0x5111812, 0x5111821, 0x5112118, 0x5112127, 0x5112136, 0x5112145, 0x5112154,
+	0x5112163, 0x5112172, 0x5112181, 0x5112217, 0x5112226, 0x5112235, 0x5112244, 0x5112253,
+	0x5112262, 0x5112271, 0x5112316, 0x5112325, 0x5112334, 0x5112343, 0x5112352, 0x5112361,
+	0x5112415, 0x5112424, 0x5112433, 0x5112442, 0x5112451, 0x5112514, 0x5112523, 0x5112532,
+	0x5112541, 0x5112613, 0x5112622, 0x5112631, 0x5112712, 0x5112721, 0x5112811, 0x5113117,
+	0x5113126, 0x5113135, 0x5113144, 0x5113153, 0x5113162, 0x5113171, 0x5113216, 0x5113225,
+	0x5113234, 0x5113243, 0x5113252, 0x5113261, 0x5113315, 0x5113324, 0x5113333, 0x5113342,
+	0x5113351, 0x5113414, 0x5113423, 0x5113432, 0x5113441, 0x5113513, 0x5113522, 0x5113531,
+	0x5113612, 0x5113621, 0x5113711, 0x5114116, 0x5114125, 0x5114134, 0x5114143, 0x5114152,
+	0x5114161, 0x5114215, 0x5114224, 0x5114233, 0x5114242, 0x5114251, 0x5114314, 0x5114323,
+	0x5114332, 0x5114341, 0x5114413, 0x5114422, 0x5114431, 0x5114512, 0x5114521, 0x5114611,
+	0x5115115, 0x5115124, 0x5115133, 0x5115142, 0x5115151, 0x5115214, 0x5115223, 0x5115232,
+	0x5115241, 0x5115313, 0x5115322, 0x5115331, 0x5115412, 0x5115421, 0x5115511, 0x5116114,
+	0x5116123, 0x5116132, 0x5116141, 0x5116213, 0x5116222, 0x5116231, 0x5116312, 0x5116321,
+	0x5116411, 0x5117113, 0x5117122, 0x5117131, 0x5117212, 0x5117221, 0x5117311, 0x5118112,
+	0x5118121, 0x5118211, 0x5121118, 0x5121127, 0x5121136, 0x5121145, 0x5121154, 0x5121163,
+	0x5121172, 0x5121181, 0x5121217, 0x5121226, 0x5121235, 0x5121244, 0x5121253, 0x5121262,
+	0x5121271, 0x5121316, 0x5121325, 0x5121334, 0x5121343, 0x5121352, 0x5121361, 0x5121415,
+	0x5121424, 0x5121433, 0x5121442, 0x5121451, 0x5121514, 0x5121523, 0x5121532, 0x5121541,
+	0x5121613, 0x5121622, 0x5121631, 0x5121712, 0x5121721, 0x5121811, 0x5122117, 0x5122126,
+	0x5122135, 0x5122144, 0x5122153, 0x5122162, 0x5122171, 0x5122216, 0x5122225, 0x5122234,
+	0x5122243, 0x5122252, 0x5122261, 0x5122315, 0x5122324, 0x5122333, 0x5122342, 0x5122351,
+	0x5122414, 0x5122423, 0x5122432, 0x5122441, 0x5122513, 0x5122522, 0x5122531, 0x5122612,
+	0x5122621, 0x5122711, 0x5123116, 0x5123125, 0x5123134, 0x5123143, 0x5123152, 0x5123161,
+	0x5123215, 0x5123224, 0x5123233, 0x5123242, 0x5123251, 0x5123314, 0x5123323, 0x5123332,
+	0x5123341, 0x5123413, 0x5123422, 0x5123431, 0x5123512, 0x5123521, 0x5123611, 0x5124115,
+	0x5124124, 0x5124133, 0x5124142, 0x5124151, 0x5124214, 0x5124223, 0x5124232, 0x5124241,
+	0x5124313, 0x5124322, 0x5124331, 0x5124412, 0x5124421, 0x5124511, 0x5125114, 0x5125123,
+	0x5125132, 0x5125141, 0x5125213, 0x5125222, 0x5125231, 0x5125312, 0x5125321, 0x5125411,
+	0x5126113, 0x5126122, 0x5126131, 0x5126212, 0x5126221, 0x5126311, 0x5127112, 0x5127121,
+	0x5127211, 0x5128111, 0x5131117, 0x5131126, 0x5131135, 0x5131144, 0x5131153, 0x5131162,
+	0x5131171, 0x5131216, 0x5131225, 0x5131234, 0x5131243, 0x5131252, 0x5131261, 0x5131315,
+	0x5131324, 0x5131333, 0x5131342, 0x5131351, 0x5131414, 0x5131423, 0x5131432, 0x5131441,
+	0x5131513, 0x5131522, 0x5131531, 0x5131612, 0x5131621, 0x5131711, 0x5132116, 0x5132125,
+	0x5132134, 0x5132143, 0x5132152, 0x5132161, 0x5132215, 0x5132224, 0x5132233, 0x5132242,
+	0x5132251, 0x5132314, 0x5132323, 0x5132332, 0x5132341, 0x5132413, 0x5132422, 0x5132431,
+	0x5132512, 0x5132521, 0x5132611, 0x5133115, 0x5133124, 0x5133133, 0x5133142, 0x5133151,
+	0x5133214, 0x5133223, 0x5133232, 0x5133241, 0x5133313, 0x5133322, 0x5133331, 0x5133412,
+	0x5133421, 0x5133511, 0x5134114, 0x5134123, 0x5134132, 0x5134141, 0x5134213, 0x5134222,
+	0x5134231, 0x5134312, 0x5134321, 0x5134411, 0x5135113, 0x5135122, 0x5135131, 0x5135212,
+	0x5135221, 0x5135311, 0x5136112, 0x5136121, 0x5136211, 0x5137111, 0x5141116, 0x5141125,
+	0x5141134, 0x5141143, 0x5141152, 0x5141161, 0x5141215, 0x5141224, 0x5141233, 0x5141242,
+	0x5141251, 0x5141314, 0x5141323, 0x5141332, 0x5141341, 0x5141413, 0x5141422, 0x5141431,
+	0x5141512, 0x5141521, 0x5141611, 0x5142115, 0x5142124, 0x5142133, 0x5142142, 0x5142151,
+	0x5142214, 0x5142223, 0x5142232, 0x5142241, 0x5142313, 0x5142322, 0x5142331, 0x5142412,
+	0x5142421, 0x5142511, 0x5143114, 0x5143123, 0x5143132, 0x5143141, 0x5143213, 0x5143222,
+	0x5143231, 0x5143312, 0x5143321, 0x5143411, 0x5144113, 0x5144122, 0x5144131, 0x5144212,
+	0x5144221, 0x5144311, 0x5145112, 0x5145121, 0x5145211, 0x5146111, 0x5151115, 0x5151124,
+	0x5151133, 0x5151142, 0x5151151, 0x5151214, 0x5151223, 0x5151232, 0x5151241, 0x5151313,
+	0x5151322, 0x5151331, 0x5151412, 0x5151421, 0x5151511, 0x5152114, 0x5152123, 0x5152132,
+	0x5152141, 0x5152213, 0x5152222, 0x5152231, 0x5152312, 0x5152321, 0x5152411, 0x5153113,
+	0x5153122, 0x5153131, 0x5153212, 0x5153221, 0x5153311, 0x5154112, 0x5154121, 0x5154211,
+	0x5155111, 0x5161114, 0x5161123, 0x5161132, 0x5161141, 0x5161213, 0x5161222, 0x5161231,
+	0x5161312, 0x5161321, 0x5161411, 0x5162113, 0x5162122, 0x5162131, 0x5162212, 0x5162221,
+	0x5162311, 0x5163112, 0x5163121, 0x5163211, 0x5164111, 0x5171113, 0x5171122, 0x5171131,
+	0x5171212, 0x5171221, 0x5171311, 0x5172112, 0x5172121, 0x5172211, 0x5173111, 0x5181112,
+	0x5181121, 0x5181211, 0x5182111, 0x5211118, 0x5211127, 0x5211136, 0x5211145, 0x5211154,
+	0x5211163, 0x5211172, 0x5211181, 0x5211217, 0x5211226, 0x5211235, 0x5211244, 0x5211253,
+	0x5211262, 0x5211271, 0x5211316, 0x5211325, 0x5211334, 0x5211343, 0x5211352, 0x5211361,
+	0x5211415, 0x5211424, 0x5211433, 0x5211442, 0x5211451, 0x5211514, 0x5211523, 0x5211532,
+	0x5211541, 0x5211613, 0x5211622, 0x5211631, 0x5211712, 0x5211721, 0x5211811, 0x5212117,
+	0x5212126, 0x5212135, 0x5212144, 0x5212153, 0x5212162, 0x5212171, 0x5212216, 0x5212225,
+	0x5212234, 0x5212243, 0x5212252, 0x5212261, 0x5212315, 0x5212324, 0x5212333, 0x5212342,
+	0x5212351, 0x5212414, 0x5212423, 0x5212432, 0x5212441, 0x5212513, 0x5212522, 0x5212531,
+	0x5212612, 0x5212621, 0x5212711, 0x5213116, 0x5213125, 0x5213134, 0x5213143, 0x5213152,
+	0x5213161, 0x5213215, 0x5213224, 0x5213233, 0x5213242, 0x5213251, 0x5213314, 0x5213323,
+	0x5213332, 0x5213341, 0x5213413, 0x5213422, 0x5213431, 0x5213512, 0x5213521, 0x5213611,
+	0x5214115, 0x5214124, 0x5214133, 0x5214142, 0x5214151, 0x5214214, 0x5214223, 0x5214232,
+	0x5214241, 0x5214313, 0x5214322, 0x5214331, 0x5214412, 0x5214421, 0x5214511, 0x5215114,
+	0x5215123, 0x5215132, 0x5215141, 0x5215213, 0x5215222, 0x5215231, 0x5215312, 0x5215321,
+	0x5215411, 0x5216113, 0x5216122, 0x5216131, 0x5216212, 0x5216221, 0x5216311, 0x5217112,
+	0x5217121, 0x5217211, 0x5218111, 0x5221117, 0x5221126, 0x5221135, 0x5221144, 0x5221153,
+	0x5221162, 0x5221171, 0x5221216, 0x5221225, 0x5221234, 0x5221243, 0x5221252, 0x5221261,
+	0x5221315, 0x5221324, 0x5221333, 0x5221342, 0x5221351, 0x5221414, 0x5221423, 0x5221432,
+	0x5221441, 0x5221513, 0x5221522, 0x5221531, 0x5221612, 0x5221621, 0x5221711, 0x5222116,
+	0x5222125, 0x5222134, 0x5222143, 0x5222152, 0x5222161, 0x5222215, 0x5222251, 0x5222314,
+	0x5222341, 0x5222413, 0x5222431, 0x5222512, 0x5222521, 0x5222611, 0x5223115, 0x5223124,
+	0x5223133, 0x5223142, 0x5223151, 0x5223214, 0x5223241, 0x5223313, 0x5223331, 0x5223412,
+	0x5223421, 0x5223511, 0x5224114, 0x5224123, 0x5224132, 0x5224141, 0x5224213, 0x5224231,
+	0x5224312, 0x5224321, 0x5224411, 0x5225113, 0x5225122, 0x5225131, 0x5225212, 0x5225221,
+	0x5225311, 0x5226112, 0x5226121, 0x5226211, 0x5227111, 0x5231116, 0x5231125, 0x5231134,
+	0x5231143, 0x5231152, 0x5231161, 0x5231215, 0x5231224, 0x5231233, 0x5231242, 0x5231251,
+	0x5231314, 0x5231323, 0x5231332, 0x5231341, 0x5231413, 0x5231422, 0x5231431, 0x5231512,
+	0x5231521, 0x5231611, 0x5232115, 0x5232124, 0x5232133, 0x5232142, 0x5232151, 0x5232214,
+	0x5232241, 0x5232313, 0x5232331, 0x5232412, 0x5232421, 0x5232511, 0x5233114, 0x5233123,
+	0x5233132, 0x5233141, 0x5233213, 0x5233231, 0x5233312, 0x5233321, 0x5233411, 0x5234113,
+	0x5234122, 0x5234131, 0x5234212, 0x5234221, 0x5234311, 0x5235112, 0x5235121, 0x5235211,
+	0x5236111, 0x5241115, 0x5241124, 0x5241133, 0x5241142, 0x5241151, 0x5241214, 0x5241223,
+	0x5241232, 0x5241241, 0x5241313, 0x5241322, 0x5241331, 0x5241412, 0x5241421, 0x5241511,
+	0x5242114, 0x5242123, 0x5242132, 0x5242141, 0x5242213, 0x5242231, 0x5242312, 0x5242321,
+	0x5242411, 0x5243113, 0x5243122, 0x5243131, 0x5243212, 0x5243221, 0x5243311, 0x5244112,
+	0x5244121, 0x5244211, 0x5245111, 0x5251114, 0x5251123, 0x5251132, 0x5251141, 0x5251213,
+	0x5251222, 0x5251231, 0x5251312, 0x5251321, 0x5251411, 0x5252113, 0x5252122, 0x5252131,
+	0x5252212, 0x5252221, 0x5252311, 0x5253112, 0x5253121, 0x5253211, 0x5254111, 0x5261113,
+	0x5261122, 0x5261131, 0x5261212, 0x5261221, 0x5261311, 0x5262112, 0x5262121, 0x5262211,
+	0x5263111, 0x5271112, 0x5271121, 0x5271211, 0x5272111, 0x5281111, 0x5311117, 0x5311126,
+	0x5311135, 0x5311144, 0x5311153, 0x5311162, 0x5311171, 0x5311216, 0x5311225, 0x5311234,
+	0x5311243, 0x5311252, 0x5311261, 0x5311315, 0x5311324, 0x5311333, 0x5311342, 0x5311351,
+	0x5311414, 0x5311423, 0x5311432, 0x5311441, 0x5311513, 0x5311522, 0x5311531, 0x5311612,
+	0x5311621, 0x5311711, 0x5312116, 0x5312125, 0x5312134, 0x5312143, 0x5312152, 0x5312161,
+	0x5312215, 0x5312224, 0x5312233, 0x5312242, 0x5312251, 0x5312314, 0x5312323, 0x5312332,
+	0x5312341, 0x5312413, 0x5312422, 0x5312431, 0x5312512, 0x5312521, 0x5312611, 0x5313115,
+	0x5313124, 0x5313133, 0x5313142, 0x5313151, 0x5313214, 0x5313223, 0x5313232, 0x5313241,
+	0x5313313, 0x5313322, 0x5313331, 0x5313412, 0x5313421, 0x5313511, 0x5314114, 0x5314123,
+	0x5314132, 0x5314141, 0x5314213, 0x5314222, 0x5314231, 0x5314312, 0x5314321, 0x5314411,
+	0x5315113, 0x5315122, 0x5315131, 0x5315212, 0x5315221, 0x5315311, 0x5316112, 0x5316121,
+	0x5316211, 0x5317111, 0x5321116, 0x5321125, 0x5321134, 0x5321143, 0x5321152, 0x5321161,
+	0x5321215, 0x5321224, 0x5321233, 0x5321242, 0x5321251, 0x5321314, 0x5321323, 0x5321332,
+	0x5321341, 0x5321413, 0x5321422, 0x5321431, 0x5321512, 0x5321521, 0x5321611, 0x5322115,
+	0x5322124, 0x5322133, 0x5322142, 0x5322151, 0x5322214, 0x5322241, 0x5322313, 0x5322331,
+	0x5322412, 0x5322421, 0x5322511, 0x5323114, 0x5323123, 0x5323132, 0x5323141, 0x5323213,
+	0x5323231, 0x5323312, 0x5323321, 0x5323411, 0x5324113, 0x5324122, 0x5324131, 0x5324212,
+	0x5324221, 0x5324311, 0x5325112, 0x5325121, 0x5325211, 0x5326111, 0x5331115, 0x5331124,
+	0x5331133, 0x5331142, 0x5331151, 0x5331214, 0x5331223, 0x5331232, 0x5331241, 0x5331313,
+	0x5331322, 0x5331331, 0x5331412, 0x5331421, 0x5331511, 0x5332114, 0x5332123, 0x5332132,
+	0x5332141, 0x5332213, 0x5332231, 0x5332312, 0x5332321, 0x5332411, 0x5333113, 0x5333122,
+	0x5333131, 0x5333212, 0x5333221, 0x5333311, 0x5334112, 0x5334121, 0x5334211, 0x5335111,
+	0x5341114, 0x5341123, 0x5341132, 0x5341141, 0x5341213, 0x5341222, 0x5341231, 0x5341312,
+	0x5341321, 0x5341411, 0x5342113, 0x5342122, 0x5342131, 0x5342212, 0x5342221, 0x5342311,
+	0x5343112, 0x5343121, 0x5343211, 0x5344111, 0x5351113, 0x5351122, 0x5351131, 0x5351212,
+	0x5351221, 0x5351311, 0x5352112, 0x5352121, 0x5352211, 0x5353111, 0x5361112, 0x5361121,
+	0x5361211, 0x5362111, 0x5371111, 0x5411116, 0x5411125, 0x5411134, 0x5411143, 0x5411152,
+	0x5411161, 0x5411215, 0x5411224, 0x5411233, 0x5411242, 0x5411251, 0x5411314, 0x5411323,
+	0x5411332, 0x5411341, 0x5411413, 0x5411422, 0x5411431, 0x5411512, 0x5411521, 0x5411611,
+	0x5412115, 0x5412124, 0x5412133, 0x5412142, 0x5412151, 0x5412214, 0x5412223, 0x5412232,
+	0x5412241, 0x5412313, 0x5412322, 0x5412331, 0x5412412, 0x5412421, 0x5412511, 0x5413114,
+	0x5413123, 0x5413132, 0x5413141, 0x5413213, 0x5413222, 0x5413231, 0x5413312, 0x5413321,
+	0x5413411, 0x5414113, 0x5414122, 0x5414131, 0x5414212, 0x5414221, 0x5414311, 0x5415112,
+	0x5415121, 0x5415211, 0x5416111, 0x5421115, 0x5421124, 0x5421133, 0x5421142, 0x5421151,
+	0x5421214, 0x5421223, 0x5421232, 0x5421241, 0x5421313, 0x5421322, 0x5421331, 0x5421412,
+	0x5421421, 0x5421511, 0x5422114, 0x5422123, 0x5422132, 0x5422141, 0x5422213, 0x5422231,
+	0x5422312, 0x5422321, 0x5422411, 0x5423113, 0x5423122, 0x5423131, 0x5423212, 0x5423221,
+	0x5423311, 0x5424112, 0x5424121, 0x5424211, 0x5425111, 0x5431114, 0x5431123, 0x5431132,
+	0x5431141, 0x5431213, 0x5431222, 0x5431231, 0x5431312, 0x5431321, 0x5431411, 0x5432113,
+	0x5432122, 0x5432131, 0x5432212, 0x5432221, 0x5432311, 0x5433112, 0x5433121, 0x5433211,
+	0x5434111, 0x5441113, 0x5441122, 0x5441131, 0x5441212, 0x5441221, 0x5441311, 0x5442112,
+	0x5442121, 0x5442211, 0x5443111, 0x5451112, 0x5451121, 0x5451211, 0x5452111, 0x5461111,
+	0x5511115, 0x5511124, 0x5511133, 0x5511142, 0x5511151, 0x5511214, 0x5511223, 0x5511232,
+	0x5511241, 0x5511313, 0x5511322, 0x5511331, 0x5511412, 0x5511421, 0x5511511, 0x5512114,
+	0x5512123, 0x5512132, 0x5512141, 0x5512213, 0x5512222, 0x5512231, 0x5512312, 0x5512321,
+	0x5512411, 0x5513113, 0x5513122, 0x5513131, 0x5513212, 0x5513221, 0x5513311, 0x5514112,
+	0x5514121, 0x5514211, 0x5515111, 0x5521114, 0x5521123, 0x5521132, 0x5521141, 0x5521213,
+	0x5521222, 0x5521231, 0x5521312, 0x5521321, 0x5521411, 0x5522113, 0x5522122, 0x5522131,
+	0x5522212, 0x5522221, 0x5522311, 0x5523112, 0x5523121, 0x5523211, 0x5524111, 0x5531113,
+	0x5531122, 0x5531131, 0x5531212, 0x5531221, 0x5531311, 0x5532112, 0x5532121, 0x5532211,
+	0x5533111, 0x5541112, 0x5541121, 0x5541211, 0x5542111, 0x5551111, 0x5611114, 0x5611123,
+	0x5611132, 0x5611141, 0x5611213, 0x5611222, 0x5611231, 0x5611312, 0x5611321, 0x5611411,
+	0x5612113, 0x5612122, 0x5612131, 0x5612212, 0x5612221, 0x5612311, 0x5613112, 0x5613121,
+	0x5613211, 0x5614111, 0x5621113, 0x5621122, 0x5621131, 0x5621212, 0x5621221, 0x5621311,
+	0x5622112, 0x5622121, 0x5622211, 0x5623111, 0x5631112, 0x5631121, 0x5631211, 0x5632111,
+	0x5641111, 0x5711113, 0x5711122, 0x5711131, 0x5711212, 0x5711221, 0x5711311, 0x5712112,
+	0x5712121, 0x5712211, 0x5713111, 0x5721112, 0x5721121, 0x5721211, 0x5722111, 0x5731111,
+	0x5811112, 0x5811121, 0x5811211, 0x5812111, 0x5821111, 0x6111118, 0x6111127, 0x6111136,
+	0x6111145, 0x6111154, 0x6111163, 0x6111172, 0x6111181, 0x6111217, 0x6111226, 0x6111235,
+	0x6111244, 0x6111253, 0x6111262, 0x6111271, 0x6111316, 0x6111325, 0x6111334, 0x6111343,
+	0x6111352, 0x6111361, 0x6111415, 0x6111424, 0x6111433, 0x6111442, 0x6111451, 0x6111514,
+	0x6111523, 0x6111532, 0x6111541, 0x6111613, 0x6111622, 0x6111631, 0x6111712, 0x6111721,
+	0x6111811, 0x6112117, 0x6112126, 0x6112135, 0x6112144, 0x6112153, 0x6112162, 0x6112171,
+	0x6112216, 0x6112225, 0x6112234, 0x6112243, 0x6112252, 0x6112261, 0x6112315, 0x6112324,
+	0x6112333, 0x6112342, 0x6112351, 0x6112414, 0x6112423, 0x6112432, 0x6112441, 0x6112513,
+	0x6112522, 0x6112531, 0x6112612, 0x6112621, 0x6112711, 0x6113116, 0x6113125, 0x6113134,
+	0x6113143, 0x6113152, 0x6113161, 0x6113215, 0x6113224, 0x6113233, 0x6113242, 0x6113251,
+	0x6113314, 0x6113323, 0x6113332, 0x6113341, 0x6113413, 0x6113422, 0x6113431, 0x6113512,
+	0x6113521, 0x6113611, 0x6114115, 0x6114124, 0x6114133, 0x6114142, 0x6114151, 0x6114214,
+	0x6114223, 0x6114232, 0x6114241, 0x6114313, 0x6114322, 0x6114331, 0x6114412, 0x6114421,
+	0x6114511, 0x6115114, 0x6115123, 0x6115132, 0x6115141, 0x6115213, 0x6115222, 0x6115231,
+	0x6115312, 0x6115321, 0x6115411, 0x6116113, 0x6116122, 0x6116131, 0x6116212, 0x6116221,
+	0x6116311, 0x6117112, 0x6117121, 0x6117211, 0x6118111, 0x6121117, 0x6121126, 0x6121135,
+	0x6121144, 0x6121153, 0x6121162, 0x6121171, 0x6121216, 0x6121225, 0x6121234, 0x6121243,
+	0x6121252, 0x6121261, 0x6121315, 0x6121324, 0x6121333, 0x6121342, 0x6121351, 0x6121414,
+	0x6121423, 0x6121432, 0x6121441, 0x6121513, 0x6121522, 0x6121531, 0x6121612, 0x6121621,
+	0x6121711, 0x6122116, 0x6122125, 0x6122134, 0x6122143, 0x6122152, 0x6122161, 0x6122215,
+	0x6122224, 0x6122233, 0x6122242, 0x6122251, 0x6122314, 0x6122323, 0x6122332, 0x6122341,
+	0x6122413, 0x6122422, 0x6122431, 0x6122512, 0x6122521, 0x6122611, 0x6123115, 0x6123124,
+	0x6123133, 0x6123142, 0x6123151, 0x6123214, 0x6123223, 0x6123232, 0x6123241, 0x6123313,
+	0x6123322, 0x6123331, 0x6123412, 0x6123421, 0x6123511, 0x6124114, 0x6124123, 0x6124132,
+	0x6124141, 0x6124213, 0x6124222, 0x6124231, 0x6124312, 0x6124321, 0x6124411, 0x6125113,
+	0x6125122, 0x6125131, 0x6125212, 0x6125221, 0x6125311, 0x6126112, 0x6126121, 0x6126211,
+	0x6127111, 0x6131116, 0x6131125, 0x6131134, 0x6131143, 0x6131152, 0x6131161, 0x6131215,
+	0x6131224, 0x6131233, 0x6131242, 0x6131251, 0x6131314, 0x6131323, 0x6131332, 0x6131341,
+	0x6131413, 0x6131422, 0x6131431, 0x6131512, 0x6131521, 0x6131611, 0x6132115, 0x6132124,
+	0x6132133, 0x6132142, 0x6132151, 0x6132214, 0x6132223, 0x6132232, 0x6132241, 0x6132313,
+	0x6132322, 0x6132331, 0x6132412, 0x6132421, 0x6132511, 0x6133114, 0x6133123, 0x6133132,
+	0x6133141, 0x6133213, 0x6133222, 0x6133231, 0x6133312, 0x6133321, 0x6133411, 0x6134113,
+	0x6134122, 0x6134131, 0x6134212, 0x6134221, 0x6134311, 0x6135112, 0x6135121, 0x6135211,
+	0x6136111, 0x6141115, 0x6141124, 0x6141133, 0x6141142, 0x6141151, 0x6141214, 0x6141223,
+	0x6141232, 0x6141241, 0x6141313, 0x6141322, 0x6141331, 0x6141412, 0x6141421, 0x6141511,
+	0x6142114, 0x6142123, 0x6142132, 0x6142141, 0x6142213, 0x6142222, 0x6142231, 0x6142312,
+	0x6142321, 0x6142411, 0x6143113, 0x6143122, 0x6143131, 0x6143212, 0x6143221, 0x6143311,
+	0x6144112, 0x6144121, 0x6144211, 0x6145111, 0x6151114, 0x6151123, 0x6151132, 0x6151141,
+	0x6151213, 0x6151222, 0x6151231, 0x6151312, 0x6151321, 0x6151411, 0x6152113, 0x6152122,
+	0x6152131, 0x6152212, 0x6152221, 0x6152311, 0x6153112, 0x6153121, 0x6153211, 0x6154111,
+	0x6161113, 0x6161122, 0x6161131, 0x6161212, 0x6161221, 0x6161311, 0x6162112, 0x6162121,
+	0x6162211, 0x6163111, 0x6171112, 0x6171121, 0x6171211, 0x6172111, 0x6181111, 0x6211117,
+	0x6211126, 0x6211135, 0x6211144, 0x6211153, 0x6211162, 0x6211171, 0x6211216, 0x6211225,
+	0x6211234, 0x6211243, 0x6211252, 0x6211261, 0x6211315, 0x6211324, 0x6211333, 0x6211342,
+	0x6211351, 0x6211414, 0x6211423, 0x6211432, 0x6211441, 0x6211513, 0x6211522, 0x6211531,
+	0x6211612, 0x6211621, 0x6211711, 0x6212116, 0x6212125, 0x6212134, 0x6212143, 0x6212152,
+	0x6212161, 0x6212215, 0x6212224, 0x6212233, 0x6212242, 0x6212251, 0x6212314, 0x6212323,
+	0x6212332, 0x6212341, 0x6212413, 0x6212422, 0x6212431, 0x6212512, 0x6212521, 0x6212611,
+	0x6213115, 0x6213124, 0x6213133, 0x6213142, 0x6213151, 0x6213214, 0x6213223, 0x6213232,
+	0x6213241, 0x6213313, 0x6213322, 0x6213331, 0x6213412, 0x6213421, 0x6213511, 0x6214114,
+	0x6214123, 0x6214132, 0x6214141, 0x6214213, 0x6214222, 0x6214231, 0x6214312, 0x6214321,
+	0x6214411, 0x6215113, 0x6215122, 0x6215131, 0x6215212, 0x6215221, 0x6215311, 0x6216112,
+	0x6216121, 0x6216211, 0x6217111, 0x6221116, 0x6221125, 0x6221134, 0x6221143, 0x6221152,
+	0x6221161, 0x6221215, 0x6221224, 0x6221233, 0x6221242, 0x6221251, 0x6221314, 0x6221323,
+	0x6221332, 0x6221341, 0x6221413, 0x6221422, 0x6221431, 0x6221512, 0x6221521, 0x6221611,
+	0x6222115, 0x6222124, 0x6222133, 0x6222142, 0x6222151, 0x6222214, 0x6222241, 0x6222313,
+	0x6222331, 0x6222412, 0x6222421, 0x6222511, 0x6223114, 0x6223123, 0x6223132, 0x6223141,
+	0x6223213, 0x6223231, 0x6223312, 0x6223321, 0x6223411, 0x6224113, 0x6224122, 0x6224131,
+	0x6224212, 0x6224221, 0x6224311, 0x6225112, 0x6225121, 0x6225211, 0x6226111, 0x6231115,
+	0x6231124, 0x6231133, 0x6231142, 0x6231151, 0x6231214, 0x6231223, 0x6231232, 0x6231241,
+	0x6231313, 0x6231322, 0x6231331, 0x6231412, 0x6231421, 0x6231511, 0x6232114, 0x6232123,
+	0x6232132, 0x6232141, 0x6232213, 0x6232231, 0x6232312, 0x6232321, 0x6232411, 0x6233113,
+	0x6233122, 0x6233131, 0x6233212, 0x6233221, 0x6233311, 0x6234112, 0x6234121, 0x6234211,
+	0x6235111, 0x6241114, 0x6241123, 0x6241132, 0x6241141, 0x6241213, 0x6241222, 0x6241231,
+	0x6241312, 0x6241321, 0x6241411, 0x6242113, 0x6242122, 0x6242131, 0x6242212, 0x6242221,
+	0x6242311, 0x6243112, 0x6243121, 0x6243211, 0x6244111, 0x6251113, 0x6251122, 0x6251131,
+	0x6251212, 0x6251221, 0x6251311, 0x6252112, 0x6252121, 0x6252211, 0x6253111, 0x6261112,
+	0x6261121, 0x6261211, 0x6262111, 0x6271111, 0x6311116, 0x6311125, 0x6311134, 0x6311143,
+	0x6311152, 0x6311161, 0x6311215, 0x6311224, 0x6311233, 0x6311242, 0x6311251, 0x6311314,
+	0x6311323, 0x6311332, 0x6311341, 0x6311413, 0x6311422, 0x6311431, 0x6311512, 0x6311521,
+	0x6311611, 0x6312115, 0x6312124, 0x6312133, 0x6312142, 0x6312151, 0x6312214, 0x6312223,
+	0x6312232, 0x6312241, 0x6312313, 0x6312322, 0x6312331, 0x6312412, 0x6312421, 0x6312511,
+	0x6313114, 0x6313123, 0x6313132, 0x6313141, 0x6313213, 0x6313222, 0x6313231, 0x6313312,
+	0x6313321, 0x6313411, 0x6314113, 0x6314122, 0x6314131, 0x6314212, 0x6314221, 0x6314311,
+	0x6315112, 0x6315121, 0x6315211, 0x6316111, 0x6321115, 0x6321124, 0x6321133, 0x6321142,
+	0x6321151, 0x6321214, 0x6321223, 0x6321232, 0x6321241, 0x6321313, 0x6321322, 0x6321331,
+	0x6321412, 0x6321421, 0x6321511, 0x6322114, 0x6322123, 0x6322132, 0x6322141, 0x6322213,
+	0x6322231, 0x6322312, 0x6322321, 0x6322411, 0x6323113, 0x6323122, 0x6323131, 0x6323212,
+	0x6323221, 0x6323311, 0x6324112, 0x6324121, 0x6324211, 0x6325111, 0x6331114, 0x6331123,
+	0x6331132, 0x6331141, 0x6331213, 0x6331222, 0x6331231, 0x6331312, 0x6331321, 0x6331411,
+	0x6332113, 0x6332122, 0x6332131, 0x6332212, 0x6332221, 0x6332311, 0x6333112, 0x6333121,
+	0x6333211, 0x6334111, 0x6341113, 0x6341122, 0x6341131, 0x6341212, 0x6341221, 0x6341311,
+	0x6342112, 0x6342121, 0x6342211, 0x6343111, 0x6351112, 0x6351121, 0x6351211, 0x6352111,
+	0x6361111, 0x6411115, 0x6411124, 0x6411133, 0x6411142, 0x6411151, 0x6411214, 0x6411223,
+	0x6411232, 0x6411241, 0x6411313, 0x6411322, 0x6411331, 0x6411412, 0x6411421, 0x6411511,
+	0x6412114, 0x6412123, 0x6412132, 0x6412141, 0x6412213, 0x6412222, 0x6412231, 0x6412312,
+	0x6412321, 0x6412411, 0x6413113, 0x6413122, 0x6413131, 0x6413212, 0x6413221, 0x6413311,
+	0x6414112, 0x6414121, 0x6414211, 0x6415111, 0x6421114, 0x6421123, 0x6421132, 0x6421141,
+	0x6421213, 0x6421222, 0x6421231, 0x6421312, 0x6421321, 0x6421411, 0x6422113, 0x6422122,
+	0x6422131, 0x6422212, 0x6422221, 0x6422311, 0x6423112, 0x6423121, 0x6423211, 0x6424111,
+	0x6431113, 0x6431122, 0x6431131, 0x6431212, 0x6431221, 0x6431311, 0x6432112, 0x6432121,
+	0x6432211, 0x6433111, 0x6441112, 0x6441121, 0x6441211, 0x6442111, 0x6451111, 0x6511114,
+	0x6511123, 0x6511132, 0x6511141, 0x6511213, 0x6511222, 0x6511231, 0x6511312, 0x6511321,
+	0x6511411, 0x6512113, 0x6512122, 0x6512131, 0x6512212, 0x6512221, 0x6512311, 0x6513112,
+	0x6513121, 0x6513211, 0x6514111, 0x6521113, 0x6521122, 0x6521131, 0x6521212, 0x6521221,
+	0x6521311, 0x6522112, 0x6522121, 0x6522211, 0x6523111, 0x6531112, 0x6531121, 0x6531211,
+	0x6532111, 0x6541111, 0x6611113, 0x6611122, 0x6611131, 0x6611212, 0x6611221, 0x6611311,
+	0x6612112, 0x6612121, 0x6612211, 0x6613111, 0x6621112, 0x6621121, 0x6621211, 0x6622111,
+	0x6631111, 0x6711112, 0x6711121, 0x6711211, 0x6712111, 0x6721111, 0x6811111, 0x7111117,
+	0x7111126, 0x7111135, 0x7111144, 0x7111153, 0x7111162, 0x7111171, 0x7111216, 0x7111225,
+	0x7111234, 0x7111243, 0x7111252, 0x7111261, 0x7111315, 0x7111324, 0x7111333, 0x7111342,
+	0x7111351, 0x7111414, 0x7111423, 0x7111432, 0x7111441, 0x7111513, 0x7111522, 0x7111531,
+	0x7111612, 0x7111621, 0x7111711, 0x7112116, 0x7112125, 0x7112134, 0x7112143, 0x7112152,
+	0x7112161, 0x7112215, 0x7112224, 0x7112233, 0x7112242, 0x7112251, 0x7112314, 0x7112323,
+	0x7112332, 0x7112341, 0x7112413, 0x7112422, 0x7112431, 0x7112512, 0x7112521, 0x7112611,
+	0x7113115, 0x7113124, 0x7113133, 0x7113142, 0x7113151, 0x7113214, 0x7113223, 0x7113232,
+	0x7113241, 0x7113313, 0x7113322, 0x7113331, 0x7113412, 0x7113421, 0x7113511, 0x7114114,
+	0x7114123, 0x7114132, 0x7114141, 0x7114213, 0x7114222, 0x7114231, 0x7114312, 0x7114321,
+	0x7114411, 0x7115113, 0x7115122, 0x7115131, 0x7115212, 0x7115221, 0x7115311, 0x7116112,
+	0x7116121, 0x7116211, 0x7117111, 0x7121116, 0x7121125, 0x7121134, 0x7121143, 0x7121152,
+	0x7121161, 0x7121215, 0x7121224, 0x7121233, 0x7121242, 0x7121251, 0x7121314, 0x7121323,
+	0x7121332, 0x7121341, 0x7121413, 0x7121422, 0x7121431, 0x7121512, 0x7121521, 0x7121611,
+	0x7122115, 0x7122124, 0x7122133, 0x7122142, 0x7122151, 0x7122214, 0x7122223, 0x7122232,
+	0x7122241, 0x7122313, 0x7122322, 0x7122331, 0x7122412, 0x7122421, 0x7122511, 0x7123114,
+	0x7123123, 0x7123132, 0x7123141, 0x7123213, 0x7123222, 0x7123231, 0x7123312, 0x7123321,
+	0x7123411, 0x7124113, 0x7124122, 0x7124131, 0x7124212, 0x7124221, 0x7124311, 0x7125112,
+	0x7125121, 0x7125211, 0x7126111, 0x7131115, 0x7131124, 0x7131133, 0x7131142, 0x7131151,
+	0x7131214, 0x7131223, 0x7131232, 0x7131241, 0x7131313, 0x7131322, 0x7131331, 0x7131412,
+	0x7131421, 0x7131511, 0x7132114, 0x7132123, 0x7132132, 0x7132141, 0x7132213, 0x7132222,
+	0x7132231, 0x7132312, 0x7132321, 0x7132411, 0x7133113, 0x7133122, 0x7133131, 0x7133212,
+	0x7133221, 0x7133311, 0x7134112, 0x7134121, 0x7134211, 0x7135111, 0x7141114, 0x7141123,
+	0x7141132, 0x7141141, 0x7141213, 0x7141222, 0x7141231, 0x7141312, 0x7141321, 0x7141411,
+	0x7142113, 0x7142122, 0x7142131, 0x7142212, 0x7142221, 0x7142311, 0x7143112, 0x7143121,
+	0x7143211, 0x7144111, 0x7151113, 0x7151122, 0x7151131, 0x7151212, 0x7151221, 0x7151311,
+	0x7152112, 0x7152121, 0x7152211, 0x7153111, 0x7161112, 0x7161121, 0x7161211, 0x7162111,
+	0x7171111, 0x7211116, 0x7211125, 0x7211134, 0x7211143, 0x7211152, 0x7211161, 0x7211215,
+	0x7211224, 0x7211233, 0x7211242, 0x7211251, 0x7211314, 0x7211323, 0x7211332, 0x7211341,
+	0x7211413, 0x7211422, 0x7211431, 0x7211512, 0x7211521, 0x7211611, 0x7212115, 0x7212124,
+	0x7212133, 0x7212142, 0x7212151, 0x7212214, 0x7212223, 0x7212232, 0x7212241, 0x7212313,
+	0x7212322, 0x7212331, 0x7212412, 0x7212421, 0x7212511, 0x7213114, 0x7213123, 0x7213132,
+	0x7213141, 0x7213213, 0x7213222, 0x7213231, 0x7213312, 0x7213321, 0x7213411, 0x7214113,
+	0x7214122, 0x7214131, 0x7214212, 0x7214221, 0x7214311, 0x7215112, 0x7215121, 0x7215211,
+	0x7216111, 0x7221115, 0x7221124, 0x7221133, 0x7221142, 0x7221151, 0x7221214, 0x7221223,
+	0x7221232, 0x7221241, 0x7221313, 0x7221322, 0x7221331, 0x7221412, 0x7221421, 0x7221511,
+	0x7222114, 0x7222123, 0x7222132, 0x7222141, 0x7222213, 0x7222231, 0x7222312, 0x7222321,
+	0x7222411, 0x7223113, 0x7223122, 0x7223131, 0x7223212, 0x7223221, 0x7223311, 0x7224112,
+	0x7224121, 0x7224211, 0x7225111, 0x7231114, 0x7231123, 0x7231132, 0x7231141, 0x7231213,
+	0x7231222, 0x7231231, 0x7231312, 0x7231321, 0x7231411, 0x7232113, 0x7232122, 0x7232131,
+	0x7232212, 0x7232221, 0x7232311, 0x7233112, 0x7233121, 0x7233211, 0x7234111, 0x7241113,
+	0x7241122, 0x7241131, 0x7241212, 0x7241221, 0x7241311, 0x7242112, 0x7242121, 0x7242211,
+	0x7243111, 0x7251112, 0x7251121, 0x7251211, 0x7252111, 0x7261111, 0x7311115, 0x7311124,
+	0x7311133, 0x7311142, 0x7311151, 0x7311214, 0x7311223, 0x7311232, 0x7311241, 0x7311313,
+	0x7311322, 0x7311331, 0x7311412, 0x7311421, 0x7311511, 0x7312114, 0x7312123, 0x7312132,
+	0x7312141, 0x7312213, 0x7312222, 0x7312231, 0x7312312, 0x7312321, 0x7312411, 0x7313113,
+	0x7313122, 0x7313131, 0x7313212, 0x7313221, 0x7313311, 0x7314112, 0x7314121, 0x7314211,
+	0x7315111, 0x7321114, 0x7321123, 0x7321132, 0x7321141, 0x7321213, 0x7321222, 0x7321231,
+	0x7321312, 0x7321321, 0x7321411, 0x7322113, 0x7322122, 0x7322131, 0x7322212, 0x7322221,
+	0x7322311, 0x7323112, 0x7323121, 0x7323211, 0x7324111, 0x7331113, 0x7331122, 0x7331131,
+	0x7331212, 0x7331221, 0x7331311, 0x7332112, 0x7332121, 0x7332211, 0x7333111, 0x7341112,
+	0x7341121, 0x7341211, 0x7342111, 0x7351111, 0x7411114, 0x7411123, 0x7411132, 0x7411141,
+	0x7411213, 0x7411222, 0x7411231, 0x7411312, 0x7411321, 0x7411411, 0x7412113, 0x7412122,
+	0x7412131, 0x7412212, 0x7412221, 0x7412311, 0x7413112, 0x7413121, 0x7413211, 0x7414111,
+	0x7421113, 0x7421122, 0x7421131, 0x7421212, 0x7421221, 0x7421311, 0x7422112, 0x7422121,
+	0x7422211, 0x7423111, 0x7431112, 0x7431121, 0x7431211, 0x7432111, 0x7441111, 0x7511113,
+	0x7511122, 0x7511131, 0x7511212, 0x7511221, 0x7511311, 0x7512112, 0x7512121, 0x7512211,
+	0x7513111, 0x7521112, 0x7521121, 0x7521211, 0x7522111, 0x7531111, 0x7611112, 0x7611121,
+	0x7611211, 0x7612111, 0x7621111, 0x7711111, 0x8111116, 0x8111125, 0x8111134, 0x8111143,
+	0x8111152, 0x8111161, 0x8111215, 0x8111224, 0x8111233, 0x8111242, 0x8111251, 0x8111314,
+	0x8111323, 0x8111332, 0x8111341, 0x8111413, 0x8111422, 0x8111431, 0x8111512, 0x8111521,
+	0x8111611, 0x8112115, 0x8112124, 0x8112133, 0x8112142, 0x8112151, 0x8112214, 0x8112223,
+	0x8112232, 0x8112241, 0x8112313, 0x8112322, 0x8112331, 0x8112412, 0x8112421, 0x8112511,
+	0x8113114, 0x8113123, 0x8113132, 0x8113141, 0x8113213, 0x8113222, 0x8113231, 0x8113312,
+	0x8113321, 0x8113411, 0x8114113, 0x8114122, 0x8114131, 0x8114212, 0x8114221, 0x8114311,
+	0x8115112, 0x8115121, 0x8115211, 0x8116111, 0x8121115, 0x8121124, 0x8121133, 0x8121142,
+	0x8121151, 0x8121214, 0x8121223, 0x8121232, 0x8121241, 0x8121313, 0x8121322, 0x8121331,
+	0x8121412, 0x8121421, 0x8121511, 0x8122114, 0x8122123, 0x8122132, 0x8122141, 0x8122213,
+	0x8122222, 0x8122231, 0x8122312, 0x8122321, 0x8122411, 0x8123113, 0x8123122, 0x8123131,
+	0x8123212, 0x8123221, 0x8123311, 0x8124112, 0x8124121, 0x8124211, 0x8125111, 0x8131114,
+	0x8131123, 0x8131132, 0x8131141, 0x8131213, 0x8131222, 0x8131231, 0x8131312, 0x8131321,
+	0x8131411, 0x8132113, 0x8132122, 0x8132131, 0x8132212, 0x8132221, 0x8132311, 0x8133112,
+	0x8133121, 0x8133211, 0x8134111, 0x8141113, 0x8141122, 0x8141131, 0x8141212, 0x8141221,
+	0x8141311, 0x8142112, 0x8142121, 0x8142211, 0x8143111, 0x8151112, 0x8151121, 0x8151211,
+	0x8152111, 0x8161111, 0x8211115, 0x8211124, 0x8211133, 0x8211142, 0x8211151, 0x8211214,
+	0x8211223, 0x8211232, 0x8211241, 0x8211313, 0x8211322, 0x8211331, 0x8211412, 0x8211421,
+	0x8211511, 0x8212114, 0x8212123, 0x8212132, 0x8212141, 0x8212213, 0x8212222, 0x8212231,
+	0x8212312, 0x8212321, 0x8212411, 0x8213113, 0x8213122, 0x8213131, 0x8213212, 0x8213221,
+	0x8213311, 0x8214112, 0x8214121, 0x8214211, 0x8215111, 0x8221114, 0x8221123, 0x8221132,
+	0x8221141, 0x8221213, 0x8221222, 0x8221231, 0x8221312, 0x8221321, 0x8221411, 0x8222113,
+	0x8222122, 0x8222131, 0x8222212, 0x8222221, 0x8222311, 0x8223112, 0x8223121, 0x8223211,
+	0x8224111, 0x8231113, 0x8231122, 0x8231131, 0x8231212, 0x8231221, 0x8231311, 0x8232112,
+	0x8232121, 0x8232211, 0x8233111, 0x8241112, 0x8241121, 0x8241211, 0x8242111, 0x8251111,
+	0x8311114, 0x8311123, 0x8311132, 0x8311141, 0x8311213, 0x8311222, 0x8311231, 0x8311312,
+	0x8311321, 0x8311411, 0x8312113, 0x8312122, 0x8312131, 0x8312212, 0x8312221, 0x8312311,
+	0x8313112, 0x8313121, 0x8313211, 0x8314111, 0x8321113, 0x8321122, 0x8321131, 0x8321212,
+	0x8321221, 0x8321311, 0x8322112, 0x8322121, 0x8322211, 0x8323111, 0x8331112, 0x8331121,
+	0x8331211, 0x8332111, 0x8341111, 0x8411113, 0x8411122, 0x8411131, 0x8411212, 0x8411221,
+	0x8411311, 0x8412112, 0x8412121, 0x8412211, 0x8413111, 0x8421112, 0x8421121, 0x8421211,
+	0x8422111, 0x8431111, 0x8511112, 0x8511121, 0x8511211, 0x8512111, 0x8521111, 0x8611111
+};
+
+// base 928 digits of 2^i for 69 bit groups, most significant first
+const uint16_t gs1_pwr928[69][7] = {
+	{0,0,0,0,0,0,1},
+	{0,0,0,0,0,0,2},
+	{0,0,0,0,0,0,4},
+	{0,0,0,0,0,0,8},
+	{0,0,0,0,0,0,16},
+	{0,0,0,0,0,0,32},
+	{0,0,0,0,0,0,64},
+	{0,0,0,0,0,0,128},
+	{0,0,0,0,0,0,256},
+	{0,0,0,0,0,0,512},
+	{0,0,0,0,0,1,96},
+	{0,0,0,0,0,2,192},
+	{0,0,0,0,0,4,384},
+	{0,0,0,0,0,8,768},
+	{0,0,0,0,0,17,608},
+	{0,0,0,0,0,35,288},
+	{0,0,0,0,0,70,576},
+	{0,0,0,0,0,141,224},
+	{0,0,0,0,0,282,448},
+	{0,0,0,0,0,564,896},
+	{0,0,0,0,1,201,864},
+	{0,0,0,0,2,403,800},
+	{0,0,0,0,4,807,672},
+	{0,0,0,0,9,687,416},
+	{0,0,0,0,19,446,832},
+	{0,0,0,0,38,893,736},
+	{0,0,0,0,77,859,544},
+	{0,0,0,0,155,791,160},
+	{0,0,0,0,311,654,320},
+	{0,0,0,0,623,380,640},
+	{0,0,0,1,318,761,352},
+	{0,0,0,2,637,594,704},
+	{0,0,0,5,347,261,480},
+	{0,0,0,10,694,523,32},
+	{0,0,0,21,461,118,64},
+	{0,0,0,42,922,236,128},
+	{0,0,0,85,916,472,256},
+	{0,0,0,171,905,16,512},
+	{0,0,0,343,882,33,96},
+	{0,0,0,687,836,66,192},
+	{0,0,1,447,744,132,384},
+	{0,0,2,895,560,264,768},
+	{0,0,5,863,192,529,608},
+	{0,0,11,798,385,131,288},
+	{0,0,23,668,770,262,576},
+	{0,0,47,409,612,525,224},
+	{0,0,94,819,297,122,448},
+	{0,0,189,710,594,244,896},
+	{0,0,379,493,260,489,864},
+	{0,0,759,58,521,51,800},
+	{0,1,590,117,114,103,672},
+	{0,3,252,234,228,207,416},
+	{0,6,504,468,456,414,832},
+	{0,13,81,8,912,829,736},
+	{0,26,162,17,897,731,544},
+	{0,52,324,35,867,535,160},
+	{0,104,648,71,807,142,320},
+	{0,209,368,143,686,284,640},
+	{0,418,736,287,444,569,352},
+	{0,837,544,574,889,210,704},
+	{1,747,161,221,850,421,480},
+	{3,566,322,443,772,843,32},
+	{7,204,644,887,617,758,64},
+	{14,409,361,847,307,588,128},
+	{28,818,723,766,615,248,256},
+	{57,709,519,605,302,496,512},
+	{115,491,111,282,605,65,96},
+	{231,54,222,565,282,130,192},
+	{462,108,445,202,564,260,384}
+};
+
+// CC codeword widths by cluster, left to right
+const uint8_t gs1_ccBarWidths[3][929][8] = {
+	{
+		{3,1,1,1,1,1,3,6}, {4,1,1,1,1,1,4,4}, {5,1,1,1,1,1,5,2}, {3,1,1,1,1,2,3,5},
+		{4,1,1,1,1,2,4,3}, {5,1,1,1,1,2,5,1}, {2,1,1,1,1,3,2,6}, {3,1,1,1,1,3,3,4},
+		{2,1,1,1,1,4,2,5}, {1,1,1,1,1,5,1,6}, {2,1,1,1,1,5,2,4}, {1,1,1,1,1,6,1,5},
+		{2,1,1,1,2,1,3,6}, {3,1,1,1,2,1,4,4}, {4,1,1,1,2,1,5,2}, {2,1,1,1,2,2,3,5},
+		{3,1,1,1,2,2,4,3}, {4,1,1,1,2,2,5,1}, {1,1,1,1,2,3,2,6}, {2,1,1,1,2,3,3,4},
+		{1,1,1,1,2,4,2,5}, {1,1,1,1,3,1,3,6}, {2,1,1,1,3,1,4,4}, {3,1,1,1,3,1,5,2},
+		{1,1,1,1,3,2,3,5}, {2,1,1,1,3,2,4,3}, {3,1,1,1,3,2,5,1}, {1,1,1,1,3,3,3,4},
+		{2,1,1,1,3,3,4,2}, {1,1,1,1,4,1,4,4}, {2,1,1,1,4,1,5,2}, {1,1,1,1,4,2,4,3},
+		{2,1,1,1,4,2,5,1}, {1,1,1,1,5,1,5,2}, {5,1,1,1,6,1,1,1}, {3,1,1,2,1,1,3,5},
+		{4,1,1,2,1,1,4,3}, {5,1,1,2,1,1,5,1}, {2,1,1,2,1,2,2,6}, {3,1,1,2,1,2,3,4},
+		{4,1,1,2,1,2,4,2}, {2,1,1,2,1,3,2,5}, {3,1,1,2,1,3,3,3}, {1,1,1,2,1,4,1,6},
+		{2,1,1,2,1,4,2,4}, {3,1,1,2,1,4,3,2}, {1,1,1,2,1,5,1,5}, {2,1,1,2,1,5,2,3},
+		{1,1,1,2,1,6,1,4}, {2,1,1,2,2,1,3,5}, {3,1,1,2,2,1,4,3}, {4,1,1,2,2,1,5,1},
+		{1,1,1,2,2,2,2,6}, {2,1,1,2,2,2,3,4}, {3,1,1,2,2,2,4,2}, {1,1,1,2,2,3,2,5},
+		{2,1,1,2,2,3,3,3}, {3,1,1,2,2,3,4,1}, {1,1,1,2,2,4,2,4}, {2,1,1,2,2,4,3,2},
+		{1,1,1,2,3,1,3,5}, {2,1,1,2,3,1,4,3}, {3,1,1,2,3,1,5,1}, {1,1,1,2,3,2,3,4},
+		{2,1,1,2,3,2,4,2}, {1,1,1,2,3,3,3,3}, {2,1,1,2,3,3,4,1}, {1,1,1,2,4,1,4,3},
+		{2,1,1,2,4,1,5,1}, {1,1,1,2,4,2,4,2}, {1,1,1,2,4,3,4,1}, {2,1,1,3,1,1,2,6},
+		{3,1,1,3,1,1,3,4}, {4,1,1,3,1,1,4,2}, {2,1,1,3,1,2,2,5}, {3,1,1,3,1,2,3,3},
+		{4,1,1,3,1,2,4,1}, {1,1,1,3,1,3,1,6}, {2,1,1,3,1,3,2,4}, {3,1,1,3,1,3,3,2},
+		{1,1,1,3,1,4,1,5}, {2,1,1,3,1,4,2,3}, {1,1,1,3,1,5,1,4}, {1,1,1,3,1,6,1,3},
+		{1,1,1,3,2,1,2,6}, {2,1,1,3,2,1,3,4}, {3,1,1,3,2,1,4,2}, {1,1,1,3,2,2,2,5},
+		{2,1,1,3,2,2,3,3}, {3,1,1,3,2,2,4,1}, {1,1,1,3,2,3,2,4}, {2,1,1,3,2,3,3,2},
+		{1,1,1,3,2,4,2,3}, {1,1,1,3,2,5,2,2}, {1,1,1,3,3,1,3,4}, {2,1,1,3,3,1,4,2},
+		{1,1,1,3,3,2,3,3}, {2,1,1,3,3,2,4,1}, {1,1,1,3,3,3,3,2}, {1,1,1,3,4,1,4,2},
+		{2,1,1,4,1,1,2,5}, {3,1,1,4,1,1,3,3}, {4,1,1,4,1,1,4,1}, {1,1,1,4,1,2,1,6},
+		{2,1,1,4,1,2,2,4}, {3,1,1,4,1,2,3,2}, {1,1,1,4,1,3,1,5}, {2,1,1,4,1,3,2,3},
+		{3,1,1,4,1,3,3,1}, {1,1,1,4,1,4,1,4}, {2,1,1,4,1,4,2,2}, {1,1,1,4,1,5,1,3},
+		{2,1,1,4,1,5,2,1}, {1,1,1,4,2,1,2,5}, {2,1,1,4,2,1,3,3}, {3,1,1,4,2,1,4,1},
+		{1,1,1,4,2,2,2,4}, {2,1,1,4,2,2,3,2}, {1,1,1,4,2,3,2,3}, {2,1,1,4,2,3,3,1},
+		{1,1,1,4,2,4,2,2}, {1,1,1,4,2,5,2,1}, {2,1,1,4,3,1,4,1}, {1,1,1,4,3,3,3,1},
+		{1,1,1,5,1,1,1,6}, {2,1,1,5,1,1,2,4}, {3,1,1,5,1,1,3,2}, {1,1,1,5,1,2,1,5},
+		{2,1,1,5,1,2,2,3}, {3,1,1,5,1,2,3,1}, {1,1,1,5,1,3,1,4}, {2,1,1,5,1,3,2,2},
+		{1,1,1,5,1,4,1,3}, {2,1,1,5,1,4,2,1}, {1,1,1,5,1,5,1,2}, {1,1,1,5,2,1,2,4},
+		{1,1,1,5,2,2,2,3}, {1,1,1,5,2,3,2,2}, {1,1,1,6,1,1,1,5}, {3,1,1,6,1,1,3,1},
+		{2,1,1,6,1,2,2,2}, {2,1,1,6,1,3,2,1}, {1,1,1,6,1,5,1,1}, {3,2,1,1,1,1,3,5},
+		{4,2,1,1,1,1,4,3}, {5,2,1,1,1,1,5,1}, {2,2,1,1,1,2,2,6}, {3,2,1,1,1,2,3,4},
+		{4,2,1,1,1,2,4,2}, {2,2,1,1,1,3,2,5}, {3,2,1,1,1,3,3,3}, {4,2,1,1,1,3,4,1},
+		{1,2,1,1,1,4,1,6}, {2,2,1,1,1,4,2,4}, {1,2,1,1,1,5,1,5}, {2,2,1,1,2,1,3,5},
+		{3,2,1,1,2,1,4,3}, {4,2,1,1,2,1,5,1}, {1,2,1,1,2,2,2,6}, {2,2,1,1,2,2,3,4},
+		{3,2,1,1,2,2,4,2}, {1,2,1,1,2,3,2,5}, {2,2,1,1,2,3,3,3}, {1,2,1,1,2,4,2,4},
+		{1,2,1,1,2,5,2,3}, {1,2,1,1,3,1,3,5}, {2,2,1,1,3,1,4,3}, {3,2,1,1,3,1,5,1},
+		{1,2,1,1,3,2,3,4}, {2,2,1,1,3,2,4,2}, {1,2,1,1,3,3,3,3}, {1,2,1,1,3,4,3,2},
+		{1,2,1,1,4,1,4,3}, {2,2,1,1,4,1,5,1}, {1,2,1,1,4,2,4,2}, {1,2,1,1,5,1,5,1},
+		{3,1,2,1,1,1,2,6}, {4,1,2,1,1,1,3,4}, {5,1,2,1,1,1,4,2}, {3,1,2,1,1,2,2,5},
+		{4,1,2,1,1,2,3,3}, {5,1,2,1,1,2,4,1}, {2,1,2,1,1,3,1,6}, {3,1,2,1,1,3,2,4},
+		{4,1,2,1,1,3,3,2}, {2,1,2,1,1,4,1,5}, {3,1,2,1,1,4,2,3}, {4,1,2,1,1,4,3,1},
+		{2,1,2,1,1,5,1,4}, {3,1,2,1,1,5,2,2}, {2,2,1,2,1,1,2,6}, {3,2,1,2,1,1,3,4},
+		{4,2,1,2,1,1,4,2}, {2,1,2,1,2,1,2,6}, {2,2,1,2,1,2,2,5}, {3,2,1,2,1,2,3,3},
+		{4,2,1,2,1,2,4,1}, {2,1,2,1,2,2,2,5}, {3,1,2,1,2,2,3,3}, {4,1,2,1,2,2,4,1},
+		{1,1,2,1,2,3,1,6}, {1,2,1,2,1,4,1,5}, {2,2,1,2,1,4,2,3}, {3,2,1,2,1,4,3,1},
+		{1,1,2,1,2,4,1,5}, {2,1,2,1,2,4,2,3}, {1,1,2,1,2,5,1,4}, {1,2,1,2,2,1,2,6},
+		{2,2,1,2,2,1,3,4}, {3,2,1,2,2,1,4,2}, {1,1,2,1,3,1,2,6}, {1,2,1,2,2,2,2,5},
+		{2,2,1,2,2,2,3,3}, {3,2,1,2,2,2,4,1}, {1,1,2,1,3,2,2,5}, {2,1,2,1,3,2,3,3},
+		{3,1,2,1,3,2,4,1}, {1,1,2,1,3,3,2,4}, {1,2,1,2,2,4,2,3}, {1,1,2,1,3,4,2,3},
+		{1,2,1,2,3,1,3,4}, {2,2,1,2,3,1,4,2}, {1,1,2,1,4,1,3,4}, {1,2,1,2,3,2,3,3},
+		{2,2,1,2,3,2,4,1}, {1,1,2,1,4,2,3,3}, {2,1,2,1,4,2,4,1}, {1,1,2,1,4,3,3,2},
+		{1,2,1,2,4,1,4,2}, {1,1,2,1,5,1,4,2}, {1,2,1,2,4,2,4,1}, {1,1,2,1,5,2,4,1},
+		{3,1,2,2,1,1,2,5}, {4,1,2,2,1,1,3,3}, {5,1,2,2,1,1,4,1}, {2,1,2,2,1,2,1,6},
+		{3,1,2,2,1,2,2,4}, {4,1,2,2,1,2,3,2}, {2,1,2,2,1,3,1,5}, {3,1,2,2,1,3,2,3},
+		{4,1,2,2,1,3,3,1}, {2,1,2,2,1,4,1,4}, {3,1,2,2,1,4,2,2}, {2,1,2,2,1,5,1,3},
+		{2,1,2,2,1,6,1,2}, {2,2,1,3,1,1,2,5}, {3,2,1,3,1,1,3,3}, {4,2,1,3,1,1,4,1},
+		{2,1,2,2,2,1,2,5}, {2,2,1,3,1,2,2,4}, {3,2,1,3,1,2,3,2}, {1,1,2,2,2,2,1,6},
+		{1,2,1,3,1,3,1,5}, {3,1,2,2,2,2,3,2}, {3,2,1,3,1,3,3,1}, {1,1,2,2,2,3,1,5},
+		{1,2,1,3,1,4,1,4}, {2,2,1,3,1,4,2,2}, {1,1,2,2,2,4,1,4}, {2,1,2,2,2,4,2,2},
+		{2,2,1,3,1,5,2,1}, {1,2,1,3,1,6,1,2}, {1,2,1,3,2,1,2,5}, {2,2,1,3,2,1,3,3},
+		{3,2,1,3,2,1,4,1}, {1,1,2,2,3,1,2,5}, {1,2,1,3,2,2,2,4}, {2,2,1,3,2,2,3,2},
+		{1,1,2,2,3,2,2,4}, {2,1,2,2,3,2,3,2}, {2,2,1,3,2,3,3,1}, {1,1,2,2,3,3,2,3},
+		{1,2,1,3,2,4,2,2}, {1,2,1,3,2,5,2,1}, {1,2,1,3,3,1,3,3}, {2,2,1,3,3,1,4,1},
+		{1,1,2,2,4,1,3,3}, {1,2,1,3,3,2,3,2}, {1,1,2,2,4,2,3,2}, {1,2,1,3,3,3,3,1},
+		{1,1,2,2,4,3,3,1}, {1,1,2,2,5,1,4,1}, {2,1,2,3,1,1,1,6}, {3,1,2,3,1,1,2,4},
+		{4,1,2,3,1,1,3,2}, {2,1,2,3,1,2,1,5}, {3,1,2,3,1,2,2,3}, {4,1,2,3,1,2,3,1},
+		{2,1,2,3,1,3,1,4}, {3,1,2,3,1,3,2,2}, {2,1,2,3,1,4,1,3}, {3,1,2,3,1,4,2,1},
+		{2,1,2,3,1,5,1,2}, {2,1,2,3,1,6,1,1}, {1,2,1,4,1,1,1,6}, {2,2,1,4,1,1,2,4},
+		{3,2,1,4,1,1,3,2}, {1,1,2,3,2,1,1,6}, {1,2,1,4,1,2,1,5}, {2,2,1,4,1,2,2,3},
+		{3,2,1,4,1,2,3,1}, {1,1,2,3,2,2,1,5}, {2,1,2,3,2,2,2,3}, {3,1,2,3,2,2,3,1},
+		{1,1,2,3,2,3,1,4}, {1,2,1,4,1,4,1,3}, {2,2,1,4,1,4,2,1}, {1,1,2,3,2,4,1,3},
+		{2,1,2,3,2,4,2,1}, {1,1,2,3,2,5,1,2}, {1,2,1,4,2,1,2,4}, {2,2,1,4,2,1,3,2},
+		{1,1,2,3,3,1,2,4}, {1,2,1,4,2,2,2,3}, {2,2,1,4,2,2,3,1}, {1,1,2,3,3,2,2,3},
+		{2,1,2,3,3,2,3,1}, {1,1,2,3,3,3,2,2}, {1,2,1,4,2,4,2,1}, {1,1,2,3,3,4,2,1},
+		{1,1,2,3,4,1,3,2}, {1,1,2,3,4,2,3,1}, {2,1,2,4,1,1,1,5}, {3,1,2,4,1,1,2,3},
+		{4,1,2,4,1,1,3,1}, {2,1,2,4,1,2,1,4}, {3,1,2,4,1,2,2,2}, {2,1,2,4,1,3,1,3},
+		{3,1,2,4,1,3,2,1}, {2,1,2,4,1,4,1,2}, {2,1,2,4,1,5,1,1}, {1,2,1,5,1,1,1,5},
+		{2,2,1,5,1,1,2,3}, {3,2,1,5,1,1,3,1}, {1,1,2,4,2,1,1,5}, {1,2,1,5,1,2,1,4},
+		{2,2,1,5,1,2,2,2}, {1,1,2,4,2,2,1,4}, {2,1,2,4,2,2,2,2}, {2,2,1,5,1,3,2,1},
+		{1,1,2,4,2,3,1,3}, {1,2,1,5,1,4,1,2}, {1,1,2,4,2,4,1,2}, {1,2,1,5,1,5,1,1},
+		{1,2,1,5,2,1,2,3}, {1,1,2,4,3,1,2,3}, {1,1,2,4,3,2,2,2}, {1,1,2,4,3,3,2,1},
+		{3,1,2,5,1,1,2,2}, {3,1,2,5,1,2,2,1}, {2,1,2,5,1,4,1,1}, {2,2,1,6,1,1,2,2},
+		{1,2,1,6,1,2,1,3}, {1,1,2,5,2,2,1,3}, {1,1,2,5,2,3,1,2}, {1,1,2,5,2,4,1,1},
+		{2,3,1,1,1,1,2,6}, {3,3,1,1,1,1,3,4}, {4,3,1,1,1,1,4,2}, {2,3,1,1,1,2,2,5},
+		{3,3,1,1,1,2,3,3}, {1,3,1,1,1,3,1,6}, {2,3,1,1,1,3,2,4}, {3,3,1,1,1,3,3,2},
+		{1,3,1,1,1,4,1,5}, {2,3,1,1,1,4,2,3}, {1,3,1,1,1,5,1,4}, {1,3,1,1,1,6,1,3},
+		{1,3,1,1,2,1,2,6}, {2,3,1,1,2,1,3,4}, {3,3,1,1,2,1,4,2}, {1,3,1,1,2,2,2,5},
+		{2,3,1,1,2,2,3,3}, {3,3,1,1,2,2,4,1}, {1,3,1,1,2,3,2,4}, {2,3,1,1,2,3,3,2},
+		{1,3,1,1,2,4,2,3}, {1,3,1,1,2,5,2,2}, {1,3,1,1,3,1,3,4}, {2,3,1,1,3,1,4,2},
+		{1,3,1,1,3,2,3,3}, {2,3,1,1,3,2,4,1}, {1,3,1,1,3,3,3,2}, {1,3,1,1,4,1,4,2},
+		{1,3,1,1,4,2,4,1}, {3,2,2,1,1,1,2,5}, {4,2,2,1,1,1,3,3}, {5,2,2,1,1,1,4,1},
+		{2,2,2,1,1,2,1,6}, {3,2,2,1,1,2,2,4}, {4,2,2,1,1,2,3,2}, {2,2,2,1,1,3,1,5},
+		{3,2,2,1,1,3,2,3}, {4,2,2,1,1,3,3,1}, {2,2,2,1,1,4,1,4}, {3,2,2,1,1,4,2,2},
+		{2,2,2,1,1,5,1,3}, {3,2,2,1,1,5,2,1}, {2,3,1,2,1,1,2,5}, {3,3,1,2,1,1,3,3},
+		{4,3,1,2,1,1,4,1}, {2,2,2,1,2,1,2,5}, {2,3,1,2,1,2,2,4}, {3,3,1,2,1,2,3,2},
+		{1,2,2,1,2,2,1,6}, {1,3,1,2,1,3,1,5}, {3,2,2,1,2,2,3,2}, {3,3,1,2,1,3,3,1},
+		{1,2,2,1,2,3,1,5}, {2,2,2,1,2,3,2,3}, {2,3,1,2,1,4,2,2}, {1,2,2,1,2,4,1,4},
+		{1,3,1,2,1,5,1,3}, {1,2,2,1,2,5,1,3}, {1,3,1,2,2,1,2,5}, {2,3,1,2,2,1,3,3},
+		{3,3,1,2,2,1,4,1}, {1,2,2,1,3,1,2,5}, {1,3,1,2,2,2,2,4}, {3,2,2,1,3,1,4,1},
+		{1,2,2,1,3,2,2,4}, {2,2,2,1,3,2,3,2}, {2,3,1,2,2,3,3,1}, {1,2,2,1,3,3,2,3},
+		{1,3,1,2,2,4,2,2}, {1,2,2,1,3,4,2,2}, {1,3,1,2,3,1,3,3}, {2,3,1,2,3,1,4,1},
+		{1,2,2,1,4,1,3,3}, {1,3,1,2,3,2,3,2}, {1,2,2,1,4,2,3,2}, {1,3,1,2,3,3,3,1},
+		{1,3,1,2,4,1,4,1}, {1,2,2,1,5,1,4,1}, {3,1,3,1,1,1,1,6}, {4,1,3,1,1,1,2,4},
+		{5,1,3,1,1,1,3,2}, {3,1,3,1,1,2,1,5}, {4,1,3,1,1,2,2,3}, {5,1,3,1,1,2,3,1},
+		{3,1,3,1,1,3,1,4}, {4,1,3,1,1,3,2,2}, {3,1,3,1,1,4,1,3}, {4,1,3,1,1,4,2,1},
+		{3,1,3,1,1,5,1,2}, {2,2,2,2,1,1,1,6}, {3,2,2,2,1,1,2,4}, {4,2,2,2,1,1,3,2},
+		{2,1,3,1,2,1,1,6}, {2,2,2,2,1,2,1,5}, {4,1,3,1,2,1,3,2}, {4,2,2,2,1,2,3,1},
+		{2,1,3,1,2,2,1,5}, {3,1,3,1,2,2,2,3}, {4,1,3,1,2,2,3,1}, {2,1,3,1,2,3,1,4},
+		{2,2,2,2,1,4,1,3}, {3,2,2,2,1,4,2,1}, {2,1,3,1,2,4,1,3}, {3,1,3,1,2,4,2,1},
+		{2,2,2,2,1,6,1,1}, {1,3,1,3,1,1,1,6}, {2,3,1,3,1,1,2,4}, {3,3,1,3,1,1,3,2},
+		{1,2,2,2,2,1,1,6}, {1,3,1,3,1,2,1,5}, {2,3,1,3,1,2,2,3}, {3,3,1,3,1,2,3,1},
+		{1,1,3,1,3,1,1,6}, {1,2,2,2,2,2,1,5}, {2,2,2,2,2,2,2,3}, {3,2,2,2,2,2,3,1},
+		{1,1,3,1,3,2,1,5}, {2,1,3,1,3,2,2,3}, {3,1,3,1,3,2,3,1}, {2,3,1,3,1,4,2,1},
+		{1,1,3,1,3,3,1,4}, {1,2,2,2,2,4,1,3}, {2,2,2,2,2,4,2,1}, {1,1,3,1,3,4,1,3},
+		{1,3,1,3,1,6,1,1}, {1,3,1,3,2,1,2,4}, {2,3,1,3,2,1,3,2}, {1,2,2,2,3,1,2,4},
+		{1,3,1,3,2,2,2,3}, {2,3,1,3,2,2,3,1}, {1,1,3,1,4,1,2,4}, {1,2,2,2,3,2,2,3},
+		{2,2,2,2,3,2,3,1}, {1,1,3,1,4,2,2,3}, {2,1,3,1,4,2,3,1}, {1,3,1,3,2,4,2,1},
+		{1,2,2,2,3,4,2,1}, {1,3,1,3,3,1,3,2}, {1,2,2,2,4,1,3,2}, {1,3,1,3,3,2,3,1},
+		{1,1,3,1,5,1,3,2}, {1,2,2,2,4,2,3,1}, {3,1,3,2,1,1,1,5}, {4,1,3,2,1,1,2,3},
+		{5,1,3,2,1,1,3,1}, {3,1,3,2,1,2,1,4}, {4,1,3,2,1,2,2,2}, {3,1,3,2,1,3,1,3},
+		{4,1,3,2,1,3,2,1}, {3,1,3,2,1,4,1,2}, {3,1,3,2,1,5,1,1}, {2,2,2,3,1,1,1,5},
+		{3,2,2,3,1,1,2,3}, {4,2,2,3,1,1,3,1}, {2,1,3,2,2,1,1,5}, {2,2,2,3,1,2,1,4},
+		{4,1,3,2,2,1,3,1}, {2,1,3,2,2,2,1,4}, {3,1,3,2,2,2,2,2}, {3,2,2,3,1,3,2,1},
+		{2,1,3,2,2,3,1,3}, {2,2,2,3,1,4,1,2}, {2,1,3,2,2,4,1,2}, {2,2,2,3,1,5,1,1},
+		{2,1,3,2,2,5,1,1}, {1,3,1,4,1,1,1,5}, {2,3,1,4,1,1,2,3}, {3,3,1,4,1,1,3,1},
+		{1,2,2,3,2,1,1,5}, {1,3,1,4,1,2,1,4}, {2,3,1,4,1,2,2,2}, {1,1,3,2,3,1,1,5},
+		{1,2,2,3,2,2,1,4}, {2,2,2,3,2,2,2,2}, {2,3,1,4,1,3,2,1}, {1,1,3,2,3,2,1,4},
+		{2,1,3,2,3,2,2,2}, {1,3,1,4,1,4,1,2}, {1,1,3,2,3,3,1,3}, {1,2,2,3,2,4,1,2},
+		{1,3,1,4,1,5,1,1}, {1,2,2,3,2,5,1,1}, {1,3,1,4,2,1,2,3}, {2,3,1,4,2,1,3,1},
+		{1,2,2,3,3,1,2,3}, {1,3,1,4,2,2,2,2}, {1,1,3,2,4,1,2,3}, {1,2,2,3,3,2,2,2},
+		{1,3,1,4,2,3,2,1}, {1,1,3,2,4,2,2,2}, {1,2,2,3,3,3,2,1}, {1,3,1,4,3,1,3,1},
+		{1,1,3,2,5,1,3,1}, {3,1,3,3,1,1,1,4}, {4,1,3,3,1,1,2,2}, {3,1,3,3,1,2,1,3},
+		{4,1,3,3,1,2,2,1}, {3,1,3,3,1,3,1,2}, {3,1,3,3,1,4,1,1}, {2,2,2,4,1,1,1,4},
+		{3,2,2,4,1,1,2,2}, {2,1,3,3,2,1,1,4}, {2,2,2,4,1,2,1,3}, {3,2,2,4,1,2,2,1},
+		{2,1,3,3,2,2,1,3}, {3,1,3,3,2,2,2,1}, {2,1,3,3,2,3,1,2}, {2,2,2,4,1,4,1,1},
+		{2,1,3,3,2,4,1,1}, {1,3,1,5,1,1,1,4}, {2,3,1,5,1,1,2,2}, {1,2,2,4,2,1,1,4},
+		{1,3,1,5,1,2,1,3}, {2,3,1,5,1,2,2,1}, {1,1,3,3,3,1,1,4}, {1,2,2,4,2,2,1,3},
+		{2,2,2,4,2,2,2,1}, {1,1,3,3,3,2,1,3}, {2,1,3,3,3,2,2,1}, {1,3,1,5,1,4,1,1},
+		{1,1,3,3,3,3,1,2}, {1,2,2,4,2,4,1,1}, {1,1,3,3,3,4,1,1}, {1,2,2,4,3,1,2,2},
+		{1,1,3,3,4,1,2,2}, {1,1,3,3,4,2,2,1}, {4,1,3,4,1,1,2,1}, {3,1,3,4,1,3,1,1},
+		{3,2,2,5,1,1,2,1}, {2,2,2,5,1,2,1,2}, {2,2,2,5,1,3,1,1}, {1,3,1,6,1,1,1,3},
+		{1,2,2,5,2,1,1,3}, {1,1,3,4,3,1,1,3}, {1,3,1,6,1,3,1,1}, {1,2,2,5,2,3,1,1},
+		{2,4,1,1,1,1,2,5}, {1,4,1,1,1,2,1,6}, {2,4,1,1,1,2,2,4}, {1,4,1,1,1,3,1,5},
+		{2,4,1,1,1,3,2,3}, {3,4,1,1,1,3,3,1}, {1,4,1,1,1,4,1,4}, {2,4,1,1,1,4,2,2},
+		{1,4,1,1,1,5,1,3}, {2,4,1,1,1,5,2,1}, {1,4,1,1,2,1,2,5}, {2,4,1,1,2,1,3,3},
+		{3,4,1,1,2,1,4,1}, {1,4,1,1,2,2,2,4}, {2,4,1,1,2,2,3,2}, {1,4,1,1,2,3,2,3},
+		{2,4,1,1,2,3,3,1}, {1,4,1,1,2,4,2,2}, {1,4,1,1,2,5,2,1}, {1,4,1,1,3,1,3,3},
+		{2,4,1,1,3,1,4,1}, {1,4,1,1,3,2,3,2}, {1,4,1,1,3,3,3,1}, {1,4,1,1,4,1,4,1},
+		{2,3,2,1,1,1,1,6}, {3,3,2,1,1,1,2,4}, {4,3,2,1,1,1,3,2}, {2,3,2,1,1,2,1,5},
+		{3,3,2,1,1,2,2,3}, {2,3,2,1,1,3,1,4}, {3,3,2,1,1,3,2,2}, {2,3,2,1,1,4,1,3},
+		{3,3,2,1,1,4,2,1}, {2,3,2,1,1,5,1,2}, {1,4,1,2,1,1,1,6}, {2,4,1,2,1,1,2,4},
+		{3,4,1,2,1,1,3,2}, {1,3,2,1,2,1,1,6}, {1,4,1,2,1,2,1,5}, {3,3,2,1,2,1,3,2},
+		{3,4,1,2,1,2,3,1}, {1,3,2,1,2,2,1,5}, {2,3,2,1,2,2,2,3}, {3,3,2,1,2,2,3,1},
+		{1,3,2,1,2,3,1,4}, {1,4,1,2,1,4,1,3}, {2,4,1,2,1,4,2,1}, {1,3,2,1,2,4,1,3},
+		{2,3,2,1,2,4,2,1}, {1,4,1,2,1,6,1,1}, {1,4,1,2,2,1,2,4}, {2,4,1,2,2,1,3,2},
+		{1,3,2,1,3,1,2,4}, {1,4,1,2,2,2,2,3}, {2,4,1,2,2,2,3,1}, {1,3,2,1,3,2,2,3},
+		{2,3,2,1,3,2,3,1}, {1,3,2,1,3,3,2,2}, {1,4,1,2,2,4,2,1}, {1,4,1,2,3,1,3,2},
+		{1,3,2,1,4,1,3,2}, {1,4,1,2,3,2,3,1}, {1,3,2,1,4,2,3,1}, {3,2,3,1,1,1,1,5},
+		{4,2,3,1,1,1,2,3}, {5,2,3,1,1,1,3,1}, {3,2,3,1,1,2,1,4}, {4,2,3,1,1,2,2,2},
+		{3,2,3,1,1,3,1,3}, {4,2,3,1,1,3,2,1}, {3,2,3,1,1,4,1,2}, {3,2,3,1,1,5,1,1},
+		{2,3,2,2,1,1,1,5}, {3,3,2,2,1,1,2,3}, {2,2,3,1,2,1,1,5}, {2,3,2,2,1,2,1,4},
+		{3,3,2,2,1,2,2,2}, {2,2,3,1,2,2,1,4}, {3,2,3,1,2,2,2,2}, {3,3,2,2,1,3,2,1},
+		{2,2,3,1,2,3,1,3}, {2,3,2,2,1,4,1,2}, {2,2,3,1,2,4,1,2}, {2,3,2,2,1,5,1,1},
+		{2,2,3,1,2,5,1,1}, {1,4,1,3,1,1,1,5}, {2,4,1,3,1,1,2,3}, {1,3,2,2,2,1,1,5},
+		{1,4,1,3,1,2,1,4}, {3,3,2,2,2,1,3,1}, {1,2,3,1,3,1,1,5}, {1,3,2,2,2,2,1,4},
+		{2,3,2,2,2,2,2,2}, {2,4,1,3,1,3,2,1}, {1,2,3,1,3,2,1,4}, {2,2,3,1,3,2,2,2},
+		{1,4,1,3,1,4,1,2}, {1,2,3,1,3,3,1,3}, {1,3,2,2,2,4,1,2}, {1,4,1,3,1,5,1,1},
+		{1,3,2,2,2,5,1,1}, {1,4,1,3,2,1,2,3}, {2,4,1,3,2,1,3,1}, {1,3,2,2,3,1,2,3},
+		{1,4,1,3,2,2,2,2}, {1,2,3,1,4,1,2,3}, {1,3,2,2,3,2,2,2}, {1,4,1,3,2,3,2,1},
+		{1,2,3,1,4,2,2,2}, {1,3,2,2,3,3,2,1}, {1,4,1,3,3,1,3,1}, {1,3,2,2,4,1,3,1},
+		{1,2,3,1,5,1,3,1}, {4,1,4,1,1,1,1,4}, {5,1,4,1,1,1,2,2}, {4,1,4,1,1,2,1,3},
+		{5,1,4,1,1,2,2,1}, {4,1,4,1,1,3,1,2}, {4,1,4,1,1,4,1,1}, {3,2,3,2,1,1,1,4},
+		{4,2,3,2,1,1,2,2}, {3,1,4,1,2,1,1,4}, {4,1,4,1,2,1,2,2}, {4,2,3,2,1,2,2,1},
+		{3,1,4,1,2,2,1,3}, {4,1,4,1,2,2,2,1}, {3,1,4,1,2,3,1,2}, {3,2,3,2,1,4,1,1},
+		{3,1,4,1,2,4,1,1}, {2,3,2,3,1,1,1,4}, {3,3,2,3,1,1,2,2}, {2,2,3,2,2,1,1,4},
+		{2,3,2,3,1,2,1,3}, {3,3,2,3,1,2,2,1}, {2,1,4,1,3,1,1,4}, {2,2,3,2,2,2,1,3},
+		{3,2,3,2,2,2,2,1}, {2,1,4,1,3,2,1,3}, {3,1,4,1,3,2,2,1}, {2,3,2,3,1,4,1,1},
+		{2,1,4,1,3,3,1,2}, {2,2,3,2,2,4,1,1}, {2,1,4,1,3,4,1,1}, {1,4,1,4,1,1,1,4},
+		{2,4,1,4,1,1,2,2}, {1,3,2,3,2,1,1,4}, {1,4,1,4,1,2,1,3}, {2,4,1,4,1,2,2,1},
+		{1,2,3,2,3,1,1,4}, {1,3,2,3,2,2,1,3}, {2,3,2,3,2,2,2,1}, {1,1,4,1,4,1,1,4},
+		{1,2,3,2,3,2,1,3}, {2,2,3,2,3,2,2,1}, {1,4,1,4,1,4,1,1}, {1,1,4,1,4,2,1,3},
+		{2,1,4,1,4,2,2,1}, {1,3,2,3,2,4,1,1}, {1,1,4,1,4,3,1,2}, {1,4,1,4,2,1,2,2},
+		{1,3,2,3,3,1,2,2}, {1,4,1,4,2,2,2,1}, {1,2,3,2,4,1,2,2}, {1,3,2,3,3,2,2,1},
+		{1,1,4,1,5,1,2,2}, {1,2,3,2,4,2,2,1}, {1,1,4,1,5,2,2,1}, {4,1,4,2,1,1,1,3},
+		{5,1,4,2,1,1,2,1}, {4,1,4,2,1,2,1,2}, {4,1,4,2,1,3,1,1}, {3,2,3,3,1,1,1,3},
+		{4,2,3,3,1,1,2,1}, {3,1,4,2,2,1,1,3}, {4,1,4,2,2,1,2,1}, {3,1,4,2,2,2,1,2},
+		{3,2,3,3,1,3,1,1}, {3,1,4,2,2,3,1,1}, {2,3,2,4,1,1,1,3}, {3,3,2,4,1,1,2,1},
+		{2,2,3,3,2,1,1,3}, {2,3,2,4,1,2,1,2}, {2,1,4,2,3,1,1,3}, {2,2,3,3,2,2,1,2},
+		{2,3,2,4,1,3,1,1}, {2,1,4,2,3,2,1,2}, {2,2,3,3,2,3,1,1}, {2,1,4,2,3,3,1,1},
+		{1,4,1,5,1,1,1,3}, {2,4,1,5,1,1,2,1}, {1,3,2,4,2,1,1,3}, {2,3,2,4,2,1,2,1},
+		{1,2,3,3,3,1,1,3}, {1,3,2,4,2,2,1,2}, {1,4,1,5,1,3,1,1}, {1,1,4,2,4,1,1,3},
+		{1,2,3,3,3,2,1,2}, {1,3,2,4,2,3,1,1}, {1,1,4,2,4,2,1,2}, {1,2,3,3,3,3,1,1},
+		{1,1,4,2,4,3,1,1}, {1,3,2,4,3,1,2,1}, {1,1,4,2,5,1,2,1}, {4,1,4,3,1,2,1,1},
+		{3,1,4,3,2,1,1,2}, {3,1,4,3,2,2,1,1}, {2,2,3,4,2,1,1,2}, {2,1,4,3,3,1,1,2},
+		{2,1,4,3,3,2,1,1}, {1,3,2,5,2,1,1,2}, {1,2,3,4,3,1,1,2}, {1,1,4,3,4,1,1,2},
+		{1,1,4,3,4,2,1,1}, {1,5,1,1,1,1,1,6}, {1,5,1,1,1,2,1,5}, {2,5,1,1,1,2,2,3},
+		{1,5,1,1,1,3,1,4}, {1,5,1,1,1,4,1,3}, {1,5,1,1,1,5,1,2}, {1,5,1,1,2,1,2,4},
+		{1,5,1,1,2,2,2,3}, {1,5,1,1,2,3,2,2}, {1,5,1,1,2,4,2,1}, {1,5,1,1,3,1,3,2},
+		{1,5,1,1,3,2,3,1}, {2,4,2,1,1,1,1,5}, {2,4,2,1,1,2,1,4}, {3,4,2,1,1,2,2,2},
+		{2,4,2,1,1,3,1,3}, {3,4,2,1,1,3,2,1}, {2,4,2,1,1,4,1,2}, {2,4,2,1,1,5,1,1},
+		{1,5,1,2,1,1,1,5}, {2,5,1,2,1,1,2,3}, {1,4,2,1,2,1,1,5}, {2,4,2,1,2,1,2,3},
+		{2,5,1,2,1,2,2,2}, {1,4,2,1,2,2,1,4}, {2,4,2,1,2,2,2,2}, {1,4,2,1,2,3,1,3},
+		{2,4,2,1,2,3,2,1}, {1,4,2,1,2,4,1,2}, {1,5,1,2,1,5,1,1}, {1,4,2,1,2,5,1,1},
+		{1,5,1,2,2,1,2,3}, {2,5,1,2,2,1,3,1}, {1,4,2,1,3,1,2,3}, {2,4,2,1,3,1,3,1},
+		{1,4,2,1,3,2,2,2}, {1,5,1,2,2,3,2,1}, {1,4,2,1,3,3,2,1}, {1,5,1,2,3,1,3,1},
+		{1,4,2,1,4,1,3,1}, {3,3,3,1,1,1,1,4}, {3,3,3,1,1,2,1,3}, {3,3,3,1,1,3,1,2},
+		{3,3,3,1,1,4,1,1}, {2,4,2,2,1,1,1,4}, {2,3,3,1,2,1,1,4}, {3,3,3,1,2,1,2,2},
+		{3,4,2,2,1,2,2,1}, {2,3,3,1,2,2,1,3}, {3,3,3,1,2,2,2,1}, {2,3,3,1,2,3,1,2},
+		{2,4,2,2,1,4,1,1}, {2,3,3,1,2,4,1,1}, {1,5,1,3,1,1,1,4}, {1,4,2,2,2,1,1,4},
+		{1,5,1,3,1,2,1,3}, {2,5,1,3,1,2,2,1}, {1,3,3,1,3,1,1,4}, {1,4,2,2,2,2,1,3},
+		{1,5,1,3,1,3,1,2}, {1,3,3,1,3,2,1,3}, {1,4,2,2,2,3,1,2}, {1,5,1,3,1,4,1,1},
+		{1,3,3,1,3,3,1,2}, {1,4,2,2,2,4,1,1}, {1,5,1,3,2,1,2,2}, {1,4,2,2,3,1,2,2},
+		{1,5,1,3,2,2,2,1}, {1,3,3,1,4,1,2,2}, {1,4,2,2,3,2,2,1}, {1,3,3,1,4,2,2,1},
+		{4,2,4,1,1,1,1,3}, {4,2,4,1,1,2,1,2}, {4,2,4,1,1,3,1,1}, {3,3,3,2,1,1,1,3},
+		{3,2,4,1,2,1,1,3}, {4,2,4,1,2,1,2,1}, {3,2,4,1,2,2,1,2}, {3,3,3,2,1,3,1,1},
+		{3,2,4,1,2,3,1,1}, {2,4,2,3,1,1,1,3}, {3,4,2,3,1,1,2,1}, {2,3,3,2,2,1,1,3},
+		{3,3,3,2,2,1,2,1}, {2,2,4,1,3,1,1,3}, {2,3,3,2,2,2,1,2}, {2,4,2,3,1,3,1,1},
+		{2,2,4,1,3,2,1,2}, {2,3,3,2,2,3,1,1}, {2,2,4,1,3,3,1,1}, {1,5,1,4,1,1,1,3},
+		{2,5,1,4,1,1,2,1}, {1,4,2,3,2,1,1,3}, {2,4,2,3,2,1,2,1}, {1,3,3,2,3,1,1,3},
+		{1,4,2,3,2,2,1,2}, {1,5,1,4,1,3,1,1}, {1,2,4,1,4,1,1,3}, {1,3,3,2,3,2,1,2},
+		{1,4,2,3,2,3,1,1}, {1,2,4,1,4,2,1,2}, {1,3,3,2,3,3,1,1}, {1,5,1,4,2,1,2,1},
+		{1,4,2,3,3,1,2,1}, {1,3,3,2,4,1,2,1}, {1,2,4,1,5,1,2,1}, {5,1,5,1,1,1,1,2},
+		{5,1,5,1,1,2,1,1}, {4,2,4,2,1,1,1,2}, {4,1,5,1,2,1,1,2}, {4,2,4,2,1,2,1,1},
+		{4,1,5,1,2,2,1,1}, {3,3,3,3,1,1,1,2}, {3,2,4,2,2,1,1,2}, {3,3,3,3,1,2,1,1},
+		{3,1,5,1,3,1,1,2}, {3,2,4,2,2,2,1,1}, {3,1,5,1,3,2,1,1}, {2,4,2,4,1,1,1,2},
+		{2,3,3,3,2,1,1,2}, {2,4,2,4,1,2,1,1}, {2,2,4,2,3,1,1,2}, {2,3,3,3,2,2,1,1},
+		{2,1,5,1,4,1,1,2}
+	},
+	{
+		{5,1,1,1,1,1,2,5}, {6,1,1,1,1,1,3,3}, {4,1,1,1,1,2,1,6}, {5,1,1,1,1,2,2,4},
+		{6,1,1,1,1,2,3,2}, {4,1,1,1,1,3,1,5}, {5,1,1,1,1,3,2,3}, {6,1,1,1,1,3,3,1},
+		{4,1,1,1,1,4,1,4}, {5,1,1,1,1,4,2,2}, {4,1,1,1,1,5,1,3}, {5,1,1,1,1,5,2,1},
+		{4,1,1,1,1,6,1,2}, {4,1,1,1,2,1,2,5}, {5,1,1,1,2,1,3,3}, {6,1,1,1,2,1,4,1},
+		{3,1,1,1,2,2,1,6}, {4,1,1,1,2,2,2,4}, {5,1,1,1,2,2,3,2}, {3,1,1,1,2,3,1,5},
+		{4,1,1,1,2,3,2,3}, {5,1,1,1,2,3,3,1}, {3,1,1,1,2,4,1,4}, {4,1,1,1,2,4,2,2},
+		{3,1,1,1,2,5,1,3}, {4,1,1,1,2,5,2,1}, {3,1,1,1,2,6,1,2}, {3,1,1,1,3,1,2,5},
+		{4,1,1,1,3,1,3,3}, {5,1,1,1,3,1,4,1}, {2,1,1,1,3,2,1,6}, {3,1,1,1,3,2,2,4},
+		{4,1,1,1,3,2,3,2}, {2,1,1,1,3,3,1,5}, {3,1,1,1,3,3,2,3}, {4,1,1,1,3,3,3,1},
+		{2,1,1,1,3,4,1,4}, {3,1,1,1,3,4,2,2}, {2,1,1,1,3,5,1,3}, {3,1,1,1,3,5,2,1},
+		{2,1,1,1,3,6,1,2}, {2,1,1,1,4,1,2,5}, {3,1,1,1,4,1,3,3}, {4,1,1,1,4,1,4,1},
+		{1,1,1,1,4,2,1,6}, {2,1,1,1,4,2,2,4}, {3,1,1,1,4,2,3,2}, {1,1,1,1,4,3,1,5},
+		{2,1,1,1,4,3,2,3}, {3,1,1,1,4,3,3,1}, {1,1,1,1,4,4,1,4}, {2,1,1,1,4,4,2,2},
+		{1,1,1,1,4,5,1,3}, {2,1,1,1,4,5,2,1}, {1,1,1,1,5,1,2,5}, {2,1,1,1,5,1,3,3},
+		{3,1,1,1,5,1,4,1}, {1,1,1,1,5,2,2,4}, {2,1,1,1,5,2,3,2}, {1,1,1,1,5,3,2,3},
+		{2,1,1,1,5,3,3,1}, {1,1,1,1,5,4,2,2}, {1,1,1,1,6,1,3,3}, {2,1,1,1,6,1,4,1},
+		{1,1,1,1,6,2,3,2}, {1,1,1,1,6,3,3,1}, {4,1,1,2,1,1,1,6}, {5,1,1,2,1,1,2,4},
+		{6,1,1,2,1,1,3,2}, {4,1,1,2,1,2,1,5}, {5,1,1,2,1,2,2,3}, {6,1,1,2,1,2,3,1},
+		{4,1,1,2,1,3,1,4}, {5,1,1,2,1,3,2,2}, {4,1,1,2,1,4,1,3}, {5,1,1,2,1,4,2,1},
+		{4,1,1,2,1,5,1,2}, {4,1,1,2,1,6,1,1}, {3,1,1,2,2,1,1,6}, {4,1,1,2,2,1,2,4},
+		{5,1,1,2,2,1,3,2}, {3,1,1,2,2,2,1,5}, {4,1,1,2,2,2,2,3}, {5,1,1,2,2,2,3,1},
+		{3,1,1,2,2,3,1,4}, {4,1,1,2,2,3,2,2}, {3,1,1,2,2,4,1,3}, {4,1,1,2,2,4,2,1},
+		{3,1,1,2,2,5,1,2}, {3,1,1,2,2,6,1,1}, {2,1,1,2,3,1,1,6}, {3,1,1,2,3,1,2,4},
+		{4,1,1,2,3,1,3,2}, {2,1,1,2,3,2,1,5}, {3,1,1,2,3,2,2,3}, {4,1,1,2,3,2,3,1},
+		{2,1,1,2,3,3,1,4}, {3,1,1,2,3,3,2,2}, {2,1,1,2,3,4,1,3}, {3,1,1,2,3,4,2,1},
+		{2,1,1,2,3,5,1,2}, {2,1,1,2,3,6,1,1}, {1,1,1,2,4,1,1,6}, {2,1,1,2,4,1,2,4},
+		{3,1,1,2,4,1,3,2}, {1,1,1,2,4,2,1,5}, {2,1,1,2,4,2,2,3}, {3,1,1,2,4,2,3,1},
+		{1,1,1,2,4,3,1,4}, {2,1,1,2,4,3,2,2}, {1,1,1,2,4,4,1,3}, {2,1,1,2,4,4,2,1},
+		{1,1,1,2,4,5,1,2}, {1,1,1,2,5,1,2,4}, {2,1,1,2,5,1,3,2}, {1,1,1,2,5,2,2,3},
+		{2,1,1,2,5,2,3,1}, {1,1,1,2,5,3,2,2}, {1,1,1,2,5,4,2,1}, {1,1,1,2,6,1,3,2},
+		{1,1,1,2,6,2,3,1}, {4,1,1,3,1,1,1,5}, {5,1,1,3,1,1,2,3}, {6,1,1,3,1,1,3,1},
+		{4,1,1,3,1,2,1,4}, {5,1,1,3,1,2,2,2}, {4,1,1,3,1,3,1,3}, {5,1,1,3,1,3,2,1},
+		{4,1,1,3,1,4,1,2}, {4,1,1,3,1,5,1,1}, {3,1,1,3,2,1,1,5}, {4,1,1,3,2,1,2,3},
+		{5,1,1,3,2,1,3,1}, {3,1,1,3,2,2,1,4}, {4,1,1,3,2,2,2,2}, {3,1,1,3,2,3,1,3},
+		{4,1,1,3,2,3,2,1}, {3,1,1,3,2,4,1,2}, {3,1,1,3,2,5,1,1}, {2,1,1,3,3,1,1,5},
+		{3,1,1,3,3,1,2,3}, {4,1,1,3,3,1,3,1}, {2,1,1,3,3,2,1,4}, {3,1,1,3,3,2,2,2},
+		{2,1,1,3,3,3,1,3}, {3,1,1,3,3,3,2,1}, {2,1,1,3,3,4,1,2}, {2,1,1,3,3,5,1,1},
+		{1,1,1,3,4,1,1,5}, {2,1,1,3,4,1,2,3}, {3,1,1,3,4,1,3,1}, {1,1,1,3,4,2,1,4},
+		{2,1,1,3,4,2,2,2}, {1,1,1,3,4,3,1,3}, {2,1,1,3,4,3,2,1}, {1,1,1,3,4,4,1,2},
+		{1,1,1,3,4,5,1,1}, {1,1,1,3,5,1,2,3}, {2,1,1,3,5,1,3,1}, {1,1,1,3,5,2,2,2},
+		{1,1,1,3,5,3,2,1}, {1,1,1,3,6,1,3,1}, {4,1,1,4,1,1,1,4}, {5,1,1,4,1,1,2,2},
+		{4,1,1,4,1,2,1,3}, {5,1,1,4,1,2,2,1}, {4,1,1,4,1,3,1,2}, {4,1,1,4,1,4,1,1},
+		{3,1,1,4,2,1,1,4}, {4,1,1,4,2,1,2,2}, {3,1,1,4,2,2,1,3}, {4,1,1,4,2,2,2,1},
+		{3,1,1,4,2,3,1,2}, {3,1,1,4,2,4,1,1}, {2,1,1,4,3,1,1,4}, {3,1,1,4,3,1,2,2},
+		{2,1,1,4,3,2,1,3}, {3,1,1,4,3,2,2,1}, {2,1,1,4,3,3,1,2}, {2,1,1,4,3,4,1,1},
+		{1,1,1,4,4,1,1,4}, {2,1,1,4,4,1,2,2}, {1,1,1,4,4,2,1,3}, {2,1,1,4,4,2,2,1},
+		{1,1,1,4,4,3,1,2}, {1,1,1,4,4,4,1,1}, {1,1,1,4,5,1,2,2}, {1,1,1,4,5,2,2,1},
+		{4,1,1,5,1,1,1,3}, {5,1,1,5,1,1,2,1}, {4,1,1,5,1,2,1,2}, {4,1,1,5,1,3,1,1},
+		{3,1,1,5,2,1,1,3}, {4,1,1,5,2,1,2,1}, {3,1,1,5,2,2,1,2}, {3,1,1,5,2,3,1,1},
+		{2,1,1,5,3,1,1,3}, {3,1,1,5,3,1,2,1}, {2,1,1,5,3,2,1,2}, {2,1,1,5,3,3,1,1},
+		{1,1,1,5,4,1,1,3}, {2,1,1,5,4,1,2,1}, {1,1,1,5,4,2,1,2}, {1,1,1,5,4,3,1,1},
+		{4,1,1,6,1,1,1,2}, {4,1,1,6,1,2,1,1}, {3,1,1,6,2,1,1,2}, {3,1,1,6,2,2,1,1},
+		{2,1,1,6,3,1,1,2}, {2,1,1,6,3,2,1,1}, {4,2,1,1,1,1,1,6}, {5,2,1,1,1,1,2,4},
+		{6,2,1,1,1,1,3,2}, {4,2,1,1,1,2,1,5}, {5,2,1,1,1,2,2,3}, {6,2,1,1,1,2,3,1},
+		{4,2,1,1,1,3,1,4}, {5,2,1,1,1,3,2,2}, {4,2,1,1,1,4,1,3}, {5,2,1,1,1,4,2,1},
+		{4,2,1,1,1,5,1,2}, {4,2,1,1,1,6,1,1}, {3,2,1,1,2,1,1,6}, {4,2,1,1,2,1,2,4},
+		{5,2,1,1,2,1,3,2}, {3,2,1,1,2,2,1,5}, {4,2,1,1,2,2,2,3}, {5,2,1,1,2,2,3,1},
+		{3,2,1,1,2,3,1,4}, {4,2,1,1,2,3,2,2}, {3,2,1,1,2,4,1,3}, {4,2,1,1,2,4,2,1},
+		{3,2,1,1,2,5,1,2}, {3,2,1,1,2,6,1,1}, {2,2,1,1,3,1,1,6}, {3,2,1,1,3,1,2,4},
+		{4,2,1,1,3,1,3,2}, {2,2,1,1,3,2,1,5}, {3,2,1,1,3,2,2,3}, {4,2,1,1,3,2,3,1},
+		{2,2,1,1,3,3,1,4}, {3,2,1,1,3,3,2,2}, {2,2,1,1,3,4,1,3}, {3,2,1,1,3,4,2,1},
+		{2,2,1,1,3,5,1,2}, {2,2,1,1,3,6,1,1}, {1,2,1,1,4,1,1,6}, {2,2,1,1,4,1,2,4},
+		{3,2,1,1,4,1,3,2}, {1,2,1,1,4,2,1,5}, {2,2,1,1,4,2,2,3}, {3,2,1,1,4,2,3,1},
+		{1,2,1,1,4,3,1,4}, {2,2,1,1,4,3,2,2}, {1,2,1,1,4,4,1,3}, {2,2,1,1,4,4,2,1},
+		{1,2,1,1,4,5,1,2}, {1,2,1,1,5,1,2,4}, {2,2,1,1,5,1,3,2}, {1,2,1,1,5,2,2,3},
+		{2,2,1,1,5,2,3,1}, {1,2,1,1,5,3,2,2}, {1,2,1,1,5,4,2,1}, {1,2,1,1,6,1,3,2},
+		{1,2,1,1,6,2,3,1}, {5,1,2,1,1,1,1,5}, {6,1,2,1,1,1,2,3}, {1,1,2,1,1,1,6,4},
+		{5,1,2,1,1,2,1,4}, {6,1,2,1,1,2,2,2}, {1,1,2,1,1,2,6,3}, {5,1,2,1,1,3,1,3},
+		{6,1,2,1,1,3,2,1}, {1,1,2,1,1,3,6,2}, {5,1,2,1,1,4,1,2}, {5,1,2,1,1,5,1,1},
+		{4,2,1,2,1,1,1,5}, {5,2,1,2,1,1,2,3}, {6,2,1,2,1,1,3,1}, {4,1,2,1,2,1,1,5},
+		{4,2,1,2,1,2,1,4}, {6,1,2,1,2,1,3,1}, {4,1,2,1,2,2,1,4}, {5,1,2,1,2,2,2,2},
+		{5,2,1,2,1,3,2,1}, {4,1,2,1,2,3,1,3}, {4,2,1,2,1,4,1,2}, {4,1,2,1,2,4,1,2},
+		{4,2,1,2,1,5,1,1}, {4,1,2,1,2,5,1,1}, {3,2,1,2,2,1,1,5}, {4,2,1,2,2,1,2,3},
+		{5,2,1,2,2,1,3,1}, {3,1,2,1,3,1,1,5}, {3,2,1,2,2,2,1,4}, {4,2,1,2,2,2,2,2},
+		{3,1,2,1,3,2,1,4}, {4,1,2,1,3,2,2,2}, {4,2,1,2,2,3,2,1}, {3,1,2,1,3,3,1,3},
+		{3,2,1,2,2,4,1,2}, {3,1,2,1,3,4,1,2}, {3,2,1,2,2,5,1,1}, {3,1,2,1,3,5,1,1},
+		{2,2,1,2,3,1,1,5}, {3,2,1,2,3,1,2,3}, {4,2,1,2,3,1,3,1}, {2,1,2,1,4,1,1,5},
+		{2,2,1,2,3,2,1,4}, {3,2,1,2,3,2,2,2}, {2,1,2,1,4,2,1,4}, {3,1,2,1,4,2,2,2},
+		{3,2,1,2,3,3,2,1}, {2,1,2,1,4,3,1,3}, {2,2,1,2,3,4,1,2}, {2,1,2,1,4,4,1,2},
+		{2,2,1,2,3,5,1,1}, {2,1,2,1,4,5,1,1}, {1,2,1,2,4,1,1,5}, {2,2,1,2,4,1,2,3},
+		{3,2,1,2,4,1,3,1}, {1,1,2,1,5,1,1,5}, {1,2,1,2,4,2,1,4}, {2,2,1,2,4,2,2,2},
+		{1,1,2,1,5,2,1,4}, {2,1,2,1,5,2,2,2}, {2,2,1,2,4,3,2,1}, {1,1,2,1,5,3,1,3},
+		{1,2,1,2,4,4,1,2}, {1,1,2,1,5,4,1,2}, {1,2,1,2,4,5,1,1}, {1,2,1,2,5,1,2,3},
+		{2,2,1,2,5,1,3,1}, {1,1,2,1,6,1,2,3}, {1,2,1,2,5,2,2,2}, {1,1,2,1,6,2,2,2},
+		{1,2,1,2,5,3,2,1}, {1,1,2,1,6,3,2,1}, {1,2,1,2,6,1,3,1}, {5,1,2,2,1,1,1,4},
+		{6,1,2,2,1,1,2,2}, {1,1,2,2,1,1,6,3}, {5,1,2,2,1,2,1,3}, {6,1,2,2,1,2,2,1},
+		{1,1,2,2,1,2,6,2}, {5,1,2,2,1,3,1,2}, {1,1,2,2,1,3,6,1}, {5,1,2,2,1,4,1,1},
+		{4,2,1,3,1,1,1,4}, {5,2,1,3,1,1,2,2}, {4,1,2,2,2,1,1,4}, {4,2,1,3,1,2,1,3},
+		{5,2,1,3,1,2,2,1}, {4,1,2,2,2,2,1,3}, {5,1,2,2,2,2,2,1}, {4,1,2,2,2,3,1,2},
+		{4,2,1,3,1,4,1,1}, {4,1,2,2,2,4,1,1}, {3,2,1,3,2,1,1,4}, {4,2,1,3,2,1,2,2},
+		{3,1,2,2,3,1,1,4}, {3,2,1,3,2,2,1,3}, {4,2,1,3,2,2,2,1}, {3,1,2,2,3,2,1,3},
+		{4,1,2,2,3,2,2,1}, {3,1,2,2,3,3,1,2}, {3,2,1,3,2,4,1,1}, {3,1,2,2,3,4,1,1},
+		{2,2,1,3,3,1,1,4}, {3,2,1,3,3,1,2,2}, {2,1,2,2,4,1,1,4}, {2,2,1,3,3,2,1,3},
+		{3,2,1,3,3,2,2,1}, {2,1,2,2,4,2,1,3}, {3,1,2,2,4,2,2,1}, {2,1,2,2,4,3,1,2},
+		{2,2,1,3,3,4,1,1}, {2,1,2,2,4,4,1,1}, {1,2,1,3,4,1,1,4}, {2,2,1,3,4,1,2,2},
+		{1,1,2,2,5,1,1,4}, {1,2,1,3,4,2,1,3}, {2,2,1,3,4,2,2,1}, {1,1,2,2,5,2,1,3},
+		{2,1,2,2,5,2,2,1}, {1,1,2,2,5,3,1,2}, {1,2,1,3,4,4,1,1}, {1,1,2,2,5,4,1,1},
+		{1,2,1,3,5,1,2,2}, {1,1,2,2,6,1,2,2}, {1,2,1,3,5,2,2,1}, {1,1,2,2,6,2,2,1},
+		{5,1,2,3,1,1,1,3}, {6,1,2,3,1,1,2,1}, {1,1,2,3,1,1,6,2}, {5,1,2,3,1,2,1,2},
+		{1,1,2,3,1,2,6,1}, {5,1,2,3,1,3,1,1}, {4,2,1,4,1,1,1,3}, {5,2,1,4,1,1,2,1},
+		{4,1,2,3,2,1,1,3}, {5,1,2,3,2,1,2,1}, {4,1,2,3,2,2,1,2}, {4,2,1,4,1,3,1,1},
+		{4,1,2,3,2,3,1,1}, {3,2,1,4,2,1,1,3}, {4,2,1,4,2,1,2,1}, {3,1,2,3,3,1,1,3},
+		{3,2,1,4,2,2,1,2}, {3,1,2,3,3,2,1,2}, {3,2,1,4,2,3,1,1}, {3,1,2,3,3,3,1,1},
+		{2,2,1,4,3,1,1,3}, {3,2,1,4,3,1,2,1}, {2,1,2,3,4,1,1,3}, {3,1,2,3,4,1,2,1},
+		{2,1,2,3,4,2,1,2}, {2,2,1,4,3,3,1,1}, {2,1,2,3,4,3,1,1}, {1,2,1,4,4,1,1,3},
+		{2,2,1,4,4,1,2,1}, {1,1,2,3,5,1,1,3}, {1,2,1,4,4,2,1,2}, {1,1,2,3,5,2,1,2},
+		{1,2,1,4,4,3,1,1}, {1,1,2,3,5,3,1,1}, {1,2,1,4,5,1,2,1}, {1,1,2,3,6,1,2,1},
+		{5,1,2,4,1,1,1,2}, {1,1,2,4,1,1,6,1}, {5,1,2,4,1,2,1,1}, {4,2,1,5,1,1,1,2},
+		{4,1,2,4,2,1,1,2}, {4,2,1,5,1,2,1,1}, {4,1,2,4,2,2,1,1}, {3,2,1,5,2,1,1,2},
+		{3,1,2,4,3,1,1,2}, {3,2,1,5,2,2,1,1}, {3,1,2,4,3,2,1,1}, {2,2,1,5,3,1,1,2},
+		{2,1,2,4,4,1,1,2}, {2,2,1,5,3,2,1,1}, {2,1,2,4,4,2,1,1}, {1,2,1,5,4,1,1,2},
+		{1,1,2,4,5,1,1,2}, {1,2,1,5,4,2,1,1}, {1,1,2,4,5,2,1,1}, {5,1,2,5,1,1,1,1},
+		{4,2,1,6,1,1,1,1}, {4,1,2,5,2,1,1,1}, {3,2,1,6,2,1,1,1}, {3,1,2,5,3,1,1,1},
+		{2,2,1,6,3,1,1,1}, {2,1,2,5,4,1,1,1}, {4,3,1,1,1,1,1,5}, {5,3,1,1,1,1,2,3},
+		{6,3,1,1,1,1,3,1}, {4,3,1,1,1,2,1,4}, {5,3,1,1,1,2,2,2}, {4,3,1,1,1,3,1,3},
+		{5,3,1,1,1,3,2,1}, {4,3,1,1,1,4,1,2}, {4,3,1,1,1,5,1,1}, {3,3,1,1,2,1,1,5},
+		{4,3,1,1,2,1,2,3}, {5,3,1,1,2,1,3,1}, {3,3,1,1,2,2,1,4}, {4,3,1,1,2,2,2,2},
+		{3,3,1,1,2,3,1,3}, {4,3,1,1,2,3,2,1}, {3,3,1,1,2,4,1,2}, {3,3,1,1,2,5,1,1},
+		{2,3,1,1,3,1,1,5}, {3,3,1,1,3,1,2,3}, {4,3,1,1,3,1,3,1}, {2,3,1,1,3,2,1,4},
+		{3,3,1,1,3,2,2,2}, {2,3,1,1,3,3,1,3}, {3,3,1,1,3,3,2,1}, {2,3,1,1,3,4,1,2},
+		{2,3,1,1,3,5,1,1}, {1,3,1,1,4,1,1,5}, {2,3,1,1,4,1,2,3}, {3,3,1,1,4,1,3,1},
+		{1,3,1,1,4,2,1,4}, {2,3,1,1,4,2,2,2}, {1,3,1,1,4,3,1,3}, {2,3,1,1,4,3,2,1},
+		{1,3,1,1,4,4,1,2}, {1,3,1,1,4,5,1,1}, {1,3,1,1,5,1,2,3}, {2,3,1,1,5,1,3,1},
+		{1,3,1,1,5,2,2,2}, {1,3,1,1,5,3,2,1}, {1,3,1,1,6,1,3,1}, {5,2,2,1,1,1,1,4},
+		{6,2,2,1,1,1,2,2}, {1,2,2,1,1,1,6,3}, {5,2,2,1,1,2,1,3}, {6,2,2,1,1,2,2,1},
+		{1,2,2,1,1,2,6,2}, {5,2,2,1,1,3,1,2}, {1,2,2,1,1,3,6,1}, {5,2,2,1,1,4,1,1},
+		{4,3,1,2,1,1,1,4}, {5,3,1,2,1,1,2,2}, {4,2,2,1,2,1,1,4}, {4,3,1,2,1,2,1,3},
+		{5,3,1,2,1,2,2,1}, {4,2,2,1,2,2,1,3}, {5,2,2,1,2,2,2,1}, {4,2,2,1,2,3,1,2},
+		{4,3,1,2,1,4,1,1}, {4,2,2,1,2,4,1,1}, {3,3,1,2,2,1,1,4}, {4,3,1,2,2,1,2,2},
+		{3,2,2,1,3,1,1,4}, {3,3,1,2,2,2,1,3}, {4,3,1,2,2,2,2,1}, {3,2,2,1,3,2,1,3},
+		{4,2,2,1,3,2,2,1}, {3,2,2,1,3,3,1,2}, {3,3,1,2,2,4,1,1}, {3,2,2,1,3,4,1,1},
+		{2,3,1,2,3,1,1,4}, {3,3,1,2,3,1,2,2}, {2,2,2,1,4,1,1,4}, {2,3,1,2,3,2,1,3},
+		{3,3,1,2,3,2,2,1}, {2,2,2,1,4,2,1,3}, {3,2,2,1,4,2,2,1}, {2,2,2,1,4,3,1,2},
+		{2,3,1,2,3,4,1,1}, {2,2,2,1,4,4,1,1}, {1,3,1,2,4,1,1,4}, {2,3,1,2,4,1,2,2},
+		{1,2,2,1,5,1,1,4}, {1,3,1,2,4,2,1,3}, {2,3,1,2,4,2,2,1}, {1,2,2,1,5,2,1,3},
+		{2,2,2,1,5,2,2,1}, {1,2,2,1,5,3,1,2}, {1,3,1,2,4,4,1,1}, {1,2,2,1,5,4,1,1},
+		{1,3,1,2,5,1,2,2}, {1,2,2,1,6,1,2,2}, {1,3,1,2,5,2,2,1}, {1,2,2,1,6,2,2,1},
+		{6,1,3,1,1,1,1,3}, {1,1,3,1,1,1,5,4}, {2,1,3,1,1,1,6,2}, {6,1,3,1,1,2,1,2},
+		{1,1,3,1,1,2,5,3}, {2,1,3,1,1,2,6,1}, {6,1,3,1,1,3,1,1}, {1,1,3,1,1,3,5,2},
+		{1,1,3,1,1,4,5,1}, {5,2,2,2,1,1,1,3}, {6,2,2,2,1,1,2,1}, {1,2,2,2,1,1,6,2},
+		{5,1,3,1,2,1,1,3}, {6,1,3,1,2,1,2,1}, {1,1,3,1,2,1,6,2}, {1,2,2,2,1,2,6,1},
+		{5,1,3,1,2,2,1,2}, {5,2,2,2,1,3,1,1}, {1,1,3,1,2,2,6,1}, {5,1,3,1,2,3,1,1},
+		{4,3,1,3,1,1,1,3}, {5,3,1,3,1,1,2,1}, {4,2,2,2,2,1,1,3}, {4,3,1,3,1,2,1,2},
+		{4,1,3,1,3,1,1,3}, {5,1,3,1,3,1,2,1}, {4,3,1,3,1,3,1,1}, {4,1,3,1,3,2,1,2},
+		{4,2,2,2,2,3,1,1}, {4,1,3,1,3,3,1,1}, {3,3,1,3,2,1,1,3}, {4,3,1,3,2,1,2,1},
+		{3,2,2,2,3,1,1,3}, {3,3,1,3,2,2,1,2}, {3,1,3,1,4,1,1,3}, {3,2,2,2,3,2,1,2},
+		{3,3,1,3,2,3,1,1}, {3,1,3,1,4,2,1,2}, {3,2,2,2,3,3,1,1}, {3,1,3,1,4,3,1,1},
+		{2,3,1,3,3,1,1,3}, {3,3,1,3,3,1,2,1}, {2,2,2,2,4,1,1,3}, {2,3,1,3,3,2,1,2},
+		{2,1,3,1,5,1,1,3}, {2,2,2,2,4,2,1,2}, {2,3,1,3,3,3,1,1}, {2,1,3,1,5,2,1,2},
+		{2,2,2,2,4,3,1,1}, {2,1,3,1,5,3,1,1}, {1,3,1,3,4,1,1,3}, {2,3,1,3,4,1,2,1},
+		{1,2,2,2,5,1,1,3}, {1,3,1,3,4,2,1,2}, {1,1,3,1,6,1,1,3}, {1,2,2,2,5,2,1,2},
+		{1,3,1,3,4,3,1,1}, {1,1,3,1,6,2,1,2}, {1,2,2,2,5,3,1,1}, {1,1,3,1,6,3,1,1},
+		{1,3,1,3,5,1,2,1}, {1,2,2,2,6,1,2,1}, {6,1,3,2,1,1,1,2}, {1,1,3,2,1,1,5,3},
+		{2,1,3,2,1,1,6,1}, {6,1,3,2,1,2,1,1}, {1,1,3,2,1,2,5,2}, {1,1,3,2,1,3,5,1},
+		{5,2,2,3,1,1,1,2}, {1,2,2,3,1,1,6,1}, {5,1,3,2,2,1,1,2}, {5,2,2,3,1,2,1,1},
+		{1,1,3,2,2,1,6,1}, {5,1,3,2,2,2,1,1}, {4,3,1,4,1,1,1,2}, {4,2,2,3,2,1,1,2},
+		{4,3,1,4,1,2,1,1}, {4,1,3,2,3,1,1,2}, {4,2,2,3,2,2,1,1}, {4,1,3,2,3,2,1,1},
+		{3,3,1,4,2,1,1,2}, {3,2,2,3,3,1,1,2}, {3,3,1,4,2,2,1,1}, {3,1,3,2,4,1,1,2},
+		{3,2,2,3,3,2,1,1}, {3,1,3,2,4,2,1,1}, {2,3,1,4,3,1,1,2}, {2,2,2,3,4,1,1,2},
+		{2,3,1,4,3,2,1,1}, {2,1,3,2,5,1,1,2}, {2,2,2,3,4,2,1,1}, {2,1,3,2,5,2,1,1},
+		{1,3,1,4,4,1,1,2}, {1,2,2,3,5,1,1,2}, {1,3,1,4,4,2,1,1}, {1,1,3,2,6,1,1,2},
+		{1,2,2,3,5,2,1,1}, {1,1,3,2,6,2,1,1}, {6,1,3,3,1,1,1,1}, {1,1,3,3,1,1,5,2},
+		{1,1,3,3,1,2,5,1}, {5,2,2,4,1,1,1,1}, {5,1,3,3,2,1,1,1}, {4,3,1,5,1,1,1,1},
+		{4,2,2,4,2,1,1,1}, {4,1,3,3,3,1,1,1}, {3,3,1,5,2,1,1,1}, {3,2,2,4,3,1,1,1},
+		{3,1,3,3,4,1,1,1}, {2,3,1,5,3,1,1,1}, {2,2,2,4,4,1,1,1}, {2,1,3,3,5,1,1,1},
+		{1,3,1,5,4,1,1,1}, {1,2,2,4,5,1,1,1}, {1,1,3,3,6,1,1,1}, {1,1,3,4,1,1,5,1},
+		{4,4,1,1,1,1,1,4}, {5,4,1,1,1,1,2,2}, {4,4,1,1,1,2,1,3}, {5,4,1,1,1,2,2,1},
+		{4,4,1,1,1,3,1,2}, {4,4,1,1,1,4,1,1}, {3,4,1,1,2,1,1,4}, {4,4,1,1,2,1,2,2},
+		{3,4,1,1,2,2,1,3}, {4,4,1,1,2,2,2,1}, {3,4,1,1,2,3,1,2}, {3,4,1,1,2,4,1,1},
+		{2,4,1,1,3,1,1,4}, {3,4,1,1,3,1,2,2}, {2,4,1,1,3,2,1,3}, {3,4,1,1,3,2,2,1},
+		{2,4,1,1,3,3,1,2}, {2,4,1,1,3,4,1,1}, {1,4,1,1,4,1,1,4}, {2,4,1,1,4,1,2,2},
+		{1,4,1,1,4,2,1,3}, {2,4,1,1,4,2,2,1}, {1,4,1,1,4,3,1,2}, {1,4,1,1,4,4,1,1},
+		{1,4,1,1,5,1,2,2}, {1,4,1,1,5,2,2,1}, {5,3,2,1,1,1,1,3}, {6,3,2,1,1,1,2,1},
+		{1,3,2,1,1,1,6,2}, {5,3,2,1,1,2,1,2}, {1,3,2,1,1,2,6,1}, {5,3,2,1,1,3,1,1},
+		{4,4,1,2,1,1,1,3}, {5,4,1,2,1,1,2,1}, {4,3,2,1,2,1,1,3}, {4,4,1,2,1,2,1,2},
+		{4,3,2,1,2,2,1,2}, {4,4,1,2,1,3,1,1}, {4,3,2,1,2,3,1,1}, {3,4,1,2,2,1,1,3},
+		{4,4,1,2,2,1,2,1}, {3,3,2,1,3,1,1,3}, {3,4,1,2,2,2,1,2}, {3,3,2,1,3,2,1,2},
+		{3,4,1,2,2,3,1,1}, {3,3,2,1,3,3,1,1}, {2,4,1,2,3,1,1,3}, {3,4,1,2,3,1,2,1},
+		{2,3,2,1,4,1,1,3}, {2,4,1,2,3,2,1,2}, {2,3,2,1,4,2,1,2}, {2,4,1,2,3,3,1,1},
+		{2,3,2,1,4,3,1,1}, {1,4,1,2,4,1,1,3}, {2,4,1,2,4,1,2,1}, {1,3,2,1,5,1,1,3},
+		{1,4,1,2,4,2,1,2}, {1,3,2,1,5,2,1,2}, {1,4,1,2,4,3,1,1}, {1,3,2,1,5,3,1,1},
+		{1,4,1,2,5,1,2,1}, {1,3,2,1,6,1,2,1}, {6,2,3,1,1,1,1,2}, {1,2,3,1,1,1,5,3},
+		{2,2,3,1,1,1,6,1}, {6,2,3,1,1,2,1,1}, {1,2,3,1,1,2,5,2}, {1,2,3,1,1,3,5,1},
+		{5,3,2,2,1,1,1,2}, {1,3,2,2,1,1,6,1}, {5,2,3,1,2,1,1,2}, {5,3,2,2,1,2,1,1},
+		{1,2,3,1,2,1,6,1}, {5,2,3,1,2,2,1,1}, {4,4,1,3,1,1,1,2}, {4,3,2,2,2,1,1,2},
+		{4,4,1,3,1,2,1,1}, {4,2,3,1,3,1,1,2}, {4,3,2,2,2,2,1,1}, {4,2,3,1,3,2,1,1},
+		{3,4,1,3,2,1,1,2}, {3,3,2,2,3,1,1,2}, {3,4,1,3,2,2,1,1}, {3,2,3,1,4,1,1,2},
+		{3,3,2,2,3,2,1,1}, {3,2,3,1,4,2,1,1}, {2,4,1,3,3,1,1,2}, {2,3,2,2,4,1,1,2},
+		{2,4,1,3,3,2,1,1}, {2,2,3,1,5,1,1,2}, {2,3,2,2,4,2,1,1}, {2,2,3,1,5,2,1,1},
+		{1,4,1,3,4,1,1,2}, {1,3,2,2,5,1,1,2}, {1,4,1,3,4,2,1,1}, {1,2,3,1,6,1,1,2},
+		{1,3,2,2,5,2,1,1}, {1,2,3,1,6,2,1,1}, {1,1,4,1,1,1,4,4}, {2,1,4,1,1,1,5,2},
+		{1,1,4,1,1,2,4,3}, {2,1,4,1,1,2,5,1}, {1,1,4,1,1,3,4,2}, {1,1,4,1,1,4,4,1},
+		{6,2,3,2,1,1,1,1}, {1,2,3,2,1,1,5,2}, {6,1,4,1,2,1,1,1}, {1,1,4,1,2,1,5,2},
+		{1,2,3,2,1,2,5,1}, {1,1,4,1,2,2,5,1}, {5,3,2,3,1,1,1,1}, {5,2,3,2,2,1,1,1},
+		{5,1,4,1,3,1,1,1}, {4,4,1,4,1,1,1,1}, {4,3,2,3,2,1,1,1}, {4,2,3,2,3,1,1,1},
+		{4,1,4,1,4,1,1,1}, {3,4,1,4,2,1,1,1}, {3,3,2,3,3,1,1,1}, {3,2,3,2,4,1,1,1},
+		{3,1,4,1,5,1,1,1}, {2,4,1,4,3,1,1,1}, {2,3,2,3,4,1,1,1}, {2,2,3,2,5,1,1,1},
+		{2,1,4,1,6,1,1,1}, {1,4,1,4,4,1,1,1}, {1,3,2,3,5,1,1,1}, {1,2,3,2,6,1,1,1},
+		{1,1,4,2,1,1,4,3}, {2,1,4,2,1,1,5,1}, {1,1,4,2,1,2,4,2}, {1,1,4,2,1,3,4,1},
+		{1,2,3,3,1,1,5,1}, {1,1,4,2,2,1,5,1}, {1,1,4,3,1,1,4,2}, {1,1,4,3,1,2,4,1},
+		{1,1,4,4,1,1,4,1}, {4,5,1,1,1,1,1,3}, {4,5,1,1,1,2,1,2}, {4,5,1,1,1,3,1,1},
+		{3,5,1,1,2,1,1,3}, {4,5,1,1,2,1,2,1}, {3,5,1,1,2,2,1,2}, {3,5,1,1,2,3,1,1},
+		{2,5,1,1,3,1,1,3}, {3,5,1,1,3,1,2,1}, {2,5,1,1,3,2,1,2}, {2,5,1,1,3,3,1,1},
+		{1,5,1,1,4,1,1,3}, {2,5,1,1,4,1,2,1}, {1,5,1,1,4,2,1,2}, {1,5,1,1,4,3,1,1},
+		{1,5,1,1,5,1,2,1}, {5,4,2,1,1,1,1,2}, {1,4,2,1,1,1,6,1}, {5,4,2,1,1,2,1,1},
+		{4,5,1,2,1,1,1,2}, {4,4,2,1,2,1,1,2}, {4,5,1,2,1,2,1,1}, {4,4,2,1,2,2,1,1},
+		{3,5,1,2,2,1,1,2}, {3,4,2,1,3,1,1,2}, {3,5,1,2,2,2,1,1}, {3,4,2,1,3,2,1,1},
+		{2,5,1,2,3,1,1,2}, {2,4,2,1,4,1,1,2}, {2,5,1,2,3,2,1,1}, {2,4,2,1,4,2,1,1},
+		{1,5,1,2,4,1,1,2}, {1,4,2,1,5,1,1,2}, {1,5,1,2,4,2,1,1}, {1,4,2,1,5,2,1,1},
+		{6,3,3,1,1,1,1,1}, {1,3,3,1,1,1,5,2}, {1,3,3,1,1,2,5,1}, {5,4,2,2,1,1,1,1},
+		{5,3,3,1,2,1,1,1}, {4,5,1,3,1,1,1,1}, {4,4,2,2,2,1,1,1}, {4,3,3,1,3,1,1,1},
+		{3,5,1,3,2,1,1,1}, {3,4,2,2,3,1,1,1}, {3,3,3,1,4,1,1,1}, {2,5,1,3,3,1,1,1},
+		{2,4,2,2,4,1,1,1}, {2,3,3,1,5,1,1,1}, {1,5,1,3,4,1,1,1}, {1,4,2,2,5,1,1,1},
+		{1,3,3,1,6,1,1,1}, {1,2,4,1,1,1,4,3}, {2,2,4,1,1,1,5,1}, {1,2,4,1,1,2,4,2},
+		{1,2,4,1,1,3,4,1}, {1,3,3,2,1,1,5,1}, {1,2,4,1,2,1,5,1}, {1,1,5,1,1,1,3,4},
+		{2,1,5,1,1,1,4,2}, {1,1,5,1,1,2,3,3}, {2,1,5,1,1,2,4,1}, {1,1,5,1,1,3,3,2},
+		{1,1,5,1,1,4,3,1}, {1,2,4,2,1,1,4,2}, {1,1,5,1,2,1,4,2}, {1,2,4,2,1,2,4,1},
+		{1,1,5,1,2,2,4,1}, {1,1,5,2,1,1,3,3}, {2,1,5,2,1,1,4,1}, {1,1,5,2,1,2,3,2},
+		{1,1,5,2,1,3,3,1}, {1,2,4,3,1,1,4,1}, {1,1,5,2,2,1,4,1}, {1,1,5,3,1,1,3,2},
+		{1,1,5,3,1,2,3,1}, {1,1,5,4,1,1,3,1}, {3,6,1,1,2,1,1,2}, {3,6,1,1,2,2,1,1},
+		{2,6,1,1,3,1,1,2}, {2,6,1,1,3,2,1,1}, {1,6,1,1,4,1,1,2}, {1,6,1,1,4,2,1,1},
+		{4,5,2,1,2,1,1,1}, {3,6,1,2,2,1,1,1}, {3,5,2,1,3,1,1,1}, {2,6,1,2,3,1,1,1},
+		{2,5,2,1,4,1,1,1}, {1,6,1,2,4,1,1,1}, {1,5,2,1,5,1,1,1}, {1,4,3,1,1,1,5,1},
+		{1,3,4,1,1,1,4,2}, {1,3,4,1,1,2,4,1}, {1,2,5,1,1,1,3,3}, {2,2,5,1,1,1,4,1},
+		{1,2,5,1,1,2,3,2}, {1,2,5,1,1,3,3,1}, {1,3,4,2,1,1,4,1}, {1,2,5,1,2,1,4,1},
+		{1,1,6,1,1,1,2,4}, {2,1,6,1,1,1,3,2}, {1,1,6,1,1,2,2,3}, {2,1,6,1,1,2,3,1},
+		{1,1,6,1,1,3,2,2}, {1,1,6,1,1,4,2,1}, {1,2,5,2,1,1,3,2}, {1,1,6,1,2,1,3,2},
+		{1,2,5,2,1,2,3,1}, {1,1,6,1,2,2,3,1}, {1,1,6,2,1,1,2,3}, {2,1,6,2,1,1,3,1},
+		{1,1,6,2,1,2,2,2}, {1,1,6,2,1,3,2,1}, {1,2,5,3,1,1,3,1}, {1,1,6,2,2,1,3,1},
+		{1,1,6,3,1,1,2,2}, {1,1,6,3,1,2,2,1}, {1,4,4,1,1,1,4,1}, {1,3,5,1,1,1,3,2},
+		{1,3,5,1,1,2,3,1}, {1,2,6,1,1,1,2,3}, {2,2,6,1,1,1,3,1}, {1,2,6,1,1,2,2,2},
+		{1,2,6,1,1,3,2,1}, {1,3,5,2,1,1,3,1}, {1,2,6,1,2,1,3,1}, {1,2,6,2,1,1,2,2},
+		{1,2,6,2,1,2,2,1}
+	},
+	{
+		{2,1,1,1,1,1,5,5}, {3,1,1,1,1,1,6,3}, {1,1,1,1,1,2,4,6}, {2,1,1,1,1,2,5,4},
+		{3,1,1,1,1,2,6,2}, {1,1,1,1,1,3,4,5}, {2,1,1,1,1,3,5,3}, {3,1,1,1,1,3,6,1},
+		{1,1,1,1,1,4,4,4}, {2,1,1,1,1,4,5,2}, {1,1,1,1,1,5,4,3}, {6,1,1,1,2,1,1,4},
+		{1,1,1,1,2,1,5,5}, {2,1,1,1,2,1,6,3}, {6,1,1,1,2,2,1,3}, {1,1,1,1,2,2,5,4},
+		{2,1,1,1,2,2,6,2}, {6,1,1,1,2,3,1,2}, {1,1,1,1,2,3,5,3}, {2,1,1,1,2,3,6,1},
+		{6,1,1,1,2,4,1,1}, {1,1,1,1,2,4,5,2}, {5,1,1,1,3,1,1,4}, {6,1,1,1,3,1,2,2},
+		{1,1,1,1,3,1,6,3}, {5,1,1,1,3,2,1,3}, {6,1,1,1,3,2,2,1}, {1,1,1,1,3,2,6,2},
+		{5,1,1,1,3,3,1,2}, {1,1,1,1,3,3,6,1}, {5,1,1,1,3,4,1,1}, {4,1,1,1,4,1,1,4},
+		{5,1,1,1,4,1,2,2}, {4,1,1,1,4,2,1,3}, {5,1,1,1,4,2,2,1}, {4,1,1,1,4,3,1,2},
+		{4,1,1,1,4,4,1,1}, {3,1,1,1,5,1,1,4}, {4,1,1,1,5,1,2,2}, {3,1,1,1,5,2,1,3},
+		{4,1,1,1,5,2,2,1}, {3,1,1,1,5,3,1,2}, {3,1,1,1,5,4,1,1}, {2,1,1,1,6,1,1,4},
+		{3,1,1,1,6,1,2,2}, {2,1,1,1,6,2,1,3}, {3,1,1,1,6,2,2,1}, {2,1,1,1,6,3,1,2},
+		{1,1,1,2,1,1,4,6}, {2,1,1,2,1,1,5,4}, {3,1,1,2,1,1,6,2}, {1,1,1,2,1,2,4,5},
+		{2,1,1,2,1,2,5,3}, {3,1,1,2,1,2,6,1}, {1,1,1,2,1,3,4,4}, {2,1,1,2,1,3,5,2},
+		{1,1,1,2,1,4,4,3}, {2,1,1,2,1,4,5,1}, {1,1,1,2,1,5,4,2}, {6,1,1,2,2,1,1,3},
+		{1,1,1,2,2,1,5,4}, {2,1,1,2,2,1,6,2}, {6,1,1,2,2,2,1,2}, {1,1,1,2,2,2,5,3},
+		{2,1,1,2,2,2,6,1}, {6,1,1,2,2,3,1,1}, {1,1,1,2,2,3,5,2}, {1,1,1,2,2,4,5,1},
+		{5,1,1,2,3,1,1,3}, {6,1,1,2,3,1,2,1}, {1,1,1,2,3,1,6,2}, {5,1,1,2,3,2,1,2},
+		{1,1,1,2,3,2,6,1}, {5,1,1,2,3,3,1,1}, {4,1,1,2,4,1,1,3}, {5,1,1,2,4,1,2,1},
+		{4,1,1,2,4,2,1,2}, {4,1,1,2,4,3,1,1}, {3,1,1,2,5,1,1,3}, {4,1,1,2,5,1,2,1},
+		{3,1,1,2,5,2,1,2}, {3,1,1,2,5,3,1,1}, {2,1,1,2,6,1,1,3}, {3,1,1,2,6,1,2,1},
+		{2,1,1,2,6,2,1,2}, {2,1,1,2,6,3,1,1}, {1,1,1,3,1,1,4,5}, {2,1,1,3,1,1,5,3},
+		{3,1,1,3,1,1,6,1}, {1,1,1,3,1,2,4,4}, {2,1,1,3,1,2,5,2}, {1,1,1,3,1,3,4,3},
+		{2,1,1,3,1,3,5,1}, {1,1,1,3,1,4,4,2}, {1,1,1,3,1,5,4,1}, {6,1,1,3,2,1,1,2},
+		{1,1,1,3,2,1,5,3}, {2,1,1,3,2,1,6,1}, {6,1,1,3,2,2,1,1}, {1,1,1,3,2,2,5,2},
+		{1,1,1,3,2,3,5,1}, {5,1,1,3,3,1,1,2}, {1,1,1,3,3,1,6,1}, {5,1,1,3,3,2,1,1},
+		{4,1,1,3,4,1,1,2}, {4,1,1,3,4,2,1,1}, {3,1,1,3,5,1,1,2}, {3,1,1,3,5,2,1,1},
+		{2,1,1,3,6,1,1,2}, {2,1,1,3,6,2,1,1}, {1,1,1,4,1,1,4,4}, {2,1,1,4,1,1,5,2},
+		{1,1,1,4,1,2,4,3}, {2,1,1,4,1,2,5,1}, {1,1,1,4,1,3,4,2}, {1,1,1,4,1,4,4,1},
+		{6,1,1,4,2,1,1,1}, {1,1,1,4,2,1,5,2}, {1,1,1,4,2,2,5,1}, {5,1,1,4,3,1,1,1},
+		{4,1,1,4,4,1,1,1}, {3,1,1,4,5,1,1,1}, {1,1,1,5,1,1,4,3}, {2,1,1,5,1,1,5,1},
+		{1,1,1,5,1,2,4,2}, {1,1,1,5,1,3,4,1}, {1,1,1,5,2,1,5,1}, {1,1,1,6,1,1,4,2},
+		{1,1,1,6,1,2,4,1}, {1,2,1,1,1,1,4,6}, {2,2,1,1,1,1,5,4}, {3,2,1,1,1,1,6,2},
+		{1,2,1,1,1,2,4,5}, {2,2,1,1,1,2,5,3}, {3,2,1,1,1,2,6,1}, {1,2,1,1,1,3,4,4},
+		{2,2,1,1,1,3,5,2}, {1,2,1,1,1,4,4,3}, {2,2,1,1,1,4,5,1}, {1,2,1,1,1,5,4,2},
+		{6,2,1,1,2,1,1,3}, {1,2,1,1,2,1,5,4}, {2,2,1,1,2,1,6,2}, {6,2,1,1,2,2,1,2},
+		{1,2,1,1,2,2,5,3}, {2,2,1,1,2,2,6,1}, {6,2,1,1,2,3,1,1}, {1,2,1,1,2,3,5,2},
+		{1,2,1,1,2,4,5,1}, {5,2,1,1,3,1,1,3}, {6,2,1,1,3,1,2,1}, {1,2,1,1,3,1,6,2},
+		{5,2,1,1,3,2,1,2}, {1,2,1,1,3,2,6,1}, {5,2,1,1,3,3,1,1}, {4,2,1,1,4,1,1,3},
+		{5,2,1,1,4,1,2,1}, {4,2,1,1,4,2,1,2}, {4,2,1,1,4,3,1,1}, {3,2,1,1,5,1,1,3},
+		{4,2,1,1,5,1,2,1}, {3,2,1,1,5,2,1,2}, {3,2,1,1,5,3,1,1}, {2,2,1,1,6,1,1,3},
+		{3,2,1,1,6,1,2,1}, {2,2,1,1,6,2,1,2}, {2,2,1,1,6,3,1,1}, {2,1,2,1,1,1,4,5},
+		{3,1,2,1,1,1,5,3}, {4,1,2,1,1,1,6,1}, {1,1,2,1,1,2,3,6}, {2,1,2,1,1,2,4,4},
+		{3,1,2,1,1,2,5,2}, {1,1,2,1,1,3,3,5}, {2,1,2,1,1,3,4,3}, {3,1,2,1,1,3,5,1},
+		{1,1,2,1,1,4,3,4}, {2,1,2,1,1,4,4,2}, {1,1,2,1,1,5,3,3}, {2,1,2,1,1,5,4,1},
+		{1,1,2,1,1,6,3,2}, {1,2,1,2,1,1,4,5}, {2,2,1,2,1,1,5,3}, {3,2,1,2,1,1,6,1},
+		{1,1,2,1,2,1,4,5}, {1,2,1,2,1,2,4,4}, {2,2,1,2,1,2,5,2}, {1,1,2,1,2,2,4,4},
+		{2,1,2,1,2,2,5,2}, {2,2,1,2,1,3,5,1}, {1,1,2,1,2,3,4,3}, {1,2,1,2,1,4,4,2},
+		{1,1,2,1,2,4,4,2}, {1,2,1,2,1,5,4,1}, {1,1,2,1,2,5,4,1}, {6,2,1,2,2,1,1,2},
+		{1,2,1,2,2,1,5,3}, {2,2,1,2,2,1,6,1}, {6,1,2,1,3,1,1,2}, {6,2,1,2,2,2,1,1},
+		{1,1,2,1,3,1,5,3}, {1,2,1,2,2,2,5,2}, {6,1,2,1,3,2,1,1}, {1,1,2,1,3,2,5,2},
+		{1,2,1,2,2,3,5,1}, {1,1,2,1,3,3,5,1}, {5,2,1,2,3,1,1,2}, {1,2,1,2,3,1,6,1},
+		{5,1,2,1,4,1,1,2}, {5,2,1,2,3,2,1,1}, {1,1,2,1,4,1,6,1}, {5,1,2,1,4,2,1,1},
+		{4,2,1,2,4,1,1,2}, {4,1,2,1,5,1,1,2}, {4,2,1,2,4,2,1,1}, {4,1,2,1,5,2,1,1},
+		{3,2,1,2,5,1,1,2}, {3,1,2,1,6,1,1,2}, {3,2,1,2,5,2,1,1}, {3,1,2,1,6,2,1,1},
+		{2,2,1,2,6,1,1,2}, {2,2,1,2,6,2,1,1}, {1,1,2,2,1,1,3,6}, {2,1,2,2,1,1,4,4},
+		{3,1,2,2,1,1,5,2}, {1,1,2,2,1,2,3,5}, {2,1,2,2,1,2,4,3}, {3,1,2,2,1,2,5,1},
+		{1,1,2,2,1,3,3,4}, {2,1,2,2,1,3,4,2}, {1,1,2,2,1,4,3,3}, {2,1,2,2,1,4,4,1},
+		{1,1,2,2,1,5,3,2}, {1,1,2,2,1,6,3,1}, {1,2,1,3,1,1,4,4}, {2,2,1,3,1,1,5,2},
+		{1,1,2,2,2,1,4,4}, {1,2,1,3,1,2,4,3}, {2,2,1,3,1,2,5,1}, {1,1,2,2,2,2,4,3},
+		{2,1,2,2,2,2,5,1}, {1,1,2,2,2,3,4,2}, {1,2,1,3,1,4,4,1}, {1,1,2,2,2,4,4,1},
+		{6,2,1,3,2,1,1,1}, {1,2,1,3,2,1,5,2}, {6,1,2,2,3,1,1,1}, {1,1,2,2,3,1,5,2},
+		{1,2,1,3,2,2,5,1}, {1,1,2,2,3,2,5,1}, {5,2,1,3,3,1,1,1}, {5,1,2,2,4,1,1,1},
+		{4,2,1,3,4,1,1,1}, {4,1,2,2,5,1,1,1}, {3,2,1,3,5,1,1,1}, {3,1,2,2,6,1,1,1},
+		{2,2,1,3,6,1,1,1}, {1,1,2,3,1,1,3,5}, {2,1,2,3,1,1,4,3}, {3,1,2,3,1,1,5,1},
+		{1,1,2,3,1,2,3,4}, {2,1,2,3,1,2,4,2}, {1,1,2,3,1,3,3,3}, {2,1,2,3,1,3,4,1},
+		{1,1,2,3,1,4,3,2}, {1,1,2,3,1,5,3,1}, {1,2,1,4,1,1,4,3}, {2,2,1,4,1,1,5,1},
+		{1,1,2,3,2,1,4,3}, {1,2,1,4,1,2,4,2}, {1,1,2,3,2,2,4,2}, {1,2,1,4,1,3,4,1},
+		{1,1,2,3,2,3,4,1}, {1,2,1,4,2,1,5,1}, {1,1,2,3,3,1,5,1}, {1,1,2,4,1,1,3,4},
+		{2,1,2,4,1,1,4,2}, {1,1,2,4,1,2,3,3}, {2,1,2,4,1,2,4,1}, {1,1,2,4,1,3,3,2},
+		{1,1,2,4,1,4,3,1}, {1,2,1,5,1,1,4,2}, {1,1,2,4,2,1,4,2}, {1,2,1,5,1,2,4,1},
+		{1,1,2,4,2,2,4,1}, {1,1,2,5,1,1,3,3}, {2,1,2,5,1,1,4,1}, {1,1,2,5,1,2,3,2},
+		{1,1,2,5,1,3,3,1}, {1,2,1,6,1,1,4,1}, {1,1,2,5,2,1,4,1}, {1,1,2,6,1,1,3,2},
+		{1,1,2,6,1,2,3,1}, {1,3,1,1,1,1,4,5}, {2,3,1,1,1,1,5,3}, {3,3,1,1,1,1,6,1},
+		{1,3,1,1,1,2,4,4}, {2,3,1,1,1,2,5,2}, {1,3,1,1,1,3,4,3}, {2,3,1,1,1,3,5,1},
+		{1,3,1,1,1,4,4,2}, {1,3,1,1,1,5,4,1}, {6,3,1,1,2,1,1,2}, {1,3,1,1,2,1,5,3},
+		{2,3,1,1,2,1,6,1}, {6,3,1,1,2,2,1,1}, {1,3,1,1,2,2,5,2}, {1,3,1,1,2,3,5,1},
+		{5,3,1,1,3,1,1,2}, {1,3,1,1,3,1,6,1}, {5,3,1,1,3,2,1,1}, {4,3,1,1,4,1,1,2},
+		{4,3,1,1,4,2,1,1}, {3,3,1,1,5,1,1,2}, {3,3,1,1,5,2,1,1}, {2,3,1,1,6,1,1,2},
+		{2,3,1,1,6,2,1,1}, {1,2,2,1,1,1,3,6}, {2,2,2,1,1,1,4,4}, {3,2,2,1,1,1,5,2},
+		{1,2,2,1,1,2,3,5}, {2,2,2,1,1,2,4,3}, {3,2,2,1,1,2,5,1}, {1,2,2,1,1,3,3,4},
+		{2,2,2,1,1,3,4,2}, {1,2,2,1,1,4,3,3}, {2,2,2,1,1,4,4,1}, {1,2,2,1,1,5,3,2},
+		{1,2,2,1,1,6,3,1}, {1,3,1,2,1,1,4,4}, {2,3,1,2,1,1,5,2}, {1,2,2,1,2,1,4,4},
+		{1,3,1,2,1,2,4,3}, {2,3,1,2,1,2,5,1}, {1,2,2,1,2,2,4,3}, {2,2,2,1,2,2,5,1},
+		{1,2,2,1,2,3,4,2}, {1,3,1,2,1,4,4,1}, {1,2,2,1,2,4,4,1}, {6,3,1,2,2,1,1,1},
+		{1,3,1,2,2,1,5,2}, {6,2,2,1,3,1,1,1}, {1,2,2,1,3,1,5,2}, {1,3,1,2,2,2,5,1},
+		{1,2,2,1,3,2,5,1}, {5,3,1,2,3,1,1,1}, {5,2,2,1,4,1,1,1}, {4,3,1,2,4,1,1,1},
+		{4,2,2,1,5,1,1,1}, {3,3,1,2,5,1,1,1}, {3,2,2,1,6,1,1,1}, {2,3,1,2,6,1,1,1},
+		{2,1,3,1,1,1,3,5}, {3,1,3,1,1,1,4,3}, {4,1,3,1,1,1,5,1}, {1,1,3,1,1,2,2,6},
+		{2,1,3,1,1,2,3,4}, {3,1,3,1,1,2,4,2}, {1,1,3,1,1,3,2,5}, {2,1,3,1,1,3,3,3},
+		{3,1,3,1,1,3,4,1}, {1,1,3,1,1,4,2,4}, {2,1,3,1,1,4,3,2}, {1,1,3,1,1,5,2,3},
+		{2,1,3,1,1,5,3,1}, {1,1,3,1,1,6,2,2}, {1,2,2,2,1,1,3,5}, {2,2,2,2,1,1,4,3},
+		{3,2,2,2,1,1,5,1}, {1,1,3,1,2,1,3,5}, {1,2,2,2,1,2,3,4}, {2,2,2,2,1,2,4,2},
+		{1,1,3,1,2,2,3,4}, {2,1,3,1,2,2,4,2}, {2,2,2,2,1,3,4,1}, {1,1,3,1,2,3,3,3},
+		{1,2,2,2,1,4,3,2}, {1,1,3,1,2,4,3,2}, {1,2,2,2,1,5,3,1}, {1,1,3,1,2,5,3,1},
+		{1,3,1,3,1,1,4,3}, {2,3,1,3,1,1,5,1}, {1,2,2,2,2,1,4,3}, {1,3,1,3,1,2,4,2},
+		{1,1,3,1,3,1,4,3}, {1,2,2,2,2,2,4,2}, {1,3,1,3,1,3,4,1}, {1,1,3,1,3,2,4,2},
+		{1,2,2,2,2,3,4,1}, {1,1,3,1,3,3,4,1}, {1,3,1,3,2,1,5,1}, {1,2,2,2,3,1,5,1},
+		{1,1,3,1,4,1,5,1}, {1,1,3,2,1,1,2,6}, {2,1,3,2,1,1,3,4}, {3,1,3,2,1,1,4,2},
+		{1,1,3,2,1,2,2,5}, {2,1,3,2,1,2,3,3}, {3,1,3,2,1,2,4,1}, {1,1,3,2,1,3,2,4},
+		{2,1,3,2,1,3,3,2}, {1,1,3,2,1,4,2,3}, {2,1,3,2,1,4,3,1}, {1,1,3,2,1,5,2,2},
+		{1,1,3,2,1,6,2,1}, {1,2,2,3,1,1,3,4}, {2,2,2,3,1,1,4,2}, {1,1,3,2,2,1,3,4},
+		{1,2,2,3,1,2,3,3}, {2,2,2,3,1,2,4,1}, {1,1,3,2,2,2,3,3}, {2,1,3,2,2,2,4,1},
+		{1,1,3,2,2,3,3,2}, {1,2,2,3,1,4,3,1}, {1,1,3,2,2,4,3,1}, {1,3,1,4,1,1,4,2},
+		{1,2,2,3,2,1,4,2}, {1,3,1,4,1,2,4,1}, {1,1,3,2,3,1,4,2}, {1,2,2,3,2,2,4,1},
+		{1,1,3,2,3,2,4,1}, {1,1,3,3,1,1,2,5}, {2,1,3,3,1,1,3,3}, {3,1,3,3,1,1,4,1},
+		{1,1,3,3,1,2,2,4}, {2,1,3,3,1,2,3,2}, {1,1,3,3,1,3,2,3}, {2,1,3,3,1,3,3,1},
+		{1,1,3,3,1,4,2,2}, {1,1,3,3,1,5,2,1}, {1,2,2,4,1,1,3,3}, {2,2,2,4,1,1,4,1},
+		{1,1,3,3,2,1,3,3}, {1,2,2,4,1,2,3,2}, {1,1,3,3,2,2,3,2}, {1,2,2,4,1,3,3,1},
+		{1,1,3,3,2,3,3,1}, {1,3,1,5,1,1,4,1}, {1,2,2,4,2,1,4,1}, {1,1,3,3,3,1,4,1},
+		{1,1,3,4,1,1,2,4}, {2,1,3,4,1,1,3,2}, {1,1,3,4,1,2,2,3}, {2,1,3,4,1,2,3,1},
+		{1,1,3,4,1,3,2,2}, {1,1,3,4,1,4,2,1}, {1,2,2,5,1,1,3,2}, {1,1,3,4,2,1,3,2},
+		{1,2,2,5,1,2,3,1}, {1,1,3,4,2,2,3,1}, {1,1,3,5,1,1,2,3}, {2,1,3,5,1,1,3,1},
+		{1,1,3,5,1,2,2,2}, {1,1,3,5,1,3,2,1}, {1,2,2,6,1,1,3,1}, {1,1,3,5,2,1,3,1},
+		{1,1,3,6,1,1,2,2}, {1,1,3,6,1,2,2,1}, {1,4,1,1,1,1,4,4}, {2,4,1,1,1,1,5,2},
+		{1,4,1,1,1,2,4,3}, {2,4,1,1,1,2,5,1}, {1,4,1,1,1,3,4,2}, {1,4,1,1,1,4,4,1},
+		{1,4,1,1,2,1,5,2}, {1,4,1,1,2,2,5,1}, {5,4,1,1,3,1,1,1}, {4,4,1,1,4,1,1,1},
+		{3,4,1,1,5,1,1,1}, {2,4,1,1,6,1,1,1}, {1,3,2,1,1,1,3,5}, {2,3,2,1,1,1,4,3},
+		{3,3,2,1,1,1,5,1}, {1,3,2,1,1,2,3,4}, {2,3,2,1,1,2,4,2}, {1,3,2,1,1,3,3,3},
+		{2,3,2,1,1,3,4,1}, {1,3,2,1,1,4,3,2}, {1,3,2,1,1,5,3,1}, {1,4,1,2,1,1,4,3},
+		{2,4,1,2,1,1,5,1}, {1,3,2,1,2,1,4,3}, {1,4,1,2,1,2,4,2}, {1,3,2,1,2,2,4,2},
+		{1,4,1,2,1,3,4,1}, {1,3,2,1,2,3,4,1}, {1,4,1,2,2,1,5,1}, {1,3,2,1,3,1,5,1},
+		{1,2,3,1,1,1,2,6}, {2,2,3,1,1,1,3,4}, {3,2,3,1,1,1,4,2}, {1,2,3,1,1,2,2,5},
+		{2,2,3,1,1,2,3,3}, {3,2,3,1,1,2,4,1}, {1,2,3,1,1,3,2,4}, {2,2,3,1,1,3,3,2},
+		{1,2,3,1,1,4,2,3}, {2,2,3,1,1,4,3,1}, {1,2,3,1,1,5,2,2}, {1,2,3,1,1,6,2,1},
+		{1,3,2,2,1,1,3,4}, {2,3,2,2,1,1,4,2}, {1,2,3,1,2,1,3,4}, {1,3,2,2,1,2,3,3},
+		{2,3,2,2,1,2,4,1}, {1,2,3,1,2,2,3,3}, {1,3,2,2,1,3,3,2}, {1,2,3,1,2,3,3,2},
+		{1,3,2,2,1,4,3,1}, {1,2,3,1,2,4,3,1}, {1,4,1,3,1,1,4,2}, {1,3,2,2,2,1,4,2},
+		{1,4,1,3,1,2,4,1}, {1,2,3,1,3,1,4,2}, {1,3,2,2,2,2,4,1}, {1,2,3,1,3,2,4,1},
+		{2,1,4,1,1,1,2,5}, {3,1,4,1,1,1,3,3}, {4,1,4,1,1,1,4,1}, {1,1,4,1,1,2,1,6},
+		{2,1,4,1,1,2,2,4}, {3,1,4,1,1,2,3,2}, {1,1,4,1,1,3,1,5}, {2,1,4,1,1,3,2,3},
+		{3,1,4,1,1,3,3,1}, {1,1,4,1,1,4,1,4}, {2,1,4,1,1,4,2,2}, {1,1,4,1,1,5,1,3},
+		{2,1,4,1,1,5,2,1}, {1,1,4,1,1,6,1,2}, {1,2,3,2,1,1,2,5}, {2,2,3,2,1,1,3,3},
+		{3,2,3,2,1,1,4,1}, {1,1,4,1,2,1,2,5}, {1,2,3,2,1,2,2,4}, {2,2,3,2,1,2,3,2},
+		{1,1,4,1,2,2,2,4}, {2,1,4,1,2,2,3,2}, {2,2,3,2,1,3,3,1}, {1,1,4,1,2,3,2,3},
+		{1,2,3,2,1,4,2,2}, {1,1,4,1,2,4,2,2}, {1,2,3,2,1,5,2,1}, {1,1,4,1,2,5,2,1},
+		{1,3,2,3,1,1,3,3}, {2,3,2,3,1,1,4,1}, {1,2,3,2,2,1,3,3}, {1,3,2,3,1,2,3,2},
+		{1,1,4,1,3,1,3,3}, {1,2,3,2,2,2,3,2}, {1,3,2,3,1,3,3,1}, {1,1,4,1,3,2,3,2},
+		{1,2,3,2,2,3,3,1}, {1,1,4,1,3,3,3,1}, {1,4,1,4,1,1,4,1}, {1,3,2,3,2,1,4,1},
+		{1,2,3,2,3,1,4,1}, {1,1,4,1,4,1,4,1}, {1,1,4,2,1,1,1,6}, {2,1,4,2,1,1,2,4},
+		{3,1,4,2,1,1,3,2}, {1,1,4,2,1,2,1,5}, {2,1,4,2,1,2,2,3}, {3,1,4,2,1,2,3,1},
+		{1,1,4,2,1,3,1,4}, {2,1,4,2,1,3,2,2}, {1,1,4,2,1,4,1,3}, {2,1,4,2,1,4,2,1},
+		{1,1,4,2,1,5,1,2}, {1,1,4,2,1,6,1,1}, {1,2,3,3,1,1,2,4}, {2,2,3,3,1,1,3,2},
+		{1,1,4,2,2,1,2,4}, {1,2,3,3,1,2,2,3}, {2,2,3,3,1,2,3,1}, {1,1,4,2,2,2,2,3},
+		{2,1,4,2,2,2,3,1}, {1,1,4,2,2,3,2,2}, {1,2,3,3,1,4,2,1}, {1,1,4,2,2,4,2,1},
+		{1,3,2,4,1,1,3,2}, {1,2,3,3,2,1,3,2}, {1,3,2,4,1,2,3,1}, {1,1,4,2,3,1,3,2},
+		{1,2,3,3,2,2,3,1}, {1,1,4,2,3,2,3,1}, {1,1,4,3,1,1,1,5}, {2,1,4,3,1,1,2,3},
+		{3,1,4,3,1,1,3,1}, {1,1,4,3,1,2,1,4}, {2,1,4,3,1,2,2,2}, {1,1,4,3,1,3,1,3},
+		{2,1,4,3,1,3,2,1}, {1,1,4,3,1,4,1,2}, {1,1,4,3,1,5,1,1}, {1,2,3,4,1,1,2,3},
+		{2,2,3,4,1,1,3,1}, {1,1,4,3,2,1,2,3}, {1,2,3,4,1,2,2,2}, {1,1,4,3,2,2,2,2},
+		{1,2,3,4,1,3,2,1}, {1,1,4,3,2,3,2,1}, {1,3,2,5,1,1,3,1}, {1,2,3,4,2,1,3,1},
+		{1,1,4,3,3,1,3,1}, {1,1,4,4,1,1,1,4}, {2,1,4,4,1,1,2,2}, {1,1,4,4,1,2,1,3},
+		{2,1,4,4,1,2,2,1}, {1,1,4,4,1,3,1,2}, {1,1,4,4,1,4,1,1}, {1,2,3,5,1,1,2,2},
+		{1,1,4,4,2,1,2,2}, {1,2,3,5,1,2,2,1}, {1,1,4,4,2,2,2,1}, {1,1,4,5,1,1,1,3},
+		{2,1,4,5,1,1,2,1}, {1,1,4,5,1,2,1,2}, {1,1,4,5,1,3,1,1}, {1,2,3,6,1,1,2,1},
+		{1,1,4,5,2,1,2,1}, {1,5,1,1,1,1,4,3}, {2,5,1,1,1,1,5,1}, {1,5,1,1,1,2,4,2},
+		{1,5,1,1,1,3,4,1}, {1,5,1,1,2,1,5,1}, {1,4,2,1,1,1,3,4}, {2,4,2,1,1,1,4,2},
+		{1,4,2,1,1,2,3,3}, {2,4,2,1,1,2,4,1}, {1,4,2,1,1,3,3,2}, {1,4,2,1,1,4,3,1},
+		{1,5,1,2,1,1,4,2}, {1,4,2,1,2,1,4,2}, {1,5,1,2,1,2,4,1}, {1,4,2,1,2,2,4,1},
+		{1,3,3,1,1,1,2,5}, {2,3,3,1,1,1,3,3}, {3,3,3,1,1,1,4,1}, {1,3,3,1,1,2,2,4},
+		{2,3,3,1,1,2,3,2}, {1,3,3,1,1,3,2,3}, {2,3,3,1,1,3,3,1}, {1,3,3,1,1,4,2,2},
+		{1,3,3,1,1,5,2,1}, {1,4,2,2,1,1,3,3}, {2,4,2,2,1,1,4,1}, {1,3,3,1,2,1,3,3},
+		{1,4,2,2,1,2,3,2}, {1,3,3,1,2,2,3,2}, {1,4,2,2,1,3,3,1}, {1,3,3,1,2,3,3,1},
+		{1,5,1,3,1,1,4,1}, {1,4,2,2,2,1,4,1}, {1,3,3,1,3,1,4,1}, {1,2,4,1,1,1,1,6},
+		{2,2,4,1,1,1,2,4}, {3,2,4,1,1,1,3,2}, {1,2,4,1,1,2,1,5}, {2,2,4,1,1,2,2,3},
+		{3,2,4,1,1,2,3,1}, {1,2,4,1,1,3,1,4}, {2,2,4,1,1,3,2,2}, {1,2,4,1,1,4,1,3},
+		{2,2,4,1,1,4,2,1}, {1,2,4,1,1,5,1,2}, {1,2,4,1,1,6,1,1}, {1,3,3,2,1,1,2,4},
+		{2,3,3,2,1,1,3,2}, {1,2,4,1,2,1,2,4}, {1,3,3,2,1,2,2,3}, {2,3,3,2,1,2,3,1},
+		{1,2,4,1,2,2,2,3}, {2,2,4,1,2,2,3,1}, {1,2,4,1,2,3,2,2}, {1,3,3,2,1,4,2,1},
+		{1,2,4,1,2,4,2,1}, {1,4,2,3,1,1,3,2}, {1,3,3,2,2,1,3,2}, {1,4,2,3,1,2,3,1},
+		{1,2,4,1,3,1,3,2}, {1,3,3,2,2,2,3,1}, {1,2,4,1,3,2,3,1}, {2,1,5,1,1,1,1,5},
+		{3,1,5,1,1,1,2,3}, {4,1,5,1,1,1,3,1}, {2,1,5,1,1,2,1,4}, {3,1,5,1,1,2,2,2},
+		{2,1,5,1,1,3,1,3}, {3,1,5,1,1,3,2,1}, {2,1,5,1,1,4,1,2}, {2,1,5,1,1,5,1,1},
+		{1,2,4,2,1,1,1,5}, {2,2,4,2,1,1,2,3}, {3,2,4,2,1,1,3,1}, {1,1,5,1,2,1,1,5},
+		{1,2,4,2,1,2,1,4}, {2,2,4,2,1,2,2,2}, {1,1,5,1,2,2,1,4}, {2,1,5,1,2,2,2,2},
+		{2,2,4,2,1,3,2,1}, {1,1,5,1,2,3,1,3}, {1,2,4,2,1,4,1,2}, {1,1,5,1,2,4,1,2},
+		{1,2,4,2,1,5,1,1}, {1,1,5,1,2,5,1,1}, {1,3,3,3,1,1,2,3}, {2,3,3,3,1,1,3,1},
+		{1,2,4,2,2,1,2,3}, {1,3,3,3,1,2,2,2}, {1,1,5,1,3,1,2,3}, {1,2,4,2,2,2,2,2},
+		{1,3,3,3,1,3,2,1}, {1,1,5,1,3,2,2,2}, {1,2,4,2,2,3,2,1}, {1,1,5,1,3,3,2,1},
+		{1,4,2,4,1,1,3,1}, {1,3,3,3,2,1,3,1}, {1,2,4,2,3,1,3,1}, {1,1,5,1,4,1,3,1},
+		{2,1,5,2,1,1,1,4}, {3,1,5,2,1,1,2,2}, {2,1,5,2,1,2,1,3}, {3,1,5,2,1,2,2,1},
+		{2,1,5,2,1,3,1,2}, {2,1,5,2,1,4,1,1}, {1,2,4,3,1,1,1,4}, {2,2,4,3,1,1,2,2},
+		{1,1,5,2,2,1,1,4}, {1,2,4,3,1,2,1,3}, {2,2,4,3,1,2,2,1}, {1,1,5,2,2,2,1,3},
+		{2,1,5,2,2,2,2,1}, {1,1,5,2,2,3,1,2}, {1,2,4,3,1,4,1,1}, {1,1,5,2,2,4,1,1},
+		{1,3,3,4,1,1,2,2}, {1,2,4,3,2,1,2,2}, {1,3,3,4,1,2,2,1}, {1,1,5,2,3,1,2,2},
+		{1,2,4,3,2,2,2,1}, {1,1,5,2,3,2,2,1}, {2,1,5,3,1,1,1,3}, {3,1,5,3,1,1,2,1},
+		{2,1,5,3,1,2,1,2}, {2,1,5,3,1,3,1,1}, {1,2,4,4,1,1,1,3}, {2,2,4,4,1,1,2,1},
+		{1,1,5,3,2,1,1,3}, {1,2,4,4,1,2,1,2}, {1,1,5,3,2,2,1,2}, {1,2,4,4,1,3,1,1},
+		{1,1,5,3,2,3,1,1}, {1,3,3,5,1,1,2,1}, {1,2,4,4,2,1,2,1}, {1,1,5,3,3,1,2,1},
+		{2,1,5,4,1,1,1,2}, {2,1,5,4,1,2,1,1}, {1,2,4,5,1,1,1,2}, {1,1,5,4,2,1,1,2},
+		{1,2,4,5,1,2,1,1}, {1,1,5,4,2,2,1,1}, {1,6,1,1,1,1,4,2}, {1,6,1,1,1,2,4,1},
+		{1,5,2,1,1,1,3,3}, {2,5,2,1,1,1,4,1}, {1,5,2,1,1,2,3,2}, {1,5,2,1,1,3,3,1},
+		{1,6,1,2,1,1,4,1}, {1,5,2,1,2,1,4,1}, {1,4,3,1,1,1,2,4}, {2,4,3,1,1,1,3,2},
+		{1,4,3,1,1,2,2,3}, {2,4,3,1,1,2,3,1}, {1,4,3,1,1,3,2,2}, {1,4,3,1,1,4,2,1},
+		{1,5,2,2,1,1,3,2}, {1,4,3,1,2,1,3,2}, {1,5,2,2,1,2,3,1}, {1,4,3,1,2,2,3,1},
+		{1,3,4,1,1,1,1,5}, {2,3,4,1,1,1,2,3}, {3,3,4,1,1,1,3,1}, {1,3,4,1,1,2,1,4},
+		{2,3,4,1,1,2,2,2}, {1,3,4,1,1,3,1,3}, {2,3,4,1,1,3,2,1}, {1,3,4,1,1,4,1,2},
+		{1,3,4,1,1,5,1,1}, {1,4,3,2,1,1,2,3}, {2,4,3,2,1,1,3,1}, {1,3,4,1,2,1,2,3},
+		{2,3,4,1,2,1,3,1}, {1,3,4,1,2,2,2,2}, {1,4,3,2,1,3,2,1}, {1,3,4,1,2,3,2,1},
+		{1,5,2,3,1,1,3,1}, {1,4,3,2,2,1,3,1}, {1,3,4,1,3,1,3,1}, {2,2,5,1,1,1,1,4},
+		{3,2,5,1,1,1,2,2}, {2,2,5,1,1,2,1,3}, {3,2,5,1,1,2,2,1}, {2,2,5,1,1,3,1,2},
+		{2,2,5,1,1,4,1,1}, {1,3,4,2,1,1,1,4}, {2,3,4,2,1,1,2,2}, {1,2,5,1,2,1,1,4},
+		{2,2,5,1,2,1,2,2}, {2,3,4,2,1,2,2,1}, {1,2,5,1,2,2,1,3}, {1,3,4,2,1,3,1,2},
+		{1,2,5,1,2,3,1,2}, {1,3,4,2,1,4,1,1}, {1,2,5,1,2,4,1,1}, {1,4,3,3,1,1,2,2},
+		{1,3,4,2,2,1,2,2}, {1,4,3,3,1,2,2,1}, {1,2,5,1,3,1,2,2}, {1,3,4,2,2,2,2,1},
+		{1,2,5,1,3,2,2,1}, {3,1,6,1,1,1,1,3}, {4,1,6,1,1,1,2,1}, {3,1,6,1,1,2,1,2},
+		{3,1,6,1,1,3,1,1}, {2,2,5,2,1,1,1,3}, {3,2,5,2,1,1,2,1}, {2,1,6,1,2,1,1,3},
+		{2,2,5,2,1,2,1,2}, {2,1,6,1,2,2,1,2}, {2,2,5,2,1,3,1,1}, {2,1,6,1,2,3,1,1},
+		{1,3,4,3,1,1,1,3}, {2,3,4,3,1,1,2,1}, {1,2,5,2,2,1,1,3}, {1,3,4,3,1,2,1,2},
+		{1,1,6,1,3,1,1,3}, {1,2,5,2,2,2,1,2}, {1,3,4,3,1,3,1,1}, {1,1,6,1,3,2,1,2},
+		{1,2,5,2,2,3,1,1}, {1,1,6,1,3,3,1,1}, {1,4,3,4,1,1,2,1}, {1,3,4,3,2,1,2,1},
+		{1,2,5,2,3,1,2,1}, {1,1,6,1,4,1,2,1}, {3,1,6,2,1,1,1,2}, {3,1,6,2,1,2,1,1},
+		{2,2,5,3,1,1,1,2}, {2,1,6,2,2,1,1,2}, {2,2,5,3,1,2,1,1}, {2,1,6,2,2,2,1,1},
+		{1,3,4,4,1,1,1,2}, {1,2,5,3,2,1,1,2}, {1,3,4,4,1,2,1,1}, {1,1,6,2,3,1,1,2},
+		{1,2,5,3,2,2,1,1}, {1,1,6,2,3,2,1,1}, {3,1,6,3,1,1,1,1}, {2,2,5,4,1,1,1,1},
+		{2,1,6,3,2,1,1,1}, {1,3,4,5,1,1,1,1}, {1,2,5,4,2,1,1,1}, {1,1,6,3,3,1,1,1},
+		{1,6,2,1,1,1,3,2}, {1,6,2,1,1,2,3,1}, {1,5,3,1,1,1,2,3}, {2,5,3,1,1,1,3,1},
+		{1,5,3,1,1,2,2,2}, {1,5,3,1,1,3,2,1}, {1,6,2,2,1,1,3,1}, {1,5,3,1,2,1,3,1},
+		{1,4,4,1,1,1,1,4}, {2,4,4,1,1,1,2,2}, {1,4,4,1,1,2,1,3}, {2,4,4,1,1,2,2,1},
+		{1,4,4,1,1,3,1,2}, {1,4,4,1,1,4,1,1}, {1,5,3,2,1,1,2,2}, {1,4,4,1,2,1,2,2},
+		{1,5,3,2,1,2,2,1}, {1,4,4,1,2,2,2,1}, {2,3,5,1,1,1,1,3}, {3,3,5,1,1,1,2,1},
+		{2,3,5,1,1,2,1,2}, {2,3,5,1,1,3,1,1}, {1,4,4,2,1,1,1,3}, {2,4,4,2,1,1,2,1},
+		{1,3,5,1,2,1,1,3}, {2,3,5,1,2,1,2,1}, {1,3,5,1,2,2,1,2}, {1,4,4,2,1,3,1,1},
+		{1,3,5,1,2,3,1,1}, {1,5,3,3,1,1,2,1}, {1,4,4,2,2,1,2,1}, {1,3,5,1,3,1,2,1},
+		{3,2,6,1,1,1,1,2}, {3,2,6,1,1,2,1,1}, {2,3,5,2,1,1,1,2}, {2,2,6,1,2,1,1,2},
+		{2,3,5,2,1,2,1,1}, {2,2,6,1,2,2,1,1}, {1,4,4,3,1,1,1,2}, {1,3,5,2,2,1,1,2},
+		{1,4,4,3,1,2,1,1}, {1,2,6,1,3,1,1,2}, {1,3,5,2,2,2,1,1}, {1,2,6,1,3,2,1,1},
+		{3,2,6,2,1,1,1,1}, {2,3,5,3,1,1,1,1}, {2,2,6,2,2,1,1,1}, {1,4,4,4,1,1,1,1},
+		{1,3,5,3,2,1,1,1}, {1,2,6,2,3,1,1,1}, {1,6,3,1,1,1,2,2}, {1,6,3,1,1,2,2,1},
+		{1,5,4,1,1,1,1,3}, {2,5,4,1,1,1,2,1}, {1,5,4,1,1,2,1,2}, {1,5,4,1,1,3,1,1},
+		{1,6,3,2,1,1,2,1}, {1,5,4,1,2,1,2,1}, {2,4,5,1,1,1,1,2}, {2,4,5,1,1,2,1,1},
+		{1,5,4,2,1,1,1,2}, {1,4,5,1,2,1,1,2}, {1,5,4,2,1,2,1,1}, {1,4,5,1,2,2,1,1},
+		{3,3,6,1,1,1,1,1}
+	}
+};
+
+// CC row address widths, left/right and center, left to right
+const uint8_t gs1_ccRapWidths[2][52][6] = {
+	{
+		{2,2,1,3,1,1}, {3,1,1,3,1,1}, {3,1,2,2,1,1}, {2,2,2,2,1,1},
+		{2,1,3,2,1,1}, {2,1,4,1,1,1}, {2,2,3,1,1,1}, {3,1,3,1,1,1},
+		{3,2,2,1,1,1}, {4,1,2,1,1,1}, {4,2,1,1,1,1}, {3,3,1,1,1,1},
+		{2,4,1,1,1,1}, {2,3,2,1,1,1}, {2,3,1,2,1,1}, {3,2,1,2,1,1},
+		{4,1,1,2,1,1}, {4,1,1,1,2,1}, {4,1,1,1,1,2}, {3,2,1,1,1,2},
+		{3,1,2,1,1,2}, {3,1,1,2,1,2}, {3,1,1,2,2,1}, {3,1,1,1,3,1},
+		{3,1,1,1,2,2}, {3,1,1,1,1,3}, {2,2,1,1,1,3}, {2,2,1,1,2,2},
+		{2,2,1,1,3,1}, {2,2,1,2,2,1}, {2,2,2,1,2,1}, {3,1,2,1,2,1},
+		{3,2,1,1,2,1}, {2,3,1,1,2,1}, {2,3,1,1,1,2}, {2,2,2,1,1,2},
+		{2,1,3,1,1,2}, {2,1,2,2,1,2}, {2,1,2,2,2,1}, {2,1,2,1,3,1},
+		{2,1,2,1,2,2}, {2,1,2,1,1,3}, {2,1,1,2,1,3}, {2,1,1,1,2,3},
+		{2,1,1,1,3,2}, {2,1,1,1,4,1}, {2,1,1,2,3,1}, {2,1,1,2,2,2},
+		{2,1,1,3,1,2}, {2,1,1,3,2,1}, {2,1,1,4,1,1}, {2,1,2,3,1,1}
+	},
+	{
+		{1,1,2,2,3,1}, {1,2,1,2,3,1}, {1,2,2,1,3,1}, {1,3,1,1,3,1},
+		{1,3,1,2,2,1}, {1,3,2,1,2,1}, {1,4,1,1,2,1}, {1,4,1,2,1,1},
+		{1,4,2,1,1,1}, {1,3,3,1,1,1}, {1,3,2,2,1,1}, {1,3,1,3,1,1},
+		{1,2,2,3,1,1}, {1,2,3,2,1,1}, {1,2,4,1,1,1}, {1,1,5,1,1,1},
+		{1,1,4,2,1,1}, {1,1,4,1,2,1}, {1,2,3,1,2,1}, {1,2,3,1,1,2},
+		{1,2,2,2,1,2}, {1,2,2,2,2,1}, {1,2,1,3,2,1}, {1,2,1,4,1,1},
+		{1,1,2,4,1,1}, {1,1,3,3,1,1}, {1,1,3,2,2,1}, {1,1,3,2,1,2},
+		{1,1,3,1,2,2}, {1,2,2,1,2,2}, {1,3,1,1,2,2}, {1,3,1,1,1,3},
+		{1,2,2,1,1,3}, {1,1,3,1,1,3}, {1,1,2,2,1,3}, {1,1,2,2,2,2},
+		{1,1,2,3,1,2}, {1,1,2,3,2,1}, {1,1,1,4,2,1}, {1,1,1,3,3,1},
+		{1,1,1,3,2,2}, {1,1,1,2,3,2}, {1,1,1,2,2,3}, {1,1,1,1,3,3},
+		{1,1,1,1,2,4}, {1,1,1,2,1,4}, {1,1,2,1,1,4}, {1,2,1,1,1,4},
+		{1,2,1,1,2,3}, {1,2,1,1,3,2}, {1,1,2,1,3,2}, {1,1,2,1,4,1}
+	}
+};
@@ -0,0 +1,40 @@
+/**
+ * GS1 barcode encoder application
+ *
+ * @author Copyright (c) 2000-2020 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef TABLES_H
+#define TABLES_H
+
+#include <stdint.h>
+
+#include "enc-private.h"
+
+/*
+ * Lookup tables generated into tables.c by gentables, from value to the full
+ * element pattern. Run "make tables" to regenerate and "make check" to test.
+ */
+extern const uint8_t gs1_rss14Outside[RSS14_OUTSIDE_VALS][8];
+extern const uint8_t gs1_rss14Inside[RSS14_INSIDE_VALS][8];
+extern const uint8_t gs1_rssExpChars[RSSEXP_CHAR_VALS][RSSEXP_CHAR_PAT];
+extern const uint32_t gs1_rssLimSets[RSSLIM_WIDTH_SETS];
+extern const uint16_t gs1_pwr928[69][7];
+extern const uint8_t gs1_ccBarWidths[3][929][8];
+extern const uint8_t gs1_ccRapWidths[2][52][6];
+
+#endif /* TABLES_H */
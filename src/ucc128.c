@@ -266,12 +266,13 @@ static void cdc128(uint8_t data[], int *di, int symchr[], int *si, int *code)
  *
  * data    uchar[]  string of ASCII data to be encoded with 0200 for
  *				 NUL and 0201-0204 for FNC1-FNC4
+ * len     int      length of data
  * bars    int[]    array of bar/space widths to be filled, 0 term.
  *
  * Function Return:    number of symbol characters
  *
  */
-static int enc128(uint8_t data[], uint8_t bars[], int link)
+static int enc128(uint8_t data[], int len, uint8_t bars[], int link)
 {
 	/* convert ASCII data[] into symchr[] values */
 
@@ -280,7 +281,7 @@ static int enc128(uint8_t data[], uint8_t bars[], int link)
 	int symchr[UCC128_SYMMAX+1];
 	long ckchr;
 
-	for (i = 0; i < (int)strlen((char*)data); i++) {
+	for (i = 0; i < len; i++) {
 		if (data[i] == '#') {
 			data[i] = 0201; // convert FNC1 to 201 octal for enc128
 		}
@@ -368,16 +369,12 @@ void gs1_U128A(gs1_encoder *ctx) {
 	int rows, ccFlag, symChars, symWidth, ccLpad, ccRpad;
 	char primaryStr[120+1];
 	char *ccStr;
+	int primaryLen, ccLen;
 
-	ccStr = strchr(ctx->dataStr, '|');
-	if (ccStr == NULL) ccFlag = false;
-	else {
-		ccFlag = true;
-		ccStr[0] = '\0'; // separate primary data
-		ccStr++; // point to secondary data
-	}
+	ccStr = gs1_splitCC(ctx, &primaryLen, &ccLen);
+	ccFlag = (ccStr != NULL);
 
-	if (strlen(ctx->dataStr) > 48) {
+	if (primaryLen > 48) {
 		strcpy(ctx->errMsg, "primary data exceeds 48 characters");
 		ctx->errFlag = true;
 		return;
@@ -386,13 +383,18 @@ void gs1_U128A(gs1_encoder *ctx) {
 	// insert leading FNC1 if not already there
 	if (ctx->dataStr[0] != '#') {
 		strcpy(primaryStr, "#");
+		primaryLen++;
 	}
 	else {
 		primaryStr[0] = '\0';
 	}
 	strcat(primaryStr, ctx->dataStr);
 
-	symChars = enc128((uint8_t*)primaryStr, linPattern, (ccFlag) ? 1 : 0);
+	symChars = gs1_driverLinGet(ctx, primaryStr, primaryLen, (ccFlag) ? 1 : 0, linPattern, sizeof(linPattern));
+	if (!symChars) {
+		symChars = enc128((uint8_t*)primaryStr, primaryLen, linPattern, (ccFlag) ? 1 : 0);
+		gs1_driverLinPut(ctx, linPattern, sizeof(linPattern), symChars);
+	}
 
 #if PRNT
 	printf("\n%s", primaryStr);
@@ -403,18 +405,17 @@ void gs1_U128A(gs1_encoder *ctx) {
 	printf("\n");
 #endif
 
-	ctx->line1 = true; // so first line is not Y undercut
 	// init most likely prints values
 	prints.elmCnt = symChars*6+3;
 	prints.pattern = linPattern;
 	prints.guards = false;
-	prints.height = ctx->pixMult*ctx->linHeight;
+	prints.height = ctx->driver_pixMult*ctx->linHeight;
 	prints.leftPad = 0;
 	prints.rightPad = 0;
 	prints.whtFirst = true;
 	prints.reverse = false;
 	if (ccFlag) {
-		if (!((rows = gs1_CC4enc(ctx, (uint8_t*)ccStr, ccPattern)) > 0) || ctx->errFlag) return;
+		if (!((rows = gs1_CC4enc(ctx, (uint8_t*)ccStr, ccLen, ccPattern)) > 0) || ctx->errFlag) return;
 #if PRNT
 		{
 			int j;
@@ -439,144 +440,143 @@ void gs1_U128A(gs1_encoder *ctx) {
 		ccRpad = 10+2 + ((symChars-9)/2)*11;
 		ccLpad = symWidth - (CCB4_WIDTH + ccRpad);
 
-		if (ctx->bmp) {
-			// note: BMP is bottom to top inverted
-			gs1_bmpHeader(ctx->pixMult*symWidth,
-					ctx->pixMult*(rows*2+ctx->linHeight) + ctx->sepHt,
-						 ctx->outfp);
-
-			// UCC-128
-			gs1_printElmnts(ctx, &prints);
-
-			// CC separator pattern
-			prints.elmCnt = symChars*6+1;
-			prints.pattern = &linPattern[1];
-			prints.height = ctx->sepHt;
-			prints.leftPad = 10;
-			prints.rightPad = 10;
-			gs1_printElmnts(ctx, &prints);
-
-			// CC-C
-			prints.elmCnt = CCB4_ELMNTS;
-			prints.height = ctx->pixMult*2;
-			prints.leftPad = ccLpad;
-			prints.rightPad = ccRpad;
-			for (i = rows-1; i >= 0; i--) {
-				prints.pattern = ccPattern[i];
-				gs1_printElmnts(ctx, &prints);
-			}
+		gs1_driverInit(ctx, symWidth,
+				ctx->driver_pixMult*(rows*2+ctx->linHeight) + ctx->sepHt);
+
+		// CC-A/B
+		prints.elmCnt = CCB4_ELMNTS;
+		prints.height = ctx->driver_pixMult*2;
+		prints.leftPad = ccLpad;
+		prints.rightPad = ccRpad;
+		for (i = 0; i < rows; i++) {
+			prints.pattern = ccPattern[i];
+			gs1_driverAddCCRow(ctx, &prints);
 		}
-		else {
-			gs1_tifHeader(ctx->pixMult*symWidth,
-					ctx->pixMult*(rows*2+ctx->linHeight) + ctx->sepHt,
-						 ctx->outfp);
-
-			// CC-C
-			prints.elmCnt = CCB4_ELMNTS;
-			prints.height = ctx->pixMult*2;
-			prints.leftPad = ccLpad;
-			prints.rightPad = ccRpad;
-			for (i = 0; i < rows; i++) {
-				prints.pattern = ccPattern[i];
-				gs1_printElmnts(ctx, &prints);
-			}
 
-			// CC separator pattern
-			prints.elmCnt = symChars*6+1;
-			prints.pattern = &linPattern[1];
-			prints.height = ctx->sepHt;
-			prints.leftPad = 10;
-			prints.rightPad = 10;
-			gs1_printElmnts(ctx, &prints);
-
-			// UCC-128
-			prints.elmCnt = symChars*6+3;
-			prints.pattern = linPattern;
-			prints.height = ctx->pixMult*ctx->linHeight;
-			prints.leftPad = 0;
-			prints.rightPad = 0;
-			gs1_printElmnts(ctx, &prints);
-		}
-	}
-	else { // primary only
-		if (ctx->bmp) {
-			gs1_bmpHeader(ctx->pixMult*(symChars*11+22), ctx->pixMult*ctx->linHeight, ctx->outfp);
-		}
-		else {
-			gs1_tifHeader(ctx->pixMult*(symChars*11+22), ctx->pixMult*ctx->linHeight, ctx->outfp);
-		}
+		// CC separator pattern
+		prints.elmCnt = symChars*6+1;
+		prints.pattern = &linPattern[1];
+		prints.height = ctx->sepHt;
+		prints.leftPad = 10;
+		prints.rightPad = 10;
+		gs1_driverAddRow(ctx, &prints);
 
 		// UCC-128
-		gs1_printElmnts(ctx, &prints);
+		prints.elmCnt = symChars*6+3;
+		prints.pattern = linPattern;
+		prints.height = ctx->driver_pixMult*ctx->linHeight;
+		prints.leftPad = 0;
+		prints.rightPad = 0;
+	}
+	else { // primary only
+		gs1_driverInit(ctx, (symChars*11+22), ctx->driver_pixMult*ctx->linHeight);
 	}
-	return;
-}
 
+	// UCC-128
+	gs1_driverAddRow(ctx, &prints);
 
-void gs1_U128C(gs1_encoder *ctx) {
+	gs1_driverFinalise(ctx);
+	return;
+}
 
-	struct sPrints prints;
-	uint8_t *patCCC = ctx->ucc128_patCCC;
 
-	uint8_t linPattern[(UCC128_SYMMAX*6)+3];
+// encodes the primary and sets the CC-C starting colCnt from its width
+// returns the symbol character count or 0 if error
+static int U128Cprimary(gs1_encoder *ctx, uint8_t linPattern[], char **ccStr, int *ccLen) {
 
-	int i;
-	int ccFlag, symChars, symWidth, ccRpad;
+	int symChars, primaryLen;
 	char primaryStr[120+1];
-	char *ccStr;
 
-	ccStr = strchr(ctx->dataStr, '|');
-	if (ccStr == NULL) ccFlag = false;
-	else {
-		ccFlag = true;
-		ccStr[0] = '\0'; // separate primary data
-		ccStr++; // point to secondary data
-	}
+	*ccStr = gs1_splitCC(ctx, &primaryLen, ccLen);
 
-	if (strlen(ctx->dataStr) > 48) {
+	if (primaryLen > 48) {
 		strcpy(ctx->errMsg, "primary data exceeds 48 characters");
 		ctx->errFlag = true;
-		return;
+		return(0);
 	}
 
 	// insert leading FNC1 if not already there
 	if (ctx->dataStr[0] != '#') {
 		strcpy(primaryStr, "#");
+		primaryLen++;
 	}
 	else {
 		primaryStr[0] = '\0';
 	}
 	strcat(primaryStr, ctx->dataStr);
 
-	symChars = enc128((uint8_t*)primaryStr, linPattern, (ccFlag) ? 2 : 0); // 2 for CCC
+	symChars = gs1_driverLinGet(ctx, primaryStr, primaryLen, (*ccStr != NULL) ? 2 : 0, linPattern, (UCC128_SYMMAX*6)+3);
+	if (!symChars) {
+		symChars = enc128((uint8_t*)primaryStr, primaryLen, linPattern, (*ccStr != NULL) ? 2 : 0); // 2 for CCC
+		gs1_driverLinPut(ctx, linPattern, (UCC128_SYMMAX*6)+3, symChars);
+	}
 
 #if PRNT
-	printf("\n%s", primaryStr);
-	printf("\n");
-	for (i = 0; i < (symChars*6+3); i++) {
-		printf("%d", linPattern[i]);
+	{
+		int i;
+		printf("\n%s", primaryStr);
+		printf("\n");
+		for (i = 0; i < (symChars*6+3); i++) {
+			printf("%d", linPattern[i]);
+		}
+		printf("\n");
 	}
-	printf("\n");
 #endif
 
 	ctx->colCnt = ((symChars*11 + 22 - UCC128_L_PAD - 5)/17) -4;
 	if (ctx->colCnt < 1) {
 		strcpy(ctx->errMsg, "UCC-128 too small");
 		ctx->errFlag = true;
-		return;
+		return(0);
 	}
-	ctx->line1 = true; // so first line is not Y undercut
+	return(symChars);
+}
+
+
+// sizes the CC-C component into colCnt, rowCnt and eccCnt without encoding
+bool gs1_U128Csize(gs1_encoder *ctx) {
+
+	uint8_t linPattern[(UCC128_SYMMAX*6)+3];
+
+	char *ccStr;
+	int ccLen;
+
+	if (U128Cprimary(ctx, linPattern, &ccStr, &ccLen) == 0) return(false);
+	if (ccStr == NULL) {
+		strcpy(ctx->errMsg, "no CC-C component");
+		ctx->errFlag = true;
+		return(false);
+	}
+	return(gs1_CCCsize(ctx, (uint8_t*)ccStr, ccLen));
+}
+
+
+void gs1_U128C(gs1_encoder *ctx) {
+
+	struct sPrints prints;
+	uint8_t *patCCC;
+
+	uint8_t linPattern[(UCC128_SYMMAX*6)+3];
+
+	int i;
+	int ccFlag, symChars, symWidth, ccRpad;
+	char *ccStr;
+	int ccLen;
+
+	if ((symChars = U128Cprimary(ctx, linPattern, &ccStr, &ccLen)) == 0) return;
+	ccFlag = (ccStr != NULL);
 	// init most likely prints values
 	prints.elmCnt = symChars*6+3;
 	prints.pattern = linPattern;
 	prints.guards = false;
-	prints.height = ctx->pixMult*ctx->linHeight;
+	prints.height = ctx->driver_pixMult*ctx->linHeight;
 	prints.leftPad = 0;
 	prints.rightPad = 0;
 	prints.whtFirst = true;
 	prints.reverse = false;
 	if (ccFlag) {
-		if (!gs1_CCCenc(ctx, (uint8_t*)ccStr, patCCC) || ctx->errFlag) return;
+		if (!gs1_CCCenc(ctx, (uint8_t*)ccStr, ccLen) || ctx->errFlag) return;
+		patCCC = ctx->cc_patCCC;
 #if PRNT
 		{
 			int j;
@@ -593,75 +593,41 @@ void gs1_U128C(gs1_encoder *ctx) {
 
 		symWidth = symChars*11+22;
 		ccRpad = symWidth - UCC128_L_PAD - ((ctx->colCnt+4)*17+5);
-		if (ctx->bmp) {
-			// note: BMP is bottom to top inverted
-			gs1_bmpHeader(ctx->pixMult*symWidth,
-					ctx->pixMult*(ctx->rowCnt*3+ctx->linHeight) + ctx->sepHt,
-						 ctx->outfp);
-
-			// UCC-128
-			gs1_printElmnts(ctx, &prints);
-
-			// CC separator pattern
-			prints.elmCnt = symChars*6+1;
-			prints.pattern = &linPattern[1];
-			prints.height = ctx->sepHt;
-			prints.leftPad = 10;
-			prints.rightPad = 10;
-			gs1_printElmnts(ctx, &prints);
-
-			// CC-C
-			prints.elmCnt = (ctx->colCnt+4)*8+3;
-			prints.height = ctx->pixMult*3;
-			prints.leftPad = UCC128_L_PAD;
-			prints.rightPad = ccRpad;
-			for (i = ctx->rowCnt-1; i >= 0; i--) {
-				prints.pattern = &patCCC[i*((ctx->colCnt+4)*8+3)];
-				gs1_printElmnts(ctx, &prints);
-			}
+		gs1_driverInit(ctx, symWidth,
+				ctx->driver_pixMult*(ctx->rowCnt*3+ctx->linHeight) + ctx->sepHt);
+
+		// CC-C
+		prints.elmCnt = (ctx->colCnt+4)*8+3;
+		prints.height = ctx->driver_pixMult*3;
+		prints.leftPad = UCC128_L_PAD;
+		prints.rightPad = ccRpad;
+		for (i = 0; i < ctx->rowCnt; i++) {
+			prints.pattern = &patCCC[i*((ctx->colCnt+4)*8+3)];
+			gs1_driverAddCCRow(ctx, &prints);
 		}
-		else {
-			gs1_tifHeader(ctx->pixMult*symWidth,
-					ctx->pixMult*(ctx->rowCnt*3+ctx->linHeight) + ctx->sepHt,
-						 ctx->outfp);
-
-			// CC-C
-			prints.elmCnt = (ctx->colCnt+4)*8+3;
-			prints.height = ctx->pixMult*3;
-			prints.leftPad = UCC128_L_PAD;
-			prints.rightPad = ccRpad;
-			for (i = 0; i < ctx->rowCnt; i++) {
-				prints.pattern = &patCCC[i*((ctx->colCnt+4)*8+3)];
-				gs1_printElmnts(ctx, &prints);
-			}
 
-			// CC separator pattern
-			prints.elmCnt = symChars*6+1;
-			prints.pattern = &linPattern[1];
-			prints.height = ctx->sepHt;
-			prints.leftPad = 10;
-			prints.rightPad = 10;
-			gs1_printElmnts(ctx, &prints);
-
-			// UCC-128
-			prints.elmCnt = symChars*6+3;
-			prints.pattern = linPattern;
-			prints.height = ctx->pixMult*ctx->linHeight;
-			prints.leftPad = 0;
-			prints.rightPad = 0;
-			gs1_printElmnts(ctx, &prints);
-		}
-	}
-	else { // primary only
-		if (ctx->bmp) {
-			gs1_bmpHeader(ctx->pixMult*(symChars*11+22), ctx->pixMult*ctx->linHeight, ctx->outfp);
-		}
-		else {
-			gs1_tifHeader(ctx->pixMult*(symChars*11+22), ctx->pixMult*ctx->linHeight, ctx->outfp);
-		}
+		// CC separator pattern
+		prints.elmCnt = symChars*6+1;
+		prints.pattern = &linPattern[1];
+		prints.height = ctx->sepHt;
+		prints.leftPad = 10;
+		prints.rightPad = 10;
+		gs1_driverAddRow(ctx, &prints);
 
 		// UCC-128
-		gs1_printElmnts(ctx, &prints);
+		prints.elmCnt = symChars*6+3;
+		prints.pattern = linPattern;
+		prints.height = ctx->driver_pixMult*ctx->linHeight;
+		prints.leftPad = 0;
+		prints.rightPad = 0;
 	}
+	else { // primary only
+		gs1_driverInit(ctx, (symChars*11+22), ctx->driver_pixMult*ctx->linHeight);
+	}
+
+	// UCC-128
+	gs1_driverAddRow(ctx, &prints);
+
+	gs1_driverFinalise(ctx);
 	return;
 }